@@ -237,6 +237,26 @@ int32_t nrf_802154_fal_abort_extend(nrf_ppi_channel_t       channel_to_add,
 int32_t nrf_802154_fal_abort_reduce(nrf_ppi_channel_t       channel_to_remove,
                                     nrf_ppi_channel_group_t group);
 
+/**
+ * @brief Clears up the configuration provided by the @ref nrf_802154_fal_abort_set function.
+ *
+ * @retval   ::NRFX_SUCCESS               Clearing of the abort sequence path is successful.
+ * @retval   ::NRFX_ERROR_FORBIDDEN       Clearing was not done - the possible reason is that there was nothing to clear.
+ */
+int32_t nrf_802154_fal_abort_clear(void);
+#elif defined(NRF53_SERIES)
+/**
+ * @brief Instruct FEM to disable PA and LNA as soon as possible using the group following the event.
+ *
+ * @param[in] event DPPI channel on which the event triggered when the abort condition occurs
+ *                  is published.
+ * @param[in] group DPPI Group which shall be disabled when the abort event is triggered.
+ *
+ * @retval   ::NRFX_SUCCESS               Setting of the abort sequence path is successful.
+ * @retval   ::NRFX_ERROR_FORBIDDEN       Setting of the abort sequence path could not be performed.
+ */
+int32_t nrf_802154_fal_abort_set(uint32_t event, nrf_dppi_channel_group_t group);
+
 /**
  * @brief Clears up the configuration provided by the @ref nrf_802154_fal_abort_set function.
  *
@@ -276,6 +296,20 @@ void nrf_802154_fal_pa_is_configured(int8_t * const p_gain);
 bool nrf_fem_prepare_powerdown(NRF_TIMER_Type  * p_instance,
                                uint32_t          compare_channel,
                                nrf_ppi_channel_t ppi_id);
+#elif defined(NRF53_SERIES)
+/**
+ * @brief Prepares the FEM module to switch to the Power Down state.
+ *
+ * @param[in] p_instance Timer instance that is used to schedule the transition to the Power Down state.
+ * @param[in] compare_channel Compare channel to hold a value for the timer.
+ * @param[in] ppi_id ID of the DPPI channel used to switch to the Power Down state.
+ *
+ * @return bool Whether the scheduling of the transition was successful or not.
+ *
+ */
+bool nrf_fem_prepare_powerdown(NRF_TIMER_Type * p_instance,
+                               uint32_t         compare_channel,
+                               uint8_t          ppi_id);
 #endif // NRF52_SERIES
 
 #endif // NRF_FEM_PROTOCOL_API_H__
@@ -288,6 +288,17 @@ nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_last_rx_best_antenna_get(v
  */
 void nrf_802154_sl_ant_div_timer_irq_handle(void);
 
+/**
+ * @brief Overrides the time between antenna switches in @ref NRF_802154_SL_ANT_DIV_MODE_AUTO.
+ *
+ * The override applies from the next start of the reception. The configuration returned by
+ * @ref nrf_802154_sl_ant_div_cfg_get is not modified.
+ *
+ * @param[in] toggle_time  Time in microseconds between antenna switches, or 0 to use the toggle
+ *                         time of the configuration.
+ */
+void nrf_802154_sl_ant_div_toggle_time_override_set(uint8_t toggle_time);
+
 /**
  * @}
  * @defgroup nrf_802154_ant_div_callout Antenna diversity callouts
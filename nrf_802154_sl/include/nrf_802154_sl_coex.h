@@ -79,6 +79,17 @@ typedef uint32_t nrf_802154_wifi_coex_interface_type_id_t;
 #define NRF_802154_WIFI_COEX_IF_NONE  0x00 /** No coex interface is selected */
 #define NRF_802154_WIFI_COEX_IF_3WIRE 0x01 /** 3-wire coex interface is selected */
 
+/** @brief Coex priorities signalled on the priority line.
+ *
+ * Possible values:
+ * @ref NRF_802154_WIFI_COEX_PRIORITY_NORMAL
+ * @ref NRF_802154_WIFI_COEX_PRIORITY_HIGH
+ */
+typedef uint8_t nrf_802154_wifi_coex_priority_t;
+
+#define NRF_802154_WIFI_COEX_PRIORITY_NORMAL 0x00 /** The operation competes with Wi-Fi at the normal priority. */
+#define NRF_802154_WIFI_COEX_PRIORITY_HIGH   0x01 /** The operation is time-critical and the Wi-Fi side should yield to it. */
+
 /**@brief Pin configuration for wifi coex */
 typedef struct
 {
@@ -165,6 +176,16 @@ void nrf_802154_wifi_coex_cfg_3wire_set(const nrf_802154_wifi_coex_3wire_if_conf
  */
 nrf_802154_wifi_coex_ret_t nrf_802154_wifi_coex_init(void);
 
+/**
+ * @brief Sets the priority signalled to the PTA for the next requests.
+ *
+ * The priority is signalled on the priority line of the 3-wire interface with the request of
+ * the operation that is started next. It applies until this function is called again.
+ *
+ * @param[in] priority  Priority of the next operations.
+ */
+void nrf_802154_wifi_coex_priority_set(nrf_802154_wifi_coex_priority_t priority);
+
 /**
  *@}
  **/
@@ -66,6 +66,38 @@
 #define NRF_802154_SL_RTC_IRQ_PRIORITY 5
 #endif
 
+/**
+ * @def NRF_802154_SL_LP_TIMER_SLACK
+ *
+ * Time in microseconds by which the expiration of the LP timer or of the synchronization timer
+ * can be delayed, so that it is served by the RTC interrupt of the other compare event or of
+ * the already scheduled expiration. Coalescing close expirations reduces the number of
+ * wake-ups at the cost of the timing accuracy.
+ *
+ * Setting this value to 0 disables coalescing.
+ *
+ * @note This configuration is only applicable for the Low Power Timer Abstraction Layer
+ *       implementation in nrf_802154_lp_timer.c.
+ *
+ */
+#ifndef NRF_802154_SL_LP_TIMER_SLACK
+#define NRF_802154_SL_LP_TIMER_SLACK 0
+#endif
+
+/**
+ * @def NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED
+ *
+ * Configures if the initialization of the LP timer is to return without waiting for the LFCLK.
+ * The RTC is started and @ref nrf_802154_lp_timer_ready is called when the LFCLK is running.
+ *
+ * @note This configuration is only applicable for the Low Power Timer Abstraction Layer
+ *       implementations in nrf_802154_lp_timer.c and nrf_802154_lp_timer_none.c.
+ *
+ */
+#ifndef NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED
+#define NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_SL_TIMESTAMP_ENABLED
  *
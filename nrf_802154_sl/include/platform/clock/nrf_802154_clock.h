@@ -99,6 +99,24 @@ void nrf_802154_clock_hfclk_stop(void);
  */
 bool nrf_802154_clock_hfclk_is_running(void);
 
+/**
+ * @brief Requests the High Frequency Clock ahead of a scheduled radio operation.
+ *
+ * This request is independent of @ref nrf_802154_clock_hfclk_start and
+ * @ref nrf_802154_clock_hfclk_stop. The High Frequency Clock keeps running as long as any of
+ * the requests holds it. When the High Frequency Clock is ready,
+ * @ref nrf_802154_clock_hfclk_prestart_ready() is called.
+ *
+ * @note Implementations whose clock driver starts the High Frequency Clock ahead of radio
+ *       activity on their own may leave this function empty.
+ */
+void nrf_802154_clock_hfclk_prestart(void);
+
+/**
+ * @brief Releases the request made with @ref nrf_802154_clock_hfclk_prestart.
+ */
+void nrf_802154_clock_hfclk_prestart_release(void);
+
 /**
  * @brief Starts the Low Frequency Clock.
  *
@@ -126,6 +144,12 @@ bool nrf_802154_clock_lfclk_is_running(void);
  */
 extern void nrf_802154_clock_hfclk_ready(void);
 
+/**
+ * @brief Callback function executed when the High Frequency Clock requested with
+ *        @ref nrf_802154_clock_hfclk_prestart is ready.
+ */
+extern void nrf_802154_clock_hfclk_prestart_ready(void);
+
 /**
  * @brief Callback function executed when the Low Frequency Clock is ready.
  */
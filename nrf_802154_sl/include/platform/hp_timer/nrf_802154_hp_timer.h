@@ -145,6 +145,25 @@ uint32_t nrf_802154_hp_timer_timestamp_task_get(void);
  */
 uint32_t nrf_802154_hp_timer_timestamp_get(void);
 
+/**
+ * @brief Gets the task used to capture the end of a frame.
+ *
+ * Unlike @ref nrf_802154_hp_timer_timestamp_task_get, the capture channel behind this task is
+ * dedicated to frame timestamps and is not shared with the timer coordinator, so the task can
+ * stay connected to the radio for as long as the radio is in use.
+ *
+ * @returns  Address of the task.
+ */
+uint32_t nrf_802154_hp_timer_frame_timestamp_task_get(void);
+
+/**
+ * @brief Gets the timestamp of the last event that triggered
+ *        the @ref nrf_802154_hp_timer_frame_timestamp_task_get task.
+ *
+ * @returns  Timestamp of the last frame end captured by the timer.
+ */
+uint32_t nrf_802154_hp_timer_frame_timestamp_get(void);
+
 /**
  *@}
  **/
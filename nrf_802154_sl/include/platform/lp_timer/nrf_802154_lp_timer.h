@@ -79,6 +79,10 @@ extern "C" {
 
 /**
  * @brief Initializes the Timer.
+ *
+ * If @ref NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED is set, this function only requests
+ * the LFCLK and returns. The Timer is started when the LFCLK is running and
+ * @ref nrf_802154_lp_timer_ready is called then. Otherwise, this function waits for the LFCLK.
  */
 void nrf_802154_lp_timer_init(void);
 
@@ -117,6 +121,18 @@ void nrf_802154_lp_timer_critical_section_exit(void);
  */
 uint32_t nrf_802154_lp_timer_time_get(void);
 
+/**
+ * @brief Gets the current time as a 64-bit value.
+ *
+ * The 32 least significant bits of the returned value are equal to the value returned by
+ * @ref nrf_802154_lp_timer_time_get at the same moment.
+ *
+ * @pre The timer must be initialized with @ref nrf_802154_lp_timer_init().
+ *
+ * @returns Current time in microseconds.
+ */
+uint64_t nrf_802154_lp_timer_time64_get(void);
+
 /**
  * @brief Gets the granularity of the timer.
  *
@@ -209,6 +225,15 @@ extern void nrf_802154_lp_timer_fired(void);
  */
 extern void nrf_802154_lp_timer_synchronized(void);
 
+/**
+ * @brief Callback function executed when the Timer is started after a deferred initialization.
+ *
+ * This function is called only if @ref NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED is set.
+ * It may be called from the context of @ref nrf_802154_lp_timer_init if the LFCLK is already
+ * running.
+ */
+extern void nrf_802154_lp_timer_ready(void);
+
 /**
  *@}
  **/
@@ -114,6 +114,20 @@ void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr);
  */
 bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp);
 
+/**
+ * @brief Gets the estimated drift between the HP timer and the LP timer.
+ *
+ * The drift is estimated from the history of the synchronizations by
+ * @ref nrf_802154_timer_drift_get. The timestamps returned by
+ * @ref nrf_802154_timer_coord_timestamp_get are corrected by this drift.
+ *
+ * @param[out]  p_drift_ppb  Drift of the HP timer relative to the LP timer, in parts per billion.
+ *
+ * @retval true   The drift was estimated.
+ * @retval false  The drift is not estimated yet, or the implementation does not support it.
+ */
+bool nrf_802154_timer_coord_drift_get(int32_t * p_drift_ppb);
+
 /**
  *@}
  **/
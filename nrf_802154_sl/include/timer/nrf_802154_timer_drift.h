@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2018 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @brief Module that estimates the frequency offset between the HP timer and the LP timer.
+ *
+ */
+
+#ifndef NRF_802154_TIMER_DRIFT_H_
+#define NRF_802154_TIMER_DRIFT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_timer_drift Timer drift estimator
+ * @{
+ * @ingroup nrf_802154_timer_coord
+ * @brief Estimator of the drift between the HP timer and the LP timer.
+ *
+ * The Timer Coordinator passes every synchronization point of the HP timer and the LP timer to
+ * this module. The drift is the slope of a least-squares line fitted to the difference between
+ * the times counted by both timers over the recent synchronization points. It is used to correct
+ * the conversion of the HP timer captures to the LP time between the synchronizations.
+ */
+
+/**
+ * @brief Initializes the drift estimator and drops the estimate.
+ */
+void nrf_802154_timer_drift_init(void);
+
+/**
+ * @brief Drops the synchronization history after the HP timer was restarted.
+ *
+ * The last estimate is kept until a new one is calculated, as the drift changes slowly.
+ */
+void nrf_802154_timer_drift_restart(void);
+
+/**
+ * @brief Adds a synchronization point.
+ *
+ * @param[in]  lp_time  LP time of the synchronization event, in microseconds.
+ * @param[in]  hp_time  HP timer value captured at the synchronization event, in microseconds.
+ */
+void nrf_802154_timer_drift_sync_point_add(uint32_t lp_time, uint32_t hp_time);
+
+/**
+ * @brief Gets the estimated drift.
+ *
+ * @param[out]  p_drift_ppb  Drift of the HP timer relative to the LP timer, in parts per billion.
+ *                           A positive value means that the HP timer runs faster.
+ *
+ * @retval true   The drift was estimated.
+ * @retval false  The synchronization history is too short to estimate the drift.
+ */
+bool nrf_802154_timer_drift_get(int32_t * p_drift_ppb);
+
+/**
+ * @brief Converts an HP timer value to the LP time using the last synchronization point.
+ *
+ * The time elapsed since the synchronization point is corrected by the estimated drift.
+ *
+ * @param[in]   hp_time    HP timer value to convert, in microseconds.
+ * @param[out]  p_lp_time  Corresponding LP time, in microseconds.
+ *
+ * @retval true   The time was converted.
+ * @retval false  There is no synchronization point since the HP timer was restarted.
+ */
+bool nrf_802154_timer_drift_hp_to_lp(uint32_t hp_time, uint32_t * p_lp_time);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TIMER_DRIFT_H_ */
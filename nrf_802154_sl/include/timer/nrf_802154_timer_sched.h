@@ -143,6 +143,10 @@ uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_
  * @note Fields @c t0, @c dt, @c callback and @c p_context must be filled in @p p_timer before
  *       calling this function. The @c callback field cannot be NULL.
  *
+ * @note Any number of timers can run at once. A single callback function can serve several
+ *       timers, which are told apart by their @c p_context. A timer that is not running can be
+ *       filled in again and re-added, also from its own callback function.
+ *
  * @note Due to the timer granularity, the callback function cannot be called exactly
  *       at the specified time. Use @p round_up to specify if the given timer should expire before
  *       or after the time given in the @p p_timer structure. The @c dt field of the @p p_timer
@@ -174,6 +178,16 @@ void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_ru
  */
 bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer);
 
+/**
+ * @brief Gets the expiration time of the earliest running timer.
+ *
+ * @param[out]  p_time  Expiration time of the timer in microseconds.
+ *
+ * @retval true   @p p_time is set.
+ * @retval false  No timer is running.
+ */
+bool nrf_802154_timer_sched_next_expiration_get(uint32_t * p_time);
+
 /**
  *@}
  **/
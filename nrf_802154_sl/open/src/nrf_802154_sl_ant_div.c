@@ -104,6 +104,11 @@ nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_last_rx_best_antenna_get(v
     return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
 }
 
+void nrf_802154_sl_ant_div_toggle_time_override_set(uint8_t toggle_time)
+{
+    (void)toggle_time;
+}
+
 bool nrf_802154_sl_ant_div_rx_frame_started_notify(void)
 {
     return false;
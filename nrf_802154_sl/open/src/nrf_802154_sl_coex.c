@@ -71,6 +71,13 @@ bool nrf_802154_wifi_coex_is_enabled(void)
     return false;
 }
 
+void nrf_802154_wifi_coex_priority_set(nrf_802154_wifi_coex_priority_t priority)
+{
+    (void)priority;
+
+    return;
+}
+
 #ifdef __cplusplus
 }
 #endif
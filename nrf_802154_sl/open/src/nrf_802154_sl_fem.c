@@ -102,6 +102,20 @@ int32_t nrf_802154_fal_abort_clear(void)
     return NRFX_ERROR_FORBIDDEN;
 }
 
+#elif defined(NRF53_SERIES)
+int32_t nrf_802154_fal_abort_set(uint32_t event, nrf_dppi_channel_group_t group)
+{
+    (void)event;
+    (void)group;
+
+    return NRFX_ERROR_FORBIDDEN;
+}
+
+int32_t nrf_802154_fal_abort_clear(void)
+{
+    return NRFX_ERROR_FORBIDDEN;
+}
+
 #endif // NRF52_SERIES
 
 void nrf_802154_fal_cleanup(void)
@@ -127,6 +141,18 @@ bool nrf_fem_prepare_powerdown(NRF_TIMER_Type  * p_instance,
     return false;
 }
 
+#elif defined(NRF53_SERIES)
+bool nrf_fem_prepare_powerdown(NRF_TIMER_Type * p_instance,
+                               uint32_t         compare_channel,
+                               uint8_t          ppi_id)
+{
+    (void)p_instance;
+    (void)compare_channel;
+    (void)ppi_id;
+
+    return false;
+}
+
 #endif // NRF52_SERIES
 
 int8_t nrf_802154_fal_tx_power_get(const uint8_t channel, const int8_t power)
@@ -51,6 +51,85 @@ static void timeout_handler(struct k_timer * timer_id);
 
 K_TIMER_DEFINE(timer, timeout_handler, NULL);
 
+/**@brief Head of the list of running timers, sorted by expiration time. */
+static nrf_802154_timer_t * volatile mp_head;
+
+/**@brief Gets the expiration time of the given timer. */
+static inline uint32_t timer_target_get(const nrf_802154_timer_t * p_timer)
+{
+    return p_timer->t0 + p_timer->dt;
+}
+
+/**@brief Checks if @p p_first expires earlier than @p p_second.
+ *
+ * The signed difference of the targets keeps the order correct across the timer wrap-around,
+ * also for a timer that is already expired when it is added.
+ */
+static inline bool timer_expires_before(const nrf_802154_timer_t * p_first,
+                                        const nrf_802154_timer_t * p_second)
+{
+    return (int32_t)(timer_target_get(p_first) - timer_target_get(p_second)) < 0;
+}
+
+/**@brief Checks if the given timer is expired at @p now. */
+static inline bool timer_is_expired(const nrf_802154_timer_t * p_timer, uint32_t now)
+{
+    return !nrf_802154_timer_sched_time_is_in_future(now, p_timer->t0, p_timer->dt);
+}
+
+/**@brief Removes the given timer from the list.
+ *
+ * @note This function must be called from a critical section.
+ *
+ * @retval true   The timer was removed.
+ * @retval false  The timer was not in the list.
+ */
+static bool timer_unlink(nrf_802154_timer_t * p_timer)
+{
+    nrf_802154_timer_t * volatile * pp_item = &mp_head;
+
+    while (*pp_item != NULL)
+    {
+        if (*pp_item == p_timer)
+        {
+            *pp_item        = p_timer->p_next;
+            p_timer->p_next = NULL;
+
+            return true;
+        }
+
+        pp_item = &(*pp_item)->p_next;
+    }
+
+    return false;
+}
+
+/**@brief Arms the kernel timer for the head of the list, or stops it if the list is empty.
+ *
+ * @note This function must be called from a critical section.
+ */
+static void hw_timer_rearm(void)
+{
+    nrf_802154_timer_t * p_head = mp_head;
+
+    if (p_head == NULL)
+    {
+        k_timer_stop(&timer);
+        return;
+    }
+
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    if (timer_is_expired(p_head, now))
+    {
+        k_timer_start(&timer, K_NO_WAIT, K_NO_WAIT);
+    }
+    else
+    {
+        k_timer_start(&timer, K_USEC(timer_target_get(p_head) - now), K_NO_WAIT);
+    }
+}
+
 void nrf_802154_timer_coord_init(void)
 {
     // Intentionally empty
@@ -71,14 +150,26 @@ void nrf_802154_timer_coord_stop(void)
     // Intentionally empty
 }
 
+bool nrf_802154_timer_coord_drift_get(int32_t * p_drift_ppb)
+{
+    (void)p_drift_ppb;
+
+    // This implementation uses the system timer only, without the HP timer to be synchronized.
+    return false;
+}
+
 void nrf_802154_timer_sched_init(void)
 {
     BUILD_ASSERT(CONFIG_SYS_CLOCK_TICKS_PER_SEC == NRF_802154_SL_RTC_FREQUENCY);
+
+    mp_head = NULL;
 }
 
 void nrf_802154_timer_sched_deinit(void)
 {
-    // Intentionally empty
+    k_timer_stop(&timer);
+
+    mp_head = NULL;
 }
 
 uint32_t nrf_802154_timer_sched_time_get(void)
@@ -86,67 +177,161 @@ uint32_t nrf_802154_timer_sched_time_get(void)
     return NRF_802154_SL_RTC_TICKS_TO_US(k_uptime_ticks());
 }
 
+uint32_t nrf_802154_timer_sched_granularity_get(void)
+{
+    return NRF_802154_SL_US_PER_TICK;
+}
+
+bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+{
+    int32_t difference = (int32_t)(t0 + dt - now);
+
+    return difference > 0;
+}
+
+uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_timer)
+{
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    if (timer_is_expired(p_timer, now))
+    {
+        return 0;
+    }
+
+    return timer_target_get(p_timer) - now;
+}
+
 void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
 {
+    assert(p_timer->callback != NULL);
+
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    // The kernel never expires a timer before the requested time, so it always rounds up.
     (void)round_up;
-    assert(!(p_timer->p_next)); // Only one timer is allowed to run at a time.
 
-    uint32_t now    = nrf_802154_timer_sched_time_get();
-    uint32_t target = p_timer->t0 + p_timer->dt - now;
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    (void)timer_unlink(p_timer);
+
+    nrf_802154_timer_t * volatile * pp_item = &mp_head;
+
+    while ((*pp_item != NULL) && !timer_expires_before(p_timer, *pp_item))
+    {
+        pp_item = &(*pp_item)->p_next;
+    }
+
+    p_timer->p_next = *pp_item;
+    *pp_item        = p_timer;
+
+    if (mp_head == p_timer)
+    {
+        hw_timer_rearm();
+    }
 
-    k_timer_user_data_set(&timer, (void *)p_timer->callback); // Passing arguments is not supported.
-    k_timer_start(&timer, K_USEC(target), K_NO_WAIT);
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
 }
 
 void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
 {
-    if (k_timer_status_get(&timer) > 0)
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    bool                               was_head;
+    bool                               was_running;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    was_head    = (mp_head == p_timer);
+    was_running = timer_unlink(p_timer);
+
+    if (was_head)
     {
-        /* Timer has expired. */
-        if (p_was_running)
-        {
-            *p_was_running = false;
-        }
+        hw_timer_rearm();
     }
-    else if (k_timer_remaining_get(&timer) == 0)
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    if (p_was_running)
     {
-        /* Timer was stopped (by someone else) before expiring. */
-        if (p_was_running)
-        {
-            *p_was_running = false;
-        }
+        *p_was_running = was_running;
     }
-    else
+}
+
+bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    bool                               result = false;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    for (nrf_802154_timer_t * p_item = mp_head; p_item != NULL; p_item = p_item->p_next)
     {
-        /* Timer is still running. */
-        k_timer_stop(&timer);
-        if (p_was_running)
+        if (p_item == p_timer)
         {
-            *p_was_running = true;
+            result = true;
+            break;
         }
     }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return result;
 }
 
-bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+bool nrf_802154_timer_sched_next_expiration_get(uint32_t * p_time)
 {
-    (void)now;
-    (void)t0;
-    (void)dt;
-    return false;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    bool                               result = false;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    if (mp_head != NULL)
+    {
+        *p_time = timer_target_get(mp_head);
+        result  = true;
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return result;
 }
 
 static void timeout_handler(struct k_timer * timer_id)
 {
-    nrf_802154_timer_callback_t callback =
-        (nrf_802154_timer_callback_t)k_timer_user_data_get(timer_id);
+    (void)timer_id;
 
-    callback(NULL); // Passing arguments is not supported.
-}
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
 
-bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
-{
-    (void)p_timer;
-    return k_timer_status_get(&timer) < 0;
+    // Fire all expired timers. Callbacks are called outside of the critical section, so that
+    // they are allowed to add and remove timers.
+    while (true)
+    {
+        nrf_802154_timer_t        * p_timer;
+        nrf_802154_timer_callback_t callback;
+        void                      * p_context;
+
+        nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+        p_timer = mp_head;
+
+        if ((p_timer == NULL) || !timer_is_expired(p_timer, nrf_802154_timer_sched_time_get()))
+        {
+            hw_timer_rearm();
+            nrf_802154_sl_mcu_critical_exit(mcu_cs);
+            break;
+        }
+
+        mp_head         = p_timer->p_next;
+        p_timer->p_next = NULL;
+
+        // The timer can be filled in again and re-added from a higher priority context as soon as
+        // it leaves the list, so the callback of this expiration is captured here.
+        callback  = p_timer->callback;
+        p_context = p_timer->p_context;
+
+        nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+        callback(p_context);
+    }
 }
 
 void nrf_802154_lp_timer_init(void)
@@ -159,6 +344,11 @@ void nrf_802154_lp_timer_deinit(void)
     // Intentionally empty
 }
 
+uint64_t nrf_802154_lp_timer_time64_get(void)
+{
+    return NRF_802154_SL_RTC_TICKS_TO_US((uint64_t)k_uptime_ticks());
+}
+
 void nrf_802154_lp_timer_critical_section_enter(void)
 {
     // Intentionally empty
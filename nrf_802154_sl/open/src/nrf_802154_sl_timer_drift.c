@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2018 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the drift estimator used by the Timer Coordinator.
+ *
+ */
+
+#include "timer/nrf_802154_timer_drift.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Number of synchronization points used to fit the drift. */
+#define SYNC_POINTS_NUM      8U
+
+/** Minimal time between the first and the last synchronization point to estimate the drift [us].
+ *  Shorter histories make the LP timer granularity dominate the estimate. */
+#define MIN_FIT_SPAN         1000000UL
+
+/** Number of parts per billion in one. */
+#define PPB_PER_ONE          1000000000LL
+
+/** Drift estimates larger than this value are treated as invalid synchronization points [ppb]. */
+#define MAX_DRIFT_PPB        1000000L
+
+/** Synchronization point of the HP timer and the LP timer. */
+typedef struct
+{
+    uint32_t lp_time; ///< LP time of the synchronization event.
+    uint32_t hp_time; ///< HP timer value captured at the synchronization event.
+} sync_point_t;
+
+static sync_point_t     m_points[SYNC_POINTS_NUM]; ///< History of the synchronization points.
+static uint8_t          m_points_cnt;              ///< Number of valid entries in @ref m_points.
+static uint8_t          m_last_idx;                ///< Index of the newest entry in @ref m_points.
+static volatile int32_t m_drift_ppb;               ///< Last drift estimate.
+static volatile bool    m_drift_valid;             ///< If @ref m_drift_ppb holds an estimate.
+
+/** Fit the drift to the synchronization history and update the estimate. */
+static void drift_fit(void)
+{
+    const sync_point_t * p_first = &m_points[(m_last_idx + SYNC_POINTS_NUM + 1U - m_points_cnt) %
+                                             SYNC_POINTS_NUM];
+    const sync_point_t * p_last  = &m_points[m_last_idx];
+
+    if ((m_points_cnt < 2U) || ((p_last->lp_time - p_first->lp_time) < MIN_FIT_SPAN))
+    {
+        return;
+    }
+
+    int64_t sum_x  = 0;
+    int64_t sum_y  = 0;
+    int64_t sum_xx = 0;
+    int64_t sum_xy = 0;
+    int64_t n      = m_points_cnt;
+
+    // x is the LP time and y is the offset of the HP timer, both relative to the oldest point.
+    for (uint8_t i = 0; i < m_points_cnt; i++)
+    {
+        const sync_point_t * p_point = &m_points[(m_last_idx + SYNC_POINTS_NUM - i) %
+                                                 SYNC_POINTS_NUM];
+        int64_t              x       = (int64_t)(uint32_t)(p_point->lp_time - p_first->lp_time);
+        int64_t              y       = (int64_t)(int32_t)((p_point->hp_time - p_first->hp_time) -
+                                                          (p_point->lp_time - p_first->lp_time));
+
+        sum_x  += x;
+        sum_y  += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+
+    int64_t num = (n * sum_xy) - (sum_x * sum_y);
+    int64_t den = (n * sum_xx) - (sum_x * sum_x);
+
+    // The slope is scaled to parts per billion in two steps to avoid an overflow.
+    den /= 1000000LL;
+
+    if (den <= 0)
+    {
+        return;
+    }
+
+    int64_t drift_ppb = (num * 1000LL) / den;
+
+    if ((drift_ppb > MAX_DRIFT_PPB) || (drift_ppb < -MAX_DRIFT_PPB))
+    {
+        return;
+    }
+
+    m_drift_ppb   = (int32_t)drift_ppb;
+    m_drift_valid = true;
+}
+
+void nrf_802154_timer_drift_init(void)
+{
+    m_points_cnt  = 0U;
+    m_last_idx    = 0U;
+    m_drift_ppb   = 0;
+    m_drift_valid = false;
+}
+
+void nrf_802154_timer_drift_restart(void)
+{
+    m_points_cnt = 0U;
+}
+
+void nrf_802154_timer_drift_sync_point_add(uint32_t lp_time, uint32_t hp_time)
+{
+    m_last_idx = (m_points_cnt == 0U) ? 0U : ((m_last_idx + 1U) % SYNC_POINTS_NUM);
+
+    m_points[m_last_idx].lp_time = lp_time;
+    m_points[m_last_idx].hp_time = hp_time;
+
+    if (m_points_cnt < SYNC_POINTS_NUM)
+    {
+        m_points_cnt++;
+    }
+
+    drift_fit();
+}
+
+bool nrf_802154_timer_drift_get(int32_t * p_drift_ppb)
+{
+    if (!m_drift_valid)
+    {
+        return false;
+    }
+
+    *p_drift_ppb = m_drift_ppb;
+
+    return true;
+}
+
+bool nrf_802154_timer_drift_hp_to_lp(uint32_t hp_time, uint32_t * p_lp_time)
+{
+    if (m_points_cnt == 0U)
+    {
+        return false;
+    }
+
+    const sync_point_t * p_sync  = &m_points[m_last_idx];
+    int32_t              elapsed = (int32_t)(hp_time - p_sync->hp_time);
+    int32_t              error   = 0;
+
+    if (m_drift_valid)
+    {
+        // The HP timer counts (1 + drift) microseconds per microsecond of the LP timer.
+        error = (int32_t)(((int64_t)elapsed * m_drift_ppb) / PPB_PER_ONE);
+    }
+
+    *p_lp_time = p_sync->lp_time + (uint32_t)(elapsed - error);
+
+    return true;
+}
@@ -43,11 +43,22 @@
 #include <compiler_abstraction.h>
 #include <nrfx_clock.h>
 
+static volatile bool m_hfclk_started;    ///< If the HFCLK is requested with hfclk_start.
+static volatile bool m_hfclk_prestarted; ///< If the HFCLK is requested with hfclk_prestart.
+
 static void clock_event_handler(nrfx_clock_evt_type_t event)
 {
     if (event == NRFX_CLOCK_EVT_HFCLK_STARTED)
     {
-        nrf_802154_clock_hfclk_ready();
+        if (m_hfclk_prestarted)
+        {
+            nrf_802154_clock_hfclk_prestart_ready();
+        }
+
+        if (m_hfclk_started)
+        {
+            nrf_802154_clock_hfclk_ready();
+        }
     }
 
     if (event == NRFX_CLOCK_EVT_LFCLK_STARTED)
@@ -70,12 +81,38 @@ void nrf_802154_clock_deinit(void)
 
 void nrf_802154_clock_hfclk_start(void)
 {
+    m_hfclk_started = true;
     nrfx_clock_start(NRF_CLOCK_DOMAIN_HFCLK);
 }
 
 void nrf_802154_clock_hfclk_stop(void)
 {
-    nrfx_clock_stop(NRF_CLOCK_DOMAIN_HFCLK);
+    m_hfclk_started = false;
+
+    if (!m_hfclk_prestarted)
+    {
+        nrfx_clock_stop(NRF_CLOCK_DOMAIN_HFCLK);
+    }
+}
+
+void nrf_802154_clock_hfclk_prestart(void)
+{
+    m_hfclk_prestarted = true;
+
+    if (!m_hfclk_started)
+    {
+        nrfx_clock_start(NRF_CLOCK_DOMAIN_HFCLK);
+    }
+}
+
+void nrf_802154_clock_hfclk_prestart_release(void)
+{
+    m_hfclk_prestarted = false;
+
+    if (!m_hfclk_started)
+    {
+        nrfx_clock_stop(NRF_CLOCK_DOMAIN_HFCLK);
+    }
 }
 
 bool nrf_802154_clock_hfclk_is_running(void)
@@ -103,6 +140,11 @@ __WEAK void nrf_802154_clock_hfclk_ready(void)
     // Intentionally empty.
 }
 
+__WEAK void nrf_802154_clock_hfclk_prestart_ready(void)
+{
+    // Intentionally empty.
+}
+
 __WEAK void nrf_802154_clock_lfclk_ready(void)
 {
     // Intentionally empty.
@@ -80,6 +80,16 @@ bool nrf_802154_clock_hfclk_is_running(void)
     return (bool)hfclk_is_running;
 }
 
+void nrf_802154_clock_hfclk_prestart(void)
+{
+    // Intentionally empty. MPSL starts the HFCLK ahead of the timeslots it schedules.
+}
+
+void nrf_802154_clock_hfclk_prestart_release(void)
+{
+    // Intentionally empty.
+}
+
 void nrf_802154_clock_lfclk_start(void)
 {
     // Low frequency clock is started when MPSL is initialized.
@@ -108,6 +118,11 @@ __WEAK void nrf_802154_clock_hfclk_ready(void)
     // Intentionally empty.
 }
 
+__WEAK void nrf_802154_clock_hfclk_prestart_ready(void)
+{
+    // Intentionally empty.
+}
+
 __WEAK void nrf_802154_clock_lfclk_ready(void)
 {
     // Intentionally empty.
@@ -22,6 +22,7 @@
 static bool                hfclk_is_running;
 static bool                lfclk_is_running;
 static struct onoff_client hfclk_cli;
+static struct onoff_client hfclk_prestart_cli;
 static struct onoff_client lfclk_cli;
 
 void nrf_802154_clock_init(void)
@@ -75,6 +76,40 @@ bool nrf_802154_clock_hfclk_is_running(void)
     return hfclk_is_running;
 }
 
+static void hfclk_prestart_on_callback(struct onoff_manager * mgr,
+                                       struct onoff_client  * cli,
+                                       uint32_t               state,
+                                       int                    res)
+{
+    nrf_802154_clock_hfclk_prestart_ready();
+}
+
+void nrf_802154_clock_hfclk_prestart(void)
+{
+    int                    ret;
+    struct onoff_manager * mgr =
+        z_nrf_clock_control_get_onoff(CLOCK_CONTROL_NRF_SUBSYS_HF);
+
+    __ASSERT_NO_MSG(mgr != NULL);
+
+    sys_notify_init_callback(&hfclk_prestart_cli.notify, hfclk_prestart_on_callback);
+
+    ret = onoff_request(mgr, &hfclk_prestart_cli);
+    __ASSERT_NO_MSG(ret >= 0);
+}
+
+void nrf_802154_clock_hfclk_prestart_release(void)
+{
+    int                    ret;
+    struct onoff_manager * mgr =
+        z_nrf_clock_control_get_onoff(CLOCK_CONTROL_NRF_SUBSYS_HF);
+
+    __ASSERT_NO_MSG(mgr != NULL);
+
+    ret = onoff_cancel_or_release(mgr, &hfclk_prestart_cli);
+    __ASSERT_NO_MSG(ret >= 0);
+}
+
 static void lfclk_on_callback(struct onoff_manager * mgr,
                               struct onoff_client  * cli,
                               uint32_t               state,
@@ -121,6 +156,11 @@ __WEAK void nrf_802154_clock_hfclk_ready(void)
     /* Intentionally empty. */
 }
 
+__WEAK void nrf_802154_clock_hfclk_prestart_ready(void)
+{
+    /* Intentionally empty. */
+}
+
 __WEAK void nrf_802154_clock_lfclk_ready(void)
 {
     /* Intentionally empty. */
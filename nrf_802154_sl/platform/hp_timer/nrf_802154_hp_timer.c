@@ -54,6 +54,9 @@
 #define TIMER                 NRF_802154_HIGH_PRECISION_TIMER_INSTANCE
 
 /**@brief Timer compare channel definitions. */
+#define TIMER_CC_FRAME        NRF_TIMER_CC_CHANNEL0
+#define TIMER_CC_FRAME_TASK   NRF_TIMER_TASK_CAPTURE0
+
 #define TIMER_CC_CAPTURE      NRF_TIMER_CC_CHANNEL1
 #define TIMER_CC_CAPTURE_TASK NRF_TIMER_TASK_CAPTURE1
 
@@ -137,6 +140,16 @@ uint32_t nrf_802154_hp_timer_timestamp_get(void)
     return nrf_timer_cc_get(TIMER, TIMER_CC_EVT);
 }
 
+uint32_t nrf_802154_hp_timer_frame_timestamp_task_get(void)
+{
+    return nrf_timer_task_address_get(TIMER, TIMER_CC_FRAME_TASK);
+}
+
+uint32_t nrf_802154_hp_timer_frame_timestamp_get(void)
+{
+    return nrf_timer_cc_get(TIMER, TIMER_CC_FRAME);
+}
+
 uint32_t nrf_802154_hp_timer_current_time_get(void)
 {
     return timer_time_get();
@@ -381,6 +381,72 @@ static void timer_start_at(compare_channel_t channel,
     nrf_rtc_cc_set(NRF_802154_RTC_INSTANCE, m_cmp_ch[channel].channel, target_counter);
 }
 
+/**
+ * @brief Get the time at which an expiration requested for @p target_time is going to be served.
+ *
+ * If any compare channel is already scheduled to fire no later than @ref NRF_802154_SL_LP_TIMER_SLACK
+ * after @p target_time, the expiration is moved to that channel's target time, so that both are
+ * served by the same RTC interrupt.
+ *
+ * @param[in]  target_time  Requested expiration time, rounded up to the timer ticks [us].
+ *
+ * @return  The time at which the expiration is to be scheduled [us].
+ */
+static uint64_t coalesced_target_time_get(uint64_t target_time)
+{
+    uint64_t result = target_time;
+
+#if NRF_802154_SL_LP_TIMER_SLACK > 0
+    uint64_t best_dt = NRF_802154_SL_LP_TIMER_SLACK + 1ULL;
+
+    for (uint32_t i = 0; i < CHANNEL_CNT; i++)
+    {
+        uint64_t scheduled = m_target_times[i];
+
+        if (!nrf_rtc_int_enable_check(NRF_802154_RTC_INSTANCE, m_cmp_ch[i].int_mask) ||
+            (scheduled < target_time))
+        {
+            continue;
+        }
+
+        if ((scheduled - target_time) < best_dt)
+        {
+            best_dt = scheduled - target_time;
+            result  = scheduled;
+        }
+    }
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Start timer on desired channel, coalescing its expiration with already scheduled ones.
+ *
+ * @param[in]  channel  Compare channel on which timer will be started.
+ * @param[in]  t0       Number of microseconds representing timer start time.
+ * @param[in]  dt       Time of timer expiration as time elapsed from @p t0 [us].
+ * @param[in]  p_now    Pointer to data with the current time.
+ */
+static void timer_coalesced_start_at(compare_channel_t channel,
+                                     uint32_t          t0,
+                                     uint32_t          dt,
+                                     const uint64_t  * p_now)
+{
+#if NRF_802154_SL_LP_TIMER_SLACK > 0
+    uint64_t target_time = round_up_to_timer_ticks_multiply(convert_to_64bit_time(t0, dt, p_now));
+    uint64_t coalesced   = coalesced_target_time_get(target_time);
+
+    if (coalesced != target_time)
+    {
+        t0 = (uint32_t)coalesced;
+        dt = 0;
+    }
+#endif
+
+    timer_start_at(channel, t0, dt, p_now);
+}
+
 /**
  * @brief Start synchronization timer at given time.
  *
@@ -390,26 +456,14 @@ static void timer_start_at(compare_channel_t channel,
  */
 static void timer_sync_start_at(uint32_t t0, uint32_t dt, const uint64_t * p_now)
 {
-    timer_start_at(SYNC_CHANNEL, t0, dt, p_now);
+    timer_coalesced_start_at(SYNC_CHANNEL, t0, dt, p_now);
 
     nrf_rtc_int_enable(NRF_802154_RTC_INSTANCE, m_cmp_ch[SYNC_CHANNEL].int_mask);
 }
 
-void nrf_802154_lp_timer_init(void)
+/** @brief Configures and starts the RTC once the LFCLK is running. */
+static void rtc_start(void)
 {
-    m_offset_counter                 = 0;
-    m_target_times[LP_TIMER_CHANNEL] = 0;
-    m_clock_ready                    = false;
-    m_lp_timer_irq_enabled           = 0;
-
-    // Setup low frequency clock.
-    nrf_802154_clock_lfclk_start();
-
-    while (!m_clock_ready)
-    {
-        // Intentionally empty
-    }
-
     // Setup RTC timer.
 #if !NRF_802154_IRQ_PRIORITY_ALLOWED(NRF_802154_SL_RTC_IRQ_PRIORITY)
 #error NRF_802154_SL_RTC_IRQ_PRIORITY value out of the allowed range.
@@ -432,6 +486,26 @@ void nrf_802154_lp_timer_init(void)
     nrf_rtc_task_trigger(NRF_802154_RTC_INSTANCE, NRF_RTC_TASK_START);
 }
 
+void nrf_802154_lp_timer_init(void)
+{
+    m_offset_counter                 = 0;
+    m_target_times[LP_TIMER_CHANNEL] = 0;
+    m_clock_ready                    = false;
+    m_lp_timer_irq_enabled           = 0;
+
+    // Setup low frequency clock.
+    nrf_802154_clock_lfclk_start();
+
+#if !NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED
+    while (!m_clock_ready)
+    {
+        // Intentionally empty
+    }
+
+    rtc_start();
+#endif
+}
+
 void nrf_802154_lp_timer_deinit(void)
 {
     nrf_rtc_task_trigger(NRF_802154_RTC_INSTANCE, NRF_RTC_TASK_STOP);
@@ -476,6 +550,11 @@ uint32_t nrf_802154_lp_timer_time_get(void)
     return (uint32_t)curr_time_get();
 }
 
+uint64_t nrf_802154_lp_timer_time64_get(void)
+{
+    return curr_time_get();
+}
+
 uint32_t nrf_802154_lp_timer_granularity_get(void)
 {
     return NRF_802154_SL_US_PER_TICK;
@@ -490,7 +569,7 @@ void nrf_802154_lp_timer_start(uint32_t t0, uint32_t dt)
     offset_and_counter_get(&offset, &rtc_value);
     now = time_get(offset, rtc_value);
 
-    timer_start_at(LP_TIMER_CHANNEL, t0, dt, &now);
+    timer_coalesced_start_at(LP_TIMER_CHANNEL, t0, dt, &now);
 
     if (rtc_value != counter_get())
     {
@@ -564,6 +643,11 @@ uint32_t nrf_802154_lp_timer_sync_time_get(void)
 void nrf_802154_clock_lfclk_ready(void)
 {
     m_clock_ready = true;
+
+#if NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED
+    rtc_start();
+    nrf_802154_lp_timer_ready();
+#endif
 }
 
 static void rtc_irq_handler(void)
@@ -627,4 +711,9 @@ __WEAK void nrf_802154_lp_timer_synchronized(void)
     // Intentionally empty
 }
 
+__WEAK void nrf_802154_lp_timer_ready(void)
+{
+    // Intentionally empty
+}
+
 #endif // UNITY_ON_TARGET
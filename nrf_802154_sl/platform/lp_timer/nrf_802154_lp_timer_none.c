@@ -39,9 +39,14 @@
 
 #include "nrf_802154_lp_timer.h"
 
+#include "nrf_802154_sl_config.h"
+
 void nrf_802154_lp_timer_init(void)
 {
-    // Intentionally empty
+#if NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED
+    // There is no timer to wait for.
+    nrf_802154_lp_timer_ready();
+#endif
 }
 
 void nrf_802154_lp_timer_deinit(void)
@@ -39,61 +39,145 @@
 #include "nrf_802154_ack_data.h"
 
 #include <assert.h>
+#include <stddef.h>
 #include <string.h>
 
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_ram_usage.h"
+#include "nrf_802154_utils.h"
 
 /// Maximum number of Short Addresses of nodes for which there is ACK data to set.
 #define NUM_SHORT_ADDRESSES    NRF_802154_PENDING_SHORT_ADDRESSES
 /// Maximum number of Extended Addresses of nodes for which there is ACK data to set.
 #define NUM_EXTENDED_ADDRESSES NRF_802154_PENDING_EXTENDED_ADDRESSES
 
-/// Structure representing pending bit setting variables.
-typedef struct
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+#if (NUM_SHORT_ADDRESSES < 1) || (NUM_EXTENDED_ADDRESSES < 1)
+#error ACK data hash tables require at least one slot for each address type.
+#endif
+
+/// Number of slots of the hash tables of Short Addresses. At least half of them is always empty.
+#define SHORT_ADDR_SLOTS    (2 * NUM_SHORT_ADDRESSES)
+/// Number of slots of the hash tables of Extended Addresses. At least half of them is always empty.
+#define EXTENDED_ADDR_SLOTS (2 * NUM_EXTENDED_ADDRESSES)
+
+#else // NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/// Number of entries of the sorted arrays of Short Addresses.
+#define SHORT_ADDR_SLOTS    NUM_SHORT_ADDRESSES
+/// Number of entries of the sorted arrays of Extended Addresses.
+#define EXTENDED_ADDR_SLOTS NUM_EXTENDED_ADDRESSES
+
+#endif // NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/// Number of chunks of the IE arena. Each chunk holds the IE records of a single peer node.
+#define IE_ARENA_CHUNKS (NRF_802154_ACK_IE_ARENA_SIZE / NRF_802154_MAX_ACK_IE_SIZE)
+
+#if IE_ARENA_CHUNKS < 1
+#error NRF_802154_ACK_IE_ARENA_SIZE is too small to hold IE records of a single peer node.
+#endif
+
+#if IE_ARENA_CHUNKS > UINT16_MAX
+#error NRF_802154_ACK_IE_ARENA_SIZE is too large.
+#endif
+
+// Structure representing all ACK data set for a single peer node.
+struct nrf_802154_ack_data_peer_s
 {
-    bool     enabled;                                                      /// If setting pending bit is enabled.
-    uint8_t  short_addr[NUM_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];          /// Array of short addresses of nodes for which there is pending data in the buffer.
-    uint8_t  extended_addr[NUM_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE]; /// Array of extended addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_short_addr;                                            /// Current number of short addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_ext_addr;                                              /// Current number of extended addresses of nodes for which there is pending data in the buffer.
-} pending_bit_arrays_t;
+    bool     pending_bit; /// If the pending bit is to be set in ACKs sent to the peer node.
+    bool     ie_present;  /// If IE records are to be included in ACKs sent to the peer node.
+    uint8_t  ie_len;      /// Length of the IE records.
+    uint16_t ie_chunk;    /// Index of the chunk of @ref m_ie_arena holding the IE records.
+};
 
-// Structure representing a single IE record.
+// Structure representing ACK data sent to a given short address.
 typedef struct
 {
-    uint8_t p_data[NRF_802154_MAX_ACK_IE_SIZE]; /// Pointer to IE data buffer.
-    uint8_t len;                                /// Length of the buffer.
-} ie_data_t;
+    uint8_t                    addr[SHORT_ADDRESS_SIZE]; /// Short address of peer node.
+    nrf_802154_ack_data_peer_t data;                     /// ACK data sent to the peer node.
+} short_peer_t;
 
-// Structure representing IE records sent in an ACK message to a given short address.
+// Structure representing ACK data sent to a given extended address.
 typedef struct
 {
-    uint8_t   addr[SHORT_ADDRESS_SIZE]; /// Short address of peer node.
-    ie_data_t ie_data;                  /// Pointer to IE records.
-} ack_short_ie_data_t;
+    uint8_t                    addr[EXTENDED_ADDRESS_SIZE]; /// Extended address of peer node.
+    nrf_802154_ack_data_peer_t data;                        /// ACK data sent to the peer node.
+} ext_peer_t;
 
-// Structure representing IE records sent in an ACK message to a given extended address.
+// Structure representing the list of peer nodes with short addresses.
 typedef struct
 {
-    uint8_t   addr[EXTENDED_ADDRESS_SIZE]; /// Extended address of peer node.
-    ie_data_t ie_data;                     /// Pointer to IE records.
-} ack_ext_ie_data_t;
-
-// Structure representing IE data setting variables.
+    uint32_t     count;                   /// Current number of peer nodes stored in @p peers.
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+    bool         used[SHORT_ADDR_SLOTS];  /// If a slot of @p peers is occupied.
+#endif
+    short_peer_t peers[SHORT_ADDR_SLOTS]; /// Array of short addresses and ACK data sent to these addresses.
+} short_peer_list_t;
+
+// Structure representing the list of peer nodes with extended addresses.
 typedef struct
 {
-    ack_short_ie_data_t short_data[NUM_SHORT_ADDRESSES];  /// Array of short addresses and IE records sent to these addresses.
-    ack_ext_ie_data_t   ext_data[NUM_EXTENDED_ADDRESSES]; /// Array of extended addresses and IE records sent to these addresses.
-    uint32_t            num_of_short_data;                /// Current number of short addresses stored in @p short_data.
-    uint32_t            num_of_ext_data;                  /// Current number of extended addresses stored in @p ext_data.
-} ie_arrays_t;
+    uint32_t   count;                      /// Current number of peer nodes stored in @p peers.
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+    bool       used[EXTENDED_ADDR_SLOTS];  /// If a slot of @p peers is occupied.
+#endif
+    ext_peer_t peers[EXTENDED_ADDR_SLOTS]; /// Array of extended addresses and ACK data sent to these addresses.
+} ext_peer_list_t;
+
+// Structure representing the lists of peer nodes for which there is ACK data to set.
+typedef struct
+{
+    bool              enabled;    /// If setting pending bit is enabled.
+    short_peer_list_t short_list; /// List of peer nodes with short addresses.
+    ext_peer_list_t   ext_list;   /// List of peer nodes with extended addresses.
+} peer_arrays_t;
+
+// Spare list in which bulk updates of either list of peer nodes are prepared.
+typedef union
+{
+    short_peer_list_t short_list;
+    ext_peer_list_t   ext_list;
+} peer_list_shadow_t;
 
-// TODO: Combine below arrays to perform binary search only once per Ack generation.
-static pending_bit_arrays_t        m_pending_bit;
-static ie_arrays_t                 m_ie;
+/// Description of a single list of peer nodes.
+typedef struct
+{
+    uint8_t  * p_entries;   ///< Entries of the list. Each entry begins with an address.
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+    bool     * p_used;      ///< Occupancy of the slots.
+#endif
+    uint32_t * p_count;     ///< Number of stored peer nodes.
+    uint32_t   capacity;    ///< Maximum number of stored peer nodes.
+    uint32_t   slots;       ///< Number of entries.
+    uint8_t    entry_size;  ///< Size of a single entry.
+    uint8_t    data_offset; ///< Offset of the ACK data in an entry.
+} peer_table_t;
+
+static peer_arrays_t               m_peers;
+static peer_list_shadow_t          m_peers_shadow;
 static nrf_802154_src_addr_match_t m_src_matching_method;
+static volatile uint32_t           m_ie_generation; ///< Incremented on every change of the IE data.
+
+/// Lists of peer nodes used for lookups, indexed by the address type. Each one points to its list
+/// in @ref m_peers, except while a bulk update prepared in @ref m_peers_shadow is being published.
+static void * volatile mp_peer_lists[2];
+
+/// Function deciding the pending bit instead of the list, or NULL if the list is used.
+static volatile nrf_802154_pending_bit_decider_t m_pending_bit_decider;
+
+/// IE records of all peer nodes, each one in a chunk of the maximum size.
+static uint8_t  m_ie_arena[IE_ARENA_CHUNKS][NRF_802154_MAX_ACK_IE_SIZE];
+static uint16_t m_ie_free_chunks[IE_ARENA_CHUNKS]; ///< Stack of indexes of free chunks of @ref m_ie_arena.
+static uint16_t m_ie_free_count;                   ///< Number of indexes on @ref m_ie_free_chunks.
+
+NRF_802154_RAM_USAGE_REPORT(ack_data,
+                            sizeof(m_peers) + sizeof(m_peers_shadow) +
+                            sizeof(m_ie_arena) + sizeof(m_ie_free_chunks));
 
 /***************************************************************************************************
  * @section Array handling helper functions
@@ -187,46 +271,455 @@ static int8_t addr_compare(const uint8_t * p_first_addr,
     }
 }
 
+
+/**
+ * @brief Get the description of the given list of peer nodes.
+ *
+ * @param[in]  p_list     Pointer to a @ref short_peer_list_t or an @ref ext_peer_list_t.
+ * @param[in]  extended   Indication if the list holds extended or short addresses.
+ * @param[out] p_table    Description of the list.
+ */
+static void peer_table_describe(void * p_list, bool extended, peer_table_t * p_table)
+{
+    if (extended)
+    {
+        ext_peer_list_t * p_ext_list = (ext_peer_list_t *)p_list;
+
+        p_table->p_entries   = (uint8_t *)p_ext_list->peers;
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+        p_table->p_used      = p_ext_list->used;
+#endif
+        p_table->p_count     = &p_ext_list->count;
+        p_table->capacity    = NUM_EXTENDED_ADDRESSES;
+        p_table->slots       = EXTENDED_ADDR_SLOTS;
+        p_table->entry_size  = sizeof(ext_peer_t);
+        p_table->data_offset = offsetof(ext_peer_t, data);
+    }
+    else
+    {
+        short_peer_list_t * p_short_list = (short_peer_list_t *)p_list;
+
+        p_table->p_entries   = (uint8_t *)p_short_list->peers;
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+        p_table->p_used      = p_short_list->used;
+#endif
+        p_table->p_count     = &p_short_list->count;
+        p_table->capacity    = NUM_SHORT_ADDRESSES;
+        p_table->slots       = SHORT_ADDR_SLOTS;
+        p_table->entry_size  = sizeof(short_peer_t);
+        p_table->data_offset = offsetof(short_peer_t, data);
+    }
+}
+
+/**
+ * @brief Get the list of peer nodes with the given address type.
+ *
+ * @param[in]  extended   Indication if the list holds extended or short addresses.
+ * @param[out] p_table    Description of the list.
+ */
+static void peer_table_get(bool extended, peer_table_t * p_table)
+{
+    peer_table_describe(mp_peer_lists[extended ? 1 : 0], extended, p_table);
+}
+
+/**
+ * @brief Get the ACK data stored in the given entry of a list of peer nodes.
+ *
+ * @param[in]  p_table   Description of the list.
+ * @param[in]  location  Index of the entry.
+ *
+ * @returns  Pointer to the ACK data of the peer node.
+ */
+static nrf_802154_ack_data_peer_t * peer_data_get(const peer_table_t * p_table, uint32_t location)
+{
+    return (nrf_802154_ack_data_peer_t *)(p_table->p_entries +
+                                          p_table->entry_size * location +
+                                          p_table->data_offset);
+}
+
+/**
+ * @brief Check if a peer node has no ACK data set.
+ *
+ * @param[in]  p_peer  Pointer to the ACK data of the peer node.
+ *
+ * @retval true   No ACK data is set for the peer node.
+ * @retval false  Some ACK data is set for the peer node.
+ */
+static bool peer_data_is_empty(const nrf_802154_ack_data_peer_t * p_peer)
+{
+    return !p_peer->pending_bit && !p_peer->ie_present;
+}
+
+/**
+ * @brief Restore the max-heap property of an array of addresses below the given node.
+ *
+ * @param[inout] p_addrs   Array of addresses.
+ * @param[in]    root      Index of the node to sift down.
+ * @param[in]    count     Number of addresses in the heap.
+ * @param[in]    extended  Indication if @p p_addrs contains extended or short addresses.
+ */
+static void addr_heap_sift_down(uint8_t * p_addrs, uint32_t root, uint32_t count, bool extended)
+{
+    uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint8_t tmp[EXTENDED_ADDRESS_SIZE];
+
+    while ((2 * root + 1) < count)
+    {
+        uint32_t child = 2 * root + 1;
+
+        if (((child + 1) < count) &&
+            (addr_compare(p_addrs + addr_size * child,
+                          p_addrs + addr_size * (child + 1),
+                          extended) < 0))
+        {
+            child++;
+        }
+
+        if (addr_compare(p_addrs + addr_size * root, p_addrs + addr_size * child, extended) >= 0)
+        {
+            return;
+        }
+
+        memcpy(tmp, p_addrs + addr_size * root, addr_size);
+        memcpy(p_addrs + addr_size * root, p_addrs + addr_size * child, addr_size);
+        memcpy(p_addrs + addr_size * child, tmp, addr_size);
+
+        root = child;
+    }
+}
+
+/**
+ * @brief Sort an array of addresses in ascending order and remove duplicates from it.
+ *
+ * Heapsort is used, because it works in place and its running time does not depend on the order
+ * of the input.
+ *
+ * @param[inout] p_addrs   Array of addresses.
+ * @param[in]    count     Number of addresses in @p p_addrs.
+ * @param[in]    extended  Indication if @p p_addrs contains extended or short addresses.
+ *
+ * @returns  Number of unique addresses placed at the beginning of @p p_addrs.
+ */
+static uint32_t addr_array_sort(uint8_t * p_addrs, uint32_t count, bool extended)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint8_t  tmp[EXTENDED_ADDRESS_SIZE];
+    uint32_t unique;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    for (uint32_t i = count / 2; i > 0; i--)
+    {
+        addr_heap_sift_down(p_addrs, i - 1, count, extended);
+    }
+
+    for (uint32_t end = count - 1; end > 0; end--)
+    {
+        memcpy(tmp, p_addrs, addr_size);
+        memcpy(p_addrs, p_addrs + addr_size * end, addr_size);
+        memcpy(p_addrs + addr_size * end, tmp, addr_size);
+
+        addr_heap_sift_down(p_addrs, 0, end, extended);
+    }
+
+    unique = 1;
+
+    for (uint32_t i = 1; i < count; i++)
+    {
+        if (addr_compare(p_addrs + addr_size * (unique - 1), p_addrs + addr_size * i, extended) != 0)
+        {
+            memmove(p_addrs + addr_size * unique, p_addrs + addr_size * i, addr_size);
+            unique++;
+        }
+    }
+
+    return unique;
+}
+
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/**
+ * @brief Check if the given entry of a list of peer nodes is occupied.
+ *
+ * @param[in]  p_table   Description of the list.
+ * @param[in]  location  Index of the entry.
+ *
+ * @retval true   The entry stores a peer node.
+ * @retval false  The entry is free.
+ */
+static bool peer_entry_is_used(const peer_table_t * p_table, uint32_t location)
+{
+    return p_table->p_used[location];
+}
+
+/**
+ * @brief Get the slot at which an address is placed if there are no collisions.
+ *
+ * @param[in]  p_addr    Pointer to an address.
+ * @param[in]  extended  Indication if @p p_addr is an extended or a short address.
+ * @param[in]  slots     Number of slots of the table.
+ *
+ * @returns  Index of the home slot of @p p_addr.
+ */
+static uint32_t addr_home_slot_get(const uint8_t * p_addr, bool extended, uint32_t slots)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint32_t hash      = 2166136261UL; // FNV-1a offset basis
+
+    for (uint32_t i = 0; i < addr_size; i++)
+    {
+        hash ^= p_addr[i];
+        hash *= 16777619UL; // FNV-1a prime
+    }
+
+    return hash % slots;
+}
+
 /**
- * @brief Perform a binary search for an address in a list of addresses.
+ * @brief Find an address in a hash table of peer nodes.
  *
  * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[in]  p_addr_array     Pointer to a list of addresses to be searched.
- * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
- *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
- *                              (ascending order assumed).
+ * @param[in]  p_table          Description of the table to be searched.
+ * @param[out] p_location       If the address @p p_addr appears in the table, this is index of its slot.
+ *                              Otherwise, it is the index of the free slot @p p_addr would be placed in.
  * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
  *
- * @retval true   Address @p p_addr is in the list.
- * @retval false  Address @p p_addr is not in the list.
+ * @retval true   Address @p p_addr is in the table.
+ * @retval false  Address @p p_addr is not in the table.
  */
-static bool addr_binary_search(const uint8_t       * p_addr,
-                               const uint8_t       * p_addr_array,
-                               uint32_t            * p_location,
-                               nrf_802154_ack_data_t data_type,
-                               bool                  extended)
+static bool addr_index_find(const uint8_t      * p_addr,
+                            const peer_table_t * p_table,
+                            uint32_t           * p_location,
+                            bool                 extended)
 {
-    uint32_t addr_array_len = 0;
-    uint8_t  entry_size     = 0;
+    uint32_t slot = addr_home_slot_get(p_addr, extended, p_table->slots);
 
-    switch (data_type)
+    // The loop ends, because the table always has free slots.
+    while (p_table->p_used[slot])
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            entry_size     = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
-            addr_array_len = extended ?
-                             m_pending_bit.num_of_ext_addr : m_pending_bit.num_of_short_addr;
-            break;
+        if (addr_compare(p_addr, p_table->p_entries + p_table->entry_size * slot, extended) == 0)
+        {
+            *p_location = slot;
+            return true;
+        }
 
-        case NRF_802154_ACK_DATA_IE:
-            entry_size     = extended ? sizeof(ack_ext_ie_data_t) : sizeof(ack_short_ie_data_t);
-            addr_array_len = extended ? m_ie.num_of_ext_data : m_ie.num_of_short_data;
-            break;
+        slot = (slot + 1) % p_table->slots;
+    }
 
-        default:
-            assert(false);
-            break;
+    *p_location = slot;
+    return false;
+}
+
+/**
+ * @brief Add an address to a hash table of peer nodes.
+ *
+ * @param[in]  p_addr           Pointer to the address to be added.
+ * @param[in]  p_table          Description of the table.
+ * @param[in]  location         Index of the free slot found by @ref addr_index_find.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr has been added to the table successfully.
+ * @retval false  Address @p p_addr could not be added to the table.
+ */
+static bool addr_add(const uint8_t      * p_addr,
+                     const peer_table_t * p_table,
+                     uint32_t             location,
+                     bool                 extended)
+{
+    if (*p_table->p_count == p_table->capacity)
+    {
+        return false;
+    }
+
+    assert(!p_table->p_used[location]);
+
+    memcpy(p_table->p_entries + p_table->entry_size * location,
+           p_addr,
+           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+    memset(peer_data_get(p_table, location), 0, sizeof(nrf_802154_ack_data_peer_t));
+
+    p_table->p_used[location] = true;
+    (*p_table->p_count)++;
+
+    return true;
+}
+
+/**
+ * @brief Remove an address from a hash table of peer nodes.
+ *
+ * Entries following the removed one in its probe sequence are moved back to fill the gap, so that
+ * no deleted markers are needed and lookups stay short.
+ *
+ * @param[in]  p_table      Description of the table.
+ * @param[in]  location     Index of the slot to be freed.
+ * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ *
+ * @retval true   Address has been removed from the table successfully.
+ * @retval false  Address could not removed from the table.
+ */
+static bool addr_remove(const peer_table_t * p_table, uint32_t location, bool extended)
+{
+    if (!p_table->p_used[location])
+    {
+        return false;
     }
 
+    uint32_t hole = location;
+    uint32_t next = (hole + 1) % p_table->slots;
+
+    while (p_table->p_used[next])
+    {
+        uint8_t * p_next = p_table->p_entries + p_table->entry_size * next;
+        uint32_t  home   = addr_home_slot_get(p_next, extended, p_table->slots);
+        bool      stays;
+
+        // The entry stays if its home slot is cyclically within (hole, next].
+        if (hole <= next)
+        {
+            stays = (hole < home) && (home <= next);
+        }
+        else
+        {
+            stays = (hole < home) || (home <= next);
+        }
+
+        if (!stays)
+        {
+            memcpy(p_table->p_entries + p_table->entry_size * hole, p_next, p_table->entry_size);
+            hole = next;
+        }
+
+        next = (next + 1) % p_table->slots;
+    }
+
+    p_table->p_used[hole] = false;
+    (*p_table->p_count)--;
+
+    return true;
+}
+
+/**
+ * @brief Set the pending bit for all addresses from a sorted array of unique addresses.
+ *
+ * @param[in]  p_table   Description of the table to be updated.
+ * @param[in]  p_addrs   Sorted array of unique addresses.
+ * @param[in]  count     Number of addresses in @p p_addrs.
+ * @param[in]  extended  Indication if @p p_addrs contains extended or short addresses.
+ *
+ * @retval true   The pending bit has been set for all addresses.
+ * @retval false  Not enough free entries in the table. The table was not modified.
+ */
+static bool pending_bit_bulk_set(const peer_table_t * p_table,
+                                 const uint8_t      * p_addrs,
+                                 uint32_t             count,
+                                 bool                 extended)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint32_t missing = 0;
+    uint32_t location;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!addr_index_find(p_addrs + addr_size * i, p_table, &location, extended))
+        {
+            missing++;
+        }
+    }
+
+    if ((*p_table->p_count + missing) > p_table->capacity)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const uint8_t * p_addr = p_addrs + addr_size * i;
+
+        if (!addr_index_find(p_addr, p_table, &location, extended))
+        {
+            bool result = addr_add(p_addr, p_table, location, extended);
+
+            assert(result);
+            (void)result;
+        }
+
+        peer_data_get(p_table, location)->pending_bit = true;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Clear the pending bit for all addresses from a sorted array of unique addresses.
+ *
+ * @param[in]  p_table   Description of the table to be updated.
+ * @param[in]  p_addrs   Sorted array of unique addresses.
+ * @param[in]  count     Number of addresses in @p p_addrs.
+ * @param[in]  extended  Indication if @p p_addrs contains extended or short addresses.
+ */
+static void pending_bit_bulk_clear(const peer_table_t * p_table,
+                                   const uint8_t      * p_addrs,
+                                   uint32_t             count,
+                                   bool                 extended)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint32_t location;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (addr_index_find(p_addrs + addr_size * i, p_table, &location, extended))
+        {
+            nrf_802154_ack_data_peer_t * p_peer = peer_data_get(p_table, location);
+
+            p_peer->pending_bit = false;
+
+            if (peer_data_is_empty(p_peer))
+            {
+                (void)addr_remove(p_table, location, extended);
+            }
+        }
+    }
+}
+
+#else // NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/**
+ * @brief Check if the given entry of a list of peer nodes is occupied.
+ *
+ * @param[in]  p_table   Description of the list.
+ * @param[in]  location  Index of the entry.
+ *
+ * @retval true   The entry stores a peer node.
+ * @retval false  The entry is free.
+ */
+static bool peer_entry_is_used(const peer_table_t * p_table, uint32_t location)
+{
+    return location < *p_table->p_count;
+}
+
+/**
+ * @brief Perform a binary search for an address in a list of peer nodes.
+ *
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[in]  p_table          Description of the list to be searched.
+ * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
+ *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
+ *                              (ascending order assumed).
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr is in the list.
+ * @retval false  Address @p p_addr is not in the list.
+ */
+static bool addr_binary_search(const uint8_t      * p_addr,
+                               const peer_table_t * p_table,
+                               uint32_t           * p_location,
+                               bool                 extended)
+{
+    uint32_t addr_array_len = *p_table->p_count;
+
     // The actual algorithm
     int32_t  low      = 0;
     uint32_t midpoint = 0;
@@ -241,7 +734,7 @@ static bool addr_binary_search(const uint8_t       * p_addr,
             break;
         }
 
-        switch (addr_compare(p_addr, p_addr_array + entry_size * midpoint, extended))
+        switch (addr_compare(p_addr, p_table->p_entries + p_table->entry_size * midpoint, extended))
         {
             case -1:
                 high = (int32_t)(midpoint - 1);
@@ -278,9 +771,10 @@ static bool addr_binary_search(const uint8_t       * p_addr,
 }
 
 /**
- * @brief Find an address in a list of addresses.
+ * @brief Find an address in a list of peer nodes.
  *
  * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[in]  p_table          Description of the list to be searched.
  * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
  *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
  *                              (ascending order assumed).
@@ -289,80 +783,294 @@ static bool addr_binary_search(const uint8_t       * p_addr,
  * @retval true   Address @p p_addr is in the list.
  * @retval false  Address @p p_addr is not in the list.
  */
-static bool addr_index_find(const uint8_t       * p_addr,
-                            uint32_t            * p_location,
-                            nrf_802154_ack_data_t data_type,
-                            bool                  extended)
+static bool addr_index_find(const uint8_t      * p_addr,
+                            const peer_table_t * p_table,
+                            uint32_t           * p_location,
+                            bool                 extended)
 {
-    uint8_t * p_addr_array;
-    bool      valid_data_type = true;
+    return addr_binary_search(p_addr, p_table, p_location, extended);
+}
 
-    switch (data_type)
+/**
+ * @brief Add an address to the list of peer nodes in ascending order.
+ *
+ * @param[in]  p_addr           Pointer to the address to be added.
+ * @param[in]  p_table          Description of the list.
+ * @param[in]  location         Index of the location where @p p_addr should be added.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr has been added to the list successfully.
+ * @retval false  Address @p p_addr could not be added to the list.
+ */
+static bool addr_add(const uint8_t      * p_addr,
+                     const peer_table_t * p_table,
+                     uint32_t             location,
+                     bool                 extended)
+{
+    if (*p_table->p_count == p_table->capacity)
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            p_addr_array = extended ? (uint8_t *)m_pending_bit.extended_addr :
-                           (uint8_t *)m_pending_bit.short_addr;
-            break;
+        return false;
+    }
 
-        case NRF_802154_ACK_DATA_IE:
-            p_addr_array = extended ? (uint8_t *)m_ie.ext_data : (uint8_t *)m_ie.short_data;
-            break;
+    memmove(p_table->p_entries + p_table->entry_size * (location + 1),
+            p_table->p_entries + p_table->entry_size * (location),
+            (*p_table->p_count - location) * p_table->entry_size);
 
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
+    memcpy(p_table->p_entries + p_table->entry_size * location,
+           p_addr,
+           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+    memset(peer_data_get(p_table, location), 0, sizeof(nrf_802154_ack_data_peer_t));
+
+    (*p_table->p_count)++;
+
+    return true;
+}
+
+/**
+ * @brief Remove an address from the list of peer nodes keeping it in ascending order.
+ *
+ * @param[in]  p_table      Description of the list.
+ * @param[in]  location     Index of the element to be removed from the list.
+ * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ *
+ * @retval true   Address has been removed from the list successfully.
+ * @retval false  Address could not removed from the list.
+ */
+static bool addr_remove(const peer_table_t * p_table, uint32_t location, bool extended)
+{
+    if (location >= *p_table->p_count)
+    {
+        return false;
+    }
+
+    memmove(p_table->p_entries + p_table->entry_size * location,
+            p_table->p_entries + p_table->entry_size * (location + 1),
+            (*p_table->p_count - location - 1) * p_table->entry_size);
+
+    (*p_table->p_count)--;
+
+    return true;
+}
+
+
+/**
+ * @brief Set the pending bit for all addresses from a sorted array of unique addresses.
+ *
+ * The list is updated with a single merge pass, which moves every entry at most once.
+ *
+ * @param[in]  p_table   Description of the list to be updated.
+ * @param[in]  p_addrs   Sorted array of unique addresses.
+ * @param[in]  count     Number of addresses in @p p_addrs.
+ * @param[in]  extended  Indication if @p p_addrs contains extended or short addresses.
+ *
+ * @retval true   The pending bit has been set for all addresses.
+ * @retval false  Not enough free entries in the list. The list was not modified.
+ */
+static bool pending_bit_bulk_set(const peer_table_t * p_table,
+                                 const uint8_t      * p_addrs,
+                                 uint32_t             count,
+                                 bool                 extended)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint32_t missing   = 0;
+    uint32_t i         = 0;
+    uint32_t j         = 0;
+
+    // Count the addresses which are not on the list yet.
+    while (j < count)
+    {
+        int8_t cmp = (i < *p_table->p_count) ?
+                     addr_compare(p_table->p_entries + p_table->entry_size * i,
+                                  p_addrs + addr_size * j,
+                                  extended) : 1;
+
+        if (cmp <= 0)
+        {
+            i++;
+        }
+
+        if (cmp >= 0)
+        {
+            missing += (cmp > 0) ? 1 : 0;
+            j++;
+        }
+    }
+
+    if ((*p_table->p_count + missing) > p_table->capacity)
+    {
+        return false;
     }
 
-    if (!valid_data_type)
+    // Merge from the end, so that every entry is moved directly to its final location.
+    uint32_t read  = *p_table->p_count;
+    uint32_t write = *p_table->p_count + missing;
+
+    j = count;
+
+    while (j > 0)
+    {
+        const uint8_t * p_addr = p_addrs + addr_size * (j - 1);
+        int8_t          cmp    = (read > 0) ?
+                                 addr_compare(p_table->p_entries + p_table->entry_size * (read - 1),
+                                              p_addr,
+                                              extended) : -1;
+
+        write--;
+
+        if (cmp >= 0)
+        {
+            read--;
+
+            if (write != read)
+            {
+                memcpy(p_table->p_entries + p_table->entry_size * write,
+                       p_table->p_entries + p_table->entry_size * read,
+                       p_table->entry_size);
+            }
+        }
+
+        if (cmp <= 0)
+        {
+            if (cmp < 0)
+            {
+                memcpy(p_table->p_entries + p_table->entry_size * write, p_addr, addr_size);
+                memset(peer_data_get(p_table, write), 0, sizeof(nrf_802154_ack_data_peer_t));
+            }
+
+            peer_data_get(p_table, write)->pending_bit = true;
+            j--;
+        }
+    }
+
+    *p_table->p_count += missing;
+
+    return true;
+}
+
+/**
+ * @brief Clear the pending bit for all addresses from a sorted array of unique addresses.
+ *
+ * The list is updated with a single merge pass, which moves every entry at most once.
+ *
+ * @param[in]  p_table   Description of the list to be updated.
+ * @param[in]  p_addrs   Sorted array of unique addresses.
+ * @param[in]  count     Number of addresses in @p p_addrs.
+ * @param[in]  extended  Indication if @p p_addrs contains extended or short addresses.
+ */
+static void pending_bit_bulk_clear(const peer_table_t * p_table,
+                                   const uint8_t      * p_addrs,
+                                   uint32_t             count,
+                                   bool                 extended)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint32_t write     = 0;
+    uint32_t j         = 0;
+
+    for (uint32_t read = 0; read < *p_table->p_count; read++)
+    {
+        uint8_t                    * p_entry = p_table->p_entries + p_table->entry_size * read;
+        nrf_802154_ack_data_peer_t * p_peer  = peer_data_get(p_table, read);
+
+        while ((j < count) && (addr_compare(p_addrs + addr_size * j, p_entry, extended) < 0))
+        {
+            j++;
+        }
+
+        if ((j < count) && (addr_compare(p_addrs + addr_size * j, p_entry, extended) == 0))
+        {
+            p_peer->pending_bit = false;
+
+            if (peer_data_is_empty(p_peer))
+            {
+                continue;
+            }
+        }
+
+        if (write != read)
+        {
+            memcpy(p_table->p_entries + p_table->entry_size * write, p_entry, p_table->entry_size);
+        }
+
+        write++;
+    }
+
+    *p_table->p_count = write;
+}
+
+#endif // NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/**
+ * @brief Check if the frame has a source address.
+ *
+ * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ *
+ * @retval true   The frame has a short or an extended source address.
+ * @retval false  The frame has no source address.
+ */
+static bool src_addr_is_present(const uint8_t * p_frame)
+{
+    return nrf_802154_frame_parser_src_addr_is_extended(p_frame) ||
+           nrf_802154_frame_parser_src_addr_is_short(p_frame);
+}
+
+/**
+ * @brief Get the source address matching method for the frame being acknowledged.
+ *
+ * @returns  Matching method of the PAN context matched by the frame being acknowledged.
+ */
+static nrf_802154_src_addr_match_t src_matching_method_get(void)
+{
+#if NRF_802154_PAN_CONTEXTS > 1
+    const nrf_802154_pan_context_t * p_context =
+        nrf_802154_pib_pan_context_get(nrf_802154_filter_pan_context_get());
+
+    if (p_context != NULL)
     {
-        return false;
+        return p_context->src_match_method;
     }
+#endif
 
-    return addr_binary_search(p_addr, p_addr_array, p_location, data_type, extended);
+    return m_src_matching_method;
 }
 
 /**
  * @brief Thread implementation of the address matching algorithm.
  *
  * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_peer   ACK data of the source of @p p_frame or NULL if there is none.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_thread(const uint8_t * p_frame)
+static bool addr_match_thread(const uint8_t * p_frame, const nrf_802154_ack_data_peer_t * p_peer)
 {
-    bool            extended;
-    uint32_t        location;
-    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
-
     // The pending bit is set by default.
-    if (!m_pending_bit.enabled || (NULL == p_src_addr))
+    if (!m_peers.enabled || !src_addr_is_present(p_frame))
     {
         return true;
     }
 
-    return addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_PENDING_BIT, extended);
+    return (p_peer != NULL) && p_peer->pending_bit;
 }
 
 /**
  * @brief Zigbee implementation of the address matching algorithm.
  *
  * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_peer   ACK data of the source of @p p_frame or NULL if there is none.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_zigbee(const uint8_t * p_frame)
+static bool addr_match_zigbee(const uint8_t * p_frame, const nrf_802154_ack_data_peer_t * p_peer)
 {
-    uint8_t                            frame_type;
-    nrf_802154_frame_parser_mhr_data_t mhr_fields;
-    uint32_t                           location;
-    const uint8_t                    * p_cmd = p_frame;
-    bool                               ret   = false;
+    uint8_t                                    frame_type;
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields;
+    const uint8_t                            * p_cmd = p_frame;
+    bool                                       ret   = false;
 
     // If ack data generator module is disabled do not perform check, return true by default.
-    if (!m_pending_bit.enabled)
+    if (!m_peers.enabled)
     {
         return true;
     }
@@ -371,12 +1079,14 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
     frame_type = (p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK);
 
     // Parse the MAC header and retrieve the command type.
-    if (nrf_802154_frame_parser_mhr_parse(p_frame, &mhr_fields))
+    p_mhr_fields = nrf_802154_frame_parser_mhr_parse_cached(p_frame);
+
+    if (p_mhr_fields != NULL)
     {
         // Note: Security header is not included in the offset.
         // If security is to be used at any point, additional calculation
         // in nrf_802154_frame_parser_mhr_parse needs to be implemented.
-        p_cmd += mhr_fields.addressing_end_offset;
+        p_cmd += p_mhr_fields->addressing_end_offset;
     }
     else
     {
@@ -389,13 +1099,10 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
     if ((frame_type == FRAME_TYPE_COMMAND) && (*p_cmd == MAC_CMD_DATA_REQ))
     {
         // Check addressing type - in long case address, pb should always be 1.
-        if (mhr_fields.src_addr_size == SHORT_ADDRESS_SIZE)
+        if (p_mhr_fields->src_addr_size == SHORT_ADDRESS_SIZE)
         {
-            // Return true if address is not found on the m_pending_bits list.
-            ret = !addr_index_find(mhr_fields.p_src_addr,
-                                   &location,
-                                   NRF_802154_ACK_DATA_PENDING_BIT,
-                                   false);
+            // Return true if address is not found on the pending bit list.
+            ret = (p_peer == NULL) || !p_peer->pending_bit;
         }
         else
         {
@@ -413,176 +1120,224 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
  * Higher layer should ensure empty data frame with no AR is sent afterwards.
  *
  * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_peer   ACK data of the source of @p p_frame or NULL if there is none.
  *
  * @retval true   Pending bit is to be set.
  */
-static bool addr_match_standard_compliant(const uint8_t * p_frame)
+static bool addr_match_standard_compliant(const uint8_t                    * p_frame,
+                                          const nrf_802154_ack_data_peer_t * p_peer)
 {
     (void)p_frame;
+    (void)p_peer;
     return true;
 }
 
 /**
- * @brief Add an address to the address list in ascending order.
- *
- * @param[in]  p_addr           Pointer to the address to be added.
- * @param[in]  location         Index of the location where @p p_addr should be added.
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ * @brief Release the IE records of a peer node and return their chunk to the arena.
  *
- * @retval true   Address @p p_addr has been added to the list successfully.
- * @retval false  Address @p p_addr could not be added to the list.
+ * @param[in]  p_peer  Pointer to the ACK data of the peer node.
  */
-static bool addr_add(const uint8_t       * p_addr,
-                     uint32_t              location,
-                     nrf_802154_ack_data_t data_type,
-                     bool                  extended)
+static void ie_arena_release(nrf_802154_ack_data_peer_t * p_peer)
 {
-    uint32_t * p_addr_array_len;
-    uint32_t   max_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
-
-    switch (data_type)
+    if (!p_peer->ie_present)
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.extended_addr;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_ext_addr;
-                entry_size         = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.short_addr;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_short_addr;
-                entry_size         = SHORT_ADDRESS_SIZE;
-            }
-            break;
+        return;
+    }
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_ie.ext_data;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_ext_data;
-                entry_size         = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_ie.short_data;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_short_data;
-                entry_size         = sizeof(ack_short_ie_data_t);
-            }
-            break;
+    // The ACK generator stops reading the chunk as soon as the flag is cleared, so the chunk
+    // can be reused at once. Nothing is moved, so no critical section is needed.
+    p_peer->ie_present                  = false;
+    m_ie_free_chunks[m_ie_free_count++] = p_peer->ie_chunk;
+}
 
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
+/**
+ * @brief Store the IE records of a peer node in the arena.
+ *
+ * A peer node which already has IE records keeps its chunk and the records are overwritten
+ * in place. Otherwise, a free chunk is taken from the arena.
+ *
+ * @param[in]  p_peer    Pointer to the ACK data of the peer node.
+ * @param[in]  p_data    Pointer to the IE records.
+ * @param[in]  data_len  Length of the IE records.
+ *
+ * @retval true   The IE records have been stored.
+ * @retval false  The IE records are too long or there is no free chunk in the arena.
+ *                The previous IE records of the peer node were kept.
+ */
+static bool ie_arena_store(nrf_802154_ack_data_peer_t * p_peer,
+                           const uint8_t              * p_data,
+                           uint8_t                      data_len)
+{
+    if (data_len > NRF_802154_MAX_ACK_IE_SIZE)
+    {
+        return false;
+    }
+
+    if (p_peer->ie_present)
+    {
+        memcpy(m_ie_arena[p_peer->ie_chunk], p_data, data_len);
+        p_peer->ie_len = data_len;
+        return true;
     }
 
-    if (!valid_data_type || (*p_addr_array_len == max_addr_array_len))
+    if (m_ie_free_count == 0)
     {
         return false;
     }
 
-    memmove(p_addr_array + entry_size * (location + 1),
-            p_addr_array + entry_size * (location),
-            (*p_addr_array_len - location) * entry_size);
+    p_peer->ie_chunk = m_ie_free_chunks[--m_ie_free_count];
+    p_peer->ie_len   = data_len;
+    memcpy(m_ie_arena[p_peer->ie_chunk], p_data, data_len);
 
-    memcpy(p_addr_array + entry_size * location,
-           p_addr,
-           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+    // The records must be complete before the ACK generator can find them.
+    __DMB();
 
-    (*p_addr_array_len)++;
+    p_peer->ie_present = true;
 
     return true;
 }
 
 /**
- * @brief Remove an address from the address list keeping it in ascending order.
+ * @brief Set the ACK data of the given type for a peer node.
  *
- * @param[in]  location     Index of the element to be removed from the list.
- * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ * @param[in]  p_peer    Pointer to the ACK data of the peer node.
+ * @param[in]  data_type Type of data to be set.
+ * @param[in]  p_data    Pointer to the data to be set.
+ * @param[in]  data_len  Length of the @p p_data buffer.
  *
- * @retval true   Address @p p_addr has been removed from the list successfully.
- * @retval false  Address @p p_addr could not removed from the list.
+ * @retval true   The data has been set.
+ * @retval false  The data could not be set.
  */
-static bool addr_remove(uint32_t location, nrf_802154_ack_data_t data_type, bool extended)
+static bool peer_data_set(nrf_802154_ack_data_peer_t * p_peer,
+                          nrf_802154_ack_data_t        data_type,
+                          const uint8_t              * p_data,
+                          uint8_t                      data_len)
 {
-    uint32_t * p_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
+    bool result;
 
     switch (data_type)
     {
         case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_pending_bit.extended_addr;
-                p_addr_array_len = &m_pending_bit.num_of_ext_addr;
-                entry_size       = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array     = (uint8_t *)m_pending_bit.short_addr;
-                p_addr_array_len = &m_pending_bit.num_of_short_addr;
-                entry_size       = SHORT_ADDRESS_SIZE;
-            }
+            p_peer->pending_bit = true;
+            result              = true;
             break;
 
         case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_ie.ext_data;
-                p_addr_array_len = &m_ie.num_of_ext_data;
-                entry_size       = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array     = (uint8_t *)m_ie.short_data;
-                p_addr_array_len = &m_ie.num_of_short_data;
-                entry_size       = sizeof(ack_short_ie_data_t);
-            }
+            result = ie_arena_store(p_peer, p_data, data_len);
+            m_ie_generation++;
             break;
 
         default:
-            valid_data_type = false;
+            result = false;
             assert(false);
             break;
     }
 
-    if (!valid_data_type || (*p_addr_array_len == 0))
+    return result;
+}
+
+/**
+ * @brief Clear the ACK data of the given type for a peer node.
+ *
+ * @param[in]  p_peer    Pointer to the ACK data of the peer node.
+ * @param[in]  data_type Type of data to be cleared.
+ *
+ * @retval true   The data was set before.
+ * @retval false  The data was not set.
+ */
+static bool peer_data_clear(nrf_802154_ack_data_peer_t * p_peer, nrf_802154_ack_data_t data_type)
+{
+    bool was_set;
+
+    switch (data_type)
     {
-        return false;
+        case NRF_802154_ACK_DATA_PENDING_BIT:
+            was_set             = p_peer->pending_bit;
+            p_peer->pending_bit = false;
+            break;
+
+        case NRF_802154_ACK_DATA_IE:
+            was_set = p_peer->ie_present;
+            ie_arena_release(p_peer);
+            m_ie_generation++;
+            break;
+
+        default:
+            was_set = false;
+            assert(false);
+            break;
     }
 
-    memmove(p_addr_array + entry_size * location,
-            p_addr_array + entry_size * (location + 1),
-            (*p_addr_array_len - location - 1) * entry_size);
+    return was_set;
+}
 
-    (*p_addr_array_len)--;
+/**
+ * @brief Get the list of peer nodes with the given address type stored in @ref m_peers.
+ *
+ * @param[in]  extended  Indication if the list holds extended or short addresses.
+ *
+ * @returns  Pointer to the list.
+ */
+static void * peer_list_home_get(bool extended)
+{
+    return extended ? (void *)&m_peers.ext_list : (void *)&m_peers.short_list;
+}
 
-    return true;
+/**
+ * @brief Get the size of the list of peer nodes with the given address type.
+ *
+ * @param[in]  extended  Indication if the list holds extended or short addresses.
+ *
+ * @returns  Size of the list in bytes.
+ */
+static size_t peer_list_size_get(bool extended)
+{
+    return extended ? sizeof(ext_peer_list_t) : sizeof(short_peer_list_t);
 }
 
-static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data, uint8_t data_len)
+/**
+ * @brief Make the given list of peer nodes the one used for lookups.
+ *
+ * @param[in]  p_list    Pointer to the list.
+ * @param[in]  extended  Indication if the list holds extended or short addresses.
+ */
+static void peer_list_publish(void * p_list, bool extended)
 {
-    if (extended)
-    {
-        memcpy(m_ie.ext_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.ext_data[location].ie_data.len = data_len;
-    }
-    else
-    {
-        memcpy(m_ie.short_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.short_data[location].ie_data.len = data_len;
-    }
+    // The list must be completely written before the ACK generator can find it.
+    __DMB();
+
+    mp_peer_lists[extended ? 1 : 0] = p_list;
+}
+
+/**
+ * @brief Copy a list of peer nodes to @ref m_peers_shadow, so that it can be updated there.
+ *
+ * @param[in]  extended  Indication if the list holds extended or short addresses.
+ * @param[out] p_table   Description of the copy.
+ */
+static void peer_list_shadow_prepare(bool extended, peer_table_t * p_table)
+{
+    memcpy(&m_peers_shadow, peer_list_home_get(extended), peer_list_size_get(extended));
+    peer_table_describe(&m_peers_shadow, extended, p_table);
+}
+
+/**
+ * @brief Publish the list of peer nodes updated in @ref m_peers_shadow.
+ *
+ * Lookups switch to the updated list with a single pointer write. The list in @ref m_peers is then
+ * no longer read, so it is brought up to date without blocking interrupts and used again.
+ *
+ * @param[in]  extended  Indication if the list holds extended or short addresses.
+ */
+static void peer_list_shadow_commit(bool extended)
+{
+    void * p_home = peer_list_home_get(extended);
+
+    peer_list_publish(&m_peers_shadow, extended);
+
+    memcpy(p_home, &m_peers_shadow, peer_list_size_get(extended));
+
+    peer_list_publish(p_home, extended);
 }
 
 /***************************************************************************************************
@@ -591,16 +1346,25 @@ static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data
 
 void nrf_802154_ack_data_init(void)
 {
-    memset(&m_pending_bit, 0, sizeof(m_pending_bit));
-    memset(&m_ie, 0, sizeof(m_ie));
+    memset(&m_peers, 0, sizeof(m_peers));
+
+    for (uint16_t i = 0; i < IE_ARENA_CHUNKS; i++)
+    {
+        m_ie_free_chunks[i] = IE_ARENA_CHUNKS - 1 - i;
+    }
+
+    m_ie_free_count = IE_ARENA_CHUNKS;
+
+    mp_peer_lists[0] = &m_peers.short_list;
+    mp_peer_lists[1] = &m_peers.ext_list;
 
-    m_pending_bit.enabled = true;
+    m_peers.enabled       = true;
     m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
 }
 
 void nrf_802154_ack_data_enable(bool enabled)
 {
-    m_pending_bit.enabled = enabled;
+    m_peers.enabled = enabled;
 }
 
 bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
@@ -609,68 +1373,122 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
                                       const void          * p_data,
                                       uint8_t               data_len)
 {
-    uint32_t location = 0;
+    uint32_t                     location = 0;
+    peer_table_t                 table;
+    nrf_802154_ack_data_peer_t * p_peer;
 
-    if (addr_index_find(p_addr, &location, data_type, extended) ||
-        addr_add(p_addr, location, data_type, extended))
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
     {
-        if (data_type == NRF_802154_ACK_DATA_IE)
-        {
-            ie_data_add(location, extended, p_data, data_len);
-        }
+        assert(false);
+        return false;
+    }
 
-        return true;
+    peer_table_get(extended, &table);
+
+    if (!addr_index_find(p_addr, &table, &location, extended) &&
+        !addr_add(p_addr, &table, location, extended))
+    {
+        return false;
     }
-    else
+
+    p_peer = peer_data_get(&table, location);
+
+    if (!peer_data_set(p_peer, data_type, p_data, data_len))
     {
+        // Do not keep a peer node which has just been added without any data.
+        if (peer_data_is_empty(p_peer))
+        {
+            (void)addr_remove(&table, location, extended);
+        }
+
         return false;
     }
+
+    return true;
 }
 
 bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
                                         bool                  extended,
                                         nrf_802154_ack_data_t data_type)
 {
-    uint32_t location = 0;
+    uint32_t                     location = 0;
+    peer_table_t                 table;
+    nrf_802154_ack_data_peer_t * p_peer;
 
-    if (addr_index_find(p_addr, &location, data_type, extended))
+    peer_table_get(extended, &table);
+
+    if (!addr_index_find(p_addr, &table, &location, extended))
     {
-        return addr_remove(location, data_type, extended);
+        return false;
     }
-    else
+
+    p_peer = peer_data_get(&table, location);
+
+    if (!peer_data_clear(p_peer, data_type))
+    {
+        return false;
+    }
+
+    if (peer_data_is_empty(p_peer))
+    {
+        return addr_remove(&table, location, extended);
+    }
+
+    return true;
+}
+
+bool nrf_802154_ack_data_pending_bit_bulk_set(uint8_t * p_addrs, uint32_t count, bool extended)
+{
+    peer_table_t table;
+
+    count = addr_array_sort(p_addrs, count, extended);
+
+    peer_list_shadow_prepare(extended, &table);
+
+    if (!pending_bit_bulk_set(&table, p_addrs, count, extended))
     {
         return false;
     }
+
+    peer_list_shadow_commit(extended);
+
+    return true;
+}
+
+void nrf_802154_ack_data_pending_bit_bulk_clear(uint8_t * p_addrs, uint32_t count, bool extended)
+{
+    peer_table_t table;
+
+    count = addr_array_sort(p_addrs, count, extended);
+
+    peer_list_shadow_prepare(extended, &table);
+    pending_bit_bulk_clear(&table, p_addrs, count, extended);
+    peer_list_shadow_commit(extended);
 }
 
 void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
 {
-    switch (data_type)
+    peer_table_t table;
+    uint32_t     location = 0;
+
+    peer_table_get(extended, &table);
+
+    while (location < table.slots)
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                m_pending_bit.num_of_ext_addr = 0;
-            }
-            else
-            {
-                m_pending_bit.num_of_short_addr = 0;
-            }
-            break;
+        if (peer_entry_is_used(&table, location))
+        {
+            nrf_802154_ack_data_peer_t * p_peer = peer_data_get(&table, location);
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                m_ie.num_of_ext_data = 0;
-            }
-            else
+            (void)peer_data_clear(p_peer, data_type);
+
+            // Removing a peer node moves another one to its entry, which must be checked again.
+            if (peer_data_is_empty(p_peer) && addr_remove(&table, location, extended))
             {
-                m_ie.num_of_short_data = 0;
+                continue;
             }
-            break;
+        }
 
-        default:
-            break;
+        location++;
     }
 }
 
@@ -690,22 +1508,64 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 
 }
 
-bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
+const nrf_802154_ack_data_peer_t * nrf_802154_ack_data_peer_find(const uint8_t * p_src_addr,
+                                                                 bool            src_addr_extended)
+{
+    uint32_t     location;
+    peer_table_t table;
+
+    if (NULL == p_src_addr)
+    {
+        return NULL;
+    }
+
+    peer_table_get(src_addr_extended, &table);
+
+    if (!addr_index_find(p_src_addr, &table, &location, src_addr_extended))
+    {
+        return NULL;
+    }
+
+    return peer_data_get(&table, location);
+}
+
+void nrf_802154_ack_data_pending_bit_decider_set(nrf_802154_pending_bit_decider_t decider)
 {
-    bool ret;
+    m_pending_bit_decider = decider;
+}
+
+bool nrf_802154_ack_data_peer_pending_bit_should_be_set(const uint8_t                    * p_frame,
+                                                        const nrf_802154_ack_data_peer_t * p_peer)
+{
+    nrf_802154_pending_bit_decider_t decider = m_pending_bit_decider;
+    bool                             ret;
+
+    if (decider != NULL)
+    {
+        const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields =
+            nrf_802154_frame_parser_mhr_parse_cached(p_frame);
+
+        // Frames without the source address are handled by the selected matching method.
+        if ((p_mhr_fields != NULL) && (p_mhr_fields->p_src_addr != NULL))
+        {
+            return decider(p_mhr_fields->p_src_addr,
+                           p_mhr_fields->src_addr_size == EXTENDED_ADDRESS_SIZE,
+                           p_frame);
+        }
+    }
 
-    switch (m_src_matching_method)
+    switch (src_matching_method_get())
     {
         case NRF_802154_SRC_ADDR_MATCH_THREAD:
-            ret = addr_match_thread(p_frame);
+            ret = addr_match_thread(p_frame, p_peer);
             break;
 
         case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
-            ret = addr_match_zigbee(p_frame);
+            ret = addr_match_zigbee(p_frame, p_peer);
             break;
 
         case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
-            ret = addr_match_standard_compliant(p_frame);
+            ret = addr_match_standard_compliant(p_frame, p_peer);
             break;
 
         default:
@@ -716,33 +1576,116 @@ bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
     return ret;
 }
 
-const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
-                                           bool            src_addr_extended,
-                                           uint8_t       * p_ie_length)
+bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
 {
-    uint32_t location;
+    const nrf_802154_ack_data_peer_t         * p_peer = NULL;
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields;
 
-    if (NULL == p_src_addr)
+    if (m_peers.enabled && (m_pending_bit_decider == NULL) &&
+        (src_matching_method_get() != NRF_802154_SRC_ADDR_MATCH_ALWAYS_1))
     {
-        return NULL;
-    }
+        p_mhr_fields = nrf_802154_frame_parser_mhr_parse_cached(p_frame);
 
-    if (addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_IE, src_addr_extended))
-    {
-        if (src_addr_extended)
-        {
-            *p_ie_length = m_ie.ext_data[location].ie_data.len;
-            return m_ie.ext_data[location].ie_data.p_data;
-        }
-        else
+        if (p_mhr_fields != NULL)
         {
-            *p_ie_length = m_ie.short_data[location].ie_data.len;
-            return m_ie.short_data[location].ie_data.p_data;
+            p_peer = nrf_802154_ack_data_peer_find(
+                p_mhr_fields->p_src_addr,
+                p_mhr_fields->src_addr_size == EXTENDED_ADDRESS_SIZE);
         }
     }
-    else
+
+    return nrf_802154_ack_data_peer_pending_bit_should_be_set(p_frame, p_peer);
+}
+
+const uint8_t * nrf_802154_ack_data_peer_ie_get(const nrf_802154_ack_data_peer_t * p_peer,
+                                                uint8_t                          * p_ie_length)
+{
+    if ((NULL == p_peer) || !p_peer->ie_present)
     {
         *p_ie_length = 0;
         return NULL;
     }
+
+    *p_ie_length = p_peer->ie_len;
+    return m_ie_arena[p_peer->ie_chunk];
+}
+
+uint32_t nrf_802154_ack_data_ie_generation_get(void)
+{
+    return m_ie_generation;
+}
+
+#if NRF_802154_WARM_START_ENABLED
+
+/// Size of the snapshot fields following the lists of peer nodes: matching method and number of
+/// free chunks of the IE arena.
+#define SNAPSHOT_HEADER_SIZE (sizeof(uint8_t) + sizeof(uint16_t))
+
+uint32_t nrf_802154_ack_data_snapshot_max_size_get(void)
+{
+    return sizeof(m_peers) + SNAPSHOT_HEADER_SIZE + sizeof(m_ie_free_chunks) + sizeof(m_ie_arena);
+}
+
+uint32_t nrf_802154_ack_data_snapshot_save(uint8_t * p_buffer, uint32_t size)
+{
+    uint32_t free_size = m_ie_free_count * sizeof(m_ie_free_chunks[0]);
+    uint32_t length    = sizeof(m_peers) + SNAPSHOT_HEADER_SIZE + free_size + sizeof(m_ie_arena);
+
+    if (size < length)
+    {
+        return 0;
+    }
+
+    memcpy(p_buffer, &m_peers, sizeof(m_peers));
+    p_buffer += sizeof(m_peers);
+
+    p_buffer[0] = (uint8_t)m_src_matching_method;
+    memcpy(&p_buffer[1], &m_ie_free_count, sizeof(m_ie_free_count));
+    p_buffer += SNAPSHOT_HEADER_SIZE;
+
+    // Only the used part of the free chunk stack is stored to keep the snapshot compact.
+    memcpy(p_buffer, m_ie_free_chunks, free_size);
+    p_buffer += free_size;
+
+    memcpy(p_buffer, m_ie_arena, sizeof(m_ie_arena));
+
+    return length;
+}
+
+bool nrf_802154_ack_data_snapshot_restore(const uint8_t * p_buffer, uint32_t length)
+{
+    uint16_t free_count;
+    uint32_t free_size;
+
+    if (length < sizeof(m_peers) + SNAPSHOT_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    memcpy(&free_count, &p_buffer[sizeof(m_peers) + 1], sizeof(free_count));
+    free_size = free_count * sizeof(m_ie_free_chunks[0]);
+
+    if ((free_count > IE_ARENA_CHUNKS) ||
+        (length != sizeof(m_peers) + SNAPSHOT_HEADER_SIZE + free_size + sizeof(m_ie_arena)))
+    {
+        return false;
+    }
+
+    memcpy(&m_peers, p_buffer, sizeof(m_peers));
+    p_buffer += sizeof(m_peers);
+
+    m_src_matching_method = (nrf_802154_src_addr_match_t)p_buffer[0];
+    p_buffer             += SNAPSHOT_HEADER_SIZE;
+
+    memcpy(m_ie_free_chunks, p_buffer, free_size);
+    m_ie_free_count = free_count;
+    p_buffer       += free_size;
+
+    memcpy(m_ie_arena, p_buffer, sizeof(m_ie_arena));
+
+    m_ie_generation++;
+
+    return true;
 }
+
+#endif // NRF_802154_WARM_START_ENABLED
@@ -69,7 +69,7 @@ void nrf_802154_ack_data_enable(bool enabled);
  * @param[in]  data_len  Length of the @p p_data buffer.
  *
  * @retval true   Address successfully added to the list.
- * @retval false  Address not added to the list (list is full).
+ * @retval false  Address not added to the list (list or IE data memory is full).
  */
 bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
                                       bool                  extended,
@@ -95,6 +95,34 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
                                         bool                  extended,
                                         nrf_802154_ack_data_t data_type);
 
+/**
+ * @brief Sets the pending bit for multiple addresses at once.
+ *
+ * The updated list is prepared in a spare copy and published with a single pointer write, so an ACK
+ * frame is never prepared using a partially updated list and interrupts are not blocked.
+ *
+ * @param[inout] p_addrs   Array of addresses. The array is sorted and deduplicated in place.
+ * @param[in]    count     Number of addresses in @p p_addrs.
+ * @param[in]    extended  Indication if @p p_addrs contains extended addresses or short addresses.
+ *
+ * @retval true   Pending bit set for all addresses.
+ * @retval false  Not enough space in the list. The list was not modified.
+ */
+bool nrf_802154_ack_data_pending_bit_bulk_set(uint8_t * p_addrs, uint32_t count, bool extended);
+
+/**
+ * @brief Clears the pending bit for multiple addresses at once.
+ *
+ * The updated list is prepared in a spare copy and published with a single pointer write, so an ACK
+ * frame is never prepared using a partially updated list and interrupts are not blocked. Addresses
+ * missing from the list are ignored.
+ *
+ * @param[inout] p_addrs   Array of addresses. The array is sorted and deduplicated in place.
+ * @param[in]    count     Number of addresses in @p p_addrs.
+ * @param[in]    extended  Indication if @p p_addrs contains extended addresses or short addresses.
+ */
+void nrf_802154_ack_data_pending_bit_bulk_clear(uint8_t * p_addrs, uint32_t count, bool extended);
+
 /**
  * @brief Removes all addresses of a given length from the ACK data list.
  *
@@ -117,10 +145,53 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type);
  */
 void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method);
 
+/**
+ * @brief Sets the function deciding the pending bit instead of the list.
+ *
+ * @param[in]  decider  Function deciding the pending bit or NULL to use the list.
+ */
+void nrf_802154_ack_data_pending_bit_decider_set(nrf_802154_pending_bit_decider_t decider);
+
+/**
+ * @brief ACK data stored in the list for a single peer node.
+ *
+ * The structure is opaque. Use @ref nrf_802154_ack_data_peer_find to get the data of the source
+ * of a received frame once and pass it to the functions preparing the ACK frame.
+ */
+typedef struct nrf_802154_ack_data_peer_s nrf_802154_ack_data_peer_t;
+
+/**
+ * @brief Finds the ACK data stored in the list for a given source address.
+ *
+ * @param[in]  p_src_addr    Pointer to the source address to search for in the list.
+ * @param[in]  src_addr_ext  If the source address is extended.
+ *
+ * @returns  Either pointer to the ACK data of the peer node or NULL if there is none.
+ */
+const nrf_802154_ack_data_peer_t * nrf_802154_ack_data_peer_find(const uint8_t * p_src_addr,
+                                                                 bool            src_addr_ext);
+
 /**
  * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
  *
  * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_peer   ACK data returned by @ref nrf_802154_ack_data_peer_find for the source
+ *                      address of @p p_frame.
+ *
+ * @retval true   Pending bit is to be set.
+ * @retval false  Pending bit is to be cleared.
+ */
+bool nrf_802154_ack_data_peer_pending_bit_should_be_set(const uint8_t                    * p_frame,
+                                                        const nrf_802154_ack_data_peer_t * p_peer);
+
+/**
+ * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
+ *
+ * This function looks up the source address of @p p_frame in the list. If the IE data is needed
+ * as well, use @ref nrf_802154_ack_data_peer_find and
+ * @ref nrf_802154_ack_data_peer_pending_bit_should_be_set to search the list only once.
+ *
+ * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
@@ -128,16 +199,58 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame);
 
 /**
- * @brief Gets the IE data stored in the list for the source address of the provided frame.
+ * @brief Gets the IE data stored in the list for a peer node.
  *
- * @param[in]  p_src_addr    Pointer to the source address to search for in the list.
- * @param[in]  src_addr_ext  If the source address is extended.
+ * @param[in]  p_peer        ACK data returned by @ref nrf_802154_ack_data_peer_find.
  * @param[out] p_ie_length   Length of the IE data.
  *
  * @returns  Either pointer to the stored IE data or NULL if the IE data is not to be set.
  */
-const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
-                                           bool            src_addr_ext,
-                                           uint8_t       * p_ie_length);
+const uint8_t * nrf_802154_ack_data_peer_ie_get(const nrf_802154_ack_data_peer_t * p_peer,
+                                                uint8_t                          * p_ie_length);
+/**
+ * @brief Gets the number of changes of the IE data stored in the list.
+ *
+ * The returned value changes every time IE data is set or cleared for any address. It can be used
+ * to detect if ACK frames created earlier are still valid.
+ *
+ * @returns  Current generation of the IE data.
+ */
+uint32_t nrf_802154_ack_data_ie_generation_get(void);
+
+#if NRF_802154_WARM_START_ENABLED
+
+/**
+ * @brief Gets the maximum size of the snapshot of the ACK data.
+ *
+ * @returns  Size of the snapshot with the IE arena fully used, in bytes.
+ */
+uint32_t nrf_802154_ack_data_snapshot_max_size_get(void);
+
+/**
+ * @brief Stores the ACK data in a snapshot.
+ *
+ * The snapshot contains the lists of peer nodes, the source address matching method and the used
+ * part of the IE arena. The pending bit decider is not stored.
+ *
+ * @param[out] p_buffer  Buffer for the snapshot.
+ * @param[in]  size      Size of @p p_buffer.
+ *
+ * @returns  Length of the snapshot or 0 if it does not fit in @p p_buffer.
+ */
+uint32_t nrf_802154_ack_data_snapshot_save(uint8_t * p_buffer, uint32_t size);
+
+/**
+ * @brief Restores the ACK data from a snapshot created by @ref nrf_802154_ack_data_snapshot_save.
+ *
+ * @param[in]  p_buffer  Snapshot to restore.
+ * @param[in]  length    Length of the snapshot.
+ *
+ * @retval  true   The ACK data was restored.
+ * @retval  false  The snapshot is malformed. The ACK data was not modified.
+ */
+bool nrf_802154_ack_data_snapshot_restore(const uint8_t * p_buffer, uint32_t length);
+
+#endif // NRF_802154_WARM_START_ENABLED
 
 #endif // NRF_802154_ACK_DATA_H
@@ -51,6 +51,8 @@ typedef enum
     FRAME_VERSION_INVALID
 } frame_version_t;
 
+static frame_version_t m_last_ack_version; ///< Version of the frame the last ACK responded to.
+
 static frame_version_t frame_version_is_2015_or_above(const uint8_t * p_frame)
 {
     switch (p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK)
@@ -79,7 +81,9 @@ const uint8_t * nrf_802154_ack_generator_create(const uint8_t * p_frame)
     // This function should not be called if ACK is not requested.
     assert(p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT);
 
-    switch (frame_version_is_2015_or_above(p_frame))
+    m_last_ack_version = frame_version_is_2015_or_above(p_frame);
+
+    switch (m_last_ack_version)
     {
         case FRAME_VERSION_BELOW_2015:
             return nrf_802154_imm_ack_generator_create(p_frame);
@@ -91,3 +95,11 @@ const uint8_t * nrf_802154_ack_generator_create(const uint8_t * p_frame)
             return NULL;
     }
 }
+
+void nrf_802154_ack_generator_ie_write(const uint8_t * p_frame, uint32_t ack_time)
+{
+    if (m_last_ack_version == FRAME_VERSION_2015_OR_ABOVE)
+    {
+        nrf_802154_enh_ack_generator_ie_write(p_frame, ack_time);
+    }
+}
@@ -52,4 +52,15 @@ void nrf_802154_ack_generator_init(void);
  */
 const uint8_t * nrf_802154_ack_generator_create(const uint8_t * p_frame);
 
+/** Updates the IE data of the ACK created last, just before it is transmitted.
+ *
+ * This function has effect only if the ACK created last is an Enh-Ack with IE data and a function
+ * was set with @ref nrf_802154_enh_ack_generator_ie_writer_set.
+ *
+ * @param [in]  p_frame   Pointer to the buffer that contains PHR and PSDU of the frame
+ *                        to respond to.
+ * @param [in]  ack_time  Time at which the PHR of the ACK is to be transmitted.
+ */
+void nrf_802154_ack_generator_ie_write(const uint8_t * p_frame, uint32_t ack_time);
+
 #endif // NRF_802154_ACK_GENERATOR_H
@@ -41,14 +41,68 @@
 #include <string.h>
 
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_link_metrics.h"
+#include "mac_features/nrf_802154_security_pib.h"
 #include "nrf_802154_ack_data.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_ram_usage.h"
 
-#define ENH_ACK_MAX_SIZE MAX_PACKET_SIZE
+/// Largest MAC header of an Enh-Ack, with an extended destination address and full security header.
+#define ENH_ACK_MAX_HEADER_SIZE (FCF_SIZE + DSN_SIZE + PAN_ID_SIZE + EXTENDED_ADDRESS_SIZE + \
+                                 SECURITY_CONTROL_SIZE + FRAME_COUNTER_SIZE + KEY_ID_MODE_3_SIZE)
+
+/// Largest Enh-Ack with IE data of @ref NRF_802154_MAX_ACK_IE_SIZE bytes and the longest MIC.
+#define ENH_ACK_MAX_FRAME_SIZE  (ENH_ACK_MAX_HEADER_SIZE + NRF_802154_MAX_ACK_IE_SIZE + \
+                                 MIC_128_SIZE + FCS_SIZE)
+
+/// Size of the Enh-Ack buffers. Only as much RAM is reserved as the largest Enh-Ack needs.
+#define ENH_ACK_MAX_SIZE        ((ENH_ACK_MAX_FRAME_SIZE < MAX_PACKET_SIZE) ? \
+                                 ENH_ACK_MAX_FRAME_SIZE : MAX_PACKET_SIZE)
 
 static uint8_t m_ack_data[ENH_ACK_MAX_SIZE + PHR_SIZE];
 
+static volatile nrf_802154_ack_ie_writer_t m_ie_writer; ///< Function updating the IE data.
+static uint8_t                             m_ie_offset; ///< Offset of the IE data in @ref m_ack_data.
+static uint8_t                             m_ie_len;    ///< Length of the IE data, 0 if absent.
+static uint8_t                             m_fc_offset; ///< Offset of the frame counter, 0 if absent.
+
+#if NRF_802154_ENH_ACK_TEMPLATES > 0
+
+/// Structure representing the fields of a received frame that determine the content of its Enh-Ack.
+typedef struct
+{
+    uint8_t fcf[FCF_SIZE];                   ///< Frame control field bits used by the Enh-Ack.
+    uint8_t panid[PAN_ID_SIZE];              ///< PAN ID put in the Enh-Ack.
+    uint8_t src_addr[EXTENDED_ADDRESS_SIZE]; ///< Source address of the frame.
+    uint8_t sec_ctrl;                        ///< Security control field of the frame.
+    uint8_t key_id[KEY_ID_MODE_3_SIZE];      ///< Key identifier field of the frame.
+} ack_template_key_t;
+
+/// Structure representing a cached Enh-Ack.
+typedef struct
+{
+    bool               valid;                             ///< If the template contains an Enh-Ack.
+    ack_template_key_t key;                               ///< Key of the frame it responds to.
+    uint8_t            ie_offset;                         ///< Offset of the IE data in @p data.
+    uint8_t            ie_len;                            ///< Length of the IE data.
+    uint8_t            fc_offset;                         ///< Offset of the frame counter in @p data.
+    uint8_t            data[ENH_ACK_MAX_SIZE + PHR_SIZE]; ///< PHR and PSDU of the Enh-Ack.
+} ack_template_t;
+
+static ack_template_t m_templates[NRF_802154_ENH_ACK_TEMPLATES]; ///< Cached Enh-Acks.
+static uint32_t       m_templates_ie_generation;                 ///< IE data generation of templates.
+static uint8_t        m_template_next;                           ///< Template to be replaced next.
+
+NRF_802154_RAM_USAGE_REPORT(enh_ack_generator, sizeof(m_ack_data) + sizeof(m_templates));
+
+#else
+
+NRF_802154_RAM_USAGE_REPORT(enh_ack_generator, sizeof(m_ack_data));
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES > 0
+
 static void ack_buffer_clear(void)
 {
     memset(m_ack_data, 0, FCF_SIZE + PHR_SIZE);
@@ -77,9 +131,10 @@ static void fcf_security_enabled_set(const uint8_t * p_frame)
         (p_frame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT);
 }
 
-static void fcf_frame_pending_set(const uint8_t * p_frame)
+static void fcf_frame_pending_set(const uint8_t                    * p_frame,
+                                  const nrf_802154_ack_data_peer_t * p_peer)
 {
-    if (nrf_802154_ack_data_pending_bit_should_be_set(p_frame))
+    if (nrf_802154_ack_data_peer_pending_bit_should_be_set(p_frame, p_peer))
     {
         m_ack_data[FRAME_PENDING_OFFSET] |= FRAME_PENDING_BIT;
     }
@@ -136,6 +191,7 @@ static void fcf_frame_version_set(void)
 }
 
 static void frame_control_set(const uint8_t                      * p_frame,
+                              const nrf_802154_ack_data_peer_t   * p_peer,
                               const uint8_t                      * p_ie_data,
                               nrf_802154_frame_parser_mhr_data_t * p_ack_offsets)
 {
@@ -143,7 +199,7 @@ static void frame_control_set(const uint8_t                      * p_frame,
 
     fcf_frame_type_set();
     fcf_security_enabled_set(p_frame);
-    fcf_frame_pending_set(p_frame);
+    fcf_frame_pending_set(p_frame, p_peer);
     fcf_panid_compression_set(p_frame);
     fcf_sequence_number_suppression_set(p_frame);
     fcf_ie_present_set(p_ie_data);
@@ -296,17 +352,64 @@ static void security_header_set(const nrf_802154_frame_parser_mhr_data_t * p_fra
 
     security_control_set(p_frame, p_ack);
 
-    // Frame counter is set by MAC layer when the frame is encrypted.
     fc_suppressed = ((*p_ack->p_sec_ctrl) & FRAME_COUNTER_SUPPRESS_BIT);
 
     if (!fc_suppressed)
     {
+        m_fc_offset             = (uint8_t)(p_ack->p_sec_ctrl + SECURITY_CONTROL_SIZE - m_ack_data);
         m_ack_data[PHR_OFFSET] += FRAME_COUNTER_SIZE;
     }
 
     security_key_id_set(p_frame, p_ack, fc_suppressed, p_sec_end);
 }
 
+/**
+ * @brief Writes the frame counter of the key used to secure the Enh-Ack.
+ *
+ * The frame counter is taken for every Enh-Ack separately, also for the ones created from
+ * a template. If the driver does not secure the Enh-Acks, the frame counter is left for the MAC
+ * layer to set.
+ *
+ * @retval true   The frame counter is written or it is not required.
+ * @retval false  There is no key to secure the Enh-Ack with or its frame counter is exhausted.
+ */
+static bool frame_counter_set(void)
+{
+#if NRF_802154_ENCRYPTION_ENABLED
+    uint8_t         sec_ctrl;
+    const uint8_t * p_key_id;
+    uint32_t        frame_counter;
+
+    if (m_fc_offset == 0)
+    {
+        return true;
+    }
+
+    sec_ctrl = m_ack_data[m_fc_offset - SECURITY_CONTROL_SIZE];
+    p_key_id = &m_ack_data[m_fc_offset + FRAME_COUNTER_SIZE];
+
+    if ((sec_ctrl & SECURITY_LEVEL_MASK) == 0)
+    {
+        return true;
+    }
+
+    if (!nrf_802154_security_pib_frame_counter_get_next((sec_ctrl & KEY_ID_MODE_MASK) /
+                                                        KEY_ID_MODE_1,
+                                                        p_key_id,
+                                                        &frame_counter))
+    {
+        return false;
+    }
+
+    m_ack_data[m_fc_offset]     = (uint8_t)frame_counter;
+    m_ack_data[m_fc_offset + 1] = (uint8_t)(frame_counter >> 8);
+    m_ack_data[m_fc_offset + 2] = (uint8_t)(frame_counter >> 16);
+    m_ack_data[m_fc_offset + 3] = (uint8_t)(frame_counter >> 24);
+#endif // NRF_802154_ENCRYPTION_ENABLED
+
+    return true;
+}
+
 /***************************************************************************************************
  * @section Information Elements
  **************************************************************************************************/
@@ -324,57 +427,244 @@ static void ie_header_set(const uint8_t * p_ie_data, uint8_t ie_data_len, const
 
     memcpy(p_ack_ie, p_ie_data, ie_data_len);
     m_ack_data[PHR_OFFSET] += ie_data_len;
+
+    m_ie_offset = (uint8_t)(p_ack_ie - m_ack_data);
+    m_ie_len    = ie_data_len;
 }
 
+/***************************************************************************************************
+ * @section Enh-Ack templates
+ **************************************************************************************************/
+
+#if NRF_802154_ENH_ACK_TEMPLATES > 0
+
+static void templates_flush(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_ENH_ACK_TEMPLATES; i++)
+    {
+        m_templates[i].valid = false;
+    }
+
+    m_templates_ie_generation = nrf_802154_ack_data_ie_generation_get();
+}
+
+static void template_key_create(const uint8_t                            * p_frame,
+                                const nrf_802154_frame_parser_mhr_data_t * p_frame_offsets,
+                                ack_template_key_t                       * p_key)
+{
+    const uint8_t * p_panid;
+
+    memset(p_key, 0, sizeof(ack_template_key_t));
+
+    // The frame pending bit is not a part of the key, as it is updated for every Enh-Ack.
+    p_key->fcf[0] = p_frame[SECURITY_ENABLED_OFFSET] & (SECURITY_ENABLED_BIT | PAN_ID_COMPR_MASK);
+    p_key->fcf[1] = p_frame[DSN_SUPPRESS_OFFSET] & (DSN_SUPPRESS_BIT | SRC_ADDR_TYPE_MASK);
+
+    if (p_frame_offsets->p_src_panid != NULL)
+    {
+        p_panid = p_frame_offsets->p_src_panid;
+    }
+    else if (p_frame_offsets->p_dst_panid != NULL)
+    {
+        p_panid = p_frame_offsets->p_dst_panid;
+    }
+    else
+    {
+        p_panid = nrf_802154_pib_pan_id_get();
+    }
+
+    memcpy(p_key->panid, p_panid, PAN_ID_SIZE);
+
+    if (p_frame_offsets->p_src_addr != NULL)
+    {
+        memcpy(p_key->src_addr, p_frame_offsets->p_src_addr, p_frame_offsets->src_addr_size);
+    }
+
+    if (p_frame_offsets->p_sec_ctrl != NULL)
+    {
+        const uint8_t * p_key_id = p_frame_offsets->p_sec_ctrl + SECURITY_CONTROL_SIZE;
+        uint8_t         key_id_size;
+
+        p_key->sec_ctrl = *p_frame_offsets->p_sec_ctrl;
+
+        if (!(p_key->sec_ctrl & FRAME_COUNTER_SUPPRESS_BIT))
+        {
+            p_key_id += FRAME_COUNTER_SIZE;
+        }
+
+        switch (p_key->sec_ctrl & KEY_ID_MODE_MASK)
+        {
+            case KEY_ID_MODE_1:
+                key_id_size = KEY_ID_MODE_1_SIZE;
+                break;
+
+            case KEY_ID_MODE_2:
+                key_id_size = KEY_ID_MODE_2_SIZE;
+                break;
+
+            case KEY_ID_MODE_3:
+                key_id_size = KEY_ID_MODE_3_SIZE;
+                break;
+
+            default:
+                key_id_size = 0;
+                break;
+        }
+
+        memcpy(p_key->key_id, p_key_id, key_id_size);
+    }
+}
+
+static const ack_template_t * template_find(const ack_template_key_t * p_key)
+{
+    if (m_templates_ie_generation != nrf_802154_ack_data_ie_generation_get())
+    {
+        templates_flush();
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_ENH_ACK_TEMPLATES; i++)
+    {
+        if (m_templates[i].valid &&
+            (memcmp(&m_templates[i].key, p_key, sizeof(ack_template_key_t)) == 0))
+        {
+            return &m_templates[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void template_store(const ack_template_key_t * p_key)
+{
+    ack_template_t * p_template = &m_templates[m_template_next];
+
+    m_template_next = (m_template_next + 1) % NRF_802154_ENH_ACK_TEMPLATES;
+
+    p_template->key       = *p_key;
+    p_template->ie_offset = m_ie_offset;
+    p_template->ie_len    = m_ie_len;
+    p_template->fc_offset = m_fc_offset;
+    memcpy(p_template->data, m_ack_data, m_ack_data[PHR_OFFSET] + PHR_SIZE - FCS_SIZE);
+
+    // The frame pending bit is set for every Enh-Ack created from the template separately.
+    p_template->data[FRAME_PENDING_OFFSET] &= ~FRAME_PENDING_BIT;
+    p_template->valid                       = true;
+}
+
+static void template_apply(const ack_template_t             * p_template,
+                           const uint8_t                    * p_frame,
+                           const nrf_802154_ack_data_peer_t * p_peer)
+{
+    memcpy(m_ack_data, p_template->data, p_template->data[PHR_OFFSET] + PHR_SIZE - FCS_SIZE);
+
+    m_ie_offset = p_template->ie_offset;
+    m_ie_len    = p_template->ie_len;
+    m_fc_offset = p_template->fc_offset;
+
+    sequence_number_set(p_frame);
+    fcf_frame_pending_set(p_frame, p_peer);
+}
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES > 0
+
 /***************************************************************************************************
  * @section Public API implementation
  **************************************************************************************************/
 
 void nrf_802154_enh_ack_generator_init(void)
 {
-    // Intentionally empty.
+#if NRF_802154_ENH_ACK_TEMPLATES > 0
+    templates_flush();
+    m_template_next = 0;
+#endif
 }
 
 const uint8_t * nrf_802154_enh_ack_generator_create(const uint8_t * p_frame)
 {
+    nrf_802154_frame_parser_mhr_data_t         ack_offsets;
+    const uint8_t                            * p_sec_end       = NULL;
+    const nrf_802154_frame_parser_mhr_data_t * p_frame_offsets =
+        nrf_802154_frame_parser_mhr_parse_cached(p_frame);
 
-    nrf_802154_frame_parser_mhr_data_t frame_offsets;
-    nrf_802154_frame_parser_mhr_data_t ack_offsets;
-    const uint8_t                    * p_sec_end    = NULL;
-    bool                               parse_result = nrf_802154_frame_parser_mhr_parse(p_frame,
-                                                                                        &frame_offsets);
-
-    if (!parse_result)
+    if (p_frame_offsets == NULL)
     {
         return NULL;
     }
 
+    m_ie_len    = 0;
+    m_fc_offset = 0;
+
+    // Search the ACK data list only once for both the pending bit and the IE data.
+    const nrf_802154_ack_data_peer_t * p_peer = nrf_802154_ack_data_peer_find(
+        p_frame_offsets->p_src_addr,
+        p_frame_offsets->src_addr_size == EXTENDED_ADDRESS_SIZE);
+
+#if NRF_802154_ENH_ACK_TEMPLATES > 0
+    ack_template_key_t     template_key;
+    const ack_template_t * p_template;
+
+    template_key_create(p_frame, p_frame_offsets, &template_key);
+    p_template = template_find(&template_key);
+
+    if (p_template != NULL)
+    {
+        template_apply(p_template, p_frame, p_peer);
+        return frame_counter_set() ? m_ack_data : NULL;
+    }
+#endif
+
     uint8_t         ie_data_len;
-    const uint8_t * p_ie_data = nrf_802154_ack_data_ie_get(
-        frame_offsets.p_src_addr,
-        frame_offsets.src_addr_size == EXTENDED_ADDRESS_SIZE,
-        &ie_data_len);
+    const uint8_t * p_ie_data = nrf_802154_ack_data_peer_ie_get(p_peer, &ie_data_len);
 
     // Clear previously created ACK.
     ack_buffer_clear();
 
     // Set Frame Control field bits.
-    frame_control_set(p_frame, p_ie_data, &ack_offsets);
+    frame_control_set(p_frame, p_peer, p_ie_data, &ack_offsets);
 
     // Set valid sequence number in ACK frame.
     sequence_number_set(p_frame);
 
     // Set destination address and PAN ID.
-    destination_set(&frame_offsets, &ack_offsets);
+    destination_set(p_frame_offsets, &ack_offsets);
 
     // Set source address and PAN ID.
     source_set();
 
     // Set auxiliary security header.
-    security_header_set(&frame_offsets, &ack_offsets, &p_sec_end);
+    security_header_set(p_frame_offsets, &ack_offsets, &p_sec_end);
 
     // Set IE header.
     ie_header_set(p_ie_data, ie_data_len, p_sec_end);
 
-    return m_ack_data;
+#if NRF_802154_ENH_ACK_TEMPLATES > 0
+    template_store(&template_key);
+#endif
+
+    return frame_counter_set() ? m_ack_data : NULL;
+}
+
+void nrf_802154_enh_ack_generator_ie_writer_set(nrf_802154_ack_ie_writer_t writer)
+{
+    m_ie_writer = writer;
+}
+
+void nrf_802154_enh_ack_generator_ie_write(const uint8_t * p_frame, uint32_t ack_time)
+{
+    nrf_802154_ack_ie_writer_t writer = m_ie_writer;
+
+    if (m_ie_len == 0)
+    {
+        return;
+    }
+
+#if NRF_802154_LINK_METRICS_ENABLED
+    nrf_802154_link_metrics_ie_write(p_frame, &m_ack_data[m_ie_offset], m_ie_len);
+#endif
+
+    if (writer != NULL)
+    {
+        writer(p_frame, &m_ack_data[m_ie_offset], m_ie_len, ack_time);
+    }
 }
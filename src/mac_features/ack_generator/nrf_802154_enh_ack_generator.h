@@ -41,6 +41,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_types.h"
+
 /** Initializes the Enhanced ACK generator module. */
 void nrf_802154_enh_ack_generator_init(void);
 
@@ -52,8 +54,24 @@ void nrf_802154_enh_ack_generator_init(void);
  *                       to respond to.
  *
  * @returns  Pointer to a constant buffer that contains PHR and PSDU
- *           of the created Enhanced ACK frame.
+ *           of the created Enhanced ACK frame, or NULL if the frame cannot be acknowledged
+ *           (for example, there is no key to secure the Enhanced ACK with).
  */
 const uint8_t * nrf_802154_enh_ack_generator_create(const uint8_t * p_frame);
 
+/** Sets the function updating the IE data of created Enh-Acks.
+ *
+ * @param [in]  writer  Function to be called or NULL to keep the IE data unchanged.
+ */
+void nrf_802154_enh_ack_generator_ie_writer_set(nrf_802154_ack_ie_writer_t writer);
+
+/** Updates the IE data of the Enh-Ack created last with the function set by
+ *  @ref nrf_802154_enh_ack_generator_ie_writer_set.
+ *
+ * @param [in]  p_frame   Pointer to the buffer that contains PHR and PSDU of the frame
+ *                        to respond to.
+ * @param [in]  ack_time  Time at which the PHR of the Enh-Ack is to be transmitted.
+ */
+void nrf_802154_enh_ack_generator_ie_write(const uint8_t * p_frame, uint32_t ack_time);
+
 #endif // NRF_802154_ENH_ACK_GENERATOR_H
@@ -35,7 +35,8 @@
  *
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_ACK_TIMEOUT
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_ACK_TIMEOUT
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_ACK_TIMEOUT_LOG_VERBOSITY
 
 #include "nrf_802154_ack_timeout.h"
 
@@ -44,7 +45,10 @@
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
+#include "nrf_802154_core_hooks.h"
+#include "nrf_802154_const.h"
 #include "nrf_802154_notification.h"
+#include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
 #include "timer/nrf_802154_timer_sched.h"
 
@@ -62,7 +66,14 @@ static void notify_tx_error(bool result)
 {
     if (result)
     {
-        nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK);
+        // The procedure ends before the hooks are called, as they may transmit the frame again.
+        m_procedure_is_active = false;
+        nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
+
+        if (nrf_802154_core_hooks_tx_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK))
+        {
+            nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK);
+        }
     }
 }
 
@@ -74,14 +85,11 @@ static void timeout_timer_fired(void * p_context)
 
     if (m_procedure_is_active)
     {
-        if (nrf_802154_request_receive(NRF_802154_TERM_802154,
-                                       REQ_ORIG_ACK_TIMEOUT,
-                                       notify_tx_error,
-                                       false))
-        {
-            m_procedure_is_active = false;
-        }
-        else
+        // The procedure is ended by notify_tx_error() if the request succeeds.
+        if (!nrf_802154_request_receive(NRF_802154_TERM_802154,
+                                        REQ_ORIG_ACK_TIMEOUT,
+                                        notify_tx_error,
+                                        false))
         {
             timeout_timer_retry();
         }
@@ -98,14 +106,38 @@ static void timeout_timer_retry(void)
     nrf_802154_timer_sched_add(&m_timer, true);
 }
 
+/** Get the ACK timeout of the given frame, counted from the start of its transmission.
+ *
+ * The timeout covers the frame, macAckWaitDuration with the ACK expected for the frame and
+ * the margin, but it does not exceed the timeout set with @ref nrf_802154_ack_timeout_time_set.
+ */
+static uint32_t timeout_for_frame_get(const uint8_t * p_frame)
+{
+    uint8_t  ack_length = IMM_ACK_LENGTH;
+    uint32_t timeout;
+
+    if ((p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2)
+    {
+        ack_length = NRF_802154_ACK_TIMEOUT_ENH_ACK_MAX_LENGTH;
+    }
+
+    timeout = nrf_802154_frame_duration_get(p_frame[PHR_OFFSET], true, true) +
+              PHY_US_TIME_FROM_SYMBOLS(A_UNIT_BACKOFF_SYMBOLS + A_TURNAROUND_TIME_SYMBOLS) +
+              nrf_802154_frame_duration_get(ack_length, true, true) +
+              NRF_802154_ACK_TIMEOUT_MARGIN;
+
+    return (timeout < m_timeout) ? timeout : m_timeout;
+}
+
 static void timeout_timer_start(void)
 {
     m_timer.callback  = timeout_timer_fired;
     m_timer.p_context = NULL;
     m_timer.t0        = nrf_802154_timer_sched_time_get();
-    m_timer.dt        = m_timeout;
+    m_timer.dt        = timeout_for_frame_get(mp_frame);
 
     m_procedure_is_active = true;
+    nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
 
     nrf_802154_timer_sched_add(&m_timer, true);
 }
@@ -113,6 +145,7 @@ static void timeout_timer_start(void)
 static void timeout_timer_stop(void)
 {
     m_procedure_is_active = false;
+    nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
 
     // To make sure `timeout_timer_fired()` detects that procedure is being stopped if it preempts
     // this function.
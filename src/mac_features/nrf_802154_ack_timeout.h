@@ -48,11 +48,25 @@
 /**
  * @brief Sets the timeout time for the ACK timeout feature.
  *
+ * The timeout of each frame is computed from the durations of the frame and of the expected ACK,
+ * and it is limited to @p time.
+ *
  * @param[in]  time  Timeout time in microseconds.
  *                   The default value is defined in nrf_802154_config.h.
  */
 void nrf_802154_ack_timeout_time_set(uint32_t time);
 
+/**
+ * @brief Gets the time the RADIO waits for the ACK of the transmitted frame.
+ *
+ * The time is measured by the RADIO TIMER from the end of the transmitted frame to the SHR of
+ * the ACK. This function is provided only by the precise ACK timeout module built with
+ * @ref NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED.
+ *
+ * @return  ACK wait in microseconds, or 0 if the ACK timeout procedure is not running.
+ */
+uint32_t nrf_802154_ack_timeout_hw_time_get(void);
+
 /**
  * @brief Aborts a started ACK timeout procedure.
  *
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the AES-CCM* transformation used to secure 802.15.4 frames.
+ *
+ * The CCM peripheral supports only the Bluetooth variant of CCM, so the CBC-MAC and the counter
+ * mode of CCM* are built from single AES blocks computed by the ECB peripheral.
+ *
+ */
+
+#include "nrf_802154_aes_ccm.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_utils.h"
+#include "hal/nrf_ecb.h"
+
+#if NRF_802154_ENCRYPTION_ENABLED
+
+#define AES_BLOCK_SIZE     16   ///< Size of the AES block.
+#define CCM_L              2    ///< Size of the length field of CCM* blocks.
+#define CCM_FLAGS_ADATA    0x40 ///< Bit of the B0 flags indicating authenticated data.
+#define CCM_FLAGS_M_SHIFT  3    ///< Position of the encoded MIC size in the B0 flags.
+#define CCM_NONCE_OFFSET   1    ///< Offset of the nonce in B0 and Ai blocks.
+
+/// Offset of the length or counter field in B0 and Ai blocks.
+#define CCM_COUNTER_OFFSET (CCM_NONCE_OFFSET + NRF_802154_AES_CCM_NONCE_SIZE)
+
+/// Data structure used by the ECB peripheral.
+typedef struct
+{
+    uint8_t key[AES_BLOCK_SIZE];         ///< AES key.
+    uint8_t clear_text[AES_BLOCK_SIZE];  ///< Block to encrypt.
+    uint8_t cipher_text[AES_BLOCK_SIZE]; ///< Encrypted block.
+} ecb_data_t;
+
+static ecb_data_t m_ecb_data; ///< Data processed by the ECB peripheral.
+
+/**
+ * @brief Encrypts a single block with the given key.
+ *
+ * Frames are secured in the RADIO interrupt and verified in the notification context, so
+ * the ECB peripheral is used in a critical section that lasts for one block only.
+ */
+static void block_encrypt(const uint8_t * p_key, const uint8_t * p_in, uint8_t * p_out)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    memcpy(m_ecb_data.key, p_key, AES_BLOCK_SIZE);
+    memcpy(m_ecb_data.clear_text, p_in, AES_BLOCK_SIZE);
+
+    nrf_ecb_data_pointer_set(NRF_ECB, &m_ecb_data);
+
+    do
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+        nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+
+        while (!nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB) &&
+               !nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+        {
+            // Intentionally empty: the operation takes a few microseconds.
+        }
+
+        // ECB is aborted if the CCM or AAR peripheral needs AES. Just repeat the block then.
+    }
+    while (!nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB));
+
+    memcpy(p_out, m_ecb_data.cipher_text, AES_BLOCK_SIZE);
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+/** Add data preceded by a prefix to the CBC-MAC, padding the last block with zeros. */
+static void cbc_mac_update(const uint8_t * p_key,
+                           uint8_t       * p_mac,
+                           const uint8_t * p_prefix,
+                           uint8_t         prefix_len,
+                           const uint8_t * p_data,
+                           uint8_t         data_len)
+{
+    uint32_t total = (uint32_t)prefix_len + data_len;
+
+    for (uint32_t offset = 0; offset < total; offset += AES_BLOCK_SIZE)
+    {
+        for (uint32_t i = 0; (i < AES_BLOCK_SIZE) && ((offset + i) < total); i++)
+        {
+            uint32_t pos = offset + i;
+
+            p_mac[i] ^= (pos < prefix_len) ? p_prefix[pos] : p_data[pos - prefix_len];
+        }
+
+        block_encrypt(p_key, p_mac, p_mac);
+    }
+}
+
+/** Get the key stream block Si for the given counter. */
+static void key_stream_get(const nrf_802154_aes_ccm_data_t * p_data,
+                           uint16_t                          counter,
+                           uint8_t                         * p_block)
+{
+    uint8_t a[AES_BLOCK_SIZE];
+
+    a[0] = CCM_L - 1;
+    memcpy(&a[CCM_NONCE_OFFSET], p_data->p_nonce, NRF_802154_AES_CCM_NONCE_SIZE);
+    a[CCM_COUNTER_OFFSET]     = (uint8_t)(counter >> 8);
+    a[CCM_COUNTER_OFFSET + 1] = (uint8_t)counter;
+
+    block_encrypt(p_data->p_key, a, p_block);
+}
+
+/** Compute the encrypted MIC of the given data, with the plain text not encrypted yet. */
+static void mic_compute(const nrf_802154_aes_ccm_data_t * p_data, uint8_t * p_mic)
+{
+    uint8_t mac[AES_BLOCK_SIZE];
+    uint8_t stream[AES_BLOCK_SIZE];
+    uint8_t auth_len[CCM_L] = {0, p_data->auth_data_len};
+
+    // B0 block starts the CBC-MAC.
+    mac[0] = ((p_data->auth_data_len > 0) ? CCM_FLAGS_ADATA : 0) |
+             (((p_data->mic_size - 2) / 2) << CCM_FLAGS_M_SHIFT) |
+             (CCM_L - 1);
+    memcpy(&mac[CCM_NONCE_OFFSET], p_data->p_nonce, NRF_802154_AES_CCM_NONCE_SIZE);
+    mac[CCM_COUNTER_OFFSET]     = 0;
+    mac[CCM_COUNTER_OFFSET + 1] = p_data->plain_text_len;
+
+    block_encrypt(p_data->p_key, mac, mac);
+
+    if (p_data->auth_data_len > 0)
+    {
+        cbc_mac_update(p_data->p_key, mac, auth_len, sizeof(auth_len), p_data->p_auth_data,
+                       p_data->auth_data_len);
+    }
+
+    cbc_mac_update(p_data->p_key, mac, NULL, 0, p_data->p_plain_text, p_data->plain_text_len);
+
+    // Encrypt the MIC with the key stream block S0.
+    key_stream_get(p_data, 0, stream);
+
+    for (uint32_t i = 0; i < p_data->mic_size; i++)
+    {
+        p_mic[i] = mac[i] ^ stream[i];
+    }
+}
+
+/** Encrypt or decrypt the text of the given data in place with the key stream blocks S1..Sn. */
+static void text_crypt(const nrf_802154_aes_ccm_data_t * p_data)
+{
+    uint8_t stream[AES_BLOCK_SIZE];
+
+    for (uint32_t offset = 0; offset < p_data->plain_text_len; offset += AES_BLOCK_SIZE)
+    {
+        key_stream_get(p_data, (uint16_t)(offset / AES_BLOCK_SIZE + 1), stream);
+
+        for (uint32_t i = 0; (i < AES_BLOCK_SIZE) && ((offset + i) < p_data->plain_text_len); i++)
+        {
+            p_data->p_plain_text[offset + i] ^= stream[i];
+        }
+    }
+}
+
+void nrf_802154_aes_ccm_transform(const nrf_802154_aes_ccm_data_t * p_data)
+{
+    assert((p_data->mic_size == 0) || (p_data->mic_size == 4) ||
+           (p_data->mic_size == 8) || (p_data->mic_size == 16));
+
+    if (p_data->mic_size > 0)
+    {
+        mic_compute(p_data, p_data->p_mic);
+    }
+
+    text_crypt(p_data);
+}
+
+bool nrf_802154_aes_ccm_inverse(const nrf_802154_aes_ccm_data_t * p_data)
+{
+    uint8_t mic[AES_BLOCK_SIZE];
+    uint8_t diff = 0;
+
+    assert((p_data->mic_size == 0) || (p_data->mic_size == 4) ||
+           (p_data->mic_size == 8) || (p_data->mic_size == 16));
+
+    text_crypt(p_data);
+
+    if (p_data->mic_size > 0)
+    {
+        mic_compute(p_data, mic);
+
+        // All bytes are compared, so the time taken does not depend on the first wrong byte.
+        for (uint32_t i = 0; i < p_data->mic_size; i++)
+        {
+            diff |= mic[i] ^ p_data->p_mic[i];
+        }
+    }
+
+    return diff == 0;
+}
+
+#endif // NRF_802154_ENCRYPTION_ENABLED
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that implements the AES-CCM* transformation used to secure 802.15.4 frames.
+ *
+ */
+
+#ifndef NRF_802154_AES_CCM_H
+#define NRF_802154_AES_CCM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define NRF_802154_AES_CCM_NONCE_SIZE 13 ///< Size of the CCM* nonce, in bytes.
+
+/**
+ * @brief Structure that describes the data of a single AES-CCM* transformation.
+ */
+typedef struct
+{
+    const uint8_t * p_key;          ///< Pointer to the 128-bit key.
+    const uint8_t * p_nonce;        ///< Pointer to the nonce of @ref NRF_802154_AES_CCM_NONCE_SIZE bytes.
+    const uint8_t * p_auth_data;    ///< Pointer to the data that is authenticated, but not encrypted.
+    uint8_t       * p_plain_text;   ///< Pointer to the data that is authenticated and encrypted in place.
+    uint8_t       * p_mic;          ///< Pointer to the buffer of the encrypted MIC.
+    uint8_t         auth_data_len;  ///< Length of @c p_auth_data.
+    uint8_t         plain_text_len; ///< Length of @c p_plain_text.
+    uint8_t         mic_size;       ///< Size of the MIC: 0, 4, 8 or 16 bytes.
+} nrf_802154_aes_ccm_data_t;
+
+/**
+ * @brief Performs the AES-CCM* transformation of the given data.
+ *
+ * The plain text is encrypted in place and the encrypted MIC is written to @c p_mic. Each 16 bytes
+ * of data are processed by the ECB peripheral, which is used synchronously.
+ *
+ * @param[in]  p_data  Pointer to the description of the transformation.
+ */
+void nrf_802154_aes_ccm_transform(const nrf_802154_aes_ccm_data_t * p_data);
+
+/**
+ * @brief Performs the inverse AES-CCM* transformation of the given data.
+ *
+ * The cipher text passed in @c p_plain_text is decrypted in place and the MIC is verified against
+ * the encrypted MIC in @c p_mic.
+ *
+ * @param[in]  p_data  Pointer to the description of the transformation.
+ *
+ * @retval true   The MIC is valid.
+ * @retval false  The MIC is invalid, so the decrypted data must not be used.
+ */
+bool nrf_802154_aes_ccm_inverse(const nrf_802154_aes_ccm_data_t * p_data);
+
+#endif // NRF_802154_AES_CCM_H
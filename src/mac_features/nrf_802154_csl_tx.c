@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the tracking of the channel sample times of CSL receivers.
+ *
+ * The CSL Phase of the CSL IE is the time from the SFD of the frame that carries the IE to
+ * the next channel sample of its sender. The CSL Phase and CSL Period are given in units of
+ * 10 symbols.
+ *
+ */
+
+#include "nrf_802154_csl_tx.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_CSL_TX_ENABLED
+
+#if NRF_802154_CSL_TX_PEERS < 1
+#error NRF_802154_CSL_TX_PEERS must be at least 1.
+#endif
+
+#define IE_DESCRIPTOR_SIZE 2                        ///< Size of the descriptor of a Header IE.
+#define IE_LENGTH_MASK     0x7f                     ///< Mask of the Length field in the Header IE descriptor.
+#define IE_ID_OFFSET       7                        ///< Bit offset of the Element ID in the Header IE descriptor.
+#define IE_ID_MASK         0xff                     ///< Mask of the Element ID field in the Header IE descriptor.
+#define IE_ID_CSL          0x1a                     ///< Element ID of the CSL IE.
+#define IE_ID_HT1          0x7e                     ///< Element ID of the Header Termination 1 IE.
+#define IE_ID_HT2          0x7f                     ///< Element ID of the Header Termination 2 IE.
+#define CSL_IE_MIN_SIZE    4                        ///< Size of the CSL Phase and CSL Period fields.
+#define CSL_UNIT_US        (10 * PHY_US_PER_SYMBOL) ///< Unit of the CSL Phase and CSL Period.
+
+/// Channel sampling of a CSL receiver.
+typedef struct
+{
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the peer.
+    uint8_t  addr_size;                   ///< Size of the address, 0 if entry is empty.
+    uint32_t period;                      ///< Period of the channel samples [us].
+    uint64_t sample_time;                 ///< Time of a channel sample of the peer [us].
+} csl_tx_entry_t;
+
+static csl_tx_entry_t m_entries[NRF_802154_CSL_TX_PEERS]; ///< Known CSL receivers.
+static uint32_t       m_next_entry;                       ///< Entry to be replaced next.
+
+/**
+ * @brief Find the CSL IE in the Header IEs of a frame.
+ *
+ * @param[in]  p_frame   Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[out] p_phase   CSL Phase in units of 10 symbols.
+ * @param[out] p_period  CSL Period in units of 10 symbols.
+ *
+ * @retval true   The CSL IE was found.
+ * @retval false  The frame does not contain the CSL IE.
+ */
+static bool csl_ie_parse(const uint8_t * p_frame, uint16_t * p_phase, uint16_t * p_period)
+{
+    const uint8_t * p_ie  = nrf_802154_frame_parser_ie_header_get(p_frame);
+    const uint8_t * p_end = &p_frame[PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE];
+
+    if (p_ie == NULL)
+    {
+        return false;
+    }
+
+    while ((p_ie + IE_DESCRIPTOR_SIZE) <= p_end)
+    {
+        uint16_t descriptor = p_ie[0] | (p_ie[1] << 8);
+        uint8_t  id         = (descriptor >> IE_ID_OFFSET) & IE_ID_MASK;
+        uint8_t  length     = descriptor & IE_LENGTH_MASK;
+
+        p_ie += IE_DESCRIPTOR_SIZE;
+
+        if ((id == IE_ID_HT1) || (id == IE_ID_HT2) || ((p_ie + length) > p_end))
+        {
+            break;
+        }
+
+        if ((id == IE_ID_CSL) && (length >= CSL_IE_MIN_SIZE))
+        {
+            *p_phase  = p_ie[0] | (p_ie[1] << 8);
+            *p_period = p_ie[2] | (p_ie[3] << 8);
+            return true;
+        }
+
+        p_ie += length;
+    }
+
+    return false;
+}
+
+/** Find the entry of a peer, or NULL if the peer is not in the table. */
+static csl_tx_entry_t * entry_find(const uint8_t * p_addr, uint8_t addr_size)
+{
+    for (uint32_t i = 0; i < NRF_802154_CSL_TX_PEERS; i++)
+    {
+        csl_tx_entry_t * p_entry = &m_entries[i];
+
+        if ((p_entry->addr_size == addr_size) &&
+            (0 == memcmp(p_entry->addr, p_addr, addr_size)))
+        {
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Store the channel sampling of a peer given by a CSL IE.
+ *
+ * @param[in]  p_addr    Pointer to the address of the peer.
+ * @param[in]  extended  If @p p_addr is an extended address.
+ * @param[in]  p_frame   Pointer to the buffer that contains the PHR and PSDU of the frame sent
+ *                       by the peer.
+ * @param[in]  sfd_time  Time at which the SFD of the frame was received.
+ */
+static void entry_update(const uint8_t * p_addr,
+                         bool            extended,
+                         const uint8_t * p_frame,
+                         uint64_t        sfd_time)
+{
+    uint8_t          addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    csl_tx_entry_t * p_entry;
+    uint16_t         phase;
+    uint16_t         period;
+
+    if (!csl_ie_parse(p_frame, &phase, &period))
+    {
+        return;
+    }
+
+    p_entry = entry_find(p_addr, addr_size);
+
+    if (period == 0U)
+    {
+        // The peer stopped the CSL.
+        if (p_entry != NULL)
+        {
+            p_entry->addr_size = 0U;
+        }
+
+        return;
+    }
+
+    if (p_entry == NULL)
+    {
+        p_entry      = &m_entries[m_next_entry];
+        m_next_entry = (m_next_entry + 1) % NRF_802154_CSL_TX_PEERS;
+
+        memcpy(p_entry->addr, p_addr, addr_size);
+        p_entry->addr_size = addr_size;
+    }
+
+    p_entry->period      = (uint32_t)period * CSL_UNIT_US;
+    p_entry->sample_time = sfd_time + (uint32_t)phase * CSL_UNIT_US;
+}
+
+void nrf_802154_csl_tx_init(void)
+{
+    memset(m_entries, 0, sizeof(m_entries));
+    m_next_entry = 0;
+}
+
+void nrf_802154_csl_tx_frame_received(const uint8_t * p_frame, uint64_t sfd_time)
+{
+    const uint8_t * p_src_addr;
+    bool            src_addr_extended;
+
+    p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &src_addr_extended);
+
+    if (p_src_addr != NULL)
+    {
+        entry_update(p_src_addr, src_addr_extended, p_frame, sfd_time);
+    }
+}
+
+void nrf_802154_csl_tx_ack_received(const uint8_t * p_frame,
+                                    const uint8_t * p_ack,
+                                    uint64_t        sfd_time)
+{
+    const uint8_t * p_dst_addr;
+    bool            dst_addr_extended;
+
+    // Enh-ACKs usually omit the source address, the ACK comes from the destination of the frame.
+    p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &dst_addr_extended);
+
+    if (p_dst_addr != NULL)
+    {
+        entry_update(p_dst_addr, dst_addr_extended, p_ack, sfd_time);
+    }
+}
+
+bool nrf_802154_csl_tx_time_get(const uint8_t * p_frame, uint64_t earliest, uint64_t * p_tx_time)
+{
+    const uint8_t                 * p_dst_addr;
+    bool                            dst_addr_extended;
+    const csl_tx_entry_t          * p_entry;
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &dst_addr_extended);
+
+    if (p_dst_addr == NULL)
+    {
+        return false;
+    }
+
+    // The entries are updated from the RADIO IRQ handler.
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = entry_find(p_dst_addr,
+                         dst_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    if (p_entry != NULL)
+    {
+        uint64_t tx_time = p_entry->sample_time;
+
+        if (tx_time < earliest)
+        {
+            uint64_t periods = (earliest - tx_time + p_entry->period - 1U) / p_entry->period;
+
+            tx_time += periods * p_entry->period;
+        }
+
+        *p_tx_time = tx_time;
+        result     = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+#endif // NRF_802154_CSL_TX_ENABLED
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRF_802154_CSL_TX_H
+#define NRF_802154_CSL_TX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @defgroup nrf_802154_csl_tx CSL transmitter
+ * @{
+ * @ingroup nrf_802154
+ * @brief Tracking of the channel sample times of CSL receivers.
+ *
+ * The CSL IE found in the frames and Enh-ACKs received from a peer gives the time of its next
+ * channel sample and its sampling period. The module keeps them per peer, so that frames to
+ * the peer can be scheduled at its next channel sample.
+ */
+
+/**
+ * @brief Initializes the CSL transmitter.
+ */
+void nrf_802154_csl_tx_init(void);
+
+/**
+ * @brief Updates the CSL state of the source of a received frame.
+ *
+ * Frames without the source address or without the CSL IE are ignored. A CSL IE with
+ * the period equal to 0 removes the peer.
+ *
+ * @param[in]  p_frame   Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  sfd_time  Time at which the SFD of the frame was received, in microseconds, in
+ *                       the time base of @ref nrf_802154_lp_timer_time64_get.
+ */
+void nrf_802154_csl_tx_frame_received(const uint8_t * p_frame, uint64_t sfd_time);
+
+/**
+ * @brief Updates the CSL state of the destination of a frame with the received Enh-ACK.
+ *
+ * @param[in]  p_frame   Pointer to the buffer that contains the PHR and PSDU of the
+ *                       acknowledged frame.
+ * @param[in]  p_ack     Pointer to the buffer that contains the PHR and PSDU of the Enh-ACK.
+ * @param[in]  sfd_time  Time at which the SFD of the Enh-ACK was received, in microseconds, in
+ *                       the time base of @ref nrf_802154_lp_timer_time64_get.
+ */
+void nrf_802154_csl_tx_ack_received(const uint8_t * p_frame,
+                                    const uint8_t * p_ack,
+                                    uint64_t        sfd_time);
+
+/**
+ * @brief Gets the time of the first channel sample of the destination of a frame.
+ *
+ * @param[in]  p_frame    Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  earliest   Earliest time at which the frame can be transmitted, in microseconds.
+ * @param[out] p_tx_time  Time of the first channel sample of the destination not earlier than
+ *                        @p earliest, in microseconds.
+ *
+ * @retval  true   The time is written to @p p_tx_time.
+ * @retval  false  The destination of the frame is not a known CSL receiver.
+ */
+bool nrf_802154_csl_tx_time_get(const uint8_t * p_frame, uint64_t earliest, uint64_t * p_tx_time);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_CSL_TX_H
@@ -35,7 +35,8 @@
  *
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_CSMACA
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_CSMACA
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_CSMACA_LOG_VERBOSITY
 
 #include "nrf_802154_csma_ca.h"
 
@@ -46,14 +47,16 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_core_hooks.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_random_pool.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_rssi.h"
 #include "nrf_802154_stats.h"
 #include "mac_features/nrf_802154_frame_parser.h"
-#include "platform/random/nrf_802154_random.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "timer/nrf_802154_timer_sched.h"
 
@@ -64,6 +67,111 @@ static uint8_t m_be;                 ///< Backoff exponent, which is related to
 
 static const uint8_t * mp_data;      ///< Pointer to a buffer containing PHR and PSDU of the frame being transmitted.
 static bool            m_is_running; ///< Indicates if CSMA-CA procedure is running.
+static uint32_t        m_start_time; ///< Time when the current procedure was started.
+
+static nrf_802154_tx_params_t m_tx_params;       ///< Per-frame transmit parameters of the current procedure.
+static bool                   m_tx_params_valid; ///< If @ref m_tx_params apply to the current procedure.
+
+static bool     m_deadline_valid; ///< If the current procedure must transmit before @ref m_deadline.
+static uint32_t m_deadline;       ///< Time after which no more CCA attempts are made.
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+
+#define BUSY_RATIO_SHIFT 16U                       ///< Fractional bits of the channel busy ratio.
+#define BUSY_RATIO_ONE   (1UL << BUSY_RATIO_SHIFT) ///< Busy ratio of a channel that is always busy.
+
+static volatile uint32_t m_busy_ratio;   ///< Moving average of the channel busy ratio.
+static uint8_t           m_max_backoffs; ///< Maximum number of backoffs of the current procedure.
+
+/**
+ * @brief Update the moving average of the channel busy ratio with a new sample.
+ *
+ * @param[in]  busy  If the channel was found busy.
+ */
+static void busy_ratio_update(bool busy)
+{
+    uint32_t ratio  = m_busy_ratio;
+    uint32_t sample = busy ? BUSY_RATIO_ONE : 0UL;
+
+    ratio -= ratio >> NRF_802154_CSMA_CA_ADAPTIVE_EWMA_SHIFT;
+    ratio += sample >> NRF_802154_CSMA_CA_ADAPTIVE_EWMA_SHIFT;
+
+    m_busy_ratio = ratio;
+}
+
+/**
+ * @brief Scale a value by the current channel busy ratio.
+ *
+ * @param[in]  value  Value that corresponds to a channel that is always busy.
+ *
+ * @returns  @p value multiplied by the channel busy ratio, rounded to the nearest integer.
+ */
+static uint32_t busy_ratio_scale(uint32_t value)
+{
+    return ((value * m_busy_ratio) + (BUSY_RATIO_ONE / 2U)) >> BUSY_RATIO_SHIFT;
+}
+
+/**
+ * @brief Set the initial backoff exponent and the maximum number of backoffs of the procedure.
+ *
+ * Both parameters are raised from the values stored in the PIB proportionally to the channel busy
+ * ratio, within the bounds given by macMaxBE and
+ * @ref NRF_802154_CSMA_CA_ADAPTIVE_MAX_EXTRA_BACKOFFS.
+ */
+static void adaptive_params_set(void)
+{
+    uint8_t  min_be       = nrf_802154_pib_csmaca_min_be_get();
+    uint8_t  max_be       = nrf_802154_pib_csmaca_max_be_get();
+    uint32_t max_backoffs = nrf_802154_pib_csmaca_max_backoffs_get();
+
+    m_be = min_be;
+
+    if (max_be > min_be)
+    {
+        m_be += (uint8_t)busy_ratio_scale(max_be - min_be);
+    }
+
+    // Procedure with no backoffs allowed is not extended to keep its semantics.
+    if (max_backoffs > 0)
+    {
+        max_backoffs += busy_ratio_scale(NRF_802154_CSMA_CA_ADAPTIVE_MAX_EXTRA_BACKOFFS);
+    }
+
+    m_max_backoffs = (max_backoffs > UINT8_MAX) ? UINT8_MAX : (uint8_t)max_backoffs;
+}
+
+#endif // NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+
+/**
+ * @brief Get index of the bucket of a CSMA-CA time histogram.
+ *
+ * @param[in]  time_us  Time to be counted in the histogram in microseconds (us).
+ *
+ * @returns  Index of the bucket that counts @p time_us. Refer to
+ *           @ref NRF_802154_STAT_CSMA_TIME_BUCKETS for the layout of the buckets.
+ */
+static uint32_t time_bucket_get(uint32_t time_us)
+{
+    uint32_t periods = time_us / NRF_802154_STAT_CSMA_TIME_BUCKET_BASE_US;
+    uint32_t bucket  = (periods == 0) ? 0 : (32U - __CLZ(periods));
+
+    return (bucket < NRF_802154_STAT_CSMA_TIME_BUCKETS) ?
+           bucket : (NRF_802154_STAT_CSMA_TIME_BUCKETS - 1);
+}
+
+/**
+ * @brief Get maximum number of backoffs of the current procedure.
+ *
+ * @returns  macMaxCsmaBackoffs, extended by the adaptive policy if it is enabled.
+ */
+static uint8_t max_backoffs_get(void)
+{
+#if NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+    return m_max_backoffs;
+#else
+    return nrf_802154_pib_csmaca_max_backoffs_get();
+#endif
+}
 
 /**
  * @brief Perform appropriate actions for busy channel conditions.
@@ -97,6 +205,7 @@ static void procedure_stop(void)
 
     nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_CSMACA);
     m_is_running = false;
+    nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_CSMA_CA);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -131,7 +240,7 @@ static void notify_busy_channel(bool result)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    if (!result && (m_nb >= (nrf_802154_pib_csmaca_max_backoffs_get() - 1)))
+    if (!result && (m_nb >= (max_backoffs_get() - 1)))
     {
         nrf_802154_notify_transmit_failed(mp_data, NRF_802154_TX_ERROR_BUSY_CHANNEL);
     }
@@ -156,6 +265,18 @@ static void frame_transmit(rsch_dly_ts_id_t dly_ts_id)
 
     if (procedure_is_running())
     {
+        if (m_deadline_valid &&
+            !nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(),
+                                                      m_deadline,
+                                                      0))
+        {
+            procedure_stop();
+            nrf_802154_notify_transmit_failed(mp_data, NRF_802154_TX_ERROR_DEADLINE_MISSED);
+
+            nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+            return;
+        }
+
         priority_leverage();
 
         if (!nrf_802154_request_transmit(NRF_802154_TERM_NONE,
@@ -163,7 +284,8 @@ static void frame_transmit(rsch_dly_ts_id_t dly_ts_id)
                                          mp_data,
                                          true,
                                          NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT ? false : true,
-                                         notify_busy_channel))
+                                         notify_busy_channel,
+                                         m_tx_params_valid ? &m_tx_params : NULL))
         {
             (void)channel_busy();
         }
@@ -174,30 +296,36 @@ static void frame_transmit(rsch_dly_ts_id_t dly_ts_id)
 
 /**
  * @brief Delay CCA procedure for random (2^BE - 1) unit backoff periods.
+ *
+ * @param[in]  t0  Base time of the backoff.
+ * @param[in]  dt  Delay from @p t0 after which the backoff periods start.
  */
-static void random_backoff_start(void)
+static void random_backoff_start(uint32_t t0, uint32_t dt)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    uint8_t backoff_periods = nrf_802154_random_get() % (1 << m_be);
+    uint8_t backoff_periods = nrf_802154_random_pool_get() % (1 << m_be);
 
     // If maximum number of CSMA-CA backoffs is equal to 0, this function is called only once
     // and no more backoffs will follow. Forcing the first and only backoff to 0 has the same
     // effect as no backoff at all.
-    if (0 == nrf_802154_pib_csmaca_max_backoffs_get())
+    if (0 == max_backoffs_get())
     {
         backoff_periods = 0;
     }
 
     rsch_dly_ts_param_t backoff_ts_param =
     {
-        .t0               = nrf_802154_timer_sched_time_get(),
-        .dt               = backoff_periods * UNIT_BACKOFF_PERIOD,
+        .t0               = t0,
+        .dt               = dt + backoff_periods * UNIT_BACKOFF_PERIOD,
         .id               = RSCH_DLY_CSMACA,
         .type             = RSCH_DLY_TS_TYPE_RELAXED,
         .started_callback = frame_transmit,
     };
 
+    nrf_802154_stat_csma_histogram_increment(backoff_delay,
+                                             time_bucket_get(backoff_ts_param.dt - dt));
+
     switch (nrf_802154_pib_coex_tx_request_mode_get())
     {
         case NRF_802154_COEX_TX_REQUEST_MODE_FRAME_READY:
@@ -237,6 +365,10 @@ static bool channel_busy(void)
     {
         nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+        busy_ratio_update(true);
+#endif
+
         m_nb++;
 
         if (m_be < nrf_802154_pib_csmaca_max_be_get())
@@ -244,13 +376,14 @@ static bool channel_busy(void)
             m_be++;
         }
 
-        if (m_nb < nrf_802154_pib_csmaca_max_backoffs_get())
+        if (m_nb < max_backoffs_get())
         {
-            random_backoff_start();
+            random_backoff_start(nrf_802154_timer_sched_time_get(), 0);
             result = false;
         }
         else
         {
+            nrf_802154_stat_counter_increment(channel_access_failures);
             procedure_stop();
         }
 
@@ -260,26 +393,93 @@ static bool channel_busy(void)
     return result;
 }
 
-void nrf_802154_csma_ca_start(const uint8_t * p_data)
+/**
+ * @brief Initializes the state of a new CSMA-CA procedure.
+ *
+ * @param[in]  p_data    Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]  p_params  Per-frame transmit parameters or NULL.
+ * @param[in]  ts        Time when the procedure starts.
+ */
+static void procedure_init(const uint8_t                * p_data,
+                           const nrf_802154_tx_params_t * p_params,
+                           uint32_t                       ts)
+{
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+    nrf_802154_stat_timestamp_write(last_csmaca_start_timestamp, ts);
+#endif
+
+    assert(!procedure_is_running());
+
+    if ((p_params != NULL) && (p_params != &m_tx_params))
+    {
+        m_tx_params = *p_params;
+    }
+
+    m_tx_params_valid = (p_params != NULL);
+
+    mp_data          = p_data;
+    m_nb             = 0;
+    m_be             = nrf_802154_pib_csmaca_min_be_get();
+    m_is_running     = true;
+    m_start_time     = ts;
+    m_deadline_valid = false;
+
+    nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_CSMA_CA);
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+    adaptive_params_set();
+#endif
+}
+
+void nrf_802154_csma_ca_start(const uint8_t * p_data, const nrf_802154_tx_params_t * p_params)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
     uint32_t ts = nrf_802154_timer_sched_time_get();
 
-    nrf_802154_stat_timestamp_write(last_csmaca_start_timestamp, ts);
+    procedure_init(p_data, p_params, ts);
+
+#if NRF_802154_CSMA_CA_RX_DURING_BACKOFF
+    // Listen during backoff periods. The request does not abort any ongoing operation and is
+    // ignored if the receiver is already enabled.
+    (void)nrf_802154_request_receive(NRF_802154_TERM_NONE, REQ_ORIG_CSMA_CA, NULL, false);
 #endif
 
-    assert(!procedure_is_running());
+    random_backoff_start(ts, 0);
 
-    mp_data      = p_data;
-    m_nb         = 0;
-    m_be         = nrf_802154_pib_csmaca_min_be_get();
-    m_is_running = true;
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
 
-    random_backoff_start();
+bool nrf_802154_csma_ca_start_at(const uint8_t                * p_data,
+                                 uint32_t                       t0,
+                                 uint32_t                       dt,
+                                 uint32_t                       window,
+                                 const nrf_802154_tx_params_t * p_params)
+{
+    bool result = false;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(), t0, dt))
+    {
+        procedure_init(p_data, p_params, t0 + dt);
+
+        m_deadline_valid = true;
+        m_deadline       = t0 + dt + window;
+
+        random_backoff_start(t0, dt);
+
+        result = true;
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+const nrf_802154_tx_params_t * nrf_802154_csma_ca_tx_params_get(void)
+{
+    return m_tx_params_valid ? &m_tx_params : NULL;
 }
 
 bool nrf_802154_csma_ca_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
@@ -334,6 +534,20 @@ bool nrf_802154_csma_ca_tx_started_hook(const uint8_t * p_frame)
     {
         nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+        if (procedure_is_running())
+        {
+            uint32_t latency = nrf_802154_timer_sched_time_get() - m_start_time;
+            uint32_t nb      = (m_nb < NRF_802154_STAT_CSMA_NB_BUCKETS) ?
+                               m_nb : (NRF_802154_STAT_CSMA_NB_BUCKETS - 1);
+
+            nrf_802154_stat_csma_histogram_increment(nb_at_success, nb);
+            nrf_802154_stat_csma_histogram_increment(tx_latency, time_bucket_get(latency));
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+            busy_ratio_update(false);
+#endif
+        }
+
         procedure_stop();
 
         nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -342,4 +556,18 @@ bool nrf_802154_csma_ca_tx_started_hook(const uint8_t * p_frame)
     return true;
 }
 
+#if NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+
+void nrf_802154_csma_ca_ed_sample_process(uint8_t ed_sample)
+{
+    nrf_802154_cca_cfg_t cca_cfg;
+
+    nrf_802154_pib_cca_cfg_get(&cca_cfg);
+
+    busy_ratio_update(ed_sample >
+                      nrf_802154_rssi_cca_ed_threshold_corrected_get(cca_cfg.ed_threshold));
+}
+
+#endif // NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+
 #endif // NRF_802154_CSMA_CA_ENABLED
@@ -35,6 +35,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_types.h"
 
@@ -57,10 +58,56 @@
  *       timed out by the next layer. The ACK timeout timer must start when
  *       the @ref nrf_802154_tx_started() function is called.
  *
+ * @note If @ref NRF_802154_CSMA_CA_RX_DURING_BACKOFF is enabled, this function also requests
+ *       the receive state, so that frames can be received during the backoff periods.
+ *
  * @param[in]  p_data    Pointer to a buffer the contains PHR and PSDU of the frame
  *                       that is to be transmitted.
+ * @param[in]  p_params  Pointer to the per-frame transmit parameters applied to each CCA attempt
+ *                       and to the transmission, or NULL to use the PIB configuration. The
+ *                       structure is copied. Its @c cca field is ignored, as the CCA is always
+ *                       performed.
  */
-void nrf_802154_csma_ca_start(const uint8_t * p_data);
+void nrf_802154_csma_ca_start(const uint8_t * p_data, const nrf_802154_tx_params_t * p_params);
+
+/**
+ * @brief Starts the CSMA-CA procedure for the transmission of a given frame at a given time.
+ *
+ * This function works like @ref nrf_802154_csma_ca_start, but the first backoff period starts
+ * @p dt microseconds after @p t0 instead of immediately. No CCA attempt is made later than
+ * @p window microseconds after that time. If the frame cannot be transmitted in the window,
+ * the @ref nrf_802154_transmit_failed() function is called with
+ * @ref NRF_802154_TX_ERROR_DEADLINE_MISSED.
+ *
+ * @note The receiver is not requested for the backoff periods, even if
+ *       @ref NRF_802154_CSMA_CA_RX_DURING_BACKOFF is enabled.
+ *
+ * @param[in]  p_data    Pointer to a buffer the contains PHR and PSDU of the frame
+ *                       that is to be transmitted.
+ * @param[in]  t0        Base of delay time, in microseconds.
+ * @param[in]  dt        Delay from @p t0 to the start of the procedure, in microseconds.
+ * @param[in]  window    Time from the start of the procedure in which CCA attempts are made,
+ *                       in microseconds.
+ * @param[in]  p_params  Pointer to the per-frame transmit parameters, as in
+ *                       @ref nrf_802154_csma_ca_start.
+ *
+ * @retval  true   The procedure was scheduled.
+ * @retval  false  The procedure was not scheduled, because the requested time is in the past.
+ */
+bool nrf_802154_csma_ca_start_at(const uint8_t                * p_data,
+                                 uint32_t                       t0,
+                                 uint32_t                       dt,
+                                 uint32_t                       window,
+                                 const nrf_802154_tx_params_t * p_params);
+
+/**
+ * @brief Gets the per-frame transmit parameters of the last CSMA-CA procedure.
+ *
+ * It is meant for restarting the procedure for the same frame with the same parameters.
+ *
+ * @returns  Pointer to the parameters, or NULL if the procedure uses the PIB configuration.
+ */
+const nrf_802154_tx_params_t * nrf_802154_csma_ca_tx_params_get(void);
 
 /**
  * @brief Aborts the ongoing CSMA-CA procedure.
@@ -103,6 +150,18 @@ bool nrf_802154_csma_ca_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_er
  */
 bool nrf_802154_csma_ca_tx_started_hook(const uint8_t * p_frame);
 
+#if NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+
+/**
+ * @brief Updates the channel busy ratio used by the adaptive CSMA-CA policy with an ED result.
+ *
+ * @param[in]  ed_sample  Maximum energy level measured during the energy detection procedure,
+ *                        in the units of the RADIO EDSAMPLE register.
+ */
+void nrf_802154_csma_ca_ed_sample_process(uint8_t ed_sample);
+
+#endif // NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+
 /**
  *@}
  **/
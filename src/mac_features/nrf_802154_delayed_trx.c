@@ -35,27 +35,37 @@
  *
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_DELAYED_TRX
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_DELAYED_TRX
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_DELAYED_TRX_LOG_VERBOSITY
 
 #include "nrf_802154_delayed_trx.h"
 
 #include <assert.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
+#include "nrf_802154.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_core_hooks.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_utils.h"
+#include "platform/clock/nrf_802154_clock.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "timer/nrf_802154_timer_sched.h"
 
 #if NRF_802154_DELAYED_TRX_ENABLED
 
+#if NRF_802154_DELAYED_TRX_SCHEDULE_SIZE < 1
+#error NRF_802154_DELAYED_TRX_SCHEDULE_SIZE must be at least 1.
+#endif
+
 /* The following time is the sum of 70us RTC_IRQHandler processing time, 40us of time that elapses
  * from the moment a board starts transmission to the moment other boards (e.g. sniffer) are able
  * to detect that frame and in case of TX - 93us that accounts for a delay of yet unknown origin.
@@ -74,6 +84,16 @@ typedef enum
     DELAYED_TRX_OP_STATE_NB       ///< Number of delayed operation states.
 } delayed_trx_op_state_t;
 
+/**
+ * @brief Measurements performed by delayed operations instead of the reception.
+ */
+typedef enum
+{
+    DLY_MEASURE_NONE, ///< The operation is a transmission or a receive window.
+    DLY_MEASURE_ED,   ///< The operation is an energy detection.
+    DLY_MEASURE_CCA,  ///< The operation is a standalone CCA.
+} dly_measure_t;
+
 /**
  * @brief RX delayed operation frame data.
  */
@@ -84,29 +104,331 @@ typedef struct
     bool     ack_requested; ///< Flag indicating if Ack for the frame to be received in RX window is requested.
 } delayed_rx_frame_data_t;
 
+/**
+ * @brief Delayed operation waiting in the schedule.
+ */
+typedef struct
+{
+    rsch_dly_ts_id_t id;       ///< Delayed timeslot ID: @ref RSCH_DLY_TX or @ref RSCH_DLY_RX.
+    uint32_t         t0;       ///< Base of the time of the timeslot start.
+    uint32_t         dt;       ///< Delta of the time of the timeslot start, setup time excluded.
+    uint32_t         start;    ///< Requested time of the operation, used to identify RX windows.
+    const uint8_t  * p_data;   ///< Pointer to a buffer containing PHR and PSDU of the TX frame.
+    uint32_t         timeout;  ///< Reception timeout of the RX window.
+    uint8_t          channel;  ///< Channel number on which the operation should be performed.
+    bool             cca;      ///< If CCA should be performed prior to transmission.
+    bool             periodic; ///< If the operation is a periodic receive window or beacon.
+    bool             params;   ///< If @p tx_params apply to the TX frame.
+    dly_measure_t    measure;  ///< Measurement performed in the @ref RSCH_DLY_RX timeslot.
+
+    nrf_802154_tx_params_t tx_params; ///< Per-frame transmit parameters of the TX frame.
+} dly_op_t;
+
+/**
+ * @brief Configuration of the periodic receive windows.
+ */
+typedef struct
+{
+    uint32_t period;     ///< Time between the starts of consecutive windows.
+    uint32_t window;     ///< Duration of each window.
+    uint32_t next_start; ///< Start time of the next window.
+    uint8_t  channel;    ///< Channel number on which the windows are opened.
+} dly_periodic_rx_t;
+
+/**
+ * @brief Configuration of the periodic beacon transmission.
+ */
+typedef struct
+{
+    uint8_t                * p_data;     ///< Buffer containing PHR and PSDU of the beacon.
+    uint32_t                 period;     ///< Time between the starts of consecutive beacons.
+    uint32_t                 next_start; ///< Start time of the next beacon.
+    uint8_t                  channel;    ///< Channel number on which the beacons are transmitted.
+    bool                     dsn_update; ///< If the sequence number is updated for every beacon.
+    bool                     first;      ///< If the next beacon is the first one.
+    bool                     params;     ///< If @p tx_params apply to the beacon.
+    nrf_802154_tx_params_t   tx_params;  ///< Per-frame transmit parameters of the beacon.
+} dly_periodic_tx_t;
+
+/**
+ * @brief Predicate selecting delayed operations to be cancelled.
+ *
+ * @param[in]  p_op       Delayed operation to check.
+ * @param[in]  p_context  Context passed to @ref dly_op_cancel.
+ *
+ * @retval true   The operation is to be cancelled.
+ * @retval false  The operation is to be kept.
+ */
+typedef bool (* dly_op_match_t)(const dly_op_t * p_op, const void * p_context);
+
+/**
+ * @brief Delayed operations waiting to be requested from RSCH, sorted by the timeslot start.
+ */
+static dly_op_t m_schedule[NRF_802154_DELAYED_TRX_SCHEDULE_SIZE];
+static uint8_t  m_schedule_count; ///< Number of operations in @ref m_schedule.
+
+/**
+ * @brief Delayed operation for which the timeslot is requested from RSCH.
+ *
+ * Only the earliest operation is requested from RSCH. It is moved out of @ref m_schedule
+ * when it is requested, and put back if an earlier operation is scheduled before its timeslot
+ * starts.
+ */
+static dly_op_t      m_requested_op;
+static volatile bool m_requested_op_valid; ///< If @ref m_requested_op is requested from RSCH.
+
 /**
  * @brief TX delayed operation configuration.
  */
-static const uint8_t * mp_tx_data;         ///< Pointer to a buffer containing PHR and PSDU of the frame requested to be transmitted.
-static bool            m_tx_cca;           ///< If CCA should be performed prior to transmission.
-static uint8_t         m_tx_channel;       ///< Channel number on which transmission should be performed.
+static const uint8_t * mp_tx_data;         ///< Pointer to a buffer containing PHR and PSDU of the frame being transmitted.
+static volatile bool   m_tx_periodic;      ///< If the current transmission is a periodic beacon.
 
 /**
  * @brief RX delayed operation configuration.
  */
 static nrf_802154_timer_t m_timeout_timer; ///< Timer for delayed RX timeout handling.
-static uint8_t            m_rx_channel;    ///< Channel number on which reception should be performed.
+static uint32_t           m_rx_start;      ///< Requested start time of the current RX window.
+static volatile bool      m_rx_periodic;   ///< If the current RX window is a periodic one.
+
+/**
+ * @brief Periodic receive windows configuration.
+ */
+static dly_periodic_rx_t m_periodic_rx;
+static volatile bool     m_periodic_rx_active; ///< If periodic receive windows are enabled.
 
 /**
- * @brief State of delayed operations.
+ * @brief Periodic beacon transmission configuration.
  */
-static volatile delayed_trx_op_state_t m_dly_op_state[RSCH_DLY_TS_NUM];
+static dly_periodic_tx_t m_periodic_tx;
+static volatile bool     m_periodic_tx_active; ///< If periodic beacon transmission is enabled.
+
+/**
+ * @brief State of the RX window.
+ */
+static volatile delayed_trx_op_state_t m_dly_rx_state;
 
 /**
  * @brief RX delayed operation frame data.
  */
 static volatile delayed_rx_frame_data_t m_dly_rx_frame;
 
+#if NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+/**
+ * @brief Measured setup times of delayed transmissions and receptions.
+ *
+ * A setup time is measured from the start of the delayed timeslot to the moment the core accepts
+ * the request. It is measured using the same time base as the timeslots.
+ */
+static uint32_t m_tx_setup_max;     ///< Longest measured TX setup time [us].
+static uint32_t m_rx_setup_max;     ///< Longest measured RX setup time [us].
+static uint8_t  m_tx_setup_samples; ///< Number of TX setup time measurements, saturated.
+static uint8_t  m_rx_setup_samples; ///< Number of RX setup time measurements, saturated.
+static uint32_t m_ts_start;         ///< Requested start time of the timeslot of the current operation.
+#endif
+
+#if NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US > 0
+/**
+ * @brief Coex lead time handling.
+ *
+ * When the timeslot of @ref m_requested_op is requested with the coex lead time, the operation
+ * stays requested after its timeslot starts, until @ref m_coex_lead_timer fires at the time
+ * the operation is to be started.
+ */
+static nrf_802154_timer_t m_coex_lead_timer;
+static volatile bool      m_coex_lead_applied; ///< If the requested timeslot includes the lead time.
+#endif
+
+#if NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+/**
+ * @brief HFCLK pre-start handling.
+ *
+ * While the timeslot of @ref m_requested_op is requested, @ref m_hfclk_timer requests the HFCLK
+ * one start-up time before the timeslot starts. The start-up time is measured from the request
+ * to the moment the HFCLK is ready.
+ */
+static nrf_802154_timer_t m_hfclk_timer;
+static volatile bool      m_hfclk_prestarted;    ///< If the HFCLK is requested by this module.
+static uint32_t           m_hfclk_prestart_time; ///< Time at which the HFCLK was requested.
+static uint32_t           m_hfclk_startup_max;   ///< Longest measured HFCLK start-up time [us].
+static bool               m_hfclk_startup_valid; ///< If @ref m_hfclk_startup_max is measured.
+#endif
+
+static void dly_op_request_next(void);
+static bool dly_op_schedule(const dly_op_t * p_op);
+
+#if NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+/**
+ * Update the running maximum of a setup time with the time elapsed since the timeslot start.
+ *
+ * @param[inout]  p_max      Longest measured setup time.
+ * @param[inout]  p_samples  Number of collected measurements.
+ */
+static void setup_time_measure(uint32_t * p_max, uint8_t * p_samples)
+{
+    uint32_t sample = nrf_802154_timer_sched_time_get() - m_ts_start;
+
+    if (sample > *p_max)
+    {
+        *p_max = sample;
+    }
+
+    if (*p_samples < NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_SAMPLES)
+    {
+        (*p_samples)++;
+    }
+}
+
+/**
+ * Get the calibrated setup time.
+ *
+ * @param[in]  max         Longest measured setup time.
+ * @param[in]  samples     Number of collected measurements.
+ * @param[in]  worst_case  Worst-case setup time.
+ *
+ * @returns  Setup time to be used to schedule delayed operations.
+ */
+static uint32_t setup_time_calibrated_get(uint32_t max, uint8_t samples, uint32_t worst_case)
+{
+    uint32_t setup_time = max + NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_MARGIN;
+
+    if ((samples < NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_SAMPLES) || (setup_time > worst_case))
+    {
+        setup_time = worst_case;
+    }
+
+    return setup_time;
+}
+
+#endif // NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+
+/** Get the time needed to prepare a delayed transmission. */
+static uint32_t tx_setup_time_get(void)
+{
+#if NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+    return setup_time_calibrated_get(m_tx_setup_max, m_tx_setup_samples, TX_SETUP_TIME);
+#else
+    return TX_SETUP_TIME;
+#endif
+}
+
+/** Get the time needed to prepare a delayed reception. */
+static uint32_t rx_setup_time_get(void)
+{
+#if NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+    return setup_time_calibrated_get(m_rx_setup_max, m_rx_setup_samples, RX_SETUP_TIME);
+#else
+    return RX_SETUP_TIME;
+#endif
+}
+
+#if NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+/** Get the time needed to start the HFCLK. */
+static uint32_t hfclk_startup_time_get(void)
+{
+    if (!m_hfclk_startup_valid)
+    {
+        return NRF_802154_DELAYED_TRX_HFCLK_STARTUP_TIME;
+    }
+
+    return m_hfclk_startup_max + NRF_802154_DELAYED_TRX_HFCLK_STARTUP_MARGIN;
+}
+
+/**
+ * Request the HFCLK ahead of the timeslot of the requested operation.
+ *
+ * @param[in]  p_context  Not used.
+ */
+static void hfclk_prestart(void * p_context)
+{
+    (void)p_context;
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            prestart;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    prestart = m_requested_op_valid && !m_hfclk_prestarted;
+
+    if (prestart)
+    {
+        m_hfclk_prestarted    = true;
+        m_hfclk_prestart_time = nrf_802154_timer_sched_time_get();
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (prestart)
+    {
+        nrf_802154_clock_hfclk_prestart();
+    }
+}
+
+/**
+ * Schedule the HFCLK pre-start for the timeslot of a requested operation.
+ *
+ * @param[in]  t0  Base of the timeslot start time.
+ * @param[in]  dt  Timeslot start time relative to @p t0.
+ */
+static void hfclk_prestart_schedule(uint32_t t0, uint32_t dt)
+{
+    uint32_t startup_time = hfclk_startup_time_get();
+
+    if ((dt > startup_time) &&
+        nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(),
+                                                 t0,
+                                                 dt - startup_time))
+    {
+        m_hfclk_timer.t0        = t0;
+        m_hfclk_timer.dt        = dt - startup_time;
+        m_hfclk_timer.callback  = hfclk_prestart;
+        m_hfclk_timer.p_context = NULL;
+
+        nrf_802154_timer_sched_add(&m_hfclk_timer, false);
+    }
+    else
+    {
+        hfclk_prestart(NULL);
+    }
+}
+
+/** Stop the HFCLK pre-start and release the HFCLK if it is requested by this module. */
+static void hfclk_prestart_cancel(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            prestarted;
+
+    nrf_802154_timer_sched_remove(&m_hfclk_timer, NULL);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    prestarted         = m_hfclk_prestarted;
+    m_hfclk_prestarted = false;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (prestarted)
+    {
+        nrf_802154_clock_hfclk_prestart_release();
+    }
+}
+
+void nrf_802154_clock_hfclk_prestart_ready(void)
+{
+    if (m_hfclk_prestarted)
+    {
+        uint32_t sample = nrf_802154_timer_sched_time_get() - m_hfclk_prestart_time;
+
+        if (!m_hfclk_startup_valid || (sample > m_hfclk_startup_max))
+        {
+            m_hfclk_startup_max = sample;
+        }
+
+        m_hfclk_startup_valid = true;
+    }
+}
+
+#endif // NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+
 /**
  * Set state of a delayed operation.
  *
@@ -121,383 +443,1221 @@ static bool dly_rx_state_set(delayed_trx_op_state_t expected_dly_rx_state,
 {
     volatile delayed_trx_op_state_t current_dly_rx_state;
 
-    do
+    assert(new_dly_rx_state < DELAYED_TRX_OP_STATE_NB);
+
+    do
+    {
+        current_dly_rx_state = (delayed_trx_op_state_t)__LDREXB((uint8_t *)&m_dly_rx_state);
+
+        if (current_dly_rx_state != expected_dly_rx_state)
+        {
+            __CLREX();
+            return false;
+        }
+
+    }
+    while (__STREXB((uint8_t)new_dly_rx_state, (uint8_t *)&m_dly_rx_state));
+
+    __DMB();
+
+    if (new_dly_rx_state == DELAYED_TRX_OP_STATE_ONGOING)
+    {
+        nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_DELAYED_RX);
+    }
+    else if (expected_dly_rx_state == DELAYED_TRX_OP_STATE_ONGOING)
+    {
+        nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_DELAYED_RX);
+    }
+
+    return true;
+}
+
+/**
+ * Get state of the RX window.
+ *
+ * @retval     State of the RX window.
+ */
+static delayed_trx_op_state_t dly_rx_state_get(void)
+{
+    return m_dly_rx_state;
+}
+
+/**
+ * Check if the timeslot of one delayed operation starts before the timeslot of another.
+ *
+ * @param[in]  p_op     Delayed operation to check.
+ * @param[in]  p_other  Delayed operation to compare with.
+ *
+ * @retval true   Timeslot of @p p_op starts before the timeslot of @p p_other.
+ * @retval false  Timeslot of @p p_op starts at the same time or after the timeslot of @p p_other.
+ */
+static bool dly_op_is_earlier(const dly_op_t * p_op, const dly_op_t * p_other)
+{
+    return (int32_t)((p_op->t0 + p_op->dt) - (p_other->t0 + p_other->dt)) < 0;
+}
+
+/**
+ * Insert a delayed operation to the schedule.
+ *
+ * @note This function must be called in an MCU critical section.
+ *
+ * @param[in]  p_op  Delayed operation to insert.
+ *
+ * @retval true   The operation was inserted.
+ * @retval false  The schedule is full.
+ */
+static bool schedule_insert(const dly_op_t * p_op)
+{
+    // The operation requested from RSCH occupies one entry of the schedule capacity.
+    uint8_t used = m_schedule_count + (m_requested_op_valid ? 1U : 0U);
+
+    if (used >= NRF_802154_DELAYED_TRX_SCHEDULE_SIZE)
+    {
+        return false;
+    }
+
+    uint8_t idx = m_schedule_count;
+
+    // Operations with the same timeslot start are kept in the order they were scheduled.
+    while ((idx > 0) && dly_op_is_earlier(p_op, &m_schedule[idx - 1]))
+    {
+        m_schedule[idx] = m_schedule[idx - 1];
+        idx--;
+    }
+
+    m_schedule[idx] = *p_op;
+    m_schedule_count++;
+
+    return true;
+}
+
+/**
+ * Remove a delayed operation from the schedule.
+ *
+ * @note This function must be called in an MCU critical section.
+ *
+ * @param[in]  idx  Index of the operation in the schedule.
+ */
+static void schedule_remove(uint8_t idx)
+{
+    assert(idx < m_schedule_count);
+
+    m_schedule_count--;
+
+    for (uint8_t i = idx; i < m_schedule_count; i++)
+    {
+        m_schedule[i] = m_schedule[i + 1];
+    }
+}
+
+/**
+ * Schedule the next periodic receive window.
+ *
+ * Windows that would start too early to be prepared are skipped. If the next window cannot be
+ * scheduled, the periodic reception is stopped and the MAC layer is notified.
+ */
+static void periodic_rx_rearm(void)
+{
+    if (!m_periodic_rx_active)
+    {
+        return;
+    }
+
+    uint32_t now        = nrf_802154_timer_sched_time_get();
+    uint32_t next_start = m_periodic_rx.next_start;
+    uint32_t setup_time = rx_setup_time_get() + RX_RAMP_UP_TIME;
+    int32_t  lead_time  = (int32_t)(next_start - now - setup_time);
+
+    if (lead_time <= 0)
+    {
+        uint32_t periods_missed = ((uint32_t)(-lead_time) / m_periodic_rx.period) + 1U;
+
+        next_start += periods_missed * m_periodic_rx.period;
+    }
+
+    m_periodic_rx.next_start = next_start + m_periodic_rx.period;
+
+    dly_op_t op =
+    {
+        .id       = RSCH_DLY_RX,
+        .t0       = now,
+        .dt       = (next_start - now) - setup_time,
+        .start    = next_start,
+        .p_data   = NULL,
+        .timeout  = m_periodic_rx.window,
+        .channel  = m_periodic_rx.channel,
+        .cca      = false,
+        .periodic = true,
+        .params   = false,
+    };
+
+    if (!dly_op_schedule(&op))
+    {
+        m_periodic_rx_active = false;
+        nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+    }
+}
+
+/**
+ * Schedule the next periodic beacon.
+ *
+ * Beacons that would start too early to be prepared are skipped. If the next beacon cannot be
+ * scheduled, the periodic transmission is stopped and the MAC layer is notified.
+ */
+static void periodic_tx_rearm(void)
+{
+    if (!m_periodic_tx_active)
+    {
+        return;
+    }
+
+    uint32_t now        = nrf_802154_timer_sched_time_get();
+    uint32_t next_start = m_periodic_tx.next_start;
+    uint32_t setup_time = tx_setup_time_get() + TX_RAMP_UP_TIME;
+    int32_t  lead_time  = (int32_t)(next_start - now - setup_time);
+
+    if (lead_time <= 0)
+    {
+        uint32_t periods_missed = ((uint32_t)(-lead_time) / m_periodic_tx.period) + 1U;
+
+        next_start += periods_missed * m_periodic_tx.period;
+    }
+
+    m_periodic_tx.next_start = next_start + m_periodic_tx.period;
+
+    dly_op_t op =
+    {
+        .id        = RSCH_DLY_TX,
+        .t0        = now,
+        .dt        = (next_start - now) - setup_time,
+        .start     = next_start,
+        .p_data    = m_periodic_tx.p_data,
+        .timeout   = 0,
+        .channel   = m_periodic_tx.channel,
+        .cca       = false,
+        .periodic  = true,
+        .params    = m_periodic_tx.params,
+        .tx_params = m_periodic_tx.tx_params,
+    };
+
+    if (!dly_op_schedule(&op))
+    {
+        m_periodic_tx_active = false;
+        nrf_802154_notify_transmit_failed(m_periodic_tx.p_data,
+                                          NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+    }
+}
+
+/**
+ * Handle the end of an RX window that was not ended by the MAC layer.
+ *
+ * The periodic windows are re-armed silently. The end of other windows is notified to the MAC
+ * layer.
+ *
+ * @param[in]  error  Error to be notified.
+ */
+static void dly_rx_window_ended(nrf_802154_rx_error_t error)
+{
+    if (m_rx_periodic)
+    {
+        periodic_rx_rearm();
+    }
+    else
+    {
+        nrf_802154_notify_receive_failed(error);
+    }
+}
+
+/**
+ * Notify MAC layer that a scheduled delayed operation cannot be performed.
+ *
+ * @param[in]  p_op  Delayed operation that failed.
+ */
+static void dly_op_failed_notify(const dly_op_t * p_op)
+{
+    if ((p_op->id == RSCH_DLY_TX) && p_op->periodic)
+    {
+        periodic_tx_rearm();
+    }
+    else if (p_op->id == RSCH_DLY_TX)
+    {
+        nrf_802154_notify_transmit_failed(p_op->p_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+    }
+    else if (p_op->measure == DLY_MEASURE_ED)
+    {
+        nrf_802154_notify_energy_detection_failed(NRF_802154_ED_ERROR_TIMESLOT_DENIED);
+    }
+    else if (p_op->measure == DLY_MEASURE_CCA)
+    {
+        nrf_802154_notify_cca_failed(NRF_802154_CCA_ERROR_TIMESLOT_DENIED);
+    }
+    else if (p_op->periodic)
+    {
+        periodic_rx_rearm();
+    }
+    else
+    {
+        nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+    }
+}
+
+/**
+ * Request the timeslot of the given delayed operation from RSCH.
+ *
+ * @param[in]  p_op  Delayed operation.
+ *
+ * @retval true   The timeslot was requested.
+ * @retval false  The timeslot cannot be requested.
+ */
+static bool dly_op_timeslot_request(const dly_op_t * p_op);
+
+/**
+ * Move the earliest delayed operation from the schedule to RSCH.
+ *
+ * @param[in]  p_inserted  Delayed operation that has just been inserted by the caller or NULL.
+ *
+ * @retval true   The timeslot of the earliest operation is requested or the schedule is empty.
+ * @retval false  The timeslot of @p p_inserted was rejected. The operation was removed from
+ *                the schedule and its failure is to be reported by the caller.
+ */
+static bool dly_op_request_earliest(const dly_op_t * p_inserted)
+{
+    bool result = true;
+
+    while (true)
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+        bool                            request = false;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        if (!m_requested_op_valid && (m_schedule_count > 0))
+        {
+            // Mark the operation as requested before the request, in case the timeslot starts
+            // immediately and interrupts current function execution.
+            m_requested_op       = m_schedule[0];
+            m_requested_op_valid = true;
+            schedule_remove(0);
+            request = true;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (!request)
+        {
+            break;
+        }
+
+        dly_op_t op = m_requested_op;
+
+        if (dly_op_timeslot_request(&op))
+        {
+            break;
+        }
+
+        m_requested_op_valid = false;
+
+        if ((p_inserted != NULL) && (p_inserted->id == op.id) &&
+            (p_inserted->start == op.start) && (p_inserted->p_data == op.p_data) &&
+            (p_inserted->measure == op.measure))
+        {
+            result = false;
+        }
+        else
+        {
+            dly_op_failed_notify(&op);
+        }
+    }
+
+    return result;
+}
+
+static void dly_op_request_next(void)
+{
+    (void)dly_op_request_earliest(NULL);
+}
+
+/**
+ * Put a delayed operation to the schedule.
+ *
+ * @param[in]  p_op  Delayed operation to schedule.
+ *
+ * @retval true   The operation was scheduled.
+ * @retval false  The schedule is full or the timeslot of the operation cannot be requested.
+ */
+static bool dly_op_schedule(const dly_op_t * p_op)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result;
+
+    if (!nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(),
+                                                  p_op->t0,
+                                                  p_op->dt))
+    {
+        return false;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = schedule_insert(p_op);
+
+    if (result && m_requested_op_valid && dly_op_is_earlier(p_op, &m_requested_op))
+    {
+        // The new operation starts first. Take the timeslot back from RSCH. If it cannot be
+        // cancelled, the timeslot is just starting and the next operation is requested when
+        // it is handled.
+        if (nrf_802154_rsch_delayed_timeslot_cancel(m_requested_op.id))
+        {
+            m_requested_op_valid = false;
+
+#if NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+            hfclk_prestart_cancel();
+#endif
+
+            bool inserted = schedule_insert(&m_requested_op);
+
+            // The requested operation has just released the entry it occupied.
+            assert(inserted);
+            (void)inserted;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (result)
+    {
+        result = dly_op_request_earliest(p_op);
+    }
+
+    return result;
+}
+
+/**
+ * Cancel delayed operations waiting in the schedule or for their timeslot.
+ *
+ * @param[in]  match      Predicate selecting operations to cancel.
+ * @param[in]  p_context  Context passed to @p match.
+ *
+ * @retval true   At least one operation was cancelled.
+ * @retval false  No operation was cancelled.
+ */
+#if NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US > 0
+/**
+ * Stop waiting for the end of the coex lead time of the requested operation.
+ *
+ * @retval true   The lead time timer was running and is stopped.
+ * @retval false  The lead time timer was not running.
+ */
+static bool coex_lead_timer_stop(void)
+{
+    bool was_running;
+
+    nrf_802154_timer_sched_remove(&m_coex_lead_timer, &was_running);
+
+    return was_running;
+}
+
+#endif
+
+static bool dly_op_cancel(dly_op_match_t match, const void * p_context)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result         = false;
+    bool                            request_needed = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint8_t i = m_schedule_count; i > 0; i--)
+    {
+        if (match(&m_schedule[i - 1], p_context))
+        {
+            schedule_remove(i - 1);
+            result = true;
+        }
+    }
+
+    if (m_requested_op_valid && match(&m_requested_op, p_context))
+    {
+        bool cancelled = nrf_802154_rsch_delayed_timeslot_cancel(m_requested_op.id);
+
+#if NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US > 0
+        // The timeslot already started, but the operation may still wait for its start time.
+        cancelled = cancelled || coex_lead_timer_stop();
+#endif
+
+        if (cancelled)
+        {
+            m_requested_op_valid = false;
+            request_needed       = true;
+            result               = true;
+
+#if NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+            hfclk_prestart_cancel();
+#endif
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (request_needed)
+    {
+        dly_op_request_next();
+    }
+
+    return result;
+}
+
+/**
+ * Notify MAC layer that no frame was received before timeout.
+ *
+ * @param[in]  p_context  Not used.
+ */
+static void notify_rx_timeout(void * p_context)
+{
+    (void)p_context;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(dly_rx_state_get() != DELAYED_TRX_OP_STATE_PENDING);
+
+    if (dly_rx_state_get() == DELAYED_TRX_OP_STATE_ONGOING)
+    {
+        uint32_t now           = nrf_802154_timer_sched_time_get();
+        uint32_t sof_timestamp = m_dly_rx_frame.sof_timestamp;
+
+        // Make sure that the timestamp has been latched safely. If frame reception preempts the code
+        // after executing this line, the RX window will not be extended.
+        __DMB();
+        uint8_t  psdu_length   = m_dly_rx_frame.psdu_length;
+        bool     ack_requested = m_dly_rx_frame.ack_requested;
+        uint32_t frame_length  = nrf_802154_rx_duration_get(psdu_length, ack_requested);
+
+        if (nrf_802154_timer_sched_time_is_in_future(now, sof_timestamp, frame_length))
+        {
+            // @TODO protect against infinite extensions - allow only one timer extension
+            m_timeout_timer.t0 = sof_timestamp;
+            m_timeout_timer.dt = frame_length;
+
+            nrf_802154_timer_sched_add(&m_timeout_timer, true);
+        }
+        else
+        {
+            if (dly_rx_state_set(DELAYED_TRX_OP_STATE_ONGOING, DELAYED_TRX_OP_STATE_STOPPED))
+            {
+                dly_rx_window_ended(NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+            }
+
+            // even if the set operation failed, the delayed RX state
+            // should be set to STOPPED from other context anyway
+            assert(dly_rx_state_get() == DELAYED_TRX_OP_STATE_STOPPED);
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+/**
+ * Transmit request result callback.
+ *
+ * @param[in]  result  Result of TX request.
+ */
+static void dly_tx_result_notify(bool result)
+{
+    // To avoid attaching to every possible transmit hook, in order to be able
+    // to switch from ONGOING to STOPPED state, ONGOING state is not used at all
+    // and the operation is finished right after transmit request.
+    if (!result && m_tx_periodic)
+    {
+        // The beacon is skipped silently, like a periodic beacon whose timeslot was denied.
+        m_tx_periodic = false;
+        nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_DELAYED_TX);
+        periodic_tx_rearm();
+    }
+    else if (!result)
+    {
+        nrf_802154_notify_transmit_failed(mp_tx_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+    }
+#if NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+    else
+    {
+        setup_time_measure(&m_tx_setup_max, &m_tx_setup_samples);
+    }
+#endif
+}
+
+/**
+ * Receive request result callback.
+ *
+ * @param[in]  result  Result of RX request.
+ */
+static void dly_rx_result_notify(bool result)
+{
+    if (result)
+    {
+        uint32_t now;
+
+        bool state_set = dly_rx_state_set(DELAYED_TRX_OP_STATE_PENDING,
+                                          DELAYED_TRX_OP_STATE_ONGOING);
+
+        assert(state_set);
+        (void)state_set;
+
+#if NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+        setup_time_measure(&m_rx_setup_max, &m_rx_setup_samples);
+#endif
+
+        now = nrf_802154_timer_sched_time_get();
+
+        m_timeout_timer.t0           = now;
+        m_dly_rx_frame.sof_timestamp = now;
+        m_dly_rx_frame.psdu_length   = 0;
+        m_dly_rx_frame.ack_requested = false;
+
+        nrf_802154_timer_sched_add(&m_timeout_timer, true);
+    }
+    else
+    {
+        bool state_set = dly_rx_state_set(DELAYED_TRX_OP_STATE_PENDING,
+                                          DELAYED_TRX_OP_STATE_STOPPED);
+
+        assert(state_set);
+        (void)state_set;
+
+        dly_rx_window_ended(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+    }
+}
+
+/**
+ * Perform a delayed transmission whose timeslot has just started.
+ *
+ * @param[in]  p_op  Delayed operation.
+ */
+static void dly_tx_perform(const dly_op_t * p_op)
+{
+    mp_tx_data    = p_op->p_data;
+    m_tx_periodic = p_op->periodic;
+
+    if (p_op->periodic)
+    {
+        nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_DELAYED_TX);
+
+        if (!m_periodic_tx.first && m_periodic_tx.dsn_update &&
+            !nrf_802154_frame_parser_dsn_suppress_bit_is_set(m_periodic_tx.p_data))
+        {
+            m_periodic_tx.p_data[DSN_OFFSET]++;
+        }
+
+        m_periodic_tx.first = false;
+    }
+
+    nrf_802154_pib_channel_set(p_op->channel);
+
+    if (nrf_802154_request_channel_update())
+    {
+        (void)nrf_802154_request_transmit(NRF_802154_TERM_802154,
+                                          REQ_ORIG_DELAYED_TRX,
+                                          p_op->p_data,
+                                          p_op->cca,
+                                          true,
+                                          dly_tx_result_notify,
+                                          p_op->params ? &p_op->tx_params : NULL);
+    }
+    else
+    {
+        dly_tx_result_notify(false);
+    }
+}
+
+/**
+ * Open a delayed RX window whose timeslot has just started.
+ *
+ * @param[in]  p_op  Delayed operation.
+ */
+static void dly_rx_perform(const dly_op_t * p_op)
+{
+    // The window that is still open is closed by the new one.
+    if (dly_rx_state_set(DELAYED_TRX_OP_STATE_ONGOING, DELAYED_TRX_OP_STATE_STOPPED))
+    {
+        nrf_802154_timer_sched_remove(&m_timeout_timer, NULL);
+        dly_rx_window_ended(NRF_802154_RX_ERROR_DELAYED_ABORTED);
+    }
+
+    // remove timer in case it was left after abort operation
+    nrf_802154_timer_sched_remove(&m_timeout_timer, NULL);
+
+    m_timeout_timer.dt        = p_op->timeout + RX_RAMP_UP_TIME;
+    m_timeout_timer.callback  = notify_rx_timeout;
+    m_timeout_timer.p_context = NULL;
+    m_rx_start                = p_op->start;
+    m_rx_periodic             = p_op->periodic;
+
+    bool state_set = dly_rx_state_set(DELAYED_TRX_OP_STATE_STOPPED, DELAYED_TRX_OP_STATE_PENDING);
+
+    assert(state_set);
+    (void)state_set;
+
+    nrf_802154_pib_channel_set(p_op->channel);
+
+    if (nrf_802154_request_channel_update())
+    {
+        (void)nrf_802154_request_receive(NRF_802154_TERM_802154,
+                                         REQ_ORIG_DELAYED_TRX,
+                                         dly_rx_result_notify,
+                                         true);
+    }
+    else
+    {
+        dly_rx_result_notify(false);
+    }
+}
+
+/**
+ * Perform a delayed energy detection or CCA whose timeslot has just started.
+ *
+ * @param[in]  p_op  Delayed operation.
+ */
+static void dly_measure_perform(const dly_op_t * p_op)
+{
+    bool result = false;
+
+    nrf_802154_pib_channel_set(p_op->channel);
+
+    if (nrf_802154_request_channel_update())
+    {
+        if (p_op->measure == DLY_MEASURE_ED)
+        {
+            result = nrf_802154_request_energy_detection(NRF_802154_TERM_802154,
+                                                         p_op->timeout,
+                                                         0U);
+        }
+        else
+        {
+            result = nrf_802154_request_cca(NRF_802154_TERM_802154);
+        }
+    }
+
+    if (!result)
+    {
+        dly_op_failed_notify(p_op);
+    }
+}
+
+/**
+ * Start the requested delayed operation.
+ */
+static void dly_op_start(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    dly_op_t                        op;
+    bool                            valid;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    op                   = m_requested_op;
+    valid                = m_requested_op_valid;
+    m_requested_op_valid = false;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (valid)
     {
-        current_dly_rx_state =
-            (delayed_trx_op_state_t)__LDREXB((uint8_t *)&m_dly_op_state[RSCH_DLY_RX]);
+#if NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+        m_ts_start = op.t0 + op.dt;
+#endif
 
-        if (current_dly_rx_state != expected_dly_rx_state)
+        if (op.id == RSCH_DLY_TX)
         {
-            __CLREX();
-            return false;
+            dly_tx_perform(&op);
+        }
+        else if (op.measure != DLY_MEASURE_NONE)
+        {
+            dly_measure_perform(&op);
+        }
+        else
+        {
+            dly_rx_perform(&op);
         }
 
+        dly_op_request_next();
     }
-    while (__STREXB((uint8_t)new_dly_rx_state, (uint8_t *)&m_dly_op_state[RSCH_DLY_RX]));
-
-    __DMB();
-
-    return true;
 }
 
+#if NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US > 0
 /**
- * Get state of a delayed operation.
+ * Notify that the coex lead time of the requested operation has elapsed.
  *
- * @param[in]  dly_ts_id  Delayed timeslot ID.
- *
- * @retval     State of delayed operation.
+ * @param[in]  p_context  Not used.
  */
-static delayed_trx_op_state_t dly_op_state_get(rsch_dly_ts_id_t dly_ts_id)
+static void coex_lead_timer_fired(void * p_context)
 {
-    assert(dly_ts_id < RSCH_DLY_TS_NUM);
+    (void)p_context;
 
-    return m_dly_op_state[dly_ts_id];
+    dly_op_start();
 }
 
+#endif
+
 /**
- * Set state of a delayed operation.
+ * Notify that the previously requested delayed timeslot has started just now.
  *
- * @param[in]  dly_ts_id      Delayed timeslot ID.
- * @param[in]  expected_state Expected delayed operation state prior state transition.
- * @param[in]  new_state      Delayed operation state to enter.
+ * @param[in]  dly_ts_id  ID of the started timeslot.
  */
-static void dly_op_state_set(rsch_dly_ts_id_t       dly_ts_id,
-                             delayed_trx_op_state_t expected_state,
-                             delayed_trx_op_state_t new_state)
+static void timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
 {
-    assert(new_state < DELAYED_TRX_OP_STATE_NB);
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    switch (dly_ts_id)
-    {
-        case RSCH_DLY_TX:
-        {
-            assert(m_dly_op_state[RSCH_DLY_TX] == expected_state);
-            m_dly_op_state[RSCH_DLY_TX] = new_state;
-            break;
-        }
+    assert(!m_requested_op_valid || (dly_ts_id == m_requested_op.id));
+    (void)dly_ts_id;
 
-        case RSCH_DLY_RX:
-        {
-            bool result = dly_rx_state_set(expected_state, new_state);
+#if NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+    // RSCH holds the HFCLK for the timeslot from now on.
+    hfclk_prestart_cancel();
+#endif
 
-            assert(result);
-            (void)result;
-            break;
-        }
+#if NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US > 0
+    if (m_requested_op_valid && m_coex_lead_applied)
+    {
+        // The coex is requested now. Keep the operation requested until its start time.
+        m_coex_lead_timer.t0        = m_requested_op.t0;
+        m_coex_lead_timer.dt        = m_requested_op.dt;
+        m_coex_lead_timer.callback  = coex_lead_timer_fired;
+        m_coex_lead_timer.p_context = NULL;
 
-        default:
-        {
-            assert(false);
-            break;
-        }
+        nrf_802154_timer_sched_add(&m_coex_lead_timer, true);
     }
+    else
+#endif
+    {
+        dly_op_start();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
-/**
- * Start delayed operation.
- *
- * @param[in]  p_dly_ts_param  Parameters of the requested delayed timeslot.
- */
-static bool dly_op_request(const rsch_dly_ts_param_t * p_dly_ts_param)
+static bool dly_op_timeslot_request(const dly_op_t * p_op)
 {
-    // Set PENDING state before timeslot request, in case timeslot starts
-    // immediately and interrupts current function execution.
-    dly_op_state_set(p_dly_ts_param->id, DELAYED_TRX_OP_STATE_STOPPED,
-                     DELAYED_TRX_OP_STATE_PENDING);
+    uint32_t dt = p_op->dt;
 
-    bool result = nrf_802154_rsch_delayed_timeslot_request(p_dly_ts_param);
+#if NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US > 0
+    m_coex_lead_applied = nrf_802154_wifi_coex_is_enabled() &&
+                          nrf_802154_timer_sched_time_is_in_future(
+        nrf_802154_timer_sched_time_get(),
+        p_op->t0,
+        dt - NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US);
 
-    if (!result)
+    if (m_coex_lead_applied)
     {
-        dly_op_state_set(p_dly_ts_param->id,
-                         DELAYED_TRX_OP_STATE_PENDING,
-                         DELAYED_TRX_OP_STATE_STOPPED);
+        dt -= NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US;
     }
+#endif
 
-    return result;
+    rsch_dly_ts_param_t dly_ts_param =
+    {
+        .t0               = p_op->t0,
+        .dt               = dt,
+        .prio             = (p_op->id == RSCH_DLY_TX) ? RSCH_PRIO_TX : RSCH_PRIO_IDLE_LISTENING,
+        .id               = p_op->id,
+        .type             = RSCH_DLY_TS_TYPE_PRECISE,
+        .started_callback = timeslot_started_callback,
+    };
+
+#if NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+    // Schedule the pre-start first, as the timeslot may start as soon as it is requested.
+    hfclk_prestart_schedule(p_op->t0, dt);
+
+    if (!nrf_802154_rsch_delayed_timeslot_request(&dly_ts_param))
+    {
+        hfclk_prestart_cancel();
+
+        return false;
+    }
+
+    return true;
+#else
+    return nrf_802154_rsch_delayed_timeslot_request(&dly_ts_param);
+#endif
 }
 
-/**
- * Notify MAC layer that no frame was received before timeout.
- *
- * @param[in]  p_context  Not used.
- */
-static void notify_rx_timeout(void * p_context)
+/** Match scheduled transmissions, except the periodic beacons. */
+static bool dly_tx_match(const dly_op_t * p_op, const void * p_context)
 {
     (void)p_context;
 
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    return (p_op->id == RSCH_DLY_TX) && !p_op->periodic;
+}
 
-    assert(dly_op_state_get(RSCH_DLY_RX) != DELAYED_TRX_OP_STATE_PENDING);
+/** Match scheduled periodic beacons. */
+static bool dly_periodic_tx_match(const dly_op_t * p_op, const void * p_context)
+{
+    (void)p_context;
 
-    if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
-    {
-        uint32_t now           = nrf_802154_timer_sched_time_get();
-        uint32_t sof_timestamp = m_dly_rx_frame.sof_timestamp;
+    return (p_op->id == RSCH_DLY_TX) && p_op->periodic;
+}
 
-        // Make sure that the timestamp has been latched safely. If frame reception preempts the code
-        // after executing this line, the RX window will not be extended.
-        __DMB();
-        uint8_t  psdu_length   = m_dly_rx_frame.psdu_length;
-        bool     ack_requested = m_dly_rx_frame.ack_requested;
-        uint32_t frame_length  = nrf_802154_rx_duration_get(psdu_length, ack_requested);
+/** Match scheduled transmission of the frame pointed by @p p_context. */
+static bool dly_tx_frame_match(const dly_op_t * p_op, const void * p_context)
+{
+    return (p_op->id == RSCH_DLY_TX) && (p_op->p_data == (const uint8_t *)p_context);
+}
 
-        if (nrf_802154_timer_sched_time_is_in_future(now, sof_timestamp, frame_length))
-        {
-            // @TODO protect against infinite extensions - allow only one timer extension
-            m_timeout_timer.t0 = sof_timestamp;
-            m_timeout_timer.dt = frame_length;
+/** Match scheduled receive windows, except the periodic ones. */
+static bool dly_rx_match(const dly_op_t * p_op, const void * p_context)
+{
+    (void)p_context;
 
-            nrf_802154_timer_sched_add(&m_timeout_timer, true);
-        }
-        else
-        {
-            if (dly_rx_state_set(DELAYED_TRX_OP_STATE_ONGOING, DELAYED_TRX_OP_STATE_STOPPED))
-            {
-                nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
-            }
+    return (p_op->id == RSCH_DLY_RX) && (p_op->measure == DLY_MEASURE_NONE) && !p_op->periodic;
+}
 
-            // even if the set operation failed, the delayed RX state
-            // should be set to STOPPED from other context anyway
-            assert(dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED);
-        }
-    }
+/** Match scheduled receive window starting at the time pointed by @p p_context. */
+static bool dly_rx_window_match(const dly_op_t * p_op, const void * p_context)
+{
+    return dly_rx_match(p_op, NULL) && (p_op->start == *(const uint32_t *)p_context);
+}
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+/** Match scheduled periodic receive windows. */
+static bool dly_periodic_rx_match(const dly_op_t * p_op, const void * p_context)
+{
+    (void)p_context;
+
+    return (p_op->id == RSCH_DLY_RX) && (p_op->measure == DLY_MEASURE_NONE) && p_op->periodic;
+}
+
+/** Match scheduled energy detections and CCAs. */
+static bool dly_measure_match(const dly_op_t * p_op, const void * p_context)
+{
+    (void)p_context;
+
+    return (p_op->id == RSCH_DLY_RX) && (p_op->measure != DLY_MEASURE_NONE);
 }
 
 /**
- * Transmit request result callback.
+ * Stop the ongoing RX window without notifying the timeout.
  *
- * @param[in]  result  Result of TX request.
+ * @retval true   The RX window was ongoing or its timeout timer was running.
+ * @retval false  No RX window was ongoing.
  */
-static void dly_tx_result_notify(bool result)
+static bool dly_rx_window_stop(void)
 {
-    (void)result;
+    bool was_running;
 
-    // To avoid attaching to every possible transmit hook, in order to be able
-    // to switch from ONGOING to STOPPED state, ONGOING state is not used at all
-    // and state is changed to STOPPED right after transmit request.
-    m_dly_op_state[RSCH_DLY_TX] = DELAYED_TRX_OP_STATE_STOPPED;
+    nrf_802154_timer_sched_remove(&m_timeout_timer, &was_running);
 
-    if (!result)
-    {
-        nrf_802154_notify_transmit_failed(mp_tx_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
-    }
+    bool result = dly_rx_state_set(DELAYED_TRX_OP_STATE_ONGOING, DELAYED_TRX_OP_STATE_STOPPED);
+
+    return result || was_running;
 }
 
 /**
- * Receive request result callback.
+ * Schedule a delayed transmission.
  *
- * @param[in]  result  Result of RX request.
+ * @param[inout]  p_op  Delayed transmission with the requested frame start time. The time is
+ *                      moved earlier by the time needed to start the transmission.
+ *
+ * @retval true   The transmission was scheduled.
+ * @retval false  The schedule is full or the requested time is in the past.
  */
-static void dly_rx_result_notify(bool result)
+static bool dly_tx_schedule(dly_op_t * p_op)
 {
-    if (result)
-    {
-        uint32_t now;
+    p_op->dt -= tx_setup_time_get();
+    p_op->dt -= TX_RAMP_UP_TIME;
 
-        dly_op_state_set(RSCH_DLY_RX, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_ONGOING);
+    if (p_op->cca)
+    {
+        p_op->dt -= nrf_802154_cca_before_tx_duration_get();
+    }
 
-        now = nrf_802154_timer_sched_time_get();
+    return dly_op_schedule(p_op);
+}
 
-        m_timeout_timer.t0           = now;
-        m_dly_rx_frame.sof_timestamp = now;
-        m_dly_rx_frame.psdu_length   = 0;
-        m_dly_rx_frame.ack_requested = false;
+bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
+                                     bool            cca,
+                                     uint32_t        t0,
+                                     uint32_t        dt,
+                                     uint8_t         channel)
+{
+    dly_op_t op =
+    {
+        .id       = RSCH_DLY_TX,
+        .t0       = t0,
+        .dt       = dt,
+        .start    = t0 + dt,
+        .p_data   = p_data,
+        .timeout  = 0,
+        .channel  = channel,
+        .cca      = cca,
+        .periodic = false,
+        .params   = false,
+    };
+
+    return dly_tx_schedule(&op);
+}
 
-        nrf_802154_timer_sched_add(&m_timeout_timer, true);
-    }
-    else
+bool nrf_802154_delayed_trx_transmit_ex(const uint8_t                * p_data,
+                                        uint32_t                       t0,
+                                        uint32_t                       dt,
+                                        const nrf_802154_tx_params_t * p_params)
+{
+    dly_op_t op =
     {
-        dly_op_state_set(RSCH_DLY_RX, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_STOPPED);
+        .id        = RSCH_DLY_TX,
+        .t0        = t0,
+        .dt        = dt,
+        .start     = t0 + dt,
+        .p_data    = p_data,
+        .timeout   = 0,
+        .channel   = ((p_params->flags & NRF_802154_TX_PARAM_CHANNEL) != 0U) ?
+                     p_params->channel : nrf_802154_pib_channel_get(),
+        .cca       = p_params->cca,
+        .periodic  = false,
+        .params    = true,
+        .tx_params = *p_params,
+    };
+
+    return dly_tx_schedule(&op);
+}
 
-        nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
-    }
+bool nrf_802154_delayed_trx_receive(uint32_t t0,
+                                    uint32_t dt,
+                                    uint32_t timeout,
+                                    uint8_t  channel)
+{
+    dly_op_t op =
+    {
+        .id       = RSCH_DLY_RX,
+        .t0       = t0,
+        .dt       = dt,
+        .start    = t0 + dt,
+        .p_data   = NULL,
+        .timeout  = timeout,
+        .channel  = channel,
+        .cca      = false,
+        .periodic = false,
+        .params   = false,
+    };
+
+    op.dt -= rx_setup_time_get();
+    op.dt -= RX_RAMP_UP_TIME;
+
+    return dly_op_schedule(&op);
 }
 
 /**
- * Notify that the previously requested delayed TX timeslot has started just now.
+ * Schedule an energy detection or a CCA at the given time.
  *
- * @param[in]  dly_ts_id  ID of the started timeslot.
+ * @param[in]  p_op  Delayed operation with the start time not including the setup time.
+ *
+ * @retval true   The operation was scheduled.
+ * @retval false  The schedule is full or the requested time is in the past.
  */
-static void tx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
+static bool dly_measure_schedule(dly_op_t * p_op)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+    p_op->dt -= rx_setup_time_get();
+    p_op->dt -= RX_RAMP_UP_TIME;
 
-    assert(dly_ts_id == RSCH_DLY_TX);
+    return dly_op_schedule(p_op);
+}
 
-    switch (dly_op_state_get(dly_ts_id))
+bool nrf_802154_delayed_trx_energy_detection(uint32_t t0,
+                                             uint32_t dt,
+                                             uint32_t time_us,
+                                             uint8_t  channel)
+{
+    dly_op_t op =
     {
-        case DELAYED_TRX_OP_STATE_PENDING:
-        {
-            nrf_802154_pib_channel_set(m_tx_channel);
-
-            if (nrf_802154_request_channel_update())
-            {
-                (void)nrf_802154_request_transmit(NRF_802154_TERM_802154,
-                                                  REQ_ORIG_DELAYED_TRX,
-                                                  mp_tx_data,
-                                                  m_tx_cca,
-                                                  true,
-                                                  dly_tx_result_notify);
-            }
-            else
-            {
-                dly_tx_result_notify(false);
-            }
-
-            break;
-        }
+        .id       = RSCH_DLY_RX,
+        .t0       = t0,
+        .dt       = dt,
+        .start    = t0 + dt,
+        .p_data   = NULL,
+        .timeout  = time_us,
+        .channel  = channel,
+        .cca      = false,
+        .periodic = false,
+        .params   = false,
+        .measure  = DLY_MEASURE_ED,
+    };
+
+    return dly_measure_schedule(&op);
+}
 
-        case DELAYED_TRX_OP_STATE_STOPPED:
-            break;
+bool nrf_802154_delayed_trx_cca(uint32_t t0, uint32_t dt, uint8_t channel)
+{
+    dly_op_t op =
+    {
+        .id       = RSCH_DLY_RX,
+        .t0       = t0,
+        .dt       = dt,
+        .start    = t0 + dt,
+        .p_data   = NULL,
+        .timeout  = 0,
+        .channel  = channel,
+        .cca      = false,
+        .periodic = false,
+        .params   = false,
+        .measure  = DLY_MEASURE_CCA,
+    };
+
+    return dly_measure_schedule(&op);
+}
 
-        default:
-            assert(false);
-            break;
-    }
+bool nrf_802154_delayed_trx_measure_cancel(void)
+{
+    return dly_op_cancel(dly_measure_match, NULL);
+}
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+bool nrf_802154_delayed_trx_transmit_cancel(void)
+{
+    return dly_op_cancel(dly_tx_match, NULL);
 }
 
-/**
- * Notify that the previously requested delayed RX timeslot has started just now.
- *
- * @param[in]  dly_ts_id  ID of the started timeslot.
- */
-static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
+bool nrf_802154_delayed_trx_transmit_frame_cancel(const uint8_t * p_data)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+    return dly_op_cancel(dly_tx_frame_match, p_data);
+}
 
-    assert(dly_ts_id == RSCH_DLY_RX);
+bool nrf_802154_delayed_trx_receive_cancel(void)
+{
+    bool result = dly_op_cancel(dly_rx_match, NULL);
 
-    switch (dly_op_state_get(dly_ts_id))
+    if (!m_rx_periodic)
     {
-        case DELAYED_TRX_OP_STATE_PENDING:
-        {
-            nrf_802154_pib_channel_set(m_rx_channel);
-
-            if (nrf_802154_request_channel_update())
-            {
-                (void)nrf_802154_request_receive(NRF_802154_TERM_802154,
-                                                 REQ_ORIG_DELAYED_TRX,
-                                                 dly_rx_result_notify,
-                                                 true);
-            }
-            else
-            {
-                dly_rx_result_notify(false);
-            }
+        result = dly_rx_window_stop() || result;
+    }
 
-            break;
-        }
+    return result;
+}
 
-        case DELAYED_TRX_OP_STATE_STOPPED:
-            break;
+bool nrf_802154_delayed_trx_receive_window_cancel(uint32_t t0, uint32_t dt)
+{
+    uint32_t start  = t0 + dt;
+    bool     result = dly_op_cancel(dly_rx_window_match, &start);
 
-        default:
-            assert(false);
-            break;
+    if ((dly_rx_state_get() != DELAYED_TRX_OP_STATE_STOPPED) && !m_rx_periodic &&
+        (m_rx_start == start))
+    {
+        result = dly_rx_window_stop() || result;
     }
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+    return result;
 }
 
-bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
-                                     bool            cca,
-                                     uint32_t        t0,
-                                     uint32_t        dt,
-                                     uint8_t         channel)
+bool nrf_802154_delayed_trx_receive_periodic(uint32_t period,
+                                             uint32_t window,
+                                             uint32_t phase,
+                                             uint8_t  channel)
 {
-    bool result = dly_op_state_get(RSCH_DLY_TX) == DELAYED_TRX_OP_STATE_STOPPED;
-
-    if (result)
+    if (m_periodic_rx_active || (window >= period))
     {
-        dt -= TX_SETUP_TIME;
-        dt -= TX_RAMP_UP_TIME;
+        return false;
+    }
 
-        if (cca)
-        {
-            dt -= nrf_802154_cca_before_tx_duration_get();
-        }
+    m_periodic_rx.period     = period;
+    m_periodic_rx.window     = window;
+    m_periodic_rx.next_start = phase;
+    m_periodic_rx.channel    = channel;
+    m_periodic_rx_active     = true;
 
-        mp_tx_data   = p_data;
-        m_tx_cca     = cca;
-        m_tx_channel = channel;
+    periodic_rx_rearm();
 
-        rsch_dly_ts_param_t dly_ts_param =
-        {
-            .t0               = t0,
-            .dt               = dt,
-            .prio             = RSCH_PRIO_TX,
-            .id               = RSCH_DLY_TX,
-            .type             = RSCH_DLY_TS_TYPE_PRECISE,
-            .started_callback = tx_timeslot_started_callback,
-        };
+    return m_periodic_rx_active;
+}
+
+bool nrf_802154_delayed_trx_receive_periodic_stop(void)
+{
+    bool result = m_periodic_rx_active;
+
+    m_periodic_rx_active = false;
 
-        result = dly_op_request(&dly_ts_param);
+    (void)dly_op_cancel(dly_periodic_rx_match, NULL);
+
+    if (m_rx_periodic)
+    {
+        (void)dly_rx_window_stop();
     }
 
     return result;
 }
 
-bool nrf_802154_delayed_trx_receive(uint32_t t0,
-                                    uint32_t dt,
-                                    uint32_t timeout,
-                                    uint8_t  channel)
+bool nrf_802154_delayed_trx_beacon_periodic_start(uint8_t                      * p_data,
+                                                  uint32_t                       period,
+                                                  uint32_t                       t0,
+                                                  bool                           dsn_update,
+                                                  const nrf_802154_tx_params_t * p_params)
 {
-    bool result = dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED;
+    uint32_t frame_time = TX_RAMP_UP_TIME + nrf_802154_frame_duration_get(p_data[PHR_OFFSET],
+                                                                          true,
+                                                                          true);
 
-    if (result)
+    if (m_periodic_tx_active || (period <= frame_time))
     {
-        dt -= RX_SETUP_TIME;
-        dt -= RX_RAMP_UP_TIME;
-
-        m_timeout_timer.dt        = timeout + RX_RAMP_UP_TIME;
-        m_timeout_timer.callback  = notify_rx_timeout;
-        m_timeout_timer.p_context = NULL;
+        return false;
+    }
 
-        m_rx_channel = channel;
+    m_periodic_tx.p_data     = p_data;
+    m_periodic_tx.period     = period;
+    m_periodic_tx.next_start = t0;
+    m_periodic_tx.dsn_update = dsn_update;
+    m_periodic_tx.first      = true;
+    m_periodic_tx.params     = (p_params != NULL);
+    m_periodic_tx.channel    = nrf_802154_pib_channel_get();
 
-        // remove timer in case it was left after abort operation
-        nrf_802154_timer_sched_remove(&m_timeout_timer, NULL);
+    if (p_params != NULL)
+    {
+        m_periodic_tx.tx_params = *p_params;
 
-        rsch_dly_ts_param_t dly_ts_param =
+        if ((p_params->flags & NRF_802154_TX_PARAM_CHANNEL) != 0U)
         {
-            .t0               = t0,
-            .dt               = dt,
-            .prio             = RSCH_PRIO_IDLE_LISTENING,
-            .id               = RSCH_DLY_RX,
-            .type             = RSCH_DLY_TS_TYPE_PRECISE,
-            .started_callback = rx_timeslot_started_callback,
-        };
-
-        result = dly_op_request(&dly_ts_param);
+            m_periodic_tx.channel = p_params->channel;
+        }
     }
 
-    return result;
+    m_periodic_tx_active = true;
+
+    periodic_tx_rearm();
+
+    return m_periodic_tx_active;
 }
 
-bool nrf_802154_delayed_trx_transmit_cancel(void)
+bool nrf_802154_delayed_trx_beacon_periodic_stop(void)
 {
-    bool result = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_TX);
+    bool result = m_periodic_tx_active;
+
+    m_periodic_tx_active = false;
 
-    m_dly_op_state[RSCH_DLY_TX] = DELAYED_TRX_OP_STATE_STOPPED;
+    (void)dly_op_cancel(dly_periodic_tx_match, NULL);
 
     return result;
 }
 
-bool nrf_802154_delayed_trx_receive_cancel(void)
+void nrf_802154_delayed_trx_setup_times_get(uint32_t * p_tx_setup_time,
+                                            uint32_t * p_rx_setup_time)
 {
-    bool result = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_RX);
-    bool was_running;
+    *p_tx_setup_time = tx_setup_time_get();
+    *p_rx_setup_time = rx_setup_time_get();
+}
 
-    nrf_802154_timer_sched_remove(&m_timeout_timer, &was_running);
+bool nrf_802154_delayed_trx_nearest_op_time_get(uint32_t * p_time)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = true;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
 
-    m_dly_op_state[RSCH_DLY_RX] = DELAYED_TRX_OP_STATE_STOPPED;
+    // The requested operation is always the earliest one.
+    if (m_requested_op_valid)
+    {
+        *p_time = m_requested_op.t0 + m_requested_op.dt;
+    }
+    else if (m_schedule_count > 0)
+    {
+        *p_time = m_schedule[0].t0 + m_schedule[0].dt;
+    }
+    else
+    {
+        result = false;
+    }
 
-    result = result || was_running;
+    nrf_802154_mcu_critical_exit(mcu_cs);
 
     return result;
 }
@@ -510,18 +1670,18 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
     {
         // Ignore if self-request.
     }
-    else if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
+    else if (dly_rx_state_get() == DELAYED_TRX_OP_STATE_ONGOING)
     {
         if (term_lvl >= NRF_802154_TERM_802154)
         {
             if (dly_rx_state_set(DELAYED_TRX_OP_STATE_ONGOING, DELAYED_TRX_OP_STATE_STOPPED))
             {
-                nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_ABORTED);
+                dly_rx_window_ended(NRF_802154_RX_ERROR_DELAYED_ABORTED);
             }
 
             // even if the set operation failed, the delayed RX state
             // should be set to STOPPED from other context anyway
-            assert(dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED);
+            assert(dly_rx_state_get() == DELAYED_TRX_OP_STATE_STOPPED);
         }
         else
         {
@@ -534,7 +1694,7 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
 
 void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame)
 {
-    if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
+    if (dly_rx_state_get() == DELAYED_TRX_OP_STATE_ONGOING)
     {
         m_dly_rx_frame.sof_timestamp = nrf_802154_timer_sched_time_get();
         m_dly_rx_frame.psdu_length   = p_frame[PHR_OFFSET];
@@ -542,4 +1702,23 @@ void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame)
     }
 }
 
+void nrf_802154_delayed_trx_transmitted_hook(const uint8_t * p_frame)
+{
+    if (m_tx_periodic && (p_frame == m_periodic_tx.p_data))
+    {
+        m_tx_periodic = false;
+        nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_DELAYED_TX);
+        periodic_tx_rearm();
+    }
+}
+
+bool nrf_802154_delayed_trx_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)error;
+
+    nrf_802154_delayed_trx_transmitted_hook(p_frame);
+
+    return true;
+}
+
 #endif // NRF_802154_DELAYED_TRX_ENABLED
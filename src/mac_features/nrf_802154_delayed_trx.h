@@ -47,7 +47,8 @@
  * @brief Delayed transmission or receive window.
  *
  * This module implements delayed transmission and receive window features used in the CSL and TSCH
- * modes.
+ * modes. Up to @ref NRF_802154_DELAYED_TRX_SCHEDULE_SIZE operations can be scheduled at the same
+ * time. They are performed in the order of their start time.
  */
 
 /**
@@ -66,6 +67,9 @@
  * @param[in]  t0       Base of delay time in microseconds.
  * @param[in]  dt       Delta of the delay time from @p t0 in microseconds.
  * @param[in]  channel  Number of the channel on which the frame is to be transmitted.
+ *
+ * @retval true   The transmission was scheduled.
+ * @retval false  The schedule is full or the requested time is in the past.
  */
 bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
                                      bool            cca,
@@ -74,7 +78,28 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
                                      uint8_t         channel);
 
 /**
- * @brief Cancels a transmission scheduled by a call to @ref nrf_802154_delayed_trx_transmit.
+ * @brief Requests transmission of a frame with the given transmit parameters at a given time.
+ *
+ * This function works as @ref nrf_802154_delayed_trx_transmit, but the CCA and the channel are
+ * taken from @p p_params. If @p p_params does not select a channel, the frame is transmitted on
+ * the current PIB channel. The parameters are applied to the frame as by
+ * @ref nrf_802154_request_transmit.
+ *
+ * @param[in]  p_data    Pointer to a buffer containing PHR and PSDU of the frame to be transmitted.
+ * @param[in]  t0        Base of delay time in microseconds.
+ * @param[in]  dt        Delta of the delay time from @p t0 in microseconds.
+ * @param[in]  p_params  Pointer to the transmit parameters. The structure is copied.
+ *
+ * @retval true   The transmission was scheduled.
+ * @retval false  The schedule is full or the requested time is in the past.
+ */
+bool nrf_802154_delayed_trx_transmit_ex(const uint8_t                * p_data,
+                                        uint32_t                       t0,
+                                        uint32_t                       dt,
+                                        const nrf_802154_tx_params_t * p_params);
+
+/**
+ * @brief Cancels all transmissions scheduled by calls to @ref nrf_802154_delayed_trx_transmit.
  *
  * This function does not cancel transmission if the transmission is already ongoing.
  *
@@ -83,6 +108,18 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
  */
 bool nrf_802154_delayed_trx_transmit_cancel(void);
 
+/**
+ * @brief Cancels scheduled transmissions of the given frame.
+ *
+ * This function does not cancel transmission if the transmission is already ongoing.
+ *
+ * @param[in]  p_data  Pointer to the buffer passed to @ref nrf_802154_delayed_trx_transmit.
+ *
+ * @retval true     Successfully cancelled a scheduled transmission.
+ * @retval false    No delayed transmission of the frame was scheduled.
+ */
+bool nrf_802154_delayed_trx_transmit_frame_cancel(const uint8_t * p_data);
+
 /**
  *@}
  **/
@@ -99,6 +136,9 @@ bool nrf_802154_delayed_trx_transmit_cancel(void);
  * @param[in]  dt       Delta of delay time from @p t0 in microseconds.
  * @param[in]  timeout  Reception timeout (counted from @p t0 + @p dt) in microseconds.
  * @param[in]  channel  Number of the channel on which the frame is to be received.
+ *
+ * @retval true   The reception was scheduled.
+ * @retval false  The schedule is full or the requested time is in the past.
  */
 bool nrf_802154_delayed_trx_receive(uint32_t t0,
                                     uint32_t dt,
@@ -106,15 +146,164 @@ bool nrf_802154_delayed_trx_receive(uint32_t t0,
                                     uint8_t  channel);
 
 /**
- * @brief Cancels a reception scheduled by a call to @ref nrf_802154_delayed_trx_receive.
+ * @brief Requests the energy detection at a given time.
+ *
+ * The result is notified by @ref nrf_802154_energy_detected. If the timeslot is denied or
+ * the procedure cannot be started, @ref nrf_802154_energy_detection_failed is called.
+ *
+ * @param[in]  t0       Base of delay time in microseconds.
+ * @param[in]  dt       Delta of delay time from @p t0 in microseconds.
+ * @param[in]  time_us  Duration of the energy detection in microseconds.
+ * @param[in]  channel  Number of the channel on which the energy is to be detected.
+ *
+ * @retval true   The energy detection was scheduled.
+ * @retval false  The schedule is full or the requested time is in the past.
+ */
+bool nrf_802154_delayed_trx_energy_detection(uint32_t t0,
+                                             uint32_t dt,
+                                             uint32_t time_us,
+                                             uint8_t  channel);
+
+/**
+ * @brief Requests the CCA procedure at a given time.
  *
- * After a call to this function, no reception timeout event will be notified.
+ * The result is notified by @ref nrf_802154_cca_done. If the timeslot is denied or
+ * the procedure cannot be started, @ref nrf_802154_cca_failed is called.
+ *
+ * @param[in]  t0       Base of delay time in microseconds.
+ * @param[in]  dt       Delta of delay time from @p t0 in microseconds.
+ * @param[in]  channel  Number of the channel on which the CCA is to be performed.
+ *
+ * @retval true   The CCA was scheduled.
+ * @retval false  The schedule is full or the requested time is in the past.
+ */
+bool nrf_802154_delayed_trx_cca(uint32_t t0, uint32_t dt, uint8_t channel);
+
+/**
+ * @brief Cancels all scheduled energy detections and CCA procedures.
+ *
+ * @retval true   At least one scheduled procedure was cancelled.
+ * @retval false  No procedure was scheduled.
+ */
+bool nrf_802154_delayed_trx_measure_cancel(void);
+
+/**
+ * @brief Cancels all receptions scheduled by calls to @ref nrf_802154_delayed_trx_receive.
+ *
+ * After a call to this function, no reception timeout event will be notified. The periodic
+ * receive windows are not affected.
  *
  * @retval true     Successfully cancelled a scheduled transmission.
  * @retval false    No delayed reception was scheduled.
  */
 bool nrf_802154_delayed_trx_receive_cancel(void);
 
+/**
+ * @brief Cancels the reception window starting at the given time.
+ *
+ * The window is identified by the time passed to @ref nrf_802154_delayed_trx_receive.
+ * If the window has already started, no reception timeout event will be notified for it.
+ *
+ * @param[in]  t0  Base of delay time in microseconds.
+ * @param[in]  dt  Delta of delay time from @p t0 in microseconds.
+ *
+ * @retval true     Successfully cancelled the reception window.
+ * @retval false    No reception window starting at the given time was scheduled.
+ */
+bool nrf_802154_delayed_trx_receive_window_cancel(uint32_t t0, uint32_t dt);
+
+/**
+ * @brief Starts periodic reception windows.
+ *
+ * The receive windows start at @p phase + k * @p period and last @p window each. The next window
+ * is scheduled when the previous one ends, without involving the MAC layer. Frames received
+ * during the windows are notified as usual. The end of a window is not notified.
+ *
+ * @param[in]  period   Time between the starts of consecutive windows in microseconds.
+ * @param[in]  window   Duration of each window in microseconds. It must be shorter than
+ *                      @p period.
+ * @param[in]  phase    Start time of one of the windows, in the time base of the Timer Scheduler.
+ * @param[in]  channel  Number of the channel on which the frames are to be received.
+ *
+ * @retval true   The periodic reception was started.
+ * @retval false  The periodic reception is already running, the parameters are invalid, or
+ *                the first window cannot be scheduled.
+ */
+bool nrf_802154_delayed_trx_receive_periodic(uint32_t period,
+                                             uint32_t window,
+                                             uint32_t phase,
+                                             uint8_t  channel);
+
+/**
+ * @brief Stops periodic reception windows started by @ref nrf_802154_delayed_trx_receive_periodic.
+ *
+ * If a window is open, the radio remains in the receive state, but no further window is scheduled.
+ *
+ * @retval true   The periodic reception was stopped.
+ * @retval false  The periodic reception was not running.
+ */
+bool nrf_802154_delayed_trx_receive_periodic_stop(void);
+
+/**
+ * @brief Starts periodic transmission of a beacon.
+ *
+ * The beacons start at @p t0 + k * @p period. The next beacon is scheduled when the transmission
+ * of the previous one ends, without involving the MAC layer. The same buffer is transmitted every
+ * period. Beacons that cannot be transmitted in time are skipped.
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the beacon. The buffer
+ *                         is modified in place if @p dsn_update is set or @p p_params requests
+ *                         a timestamp.
+ * @param[in]  period      Time between the starts of consecutive beacons in microseconds.
+ * @param[in]  t0          Start time of the first beacon, in the time base of the Timer Scheduler.
+ * @param[in]  dsn_update  If the sequence number of the beacon is to be incremented before every
+ *                         beacon except the first one.
+ * @param[in]  p_params    Pointer to the transmit parameters of the beacon, or NULL to use
+ *                         the PIB configuration.
+ *
+ * @retval true   The periodic transmission was started.
+ * @retval false  The periodic transmission is already running, the period is too short, or
+ *                the first beacon cannot be scheduled.
+ */
+bool nrf_802154_delayed_trx_beacon_periodic_start(uint8_t                      * p_data,
+                                                  uint32_t                       period,
+                                                  uint32_t                       t0,
+                                                  bool                           dsn_update,
+                                                  const nrf_802154_tx_params_t * p_params);
+
+/**
+ * @brief Stops periodic beacon transmission started by
+ *        @ref nrf_802154_delayed_trx_beacon_periodic_start.
+ *
+ * A beacon that is already being transmitted is not aborted.
+ *
+ * @retval true   The periodic transmission was stopped.
+ * @retval false  The periodic transmission was not running.
+ */
+bool nrf_802154_delayed_trx_beacon_periodic_stop(void);
+
+/**
+ * @brief Gets the setup times used to schedule delayed operations.
+ *
+ * The setup times do not include the radio ramp-up and CCA durations. If
+ * @ref NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED is set, they are the calibrated values.
+ *
+ * @param[out]  p_tx_setup_time  Setup time of delayed transmissions in microseconds.
+ * @param[out]  p_rx_setup_time  Setup time of delayed receptions in microseconds.
+ */
+void nrf_802154_delayed_trx_setup_times_get(uint32_t * p_tx_setup_time,
+                                            uint32_t * p_rx_setup_time);
+
+/**
+ * @brief Gets the start time of the timeslot of the earliest scheduled delayed operation.
+ *
+ * @param[out]  p_time  Start time of the timeslot in microseconds.
+ *
+ * @retval  true   @p p_time is set.
+ * @retval  false  No delayed operation is scheduled.
+ */
+bool nrf_802154_delayed_trx_nearest_op_time_get(uint32_t * p_time);
+
 /**
  * @brief Aborts an ongoing delayed reception procedure.
  *
@@ -143,6 +332,23 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
  */
 void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame);
 
+/**
+ * @brief Schedules the next periodic beacon when the transmission of a beacon ends.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ */
+void nrf_802154_delayed_trx_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Schedules the next periodic beacon when the transmission of a beacon fails.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame that failed.
+ * @param[in]  error    Cause of the failure.
+ *
+ * @retval  true  The failure is always propagated to the MAC layer.
+ */
+bool nrf_802154_delayed_trx_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
 /**
  *@}
  **/
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the filter of duplicated frames received by the 802.15.4 driver.
+ *
+ * A frame is retransmitted by its sender if the ACK to it is lost. The filter keeps the sequence
+ * number and the frame counter of the last frame received from a few recent peers, so that
+ * retransmitted frames can be acknowledged without being passed to the higher layer again.
+ *
+ */
+
+#include "nrf_802154_duplicate_filter.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_DUPLICATE_FILTER_ENABLED
+
+#if NRF_802154_DUPLICATE_FILTER_SIZE < 1
+#error NRF_802154_DUPLICATE_FILTER_SIZE must be at least 1.
+#endif
+
+/// Last frame received from a peer.
+typedef struct
+{
+    uint8_t  src_addr[EXTENDED_ADDRESS_SIZE]; ///< Source address of the peer.
+    uint8_t  src_addr_size;                   ///< Size of the source address, 0 if entry is empty.
+    uint8_t  dsn;                             ///< Sequence number of the last frame.
+    bool     frame_counter_present;           ///< If the last frame contained the frame counter.
+    uint32_t frame_counter;                   ///< Frame counter of the last frame.
+} duplicate_filter_entry_t;
+
+static duplicate_filter_entry_t m_entries[NRF_802154_DUPLICATE_FILTER_SIZE]; ///< Recent peers.
+static uint32_t                 m_next_entry;                                ///< Entry to be replaced next.
+
+/**
+ * @brief Get the frame counter of a received frame.
+ *
+ * @param[in]  p_mhr_data       Parsed MHR of the frame.
+ * @param[out] p_frame_counter  Frame counter of the frame.
+ *
+ * @retval  true   The frame contains the frame counter.
+ * @retval  false  The frame is not secured or its frame counter is suppressed.
+ */
+static bool frame_counter_get(const nrf_802154_frame_parser_mhr_data_t * p_mhr_data,
+                              uint32_t                                 * p_frame_counter)
+{
+    const uint8_t * p_sec_ctrl = p_mhr_data->p_sec_ctrl;
+
+    if ((p_sec_ctrl == NULL) || (*p_sec_ctrl & FRAME_COUNTER_SUPPRESS_BIT))
+    {
+        return false;
+    }
+
+    const uint8_t * p_fc = p_sec_ctrl + SECURITY_CONTROL_SIZE;
+
+    *p_frame_counter = (uint32_t)p_fc[0] | ((uint32_t)p_fc[1] << 8) |
+                       ((uint32_t)p_fc[2] << 16) | ((uint32_t)p_fc[3] << 24);
+
+    return true;
+}
+
+/**
+ * @brief Find the entry of the peer that sent a frame.
+ *
+ * @param[in]  p_src_addr     Pointer to the source address of the frame.
+ * @param[in]  src_addr_size  Size of the source address.
+ *
+ * @returns  Pointer to the entry of the peer, or NULL if the peer is not in the filter.
+ */
+static duplicate_filter_entry_t * entry_find(const uint8_t * p_src_addr, uint8_t src_addr_size)
+{
+    for (uint32_t i = 0; i < NRF_802154_DUPLICATE_FILTER_SIZE; i++)
+    {
+        duplicate_filter_entry_t * p_entry = &m_entries[i];
+
+        if ((p_entry->src_addr_size == src_addr_size) &&
+            (0 == memcmp(p_entry->src_addr, p_src_addr, src_addr_size)))
+        {
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+void nrf_802154_duplicate_filter_init(void)
+{
+    memset(m_entries, 0, sizeof(m_entries));
+    m_next_entry = 0;
+}
+
+bool nrf_802154_duplicate_filter_check(const uint8_t * p_frame)
+{
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data;
+    duplicate_filter_entry_t                 * p_entry;
+    uint32_t                                   frame_counter = 0;
+    bool                                       frame_counter_present;
+    uint8_t                                    dsn;
+    bool                                       result = false;
+
+    if (nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_frame) &&
+        ((p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) >= FRAME_VERSION_2))
+    {
+        return false;
+    }
+
+    p_mhr_data = nrf_802154_frame_parser_mhr_parse_cached(p_frame);
+
+    if ((p_mhr_data == NULL) || (p_mhr_data->p_src_addr == NULL))
+    {
+        return false;
+    }
+
+    dsn                   = p_frame[DSN_OFFSET];
+    frame_counter_present = frame_counter_get(p_mhr_data, &frame_counter);
+    p_entry               = entry_find(p_mhr_data->p_src_addr, p_mhr_data->src_addr_size);
+
+    if (p_entry != NULL)
+    {
+        result = (p_entry->dsn == dsn) &&
+                 (p_entry->frame_counter_present == frame_counter_present) &&
+                 (p_entry->frame_counter == frame_counter);
+    }
+    else
+    {
+        p_entry      = &m_entries[m_next_entry];
+        m_next_entry = (m_next_entry + 1) % NRF_802154_DUPLICATE_FILTER_SIZE;
+
+        memcpy(p_entry->src_addr, p_mhr_data->p_src_addr, p_mhr_data->src_addr_size);
+        p_entry->src_addr_size = p_mhr_data->src_addr_size;
+    }
+
+    p_entry->dsn                   = dsn;
+    p_entry->frame_counter_present = frame_counter_present;
+    p_entry->frame_counter         = frame_counter;
+
+    return result;
+}
+
+#endif // NRF_802154_DUPLICATE_FILTER_ENABLED
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRF_802154_DUPLICATE_FILTER_H
+#define NRF_802154_DUPLICATE_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Initializes the duplicate frame filter.
+ */
+void nrf_802154_duplicate_filter_init(void);
+
+/**
+ * @brief Checks if the received frame is a retransmission of the previous frame from its sender.
+ *
+ * The frame is compared with the last frame received from the same source address. Frames are
+ * considered identical if they have the same sequence number and, if present, the same frame
+ * counter. The received frame is then remembered as the last frame from its sender.
+ *
+ * Frames without the source address or with a suppressed sequence number are never reported
+ * as duplicates.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the received frame.
+ *
+ * @retval  true   The frame is a duplicate of the previous frame from its sender.
+ * @retval  false  The frame is not a duplicate.
+ */
+bool nrf_802154_duplicate_filter_check(const uint8_t * p_frame);
+
+#endif // NRF_802154_DUPLICATE_FILTER_H
@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements securing of the transmitted frames and Enh-Acks with AES-CCM*, and
+ *   verification of the received secured frames.
+ *
+ * The frame counter written to the auxiliary security header of a transmitted frame is taken from
+ * the frame counter of its key, kept in the security PIB. The frame counter of an Enh-Ack is
+ * written by the Enh-Ack generator. The nonce is created from the extended address of this device,
+ * the frame counter and the security level of the frame, as defined in IEEE 802.15.4-2015 9.3.2.2.
+ *
+ */
+
+#include "nrf_802154_encrypt.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_aes_ccm.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_frame_parser.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_security_pib.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_ENCRYPTION_ENABLED
+
+#define SECURITY_LEVEL_ENC_BIT 0x04 ///< Bit of the Security Level field requesting encryption.
+#define IE_DESCRIPTOR_SIZE     2    ///< Size of the descriptor of an Information Element.
+#define IE_LENGTH_MASK         0x7f ///< Mask of the Length field in the Header IE descriptor.
+#define IE_ID_OFFSET           7    ///< Bit offset of the Element ID in the Header IE descriptor.
+#define IE_ID_MASK             0xff ///< Mask of the Element ID field in the Header IE descriptor.
+#define IE_ID_HT1              0x7e ///< Element ID of the Header Termination 1 IE.
+#define IE_ID_HT2              0x7f ///< Element ID of the Header Termination 2 IE.
+
+/// Layout of the secured parts of a frame.
+typedef struct
+{
+    uint8_t level;         ///< Security level of the frame.
+    uint8_t fc_offset;     ///< Offset of the Frame Counter field.
+    uint8_t key_id_offset; ///< Offset of the Key Identifier field.
+    uint8_t a_end_offset;  ///< Offset of the first byte that is not authenticated only.
+    uint8_t mic_offset;    ///< Offset of the MIC field.
+    uint8_t mic_size;      ///< Size of the MIC field.
+} secure_layout_t;
+
+static const uint8_t * mp_tx_frame;                              ///< Frame prepared to be secured.
+static uint32_t        m_tx_frame_counter;                       ///< Its frame counter.
+static uint8_t         m_tx_key[NRF_802154_KEY_SIZE];            ///< Its key.
+static uint8_t         m_tx_secured[MAX_PACKET_SIZE + PHR_SIZE]; ///< Its secured copy.
+
+/**
+ * @brief Gets the layout of the secured parts of the given frame.
+ *
+ * @param[in]  p_frame   Pointer to the buffer that contains PHR and PSDU of the frame.
+ * @param[out] p_layout  Layout of the frame.
+ *
+ * @retval true   The frame is to be secured and @p p_layout is valid.
+ * @retval false  The frame is not to be secured.
+ */
+static bool secure_layout_get(const uint8_t * p_frame, secure_layout_t * p_layout)
+{
+    uint8_t sec_ctrl_offset = nrf_802154_frame_parser_sec_ctrl_offset_get(p_frame);
+
+    if ((sec_ctrl_offset == 0) || (sec_ctrl_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
+    {
+        return false;
+    }
+
+    p_layout->level = p_frame[sec_ctrl_offset] & SECURITY_LEVEL_MASK;
+
+    if (p_layout->level == 0)
+    {
+        return false;
+    }
+
+    p_layout->fc_offset     = sec_ctrl_offset + SECURITY_CONTROL_SIZE;
+    p_layout->key_id_offset = nrf_802154_frame_parser_key_id_offset_get(p_frame);
+    p_layout->a_end_offset  = p_layout->key_id_offset;
+    p_layout->mic_size      = (p_layout->level & SECURITY_LEVEL_MIC_128) ?
+                              (2 << (p_layout->level & SECURITY_LEVEL_MIC_128)) : 0;
+
+    switch (p_frame[sec_ctrl_offset] & KEY_ID_MODE_MASK)
+    {
+        case KEY_ID_MODE_1:
+            p_layout->a_end_offset += KEY_ID_MODE_1_SIZE;
+            break;
+
+        case KEY_ID_MODE_2:
+            p_layout->a_end_offset += KEY_ID_MODE_2_SIZE;
+            break;
+
+        case KEY_ID_MODE_3:
+            p_layout->a_end_offset += KEY_ID_MODE_3_SIZE;
+            break;
+
+        default:
+            break;
+    }
+
+    if (p_frame[PHR_OFFSET] < (p_layout->a_end_offset - PHR_SIZE + p_layout->mic_size + FCS_SIZE))
+    {
+        return false;
+    }
+
+    p_layout->mic_offset = PHR_SIZE + p_frame[PHR_OFFSET] - FCS_SIZE - p_layout->mic_size;
+
+    // Header IEs are authenticated, but not encrypted.
+    if (p_frame[IE_PRESENT_OFFSET] & IE_PRESENT_BIT)
+    {
+        uint8_t offset = p_layout->a_end_offset;
+
+        while ((offset + IE_DESCRIPTOR_SIZE) <= p_layout->mic_offset)
+        {
+            uint16_t descriptor = p_frame[offset] | (p_frame[offset + 1] << 8);
+            uint8_t  id         = (descriptor >> IE_ID_OFFSET) & IE_ID_MASK;
+
+            offset += IE_DESCRIPTOR_SIZE + (descriptor & IE_LENGTH_MASK);
+
+            if ((id == IE_ID_HT1) || (id == IE_ID_HT2))
+            {
+                break;
+            }
+        }
+
+        if (offset > p_layout->mic_offset)
+        {
+            return false;
+        }
+
+        p_layout->a_end_offset = offset;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gets the key to secure the given frame with.
+ *
+ * @param[in]  p_frame          Pointer to the buffer that contains PHR and PSDU of the frame.
+ * @param[out] p_key            Pointer to the buffer for the key.
+ * @param[out] p_frame_counter  Pointer to the frame counter assigned to the frame, or NULL if
+ *                              the frame already contains the frame counter.
+ *
+ * @retval true   The key is copied to @p p_key.
+ * @retval false  The frame cannot be secured.
+ */
+static bool secure_key_get(const uint8_t * p_frame, uint8_t * p_key, uint32_t * p_frame_counter)
+{
+    uint8_t sec_ctrl = *nrf_802154_frame_parser_sec_ctrl_get(p_frame);
+    uint8_t mode     = (sec_ctrl & KEY_ID_MODE_MASK) / KEY_ID_MODE_1;
+
+    // The nonce of a frame with suppressed frame counter requires the ASN, which is not known
+    // to the driver. The key of Key Identifier Mode 0 is implicit and not known either.
+    if ((sec_ctrl & FRAME_COUNTER_SUPPRESS_BIT) || (mode == 0))
+    {
+        return false;
+    }
+
+    const uint8_t * p_key_id = nrf_802154_frame_parser_key_id_get(p_frame);
+
+    if (!nrf_802154_security_pib_key_get(mode, p_key_id, p_key))
+    {
+        return false;
+    }
+
+    return (p_frame_counter == NULL) ||
+           nrf_802154_security_pib_frame_counter_get_next(mode, p_key_id, p_frame_counter);
+}
+
+/** Read the frame counter from the given frame. */
+static uint32_t frame_counter_read(const uint8_t * p_frame, const secure_layout_t * p_layout)
+{
+    return (uint32_t)p_frame[p_layout->fc_offset] |
+           ((uint32_t)p_frame[p_layout->fc_offset + 1] << 8) |
+           ((uint32_t)p_frame[p_layout->fc_offset + 2] << 16) |
+           ((uint32_t)p_frame[p_layout->fc_offset + 3] << 24);
+}
+
+/**
+ * @brief Prepares the AES-CCM* transformation of the given frame.
+ *
+ * @param[in]  p_frame        Pointer to the buffer that contains PHR and PSDU of the frame.
+ * @param[in]  p_layout       Layout of the frame.
+ * @param[in]  p_key          Pointer to the key.
+ * @param[in]  p_ext_addr     Extended address of the originator of the frame, in little endian.
+ * @param[in]  frame_counter  Frame counter of the frame.
+ * @param[out] p_nonce        Buffer of @ref NRF_802154_AES_CCM_NONCE_SIZE bytes for the nonce.
+ * @param[out] p_ccm_data     Description of the transformation.
+ */
+static void ccm_data_prepare(uint8_t                   * p_frame,
+                             const secure_layout_t     * p_layout,
+                             const uint8_t             * p_key,
+                             const uint8_t             * p_ext_addr,
+                             uint32_t                    frame_counter,
+                             uint8_t                   * p_nonce,
+                             nrf_802154_aes_ccm_data_t * p_ccm_data)
+{
+    // The extended address is stored in little endian, but the nonce requires big endian.
+    for (uint32_t i = 0; i < EXTENDED_ADDRESS_SIZE; i++)
+    {
+        p_nonce[i] = p_ext_addr[EXTENDED_ADDRESS_SIZE - 1 - i];
+    }
+
+    p_nonce[EXTENDED_ADDRESS_SIZE]     = (uint8_t)(frame_counter >> 24);
+    p_nonce[EXTENDED_ADDRESS_SIZE + 1] = (uint8_t)(frame_counter >> 16);
+    p_nonce[EXTENDED_ADDRESS_SIZE + 2] = (uint8_t)(frame_counter >> 8);
+    p_nonce[EXTENDED_ADDRESS_SIZE + 3] = (uint8_t)frame_counter;
+    p_nonce[EXTENDED_ADDRESS_SIZE + 4] = p_layout->level;
+
+    p_ccm_data->p_key       = p_key;
+    p_ccm_data->p_nonce     = p_nonce;
+    p_ccm_data->p_auth_data = &p_frame[PHR_SIZE];
+    p_ccm_data->p_mic       = &p_frame[p_layout->mic_offset];
+    p_ccm_data->mic_size    = p_layout->mic_size;
+
+    if (p_layout->level & SECURITY_LEVEL_ENC_BIT)
+    {
+        p_ccm_data->auth_data_len  = p_layout->a_end_offset - PHR_SIZE;
+        p_ccm_data->p_plain_text   = &p_frame[p_layout->a_end_offset];
+        p_ccm_data->plain_text_len = p_layout->mic_offset - p_layout->a_end_offset;
+    }
+    else
+    {
+        p_ccm_data->auth_data_len  = p_layout->mic_offset - PHR_SIZE;
+        p_ccm_data->p_plain_text   = NULL;
+        p_ccm_data->plain_text_len = 0;
+    }
+}
+
+/** Secure the given frame in place, using the given key and frame counter. */
+static void frame_secure(uint8_t               * p_frame,
+                         const secure_layout_t * p_layout,
+                         const uint8_t         * p_key,
+                         uint32_t                frame_counter)
+{
+    nrf_802154_aes_ccm_data_t ccm_data;
+    uint8_t                   nonce[NRF_802154_AES_CCM_NONCE_SIZE];
+
+    p_frame[p_layout->fc_offset]     = (uint8_t)frame_counter;
+    p_frame[p_layout->fc_offset + 1] = (uint8_t)(frame_counter >> 8);
+    p_frame[p_layout->fc_offset + 2] = (uint8_t)(frame_counter >> 16);
+    p_frame[p_layout->fc_offset + 3] = (uint8_t)(frame_counter >> 24);
+
+    ccm_data_prepare(p_frame,
+                     p_layout,
+                     p_key,
+                     nrf_802154_pib_extended_address_get(),
+                     frame_counter,
+                     nonce,
+                     &ccm_data);
+
+    nrf_802154_aes_ccm_transform(&ccm_data);
+}
+
+void nrf_802154_encrypt_init(void)
+{
+    mp_tx_frame = NULL;
+}
+
+bool nrf_802154_encrypt_tx_setup(const uint8_t * p_frame)
+{
+    secure_layout_t layout;
+
+    mp_tx_frame = NULL;
+
+    if (!secure_layout_get(p_frame, &layout))
+    {
+        return true;
+    }
+
+    if (!secure_key_get(p_frame, m_tx_key, &m_tx_frame_counter))
+    {
+        return false;
+    }
+
+    mp_tx_frame = p_frame;
+
+    return true;
+}
+
+const uint8_t * nrf_802154_encrypt_tx_frame_get(const uint8_t * p_frame)
+{
+    secure_layout_t layout;
+
+    if ((p_frame != mp_tx_frame) || !secure_layout_get(p_frame, &layout))
+    {
+        return p_frame;
+    }
+
+    memcpy(m_tx_secured, p_frame, p_frame[PHR_OFFSET] + PHR_SIZE);
+    frame_secure(m_tx_secured, &layout, m_tx_key, m_tx_frame_counter);
+
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+    // The frame counter is not encrypted, so the higher layer can read the assigned value from
+    // the frame passed back with the result of the transmission.
+    memcpy((uint8_t *)&p_frame[layout.fc_offset], &m_tx_secured[layout.fc_offset], 4);
+#endif
+
+    return m_tx_secured;
+}
+
+void nrf_802154_encrypt_tx_ended(const uint8_t * p_frame)
+{
+    if (p_frame == mp_tx_frame)
+    {
+        mp_tx_frame = NULL;
+    }
+}
+
+bool nrf_802154_encrypt_ack(uint8_t * p_ack)
+{
+    secure_layout_t layout;
+    uint8_t         key[NRF_802154_KEY_SIZE];
+    uint32_t        frame_counter;
+
+    if (!secure_layout_get(p_ack, &layout))
+    {
+        return true;
+    }
+
+    if (!secure_key_get(p_ack, key, NULL))
+    {
+        return false;
+    }
+
+    frame_counter = frame_counter_read(p_ack, &layout);
+
+    frame_secure(p_ack, &layout, key, frame_counter);
+
+    return true;
+}
+
+#if NRF_802154_DECRYPTION_ENABLED
+
+bool nrf_802154_encrypt_rx_frame_verify(uint8_t * p_frame, bool * p_decrypted)
+{
+    secure_layout_t           layout;
+    uint8_t                   key[NRF_802154_KEY_SIZE];
+    uint8_t                   nonce[NRF_802154_AES_CCM_NONCE_SIZE];
+    nrf_802154_aes_ccm_data_t ccm_data;
+    const uint8_t           * p_src_addr;
+    bool                      src_addr_extended;
+
+    *p_decrypted = false;
+
+    if (!secure_layout_get(p_frame, &layout))
+    {
+        return true;
+    }
+
+    // The nonce requires the extended address of the originator, which the driver does not know
+    // if the frame contains only its short address.
+    p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &src_addr_extended);
+
+    if ((p_src_addr == NULL) || !src_addr_extended || !secure_key_get(p_frame, key, NULL))
+    {
+        return true;
+    }
+
+    ccm_data_prepare(p_frame,
+                     &layout,
+                     key,
+                     p_src_addr,
+                     frame_counter_read(p_frame, &layout),
+                     nonce,
+                     &ccm_data);
+
+    if (!nrf_802154_aes_ccm_inverse(&ccm_data))
+    {
+        return false;
+    }
+
+    *p_decrypted = true;
+
+    return true;
+}
+
+#endif // NRF_802154_DECRYPTION_ENABLED
+
+#endif // NRF_802154_ENCRYPTION_ENABLED
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that secures the transmitted frames and Enh-Acks with AES-CCM*, and verifies
+ *        the received secured frames.
+ *
+ */
+
+#ifndef NRF_802154_ENCRYPT_H
+#define NRF_802154_ENCRYPT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+/**
+ * @brief Initializes the encryption module.
+ */
+void nrf_802154_encrypt_init(void);
+
+/**
+ * @brief Prepares securing of a frame requested to be transmitted.
+ *
+ * The key matching the auxiliary security header of the frame is looked up and the frame counter
+ * is assigned. A frame without the auxiliary security header is accepted as is.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame.
+ *
+ * @retval true   The frame can be transmitted.
+ * @retval false  The frame cannot be secured, so it must not be transmitted.
+ */
+bool nrf_802154_encrypt_tx_setup(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the frame to be passed to the radio.
+ *
+ * The frame prepared with @ref nrf_802154_encrypt_tx_setup is copied to the internal buffer and
+ * secured there, so the buffer of the higher layer keeps the plain text for retransmissions.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame.
+ *
+ * @returns  Pointer to the secured copy of the frame, or @p p_frame if it is not to be secured.
+ */
+const uint8_t * nrf_802154_encrypt_tx_frame_get(const uint8_t * p_frame);
+
+/**
+ * @brief Notifies the encryption module that the transmission of a frame ended.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame.
+ */
+void nrf_802154_encrypt_tx_ended(const uint8_t * p_frame);
+
+/**
+ * @brief Secures the Enh-Ack created by the ACK generator in place.
+ *
+ * The frame counter of the Enh-Ack must be already written by the ACK generator.
+ *
+ * @param[inout]  p_ack  Pointer to the buffer that contains PHR and PSDU of the Enh-Ack.
+ *
+ * @retval true   The Enh-Ack is secured or it does not require security.
+ * @retval false  The Enh-Ack cannot be secured, so it must not be transmitted.
+ */
+bool nrf_802154_encrypt_ack(uint8_t * p_ack);
+
+#if NRF_802154_DECRYPTION_ENABLED
+
+/**
+ * @brief Verifies and decrypts a received frame in place.
+ *
+ * The frame is processed only if it is secured, its originator is identified by the extended
+ * address and the key matching its Key Identifier field is stored. The frame is passed unchanged
+ * otherwise, so it can be processed by the higher layer.
+ *
+ * @note Frame counters of the received frames are not checked against replays. This is left for
+ *       the higher layer.
+ *
+ * @param[inout]  p_frame      Pointer to the buffer that contains PHR and PSDU of the frame.
+ * @param[out]    p_decrypted  If the frame was verified and decrypted.
+ *
+ * @retval true   The frame is valid or it was not processed.
+ * @retval false  The MIC of the frame is invalid, so the frame must be dropped.
+ */
+bool nrf_802154_encrypt_rx_frame_verify(uint8_t * p_frame, bool * p_decrypted);
+
+#endif // NRF_802154_DECRYPTION_ENABLED
+
+#endif // NRF_802154_ENCRYPT_H
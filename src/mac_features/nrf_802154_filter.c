@@ -48,11 +48,50 @@
 #include "nrf_802154_const.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_utils.h"
 
-#define FCF_CHECK_OFFSET           (PHR_SIZE + FCF_SIZE)
-#define PANID_CHECK_OFFSET         (DEST_ADDR_OFFSET)
-#define SHORT_ADDR_CHECK_OFFSET    (DEST_ADDR_OFFSET + SHORT_ADDRESS_SIZE)
-#define EXTENDED_ADDR_CHECK_OFFSET (DEST_ADDR_OFFSET + EXTENDED_ADDRESS_SIZE)
+#define FCF_CHECK_OFFSET   (PHR_SIZE + FCF_SIZE)
+#define PANID_CHECK_OFFSET (DEST_ADDR_OFFSET)
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+#if (NRF_802154_SRC_ADDR_FILTER_SHORT_ADDRESSES < 1) || \
+    (NRF_802154_SRC_ADDR_FILTER_EXTENDED_ADDRESSES < 1)
+#error Source address filter requires at least one slot for each address type.
+#endif
+
+/// Number of slots of the hash table of short addresses. At least half of them is always empty.
+#define SRC_SHORT_ADDR_SLOTS    (2 * NRF_802154_SRC_ADDR_FILTER_SHORT_ADDRESSES)
+/// Number of slots of the hash table of extended addresses. At least half of them is always empty.
+#define SRC_EXTENDED_ADDR_SLOTS (2 * NRF_802154_SRC_ADDR_FILTER_EXTENDED_ADDRESSES)
+
+/// Descriptor of a hash table of the source address filter.
+typedef struct
+{
+    uint8_t  * p_addrs;   ///< Storage of addresses, @p addr_size bytes per slot.
+    bool     * p_used;    ///< If a slot holds an address.
+    uint32_t * p_count;   ///< Number of addresses in the table.
+    uint32_t   capacity;  ///< Maximum number of addresses in the table.
+    uint32_t   slots;     ///< Number of slots of the table.
+    uint8_t    addr_size; ///< Size of a single address.
+} src_addr_table_t;
+
+static uint8_t  m_src_short_addrs[SRC_SHORT_ADDR_SLOTS][SHORT_ADDRESS_SIZE];
+static bool     m_src_short_used[SRC_SHORT_ADDR_SLOTS];
+static uint32_t m_src_short_count;
+
+static uint8_t  m_src_extended_addrs[SRC_EXTENDED_ADDR_SLOTS][EXTENDED_ADDRESS_SIZE];
+static bool     m_src_extended_used[SRC_EXTENDED_ADDR_SLOTS];
+static uint32_t m_src_extended_count;
+
+static volatile nrf_802154_src_addr_filter_mode_t m_src_addr_filter_mode; ///< Source filter mode.
+
+#endif // NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+#if NRF_802154_PAN_CONTEXTS > 1
+static uint8_t m_pan_context; ///< PAN context matched by the frame being filtered.
+
+#endif
 
 /**
  * @brief Check if given frame version is allowed for given frame type.
@@ -155,12 +194,8 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2006(const uint8_t *
     switch (p_data[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK)
     {
         case DEST_ADDR_TYPE_SHORT:
-            *p_num_bytes = SHORT_ADDR_CHECK_OFFSET;
-            result       = NRF_802154_RX_ERROR_NONE;
-            break;
-
         case DEST_ADDR_TYPE_EXTENDED:
-            *p_num_bytes = EXTENDED_ADDR_CHECK_OFFSET;
+            *p_num_bytes = nrf_802154_frame_parser_dst_addr_end_offset_get(p_data);
             result       = NRF_802154_RX_ERROR_NONE;
             break;
 
@@ -302,23 +337,26 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get(const uint8_t * p_dat
 /**
  * Verify if destination PAN Id of incoming frame allows processing by this node.
  *
- * @param[in] p_panid     Pointer of PAN ID of incoming frame.
- * @param[in] frame_type  Type of the frame being filtered.
+ * @param[in] p_panid      Pointer of PAN ID of incoming frame.
+ * @param[in] frame_type   Type of the frame being filtered.
+ * @param[in] p_own_panid  Pointer to the PAN ID of the checked PAN context.
  *
  * @retval true   PAN Id of incoming frame allows further processing of the frame.
  * @retval false  PAN Id of incoming frame does not allow further processing.
  */
-static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
+static bool dst_pan_id_check(const uint8_t * p_panid,
+                             uint8_t         frame_type,
+                             const uint8_t * p_own_panid)
 {
     bool result;
 
-    if ((0 == memcmp(p_panid, nrf_802154_pib_pan_id_get(), PAN_ID_SIZE)) ||
+    if ((0 == memcmp(p_panid, p_own_panid, PAN_ID_SIZE)) ||
         (0 == memcmp(p_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
     else if ((FRAME_TYPE_BEACON == frame_type) &&
-             (0 == memcmp(nrf_802154_pib_pan_id_get(), BROADCAST_ADDRESS, PAN_ID_SIZE)))
+             (0 == memcmp(p_own_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
@@ -334,15 +372,16 @@ static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
  * Verify if destination short address of incoming frame allows processing by this node.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] p_own_addr  Pointer to the short address of the checked PAN context.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_short_addr_check(const uint8_t * p_dst_addr)
+static bool dst_short_addr_check(const uint8_t * p_dst_addr, const uint8_t * p_own_addr)
 {
     bool result;
 
-    if ((0 == memcmp(p_dst_addr, nrf_802154_pib_short_address_get(), SHORT_ADDRESS_SIZE)) ||
+    if ((0 == memcmp(p_dst_addr, p_own_addr, SHORT_ADDRESS_SIZE)) ||
         (0 == memcmp(p_dst_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE)))
     {
         result = true;
@@ -359,15 +398,16 @@ static bool dst_short_addr_check(const uint8_t * p_dst_addr)
  * Verify if destination extended address of incoming frame allows processing by this node.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] p_own_addr  Pointer to the extended address of the checked PAN context.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
+static bool dst_extended_addr_check(const uint8_t * p_dst_addr, const uint8_t * p_own_addr)
 {
     bool result;
 
-    if (0 == memcmp(p_dst_addr, nrf_802154_pib_extended_address_get(), EXTENDED_ADDRESS_SIZE))
+    if (0 == memcmp(p_dst_addr, p_own_addr, EXTENDED_ADDRESS_SIZE))
     {
         result = true;
     }
@@ -381,7 +421,8 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
 
 /**
  * Verify if destination addressing of incoming frame allows processing by this node.
- * This function checks addressing according to IEEE 802.15.4-2015.
+ * This function checks addressing according to IEEE 802.15.4-2015. The frame is checked against
+ * each configured PAN context and the first matching context is stored in @ref m_pan_context.
  *
  * @param[in] p_data  Pointer to a buffer containing PHR and PSDU of the incoming frame.
  *
@@ -391,49 +432,241 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
  */
 static nrf_802154_rx_error_t dst_addr_check(const uint8_t * p_data, uint8_t frame_type)
 {
-    bool                               result;
-    nrf_802154_frame_parser_mhr_data_t mhr_data;
-
-    result = nrf_802154_frame_parser_mhr_parse(p_data, &mhr_data);
+    // The parse result is reused by the ACK generator when the ACK is created for this frame.
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_parse_cached(p_data);
 
-    if (!result)
+    if (p_mhr_data == NULL)
     {
         return NRF_802154_RX_ERROR_INVALID_FRAME;
     }
 
-    if (mhr_data.p_dst_panid != NULL)
+    for (uint8_t id = 0; id < NRF_802154_PAN_CONTEXTS; id++)
+    {
+        const uint8_t * p_own_panid;
+        const uint8_t * p_own_addr;
+
+        if (id == 0)
+        {
+            p_own_panid = nrf_802154_pib_pan_id_get();
+            p_own_addr  = (p_mhr_data->dst_addr_size == SHORT_ADDRESS_SIZE) ?
+                          nrf_802154_pib_short_address_get() :
+                          nrf_802154_pib_extended_address_get();
+        }
+#if NRF_802154_PAN_CONTEXTS > 1
+        else
+        {
+            const nrf_802154_pan_context_t * p_context = nrf_802154_pib_pan_context_get(id);
+
+            if (p_context == NULL)
+            {
+                continue;
+            }
+
+            p_own_panid = p_context->pan_id;
+            p_own_addr  = (p_mhr_data->dst_addr_size == SHORT_ADDRESS_SIZE) ?
+                          p_context->short_addr : p_context->extended_addr;
+        }
+#endif
+
+        if ((p_mhr_data->p_dst_panid != NULL) &&
+            !dst_pan_id_check(p_mhr_data->p_dst_panid, frame_type, p_own_panid))
+        {
+            continue;
+        }
+
+        bool addr_match;
+
+        switch (p_mhr_data->dst_addr_size)
+        {
+            case SHORT_ADDRESS_SIZE:
+                addr_match = dst_short_addr_check(p_mhr_data->p_dst_addr, p_own_addr);
+                break;
+
+            case EXTENDED_ADDRESS_SIZE:
+                addr_match = dst_extended_addr_check(p_mhr_data->p_dst_addr, p_own_addr);
+                break;
+
+            case 0:
+                // Allow frames destined to the Pan Coordinator without destination address or
+                // beacon frames without destination address
+                addr_match = nrf_802154_pib_pan_coord_get() || (frame_type == FRAME_TYPE_BEACON);
+                break;
+
+            default:
+                assert(false);
+                return NRF_802154_RX_ERROR_INVALID_FRAME;
+        }
+
+        if (addr_match)
+        {
+#if NRF_802154_PAN_CONTEXTS > 1
+            m_pan_context = id;
+#endif
+            return NRF_802154_RX_ERROR_NONE;
+        }
+    }
+
+    return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+}
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+/**
+ * @brief Get the hash table of the source address filter holding given type of addresses.
+ *
+ * @param[in]  extended  If the table of extended or short addresses is requested.
+ * @param[out] p_table   Descriptor of the requested table.
+ */
+static void src_addr_table_get(bool extended, src_addr_table_t * p_table)
+{
+    if (extended)
+    {
+        p_table->p_addrs   = &m_src_extended_addrs[0][0];
+        p_table->p_used    = m_src_extended_used;
+        p_table->p_count   = &m_src_extended_count;
+        p_table->capacity  = NRF_802154_SRC_ADDR_FILTER_EXTENDED_ADDRESSES;
+        p_table->slots     = SRC_EXTENDED_ADDR_SLOTS;
+        p_table->addr_size = EXTENDED_ADDRESS_SIZE;
+    }
+    else
+    {
+        p_table->p_addrs   = &m_src_short_addrs[0][0];
+        p_table->p_used    = m_src_short_used;
+        p_table->p_count   = &m_src_short_count;
+        p_table->capacity  = NRF_802154_SRC_ADDR_FILTER_SHORT_ADDRESSES;
+        p_table->slots     = SRC_SHORT_ADDR_SLOTS;
+        p_table->addr_size = SHORT_ADDRESS_SIZE;
+    }
+}
+
+/**
+ * @brief Get the slot at which the search for an address starts.
+ *
+ * @param[in]  p_table  Descriptor of the table.
+ * @param[in]  p_addr   Pointer to an address.
+ *
+ * @returns  Index of the home slot of @p p_addr.
+ */
+static uint32_t src_addr_home_slot_get(const src_addr_table_t * p_table, const uint8_t * p_addr)
+{
+    uint32_t hash = 2166136261UL; // FNV-1a offset basis
+
+    for (uint32_t i = 0; i < p_table->addr_size; i++)
     {
-        if (!dst_pan_id_check(mhr_data.p_dst_panid, frame_type))
+        hash ^= p_addr[i];
+        hash *= 16777619UL; // FNV-1a prime
+    }
+
+    return hash % p_table->slots;
+}
+
+/**
+ * @brief Find an address in a hash table of the source address filter.
+ *
+ * @param[in]  p_table  Descriptor of the table.
+ * @param[in]  p_addr   Pointer to an address that is searched for.
+ * @param[out] p_slot   If the address appears in the table, this is index of its slot. Otherwise,
+ *                      it is the index of the free slot @p p_addr would be placed in.
+ *
+ * @retval true   Address @p p_addr is in the table.
+ * @retval false  Address @p p_addr is not in the table.
+ */
+static bool src_addr_find(const src_addr_table_t * p_table,
+                          const uint8_t          * p_addr,
+                          uint32_t               * p_slot)
+{
+    uint32_t slot = src_addr_home_slot_get(p_table, p_addr);
+
+    // The loop ends, because the table always has free slots.
+    while (p_table->p_used[slot])
+    {
+        if (0 == memcmp(&p_table->p_addrs[slot * p_table->addr_size], p_addr, p_table->addr_size))
         {
-            return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+            *p_slot = slot;
+            return true;
         }
+
+        slot = (slot + 1) % p_table->slots;
     }
 
-    switch (mhr_data.dst_addr_size)
+    *p_slot = slot;
+    return false;
+}
+
+/**
+ * @brief Verify the source address of the incoming frame against the source address filter.
+ *
+ * Frames without the source address field are always accepted.
+ *
+ * @param[in] p_data  Pointer to a buffer containing PHR and PSDU of the incoming frame.
+ *
+ * @retval NRF_802154_RX_ERROR_NONE               The frame may be further processed.
+ * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Received frame is invalid.
+ * @retval NRF_802154_RX_ERROR_SRC_ADDR_FILTERED  The frame is rejected by the filter.
+ */
+static nrf_802154_rx_error_t src_addr_check(const uint8_t * p_data)
+{
+    nrf_802154_src_addr_filter_mode_t          mode = m_src_addr_filter_mode;
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data;
+    src_addr_table_t                           table;
+    uint32_t                                   slot;
+    bool                                       listed;
+
+    if (mode == NRF_802154_SRC_ADDR_FILTER_DISABLED)
     {
-        case SHORT_ADDRESS_SIZE:
-            return dst_short_addr_check(mhr_data.p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-
-        case EXTENDED_ADDRESS_SIZE:
-            return dst_extended_addr_check(mhr_data.p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-
-        case 0:
-            // Allow frames destined to the Pan Coordinator without destination address or
-            // beacon frames without destination address
-            return (nrf_802154_pib_pan_coord_get() ||
-                    (frame_type ==
-                     FRAME_TYPE_BEACON)) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+        return NRF_802154_RX_ERROR_NONE;
+    }
 
-        default:
-            assert(false);
+    p_mhr_data = nrf_802154_frame_parser_mhr_parse_cached(p_data);
+
+    if (p_mhr_data == NULL)
+    {
+        return NRF_802154_RX_ERROR_INVALID_FRAME;
+    }
+
+    if (p_mhr_data->p_src_addr == NULL)
+    {
+        return NRF_802154_RX_ERROR_NONE;
+    }
+
+    src_addr_table_get(p_mhr_data->src_addr_size == EXTENDED_ADDRESS_SIZE, &table);
+    listed = src_addr_find(&table, p_mhr_data->p_src_addr, &slot);
+
+    if (listed == (mode == NRF_802154_SRC_ADDR_FILTER_ALLOW))
+    {
+        return NRF_802154_RX_ERROR_NONE;
     }
 
-    return NRF_802154_RX_ERROR_INVALID_FRAME;
+    return NRF_802154_RX_ERROR_SRC_ADDR_FILTERED;
 }
 
+/**
+ * @brief Extend the part of the frame to be received before its addressing is checked, so that
+ *        the source address is also available if the source address filter is active.
+ *
+ * @param[in]    p_data       Pointer to a buffer containing PHR and PSDU of the incoming frame.
+ * @param[inout] p_num_bytes  Offset of the destination addressing fields end.
+ */
+static void src_addr_check_offset_update(const uint8_t * p_data, uint8_t * p_num_bytes)
+{
+    uint8_t end_offset;
+
+    if (m_src_addr_filter_mode == NRF_802154_SRC_ADDR_FILTER_DISABLED)
+    {
+        return;
+    }
+
+    end_offset = nrf_802154_frame_parser_addressing_end_offset_get(p_data);
+
+    if ((end_offset != NRF_802154_FRAME_PARSER_INVALID_OFFSET) && (end_offset > *p_num_bytes))
+    {
+        *p_num_bytes = end_offset;
+    }
+}
+
+#endif // NRF_802154_SRC_ADDR_FILTER_ENABLED
+
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes)
 {
     nrf_802154_rx_error_t result        = NRF_802154_RX_ERROR_INVALID_FRAME;
@@ -443,6 +676,10 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
     switch (*p_num_bytes)
     {
         case FCF_CHECK_OFFSET:
+#if NRF_802154_PAN_CONTEXTS > 1
+            m_pan_context = 0;
+#endif
+
             if (p_data[0] < IMM_ACK_LENGTH || p_data[0] > MAX_PACKET_SIZE)
             {
                 result = NRF_802154_RX_ERROR_INVALID_LENGTH;
@@ -455,6 +692,12 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
                 break;
             }
 
+            if ((nrf_802154_pib_frame_type_filter_get() & (1 << frame_type)) == 0)
+            {
+                result = NRF_802154_RX_ERROR_FRAME_TYPE_FILTERED;
+                break;
+            }
+
             if (!dst_addressing_may_be_present(frame_type))
             {
                 result = NRF_802154_RX_ERROR_NONE;
@@ -462,12 +705,141 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
             }
 
             result = dst_addressing_end_offset_get(p_data, p_num_bytes, frame_type, frame_version);
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+            if ((result == NRF_802154_RX_ERROR_NONE) && (*p_num_bytes != FCF_CHECK_OFFSET))
+            {
+                src_addr_check_offset_update(p_data, p_num_bytes);
+            }
+#endif
             break;
 
         default:
             result = dst_addr_check(p_data, frame_type);
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+            if (result == NRF_802154_RX_ERROR_NONE)
+            {
+                result = src_addr_check(p_data);
+            }
+#endif
             break;
     }
 
     return result;
 }
+
+uint8_t nrf_802154_filter_pan_context_get(void)
+{
+#if NRF_802154_PAN_CONTEXTS > 1
+    return m_pan_context;
+#else
+    return 0;
+#endif
+}
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+void nrf_802154_filter_src_addr_mode_set(nrf_802154_src_addr_filter_mode_t mode)
+{
+    m_src_addr_filter_mode = mode;
+}
+
+bool nrf_802154_filter_src_addr_add(const uint8_t * p_addr, bool extended)
+{
+    src_addr_table_t                table;
+    uint32_t                        slot;
+    bool                            result = true;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    src_addr_table_get(extended, &table);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!src_addr_find(&table, p_addr, &slot))
+    {
+        if (*table.p_count < table.capacity)
+        {
+            memcpy(&table.p_addrs[slot * table.addr_size], p_addr, table.addr_size);
+            table.p_used[slot] = true;
+            (*table.p_count)++;
+        }
+        else
+        {
+            result = false;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_filter_src_addr_remove(const uint8_t * p_addr, bool extended)
+{
+    src_addr_table_t                table;
+    uint32_t                        hole;
+    bool                            result;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    src_addr_table_get(extended, &table);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = src_addr_find(&table, p_addr, &hole);
+
+    if (result)
+    {
+        uint32_t next = (hole + 1) % table.slots;
+
+        // Move back the entries following the removed one in its probe sequence to fill the gap.
+        while (table.p_used[next])
+        {
+            const uint8_t * p_next = &table.p_addrs[next * table.addr_size];
+            uint32_t        home   = src_addr_home_slot_get(&table, p_next);
+            bool            stays;
+
+            // The entry stays if its home slot is cyclically within (hole, next].
+            if (hole <= next)
+            {
+                stays = (hole < home) && (home <= next);
+            }
+            else
+            {
+                stays = (hole < home) || (home <= next);
+            }
+
+            if (!stays)
+            {
+                memcpy(&table.p_addrs[hole * table.addr_size], p_next, table.addr_size);
+                hole = next;
+            }
+
+            next = (next + 1) % table.slots;
+        }
+
+        table.p_used[hole] = false;
+        (*table.p_count)--;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void nrf_802154_filter_src_addr_reset(bool extended)
+{
+    src_addr_table_t                table;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    src_addr_table_get(extended, &table);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    memset(table.p_used, 0, table.slots * sizeof(bool));
+    *table.p_count = 0;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_SRC_ADDR_FILTER_ENABLED
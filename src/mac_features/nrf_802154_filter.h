@@ -40,6 +40,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 
 /**
@@ -68,11 +69,65 @@
  *                            unchanged if no more iterations are to be performed during
  *                            the filtering of the given frame.
  *
- * @retval NRF_802154_RX_ERROR_NONE               Verified part of the incoming frame is valid.
- * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Verified part of the incoming frame is invalid.
- * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  Incoming frame has destination address that
- *                                                mismatches the address of this node.
+ * @retval NRF_802154_RX_ERROR_NONE                 Verified part of the incoming frame is valid.
+ * @retval NRF_802154_RX_ERROR_INVALID_FRAME        Verified part of the incoming frame is invalid.
+ * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR    Incoming frame has destination address that
+ *                                                  mismatches the address of this node.
+ * @retval NRF_802154_RX_ERROR_SRC_ADDR_FILTERED    Incoming frame is rejected by the source
+ *                                                  address filter.
+ * @retval NRF_802154_RX_ERROR_FRAME_TYPE_FILTERED  Incoming frame is of a type that is not
+ *                                                  accepted by the frame type filter.
  */
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes);
 
+/**
+ * @brief Gets the PAN context matched by the last frame accepted by the filter.
+ *
+ * Frames without a destination address and frames without addressing fields are reported as
+ * matching context 0.
+ *
+ * @returns  Identifier of the matched context (0 to @ref NRF_802154_PAN_CONTEXTS - 1).
+ */
+uint8_t nrf_802154_filter_pan_context_get(void);
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+/**
+ * @brief Sets the mode of the source address filter.
+ *
+ * @param[in]  mode  Source address filter mode.
+ */
+void nrf_802154_filter_src_addr_mode_set(nrf_802154_src_addr_filter_mode_t mode);
+
+/**
+ * @brief Adds an address to the source address filter list.
+ *
+ * @param[in]  p_addr    Pointer to the address in the little-endian byte order.
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The address is in the list.
+ * @retval false  The list is full.
+ */
+bool nrf_802154_filter_src_addr_add(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Removes an address from the source address filter list.
+ *
+ * @param[in]  p_addr    Pointer to the address in the little-endian byte order.
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The address has been removed from the list.
+ * @retval false  The address was not in the list.
+ */
+bool nrf_802154_filter_src_addr_remove(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Removes all addresses of the given type from the source address filter list.
+ *
+ * @param[in]  extended  If extended or short addresses are to be removed.
+ */
+void nrf_802154_filter_src_addr_reset(bool extended);
+
+#endif // NRF_802154_SRC_ADDR_FILTER_ENABLED
+
 #endif /* NRF_802154_FILTER_H_ */
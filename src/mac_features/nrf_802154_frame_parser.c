@@ -45,165 +45,192 @@
 
 #include "nrf_802154_const.h"
 
-/***************************************************************************************************
- * @section Helper functions
- **************************************************************************************************/
+/// Number of entries in the addressing offsets table.
+#define ADDR_OFFSETS_TABLE_SIZE      128U
+
+/// Bit of the addressing offsets table index holding the PAN ID compression bit.
+#define ADDR_IDX_PANID_COMPR_SHIFT   0U
+/// Lowest bit of the addressing offsets table index holding the destination addressing mode.
+#define ADDR_IDX_DST_MODE_SHIFT      1U
+/// Lowest bit of the addressing offsets table index holding the source addressing mode.
+#define ADDR_IDX_SRC_MODE_SHIFT      3U
+/// Bit of the addressing offsets table index set for frame version 2 and above.
+#define ADDR_IDX_VERSION_2_SHIFT     5U
+/// Bit of the addressing offsets table index set if DSN is suppressed in at least 2015 frame.
+#define ADDR_IDX_DSN_SUPPRESS_SHIFT  6U
+
+#define ADDR_MODE_NONE               0U ///< Addressing mode: address not present.
+#define ADDR_MODE_RESERVED           1U ///< Addressing mode: reserved value.
+#define ADDR_MODE_SHORT              2U ///< Addressing mode: short address.
+#define ADDR_MODE_EXTENDED           3U ///< Addressing mode: extended address.
+
+#define INVALID_OFFSET               NRF_802154_FRAME_PARSER_INVALID_OFFSET
 
-// Version
-static uint8_t frame_version_get(const uint8_t * p_frame)
-{
-    return p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK;
-}
-
-// Addressing
+/*
+ * The following macros compute fields of a single addressing offsets table entry from its index.
+ * They are constant expressions, which lets the compiler generate the whole table on its own.
+ */
+#define IDX_PANID_COMPR(i)           (((i) >> ADDR_IDX_PANID_COMPR_SHIFT) & 1U)
+#define IDX_DST_MODE(i)              (((i) >> ADDR_IDX_DST_MODE_SHIFT) & 3U)
+#define IDX_SRC_MODE(i)              (((i) >> ADDR_IDX_SRC_MODE_SHIFT) & 3U)
+#define IDX_VERSION_2(i)             (((i) >> ADDR_IDX_VERSION_2_SHIFT) & 1U)
+#define IDX_DSN_SUPPRESS(i)          (((i) >> ADDR_IDX_DSN_SUPPRESS_SHIFT) & 1U)
+
+#define MODE_SIZE(m)                                       \
+    (((m) == ADDR_MODE_NONE) ? 0U :                        \
+     ((m) == ADDR_MODE_SHORT) ? SHORT_ADDRESS_SIZE :       \
+     ((m) == ADDR_MODE_EXTENDED) ? EXTENDED_ADDRESS_SIZE : \
+     INVALID_OFFSET)
+
+#define IDX_DST_PRESENT(i)           (IDX_DST_MODE(i) != ADDR_MODE_NONE)
+#define IDX_SRC_PRESENT(i)           (IDX_SRC_MODE(i) != ADDR_MODE_NONE)
+#define IDX_BOTH_EXTENDED(i)                    \
+    ((IDX_DST_MODE(i) == ADDR_MODE_EXTENDED) && \
+     (IDX_SRC_MODE(i) == ADDR_MODE_EXTENDED))
+
+// Table 7-2 of IEEE 802.15.4-2015 for frame version 2, PAN ID compression rules of 2006 otherwise.
+#define IDX_DST_PANID_PRESENT(i)                       \
+    (!IDX_VERSION_2(i) ? IDX_DST_PRESENT(i) :          \
+     IDX_BOTH_EXTENDED(i) ? !IDX_PANID_COMPR(i) :      \
+     (IDX_SRC_PRESENT(i) && IDX_DST_PRESENT(i)) ? 1U : \
+     IDX_SRC_PRESENT(i) ? 0U :                         \
+     IDX_DST_PRESENT(i) ? !IDX_PANID_COMPR(i) :        \
+     IDX_PANID_COMPR(i))
+
+#define IDX_SRC_PANID_PRESENT(i)                                       \
+    (!IDX_VERSION_2(i) ? (IDX_SRC_PRESENT(i) && !IDX_PANID_COMPR(i)) : \
+     IDX_BOTH_EXTENDED(i) ? 0U :                                       \
+     IDX_SRC_PRESENT(i) ? !IDX_PANID_COMPR(i) :                        \
+     0U)
+
+#define IDX_ADDRESSING_START(i) \
+    (PHR_SIZE + FCF_SIZE + ((IDX_VERSION_2(i) && IDX_DSN_SUPPRESS(i)) ? 0U : DSN_SIZE))
+
+#define IDX_DST_PANID_END(i) \
+    (IDX_ADDRESSING_START(i) + (IDX_DST_PANID_PRESENT(i) ? PAN_ID_SIZE : 0U))
+
+#define IDX_DST_ADDR_END(i)                                            \
+    ((MODE_SIZE(IDX_DST_MODE(i)) == INVALID_OFFSET) ? INVALID_OFFSET : \
+     (IDX_DST_PANID_END(i) + MODE_SIZE(IDX_DST_MODE(i))))
+
+#define IDX_SRC_PANID_END(i)                                    \
+    ((IDX_DST_ADDR_END(i) == INVALID_OFFSET) ? INVALID_OFFSET : \
+     (IDX_DST_ADDR_END(i) + (IDX_SRC_PANID_PRESENT(i) ? PAN_ID_SIZE : 0U)))
+
+#define IDX_SRC_ADDR_END(i)                                              \
+    (((IDX_SRC_PANID_END(i) == INVALID_OFFSET) ||                        \
+      (MODE_SIZE(IDX_SRC_MODE(i)) == INVALID_OFFSET)) ? INVALID_OFFSET : \
+     (IDX_SRC_PANID_END(i) + MODE_SIZE(IDX_SRC_MODE(i))))
+
+#define ADDR_OFFSETS_ENTRY(i)                                                             \
+    {                                                                                     \
+        .dst_panid_offset      = IDX_DST_PANID_PRESENT(i) ? IDX_ADDRESSING_START(i) : 0U, \
+        .dst_addr_offset       = IDX_DST_PRESENT(i) ? IDX_DST_PANID_END(i) : 0U,          \
+        .dst_addr_end_offset   = IDX_DST_ADDR_END(i),                                     \
+        .src_panid_offset      = IDX_SRC_PANID_PRESENT(i) ? IDX_DST_ADDR_END(i) :         \
+                                 IDX_DST_PANID_PRESENT(i) ? IDX_ADDRESSING_START(i) : 0U, \
+        .src_addr_offset       = IDX_SRC_PRESENT(i) ? IDX_SRC_PANID_END(i) : 0U,          \
+        .addressing_end_offset = IDX_SRC_ADDR_END(i),                                     \
+    }
+
+#define ADDR_OFFSETS_ENTRIES_4(i)                                                        \
+    ADDR_OFFSETS_ENTRY((i)), ADDR_OFFSETS_ENTRY((i) + 1U), ADDR_OFFSETS_ENTRY((i) + 2U), \
+    ADDR_OFFSETS_ENTRY((i) + 3U)
+#define ADDR_OFFSETS_ENTRIES_16(i)                                 \
+    ADDR_OFFSETS_ENTRIES_4((i)), ADDR_OFFSETS_ENTRIES_4((i) + 4U), \
+    ADDR_OFFSETS_ENTRIES_4((i) + 8U), ADDR_OFFSETS_ENTRIES_4((i) + 12U)
+#define ADDR_OFFSETS_ENTRIES_64(i)                                    \
+    ADDR_OFFSETS_ENTRIES_16((i)), ADDR_OFFSETS_ENTRIES_16((i) + 16U), \
+    ADDR_OFFSETS_ENTRIES_16((i) + 32U), ADDR_OFFSETS_ENTRIES_16((i) + 48U)
 
-static uint8_t addressing_offset_get(const uint8_t * p_frame)
+/**
+ * @brief Offsets of the addressing fields of a frame.
+ *
+ * A field that is not present in the frame has offset 0. If the frame uses a reserved
+ * addressing mode, all offsets that depend on the size of that address are
+ * @ref NRF_802154_FRAME_PARSER_INVALID_OFFSET.
+ */
+typedef struct
 {
-    if ((frame_version_get(p_frame) >= FRAME_VERSION_2) &&
-        nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_frame))
-    {
-        return PHR_SIZE + FCF_SIZE;
-    }
-    else
-    {
-        return PHR_SIZE + FCF_SIZE + DSN_SIZE;
-    }
-}
+    uint8_t dst_panid_offset;      ///< Offset of the destination PAN ID field.
+    uint8_t dst_addr_offset;       ///< Offset of the destination address field.
+    uint8_t dst_addr_end_offset;   ///< Offset of the first byte following the destination address.
+    uint8_t src_panid_offset;      ///< Offset of the source PAN ID field, possibly compressed.
+    uint8_t src_addr_offset;       ///< Offset of the source address field.
+    uint8_t addressing_end_offset; ///< Offset of the first byte following the addressing fields.
+} addr_offsets_t;
 
-static bool src_addr_is_present(const uint8_t * p_frame)
+/// Addressing field offsets for each combination of the FCF bits that define the MHR layout.
+static const addr_offsets_t m_addr_offsets[ADDR_OFFSETS_TABLE_SIZE] =
 {
-    return (p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK) != SRC_ADDR_TYPE_NONE;
-}
+    ADDR_OFFSETS_ENTRIES_64(0U),
+    ADDR_OFFSETS_ENTRIES_64(64U),
+};
 
-static bool dst_addr_is_present(const uint8_t * p_frame)
+/// Size of the address for each addressing mode.
+static const uint8_t m_addr_sizes[] =
 {
-    return (p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK) != DEST_ADDR_TYPE_NONE;
-}
+    [ADDR_MODE_NONE]     = 0U,
+    [ADDR_MODE_RESERVED] = INVALID_OFFSET,
+    [ADDR_MODE_SHORT]    = SHORT_ADDRESS_SIZE,
+    [ADDR_MODE_EXTENDED] = EXTENDED_ADDRESS_SIZE,
+};
 
-static uint8_t src_addr_size_get(const uint8_t * p_frame)
+/// Level to which the frame held in the parse cache has been parsed.
+typedef enum
 {
-    switch (p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK)
-    {
-        case SRC_ADDR_TYPE_NONE:
-            return 0;
-
-        case SRC_ADDR_TYPE_SHORT:
-            return SHORT_ADDRESS_SIZE;
-
-        case SRC_ADDR_TYPE_EXTENDED:
-            return EXTENDED_ADDRESS_SIZE;
+    PARSE_LEVEL_NONE,    ///< The cache does not hold any frame.
+    PARSE_LEVEL_INVALID, ///< Parsing of the MHR failed.
+    PARSE_LEVEL_MHR,     ///< The MHR has been parsed correctly.
+} parse_level_t;
 
-        default:
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-    }
-}
-
-static uint8_t dst_addr_size_get(const uint8_t * p_frame)
+/// Structure holding the result of the last MHR parse.
+typedef struct
 {
-    switch (p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK)
-    {
-        case DEST_ADDR_TYPE_NONE:
-            return 0;
+    const uint8_t                    * p_frame;       ///< Parsed frame.
+    uint8_t                            fcf[FCF_SIZE]; ///< Frame Control field of the parsed frame.
+    parse_level_t                      level;         ///< Parse level of @p mhr_data.
+    nrf_802154_frame_parser_mhr_data_t mhr_data;      ///< Result of the parse.
+} parse_cache_t;
 
-        case DEST_ADDR_TYPE_SHORT:
-            return SHORT_ADDRESS_SIZE;
+static parse_cache_t m_parse_cache;
 
-        case DEST_ADDR_TYPE_EXTENDED:
-            return EXTENDED_ADDRESS_SIZE;
+/***************************************************************************************************
+ * @section Helper functions
+ **************************************************************************************************/
 
-        default:
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-    }
-}
+// Addressing
 
-// PAN ID
-static bool dst_panid_is_present(const uint8_t * p_frame)
+/**
+ * @brief Gets the addressing offsets table entry matching the Frame Control field of a frame.
+ *
+ * The index is assembled from the FCF bits without any branches, so the offsets of all addressing
+ * fields are available after a single table lookup.
+ */
+static inline const addr_offsets_t * addr_offsets_get(const uint8_t * p_frame)
 {
-    bool panid_compression = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? true : false;
-
-    switch (frame_version_get(p_frame))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!dst_addr_is_present(p_frame))
-            {
-                return false;
-            }
+    uint32_t fcf_0 = p_frame[PAN_ID_COMPR_OFFSET];
+    uint32_t fcf_1 = p_frame[DEST_ADDR_TYPE_OFFSET];
+    uint32_t v2    = (fcf_1 & FRAME_VERSION_2) >> 5;
+    uint32_t idx;
 
-            return true;
+    idx  = ((fcf_0 & PAN_ID_COMPR_MASK) >> 6) << ADDR_IDX_PANID_COMPR_SHIFT;
+    idx |= ((fcf_1 & DEST_ADDR_TYPE_MASK) >> 2) << ADDR_IDX_DST_MODE_SHIFT;
+    idx |= ((fcf_1 & SRC_ADDR_TYPE_MASK) >> 6) << ADDR_IDX_SRC_MODE_SHIFT;
+    idx |= v2 << ADDR_IDX_VERSION_2_SHIFT;
+    idx |= ((fcf_1 & DSN_SUPPRESS_BIT) & v2) << ADDR_IDX_DSN_SUPPRESS_SHIFT;
 
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_frame) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_frame) && dst_addr_is_present(p_frame))
-            {
-                return true;
-            }
-
-            if (src_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            if (dst_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            return panid_compression ? true : false;
-    }
+    return &m_addr_offsets[idx];
 }
 
-static bool src_panid_is_present(const uint8_t * p_frame)
+static uint8_t src_addr_size_get(const uint8_t * p_frame)
 {
-    bool panid_compression = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? true : false;
-
-    switch (frame_version_get(p_frame))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!src_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            return panid_compression ? false : true;
-
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_frame) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_frame))
-            {
-                return false;
-            }
-
-            if (src_addr_is_present(p_frame) && dst_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (dst_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            return false;
-    }
+    return m_addr_sizes[(p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK) >> 6];
 }
 
-static bool src_panid_is_compressed(const uint8_t * p_frame)
+static uint8_t dst_addr_size_get(const uint8_t * p_frame)
 {
-    return dst_panid_is_present(p_frame) && !src_panid_is_present(p_frame);
+    return m_addr_sizes[(p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK) >> 2];
 }
 
 // Security
@@ -214,49 +241,7 @@ static bool security_is_enabled(const uint8_t * p_frame)
 
 static uint8_t security_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-    uint8_t src_addr_offset  = nrf_802154_frame_parser_src_addr_offset_get(p_frame);
-    uint8_t src_panid_offset = nrf_802154_frame_parser_src_panid_offset_get(p_frame);
-    uint8_t src_addr_size    = src_addr_size_get(p_frame);
-
-    if (src_addr_is_present(p_frame))
-    {
-        if ((src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
-            (src_addr_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return src_addr_offset + src_addr_size;
-    }
-    else if (src_panid_is_present(p_frame))
-    {
-        if (src_panid_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return src_panid_offset + PAN_ID_SIZE;
-    }
-    else if (dst_addr_offset)
-    {
-        if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return dst_addr_offset + dst_addr_size;
-    }
-    else if (dst_panid_offset)
-    {
-        return dst_panid_offset + PAN_ID_SIZE;
-    }
-    else
-    {
-        return addressing_offset_get(p_frame);
-    }
+    return addr_offsets_get(p_frame)->addressing_end_offset;
 }
 
 static uint8_t key_id_size_get(const uint8_t * p_frame)
@@ -344,127 +329,27 @@ bool nrf_802154_frame_parser_ar_bit_is_set(const uint8_t * p_frame)
 
 uint8_t nrf_802154_frame_parser_dst_panid_offset_get(const uint8_t * p_frame)
 {
-    if (dst_panid_is_present(p_frame))
-    {
-        return addressing_offset_get(p_frame);
-    }
-    else
-    {
-        return 0;
-    }
+    return addr_offsets_get(p_frame)->dst_panid_offset;
 }
 
 uint8_t nrf_802154_frame_parser_dst_addr_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-
-    if (dst_addr_is_present(p_frame))
-    {
-        return 0 ==
-               dst_panid_offset ? addressing_offset_get(p_frame) : dst_panid_offset + PAN_ID_SIZE;
-    }
-    else
-    {
-        return 0;
-    }
+    return addr_offsets_get(p_frame)->dst_addr_offset;
 }
 
 uint8_t nrf_802154_frame_parser_dst_addr_end_offset_get(const uint8_t * p_frame)
 {
-    uint8_t offset        = addressing_offset_get(p_frame);
-    uint8_t dst_addr_size = dst_addr_size_get(p_frame);
-
-    if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-    {
-        return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-    }
-
-    if (dst_panid_is_present(p_frame))
-    {
-        offset += PAN_ID_SIZE;
-    }
-
-    offset += dst_addr_size;
-
-    return offset;
+    return addr_offsets_get(p_frame)->dst_addr_end_offset;
 }
 
 uint8_t nrf_802154_frame_parser_src_panid_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-
-    if (src_panid_is_present(p_frame))
-    {
-        if (dst_addr_offset)
-        {
-            if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return dst_addr_offset + dst_addr_size;
-        }
-        else if (dst_panid_offset)
-        {
-            return dst_panid_offset + PAN_ID_SIZE;
-        }
-        else
-        {
-            return addressing_offset_get(p_frame);
-        }
-    }
-    else if (src_panid_is_compressed(p_frame))
-    {
-        return nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    }
-    else
-    {
-        return 0;
-    }
+    return addr_offsets_get(p_frame)->src_panid_offset;
 }
 
 uint8_t nrf_802154_frame_parser_src_addr_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-    uint8_t src_panid_offset = nrf_802154_frame_parser_src_panid_offset_get(p_frame);
-
-    if (src_addr_is_present(p_frame))
-    {
-        if (src_panid_is_present(p_frame))
-        {
-            if (src_panid_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return src_panid_offset + PAN_ID_SIZE;
-        }
-        else if (dst_addr_offset)
-        {
-            if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return dst_addr_offset + dst_addr_size;
-        }
-        else if (dst_panid_offset)
-        {
-            return dst_panid_offset + PAN_ID_SIZE;
-        }
-        else
-        {
-            return addressing_offset_get(p_frame);
-        }
-    }
-    else
-    {
-        return 0;
-    }
+    return addr_offsets_get(p_frame)->src_addr_offset;
 }
 
 uint8_t nrf_802154_frame_parser_addressing_end_offset_get(const uint8_t * p_frame)
@@ -577,81 +462,57 @@ const uint8_t * nrf_802154_frame_parser_src_addr_get(const uint8_t * p_frame,
 bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_frame,
                                        nrf_802154_frame_parser_mhr_data_t * p_fields)
 {
-    uint8_t offset               = addressing_offset_get(p_frame);
-    bool    is_dst_panid_present = dst_panid_is_present(p_frame);
-    bool    is_src_panid_present = src_panid_is_present(p_frame);
+    const addr_offsets_t * p_offsets = addr_offsets_get(p_frame);
 
-    if (is_dst_panid_present)
+    if (p_offsets->addressing_end_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
     {
-        p_fields->p_dst_panid = &p_frame[offset];
-        offset               += PAN_ID_SIZE;
-    }
-    else
-    {
-        p_fields->p_dst_panid = NULL;
+        return false;
     }
 
-    if (dst_addr_is_present(p_frame))
-    {
-        p_fields->p_dst_addr    = &p_frame[offset];
-        p_fields->dst_addr_size = dst_addr_size_get(p_frame);
-        offset                 += (p_fields->dst_addr_size);
+    p_fields->p_dst_panid = (p_offsets->dst_panid_offset != 0) ?
+                            &p_frame[p_offsets->dst_panid_offset] : NULL;
+    p_fields->p_dst_addr  = (p_offsets->dst_addr_offset != 0) ?
+                            &p_frame[p_offsets->dst_addr_offset] : NULL;
+    p_fields->p_src_panid = (p_offsets->src_panid_offset != 0) ?
+                            &p_frame[p_offsets->src_panid_offset] : NULL;
+    p_fields->p_src_addr  = (p_offsets->src_addr_offset != 0) ?
+                            &p_frame[p_offsets->src_addr_offset] : NULL;
 
-        if (p_fields->dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        p_fields->p_dst_addr    = NULL;
-        p_fields->dst_addr_size = 0;
-    }
+    p_fields->dst_addr_size         = dst_addr_size_get(p_frame);
+    p_fields->src_addr_size         = src_addr_size_get(p_frame);
+    p_fields->addressing_end_offset = p_offsets->addressing_end_offset;
 
-    if (is_src_panid_present)
-    {
-        p_fields->p_src_panid = &p_frame[offset];
-        offset               += PAN_ID_SIZE;
-    }
-    else if (is_dst_panid_present)
+    if (security_is_enabled(p_frame))
     {
-        p_fields->p_src_panid = p_fields->p_dst_panid;
+        p_fields->p_sec_ctrl = &p_frame[p_offsets->addressing_end_offset];
+        // TODO increment offset...
     }
     else
     {
-        p_fields->p_src_panid = NULL;
+        p_fields->p_sec_ctrl = NULL;
     }
 
-    if (src_addr_is_present(p_frame))
-    {
-        p_fields->p_src_addr    = &p_frame[offset];
-        p_fields->src_addr_size = src_addr_size_get(p_frame);
-        offset                 += (p_fields->src_addr_size);
-
-        if (p_fields->src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        p_fields->p_src_addr    = NULL;
-        p_fields->src_addr_size = 0;
-    }
+    return true;
+}
 
-    p_fields->addressing_end_offset = offset;
+const nrf_802154_frame_parser_mhr_data_t * nrf_802154_frame_parser_mhr_parse_cached(
+    const uint8_t * p_frame)
+{
+    parse_cache_t * p_cache = &m_parse_cache;
 
-    if (security_is_enabled(p_frame))
+    if ((p_cache->level == PARSE_LEVEL_NONE) ||
+        (p_cache->p_frame != p_frame) ||
+        (p_cache->fcf[0] != p_frame[PHR_SIZE]) ||
+        (p_cache->fcf[1] != p_frame[PHR_SIZE + 1]))
     {
-        p_fields->p_sec_ctrl = &p_frame[offset];
-        // TODO increment offset...
-    }
-    else
-    {
-        p_fields->p_sec_ctrl = NULL;
+        p_cache->p_frame = p_frame;
+        p_cache->fcf[0]  = p_frame[PHR_SIZE];
+        p_cache->fcf[1]  = p_frame[PHR_SIZE + 1];
+        p_cache->level   = nrf_802154_frame_parser_mhr_parse(p_frame, &p_cache->mhr_data) ?
+                           PARSE_LEVEL_MHR : PARSE_LEVEL_INVALID;
     }
 
-    return true;
+    return (p_cache->level == PARSE_LEVEL_MHR) ? &p_cache->mhr_data : NULL;
 }
 
 const uint8_t * nrf_802154_frame_parser_sec_ctrl_get(const uint8_t * p_frame)
@@ -681,3 +542,50 @@ const uint8_t * nrf_802154_frame_parser_ie_header_get(const uint8_t * p_frame)
 
     return &p_frame[ie_header_offset];
 }
+
+bool nrf_802154_frame_parser_data_request_is(const uint8_t                            * p_frame,
+                                             const nrf_802154_frame_parser_mhr_data_t * p_mhr_data)
+{
+    uint8_t cmd_offset = p_mhr_data->addressing_end_offset;
+
+    if ((p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_COMMAND)
+    {
+        return false;
+    }
+
+    if (p_frame[IE_PRESENT_OFFSET] & IE_PRESENT_BIT)
+    {
+        return false;
+    }
+
+    if (p_mhr_data->p_sec_ctrl != NULL)
+    {
+        // The Command Frame Identifier follows the auxiliary security header and is not encrypted.
+        cmd_offset = nrf_802154_frame_parser_key_id_offset_get(p_frame);
+
+        switch (*p_mhr_data->p_sec_ctrl & KEY_ID_MODE_MASK)
+        {
+            case KEY_ID_MODE_1:
+                cmd_offset += KEY_ID_MODE_1_SIZE;
+                break;
+
+            case KEY_ID_MODE_2:
+                cmd_offset += KEY_ID_MODE_2_SIZE;
+                break;
+
+            case KEY_ID_MODE_3:
+                cmd_offset += KEY_ID_MODE_3_SIZE;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (cmd_offset >= (p_frame[PHR_OFFSET] + PHR_SIZE - FCS_SIZE))
+    {
+        return false;
+    }
+
+    return p_frame[cmd_offset] == MAC_CMD_DATA_REQ;
+}
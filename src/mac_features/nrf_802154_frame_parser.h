@@ -207,6 +207,25 @@ uint8_t nrf_802154_frame_parser_src_panid_offset_get(const uint8_t * p_frame);
 bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_frame,
                                        nrf_802154_frame_parser_mhr_data_t * p_fields);
 
+/**
+ * @brief Gets the pointers and the details of MHR parts of a given frame, reusing the last result.
+ *
+ * The MHR layout depends only on the Frame Control field. The result of the last parse is kept
+ * together with the frame pointer and its Frame Control field, so consumers processing the same
+ * received frame parse its MHR only once.
+ *
+ * @note This function is intended for the frame reception path. It must not be called from
+ *       contexts that can preempt each other.
+ *
+ * @param[in]  p_frame   Pointer to a frame to parse.
+ *
+ * @returns  Pointer to the structure with the details of the parsed frame, valid until
+ *           this function is called for another frame.
+ * @returns  NULL if there is a parse error.
+ */
+const nrf_802154_frame_parser_mhr_data_t * nrf_802154_frame_parser_mhr_parse_cached(
+    const uint8_t * p_frame);
+
 /**
  * @brief Gets the security control field in the provided frame.
  *
@@ -315,4 +334,19 @@ const uint8_t * nrf_802154_frame_parser_ie_header_get(const uint8_t * p_frame);
  */
 uint8_t nrf_802154_frame_parser_ie_header_offset_get(const uint8_t * p_frame);
 
+/**
+ * @brief Checks if the provided frame is a Data Request command.
+ *
+ * Secured commands are recognized as long as they contain no header IEs.
+ *
+ * @param[in]   p_frame     Pointer to a frame.
+ * @param[in]   p_mhr_data  Pointer to the parsed MHR of @p p_frame.
+ *
+ * @retval  true   The frame is a Data Request command.
+ * @retval  false  The frame is not a Data Request command.
+ *
+ */
+bool nrf_802154_frame_parser_data_request_is(const uint8_t                            * p_frame,
+                                             const nrf_802154_frame_parser_mhr_data_t * p_mhr_data);
+
 #endif // NRF_802154_FRAME_PARSER_H
@@ -41,10 +41,12 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "nrf_802154_core_hooks.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "timer/nrf_802154_timer_sched.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
 
 #if NRF_802154_IFS_ENABLED
 typedef struct
@@ -65,6 +67,12 @@ static uint8_t            m_last_frame_length;        ///< Length in bytes of th
 static ifs_operation_t    m_context;                  ///< Context passed to the timer.
 static nrf_802154_timer_t m_timer;                    ///< Interframe space timer.
 
+#if NRF_802154_IFS_HW_TIMED_ENABLED
+static uint32_t        m_last_frame_hp_timestamp;     ///< High precision timestamp of the last transmitted frame (end of frame).
+static const uint8_t * mp_hw_timed_frame;             ///< Frame that is to be transmitted at @ref m_hw_timed_ifs_end.
+static uint32_t        m_hw_timed_ifs_end;            ///< High precision time at which the needed IFS ends.
+#endif
+
 static void ifs_tx_result_notify(bool result)
 {
     if (!result)
@@ -77,12 +85,15 @@ static void callback_fired(void * p_context)
 {
     ifs_operation_t * p_ctx = (ifs_operation_t *)p_context;
 
+    nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_IFS);
+
     nrf_802154_request_transmit(NRF_802154_TERM_NONE,
                                 REQ_ORIG_IFS,
                                 p_ctx->p_data,
                                 p_ctx->cca,
                                 true,
-                                ifs_tx_result_notify);
+                                ifs_tx_result_notify,
+                                NULL);
 }
 
 /**@brief Checks if the IFS is needed by comparing the addresses of the actual and the last frames. */
@@ -144,6 +155,26 @@ static uint16_t ifs_needed_by_time(uint32_t current_timestamp)
     return ifs_period;
 }
 
+#if NRF_802154_IFS_HW_TIMED_ENABLED
+/**@brief Checks if the high precision timestamp of the last frame can be used to time the IFS.
+ *
+ * The high precision timer is not guaranteed to run continuously between frames (e.g. when the
+ * timeslot was interrupted). Its measurement is trusted only if it matches the time elapsed
+ * according to the timer scheduler.
+ */
+static bool hw_timed_path_is_available(uint32_t current_timestamp)
+{
+    uint32_t hp_elapsed = nrf_802154_hp_timer_current_time_get() - m_last_frame_hp_timestamp;
+    uint32_t lp_elapsed = current_timestamp - m_last_frame_timestamp;
+    uint32_t tolerance  = 2U * nrf_802154_timer_sched_granularity_get();
+    uint32_t diff       = (hp_elapsed > lp_elapsed) ? (hp_elapsed - lp_elapsed) :
+                          (lp_elapsed - hp_elapsed);
+
+    return diff <= tolerance;
+}
+
+#endif
+
 bool nrf_802154_ifs_pretransmission(const uint8_t * p_frame, bool cca)
 {
     nrf_802154_ifs_mode_t mode = nrf_802154_pib_ifs_mode_get();
@@ -173,6 +204,17 @@ bool nrf_802154_ifs_pretransmission(const uint8_t * p_frame, bool cca)
         return true;
     }
 
+#if NRF_802154_IFS_HW_TIMED_ENABLED
+    if (!cca && hw_timed_path_is_available(current_timestamp))
+    {
+        // Let the core module start the transmission exactly at the end of the IFS.
+        mp_hw_timed_frame  = p_frame;
+        m_hw_timed_ifs_end = m_last_frame_hp_timestamp + dt;
+
+        return true;
+    }
+#endif
+
     m_context.p_data  = (uint8_t *)p_frame;
     m_context.cca     = cca;
     m_timer.t0        = m_last_frame_timestamp;
@@ -180,6 +222,7 @@ bool nrf_802154_ifs_pretransmission(const uint8_t * p_frame, bool cca)
     m_timer.callback  = callback_fired;
     m_timer.p_context = &m_context;
 
+    nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_IFS);
     nrf_802154_timer_sched_add(&m_timer, true);
 
     return false;
@@ -191,6 +234,11 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
 
     m_last_frame_timestamp = nrf_802154_timer_sched_time_get();
 
+#if NRF_802154_IFS_HW_TIMED_ENABLED
+    m_last_frame_hp_timestamp = nrf_802154_hp_timer_current_time_get();
+    mp_hw_timed_frame         = NULL;
+#endif
+
     const uint8_t * addr =
         nrf_802154_frame_parser_dst_addr_get(p_frame, &m_is_last_address_extended);
 
@@ -213,6 +261,35 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
     m_last_frame_length = p_frame[0];
 }
 
+#if NRF_802154_IFS_HW_TIMED_ENABLED
+bool nrf_802154_ifs_tx_delay_peek(const uint8_t * p_frame, uint32_t * p_delay_us)
+{
+    if ((p_frame == NULL) || (p_frame != mp_hw_timed_frame))
+    {
+        return false;
+    }
+
+    int32_t remaining = (int32_t)(m_hw_timed_ifs_end - nrf_802154_hp_timer_current_time_get());
+
+    *p_delay_us = (remaining > 0) ? (uint32_t)remaining : 0U;
+
+    return true;
+}
+
+bool nrf_802154_ifs_tx_delay_get(const uint8_t * p_frame, uint32_t * p_delay_us)
+{
+    bool result = nrf_802154_ifs_tx_delay_peek(p_frame, p_delay_us);
+
+    if (result)
+    {
+        mp_hw_timed_frame = NULL;
+    }
+
+    return result;
+}
+
+#endif
+
 bool nrf_802154_ifs_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
 {
     bool result = true;
@@ -229,6 +306,8 @@ bool nrf_802154_ifs_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
             nrf_802154_timer_sched_remove(&m_timer, &was_running);
             if (was_running)
             {
+                nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_IFS);
+
                 ifs_operation_t * p_op = (ifs_operation_t *)m_timer.p_context;
 
                 nrf_802154_notify_transmit_failed(p_op->p_data, NRF_802154_TX_ERROR_ABORTED);
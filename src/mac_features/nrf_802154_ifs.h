@@ -35,6 +35,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_types.h"
 
@@ -57,6 +58,37 @@ bool nrf_802154_ifs_pretransmission(const uint8_t * p_frame, bool cca);
  */
 void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame);
 
+#if NRF_802154_IFS_HW_TIMED_ENABLED
+
+/**
+ * @brief Gets the time remaining to the end of the IFS before the given frame is transmitted.
+ *
+ * If @ref nrf_802154_ifs_pretransmission allowed the frame to be processed right away while
+ * the IFS was still needed, the transmission must be started with the delay returned by this
+ * function. The delay is consumed, so subsequent calls for the same frame return false.
+ *
+ * @param[in]  p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[out] p_delay_us  Time in microseconds from now to the end of the IFS.
+ *
+ * @retval  true   The frame must be transmitted after @p p_delay_us.
+ * @retval  false  The frame can be transmitted right away.
+ */
+bool nrf_802154_ifs_tx_delay_get(const uint8_t * p_frame, uint32_t * p_delay_us);
+
+/**
+ * @brief Gets the time remaining to the end of the IFS like @ref nrf_802154_ifs_tx_delay_get,
+ *        without consuming the delay.
+ *
+ * @param[in]  p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[out] p_delay_us  Time in microseconds from now to the end of the IFS.
+ *
+ * @retval  true   The frame is to be transmitted after @p p_delay_us.
+ * @retval  false  The frame can be transmitted right away.
+ */
+bool nrf_802154_ifs_tx_delay_peek(const uint8_t * p_frame, uint32_t * p_delay_us);
+
+#endif // NRF_802154_IFS_HW_TIMED_ENABLED
+
 /**
  * @brief Aborts an ongoing IFS-delayed transmission.
  *
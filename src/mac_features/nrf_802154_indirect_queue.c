@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the queue of frames waiting for a Data Request from their destination.
+ *
+ */
+
+#include "nrf_802154_indirect_queue.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mac_features/ack_generator/nrf_802154_ack_data.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_frame_parser.h"
+#include "nrf_802154_types.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_INDIRECT_QUEUE_SIZE > 0
+
+#if NRF_802154_INDIRECT_QUEUE_SIZE >= UINT8_MAX
+#error NRF_802154_INDIRECT_QUEUE_SIZE is too big.
+#endif
+
+/// Frame waiting in the indirect transmission queue.
+typedef struct
+{
+    const uint8_t * p_data;                      ///< Pointer to the PHR and PSDU of the frame.
+    uint8_t         addr[EXTENDED_ADDRESS_SIZE]; ///< Destination address of the frame.
+    bool            extended;                    ///< If @p addr is an extended address.
+} indirect_queue_item_t;
+
+/** Frames waiting in the queue, the oldest first. */
+static indirect_queue_item_t m_items[NRF_802154_INDIRECT_QUEUE_SIZE];
+
+/** Number of frames waiting in the queue. */
+static uint8_t m_count;
+
+/** Check if any frame in the queue is destined to the given address. */
+static bool addr_is_queued(const uint8_t * p_addr, bool extended)
+{
+    uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    for (uint8_t i = 0; i < m_count; i++)
+    {
+        if ((m_items[i].extended == extended) && (0 == memcmp(m_items[i].addr, p_addr, addr_size)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Remove the item at the given position. Must be called from a critical section.
+ *
+ * The pending bit of the destination is cleared when no other frame is queued for it.
+ */
+static void item_remove(uint8_t idx)
+{
+    indirect_queue_item_t item = m_items[idx];
+
+    m_count--;
+    memmove(&m_items[idx], &m_items[idx + 1], (m_count - idx) * sizeof(m_items[0]));
+
+    if (!addr_is_queued(item.addr, item.extended))
+    {
+        (void)nrf_802154_ack_data_for_addr_clear(item.addr,
+                                                 item.extended,
+                                                 NRF_802154_ACK_DATA_PENDING_BIT);
+    }
+}
+
+void nrf_802154_indirect_queue_init(void)
+{
+    m_count = 0;
+}
+
+bool nrf_802154_indirect_queue_push(const uint8_t * p_data)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+    bool                               result = false;
+    nrf_802154_mcu_critical_state_t    mcu_cs;
+
+    if (!nrf_802154_frame_parser_mhr_parse(p_data, &mhr) || (mhr.p_dst_addr == NULL))
+    {
+        return false;
+    }
+
+    if ((mhr.dst_addr_size == SHORT_ADDRESS_SIZE) &&
+        (0 == memcmp(mhr.p_dst_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE)))
+    {
+        return false;
+    }
+
+    bool extended = (mhr.dst_addr_size == EXTENDED_ADDRESS_SIZE);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if ((m_count < NRF_802154_INDIRECT_QUEUE_SIZE) &&
+        nrf_802154_ack_data_for_addr_set(mhr.p_dst_addr,
+                                         extended,
+                                         NRF_802154_ACK_DATA_PENDING_BIT,
+                                         NULL,
+                                         0))
+    {
+        indirect_queue_item_t * p_item = &m_items[m_count];
+
+        p_item->p_data   = p_data;
+        p_item->extended = extended;
+        memcpy(p_item->addr, mhr.p_dst_addr, mhr.dst_addr_size);
+
+        m_count++;
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_indirect_queue_remove(const uint8_t * p_data)
+{
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint8_t i = 0; i < m_count; i++)
+    {
+        if (m_items[i].p_data == p_data)
+        {
+            item_remove(i);
+            result = true;
+            break;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+const uint8_t * nrf_802154_indirect_queue_data_request_pop(const uint8_t * p_data_request)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+    const uint8_t                    * p_data = NULL;
+    nrf_802154_mcu_critical_state_t    mcu_cs;
+
+    if ((m_count == 0) ||
+        !nrf_802154_frame_parser_mhr_parse(p_data_request, &mhr) ||
+        (mhr.p_src_addr == NULL) ||
+        !nrf_802154_frame_parser_data_request_is(p_data_request, &mhr))
+    {
+        return NULL;
+    }
+
+    bool extended = (mhr.src_addr_size == EXTENDED_ADDRESS_SIZE);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint8_t i = 0; i < m_count; i++)
+    {
+        if ((m_items[i].extended == extended) &&
+            (0 == memcmp(m_items[i].addr, mhr.p_src_addr, mhr.src_addr_size)))
+        {
+            p_data = m_items[i].p_data;
+            item_remove(i);
+            break;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return p_data;
+}
+
+#endif // NRF_802154_INDIRECT_QUEUE_SIZE > 0
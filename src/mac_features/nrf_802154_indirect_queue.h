@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file contains the declarations of the queue of frames for indirect transmission.
+ *
+ * @defgroup nrf_802154_indirect_queue Indirect transmission queue
+ * @{
+ * @ingroup nrf_802154
+ * @brief Queue of frames waiting for a Data Request from their destination.
+ *
+ * The destination address of each queued frame is added to the pending bit list, so the ACK to
+ * a Data Request from that address has the Frame Pending bit set. Right after such an ACK is
+ * transmitted, the core takes the oldest frame queued for the requesting node and transmits it.
+ */
+
+#ifndef NRF_802154_INDIRECT_QUEUE_H_
+#define NRF_802154_INDIRECT_QUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_INDIRECT_QUEUE_SIZE > 0
+
+/**
+ * @brief Initializes the indirect transmission queue.
+ */
+void nrf_802154_indirect_queue_init(void);
+
+/**
+ * @brief Adds a frame to the indirect transmission queue.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full, the pending bit list is full, or the frame has no
+ *                 destination address.
+ */
+bool nrf_802154_indirect_queue_push(const uint8_t * p_data);
+
+/**
+ * @brief Removes the given frame from the indirect transmission queue.
+ *
+ * @param[in]  p_data  Pointer to a frame previously added with @ref nrf_802154_indirect_queue_push.
+ *
+ * @retval  true   The frame was removed from the queue.
+ * @retval  false  The frame is not in the queue.
+ */
+bool nrf_802154_indirect_queue_remove(const uint8_t * p_data);
+
+/**
+ * @brief Takes the oldest frame queued for the source of the given Data Request.
+ *
+ * @param[in]  p_data_request  Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *
+ * @returns  Pointer to the frame removed from the queue, or NULL if @p p_data_request is not
+ *           a Data Request or no frame is queued for its source.
+ */
+const uint8_t * nrf_802154_indirect_queue_data_request_pop(const uint8_t * p_data_request);
+
+#endif // NRF_802154_INDIRECT_QUEUE_SIZE > 0
+
+#endif // NRF_802154_INDIRECT_QUEUE_H_
+
+/** @} */
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the link metrics of Enh-Ack based probing for the 802.15.4 driver.
+ *
+ * The RSSI and LQI of the frames received from each initiator are kept in fixed point, scaled by
+ * 2^NRF_802154_LINK_METRICS_EWMA_SHIFT. They are converted to the Thread representation only when
+ * an Enh-Ack is written, so the RX path stays short.
+ *
+ */
+
+#include "nrf_802154_link_metrics.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_LINK_METRICS_ENABLED
+
+/// Scale of the fixed point averages.
+#define EWMA_ONE (1L << NRF_802154_LINK_METRICS_EWMA_SHIFT)
+
+#define IE_HDR_SIZE               2        ///< Size of the header IE descriptor.
+#define IE_HDR_LENGTH_MASK        0x7f     ///< Mask of the content length in the header IE descriptor.
+#define IE_HDR_ELEMENT_ID_POS     7        ///< Position of the element ID in the header IE descriptor.
+#define IE_HDR_ELEMENT_ID_MASK    0xff     ///< Mask of the element ID after shifting.
+#define IE_VENDOR_SPECIFIC_ID     0x00     ///< Element ID of the vendor-specific header IE.
+#define THREAD_OUI                0xeab89b ///< OUI of the Thread Group.
+#define THREAD_OUI_SIZE           3        ///< Size of the OUI in the vendor-specific header IE.
+#define THREAD_IE_SUBTYPE_SIZE    1        ///< Size of the Thread vendor-specific IE subtype.
+#define THREAD_IE_ENH_ACK_PROBING 0x00     ///< Subtype of the Thread IE for Enh-Ack based probing.
+
+#define RSSI_MIN                  (-130)   ///< RSSI represented as 0 in the link metrics.
+#define RSSI_RANGE                130      ///< Range of RSSI represented as 0-255 in the link metrics.
+#define METRIC_MAX                255      ///< Maximum value of a scaled metric.
+
+/// Link metrics of an initiator.
+typedef struct
+{
+    uint8_t                   addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the initiator.
+    uint8_t                   addr_size;                   ///< Size of the address, 0 if entry is empty.
+    nrf_802154_link_metrics_t metrics;                     ///< Metrics to write into Enh-Acks.
+    bool                      measured;                    ///< If the averages are initialized.
+    int32_t                   rssi;                        ///< Average RSSI, scaled by @ref EWMA_ONE.
+    int32_t                   lqi;                         ///< Average LQI, scaled by @ref EWMA_ONE.
+} link_metrics_entry_t;
+
+static link_metrics_entry_t m_entries[NRF_802154_LINK_METRICS_INITIATORS]; ///< Initiators.
+
+/** Add a sample to a fixed point average, or initialize it with the first sample. */
+static int32_t ewma_update(int32_t average, int32_t sample, bool initialized)
+{
+    if (!initialized)
+    {
+        return sample * EWMA_ONE;
+    }
+
+    return average + sample - (average / EWMA_ONE);
+}
+
+/**
+ * @brief Find the entry of an initiator.
+ *
+ * @param[in]  p_addr     Pointer to the address of the initiator.
+ * @param[in]  addr_size  Size of the address.
+ *
+ * @returns  Pointer to the entry of the initiator, or NULL if it is not configured.
+ */
+static link_metrics_entry_t * entry_find(const uint8_t * p_addr, uint8_t addr_size)
+{
+    for (uint32_t i = 0; i < NRF_802154_LINK_METRICS_INITIATORS; i++)
+    {
+        link_metrics_entry_t * p_entry = &m_entries[i];
+
+        if ((p_entry->addr_size == addr_size) &&
+            (0 == memcmp(p_entry->addr, p_addr, addr_size)))
+        {
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+/** Find the entry of the initiator that sent the given frame. */
+static link_metrics_entry_t * entry_for_frame_find(const uint8_t * p_frame)
+{
+    const uint8_t * p_src_addr;
+    bool            src_addr_extended;
+
+    p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &src_addr_extended);
+
+    if (p_src_addr == NULL)
+    {
+        return NULL;
+    }
+
+    return entry_find(p_src_addr, src_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+}
+
+/** Scale RSSI in dBm above @p floor to the 0-255 representation of the link metrics. */
+static uint8_t rssi_scale(int32_t rssi, int32_t floor)
+{
+    int32_t value = rssi - floor;
+
+    if (value <= 0)
+    {
+        return 0U;
+    }
+
+    if (value >= RSSI_RANGE)
+    {
+        return METRIC_MAX;
+    }
+
+    return (uint8_t)((value * METRIC_MAX) / RSSI_RANGE);
+}
+
+/**
+ * @brief Find the values of the Thread IE for Enh-Ack based probing in the IE data.
+ *
+ * @param[in]  p_ie          Pointer to the IE data.
+ * @param[in]  ie_len        Length of the IE data.
+ * @param[out] p_values_len  Number of the values in the IE.
+ *
+ * @returns  Pointer to the first value, or NULL if the IE is not found.
+ */
+static uint8_t * probing_values_find(uint8_t * p_ie, uint8_t ie_len, uint8_t * p_values_len)
+{
+    const uint8_t header_len = THREAD_OUI_SIZE + THREAD_IE_SUBTYPE_SIZE;
+    uint32_t      offset     = 0;
+
+    while (offset + IE_HDR_SIZE <= ie_len)
+    {
+        uint16_t  descriptor = (uint16_t)(p_ie[offset] | (p_ie[offset + 1] << 8));
+        uint8_t   length     = descriptor & IE_HDR_LENGTH_MASK;
+        uint8_t   element_id = (descriptor >> IE_HDR_ELEMENT_ID_POS) & IE_HDR_ELEMENT_ID_MASK;
+        uint8_t * p_content  = &p_ie[offset + IE_HDR_SIZE];
+
+        if (offset + IE_HDR_SIZE + length > ie_len)
+        {
+            break;
+        }
+
+        if ((element_id == IE_VENDOR_SPECIFIC_ID) &&
+            (length > header_len) &&
+            (p_content[0] == (uint8_t)THREAD_OUI) &&
+            (p_content[1] == (uint8_t)(THREAD_OUI >> 8)) &&
+            (p_content[2] == (uint8_t)(THREAD_OUI >> 16)) &&
+            (p_content[THREAD_OUI_SIZE] == THREAD_IE_ENH_ACK_PROBING))
+        {
+            *p_values_len = length - header_len;
+            return &p_content[header_len];
+        }
+
+        offset += IE_HDR_SIZE + length;
+    }
+
+    return NULL;
+}
+
+void nrf_802154_link_metrics_init(void)
+{
+    memset(m_entries, 0, sizeof(m_entries));
+}
+
+bool nrf_802154_link_metrics_initiator_set(const uint8_t           * p_addr,
+                                           bool                      extended,
+                                           nrf_802154_link_metrics_t metrics)
+{
+    uint8_t                         addr_size = extended ? EXTENDED_ADDRESS_SIZE :
+                                                SHORT_ADDRESS_SIZE;
+    link_metrics_entry_t          * p_entry;
+    bool                            result = true;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    // The entries are read from the RADIO IRQ handler, they must be modified atomically.
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = entry_find(p_addr, addr_size);
+
+    if (metrics == 0U)
+    {
+        if (p_entry != NULL)
+        {
+            memset(p_entry, 0, sizeof(*p_entry));
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; (p_entry == NULL) && (i < NRF_802154_LINK_METRICS_INITIATORS); i++)
+        {
+            if (m_entries[i].addr_size == 0U)
+            {
+                p_entry = &m_entries[i];
+            }
+        }
+
+        if (p_entry != NULL)
+        {
+            memset(p_entry, 0, sizeof(*p_entry));
+            memcpy(p_entry->addr, p_addr, addr_size);
+            p_entry->addr_size = addr_size;
+            p_entry->metrics   = metrics;
+        }
+        else
+        {
+            result = false;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void nrf_802154_link_metrics_initiators_clear(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    nrf_802154_link_metrics_init();
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_link_metrics_frame_received(const uint8_t                  * p_frame,
+                                            const nrf_802154_rx_metadata_t * p_metadata)
+{
+    link_metrics_entry_t * p_entry = entry_for_frame_find(p_frame);
+
+    if (p_entry == NULL)
+    {
+        return;
+    }
+
+    p_entry->rssi     = ewma_update(p_entry->rssi, p_metadata->power, p_entry->measured);
+    p_entry->lqi      = ewma_update(p_entry->lqi, p_metadata->lqi, p_entry->measured);
+    p_entry->measured = true;
+}
+
+void nrf_802154_link_metrics_ie_write(const uint8_t * p_frame, uint8_t * p_ie, uint8_t ie_len)
+{
+    const link_metrics_entry_t * p_entry = entry_for_frame_find(p_frame);
+    uint8_t                    * p_values;
+    uint8_t                      values_len;
+    uint8_t                      count = 0;
+    int32_t                      rssi;
+
+    if ((p_entry == NULL) || !p_entry->measured)
+    {
+        return;
+    }
+
+    p_values = probing_values_find(p_ie, ie_len, &values_len);
+
+    if (p_values == NULL)
+    {
+        return;
+    }
+
+    rssi = p_entry->rssi / EWMA_ONE;
+
+    if (((p_entry->metrics & NRF_802154_LINK_METRICS_LQI) != 0U) && (count < values_len))
+    {
+        p_values[count++] = (uint8_t)(p_entry->lqi / EWMA_ONE);
+    }
+
+    if (((p_entry->metrics & NRF_802154_LINK_METRICS_LINK_MARGIN) != 0U) && (count < values_len))
+    {
+        p_values[count++] = rssi_scale(rssi, NRF_802154_LINK_METRICS_NOISE_FLOOR);
+    }
+
+    if (((p_entry->metrics & NRF_802154_LINK_METRICS_RSSI) != 0U) && (count < values_len))
+    {
+        p_values[count++] = rssi_scale(rssi, RSSI_MIN);
+    }
+}
+
+#endif // NRF_802154_LINK_METRICS_ENABLED
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that writes the link metrics of Enh-Ack based probing into Enh-Acks.
+ *
+ */
+
+#ifndef NRF_802154_LINK_METRICS_H
+#define NRF_802154_LINK_METRICS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the link metrics module.
+ */
+void nrf_802154_link_metrics_init(void);
+
+/**
+ * @brief Configures the link metrics written into Enh-Acks sent to an initiator.
+ *
+ * The metrics of the initiator are reset.
+ *
+ * @param[in]  p_addr    Pointer to the address of the initiator.
+ * @param[in]  extended  Indication if @p p_addr is an extended address or a short address.
+ * @param[in]  metrics   Metrics to write, or 0 to remove the initiator.
+ *
+ * @retval true   The initiator is configured.
+ * @retval false  There is no room for another initiator.
+ */
+bool nrf_802154_link_metrics_initiator_set(const uint8_t           * p_addr,
+                                           bool                      extended,
+                                           nrf_802154_link_metrics_t metrics);
+
+/**
+ * @brief Removes all initiators.
+ */
+void nrf_802154_link_metrics_initiators_clear(void);
+
+/**
+ * @brief Updates the link metrics with a received frame.
+ *
+ * Frames from sources that are not configured initiators are ignored.
+ *
+ * @param[in]  p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the frame.
+ */
+void nrf_802154_link_metrics_frame_received(const uint8_t                  * p_frame,
+                                            const nrf_802154_rx_metadata_t * p_metadata);
+
+/**
+ * @brief Writes the link metrics of the source of a frame into the IE data of its Enh-Ack.
+ *
+ * The metrics are written into the values of the Thread vendor-specific header IE for Enh-Ack
+ * based probing found in @p p_ie. The IE data is left unchanged if the source of the frame is not
+ * a configured initiator or the IE data does not contain such an IE.
+ *
+ * @param[in]    p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame
+ *                        the Enh-Ack responds to.
+ * @param[inout] p_ie     Pointer to the IE data in the Enh-Ack.
+ * @param[in]    ie_len   Length of the IE data.
+ */
+void nrf_802154_link_metrics_ie_write(const uint8_t * p_frame, uint8_t * p_ie, uint8_t ie_len);
+
+#endif // NRF_802154_LINK_METRICS_H
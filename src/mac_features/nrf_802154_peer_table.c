@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the table of link quality of the peers of the 802.15.4 driver.
+ *
+ * The RSSI and LQI of the frames received from a peer and of the ACKs it sent are averaged with
+ * an exponentially weighted moving average. The averages are kept in fixed point, scaled by
+ * 2^NRF_802154_PEER_TABLE_EWMA_SHIFT, so small changes are not lost to rounding.
+ *
+ */
+
+#include "nrf_802154_peer_table.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_PEER_TABLE_ENABLED
+
+#if NRF_802154_PEER_TABLE_SIZE < 1
+#error NRF_802154_PEER_TABLE_SIZE must be at least 1.
+#endif
+
+/// Scale of the fixed point averages.
+#define EWMA_ONE         (1L << NRF_802154_PEER_TABLE_EWMA_SHIFT)
+
+/// ACK success rate of a peer that always acknowledges frames.
+#define ACK_SUCCESS_FULL 100
+
+/// Link quality of a peer.
+typedef struct
+{
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the peer.
+    uint8_t  addr_size;                   ///< Size of the address, 0 if entry is empty.
+    bool     link_measured;               ///< If the averages of RSSI and LQI are initialized.
+    bool     ack_measured;                ///< If the average of ACK success is initialized.
+    int32_t  rssi;                        ///< Average RSSI, scaled by @ref EWMA_ONE.
+    int32_t  lqi;                         ///< Average LQI, scaled by @ref EWMA_ONE.
+    int32_t  ack_success;                 ///< Average ACK success in percents, scaled by @ref EWMA_ONE.
+    uint32_t last_seen;                   ///< Timestamp of the last frame received from the peer.
+    uint32_t ack_requests;                ///< Number of transmissions that requested an ACK.
+    uint32_t acks;                        ///< Number of ACKs received.
+    uint8_t  antenna;                     ///< Best antenna for the last frame received from the peer.
+    uint8_t  tx_power_reduction;          ///< Reduction of the transmit power to the peer in dB.
+} peer_table_entry_t;
+
+static peer_table_entry_t m_entries[NRF_802154_PEER_TABLE_SIZE]; ///< Known peers.
+static uint32_t           m_next_entry;                          ///< Entry to be replaced next.
+
+/** Add a sample to a fixed point average, or initialize it with the first sample. */
+static int32_t ewma_update(int32_t average, int32_t sample, bool initialized)
+{
+    if (!initialized)
+    {
+        return sample * EWMA_ONE;
+    }
+
+    return average + sample - (average / EWMA_ONE);
+}
+
+/**
+ * @brief Find the entry of a peer.
+ *
+ * @param[in]  p_addr     Pointer to the address of the peer.
+ * @param[in]  addr_size  Size of the address.
+ *
+ * @returns  Pointer to the entry of the peer, or NULL if the peer is not in the table.
+ */
+static peer_table_entry_t * entry_find(const uint8_t * p_addr, uint8_t addr_size)
+{
+    for (uint32_t i = 0; i < NRF_802154_PEER_TABLE_SIZE; i++)
+    {
+        peer_table_entry_t * p_entry = &m_entries[i];
+
+        if ((p_entry->addr_size == addr_size) &&
+            (0 == memcmp(p_entry->addr, p_addr, addr_size)))
+        {
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find the entry of a peer, or replace the oldest added one.
+ *
+ * @param[in]  p_addr     Pointer to the address of the peer.
+ * @param[in]  addr_size  Size of the address.
+ *
+ * @returns  Pointer to the entry of the peer.
+ */
+static peer_table_entry_t * entry_get(const uint8_t * p_addr, uint8_t addr_size)
+{
+    peer_table_entry_t * p_entry = entry_find(p_addr, addr_size);
+
+    if (p_entry != NULL)
+    {
+        return p_entry;
+    }
+
+    p_entry      = &m_entries[m_next_entry];
+    m_next_entry = (m_next_entry + 1) % NRF_802154_PEER_TABLE_SIZE;
+
+    memset(p_entry, 0, sizeof(*p_entry));
+    memcpy(p_entry->addr, p_addr, addr_size);
+    p_entry->addr_size = addr_size;
+    p_entry->antenna   = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+
+    return p_entry;
+}
+
+#if NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+
+#if NRF_802154_PEER_TABLE_TX_POWER_MAX_REDUCTION > UINT8_MAX
+#error NRF_802154_PEER_TABLE_TX_POWER_MAX_REDUCTION must not exceed 255.
+#endif
+
+/**
+ * @brief Adapt the transmit power reduction of a peer to the result of a transmission.
+ *
+ * @param[in]  p_entry   Pointer to the entry of the peer.
+ * @param[in]  acked     If the ACK from the peer was received.
+ * @param[in]  ack_rssi  RSSI of the received ACK. Ignored if @p acked is false.
+ */
+static void tx_power_update(peer_table_entry_t * p_entry, bool acked, int8_t ack_rssi)
+{
+    uint32_t reduction = p_entry->tx_power_reduction;
+
+    if (!acked)
+    {
+        // Recover the link at once, the retransmissions use the full power.
+        reduction = 0U;
+    }
+    else if (ack_rssi > (NRF_802154_PEER_TABLE_TX_POWER_TARGET_RSSI +
+                         NRF_802154_PEER_TABLE_TX_POWER_HYSTERESIS))
+    {
+        reduction += NRF_802154_PEER_TABLE_TX_POWER_STEP;
+
+        if (reduction > NRF_802154_PEER_TABLE_TX_POWER_MAX_REDUCTION)
+        {
+            reduction = NRF_802154_PEER_TABLE_TX_POWER_MAX_REDUCTION;
+        }
+    }
+    else if (ack_rssi < NRF_802154_PEER_TABLE_TX_POWER_TARGET_RSSI)
+    {
+        reduction = (reduction > NRF_802154_PEER_TABLE_TX_POWER_STEP) ?
+                    (reduction - NRF_802154_PEER_TABLE_TX_POWER_STEP) : 0U;
+    }
+    else
+    {
+        // The ACK RSSI is within the hysteresis band, keep the power.
+    }
+
+    p_entry->tx_power_reduction = (uint8_t)reduction;
+}
+
+#endif // NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+
+/** Add the RSSI and LQI of a frame from the peer to the averages. */
+static void link_update(peer_table_entry_t * p_entry, int8_t power, uint8_t lqi)
+{
+    p_entry->rssi          = ewma_update(p_entry->rssi, power, p_entry->link_measured);
+    p_entry->lqi           = ewma_update(p_entry->lqi, lqi, p_entry->link_measured);
+    p_entry->link_measured = true;
+}
+
+void nrf_802154_peer_table_init(void)
+{
+    memset(m_entries, 0, sizeof(m_entries));
+    m_next_entry = 0;
+}
+
+void nrf_802154_peer_table_frame_received(const uint8_t                  * p_frame,
+                                          const nrf_802154_rx_metadata_t * p_metadata)
+{
+    const uint8_t      * p_src_addr;
+    bool                 src_addr_extended;
+    peer_table_entry_t * p_entry;
+
+    p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &src_addr_extended);
+
+    if (p_src_addr == NULL)
+    {
+        return;
+    }
+
+    p_entry = entry_get(p_src_addr, src_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    link_update(p_entry, p_metadata->power, p_metadata->lqi);
+    p_entry->last_seen = p_metadata->time;
+
+    if (p_metadata->antenna != NRF_802154_SL_ANT_DIV_ANTENNA_NONE)
+    {
+        p_entry->antenna = p_metadata->antenna;
+    }
+}
+
+void nrf_802154_peer_table_frame_transmitted(const uint8_t * p_frame,
+                                             const uint8_t * p_ack,
+                                             int8_t          power,
+                                             uint8_t         lqi)
+{
+    const uint8_t      * p_dst_addr;
+    bool                 dst_addr_extended;
+    peer_table_entry_t * p_entry;
+
+    if (!nrf_802154_frame_parser_ar_bit_is_set(p_frame))
+    {
+        return;
+    }
+
+    p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &dst_addr_extended);
+
+    if (p_dst_addr == NULL)
+    {
+        return;
+    }
+
+    p_entry = entry_get(p_dst_addr, dst_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    p_entry->ack_requests++;
+    p_entry->ack_success = ewma_update(p_entry->ack_success,
+                                       (p_ack != NULL) ? ACK_SUCCESS_FULL : 0,
+                                       p_entry->ack_measured);
+    p_entry->ack_measured = true;
+
+    if (p_ack != NULL)
+    {
+        p_entry->acks++;
+        link_update(p_entry, power, lqi);
+    }
+
+#if NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+    tx_power_update(p_entry, p_ack != NULL, power);
+#endif
+}
+
+nrf_802154_sl_ant_div_antenna_t nrf_802154_peer_table_antenna_get(const uint8_t * p_frame)
+{
+    const uint8_t            * p_dst_addr;
+    bool                       dst_addr_extended;
+    const peer_table_entry_t * p_entry;
+
+    p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &dst_addr_extended);
+
+    if (p_dst_addr == NULL)
+    {
+        return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    }
+
+    p_entry = entry_find(p_dst_addr,
+                         dst_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    return (p_entry != NULL) ? p_entry->antenna : NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+}
+
+uint8_t nrf_802154_peer_table_tx_power_reduction_get(const uint8_t * p_frame)
+{
+#if NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+    const uint8_t            * p_dst_addr;
+    bool                       dst_addr_extended;
+    const peer_table_entry_t * p_entry;
+
+    p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &dst_addr_extended);
+
+    if (p_dst_addr == NULL)
+    {
+        return 0U;
+    }
+
+    p_entry = entry_find(p_dst_addr,
+                         dst_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    return (p_entry != NULL) ? p_entry->tx_power_reduction : 0U;
+#else
+    (void)p_frame;
+
+    return 0U;
+#endif
+}
+
+uint8_t nrf_802154_peer_table_ack_success_get(const uint8_t * p_frame)
+{
+    const uint8_t            * p_dst_addr;
+    bool                       dst_addr_extended;
+    const peer_table_entry_t * p_entry;
+
+    p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &dst_addr_extended);
+
+    if (p_dst_addr == NULL)
+    {
+        return ACK_SUCCESS_FULL;
+    }
+
+    p_entry = entry_find(p_dst_addr,
+                         dst_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    if ((p_entry == NULL) || !p_entry->ack_measured)
+    {
+        return ACK_SUCCESS_FULL;
+    }
+
+    return (uint8_t)(p_entry->ack_success / EWMA_ONE);
+}
+
+uint8_t nrf_802154_peer_table_read(nrf_802154_peer_info_t * p_peers, uint8_t max_count)
+{
+    uint8_t                         count = 0;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    for (uint32_t i = 0; (i < NRF_802154_PEER_TABLE_SIZE) && (count < max_count); i++)
+    {
+        const peer_table_entry_t * p_entry = &m_entries[i];
+        nrf_802154_peer_info_t   * p_peer  = &p_peers[count];
+
+        // The entry is updated from the RADIO IRQ handler, it must be copied atomically.
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        if (p_entry->addr_size != 0U)
+        {
+            memcpy(p_peer->addr, p_entry->addr, p_entry->addr_size);
+            p_peer->extended           = (p_entry->addr_size == EXTENDED_ADDRESS_SIZE);
+            p_peer->rssi               = (int8_t)(p_entry->rssi / EWMA_ONE);
+            p_peer->lqi                = (uint8_t)(p_entry->lqi / EWMA_ONE);
+            p_peer->ack_success        = p_entry->ack_measured ?
+                                         (uint8_t)(p_entry->ack_success / EWMA_ONE) :
+                                         ACK_SUCCESS_FULL;
+            p_peer->last_seen          = p_entry->last_seen;
+            p_peer->ack_requests       = p_entry->ack_requests;
+            p_peer->acks               = p_entry->acks;
+            p_peer->antenna            = p_entry->antenna;
+            p_peer->tx_power_reduction = p_entry->tx_power_reduction;
+            count++;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+
+    return count;
+}
+
+void nrf_802154_peer_table_clear(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    nrf_802154_peer_table_init();
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_PEER_TABLE_ENABLED
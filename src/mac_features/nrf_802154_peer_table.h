@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that keeps the link quality of the peers of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_PEER_TABLE_H
+#define NRF_802154_PEER_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+#include "nrf_802154_sl_ant_div.h"
+
+/**
+ * @brief Initializes the peer table.
+ */
+void nrf_802154_peer_table_init(void);
+
+/**
+ * @brief Updates the peer table with a received frame.
+ *
+ * The RSSI, LQI, the time of the frame and the antenna it was best received with are stored for
+ * its source address. Frames without the source address are ignored.
+ *
+ * @param[in]  p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the frame.
+ */
+void nrf_802154_peer_table_frame_received(const uint8_t                  * p_frame,
+                                          const nrf_802154_rx_metadata_t * p_metadata);
+
+/**
+ * @brief Updates the peer table with the result of a transmission that requested an ACK.
+ *
+ * The result is stored for the destination address of the frame, and the transmit power
+ * reduction of the destination is adapted to it. Frames without the destination address or that
+ * did not request an ACK are ignored.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  p_ack    Pointer to the buffer that contains the PHR and PSDU of the received ACK,
+ *                      or NULL if the ACK was not received.
+ * @param[in]  power    RSSI of the received ACK. Ignored if @p p_ack is NULL.
+ * @param[in]  lqi      LQI of the received ACK. Ignored if @p p_ack is NULL.
+ */
+void nrf_802154_peer_table_frame_transmitted(const uint8_t * p_frame,
+                                             const uint8_t * p_ack,
+                                             int8_t          power,
+                                             uint8_t         lqi);
+
+/**
+ * @brief Gets the antenna learned for the destination of a frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ *
+ * @returns  Best antenna for the last frame received from the destination of @p p_frame, or
+ *           @ref NRF_802154_SL_ANT_DIV_ANTENNA_NONE if the antenna of the destination is unknown.
+ */
+nrf_802154_sl_ant_div_antenna_t nrf_802154_peer_table_antenna_get(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the transmit power reduction learned for the destination of a frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ *
+ * @returns  Reduction of the transmit power for the destination of @p p_frame in dB, or 0 if
+ *           the destination is unknown or @ref NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+ *           is not set.
+ */
+uint8_t nrf_802154_peer_table_tx_power_reduction_get(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the average ACK success of the destination of a frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ *
+ * @returns  Average percentage of the transmissions to the destination of @p p_frame that were
+ *           acknowledged, or 100 if it is not known.
+ */
+uint8_t nrf_802154_peer_table_ack_success_get(const uint8_t * p_frame);
+
+/**
+ * @brief Copies the peers from the peer table.
+ *
+ * @param[out] p_peers    Pointer to the buffer for the peers.
+ * @param[in]  max_count  Number of peers that fit in @p p_peers.
+ *
+ * @returns  Number of peers copied to @p p_peers.
+ */
+uint8_t nrf_802154_peer_table_read(nrf_802154_peer_info_t * p_peers, uint8_t max_count);
+
+/**
+ * @brief Removes all peers from the peer table.
+ */
+void nrf_802154_peer_table_clear(void);
+
+#endif // NRF_802154_PEER_TABLE_H
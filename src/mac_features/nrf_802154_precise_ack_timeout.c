@@ -35,7 +35,8 @@
  *
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_ACK_TIMEOUT
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_ACK_TIMEOUT
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_ACK_TIMEOUT_LOG_VERBOSITY
 
 #include "nrf_802154_ack_timeout.h"
 
@@ -44,6 +45,7 @@
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
+#include "nrf_802154_core_hooks.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
@@ -51,15 +53,44 @@
 
 #if NRF_802154_ACK_TIMEOUT_ENABLED
 
+static uint32_t        m_timeout = NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT; ///< ACK timeout in us.
+static volatile bool   m_procedure_is_active;
+static const uint8_t * mp_frame;
+
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
+// The RADIO ends the ACK reception by itself when the TIMER expires and the core reports the
+// missing ACK, so the procedure only tracks the frame.
+static void timeout_timer_start(void)
+{
+    m_procedure_is_active = true;
+    nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
+}
+
+static void timeout_timer_stop(void)
+{
+    m_procedure_is_active = false;
+    nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
+}
+
+uint32_t nrf_802154_ack_timeout_hw_time_get(void)
+{
+    if (!m_procedure_is_active)
+    {
+        return 0U;
+    }
+
+    return TURNAROUND_TIME + PHY_US_TIME_FROM_SYMBOLS(PHY_SHR_SYMBOLS) + m_timeout;
+}
+
+#else // NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
 #define RETRY_DELAY     500     ///< Procedure is delayed by this time if it cannot be performed at the moment [us].
 #define MAX_RETRY_DELAY 1000000 ///< Maximum allowed delay of procedure retry [us].
 
 static void timeout_timer_retry(void);
 
-static uint32_t           m_timeout = NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT; ///< ACK timeout in us.
-static nrf_802154_timer_t m_timer;                                                    ///< Timer used to notify when the ACK frama is not received for too long.
-static volatile bool      m_procedure_is_active;
-static const uint8_t    * mp_frame;
+static nrf_802154_timer_t m_timer; ///< Timer used to notify when the ACK frama is not received for too long.
 
 static void notify_tx_error(bool result)
 {
@@ -83,6 +114,7 @@ static void timeout_timer_fired(void * p_context)
                                        false))
         {
             m_procedure_is_active = false;
+            nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
         }
         else
         {
@@ -111,6 +143,7 @@ static void timeout_timer_start(void)
                         nrf_802154_frame_duration_get(mp_frame[0], false, true);
 
     m_procedure_is_active = true;
+    nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
 
     nrf_802154_timer_sched_add(&m_timer, true);
 }
@@ -118,6 +151,7 @@ static void timeout_timer_start(void)
 static void timeout_timer_stop(void)
 {
     m_procedure_is_active = false;
+    nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
 
     // To make sure `timeout_timer_fired()` detects that procedure is being stopped if it preempts
     // this function.
@@ -126,6 +160,8 @@ static void timeout_timer_stop(void)
     nrf_802154_timer_sched_remove(&m_timer, NULL);
 }
 
+#endif // NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
 void nrf_802154_ack_timeout_time_set(uint32_t time)
 {
     m_timeout = time;
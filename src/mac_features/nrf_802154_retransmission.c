@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements retransmission of frames that were not acknowledged.
+ *
+ */
+
+#include "nrf_802154_retransmission.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_core_hooks.h"
+#include "nrf_802154_debug.h"
+#include "mac_features/nrf_802154_csma_ca.h"
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+
+#if NRF_802154_MAX_FRAME_RETRIES_DEFAULT > MAX_FRAME_RETRIES_MAX
+#error NRF_802154_MAX_FRAME_RETRIES_DEFAULT is out of range.
+#endif
+
+static uint8_t         m_max_retries = NRF_802154_MAX_FRAME_RETRIES_DEFAULT; ///< Maximum number of retransmissions of a frame.
+static uint8_t         m_attempts;                                           ///< Number of transmission attempts of the current frame.
+static const uint8_t * mp_data;                                              ///< Pointer to a buffer containing PHR and PSDU of the frame being retransmitted.
+static volatile bool   m_is_running;                                         ///< Indicates if retransmissions are tracked.
+
+/**
+ * @brief Check if the given error is caused by a missing acknowledgment.
+ *
+ * @param[in]  error  Cause of failed transmission.
+ *
+ * @retval true   The frame was transmitted, but it was not acknowledged.
+ * @retval false  The frame failed due to another reason.
+ */
+static bool error_is_retriable(nrf_802154_tx_error_t error)
+{
+    return (error == NRF_802154_TX_ERROR_NO_ACK) || (error == NRF_802154_TX_ERROR_INVALID_ACK);
+}
+
+void nrf_802154_retransmission_start(const uint8_t * p_data)
+{
+    mp_data      = p_data;
+    m_attempts   = 1;
+    m_is_running = true;
+    nrf_802154_core_hooks_proc_activate(NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION);
+}
+
+bool nrf_802154_retransmission_max_retries_set(uint8_t max_retries)
+{
+    if (max_retries > MAX_FRAME_RETRIES_MAX)
+    {
+        return false;
+    }
+
+    m_max_retries = max_retries;
+
+    return true;
+}
+
+uint8_t nrf_802154_retransmission_max_retries_get(void)
+{
+    return m_max_retries;
+}
+
+uint8_t nrf_802154_retransmission_attempts_get(void)
+{
+    return m_attempts;
+}
+
+bool nrf_802154_retransmission_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    // Stop only if requested by the core or the higher layer, like the CSMA-CA procedure.
+    if (((req_orig == REQ_ORIG_CORE) || (req_orig == REQ_ORIG_HIGHER_LAYER)) &&
+        (term_lvl >= NRF_802154_TERM_802154))
+    {
+        m_is_running = false;
+        nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION);
+    }
+
+    return true;
+}
+
+void nrf_802154_retransmission_transmitted_hook(const uint8_t * p_frame)
+{
+    if (p_frame == mp_data)
+    {
+        m_is_running = false;
+        nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION);
+    }
+}
+
+bool nrf_802154_retransmission_tx_failed_hook(const uint8_t        * p_frame,
+                                              nrf_802154_tx_error_t error)
+{
+    bool result = true;
+
+    if (m_is_running && (p_frame == mp_data))
+    {
+        nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+        if (error_is_retriable(error) && (m_attempts <= m_max_retries))
+        {
+            m_attempts++;
+
+            // ACK timeout is armed again when the retransmitted frame is started.
+            nrf_802154_csma_ca_start(p_frame, nrf_802154_csma_ca_tx_params_get());
+            result = false;
+        }
+        else
+        {
+            m_is_running = false;
+            nrf_802154_core_hooks_proc_deactivate(NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION);
+        }
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    }
+
+    return result;
+}
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRF_802154_RETRANSMISSION_H__
+#define NRF_802154_RETRANSMISSION_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_retransmission 802.15.4 driver frame retransmission support
+ * @{
+ * @ingroup nrf_802154
+ * @brief Retransmission of frames that were not acknowledged.
+ *
+ * If a frame transmitted with the CSMA-CA procedure is not acknowledged, this module performs
+ * the CSMA-CA procedure and transmits the frame again, up to macMaxFrameRetries times
+ * (see IEEE 802.15.4-2015: 6.7.4.3). The MAC layer is notified only about the final result.
+ */
+
+/**
+ * @brief Starts tracking of retransmissions of the given frame.
+ *
+ * This function is to be called prior to the first CSMA-CA procedure of the frame.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ */
+void nrf_802154_retransmission_start(const uint8_t * p_data);
+
+/**
+ * @brief Sets the maximum number of retransmissions of a frame that was not acknowledged.
+ *
+ * @param[in]  max_retries  Maximum number of retransmissions. Allowed values are from 0 to
+ *                          @ref MAX_FRAME_RETRIES_MAX.
+ *
+ * @retval  true   The value has been set successfully.
+ * @retval  false  The value is out of range.
+ */
+bool nrf_802154_retransmission_max_retries_set(uint8_t max_retries);
+
+/**
+ * @brief Gets the maximum number of retransmissions of a frame that was not acknowledged.
+ *
+ * @returns  Current maximum number of retransmissions.
+ */
+uint8_t nrf_802154_retransmission_max_retries_get(void);
+
+/**
+ * @brief Gets the number of transmission attempts of the last frame handled by this module.
+ *
+ * @returns  Number of transmission attempts, including the first one.
+ */
+uint8_t nrf_802154_retransmission_attempts_get(void);
+
+/**
+ * @brief Aborts tracking of retransmissions.
+ *
+ * @param[in]  term_lvl  Termination level set by the request for aborting the ongoing operation.
+ * @param[in]  req_orig  Module that originates the abort request.
+ *
+ * @retval  true   Retransmissions are not tracked anymore or the request does not affect them.
+ */
+bool nrf_802154_retransmission_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handles a transmitted event.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the transmitted frame.
+ */
+void nrf_802154_retransmission_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handles a TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains a frame that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true   TX failed event is to be propagated to the MAC layer.
+ * @retval  false  TX failed event is not to be propagated to the MAC layer. The frame is
+ *                 retransmitted.
+ */
+bool nrf_802154_retransmission_tx_failed_hook(const uint8_t        * p_frame,
+                                              nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_RETRANSMISSION_H__
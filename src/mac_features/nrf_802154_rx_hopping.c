@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the receive hopping schedule.
+ *
+ */
+
+#include "nrf_802154_rx_hopping.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_utils.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+#if NRF_802154_RX_HOPPING_ENABLED
+
+#if (NRF_802154_RX_HOPPING_MAX_CHANNELS < 1) || (NRF_802154_RX_HOPPING_MAX_CHANNELS > UINT8_MAX)
+#error NRF_802154_RX_HOPPING_MAX_CHANNELS is out of range.
+#endif
+
+#define CHANNEL_MIN 11 ///< Lowest channel of the 2.4 GHz band.
+#define CHANNEL_MAX 26 ///< Highest channel of the 2.4 GHz band.
+
+static nrf_802154_rx_hop_t m_hops[NRF_802154_RX_HOPPING_MAX_CHANNELS]; ///< Copy of the schedule.
+static uint8_t             m_hops_count;                               ///< Number of channels in @ref m_hops.
+static uint8_t             m_hop_idx;                                  ///< Index of the current channel.
+
+static volatile bool      m_running; ///< If the schedule is running.
+static nrf_802154_timer_t m_timer;   ///< Timer that fires when the dwell time ends.
+
+/** Switches to the next channel of the schedule or, if the core refused it, retries later. */
+static void timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    uint8_t next_idx = (uint8_t)((m_hop_idx + 1U) % m_hops_count);
+
+    if (!m_running)
+    {
+        return;
+    }
+
+    m_timer.t0 = nrf_802154_timer_sched_time_get();
+
+    if (nrf_802154_request_rx_channel_hop(m_hops[next_idx].channel))
+    {
+        m_hop_idx  = next_idx;
+        m_timer.dt = m_hops[next_idx].dwell_time;
+    }
+    else
+    {
+        // A frame is in flight on the current channel. Let it complete there.
+        m_timer.dt = NRF_802154_RX_HOPPING_RETRY_DELAY;
+    }
+
+    nrf_802154_timer_sched_add(&m_timer, false);
+}
+
+bool nrf_802154_rx_hopping_schedule_start(const nrf_802154_rx_hop_t * p_hops, uint8_t count)
+{
+    if (m_running || (p_hops == NULL) || (count == 0) ||
+        (count > NRF_802154_RX_HOPPING_MAX_CHANNELS))
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if ((p_hops[i].channel < CHANNEL_MIN) || (p_hops[i].channel > CHANNEL_MAX) ||
+            (p_hops[i].dwell_time == 0))
+        {
+            return false;
+        }
+    }
+
+    memcpy(m_hops, p_hops, count * sizeof(m_hops[0]));
+    m_hops_count = count;
+
+    // The first expiry moves to the first channel of the list.
+    m_hop_idx = (uint8_t)(count - 1U);
+
+    m_timer.callback  = timer_fired;
+    m_timer.p_context = NULL;
+    m_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_timer.dt        = 0;
+
+    m_running = true;
+
+    nrf_802154_timer_sched_add(&m_timer, false);
+
+    return true;
+}
+
+bool nrf_802154_rx_hopping_schedule_stop(void)
+{
+    if (!m_running)
+    {
+        return false;
+    }
+
+    m_running = false;
+
+    __DMB();
+
+    nrf_802154_timer_sched_remove(&m_timer, NULL);
+
+    return true;
+}
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
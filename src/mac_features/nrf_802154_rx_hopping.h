@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that implements the receive hopping schedule of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_RX_HOPPING_H__
+#define NRF_802154_RX_HOPPING_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_RX_HOPPING_ENABLED
+
+/**
+ * @defgroup nrf_802154_rx_hopping_schedule Receive hopping schedule
+ * @{
+ * @ingroup nrf_802154
+ * @brief Receive hopping schedule.
+ *
+ * This module keeps a list of up to @ref NRF_802154_RX_HOPPING_MAX_CHANNELS channels and switches
+ * the receiver to the next one each time the dwell time of the current channel ends. The switch is
+ * requested from the core with @ref nrf_802154_request_rx_channel_hop, which refuses it while a
+ * frame is being received or transmitted. A refused switch is retried after
+ * @ref NRF_802154_RX_HOPPING_RETRY_DELAY.
+ */
+
+/**
+ * @brief Starts the receive hopping schedule.
+ *
+ * @param[in]  p_hops  Array of the channels with their dwell times.
+ * @param[in]  count   Number of channels in @p p_hops.
+ *
+ * @retval true   The schedule started.
+ * @retval false  The schedule is already running or the list is invalid.
+ */
+bool nrf_802154_rx_hopping_schedule_start(const nrf_802154_rx_hop_t * p_hops, uint8_t count);
+
+/**
+ * @brief Stops the receive hopping schedule.
+ *
+ * @retval true   The schedule stopped.
+ * @retval false  The schedule was not running.
+ */
+bool nrf_802154_rx_hopping_schedule_stop(void);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
+#endif // NRF_802154_RX_HOPPING_H__
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the storage of the keys used to secure frames and their frame counters.
+ *
+ * The keys are modified in a critical section, so they are consistent when read by the radio
+ * interrupt handlers.
+ *
+ */
+
+#include "nrf_802154_security_pib.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_ENCRYPTION_ENABLED
+
+#if NRF_802154_SECURITY_KEY_STORAGE_SIZE < 1
+#error NRF_802154_SECURITY_KEY_STORAGE_SIZE must be at least 1.
+#endif
+
+/// Slot of the key storage.
+typedef struct
+{
+    nrf_802154_key_t key;                     ///< Stored key, including its next frame counter.
+    bool             used;                    ///< If the slot contains a key.
+    bool             frame_counter_exhausted; ///< If all frame counters of the key were used.
+} key_slot_t;
+
+static key_slot_t m_keys[NRF_802154_SECURITY_KEY_STORAGE_SIZE]; ///< Key storage.
+
+/** Get the size of the Key Identifier field for the given Key Identifier Mode (1-3). */
+static uint8_t key_id_size_get(uint8_t mode)
+{
+    switch (mode)
+    {
+        case 1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case 2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case 3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+/** Find the slot of the key with the given identifier. */
+static key_slot_t * key_slot_find(uint8_t mode, const uint8_t * p_key_id)
+{
+    uint8_t id_size = key_id_size_get(mode);
+
+    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    {
+        if (m_keys[i].used &&
+            (m_keys[i].key.id.mode == mode) &&
+            (memcmp(m_keys[i].key.id.id, p_key_id, id_size) == 0))
+        {
+            return &m_keys[i];
+        }
+    }
+
+    return NULL;
+}
+
+/** Fill the given slot with the given key. */
+static void key_slot_fill(key_slot_t * p_slot, const nrf_802154_key_t * p_key)
+{
+    p_slot->key                     = *p_key;
+    p_slot->used                    = true;
+    p_slot->frame_counter_exhausted = false;
+}
+
+void nrf_802154_security_pib_init(void)
+{
+    memset(m_keys, 0, sizeof(m_keys));
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_key_store(const nrf_802154_key_t * p_key)
+{
+    nrf_802154_security_error_t     result = NRF_802154_SECURITY_ERROR_NONE;
+    key_slot_t                    * p_slot;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (key_id_size_get(p_key->id.mode) == 0)
+    {
+        return NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_slot = key_slot_find(p_key->id.mode, p_key->id.id);
+
+    for (uint32_t i = 0; (p_slot == NULL) && (i < NRF_802154_SECURITY_KEY_STORAGE_SIZE); i++)
+    {
+        if (!m_keys[i].used)
+        {
+            p_slot = &m_keys[i];
+        }
+    }
+
+    if (p_slot != NULL)
+    {
+        key_slot_fill(p_slot, p_key);
+    }
+    else
+    {
+        result = NRF_802154_SECURITY_ERROR_STORAGE_FULL;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_key_remove(const nrf_802154_key_id_t * p_id)
+{
+    nrf_802154_security_error_t     result = NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    key_slot_t                    * p_slot;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_slot = key_slot_find(p_id->mode, p_id->id);
+
+    if (p_slot != NULL)
+    {
+        memset(p_slot, 0, sizeof(key_slot_t));
+        result = NRF_802154_SECURITY_ERROR_NONE;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void nrf_802154_security_pib_key_remove_all(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    memset(m_keys, 0, sizeof(m_keys));
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_keys_set(const nrf_802154_key_t * p_keys,
+                                                             uint8_t                  count)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (count > NRF_802154_SECURITY_KEY_STORAGE_SIZE)
+    {
+        return NRF_802154_SECURITY_ERROR_STORAGE_FULL;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (key_id_size_get(p_keys[i].id.mode) == 0)
+        {
+            return NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED;
+        }
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    memset(m_keys, 0, sizeof(m_keys));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        key_slot_t * p_slot = key_slot_find(p_keys[i].id.mode, p_keys[i].id.id);
+
+        // A key repeated in the array replaces its previous occurrence.
+        if (p_slot == NULL)
+        {
+            p_slot = &m_keys[i];
+        }
+
+        key_slot_fill(p_slot, &p_keys[i]);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+bool nrf_802154_security_pib_key_get(uint8_t mode, const uint8_t * p_key_id, uint8_t * p_key)
+{
+    bool                            result = false;
+    const key_slot_t              * p_slot;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_slot = key_slot_find(mode, p_key_id);
+
+    if (p_slot != NULL)
+    {
+        memcpy(p_key, p_slot->key.value, NRF_802154_KEY_SIZE);
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void nrf_802154_security_pib_frame_counter_set(uint32_t frame_counter)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    {
+        m_keys[i].key.frame_counter       = frame_counter;
+        m_keys[i].frame_counter_exhausted = false;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+bool nrf_802154_security_pib_frame_counter_get_next(uint8_t         mode,
+                                                    const uint8_t * p_key_id,
+                                                    uint32_t      * p_frame_counter)
+{
+    bool                            result = false;
+    key_slot_t                    * p_slot;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_slot = key_slot_find(mode, p_key_id);
+
+    if ((p_slot != NULL) && !p_slot->frame_counter_exhausted)
+    {
+        *p_frame_counter = p_slot->key.frame_counter;
+
+        // The last value of the frame counter can be used once.
+        if (p_slot->key.frame_counter == UINT32_MAX)
+        {
+            p_slot->frame_counter_exhausted = true;
+        }
+        else
+        {
+            p_slot->key.frame_counter++;
+        }
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+#endif // NRF_802154_ENCRYPTION_ENABLED
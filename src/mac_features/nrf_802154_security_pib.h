@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that stores the keys used to secure frames and their frame counters.
+ *
+ */
+
+#ifndef NRF_802154_SECURITY_PIB_H
+#define NRF_802154_SECURITY_PIB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the security PIB. All keys are removed.
+ */
+void nrf_802154_security_pib_init(void);
+
+/**
+ * @brief Stores a key. The key with the same identifier is replaced.
+ *
+ * The frame counter of the key is set to the @c frame_counter field of @p p_key.
+ *
+ * @param[in]  p_key  Pointer to the key to store.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key is stored.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL        There is no free slot for the key.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not 1-3.
+ */
+nrf_802154_security_error_t nrf_802154_security_pib_key_store(const nrf_802154_key_t * p_key);
+
+/**
+ * @brief Removes the key with the given identifier.
+ *
+ * @param[in]  p_id  Pointer to the identifier of the key.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE           The key is removed.
+ * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND  There is no key with the given identifier.
+ */
+nrf_802154_security_error_t nrf_802154_security_pib_key_remove(const nrf_802154_key_id_t * p_id);
+
+/**
+ * @brief Removes all keys.
+ */
+void nrf_802154_security_pib_key_remove_all(void);
+
+/**
+ * @brief Replaces all stored keys with the given ones.
+ *
+ * The keys are replaced at once, so a frame is never secured with a mix of the old and new keys.
+ * If any of the keys is invalid, the stored keys are not modified.
+ *
+ * @param[in]  p_keys  Pointer to the array of keys to store.
+ * @param[in]  count   Number of keys in @p p_keys.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The keys are stored.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL        There are more keys than free slots.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  A Key Identifier Mode is not 1-3.
+ */
+nrf_802154_security_error_t nrf_802154_security_pib_keys_set(const nrf_802154_key_t * p_keys,
+                                                             uint8_t                  count);
+
+/**
+ * @brief Copies the key matching the Key Identifier field of a frame.
+ *
+ * @param[in]  mode      Key Identifier Mode (1-3).
+ * @param[in]  p_key_id  Pointer to the Key Identifier field.
+ * @param[out] p_key     Pointer to the buffer of @ref NRF_802154_KEY_SIZE bytes for the key.
+ *
+ * @retval true   The key is found and copied to @p p_key.
+ * @retval false  There is no key with the given identifier.
+ */
+bool nrf_802154_security_pib_key_get(uint8_t mode, const uint8_t * p_key_id, uint8_t * p_key);
+
+/**
+ * @brief Sets the frame counter of all stored keys.
+ *
+ * @param[in]  frame_counter  Value of the frame counter.
+ */
+void nrf_802154_security_pib_frame_counter_set(uint32_t frame_counter);
+
+/**
+ * @brief Gets the frame counter for a frame to secure with the given key and increments it.
+ *
+ * This function can be called from the radio interrupt handler, as the frame counter is
+ * incremented in a critical section. The same counter is used for the transmitted frames and
+ * the Enh-Acks secured with the key.
+ *
+ * @param[in]  mode             Key Identifier Mode (1-3).
+ * @param[in]  p_key_id         Pointer to the Key Identifier field.
+ * @param[out] p_frame_counter  Pointer to the frame counter of the frame.
+ *
+ * @retval true   The frame counter is assigned.
+ * @retval false  There is no key with the given identifier or its frame counter is exhausted.
+ */
+bool nrf_802154_security_pib_frame_counter_get_next(uint8_t         mode,
+                                                    const uint8_t * p_key_id,
+                                                    uint32_t      * p_frame_counter);
+
+#endif // NRF_802154_SECURITY_PIB_H
@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the TSCH slotframe engine.
+ *
+ */
+
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_TSCH
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_TSCH_LOG_VERBOSITY
+
+#include "nrf_802154_tsch_slotframe.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../nrf_802154_debug.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_delayed_trx.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_utils.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+#if NRF_802154_TSCH_ENABLED
+
+#if !NRF_802154_DELAYED_TRX_ENABLED
+#error NRF_802154_TSCH_ENABLED requires NRF_802154_DELAYED_TRX_ENABLED.
+#endif
+
+#if (NRF_802154_TSCH_MAX_CELLS < 1) || (NRF_802154_TSCH_MAX_CELLS > UINT8_MAX)
+#error NRF_802154_TSCH_MAX_CELLS is out of range.
+#endif
+
+#if (NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE < 1) || \
+    (NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE > UINT8_MAX)
+#error NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE is out of range.
+#endif
+
+#define LEAD_TIME NRF_802154_TSCH_SCHEDULE_LEAD_TIME ///< Time before the timeslot at which its cell is scheduled [us].
+
+static nrf_802154_tsch_cell_t m_cells[NRF_802154_TSCH_MAX_CELLS];  ///< Cells sorted by the slot offset.
+static const uint8_t        * mp_frames[NRF_802154_TSCH_MAX_CELLS]; ///< Frames assigned to the cells.
+static uint8_t                m_cells_count;                        ///< Number of cells in @ref m_cells.
+
+static nrf_802154_tsch_config_t m_config;                                                        ///< Slotframe configuration.
+static uint8_t                  m_hopping_sequence[NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE]; ///< Copy of the hopping sequence.
+
+static volatile bool      m_running;    ///< If the slotframe engine is running.
+static bool               m_idle;       ///< If the engine is running, but no cell is scheduled, because the slotframe is empty.
+static nrf_802154_timer_t m_timer;      ///< Timer that fires @ref LEAD_TIME before the next cell.
+static uint64_t           m_asn;        ///< ASN of the next cell to be scheduled.
+static uint32_t           m_slot_start; ///< Start time of the timeslot @ref m_asn.
+
+static bool     m_prev_valid;       ///< If an operation was scheduled for the previous cell.
+static uint16_t m_prev_slot_offset; ///< Slot offset of the previous cell.
+static uint64_t m_prev_asn;         ///< ASN of the previous cell.
+
+static const uint8_t * mp_scheduled_frame; ///< Frame of the transmission scheduled for the previous cell, or NULL.
+static uint32_t        m_scheduled_rx_t0;  ///< Base time of the receive window scheduled for the previous cell.
+static uint32_t        m_scheduled_rx_dt;  ///< Delta of the receive window scheduled for the previous cell.
+
+/**
+ * @brief Finds the cell with the given slot offset.
+ *
+ * @param[in]   slot_offset  Slot offset of the cell.
+ * @param[out]  p_idx        Index of the cell or, if not found, of the position at which it would
+ *                           be inserted.
+ *
+ * @retval true   The cell was found.
+ * @retval false  There is no cell with the given slot offset.
+ */
+static bool cell_find(uint16_t slot_offset, uint8_t * p_idx)
+{
+    uint8_t idx = 0;
+
+    while ((idx < m_cells_count) && (m_cells[idx].slot_offset < slot_offset))
+    {
+        idx++;
+    }
+
+    *p_idx = idx;
+
+    return (idx < m_cells_count) && (m_cells[idx].slot_offset == slot_offset);
+}
+
+/**
+ * @brief Gets the ASN of the first timeslot that contains a cell, starting from the given one.
+ *
+ * @param[in]   asn         ASN to start the search from.
+ * @param[in]   inclusive   If the timeslot @p asn itself is to be taken into account.
+ * @param[out]  p_next_asn  ASN of the found timeslot.
+ *
+ * @retval true   The timeslot was found.
+ * @retval false  There are no cells in the slotframe.
+ */
+static bool next_cell_asn_get(uint64_t asn, bool inclusive, uint64_t * p_next_asn)
+{
+    uint16_t length = m_config.slotframe_length;
+    uint16_t offset = (uint16_t)(asn % length);
+
+    // Cells are sorted, so the ones with offsets out of the slotframe are at the end of the table.
+    if ((m_cells_count == 0) || (m_cells[0].slot_offset >= length))
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; (i < m_cells_count) && (m_cells[i].slot_offset < length); i++)
+    {
+        uint16_t slot_offset = m_cells[i].slot_offset;
+
+        if ((slot_offset > offset) || (inclusive && (slot_offset == offset)))
+        {
+            *p_next_asn = asn + (slot_offset - offset);
+            return true;
+        }
+    }
+
+    *p_next_asn = asn + (length - offset) + m_cells[0].slot_offset;
+
+    return true;
+}
+
+/**
+ * @brief Arms the timer for the first cell that can be scheduled in time.
+ *
+ * The search starts from the timeslot @p asn that starts at @p slot_start.
+ *
+ * @param[in]  asn         ASN of the reference timeslot.
+ * @param[in]  slot_start  Start time of the timeslot @p asn.
+ *
+ * @retval true   The timer was armed.
+ * @retval false  There are no cells in the slotframe.
+ */
+static bool first_cell_schedule(uint64_t asn, uint32_t slot_start)
+{
+    uint32_t now = nrf_802154_timer_sched_time_get();
+    int32_t  late;
+    uint64_t next_asn;
+
+    // Skip the timeslots that are too close to be scheduled.
+    late = (int32_t)(now + LEAD_TIME - slot_start);
+
+    if (late >= 0)
+    {
+        uint32_t skip = ((uint32_t)late / m_config.slot_duration) + 1;
+
+        asn        += skip;
+        slot_start += skip * m_config.slot_duration;
+    }
+
+    if (!next_cell_asn_get(asn, true, &next_asn))
+    {
+        return false;
+    }
+
+    m_asn        = next_asn;
+    m_slot_start = slot_start + (uint32_t)(next_asn - asn) * m_config.slot_duration;
+
+    m_timer.t0 = now;
+    m_timer.dt = m_slot_start - LEAD_TIME - now;
+
+    nrf_802154_timer_sched_add(&m_timer, false);
+
+    return true;
+}
+
+/** Gets the channel of the cell with the given channel offset in the timeslot @p asn. */
+static uint8_t channel_get(uint64_t asn, uint8_t channel_offset)
+{
+    return m_hopping_sequence[(asn + channel_offset) % m_config.hopping_sequence_length];
+}
+
+/**
+ * @brief Schedules the operation of the cell in the timeslot @ref m_asn.
+ *
+ * @param[in]  cell     The cell to be performed.
+ * @param[in]  p_frame  Frame assigned to the cell, or NULL.
+ *
+ * @retval true   The operation was scheduled.
+ * @retval false  There is nothing to be done in the cell or the operation could not be scheduled.
+ */
+static bool cell_perform(nrf_802154_tsch_cell_t cell, const uint8_t * p_frame)
+{
+    uint8_t channel = channel_get(m_asn, cell.channel_offset);
+
+    mp_scheduled_frame = NULL;
+
+    if (p_frame != NULL)
+    {
+        if (nrf_802154_delayed_trx_transmit(p_frame,
+                                            cell.type == NRF_802154_TSCH_CELL_TYPE_SHARED,
+                                            m_slot_start,
+                                            m_config.tx_offset,
+                                            channel))
+        {
+            mp_scheduled_frame = p_frame;
+            return true;
+        }
+
+        return false;
+    }
+
+    if (cell.type != NRF_802154_TSCH_CELL_TYPE_TX)
+    {
+        if (nrf_802154_delayed_trx_receive(m_slot_start,
+                                           m_config.rx_offset,
+                                           m_config.rx_wait,
+                                           channel))
+        {
+            m_scheduled_rx_t0 = m_slot_start;
+            m_scheduled_rx_dt = m_config.rx_offset;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Restores the frame to the cell if its transmission could not be scheduled. */
+static void cell_frame_restore(uint16_t slot_offset, const uint8_t * p_frame)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         idx;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (cell_find(slot_offset, &idx) && (mp_frames[idx] == NULL))
+    {
+        mp_frames[idx] = p_frame;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+static void timer_fired(void * p_context)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    (void)p_context;
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    nrf_802154_tsch_cell_t          cell;
+    const uint8_t                 * p_frame = NULL;
+    uint8_t                         idx;
+    bool                            cell_found;
+    bool                            next_found;
+    uint64_t                        next_asn;
+
+    if (!m_running)
+    {
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+
+    // The operation of the previous cell has ended before the timeslot of the next one.
+    if (m_prev_valid)
+    {
+        nrf_802154_notify_tsch_cell_completed(m_prev_slot_offset, m_prev_asn);
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    cell_found = cell_find((uint16_t)(m_asn % m_config.slotframe_length), &idx);
+
+    if (cell_found)
+    {
+        cell = m_cells[idx];
+
+        if (cell.type != NRF_802154_TSCH_CELL_TYPE_RX)
+        {
+            p_frame        = mp_frames[idx];
+            mp_frames[idx] = NULL;
+        }
+    }
+
+    next_found = next_cell_asn_get(m_asn, false, &next_asn);
+    m_idle     = !next_found;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    // The cell could have been removed after the timer was armed.
+    m_prev_valid = cell_found && cell_perform(cell, p_frame);
+
+    if (m_prev_valid)
+    {
+        m_prev_slot_offset = cell.slot_offset;
+        m_prev_asn         = m_asn;
+    }
+    else if (p_frame != NULL)
+    {
+        cell_frame_restore(cell.slot_offset, p_frame);
+    }
+
+    if (next_found)
+    {
+        uint32_t delta = (uint32_t)(next_asn - m_asn) * m_config.slot_duration;
+
+        m_timer.t0    = m_slot_start - LEAD_TIME;
+        m_timer.dt    = delta;
+        m_slot_start += delta;
+        m_asn         = next_asn;
+
+        nrf_802154_timer_sched_add(&m_timer, false);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+bool nrf_802154_tsch_slotframe_start(const nrf_802154_tsch_config_t * p_config)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result;
+
+    assert(p_config != NULL);
+
+    if (m_running ||
+        (p_config->slot_duration <= LEAD_TIME) ||
+        (p_config->slotframe_length == 0) ||
+        (p_config->p_hopping_sequence == NULL) ||
+        (p_config->hopping_sequence_length == 0) ||
+        (p_config->hopping_sequence_length > NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE) ||
+        (p_config->tx_offset >= p_config->slot_duration) ||
+        (p_config->rx_offset >= p_config->slot_duration))
+    {
+        return false;
+    }
+
+    m_config = *p_config;
+    memcpy(m_hopping_sequence, p_config->p_hopping_sequence, p_config->hopping_sequence_length);
+    m_config.p_hopping_sequence = m_hopping_sequence;
+
+    m_timer.callback  = timer_fired;
+    m_timer.p_context = NULL;
+    m_prev_valid      = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = first_cell_schedule(m_config.asn, m_config.slot_start);
+
+    if (result)
+    {
+        m_idle    = false;
+        m_running = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_tsch_slotframe_stop(void)
+{
+    if (!m_running)
+    {
+        return false;
+    }
+
+    m_running = false;
+
+    // To make sure `timer_fired()` detects that the engine is being stopped if it preempts
+    // this function.
+    __DMB();
+
+    nrf_802154_timer_sched_remove(&m_timer, NULL);
+
+    if (m_prev_valid)
+    {
+        if (mp_scheduled_frame != NULL)
+        {
+            (void)nrf_802154_delayed_trx_transmit_frame_cancel(mp_scheduled_frame);
+        }
+        else
+        {
+            (void)nrf_802154_delayed_trx_receive_window_cancel(m_scheduled_rx_t0,
+                                                                 m_scheduled_rx_dt);
+        }
+
+        m_prev_valid = false;
+    }
+
+    return true;
+}
+
+bool nrf_802154_tsch_slotframe_cell_add(const nrf_802154_tsch_cell_t * p_cell)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         idx;
+    bool                            result = false;
+
+    assert(p_cell != NULL);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if ((m_cells_count < NRF_802154_TSCH_MAX_CELLS) && !cell_find(p_cell->slot_offset, &idx))
+    {
+        memmove(&m_cells[idx + 1], &m_cells[idx], (m_cells_count - idx) * sizeof(m_cells[0]));
+        memmove(&mp_frames[idx + 1], &mp_frames[idx], (m_cells_count - idx) * sizeof(mp_frames[0]));
+
+        m_cells[idx]   = *p_cell;
+        mp_frames[idx] = NULL;
+        m_cells_count++;
+
+        // Resume the engine that ran out of cells.
+        if (m_running && m_idle)
+        {
+            m_idle = !first_cell_schedule(m_asn, m_slot_start);
+        }
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_tsch_slotframe_cell_remove(uint16_t slot_offset)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         idx;
+    bool                            result;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = cell_find(slot_offset, &idx);
+
+    if (result)
+    {
+        m_cells_count--;
+
+        memmove(&m_cells[idx], &m_cells[idx + 1], (m_cells_count - idx) * sizeof(m_cells[0]));
+        memmove(&mp_frames[idx], &mp_frames[idx + 1], (m_cells_count - idx) * sizeof(mp_frames[0]));
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_tsch_slotframe_cell_frame_set(uint16_t slot_offset, const uint8_t * p_data)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         idx;
+    bool                            result;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = cell_find(slot_offset, &idx) && (m_cells[idx].type != NRF_802154_TSCH_CELL_TYPE_RX);
+
+    if (result)
+    {
+        mp_frames[idx] = p_data;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+#endif // NRF_802154_TSCH_ENABLED
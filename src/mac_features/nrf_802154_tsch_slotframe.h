@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that implements the TSCH slotframe engine of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_TSCH_SLOTFRAME_H__
+#define NRF_802154_TSCH_SLOTFRAME_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_TSCH_ENABLED
+
+/**
+ * @defgroup nrf_802154_tsch_slotframe TSCH slotframe engine
+ * @{
+ * @ingroup nrf_802154
+ * @brief TSCH slotframe engine.
+ *
+ * This module keeps a table of up to @ref NRF_802154_TSCH_MAX_CELLS cells of a single slotframe.
+ * @ref NRF_802154_TSCH_SCHEDULE_LEAD_TIME before each timeslot that contains a cell, the module
+ * schedules the transmission or the reception of the cell on the channel selected by the hopping
+ * sequence, using the delayed transmission and reception features. The next higher layer is
+ * notified with @ref nrf_802154_tsch_cell_completed only when a cell is completed.
+ */
+
+/**
+ * @brief Starts the slotframe engine.
+ *
+ * Cells are performed starting from the first timeslot whose operation can still be scheduled
+ * in time.
+ *
+ * @param[in]  p_config  Pointer to the slotframe configuration. The configuration, including
+ *                       the hopping sequence, is copied by the module.
+ *
+ * @retval true   The slotframe engine started.
+ * @retval false  The engine is already running, the configuration is invalid, or there are
+ *                no cells in the slotframe.
+ */
+bool nrf_802154_tsch_slotframe_start(const nrf_802154_tsch_config_t * p_config);
+
+/**
+ * @brief Stops the slotframe engine.
+ *
+ * The operation scheduled for the next cell is cancelled, unless it is already ongoing.
+ * No further cells are notified as completed.
+ *
+ * @retval true   The slotframe engine stopped.
+ * @retval false  The slotframe engine was not running.
+ */
+bool nrf_802154_tsch_slotframe_stop(void);
+
+/**
+ * @brief Adds a cell to the slotframe.
+ *
+ * If the engine is running, the cell is taken into account starting from the timeslot after
+ * the one that is already scheduled.
+ *
+ * @param[in]  p_cell  Pointer to the cell to be added.
+ *
+ * @retval true   The cell was added.
+ * @retval false  The table of cells is full or there already is a cell with the same slot offset.
+ */
+bool nrf_802154_tsch_slotframe_cell_add(const nrf_802154_tsch_cell_t * p_cell);
+
+/**
+ * @brief Removes a cell from the slotframe.
+ *
+ * The operation that has already been scheduled for the cell is not cancelled.
+ *
+ * @param[in]  slot_offset  Slot offset of the cell to be removed.
+ *
+ * @retval true   The cell was removed.
+ * @retval false  There is no cell with the given slot offset.
+ */
+bool nrf_802154_tsch_slotframe_cell_remove(uint16_t slot_offset);
+
+/**
+ * @brief Assigns a frame to be transmitted in the next occurrence of a cell.
+ *
+ * The frame is released by the engine when its transmission is scheduled. The outcome of the
+ * transmission is notified as for any other delayed transmission.
+ *
+ * @param[in]  slot_offset  Slot offset of a @ref NRF_802154_TSCH_CELL_TYPE_TX or
+ *                          @ref NRF_802154_TSCH_CELL_TYPE_SHARED cell.
+ * @param[in]  p_data       Pointer to a buffer containing PHR and PSDU of the frame, or NULL
+ *                          to clear the frame assigned to the cell.
+ *
+ * @retval true   The frame was assigned to the cell.
+ * @retval false  There is no cell with the given slot offset that can be used to transmit.
+ */
+bool nrf_802154_tsch_slotframe_cell_frame_set(uint16_t slot_offset, const uint8_t * p_data);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#endif // NRF_802154_TSCH_SLOTFRAME_H__
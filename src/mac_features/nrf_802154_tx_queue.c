@@ -0,0 +1,595 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the transmit queue used to send frames back-to-back.
+ *
+ */
+
+#include "nrf_802154_tx_queue.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_queue.h"
+#include "nrf_802154_types.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_peer_table.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+
+#if NRF_802154_TX_QUEUE_SIZE >= UINT8_MAX
+#error NRF_802154_TX_QUEUE_SIZE is too big.
+#endif
+
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED && !NRF_802154_PEER_TABLE_ENABLED
+#error NRF_802154_TX_QUEUE_FAIRNESS_ENABLED requires NRF_802154_PEER_TABLE_ENABLED.
+#endif
+
+/// Frame waiting in the transmit queue.
+typedef struct
+{
+    const uint8_t * p_data; ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
+    bool            cca;    ///< If CCA was requested prior to transmission.
+    uint16_t        time;   ///< Radio time needed to transmit the frame.
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+    uint8_t         priority;       ///< Priority class of the frame.
+    bool            deadline_valid; ///< If the frame has a deadline.
+    uint32_t        deadline;       ///< Time by which the transmission of the frame must end.
+#endif
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+    uint8_t         deferrals;      ///< Number of frames let to be transmitted before this one.
+#endif
+} tx_queue_item_t;
+
+/** Instance of the transmit queue. */
+static nrf_802154_queue_t m_tx_queue;
+
+/** Memory holding the items of the transmit queue. One slot is lost due to simplified queue
+ *  implementation. */
+static tx_queue_item_t m_tx_queue_memory[NRF_802154_TX_QUEUE_SIZE + 1];
+
+/** If the queue is being flushed. Protects against flushing recursively from the notification. */
+static volatile bool m_flush_in_progress;
+
+/** Frame passed to the queue whose transmission is in progress. */
+static const uint8_t * volatile mp_in_flight;
+
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+/** Destination address of @ref mp_in_flight, copied so that the frames to the same destination
+ *  can be found after the frame is handed back to the higher layer. */
+static uint8_t         m_in_flight_dst[EXTENDED_ADDRESS_SIZE];
+static const uint8_t * mp_in_flight_dst;         ///< @ref m_in_flight_dst, or NULL if no address.
+static bool            m_in_flight_dst_extended; ///< If @ref m_in_flight_dst is an extended address.
+#endif
+
+static uint8_t  m_queued_count; ///< Number of frames waiting in the queue.
+static uint32_t m_queued_time;  ///< Radio time needed to transmit the frames waiting in the queue.
+
+/** Get the radio time needed to transmit the given frame. */
+static uint16_t frame_time_get(const uint8_t * p_data, bool cca)
+{
+    return nrf_802154_tx_duration_get(p_data[PHR_OFFSET],
+                                      cca,
+                                      nrf_802154_frame_parser_ar_bit_is_set(p_data));
+}
+
+#if NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED || NRF_802154_TX_QUEUE_PRIORITY_ENABLED || \
+    NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+
+/** Get the item at the given position from the front of the queue. */
+static tx_queue_item_t * item_at(uint32_t position)
+{
+    return &m_tx_queue_memory[(m_tx_queue.rdidx + position) % m_tx_queue.capacity];
+}
+
+#endif
+
+#if NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED || NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+
+/** Check if a frame is sent to the given destination address. Frames without the destination
+ *  address are treated as sent to the same destination. */
+static bool destination_is(const uint8_t * p_data, const uint8_t * p_addr, bool extended)
+{
+    bool            frame_extended;
+    const uint8_t * p_frame_addr = nrf_802154_frame_parser_dst_addr_get(p_data, &frame_extended);
+
+    if ((p_frame_addr == NULL) || (p_addr == NULL))
+    {
+        return p_frame_addr == p_addr;
+    }
+
+    return (frame_extended == extended) &&
+           (0 == memcmp(p_frame_addr,
+                        p_addr,
+                        extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE));
+}
+
+/** Check if two frames are sent to the same destination. */
+static bool same_destination_is(const uint8_t * p_data_1, const uint8_t * p_data_2)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_dst_addr_get(p_data_2, &extended);
+
+    return destination_is(p_data_1, p_addr, extended);
+}
+
+/** Check if a frame can be transmitted before the frames queued before it. */
+static bool item_can_advance(uint32_t position)
+{
+    const uint8_t * p_data = item_at(position)->p_data;
+
+    for (uint32_t i = 0; i < position; i++)
+    {
+        if (same_destination_is(item_at(i)->p_data, p_data))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/** Move the item at the given position to the front of the queue. To be called in an MCU critical
+ *  section. */
+static void item_move_to_front(uint32_t position)
+{
+    tx_queue_item_t item = *item_at(position);
+
+    // Shift the frames queued before the chosen one by one position towards the back.
+    for (uint32_t i = position; i > 0U; i--)
+    {
+        *item_at(i) = *item_at(i - 1U);
+    }
+
+    *item_at(0) = item;
+}
+
+#endif // NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED || NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+
+/** Check if the first item is to be transmitted before the second one. */
+static bool item_precedes(const tx_queue_item_t * p_item, const tx_queue_item_t * p_other)
+{
+    if (p_item->priority != p_other->priority)
+    {
+        return p_item->priority < p_other->priority;
+    }
+
+    // Earliest deadline first within a class. Frames without a deadline keep their order.
+    return p_item->deadline_valid &&
+           (!p_other->deadline_valid || ((int32_t)(p_item->deadline - p_other->deadline) < 0));
+}
+
+/** Move the last item of the queue forward to its position given by its priority and deadline. */
+static void item_sort_last(void)
+{
+    for (uint32_t i = m_queued_count - 1U; (i > 0U) && item_precedes(item_at(i), item_at(i - 1U));
+         i--)
+    {
+        tx_queue_item_t item = *item_at(i);
+
+        *item_at(i)      = *item_at(i - 1U);
+        *item_at(i - 1U) = item;
+    }
+}
+
+/** Check if the transmission of the given frame started now would end after its deadline. */
+static bool item_deadline_is_missed(const tx_queue_item_t * p_item)
+{
+    return p_item->deadline_valid &&
+           ((int32_t)(p_item->deadline - nrf_802154_timer_sched_time_get()) <
+            (int32_t)p_item->time);
+}
+
+#endif // NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+
+/** Add a frame to the queue. To be called in an MCU critical section if the queue is not full. */
+static void item_push(const uint8_t                      * p_data,
+                      bool                                 cca,
+                      const nrf_802154_tx_queue_params_t * p_queue_params)
+{
+    tx_queue_item_t * p_item = (tx_queue_item_t *)nrf_802154_queue_push_begin(&m_tx_queue);
+
+    p_item->p_data = p_data;
+    p_item->cca    = cca;
+    p_item->time   = frame_time_get(p_data, cca);
+
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+    if (p_queue_params != NULL)
+    {
+        p_item->priority       = p_queue_params->priority;
+        p_item->deadline_valid = p_queue_params->deadline_valid;
+        p_item->deadline       = p_queue_params->deadline;
+    }
+    else
+    {
+        p_item->priority       = NRF_802154_TX_QUEUE_DEFAULT_PRIORITY;
+        p_item->deadline_valid = false;
+        p_item->deadline       = 0U;
+    }
+#else
+    (void)p_queue_params;
+#endif
+
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+    p_item->deferrals = 0U;
+#endif
+
+    m_queued_count++;
+    m_queued_time += p_item->time;
+
+    nrf_802154_queue_push_commit(&m_tx_queue);
+
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+    item_sort_last();
+#endif
+}
+
+/** Remove the first frame from the queue. */
+static bool item_pop(tx_queue_item_t * p_item)
+{
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!nrf_802154_queue_is_empty(&m_tx_queue))
+    {
+        *p_item = *(tx_queue_item_t *)nrf_802154_queue_pop_begin(&m_tx_queue);
+
+        m_queued_count--;
+        m_queued_time -= p_item->time;
+
+        nrf_802154_queue_pop_commit(&m_tx_queue);
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void nrf_802154_tx_queue_init(void)
+{
+    nrf_802154_queue_init(&m_tx_queue,
+                          m_tx_queue_memory,
+                          sizeof(m_tx_queue_memory),
+                          sizeof(m_tx_queue_memory[0]));
+
+    m_flush_in_progress = false;
+    mp_in_flight        = NULL;
+    m_queued_count      = 0;
+    m_queued_time       = 0;
+}
+
+bool nrf_802154_tx_queue_push(const uint8_t                      * p_data,
+                              bool                                 cca,
+                              const nrf_802154_tx_queue_params_t * p_queue_params)
+{
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!nrf_802154_queue_is_full(&m_tx_queue))
+    {
+        item_push(p_data, cca, p_queue_params);
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_tx_queue_burst_push(const uint8_t * const * pp_data, uint8_t count, bool cca)
+{
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (count <= (NRF_802154_TX_QUEUE_SIZE - m_queued_count))
+    {
+        for (uint8_t i = 0; i < count; i++)
+        {
+            item_push(pp_data[i], cca, NULL);
+        }
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+
+/** Check if the link to the destination of the given frame is poor. */
+static bool item_link_is_poor(const tx_queue_item_t * p_item)
+{
+    return nrf_802154_peer_table_ack_success_get(p_item->p_data) <
+           NRF_802154_TX_QUEUE_FAIRNESS_ACK_SUCCESS_MIN;
+}
+
+/** Let a frame to another destination be transmitted first if the link to the destination of
+ *  the first frame is poor. */
+static void item_airtime_share(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_queued_count > 1U)
+    {
+        tx_queue_item_t * p_first = item_at(0);
+
+        if ((p_first->deferrals < NRF_802154_TX_QUEUE_FAIRNESS_MAX_DEFERRALS) &&
+            item_link_is_poor(p_first))
+        {
+            for (uint32_t i = 1; i < m_queued_count; i++)
+            {
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+                // Airtime is shared within a priority class only.
+                if (item_at(i)->priority != p_first->priority)
+                {
+                    break;
+                }
+#endif
+
+                if (!item_link_is_poor(item_at(i)) && item_can_advance(i))
+                {
+                    p_first->deferrals++;
+                    item_move_to_front(i);
+                    break;
+                }
+            }
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+/** Remove the first frame to the given destination address from the queue. */
+static bool item_destination_pop(const uint8_t * p_addr, bool extended, tx_queue_item_t * p_item)
+{
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < m_queued_count; i++)
+    {
+        if (destination_is(item_at(i)->p_data, p_addr, extended))
+        {
+            item_move_to_front(i);
+            result = item_pop(p_item);
+            break;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+#endif // NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+
+bool nrf_802154_tx_queue_pop(const uint8_t ** pp_data, bool * p_cca)
+{
+    tx_queue_item_t item;
+
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+    item_airtime_share();
+#endif
+
+    while (item_pop(&item))
+    {
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+        if (item_deadline_is_missed(&item))
+        {
+            // The frame was never in flight, so the frames queued after it are not flushed.
+            nrf_802154_notify_transmit_failed(item.p_data, NRF_802154_TX_ERROR_DEADLINE_MISSED);
+            continue;
+        }
+#endif
+
+        *pp_data = item.p_data;
+        *p_cca   = item.cca;
+
+        return true;
+    }
+
+    return false;
+}
+
+#if NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED
+
+bool nrf_802154_tx_queue_fitting_frame_advance(uint32_t time_left)
+{
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_queued_count > 0U)
+    {
+        uint32_t best_position = 0U;
+        uint16_t best_time     = 0U;
+
+        if (item_at(0)->time <= time_left)
+        {
+            result = true;
+        }
+        else
+        {
+            for (uint32_t i = 1; i < m_queued_count; i++)
+            {
+                uint16_t time = item_at(i)->time;
+
+                if ((time <= time_left) && (time > best_time) && item_can_advance(i))
+                {
+                    best_position = i;
+                    best_time     = time;
+                }
+            }
+        }
+
+        if (best_position > 0U)
+        {
+            item_move_to_front(best_position);
+            result = true;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+#endif // NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED
+
+bool nrf_802154_tx_queue_is_empty(void)
+{
+    return nrf_802154_queue_is_empty(&m_tx_queue);
+}
+
+uint32_t nrf_802154_tx_queue_duration_get(void)
+{
+    return m_queued_time;
+}
+
+void nrf_802154_tx_queue_flush(void)
+{
+    const uint8_t * p_data;
+    bool            cca;
+
+    if (m_flush_in_progress)
+    {
+        return;
+    }
+
+    m_flush_in_progress = true;
+
+    while (nrf_802154_tx_queue_pop(&p_data, &cca))
+    {
+        nrf_802154_notify_transmit_failed(p_data, NRF_802154_TX_ERROR_ABORTED);
+    }
+
+    m_flush_in_progress = false;
+}
+
+void nrf_802154_tx_queue_in_flight_set(const uint8_t * p_data)
+{
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+    const uint8_t * p_addr = NULL;
+
+    if (p_data != NULL)
+    {
+        p_addr = nrf_802154_frame_parser_dst_addr_get(p_data, &m_in_flight_dst_extended);
+    }
+
+    if (p_addr != NULL)
+    {
+        memcpy(m_in_flight_dst,
+               p_addr,
+               m_in_flight_dst_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+        mp_in_flight_dst = m_in_flight_dst;
+    }
+    else
+    {
+        mp_in_flight_dst = NULL;
+    }
+#endif
+
+    mp_in_flight = p_data;
+}
+
+bool nrf_802154_tx_queue_in_flight_is_set(void)
+{
+    return mp_in_flight != NULL;
+}
+
+void nrf_802154_tx_queue_failed_flush(const uint8_t * p_data)
+{
+    if (p_data != mp_in_flight)
+    {
+        // The failed frame was not passed to the queue.
+        return;
+    }
+
+    mp_in_flight = NULL;
+
+#if NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+    tx_queue_item_t item;
+    uint8_t         dst[EXTENDED_ADDRESS_SIZE];
+    const uint8_t * p_dst    = NULL;
+    bool            extended = m_in_flight_dst_extended;
+
+    if (m_flush_in_progress)
+    {
+        return;
+    }
+
+    m_flush_in_progress = true;
+
+    // The notifications below may set another frame in flight.
+    if (mp_in_flight_dst != NULL)
+    {
+        memcpy(dst, m_in_flight_dst, sizeof(dst));
+        p_dst = dst;
+    }
+
+    // Frames to other destinations are still to be transmitted.
+    while (item_destination_pop(p_dst, extended, &item))
+    {
+        nrf_802154_notify_transmit_failed(item.p_data, NRF_802154_TX_ERROR_ABORTED);
+    }
+
+    m_flush_in_progress = false;
+#else
+    nrf_802154_tx_queue_flush();
+#endif
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file contains the declarations of the transmit queue used to send frames back-to-back.
+ *
+ * @defgroup nrf_802154_tx_queue Transmit queue
+ * @{
+ * @ingroup nrf_802154
+ * @brief Queue of frames to be transmitted after the current transmission.
+ *
+ * Frames in the queue wait for the end of the transmission that is in progress. When it ends
+ * successfully, the core starts the next queued frame immediately. When the transmission of
+ * a frame passed to the queue fails, the frames still waiting in the queue are dropped and
+ * reported as aborted. Failures of other transmissions, like delayed ones, do not affect
+ * the queue. If @ref NRF_802154_TX_QUEUE_FAIRNESS_ENABLED is set, only the frames to the
+ * destination of the failed frame are dropped, and the core starts the next queued frame once
+ * the receiver is enabled again.
+ */
+
+#ifndef NRF_802154_TX_QUEUE_H_
+#define NRF_802154_TX_QUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+
+/**
+ * @brief Initializes the transmit queue.
+ */
+void nrf_802154_tx_queue_init(void);
+
+/**
+ * @brief Adds a frame at the end of the transmit queue.
+ *
+ * If @ref NRF_802154_TX_QUEUE_PRIORITY_ENABLED is set, the frame is added after the frames of its
+ * priority class that precede it, as described in @ref nrf_802154_tx_queue_params_t.
+ *
+ * @param[in]  p_data          Pointer to a buffer that contains PHR and PSDU of the frame to
+ *                             transmit.
+ * @param[in]  cca             If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  p_queue_params  Pointer to the queue parameters of the frame, or NULL to use
+ *                             the default priority class without a deadline.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full.
+ */
+bool nrf_802154_tx_queue_push(const uint8_t                      * p_data,
+                              bool                                 cca,
+                              const nrf_802154_tx_queue_params_t * p_queue_params);
+
+/**
+ * @brief Adds a burst of frames at the end of the transmit queue.
+ *
+ * Either all frames are added or none of them.
+ *
+ * @param[in]  pp_data  Array of pointers to buffers that contain PHR and PSDU of the frames.
+ * @param[in]  count    Number of frames in @p pp_data.
+ * @param[in]  cca      If the driver is to perform a CCA procedure before each transmission.
+ *
+ * @retval  true   The frames were added to the queue.
+ * @retval  false  There is not enough space in the queue for all the frames.
+ */
+bool nrf_802154_tx_queue_burst_push(const uint8_t * const * pp_data, uint8_t count, bool cca);
+
+/**
+ * @brief Removes the first frame from the transmit queue.
+ *
+ * If @ref NRF_802154_TX_QUEUE_PRIORITY_ENABLED is set, the frames that can no longer be
+ * transmitted by their deadlines are dropped from the front of the queue first, and the higher
+ * layer is notified with @ref NRF_802154_TX_ERROR_DEADLINE_MISSED about each of them.
+ *
+ * @param[out]  pp_data  Pointer to the frame removed from the queue.
+ * @param[out]  p_cca    If CCA was requested for the frame removed from the queue.
+ *
+ * @retval  true   A frame was removed from the queue.
+ * @retval  false  The queue is empty.
+ */
+bool nrf_802154_tx_queue_pop(const uint8_t ** pp_data, bool * p_cca);
+
+#if NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED
+
+/**
+ * @brief Moves a frame that fits in the given time to the front of the transmit queue.
+ *
+ * If the first frame does not fit, the largest frame that fits and has no frame queued before it
+ * for the same destination is moved to the front. The order of the other frames is kept.
+ *
+ * @param[in]  time_left  Time available for the transmission in microseconds.
+ *
+ * @retval  true   The first frame in the queue fits in @p time_left.
+ * @retval  false  No frame that can be moved fits in @p time_left, the queue is not changed.
+ */
+bool nrf_802154_tx_queue_fitting_frame_advance(uint32_t time_left);
+
+#endif // NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED
+
+/**
+ * @brief Checks if the transmit queue is empty.
+ *
+ * @retval  true   There are no frames waiting in the queue.
+ * @retval  false  There is at least one frame waiting in the queue.
+ */
+bool nrf_802154_tx_queue_is_empty(void);
+
+/**
+ * @brief Gets the radio time needed to transmit all frames waiting in the transmit queue.
+ *
+ * The time includes the CCA procedures and the ACKs requested by the frames, as calculated by
+ * @ref nrf_802154_tx_duration_get.
+ *
+ * @returns  Time in microseconds, or 0 if the queue is empty.
+ */
+uint32_t nrf_802154_tx_queue_duration_get(void);
+
+/**
+ * @brief Drops all frames waiting in the transmit queue.
+ *
+ * The higher layer is notified with @ref NRF_802154_TX_ERROR_ABORTED about each dropped frame.
+ */
+void nrf_802154_tx_queue_flush(void);
+
+/**
+ * @brief Sets the frame passed to the queue whose transmission is started by the core.
+ *
+ * @param[in]  p_data  Pointer to a buffer containing PHR and PSDU of the frame taken from
+ *                     the queue or started at once by a request to enqueue it, or NULL if
+ *                     no such frame is being transmitted. If
+ *                     @ref NRF_802154_TX_QUEUE_FAIRNESS_ENABLED is set, the destination address
+ *                     of the frame is copied.
+ */
+void nrf_802154_tx_queue_in_flight_set(const uint8_t * p_data);
+
+/**
+ * @brief Checks if a frame passed to the queue is being transmitted.
+ *
+ * @retval  true   A frame set with @ref nrf_802154_tx_queue_in_flight_set is being transmitted.
+ * @retval  false  No frame passed to the queue is being transmitted.
+ */
+bool nrf_802154_tx_queue_in_flight_is_set(void);
+
+/**
+ * @brief Drops the frames that are not to be transmitted after a failed transmission.
+ *
+ * Nothing is dropped unless @p p_data is the frame set with
+ * @ref nrf_802154_tx_queue_in_flight_set. If @ref NRF_802154_TX_QUEUE_FAIRNESS_ENABLED is set,
+ * only the frames to the destination of @p p_data are dropped. Otherwise, all frames are dropped
+ * as in @ref nrf_802154_tx_queue_flush.
+ * The higher layer is notified with @ref NRF_802154_TX_ERROR_ABORTED about each dropped frame.
+ *
+ * The buffer pointed by @p p_data is not accessed, so the function can be called after the frame
+ * is handed back to the higher layer.
+ *
+ * @param[in]  p_data  Pointer to a buffer containing PHR and PSDU of the frame whose transmission
+ *                     failed.
+ */
+void nrf_802154_tx_queue_failed_flush(const uint8_t * p_data);
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
+
+#endif // NRF_802154_TX_QUEUE_H_
+
+/** @} */
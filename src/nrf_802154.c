@@ -35,7 +35,8 @@
  *
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_APPLICATION
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_APPLICATION
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_APPLICATION_LOG_VERBOSITY
 
 #include "nrf_802154.h"
 
@@ -48,15 +49,21 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_core.h"
+#include "nrf_802154_capture_ring.h"
+#include "nrf_802154_rssi_ring.h"
+#include "nrf_802154_header_ring.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_nrfx_addons.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_random_pool.h"
 #include "nrf_802154_request.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_stats.h"
+#include "nrf_802154_tx_buffer.h"
+#include "nrf_802154_utils.h"
 #include "hal/nrf_radio.h"
 #include "platform/clock/nrf_802154_clock.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
@@ -69,15 +76,45 @@
 #include "timer/nrf_802154_timer_sched.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_csl_tx.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_duplicate_filter.h"
+#include "mac_features/nrf_802154_encrypt.h"
+#include "mac_features/nrf_802154_link_metrics.h"
+#include "mac_features/nrf_802154_peer_table.h"
+#include "mac_features/nrf_802154_filter.h"
+#include "mac_features/nrf_802154_retransmission.h"
+#include "mac_features/nrf_802154_security_pib.h"
+#include "mac_features/nrf_802154_rx_hopping.h"
+#include "mac_features/nrf_802154_tsch_slotframe.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_indirect_queue.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
+#include "mac_features/ack_generator/nrf_802154_enh_ack_generator.h"
 
 #include "nrf_802154_sl_ant_div.h"
 
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
 
+/**
+ * @brief Check if the given receive buffer contains a frame that has not been freed yet.
+ *
+ * @param[in]  p_data  Pointer to the buffer (PHR + PSDU) passed to the higher layer.
+ */
+static inline bool rx_buffer_is_in_use(const uint8_t * p_data)
+{
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+    if (nrf_802154_rx_buffer_is_small(p_data))
+    {
+        return !nrf_802154_rx_buffer_small_is_free(p_data);
+    }
+#endif
+
+    return !nrf_802154_rx_buffer_is_free((const rx_buffer_t *)p_data);
+}
+
 #if !NRF_802154_USE_RAW_API
 /** Static transmit buffer used by @sa nrf_802154_transmit() family of functions.
  *
@@ -104,12 +141,26 @@ static void tx_buffer_fill(const uint8_t * p_data, uint8_t length)
 
 #endif // !NRF_802154_USE_RAW_API
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+static bool m_pib_transaction_active; ///< If a PIB transaction is in progress.
+static bool m_pib_channel_changed;    ///< If the channel was changed within the PIB transaction.
+static bool m_pib_cca_changed;        ///< If the CCA configuration was changed within the PIB transaction.
+#endif
+
 void nrf_802154_channel_set(uint8_t channel)
 {
     bool changed = nrf_802154_pib_channel_get() != channel;
 
     nrf_802154_pib_channel_set(channel);
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+    if (m_pib_transaction_active)
+    {
+        m_pib_channel_changed |= changed;
+        return;
+    }
+#endif
+
     if (changed)
     {
         nrf_802154_request_channel_update();
@@ -121,6 +172,35 @@ uint8_t nrf_802154_channel_get(void)
     return nrf_802154_pib_channel_get();
 }
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+void nrf_802154_pib_transaction_begin(void)
+{
+    assert(!m_pib_transaction_active);
+
+    m_pib_channel_changed    = false;
+    m_pib_cca_changed        = false;
+    m_pib_transaction_active = true;
+}
+
+bool nrf_802154_pib_transaction_commit(void)
+{
+    bool result = true;
+
+    assert(m_pib_transaction_active);
+
+    m_pib_transaction_active = false;
+
+    if (m_pib_channel_changed || m_pib_cca_changed)
+    {
+        result = nrf_802154_request_pib_update(m_pib_channel_changed);
+    }
+
+    return result;
+}
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
 void nrf_802154_tx_power_set(int8_t power)
 {
     nrf_802154_pib_tx_power_set(power);
@@ -131,6 +211,22 @@ int8_t nrf_802154_tx_power_get(void)
     return nrf_802154_pib_tx_power_get();
 }
 
+void nrf_802154_tx_power_refresh(void)
+{
+    nrf_802154_pib_tx_power_refresh();
+}
+
+bool nrf_802154_fem_activation_delay_set(uint8_t pa_delay_us, uint8_t lna_delay_us)
+{
+    return nrf_802154_pib_fem_activation_delay_set(pa_delay_us, lna_delay_us);
+}
+
+void nrf_802154_fem_activation_delay_get(uint8_t * p_pa_delay_us, uint8_t * p_lna_delay_us)
+{
+    *p_pa_delay_us  = nrf_802154_pib_fem_pa_activation_delay_get();
+    *p_lna_delay_us = nrf_802154_pib_fem_lna_activation_delay_get();
+}
+
 bool nrf_802154_coex_rx_request_mode_set(nrf_802154_coex_rx_request_mode_t mode)
 {
     return nrf_802154_pib_coex_rx_request_mode_set(mode);
@@ -153,6 +249,7 @@ nrf_802154_coex_tx_request_mode_t nrf_802154_coex_tx_request_mode_get(void)
 
 void nrf_802154_temperature_changed(void)
 {
+    nrf_802154_rssi_temperature_update();
     nrf_802154_request_cca_cfg_update();
 }
 
@@ -171,6 +268,20 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
     nrf_802154_pib_short_address_set(p_short_address);
 }
 
+#if NRF_802154_PAN_CONTEXTS > 1
+
+bool nrf_802154_pan_context_set(uint8_t id, const nrf_802154_pan_context_t * p_context)
+{
+    return nrf_802154_pib_pan_context_set(id, p_context);
+}
+
+void nrf_802154_pan_context_clear(uint8_t id)
+{
+    nrf_802154_pib_pan_context_clear(id);
+}
+
+#endif // NRF_802154_PAN_CONTEXTS > 1
+
 int8_t nrf_802154_dbm_from_energy_level_calculate(uint8_t energy_level)
 {
     return ED_MIN_DBM + (energy_level / ED_RESULT_FACTOR);
@@ -190,6 +301,35 @@ uint32_t nrf_802154_first_symbol_timestamp_get(uint32_t end_timestamp, uint8_t p
     return end_timestamp - (frame_symbols * PHY_US_PER_SYMBOL);
 }
 
+#if NRF_802154_DEFERRED_INIT_ENABLED
+
+#define INIT_STEPS_NUM 2 ///< Initialization steps: the synchronous part and the LP timer start.
+
+static volatile uint8_t m_init_steps_pending; ///< Number of initialization steps not completed.
+
+/** @brief Completes one initialization step and notifies the readiness after the last one. */
+static void init_step_complete(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         steps_pending;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    steps_pending = --m_init_steps_pending;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (steps_pending == 0U)
+    {
+        nrf_802154_ready();
+    }
+}
+
+void nrf_802154_lp_timer_ready(void)
+{
+    init_step_complete();
+}
+
+#endif // NRF_802154_DEFERRED_INIT_ENABLED
+
 void nrf_802154_init(void)
 {
     nrf_802154_sl_crit_sect_interface_t crit_sect_int =
@@ -198,23 +338,65 @@ void nrf_802154_init(void)
         .exit  = nrf_802154_critical_section_exit
     };
 
+#if NRF_802154_DEFERRED_INIT_ENABLED
+    m_init_steps_pending = INIT_STEPS_NUM;
+#endif
+
+    // The LFCLK is requested first, so that it starts while the rest of the driver is initialized.
+    nrf_802154_clock_init();
+    nrf_802154_lp_timer_init();
     nrf_802154_ack_data_init();
     nrf_802154_core_init();
-    nrf_802154_clock_init();
     nrf_802154_critical_section_init();
     nrf_802154_debug_init();
     nrf_802154_notification_init();
-    nrf_802154_lp_timer_init();
     nrf_802154_pib_init();
     nrf_802154_rsch_prio_drop_init();
     nrf_802154_random_init();
+    nrf_802154_random_pool_init();
     nrf_802154_request_init();
     nrf_802154_rsch_crit_sect_init(&crit_sect_int);
     nrf_802154_rsch_init();
     nrf_802154_rx_buffer_init();
     nrf_802154_temperature_init();
+    nrf_802154_rssi_temperature_update();
     nrf_802154_timer_coord_init();
     nrf_802154_timer_sched_init();
+#if NRF_802154_TX_BUFFERS > 0
+    nrf_802154_tx_buffer_pool_init();
+#endif
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    nrf_802154_tx_queue_init();
+#endif
+#if NRF_802154_INDIRECT_QUEUE_SIZE > 0
+    nrf_802154_indirect_queue_init();
+#endif
+#if NRF_802154_DUPLICATE_FILTER_ENABLED
+    nrf_802154_duplicate_filter_init();
+#endif
+#if NRF_802154_PEER_TABLE_ENABLED
+    nrf_802154_peer_table_init();
+#endif
+#if NRF_802154_CSL_TX_ENABLED
+    nrf_802154_csl_tx_init();
+#endif
+#if NRF_802154_LINK_METRICS_ENABLED
+    nrf_802154_link_metrics_init();
+#endif
+#if NRF_802154_ENCRYPTION_ENABLED
+    nrf_802154_security_pib_init();
+    nrf_802154_encrypt_init();
+#endif
+#if NRF_802154_TRACE_EXPORT_ENABLED
+    nrf_802154_trace_export_init();
+#endif
+#if NRF_802154_IRQ_PROFILER_ENABLED
+    nrf_802154_stat_irq_cycles_init();
+#endif
+
+#if NRF_802154_DEFERRED_INIT_ENABLED
+    init_step_complete();
+#endif
 }
 
 void nrf_802154_deinit(void)
@@ -229,6 +411,113 @@ void nrf_802154_deinit(void)
     nrf_802154_core_deinit();
 }
 
+#if NRF_802154_WARM_START_ENABLED
+
+#define WARM_START_SNAPSHOT_VERSION 1 ///< Version of the warm start snapshot format.
+
+/** @brief Header of the warm start snapshot, followed by the PIB and the ACK data. */
+typedef struct
+{
+    uint16_t version;       ///< Version of the snapshot format.
+    uint16_t checksum;      ///< Fletcher-16 checksum of the PIB and the ACK data.
+    uint32_t pib_size;      ///< Size of the PIB part.
+    uint32_t ack_data_size; ///< Size of the ACK data part.
+} warm_start_header_t;
+
+/**
+ * @brief Calculates the Fletcher-16 checksum of a buffer.
+ *
+ * @param[in]  p_data  Pointer to the buffer.
+ * @param[in]  length  Length of the buffer.
+ *
+ * @returns  Checksum of the buffer.
+ */
+static uint16_t warm_start_checksum(const uint8_t * p_data, uint32_t length)
+{
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        sum1 = (sum1 + p_data[i]) % UINT8_MAX;
+        sum2 = (sum2 + sum1) % UINT8_MAX;
+    }
+
+    return (uint16_t)((sum2 << 8) | sum1);
+}
+
+uint32_t nrf_802154_warm_start_snapshot_max_size_get(void)
+{
+    return sizeof(warm_start_header_t) + nrf_802154_pib_snapshot_size_get() +
+           nrf_802154_ack_data_snapshot_max_size_get();
+}
+
+uint32_t nrf_802154_warm_start_snapshot_get(uint8_t * p_buffer, uint32_t size)
+{
+    warm_start_header_t header;
+    uint8_t           * p_payload = p_buffer + sizeof(header);
+
+    header.pib_size = nrf_802154_pib_snapshot_size_get();
+
+    if (size < sizeof(header) + header.pib_size)
+    {
+        return 0;
+    }
+
+    nrf_802154_pib_snapshot_save(p_payload);
+
+    header.ack_data_size = nrf_802154_ack_data_snapshot_save(p_payload + header.pib_size,
+                                                             size - sizeof(header) -
+                                                             header.pib_size);
+
+    if (header.ack_data_size == 0)
+    {
+        return 0;
+    }
+
+    header.version  = WARM_START_SNAPSHOT_VERSION;
+    header.checksum = warm_start_checksum(p_payload, header.pib_size + header.ack_data_size);
+
+    memcpy(p_buffer, &header, sizeof(header));
+
+    return sizeof(header) + header.pib_size + header.ack_data_size;
+}
+
+bool nrf_802154_init_warm(const uint8_t * p_snapshot, uint32_t length)
+{
+    warm_start_header_t header;
+    const uint8_t     * p_payload = p_snapshot + sizeof(header);
+
+    nrf_802154_init();
+
+    if ((p_snapshot == NULL) || (length < sizeof(header)))
+    {
+        return false;
+    }
+
+    memcpy(&header, p_snapshot, sizeof(header));
+
+    // The sizes of the parts depend on the driver configuration and detect its mismatch.
+    if ((header.version != WARM_START_SNAPSHOT_VERSION) ||
+        (header.pib_size != nrf_802154_pib_snapshot_size_get()) ||
+        (length != sizeof(header) + header.pib_size + header.ack_data_size) ||
+        (header.checksum != warm_start_checksum(p_payload, header.pib_size + header.ack_data_size)))
+    {
+        return false;
+    }
+
+    if (!nrf_802154_ack_data_snapshot_restore(p_payload + header.pib_size, header.ack_data_size))
+    {
+        return false;
+    }
+
+    nrf_802154_pib_snapshot_restore(p_payload);
+
+    return true;
+}
+
+#endif // NRF_802154_WARM_START_ENABLED
+
 bool nrf_802154_antenna_diversity_rx_mode_set(nrf_802154_sl_ant_div_mode_t mode)
 {
     bool result = false;
@@ -316,6 +605,24 @@ nrf_802154_sl_ant_div_antenna_t nrf_802154_antenna_diversity_last_rx_best_antenn
     return nrf_802154_sl_ant_div_last_rx_best_antenna_get();
 }
 
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+uint8_t nrf_802154_antenna_diversity_ed_result_get(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    return nrf_802154_core_ed_antenna_result_get(antenna);
+}
+
+#endif
+
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+void nrf_802154_energy_detection_result_get(nrf_802154_ed_result_t * p_result)
+{
+    assert(p_result != NULL);
+
+    nrf_802154_core_ed_result_get(p_result);
+}
+
+#endif
+
 void nrf_802154_antenna_diversity_config_set(const nrf_802154_sl_ant_div_cfg_t * p_cfg)
 {
 #if defined(RADIO_INTENSET_SYNC_Msk)
@@ -401,6 +708,16 @@ nrf_802154_sleep_error_t nrf_802154_sleep_if_idle(void)
     return result;
 }
 
+bool nrf_802154_post_tx_state_set(nrf_802154_post_tx_state_t state, uint32_t rx_window_us)
+{
+    return nrf_802154_pib_post_tx_state_set(state, rx_window_us);
+}
+
+nrf_802154_post_tx_state_t nrf_802154_post_tx_state_get(void)
+{
+    return nrf_802154_pib_post_tx_state_get();
+}
+
 bool nrf_802154_receive(void)
 {
     bool result;
@@ -425,12 +742,33 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca)
                                          p_data,
                                          cca,
                                          false,
+                                         NULL,
                                          NULL);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
+bool nrf_802154_transmit_raw_ex(const uint8_t * p_data, const nrf_802154_tx_params_t * p_params)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(p_params != NULL);
+
+    result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                         REQ_ORIG_HIGHER_LAYER,
+                                         p_data,
+                                         p_params->cca,
+                                         false,
+                                         NULL,
+                                         p_params);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
 #else // NRF_802154_USE_RAW_API
 
 bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
@@ -445,6 +783,7 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
                                          m_tx_buffer,
                                          cca,
                                          false,
+                                         NULL,
                                          NULL);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -453,211 +792,1039 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
 
 #endif // NRF_802154_USE_RAW_API
 
-#if NRF_802154_DELAYED_TRX_ENABLED
-bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
-                                bool            cca,
-                                uint32_t        t0,
-                                uint32_t        dt,
-                                uint8_t         channel)
+#if NRF_802154_TX_BUFFERS > 0
+
+uint8_t * nrf_802154_tx_buffer_alloc(void)
+{
+    return nrf_802154_tx_buffer_pool_alloc();
+}
+
+bool nrf_802154_tx_buffer_submit(uint8_t * p_data, bool cca)
 {
     bool result;
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = nrf_802154_delayed_trx_transmit(p_data, cca, t0, dt, channel);
+    result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                         REQ_ORIG_HIGHER_LAYER,
+                                         p_data,
+                                         cca,
+                                         false,
+                                         NULL,
+                                         NULL);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
-bool nrf_802154_transmit_at_cancel(void)
+bool nrf_802154_tx_buffer_submit_segments(const nrf_802154_tx_segment_t * p_segments,
+                                          uint8_t                         count,
+                                          bool                            cca)
 {
-    bool result;
+    bool      result = false;
+    uint32_t  length = 0U;
+    uint8_t * p_data;
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = nrf_802154_delayed_trx_transmit_cancel();
+    for (uint8_t i = 0; i < count; i++)
+    {
+        length += p_segments[i].length;
+    }
+
+    p_data = ((length + FCS_SIZE) <= MAX_PACKET_SIZE) ? nrf_802154_tx_buffer_pool_alloc() : NULL;
+
+    if (p_data != NULL)
+    {
+        uint8_t * p_psdu = &p_data[PHR_SIZE];
+
+        p_data[PHR_OFFSET] = (uint8_t)(length + FCS_SIZE);
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            memcpy(p_psdu, p_segments[i].p_data, p_segments[i].length);
+            p_psdu += p_segments[i].length;
+        }
+
+        result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_HIGHER_LAYER,
+                                             p_data,
+                                             cca,
+                                             false,
+                                             NULL,
+                                             NULL);
+
+        if (!result)
+        {
+            nrf_802154_tx_buffer_pool_release(p_data);
+        }
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
-bool nrf_802154_receive_at(uint32_t t0,
-                           uint32_t dt,
-                           uint32_t timeout,
-                           uint8_t  channel)
+void nrf_802154_tx_buffer_free(uint8_t * p_data)
+{
+    nrf_802154_tx_buffer_pool_release(p_data);
+}
+
+#endif // NRF_802154_TX_BUFFERS > 0
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca)
 {
     bool result;
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = nrf_802154_delayed_trx_receive(t0, dt, timeout, channel);
+    result = nrf_802154_request_transmit_enqueue(p_data, cca, NULL);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
-bool nrf_802154_receive_at_cancel(void)
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+bool nrf_802154_transmit_raw_enqueue_ex(const uint8_t                      * p_data,
+                                        bool                                 cca,
+                                        const nrf_802154_tx_queue_params_t * p_queue_params)
 {
     bool result;
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = nrf_802154_delayed_trx_receive_cancel();
+    result = nrf_802154_request_transmit_enqueue(p_data, cca, p_queue_params);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
-#endif // NRF_802154_DELAYED_TRX_ENABLED
+#endif // NRF_802154_TX_QUEUE_PRIORITY_ENABLED
 
-bool nrf_802154_energy_detection(uint32_t time_us)
+bool nrf_802154_transmit_raw_burst(const uint8_t * const * pp_data, uint8_t count, bool cca)
 {
     bool result;
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = nrf_802154_request_energy_detection(NRF_802154_TERM_NONE, time_us);
+    result = nrf_802154_request_transmit_burst(pp_data, count, cca);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
-bool nrf_802154_cca(void)
-{
-    bool result;
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
 
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+#if NRF_802154_INDIRECT_QUEUE_SIZE > 0
 
-    result = nrf_802154_request_cca(NRF_802154_TERM_NONE);
+bool nrf_802154_transmit_raw_indirect(const uint8_t * p_data)
+{
+    return nrf_802154_indirect_queue_push(p_data);
+}
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-    return result;
+bool nrf_802154_transmit_indirect_cancel(const uint8_t * p_data)
+{
+    return nrf_802154_indirect_queue_remove(p_data);
 }
 
-bool nrf_802154_continuous_carrier(void)
+#endif // NRF_802154_INDIRECT_QUEUE_SIZE > 0
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+/**
+ * @brief Converts 64-bit time to the base and delta used by the Timer Scheduler.
+ *
+ * @param[in]   time  Time to convert, in the time base of @ref nrf_802154_time64_get.
+ * @param[out]  p_t0  Base of the time - current Timer Scheduler time.
+ * @param[out]  p_dt  Delta of the time from @p p_t0.
+ *
+ * @retval  true   The time was converted.
+ * @retval  false  The time is in the past or too far in the future for the Timer Scheduler.
+ */
+static bool time64_to_sched_time(uint64_t time, uint32_t * p_t0, uint32_t * p_dt)
 {
-    bool result;
+    uint64_t now = nrf_802154_lp_timer_time64_get();
 
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    if ((time <= now) || ((time - now) > (uint64_t)INT32_MAX))
+    {
+        return false;
+    }
 
-    result = nrf_802154_request_continuous_carrier(NRF_802154_TERM_NONE);
+    *p_t0 = (uint32_t)now;
+    *p_dt = (uint32_t)(time - now);
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-    return result;
+    return true;
 }
 
-bool nrf_802154_modulated_carrier(const uint8_t * p_data)
+bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
+                                bool            cca,
+                                uint32_t        t0,
+                                uint32_t        dt,
+                                uint8_t         channel)
 {
     bool result;
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = nrf_802154_request_modulated_carrier(NRF_802154_TERM_NONE, p_data);
+    result = nrf_802154_delayed_trx_transmit(p_data, cca, t0, dt, channel);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
-#if NRF_802154_USE_RAW_API
-
-void nrf_802154_buffer_free_raw(uint8_t * p_data)
+bool nrf_802154_transmit_raw_at_ex(const uint8_t                * p_data,
+                                   uint32_t                       t0,
+                                   uint32_t                       dt,
+                                   const nrf_802154_tx_params_t * p_params)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    bool result;
 
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+    assert(p_params != NULL);
 
-    result = nrf_802154_request_buffer_free(p_data);
-    assert(result);
-    (void)result;
+    result = nrf_802154_delayed_trx_transmit_ex(p_data, t0, dt, p_params);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
 }
 
-bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
+bool nrf_802154_transmit_raw_at64(const uint8_t * p_data,
+                                  bool            cca,
+                                  uint64_t        tx_time,
+                                  uint8_t         channel)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
-
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+    bool     result = false;
+    uint32_t t0;
+    uint32_t dt;
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = nrf_802154_request_buffer_free(p_data);
+    if (time64_to_sched_time(tx_time, &t0, &dt))
+    {
+        result = nrf_802154_delayed_trx_transmit(p_data, cca, t0, dt, channel);
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return result;
 }
 
-#else // NRF_802154_USE_RAW_API
+#if NRF_802154_CSL_TX_ENABLED
 
-void nrf_802154_buffer_free(uint8_t * p_data)
+bool nrf_802154_transmit_csl(const uint8_t * p_data, bool cca)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    bool     result = false;
+    uint64_t tx_time;
+    uint32_t t0;
+    uint32_t dt;
 
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+    if (nrf_802154_csl_tx_time_get(p_data,
+                                   nrf_802154_lp_timer_time64_get() + NRF_802154_CSL_TX_LEAD_TIME,
+                                   &tx_time) &&
+        time64_to_sched_time(tx_time, &t0, &dt))
+    {
+        result = nrf_802154_delayed_trx_transmit(p_data,
+                                                 cca,
+                                                 t0,
+                                                 dt,
+                                                 nrf_802154_pib_channel_get());
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_CSL_TX_ENABLED
+
+bool nrf_802154_transmit_at_cancel(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_transmit_cancel();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_transmit_at_frame_cancel(const uint8_t * p_data)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_transmit_frame_cancel(p_data);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_at(uint32_t t0,
+                           uint32_t dt,
+                           uint32_t timeout,
+                           uint8_t  channel)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_receive(t0, dt, timeout, channel);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_at64(uint64_t rx_time, uint32_t timeout, uint8_t channel)
+{
+    bool     result = false;
+    uint32_t t0;
+    uint32_t dt;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (time64_to_sched_time(rx_time, &t0, &dt))
+    {
+        result = nrf_802154_delayed_trx_receive(t0, dt, timeout, channel);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_at_cancel(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_receive_cancel();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_at_window_cancel(uint32_t t0, uint32_t dt)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_receive_window_cancel(t0, dt);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_energy_detection_at(uint32_t t0, uint32_t dt, uint8_t channel, uint32_t time_us)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_energy_detection(t0, dt, time_us, channel);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_cca_at(uint32_t t0, uint32_t dt, uint8_t channel)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_cca(t0, dt, channel);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_measurement_at_cancel(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_measure_cancel();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_periodic(uint32_t period,
+                                 uint32_t window,
+                                 uint32_t phase,
+                                 uint8_t  channel)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_receive_periodic(period, window, phase, channel);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_periodic_stop(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_receive_periodic_stop();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_beacon_periodic_start(uint8_t                      * p_data,
+                                      uint32_t                       period,
+                                      uint32_t                       t0,
+                                      bool                           dsn_update,
+                                      const nrf_802154_tx_params_t * p_params)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_beacon_periodic_start(p_data, period, t0, dsn_update, p_params);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_beacon_periodic_stop(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_delayed_trx_beacon_periodic_stop();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+void nrf_802154_delayed_setup_times_get(uint32_t * p_tx_setup_time, uint32_t * p_rx_setup_time)
+{
+    nrf_802154_delayed_trx_setup_times_get(p_tx_setup_time, p_rx_setup_time);
+}
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+
+#if NRF_802154_TSCH_ENABLED
+
+bool nrf_802154_tsch_start(const nrf_802154_tsch_config_t * p_config)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_tsch_slotframe_start(p_config);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_tsch_stop(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_tsch_slotframe_stop();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_tsch_cell_add(const nrf_802154_tsch_cell_t * p_cell)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_tsch_slotframe_cell_add(p_cell);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_tsch_cell_remove(uint16_t slot_offset)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_tsch_slotframe_cell_remove(slot_offset);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_tsch_cell_frame_set(uint16_t slot_offset, const uint8_t * p_data)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_tsch_slotframe_cell_frame_set(slot_offset, p_data);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_RX_HOPPING_ENABLED
+
+bool nrf_802154_rx_hopping_start(const nrf_802154_rx_hop_t * p_hops, uint8_t count)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_rx_hopping_schedule_start(p_hops, count);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_rx_hopping_stop(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_rx_hopping_schedule_stop();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+bool nrf_802154_sleep_async(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_sleep_async(NRF_802154_TERM_802154);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_async(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_receive_async(NRF_802154_TERM_802154, REQ_ORIG_HIGHER_LAYER);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#if NRF_802154_USE_RAW_API
+bool nrf_802154_transmit_raw_async(const uint8_t * p_data, bool cca)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_transmit_async(NRF_802154_TERM_NONE,
+                                               REQ_ORIG_HIGHER_LAYER,
+                                               p_data,
+                                               cca,
+                                               false);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_USE_RAW_API
+
+bool nrf_802154_channel_set_async(uint8_t channel)
+{
+    bool result  = true;
+    bool changed = nrf_802154_pib_channel_get() != channel;
+
+    nrf_802154_pib_channel_set(channel);
+
+    if (changed)
+    {
+        result = nrf_802154_request_channel_update_async();
+    }
+
+    return result;
+}
+
+bool nrf_802154_cca_cfg_set_async(const nrf_802154_cca_cfg_t * p_cca_cfg)
+{
+    nrf_802154_pib_cca_cfg_set(p_cca_cfg);
+
+    return nrf_802154_request_cca_cfg_update_async();
+}
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
+bool nrf_802154_energy_detection(uint32_t time_us)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_energy_detection(NRF_802154_TERM_NONE, time_us, 0U);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_energy_detection_sweep(uint32_t channel_mask, uint32_t time_per_channel_us)
+{
+    bool result = false;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if ((channel_mask != 0U) && ((channel_mask & ~NRF_802154_ED_SWEEP_CHANNEL_MASK) == 0U))
+    {
+        result = nrf_802154_request_energy_detection(NRF_802154_TERM_NONE,
+                                                     time_per_channel_us,
+                                                     channel_mask);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#if NRF_802154_PASSIVE_ED_ENABLED
+
+bool nrf_802154_energy_detection_passive(uint32_t time_us)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_core_energy_detection_passive(time_us);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_PASSIVE_ED_ENABLED
+
+bool nrf_802154_cca(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_cca(NRF_802154_TERM_NONE);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+
+bool nrf_802154_low_power_listening(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_low_power_listening(NRF_802154_TERM_NONE);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_low_power_listening_cfg_set(uint32_t period_us,
+                                            uint32_t sample_us,
+                                            uint32_t hold_us)
+{
+    return nrf_802154_pib_lpl_cfg_set(period_us, sample_us, hold_us);
+}
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
+bool nrf_802154_continuous_carrier(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_continuous_carrier(NRF_802154_TERM_NONE);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_modulated_carrier(const uint8_t * p_data)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_modulated_carrier(NRF_802154_TERM_NONE, p_data);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+/** Free a receive buffer, without a request if the receiver does not wait for a buffer. */
+static bool buffer_free_immediately(uint8_t * p_data)
+{
+#if NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED
+    if (nrf_802154_core_buffer_free_fast(p_data))
+    {
+        return true;
+    }
+#endif
+
+    return nrf_802154_request_buffer_free(p_data);
+}
+
+#if NRF_802154_USE_RAW_API
+
+void nrf_802154_buffer_free_raw(uint8_t * p_data)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result;
+
+    assert(rx_buffer_is_in_use(p_data));
+
+    result = nrf_802154_request_buffer_free(p_data);
+    assert(result);
+    (void)result;
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result;
+
+    assert(rx_buffer_is_in_use(p_data));
+
+    result = buffer_free_immediately(p_data);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#else // NRF_802154_USE_RAW_API
+
+void nrf_802154_buffer_free(uint8_t * p_data)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result;
+
+    assert(rx_buffer_is_in_use(p_data - RAW_PAYLOAD_OFFSET));
+
+    result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
+    assert(result);
+    (void)result;
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result;
+
+    assert(rx_buffer_is_in_use(p_data - RAW_PAYLOAD_OFFSET));
+
+    result = buffer_free_immediately(p_data - RAW_PAYLOAD_OFFSET);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_USE_RAW_API
+
+bool nrf_802154_rssi_measure_begin(void)
+{
+    return nrf_802154_request_rssi_measure();
+}
+
+int8_t nrf_802154_rssi_last_get(void)
+{
+    int8_t result = 0;
+
+    if (!nrf_802154_request_rssi_measurement_get(&result))
+    {
+        result = NRF_802154_RSSI_INVALID;
+    }
+
+    return result;
+}
+
+bool nrf_802154_promiscuous_get(void)
+{
+    return nrf_802154_pib_promiscuous_get();
+}
+
+void nrf_802154_promiscuous_set(bool enabled)
+{
+    nrf_802154_pib_promiscuous_set(enabled);
+}
+
+#if NRF_802154_CAPTURE_ENABLED
+
+bool nrf_802154_capture_start(uint8_t * p_ring, uint32_t size)
+{
+    return nrf_802154_capture_ring_start(p_ring, size);
+}
+
+void nrf_802154_capture_stop(void)
+{
+    nrf_802154_capture_ring_stop();
+}
 
-    result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
-    assert(result);
-    (void)result;
+uint32_t nrf_802154_capture_read_get(const uint8_t ** pp_data)
+{
+    return nrf_802154_capture_ring_read_get(pp_data);
+}
+
+void nrf_802154_capture_read_commit(uint32_t length)
+{
+    nrf_802154_capture_ring_read_commit(length);
+}
+
+uint32_t nrf_802154_capture_dropped_get(void)
+{
+    return nrf_802154_capture_ring_dropped_get();
+}
+
+void nrf_802154_capture_pcap_header_get(uint8_t * p_header)
+{
+    nrf_802154_capture_ring_pcap_header_get(p_header);
+}
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
+#if NRF_802154_RSSI_STREAM_ENABLED
+
+bool nrf_802154_rssi_stream_start(nrf_802154_rssi_sample_t * p_samples,
+                                  uint32_t                   count,
+                                  uint32_t                   interval_us)
+{
+    if (!nrf_802154_rssi_ring_start(p_samples, count, interval_us))
+    {
+        return false;
+    }
+
+    nrf_802154_core_rssi_stream_start();
+
+    return true;
+}
+
+void nrf_802154_rssi_stream_stop(void)
+{
+    nrf_802154_rssi_ring_stop();
+}
+
+uint32_t nrf_802154_rssi_stream_read(nrf_802154_rssi_sample_t * p_samples, uint32_t max_count)
+{
+    return nrf_802154_rssi_ring_read(p_samples, max_count);
+}
+
+uint32_t nrf_802154_rssi_stream_dropped_get(void)
+{
+    return nrf_802154_rssi_ring_dropped_get();
+}
+
+#endif // NRF_802154_RSSI_STREAM_ENABLED
+
+#if NRF_802154_HEADER_MONITOR_ENABLED
+
+bool nrf_802154_header_monitor_start(nrf_802154_header_record_t * p_records, uint32_t count)
+{
+    return nrf_802154_header_ring_start(p_records, count);
+}
+
+void nrf_802154_header_monitor_stop(void)
+{
+    nrf_802154_header_ring_stop();
+}
+
+void nrf_802154_header_monitor_frames_retain_set(bool retain)
+{
+    nrf_802154_header_ring_frames_retain_set(retain);
+}
+
+uint32_t nrf_802154_header_monitor_read(nrf_802154_header_record_t * p_records,
+                                        uint32_t                     max_count)
+{
+    return nrf_802154_header_ring_read(p_records, max_count);
+}
+
+uint32_t nrf_802154_header_monitor_dropped_get(void)
+{
+    return nrf_802154_header_ring_dropped_get();
+}
+
+#endif // NRF_802154_HEADER_MONITOR_ENABLED
+
+#if NRF_802154_PER_TEST_ENABLED
+
+void nrf_802154_per_test_transmit_set(uint32_t count, uint32_t interval_us)
+{
+    nrf_802154_core_per_test_transmit_set(count, interval_us);
+}
+
+uint32_t nrf_802154_per_test_transmit_remaining_get(void)
+{
+    return nrf_802154_core_per_test_transmit_remaining_get();
+}
+
+void nrf_802154_per_test_receive_set(bool enabled)
+{
+    nrf_802154_core_per_test_receive_set(enabled);
+}
+
+void nrf_802154_per_test_receive_counters_get(uint32_t * p_crcok, uint32_t * p_crcerror)
+{
+    nrf_802154_core_per_test_receive_counters_get(p_crcok, p_crcerror);
+}
+
+#endif // NRF_802154_PER_TEST_ENABLED
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+void nrf_802154_src_addr_filter_mode_set(nrf_802154_src_addr_filter_mode_t mode)
+{
+    nrf_802154_filter_src_addr_mode_set(mode);
+}
+
+bool nrf_802154_src_addr_filter_add(const uint8_t * p_addr, bool extended)
+{
+    return nrf_802154_filter_src_addr_add(p_addr, extended);
+}
+
+bool nrf_802154_src_addr_filter_remove(const uint8_t * p_addr, bool extended)
+{
+    return nrf_802154_filter_src_addr_remove(p_addr, extended);
+}
+
+void nrf_802154_src_addr_filter_reset(bool extended)
+{
+    nrf_802154_filter_src_addr_reset(extended);
+}
+
+#endif // NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+#if NRF_802154_PEER_TABLE_ENABLED
+
+uint8_t nrf_802154_peers_get(nrf_802154_peer_info_t * p_peers, uint8_t max_count)
+{
+    uint8_t result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_peer_table_read(p_peers, max_count);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
 }
 
-bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
+void nrf_802154_peers_clear(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    bool          result;
-    rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
+    nrf_802154_peer_table_clear();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
 
-    assert(p_buffer->free == false);
-    (void)p_buffer;
+#endif // NRF_802154_PEER_TABLE_ENABLED
 
-    result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
+#if NRF_802154_ENCRYPTION_ENABLED
+
+nrf_802154_security_error_t nrf_802154_security_key_store(const nrf_802154_key_t * p_key)
+{
+    nrf_802154_security_error_t result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_security_pib_key_store(p_key);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
     return result;
 }
 
-#endif // NRF_802154_USE_RAW_API
+nrf_802154_security_error_t nrf_802154_security_key_remove(const nrf_802154_key_id_t * p_id)
+{
+    nrf_802154_security_error_t result;
 
-bool nrf_802154_rssi_measure_begin(void)
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_security_pib_key_remove(p_id);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+void nrf_802154_security_key_remove_all(void)
 {
-    return nrf_802154_request_rssi_measure();
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_security_pib_key_remove_all();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-int8_t nrf_802154_rssi_last_get(void)
+nrf_802154_security_error_t nrf_802154_security_keys_set(const nrf_802154_key_t * p_keys,
+                                                         uint8_t                  count)
 {
-    int8_t result = 0;
+    nrf_802154_security_error_t result;
 
-    if (!nrf_802154_request_rssi_measurement_get(&result))
-    {
-        result = NRF_802154_RSSI_INVALID;
-    }
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_security_pib_keys_set(p_keys, count);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
     return result;
 }
 
-bool nrf_802154_promiscuous_get(void)
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter)
 {
-    return nrf_802154_pib_promiscuous_get();
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_security_pib_frame_counter_set(frame_counter);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_promiscuous_set(bool enabled)
+#endif // NRF_802154_ENCRYPTION_ENABLED
+
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+void nrf_802154_tx_dsn_set(uint8_t dsn)
 {
-    nrf_802154_pib_promiscuous_set(enabled);
+    nrf_802154_core_tx_dsn_set(dsn);
 }
 
+#endif // NRF_802154_TX_DSN_ASSIGN_ENABLED
+
 void nrf_802154_auto_ack_set(bool enabled)
 {
     nrf_802154_pib_auto_ack_set(enabled);
@@ -678,6 +1845,16 @@ void nrf_802154_pan_coord_set(bool enabled)
     nrf_802154_pib_pan_coord_set(enabled);
 }
 
+void nrf_802154_frame_type_filter_set(nrf_802154_frame_type_filter_t mask)
+{
+    nrf_802154_pib_frame_type_filter_set(mask);
+}
+
+nrf_802154_frame_type_filter_t nrf_802154_frame_type_filter_get(void)
+{
+    return nrf_802154_pib_frame_type_filter_get();
+}
+
 void nrf_802154_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method)
 {
     nrf_802154_ack_data_src_addr_matching_method_set(match_method);
@@ -699,6 +1876,32 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
     return nrf_802154_ack_data_for_addr_clear(p_addr, extended, data_type);
 }
 
+void nrf_802154_ack_ie_writer_set(nrf_802154_ack_ie_writer_t writer)
+{
+    nrf_802154_enh_ack_generator_ie_writer_set(writer);
+}
+
+void nrf_802154_pending_bit_decider_set(nrf_802154_pending_bit_decider_t decider)
+{
+    nrf_802154_ack_data_pending_bit_decider_set(decider);
+}
+
+#if NRF_802154_LINK_METRICS_ENABLED
+
+bool nrf_802154_link_metrics_initiator_configure(const uint8_t           * p_addr,
+                                                 bool                      extended,
+                                                 nrf_802154_link_metrics_t metrics)
+{
+    return nrf_802154_link_metrics_initiator_set(p_addr, extended, metrics);
+}
+
+void nrf_802154_link_metrics_reset(void)
+{
+    nrf_802154_link_metrics_initiators_clear();
+}
+
+#endif // NRF_802154_LINK_METRICS_ENABLED
+
 void nrf_802154_auto_pending_bit_set(bool enabled)
 {
     nrf_802154_ack_data_enable(enabled);
@@ -718,6 +1921,16 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
     return nrf_802154_ack_data_for_addr_clear(p_addr, extended, NRF_802154_ACK_DATA_PENDING_BIT);
 }
 
+bool nrf_802154_pending_bit_for_addr_set_bulk(uint8_t * p_addrs, uint32_t count, bool extended)
+{
+    return nrf_802154_ack_data_pending_bit_bulk_set(p_addrs, count, extended);
+}
+
+void nrf_802154_pending_bit_for_addr_clear_bulk(uint8_t * p_addrs, uint32_t count, bool extended)
+{
+    nrf_802154_ack_data_pending_bit_bulk_clear(p_addrs, count, extended);
+}
+
 void nrf_802154_pending_bit_for_addr_reset(bool extended)
 {
     nrf_802154_ack_data_reset(extended, NRF_802154_ACK_DATA_PENDING_BIT);
@@ -727,6 +1940,14 @@ void nrf_802154_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
 {
     nrf_802154_pib_cca_cfg_set(p_cca_cfg);
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+    if (m_pib_transaction_active)
+    {
+        m_pib_cca_changed = true;
+        return;
+    }
+#endif
+
     nrf_802154_request_cca_cfg_update();
 }
 
@@ -742,9 +1963,59 @@ void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    nrf_802154_csma_ca_start(p_data);
+    nrf_802154_random_pool_refill();
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_retransmission_start(p_data);
+#endif
+    nrf_802154_csma_ca_start(p_data, NULL);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+void nrf_802154_transmit_csma_ca_raw_ex(const uint8_t                * p_data,
+                                        const nrf_802154_tx_params_t * p_params)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(p_params != NULL);
+
+    nrf_802154_random_pool_refill();
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_retransmission_start(p_data);
+#endif
+    nrf_802154_csma_ca_start(p_data, p_params);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+bool nrf_802154_transmit_csma_ca_raw_at(const uint8_t                * p_data,
+                                        uint32_t                       t0,
+                                        uint32_t                       dt,
+                                        uint32_t                       window,
+                                        const nrf_802154_tx_params_t * p_params)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_random_pool_refill();
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_retransmission_start(p_data);
+#endif
+    result = nrf_802154_csma_ca_start_at(p_data, t0, dt, window, p_params);
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    if (!result)
+    {
+        (void)nrf_802154_retransmission_abort(NRF_802154_TERM_802154, REQ_ORIG_HIGHER_LAYER);
+    }
+#endif
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
 }
 
 #else // NRF_802154_USE_RAW_API
@@ -754,8 +2025,12 @@ void nrf_802154_transmit_csma_ca(const uint8_t * p_data, uint8_t length)
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
     tx_buffer_fill(p_data, length);
+    nrf_802154_random_pool_refill();
 
-    nrf_802154_csma_ca_start(m_tx_buffer);
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_retransmission_start(m_tx_buffer);
+#endif
+    nrf_802154_csma_ca_start(m_tx_buffer, NULL);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -803,6 +2078,25 @@ void nrf_802154_ack_timeout_set(uint32_t time)
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+#if NRF_802154_RETRANSMISSION_ENABLED
+
+bool nrf_802154_max_frame_retries_set(uint8_t max_retries)
+{
+    return nrf_802154_retransmission_max_retries_set(max_retries);
+}
+
+uint8_t nrf_802154_max_frame_retries_get(void)
+{
+    return nrf_802154_retransmission_max_retries_get();
+}
+
+uint8_t nrf_802154_transmit_attempts_get(void)
+{
+    return nrf_802154_retransmission_attempts_get();
+}
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 #if NRF_802154_IFS_ENABLED
 
 nrf_802154_ifs_mode_t nrf_802154_ifs_mode_get(void)
@@ -842,6 +2136,43 @@ uint32_t nrf_802154_time_get(void)
     return nrf_802154_timer_sched_time_get();
 }
 
+uint64_t nrf_802154_time64_get(void)
+{
+    return nrf_802154_lp_timer_time64_get();
+}
+
+bool nrf_802154_time_drift_get(int32_t * p_drift_ppb)
+{
+    return nrf_802154_timer_coord_drift_get(p_drift_ppb);
+}
+
+bool nrf_802154_next_event_time_get(uint32_t * p_time)
+{
+    uint32_t now    = nrf_802154_timer_sched_time_get();
+    bool     result = nrf_802154_timer_sched_next_expiration_get(p_time);
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+    uint32_t op_time;
+
+    // Times are compared relative to now to handle the timer wrap-around.
+    if (nrf_802154_delayed_trx_nearest_op_time_get(&op_time) &&
+        (!result || ((int32_t)(op_time - now) < (int32_t)(*p_time - now))))
+    {
+        *p_time = op_time;
+        result  = true;
+    }
+#else
+    (void)now;
+#endif
+
+    return result;
+}
+
+uint64_t nrf_802154_timestamp_to_time64(uint32_t timestamp)
+{
+    return nrf_802154_time64_extend(nrf_802154_lp_timer_time64_get(), timestamp);
+}
+
 __WEAK void nrf_802154_tx_ack_started(const uint8_t * p_data)
 {
     (void)p_data;
@@ -866,6 +2197,23 @@ __WEAK void nrf_802154_received_timestamp_raw(uint8_t * p_data,
     nrf_802154_buffer_free_raw(p_data);
 }
 
+__WEAK void nrf_802154_received_metadata_raw(uint8_t                        * p_data,
+                                             const nrf_802154_rx_metadata_t * p_metadata)
+{
+    nrf_802154_received_raw(p_data, p_metadata->power, p_metadata->lqi);
+}
+
+#if NRF_802154_RX_BATCH_NOTIFY_ENABLED
+__WEAK void nrf_802154_received_batch_raw(const nrf_802154_rx_frame_t * p_frames, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        nrf_802154_received_metadata_raw(p_frames[i].p_data, &p_frames[i].metadata);
+    }
+}
+
+#endif // NRF_802154_RX_BATCH_NOTIFY_ENABLED
+
 #else // NRF_802154_USE_RAW_API
 
 __WEAK void nrf_802154_received(uint8_t * p_data, uint8_t length, int8_t power, uint8_t lqi)
@@ -887,6 +2235,13 @@ __WEAK void nrf_802154_received_timestamp(uint8_t * p_data,
     nrf_802154_buffer_free(p_data);
 }
 
+__WEAK void nrf_802154_received_metadata(uint8_t                        * p_data,
+                                         uint8_t                          length,
+                                         const nrf_802154_rx_metadata_t * p_metadata)
+{
+    nrf_802154_received(p_data, length, p_metadata->power, p_metadata->lqi);
+}
+
 #endif // !NRF_802154_USE_RAW_API
 
 __WEAK void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
@@ -894,6 +2249,16 @@ __WEAK void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
     (void)error;
 }
 
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+__WEAK void nrf_802154_receive_failed_coalesced(nrf_802154_rx_error_t error, uint32_t count)
+{
+    (void)count;
+
+    nrf_802154_receive_failed(error);
+}
+
+#endif // NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+
 __WEAK void nrf_802154_tx_started(const uint8_t * p_frame)
 {
     (void)p_frame;
@@ -978,6 +2343,13 @@ __WEAK void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
     (void)error;
 }
 
+__WEAK void nrf_802154_energy_detection_sweep_done(uint32_t        channel_mask,
+                                                   const uint8_t * p_results)
+{
+    (void)channel_mask;
+    (void)p_results;
+}
+
 __WEAK void nrf_802154_cca_done(bool channel_free)
 {
     (void)channel_free;
@@ -987,3 +2359,33 @@ __WEAK void nrf_802154_cca_failed(nrf_802154_cca_error_t error)
 {
     (void)error;
 }
+
+#if NRF_802154_TSCH_ENABLED
+__WEAK void nrf_802154_tsch_cell_completed(uint16_t slot_offset, uint64_t asn)
+{
+    (void)slot_offset;
+    (void)asn;
+}
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+__WEAK void nrf_802154_data_request_received(const uint8_t                  * p_src_addr,
+                                             bool                             src_addr_extended,
+                                             const nrf_802154_rx_metadata_t * p_metadata)
+{
+    (void)p_src_addr;
+    (void)src_addr_extended;
+    (void)p_metadata;
+}
+
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+__WEAK void nrf_802154_async_request_done(nrf_802154_async_request_t request, bool result)
+{
+    (void)request;
+    (void)result;
+}
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
@@ -62,9 +62,27 @@ extern "C" {
  *
  * @note This function is to be called once, before any other functions from this module.
  *       Only the functions setting the configuration can be called before this call.
+ *
+ * If @ref NRF_802154_DEFERRED_INIT_ENABLED is set, this function returns without waiting for
+ * the LFCLK. The configuration functions can be called right away, but radio operations can be
+ * requested only after @ref nrf_802154_ready is called.
  */
 void nrf_802154_init(void);
 
+#if NRF_802154_DEFERRED_INIT_ENABLED
+
+/**
+ * @brief Notifies that the driver is ready for radio operations after @ref nrf_802154_init.
+ *
+ * This function is called once the LFCLK is running and the initialization is complete. It may
+ * be called from the context of @ref nrf_802154_init or from an interrupt handler.
+ *
+ * @note This function must be defined by the application.
+ */
+extern void nrf_802154_ready(void);
+
+#endif // NRF_802154_DEFERRED_INIT_ENABLED
+
 /**
  * @brief Deinitializes the 802.15.4 driver.
  *
@@ -72,6 +90,49 @@ void nrf_802154_init(void);
  */
 void nrf_802154_deinit(void);
 
+#if NRF_802154_WARM_START_ENABLED
+
+/**
+ * @brief Gets the maximum size of the warm start snapshot.
+ *
+ * @returns  Size of the buffer that fits the snapshot of any configuration, in bytes.
+ */
+uint32_t nrf_802154_warm_start_snapshot_max_size_get(void);
+
+/**
+ * @brief Stores the PIB and the ACK data in a warm start snapshot.
+ *
+ * The snapshot holds the PIB, the pending bit and ACK IE lists, and the source address matching
+ * method. It is valid only for a firmware built with the same driver configuration and can be
+ * kept in retained RAM or flash to be restored with @ref nrf_802154_init_warm.
+ *
+ * @note This function must not be called while the configuration is being modified.
+ *
+ * @param[out] p_buffer  Buffer for the snapshot.
+ * @param[in]  size      Size of @p p_buffer.
+ *
+ * @returns  Length of the snapshot or 0 if it does not fit in @p p_buffer.
+ */
+uint32_t nrf_802154_warm_start_snapshot_get(uint8_t * p_buffer, uint32_t size);
+
+/**
+ * @brief Initializes the 802.15.4 driver and restores a warm start snapshot.
+ *
+ * This function works like @ref nrf_802154_init and then restores the configuration from
+ * the snapshot created by @ref nrf_802154_warm_start_snapshot_get. If the snapshot is malformed,
+ * corrupted or created with a different driver configuration, the driver is left with its
+ * default configuration.
+ *
+ * @param[in]  p_snapshot  Pointer to the snapshot.
+ * @param[in]  length      Length of the snapshot.
+ *
+ * @retval  true   The configuration was restored from the snapshot.
+ * @retval  false  The snapshot was rejected.
+ */
+bool nrf_802154_init_warm(const uint8_t * p_snapshot, uint32_t length);
+
+#endif // NRF_802154_WARM_START_ENABLED
+
 #if !NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 /**
  * @brief Handles the interrupt request from the RADIO peripheral.
@@ -100,9 +161,37 @@ void nrf_802154_radio_irq_handler(void);
 void nrf_802154_swi_irq_handler(void);
 #endif // !NRF_802154_INTERNAL_SWI_IRQ_HANDLING
 
+#if NRF_802154_NOTIFICATION_THREAD_ENABLED
+/**
+ * @brief Passes all pending notifications of the driver to the higher layer.
+ *
+ * This function is to be called from the thread of the higher layer after it is woken up by
+ * @ref nrf_802154_notification_thread_wakeup. All notification callouts are called from this
+ * function, in the order in which the notifications were issued.
+ *
+ * @note This function must not be called from more than one thread at a time.
+ */
+void nrf_802154_notification_thread_process(void);
+
+/**
+ * @brief Requests the thread of the higher layer to process the pending notifications.
+ *
+ * This function is called from the interrupt contexts of the driver, with the notification queued.
+ * It is to signal a semaphore or submit a work item of the operating system, so that
+ * @ref nrf_802154_notification_thread_process is called from the thread.
+ *
+ * @note This function must not call any function of the driver.
+ */
+extern void nrf_802154_notification_thread_wakeup(void);
+
+#endif // NRF_802154_NOTIFICATION_THREAD_ENABLED
+
 /**
  * @brief Sets the channel on which the radio is to operate.
  *
+ * If the radio is in the receive state and no frame is being received, the receiver is re-tuned
+ * to the new channel without restarting the receive operation.
+ *
  * @param[in]  channel  Channel number (11-26).
  */
 void nrf_802154_channel_set(uint8_t channel);
@@ -114,6 +203,35 @@ void nrf_802154_channel_set(uint8_t channel);
  */
 uint8_t nrf_802154_channel_get(void);
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+/**
+ * @brief Begins a PIB transaction.
+ *
+ * Within a transaction, @ref nrf_802154_channel_set and @ref nrf_802154_cca_cfg_set only store
+ * the new values. The RADIO peripheral is updated when the transaction is committed with
+ * @ref nrf_802154_pib_transaction_commit, so that the receiver is restarted at most once.
+ *
+ * The other PIB setters, like @ref nrf_802154_pan_id_set or @ref nrf_802154_tx_power_set,
+ * take effect immediately also within a transaction.
+ *
+ * @note Transactions cannot be nested.
+ */
+void nrf_802154_pib_transaction_begin(void);
+
+/**
+ * @brief Commits a PIB transaction begun with @ref nrf_802154_pib_transaction_begin.
+ *
+ * The channel and CCA configuration changes made within the transaction are applied
+ * in a single request.
+ *
+ * @retval  true   The changes were applied, or no change requiring a request was made.
+ * @retval  false  The driver could not apply the changes.
+ */
+bool nrf_802154_pib_transaction_commit(void);
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
 /**
  * @brief Sets the transmit power.
  *
@@ -131,6 +249,44 @@ void nrf_802154_tx_power_set(int8_t power);
  */
 int8_t nrf_802154_tx_power_get(void);
 
+/**
+ * @brief Recomputes transmit power settings after the front-end module configuration changed.
+ *
+ * The driver precomputes the transmit power for each channel when @ref nrf_802154_tx_power_set
+ * is called, so the front-end module is not queried when a frame is transmitted. Call this
+ * function after changing the front-end module configuration which affects its gain.
+ */
+void nrf_802154_tx_power_refresh(void);
+
+/**
+ * @brief Sets the delays of the front-end module activation.
+ *
+ * The PA and the LNA are activated the time gap configured in the front-end module before
+ * the radio is ready to transmit or receive. The time gap is usually set for the slowest part
+ * that can be fitted on a board, so the amplifiers are powered longer than needed by faster
+ * parts. The delays set by this function postpone the activation of the amplifiers in each
+ * frame, which reduces their on-time. Each delay must not exceed the respective time gap of
+ * the front-end module.
+ *
+ * The initial delays are @ref NRF_802154_FEM_PA_ACTIVATION_DELAY_US and
+ * @ref NRF_802154_FEM_LNA_ACTIVATION_DELAY_US. The new delays apply to the next operation.
+ *
+ * @param[in]  pa_delay_us   Delay of the PA activation in microseconds.
+ * @param[in]  lna_delay_us  Delay of the LNA activation in microseconds.
+ *
+ * @retval true   The delays were set.
+ * @retval false  A delay is not lower than the radio ramp-up time. No delay was changed.
+ */
+bool nrf_802154_fem_activation_delay_set(uint8_t pa_delay_us, uint8_t lna_delay_us);
+
+/**
+ * @brief Gets the delays of the front-end module activation.
+ *
+ * @param[out]  p_pa_delay_us   Delay of the PA activation in microseconds.
+ * @param[out]  p_lna_delay_us  Delay of the LNA activation in microseconds.
+ */
+void nrf_802154_fem_activation_delay_get(uint8_t * p_pa_delay_us, uint8_t * p_lna_delay_us);
+
 /**
  * @brief Sets the antenna diversity rx mode.
  *
@@ -235,6 +391,25 @@ nrf_802154_sl_ant_div_antenna_t nrf_802154_antenna_diversity_tx_antenna_get(void
  */
 nrf_802154_sl_ant_div_antenna_t nrf_802154_antenna_diversity_last_rx_best_antenna_get(void);
 
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Gets the highest energy detected on the given antenna during the last energy detection.
+ *
+ * The result is in the same format as the one passed to @ref nrf_802154_energy_detected. It is
+ * valid when the energy detection procedure ends. For @ref nrf_802154_energy_detection_sweep,
+ * it concerns the last scanned channel.
+ *
+ * @note This function is available only if @ref NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED is set.
+ *
+ * @param[in]  antenna  Antenna to get the result for.
+ *
+ * @return Energy detected on @p antenna, or 0 if the energy was not sampled on @p antenna.
+ */
+uint8_t nrf_802154_antenna_diversity_ed_result_get(nrf_802154_sl_ant_div_antenna_t antenna);
+
+#endif // NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED || defined(__DOXYGEN__)
+
 /**
  * @brief Sets antenna diversity configuration.
  *
@@ -303,6 +478,64 @@ void nrf_802154_antenna_diversity_timer_irq_handler(void);
  */
 uint32_t nrf_802154_time_get(void);
 
+/**
+ * @brief Gets the current time as a 64-bit value.
+ *
+ * Unlike @ref nrf_802154_time_get, the returned value does not wrap. Its 32 least significant bits
+ * are equal to the value returned by @ref nrf_802154_time_get at the same moment.
+ *
+ * The time returned by this function is to be used with @ref nrf_802154_transmit_raw_at64 and
+ * @ref nrf_802154_receive_at64 functions.
+ *
+ * @returns Current time in microseconds.
+ */
+uint64_t nrf_802154_time64_get(void);
+
+/**
+ * @brief Gets the estimated drift between the high-precision and the low-power clock sources.
+ *
+ * The driver converts precise timestamps to the time returned by @ref nrf_802154_time_get using
+ * this estimate, so the error of the timestamps does not grow between the synchronizations of
+ * the clocks. The estimate can be used to size the guard times of scheduled receive windows.
+ *
+ * @param[out]  p_drift_ppb  Drift of the high-precision clock relative to the low-power clock,
+ *                           in parts per billion (1 ppm = 1000 ppb).
+ *
+ * @retval  true   The drift was estimated.
+ * @retval  false  Not enough synchronizations have been made yet, or the platform does not support
+ *                 the estimation.
+ */
+bool nrf_802154_time_drift_get(int32_t * p_drift_ppb);
+
+/**
+ * @brief Gets the time at which the driver next needs the CPU.
+ *
+ * The returned time is the earliest expiration of the timers of the driver, such as the ACK
+ * timeout, the interframe spacing or the CSMA-CA backoff, and the earliest start of a scheduled
+ * delayed operation, including periodic receive windows and beacons. It is intended for the idle
+ * hook of an operating system, which can sleep until the returned time without a periodic
+ * wake-up. Events of the RADIO peripheral wake the CPU with their interrupts and are not included.
+ *
+ * The returned time can be earlier than the current time if an event is due.
+ *
+ * @param[out]  p_time  Time of the next event in microseconds, as returned by
+ *                      @ref nrf_802154_time_get.
+ *
+ * @retval  true   @p p_time is set.
+ * @retval  false  The driver has no pending timed event.
+ */
+bool nrf_802154_next_event_time_get(uint32_t * p_time);
+
+/**
+ * @brief Converts a 32-bit timestamp reported by the driver to a 64-bit time.
+ *
+ * @param[in]  timestamp  Timestamp reported by the driver, in microseconds. It must be less than
+ *                        2^31 microseconds (about 35 minutes) before or after the current time.
+ *
+ * @returns Time in microseconds in the time base of @ref nrf_802154_time64_get.
+ */
+uint64_t nrf_802154_timestamp_to_time64(uint32_t timestamp);
+
 /**
  * @}
  * @defgroup nrf_802154_addresses Setting addresses and PAN ID of the device
@@ -336,6 +569,38 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address);
  */
 void nrf_802154_short_address_set(const uint8_t * p_short_address);
 
+#if NRF_802154_PAN_CONTEXTS > 1
+
+/**
+ * @brief Configures an additional PAN context the device receives frames for.
+ *
+ * A received frame addressed to the PAN ID and one of the addresses of the context is accepted
+ * and acknowledged according to the settings of the context. Context 0 is configured with
+ * @ref nrf_802154_pan_id_set, @ref nrf_802154_short_address_set,
+ * @ref nrf_802154_extended_address_set, @ref nrf_802154_auto_ack_set and
+ * @ref nrf_802154_src_addr_matching_method_set.
+ *
+ * This function makes a copy of the configuration.
+ *
+ * @param[in]  id         Identifier of the context (1 to @ref NRF_802154_PAN_CONTEXTS - 1).
+ * @param[in]  p_context  Pointer to the configuration of the context.
+ *
+ * @retval  true   The context is configured.
+ * @retval  false  @p id is out of range.
+ */
+bool nrf_802154_pan_context_set(uint8_t id, const nrf_802154_pan_context_t * p_context);
+
+/**
+ * @brief Removes an additional PAN context.
+ *
+ * Frames addressed only to the removed context are no longer received.
+ *
+ * @param[in]  id  Identifier of the context (1 to @ref NRF_802154_PAN_CONTEXTS - 1).
+ */
+void nrf_802154_pan_context_clear(uint8_t id);
+
+#endif // NRF_802154_PAN_CONTEXTS > 1
+
 /**
  * @}
  * @defgroup nrf_802154_data Functions to calculate data given by the driver
@@ -414,6 +679,36 @@ bool nrf_802154_sleep(void);
  */
 nrf_802154_sleep_error_t nrf_802154_sleep_if_idle(void);
 
+/**
+ * @brief Selects the state entered by the driver after a successful transmission.
+ *
+ * By default the driver enters the receive state after a frame is transmitted and its ACK, if
+ * requested, is received. A sleepy device can select @ref NRF_802154_POST_TX_STATE_SLEEP to enter
+ * the sleep state instead, without a separate request. With
+ * @ref NRF_802154_POST_TX_STATE_RX_WINDOW, the driver receives for @p rx_window_us, for example
+ * to receive the response to a data request, and then enters the sleep state. A frame being
+ * received when the window ends is received completely. The window ends early if the higher layer
+ * requests another operation, including @ref nrf_802154_receive.
+ *
+ * The state is entered before @ref nrf_802154_transmitted_raw is called. After a failed
+ * transmission the driver enters the receive state regardless of this setting.
+ *
+ * @param[in]  state         State to enter after a successful transmission.
+ * @param[in]  rx_window_us  Duration of the receive window in microseconds. Used only with
+ *                           @ref NRF_802154_POST_TX_STATE_RX_WINDOW. It must not be 0.
+ *
+ * @retval  true   The state is selected.
+ * @retval  false  The state or the window duration is invalid.
+ */
+bool nrf_802154_post_tx_state_set(nrf_802154_post_tx_state_t state, uint32_t rx_window_us);
+
+/**
+ * @brief Gets the state entered by the driver after a successful transmission.
+ *
+ * @returns  State selected by @ref nrf_802154_post_tx_state_set.
+ */
+nrf_802154_post_tx_state_t nrf_802154_post_tx_state_get(void);
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_RX.
  *
@@ -438,7 +733,13 @@ bool nrf_802154_receive(void);
  * If the requested reception time is in the past, the function returns false and does not
  * schedule reception.
  *
- * A scheduled reception can be cancelled by a call to @ref nrf_802154_receive_at_cancel.
+ * A scheduled reception can be cancelled by a call to @ref nrf_802154_receive_at_cancel or
+ * @ref nrf_802154_receive_at_window_cancel.
+ *
+ * Up to @ref NRF_802154_DELAYED_TRX_SCHEDULE_SIZE delayed receptions and transmissions can be
+ * scheduled at the same time. If a receive window starts while the previous one is still open,
+ * the previous one is closed and @ref nrf_802154_receive_failed is called with the
+ * @ref NRF_802154_RX_ERROR_DELAYED_ABORTED argument.
  *
  * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
  *                      in microseconds (us).
@@ -454,6 +755,22 @@ bool nrf_802154_receive_at(uint32_t t0,
                            uint32_t timeout,
                            uint8_t  channel);
 
+/**
+ * @brief Requests reception at the specified 64-bit time.
+ *
+ * This function works as @ref nrf_802154_receive_at, but the start of the reception is given
+ * as an absolute time in the time base of @ref nrf_802154_time64_get.
+ *
+ * @param[in]  rx_time  Time at which the reception is to start, in microseconds (us).
+ *                      It must be less than 2^31 microseconds (about 35 minutes) in the future.
+ * @param[in]  timeout  Reception timeout (counted from @p rx_time), in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frame is to be received.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure.
+ */
+bool nrf_802154_receive_at64(uint64_t rx_time, uint32_t timeout, uint8_t channel);
+
 /**
  * @brief Cancels a delayed reception scheduled by a call to @ref nrf_802154_receive_at.
  *
@@ -461,11 +778,178 @@ bool nrf_802154_receive_at(uint32_t t0,
  * entering the receive window. If the receive window has been scheduled and has already started,
  * the radio remains in the receive state, but a window timeout will not be reported.
  *
+ * All delayed receptions scheduled by @ref nrf_802154_receive_at are cancelled.
+ *
  * @retval  true    The delayed reception was scheduled and successfully cancelled.
  * @retval  false   No delayed reception was scheduled.
  */
 bool nrf_802154_receive_at_cancel(void);
 
+/**
+ * @brief Cancels a delayed reception scheduled by a call to @ref nrf_802154_receive_at.
+ *
+ * This function works as @ref nrf_802154_receive_at_cancel, but it cancels only the receive
+ * window that was requested with the given @p t0 and @p dt.
+ *
+ * @param[in]  t0  Base of delay time passed to @ref nrf_802154_receive_at.
+ * @param[in]  dt  Delta of delay time passed to @ref nrf_802154_receive_at.
+ *
+ * @retval  true    The delayed reception was scheduled and successfully cancelled.
+ * @retval  false   No delayed reception was scheduled at the given time.
+ */
+bool nrf_802154_receive_at_window_cancel(uint32_t t0, uint32_t dt);
+
+/**
+ * @brief Requests the energy detection at the specified time.
+ *
+ * This function works as a delayed version of @ref nrf_802154_energy_detection. The energy
+ * detection is queued in the same schedule as @ref nrf_802154_receive_at and starts at
+ * @p t0 + @p dt on the given channel. The result is reported by @ref nrf_802154_energy_detected.
+ * If the requested timeslot is denied, @ref nrf_802154_energy_detection_failed is called with
+ * the @ref NRF_802154_ED_ERROR_TIMESLOT_DENIED argument.
+ *
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  dt       Delta of delay time from @p t0, in microseconds (us).
+ * @param[in]  channel  Radio channel on which the energy is to be detected.
+ * @param[in]  time_us  Duration of the energy detection, in microseconds (us).
+ *
+ * @retval  true   The energy detection was scheduled.
+ * @retval  false  The driver could not schedule the energy detection.
+ */
+bool nrf_802154_energy_detection_at(uint32_t t0, uint32_t dt, uint8_t channel, uint32_t time_us);
+
+/**
+ * @brief Requests the CCA procedure at the specified time.
+ *
+ * This function works as a delayed version of @ref nrf_802154_cca. The CCA is queued in
+ * the same schedule as @ref nrf_802154_receive_at and starts at @p t0 + @p dt on the given
+ * channel. The result is reported by @ref nrf_802154_cca_done. If the requested timeslot is
+ * denied, @ref nrf_802154_cca_failed is called with the
+ * @ref NRF_802154_CCA_ERROR_TIMESLOT_DENIED argument.
+ *
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  dt       Delta of delay time from @p t0, in microseconds (us).
+ * @param[in]  channel  Radio channel on which the CCA is to be performed.
+ *
+ * @retval  true   The CCA was scheduled.
+ * @retval  false  The driver could not schedule the CCA.
+ */
+bool nrf_802154_cca_at(uint32_t t0, uint32_t dt, uint8_t channel);
+
+/**
+ * @brief Cancels all procedures scheduled by @ref nrf_802154_energy_detection_at and
+ *        @ref nrf_802154_cca_at.
+ *
+ * Procedures that have already started are not affected.
+ *
+ * @retval  true    At least one scheduled procedure was cancelled.
+ * @retval  false   No procedure was scheduled.
+ */
+bool nrf_802154_measurement_at_cancel(void);
+
+/**
+ * @brief Requests periodic reception windows.
+ *
+ * This function works as @ref nrf_802154_receive_at called for every window, but the driver
+ * schedules the next window by itself when the previous one ends. The windows start at
+ * @p phase + k * @p period. Frames received during the windows are reported by
+ * @ref nrf_802154_received. The timeouts of the windows are not reported. It is intended for
+ * the CSL receiver and duty-cycled listening.
+ *
+ * If a window cannot be scheduled, the periodic reception stops and
+ * @ref nrf_802154_receive_failed is called with
+ * the @ref NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED argument. Windows that cannot be opened in time, for example because of a higher-priority
+ * operation, are skipped.
+ *
+ * The periodic windows are not affected by @ref nrf_802154_receive_at_cancel. They are stopped
+ * by @ref nrf_802154_receive_periodic_stop.
+ *
+ * @param[in]  period   Time between the starts of consecutive windows, in microseconds (us).
+ * @param[in]  window   Duration of each window, in microseconds (us). It must be shorter than
+ *                      @p period.
+ * @param[in]  phase    Start time of one of the windows - absolute time used by the Timer
+ *                      Scheduler, in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frames are to be received.
+ *
+ * @retval  true   The periodic reception was started.
+ * @retval  false  The periodic reception is already running, the parameters are invalid, or
+ *                 the first window could not be scheduled.
+ */
+bool nrf_802154_receive_periodic(uint32_t period,
+                                 uint32_t window,
+                                 uint32_t phase,
+                                 uint8_t  channel);
+
+/**
+ * @brief Stops periodic reception windows requested by @ref nrf_802154_receive_periodic.
+ *
+ * If a window is open, the radio remains in the receive state, but no further window is opened.
+ *
+ * @retval  true   The periodic reception was running and has been stopped.
+ * @retval  false  The periodic reception was not running.
+ */
+bool nrf_802154_receive_periodic_stop(void);
+
+/**
+ * @brief Requests periodic transmission of a beacon.
+ *
+ * The beacons start at @p t0 + k * @p period. The driver schedules the next beacon by itself
+ * when the transmission of the previous one ends, and transmits the same buffer every period.
+ * Every beacon is reported by @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed.
+ * Beacons that cannot be transmitted in time, for example because of a higher-priority
+ * operation, are skipped without notification.
+ *
+ * If @p dsn_update is set, the sequence number of the beacon is incremented in @p p_data before
+ * every beacon except the first one. A timestamp can be written into the beacon by setting
+ * @ref NRF_802154_TX_PARAM_TIMESTAMP in @p p_params.
+ *
+ * If a beacon cannot be scheduled, the periodic transmission stops and
+ * @ref nrf_802154_transmit_failed is called with
+ * the @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED argument.
+ *
+ * @param[in]  p_data      Pointer to the array with data to transmit. The first byte must contain
+ *                         the frame length (including FCS). The array must stay valid and
+ *                         unmodified by the caller until the periodic transmission is stopped.
+ * @param[in]  period      Time between the starts of consecutive beacons, in microseconds (us).
+ * @param[in]  t0          Start time of the first beacon - absolute time used by the Timer
+ *                         Scheduler, in microseconds (us).
+ * @param[in]  dsn_update  If the sequence number is to be incremented for every beacon.
+ * @param[in]  p_params    Pointer to the transmit parameters, or NULL to use the PIB settings.
+ *
+ * @retval  true   The periodic transmission was started.
+ * @retval  false  The periodic transmission is already running, the period is too short, or
+ *                 the first beacon could not be scheduled.
+ */
+bool nrf_802154_beacon_periodic_start(uint8_t                      * p_data,
+                                      uint32_t                       period,
+                                      uint32_t                       t0,
+                                      bool                           dsn_update,
+                                      const nrf_802154_tx_params_t * p_params);
+
+/**
+ * @brief Stops periodic beacon transmission requested by @ref nrf_802154_beacon_periodic_start.
+ *
+ * A beacon that is being transmitted is not aborted, but no further beacon is scheduled.
+ *
+ * @retval  true   The periodic transmission was running and has been stopped.
+ * @retval  false  The periodic transmission was not running.
+ */
+bool nrf_802154_beacon_periodic_stop(void);
+
+/**
+ * @brief Gets the setup times used to schedule delayed transmissions and receive windows.
+ *
+ * This function is intended for diagnostics. If
+ * @ref NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED is set, the returned values are
+ * calibrated at runtime.
+ *
+ * @param[out]  p_tx_setup_time  Setup time of delayed transmissions in microseconds.
+ * @param[out]  p_rx_setup_time  Setup time of delayed receptions in microseconds.
+ */
+void nrf_802154_delayed_setup_times_get(uint32_t * p_tx_setup_time, uint32_t * p_rx_setup_time);
+
 #if NRF_802154_USE_RAW_API
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_TX.
@@ -506,6 +990,26 @@ bool nrf_802154_receive_at_cancel(void);
  */
 bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
 
+/**
+ * @brief Changes the radio state to transmit and applies the given parameters to this frame only.
+ *
+ * This function works like @ref nrf_802154_transmit_raw. Additionally, the channel, the transmit
+ * power, and the CCA configuration selected by @c p_params->flags are applied when the
+ * transmission starts, in the same critical section. The PIB is not modified and the driver
+ * returns to the PIB configuration after the transmission. That way no separate call to
+ * @ref nrf_802154_channel_set or @ref nrf_802154_tx_power_set is needed to transmit a single
+ * frame with other parameters.
+ *
+ * @param[in]  p_data    Pointer to the array with data to transmit. See also
+ *                       @ref nrf_802154_transmit_raw.
+ * @param[in]  p_params  Pointer to the transmission parameters. The structure is copied, so it
+ *                       does not need to be valid after this function returns.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_ex(const uint8_t * p_data, const nrf_802154_tx_params_t * p_params);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -550,67 +1054,344 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
 
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_BUFFERS > 0
+
 /**
- * @brief Requests transmission at the specified time.
- *
- * @note This function is implemented in a zero-copy fashion. It passes the given buffer pointer to
- *       the RADIO peripheral.
- *
- * This function works as a delayed version of @ref nrf_802154_transmit_raw. It is asynchronous.
- * It queues the delayed transmission using the Radio Scheduler module and performs it
- * at the specified time.
+ * @brief Allocates a transmit buffer from the pool owned by the driver.
  *
- * If the delayed transmission is successfully performed, @ref nrf_802154_transmitted is called.
- * If the delayed transmission cannot be performed (@ref nrf_802154_transmit_raw would return false)
- * or the requested transmission timeslot is denied, @ref nrf_802154_transmit_failed with the
- * @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED argument is called.
+ * The higher layer can build a frame directly in the allocated buffer and pass it to
+ * @ref nrf_802154_tx_buffer_submit. That way the frame does not need to be copied, and the
+ * higher layer does not need to keep its own buffer alive during the transmission.
  *
- * This function is designed to transmit the first symbol of SHR at the given time.
- *
- * If the requested transmission time is in the past, the function returns false and does not
- * schedule transmission.
+ * @returns  Pointer to a buffer of (MAX_PACKET_SIZE + 1) bytes, or NULL if all buffers are in use.
+ */
+uint8_t * nrf_802154_tx_buffer_alloc(void);
+
+/**
+ * @brief Transmits a frame built in a buffer allocated with @ref nrf_802154_tx_buffer_alloc.
  *
- * A successfully scheduled transmission can be cancelled by a call
- * to @ref nrf_802154_transmit_at_cancel.
+ * This function works like @ref nrf_802154_transmit_raw. If the transmission procedure was
+ * scheduled, the driver returns the buffer to the pool after the transmission result is notified
+ * to the higher layer. The higher layer must not use or free the buffer after that notification.
  *
- * @param[in]  p_data   Pointer to the array with data to transmit. The first byte must contain
- *                      the frame length (including PHR and FCS). The following bytes contain data.
- *                      The CRC is computed automatically by the radio hardware. Therefore, the FCS
- *                      field can contain any bytes.
- * @param[in]  cca      If the driver is to perform a CCA procedure before transmission.
- * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
- *                      in microseconds (us).
- * @param[in]  dt       Delta of delay time from @p t0, in microseconds (us).
- * @param[in]  channel  Radio channel on which the frame is to be transmitted.
+ * @param[in]  p_data  Pointer to a buffer allocated with @ref nrf_802154_tx_buffer_alloc. The first
+ *                     byte must contain frame length (including PHR and FCS). The following bytes
+ *                     contain data.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
  *
  * @retval  true   The transmission procedure was scheduled.
- * @retval  false  The driver could not schedule the transmission procedure.
+ * @retval  false  The driver could not schedule the transmission procedure. The buffer is still
+ *                 owned by the higher layer, which can submit it again or free it with
+ *                 @ref nrf_802154_tx_buffer_free.
  */
-bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
-                                bool            cca,
-                                uint32_t        t0,
-                                uint32_t        dt,
-                                uint8_t         channel);
+bool nrf_802154_tx_buffer_submit(uint8_t * p_data, bool cca);
 
 /**
- * @brief Cancels a delayed transmission scheduled by a call to @ref nrf_802154_transmit_raw_at.
+ * @brief Transmits a frame assembled from segments in a buffer from the pool.
  *
- * If a delayed transmission has been scheduled but the transmission has not been started yet,
- * a call to this function prevents the transmission. If the transmission is ongoing,
- * it will not be aborted.
+ * The segments are copied one after another into a buffer allocated from the pool, after the PHR,
+ * which is computed from their total length and the size of the FCS. The frame is then submitted
+ * as with @ref nrf_802154_tx_buffer_submit. The segments are not accessed after this function
+ * returns, so the higher layer can build the MAC header, the upper layer headers and the payload
+ * in separate buffers without copying them into an intermediate one.
  *
- * If a delayed transmission has not been scheduled (or has already finished), this function does
- * not change state and returns false.
+ * @param[in]  p_segments  Array of the segments of the PSDU, without the FCS.
+ * @param[in]  count       Number of segments in @p p_segments.
+ * @param[in]  cca         If the driver is to perform a CCA procedure before transmission.
  *
- * @retval  true    The delayed transmission was scheduled and successfully cancelled.
- * @retval  false   No delayed transmission was scheduled.
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The frame is too long, no buffer is free or the driver could not schedule
+ *                 the transmission procedure. The buffer is returned to the pool.
  */
-bool nrf_802154_transmit_at_cancel(void);
+bool nrf_802154_tx_buffer_submit_segments(const nrf_802154_tx_segment_t * p_segments,
+                                          uint8_t                         count,
+                                          bool                            cca);
 
 /**
- * @brief Changes the radio state to energy detection.
+ * @brief Returns a buffer that has not been submitted to the pool.
  *
- * In the energy detection state, the radio detects the maximum energy for a given time.
+ * @param[in]  p_data  Pointer to a buffer allocated with @ref nrf_802154_tx_buffer_alloc.
+ */
+void nrf_802154_tx_buffer_free(uint8_t * p_data);
+
+#endif // NRF_802154_TX_BUFFERS > 0
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+
+/**
+ * @brief Adds a frame to the transmit queue.
+ *
+ * If no transmission is in progress and the queue is empty, this function works like
+ * @ref nrf_802154_transmit_raw. Otherwise, the frame is added to the queue and transmitted
+ * right after the preceding frames, without the driver returning to the receive state between
+ * the frames. The result of each transmission is reported to the higher layer by a separate call
+ * to @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed.
+ *
+ * If any transmission fails, all frames that are still waiting in the queue are dropped and
+ * reported with @ref nrf_802154_transmit_failed and @ref NRF_802154_TX_ERROR_ABORTED.
+ *
+ * @note The buffer pointed to by @p p_data must stay valid until the transmission result of that
+ *       frame is notified. Buffers allocated with @ref nrf_802154_tx_buffer_alloc can be used.
+ *
+ * @param[in]  p_data  Pointer to the array with data to transmit. The first byte must contain frame
+ *                     length (including PHR and FCS). The following bytes contain data.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ *
+ * @retval  true   The frame is going to be transmitted.
+ * @retval  false  The transmit queue is full or the driver could not schedule the transmission.
+ */
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca);
+
+#if NRF_802154_TX_QUEUE_PRIORITY_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Adds a frame with a priority class and an optional deadline to the transmit queue.
+ *
+ * This function works like @ref nrf_802154_transmit_raw_enqueue, but the frame is queued before
+ * the waiting frames of lower priority classes, and within its class in the order of deadlines.
+ * Frames added with @ref nrf_802154_transmit_raw_enqueue use
+ * @ref NRF_802154_TX_QUEUE_DEFAULT_PRIORITY and no deadline.
+ *
+ * If the frame is still waiting in the queue when its transmission could no longer end by its
+ * deadline, it is dropped and reported with @ref nrf_802154_transmit_failed and
+ * @ref NRF_802154_TX_ERROR_DEADLINE_MISSED. The other queued frames are not affected.
+ *
+ * @param[in]  p_data          Pointer to the array with data to transmit. The first byte must
+ *                             contain frame length (including PHR and FCS). The following bytes
+ *                             contain data.
+ * @param[in]  cca             If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  p_queue_params  Pointer to the queue parameters of the frame or NULL.
+ *
+ * @retval  true   The frame is going to be transmitted.
+ * @retval  false  The transmit queue is full or the driver could not schedule the transmission.
+ */
+bool nrf_802154_transmit_raw_enqueue_ex(const uint8_t                      * p_data,
+                                        bool                                 cca,
+                                        const nrf_802154_tx_queue_params_t * p_queue_params);
+
+#endif // NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+
+/**
+ * @brief Transmits a burst of frames through the transmit queue.
+ *
+ * This function works like @ref nrf_802154_transmit_raw_enqueue called for every frame, but
+ * either all frames are accepted or none of them. If no transmission is in progress, the driver
+ * requests a single timeslot long enough for all frames and the ACKs they request. This avoids
+ * a timeslot negotiation for each frame when the radio is shared with other protocols. If such
+ * a timeslot is not available, the frames are transmitted in timeslots requested one by one.
+ *
+ * @note The array pointed to by @p pp_data needs to be valid only during the call, but the
+ *       buffers of the frames must stay valid until the transmission result of each frame is
+ *       notified.
+ *
+ * @param[in]  pp_data  Array of pointers to the frames to transmit. The first byte of each frame
+ *                      must contain frame length (including PHR and FCS).
+ * @param[in]  count    Number of frames in @p pp_data.
+ * @param[in]  cca      If the driver is to perform a CCA procedure before each transmission.
+ *
+ * @retval  true   The frames are going to be transmitted.
+ * @retval  false  The transmit queue is too short for the burst or the driver could not schedule
+ *                 the transmission.
+ */
+bool nrf_802154_transmit_raw_burst(const uint8_t * const * pp_data, uint8_t count, bool cca);
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
+
+#if NRF_802154_INDIRECT_QUEUE_SIZE > 0
+
+/**
+ * @brief Queues a frame for indirect transmission to a polling device.
+ *
+ * The destination address of the frame is added to the pending bit list. When a Data Request
+ * from that address is received, the driver transmits the ACK with the Frame Pending bit set
+ * and then transmits the oldest frame queued for the address, with a CCA procedure, right after
+ * the ACK. The result of the transmission is reported by @ref nrf_802154_transmitted or
+ * @ref nrf_802154_transmit_failed. When no more frames are queued for the address, it is removed
+ * from the pending bit list.
+ *
+ * @note The buffer pointed to by @p p_data must stay valid until the transmission result of that
+ *       frame is notified or the frame is removed with @ref nrf_802154_transmit_indirect_cancel.
+ * @note The driver manages the pending bit list entries of the queued destinations. The higher
+ *       layer is not to use @ref nrf_802154_pending_bit_for_addr_clear for them.
+ * @note Secured Data Requests are recognized only if they contain no header IEs.
+ *
+ * @param[in]  p_data  Pointer to the array with data to transmit. The first byte must contain frame
+ *                     length (including PHR and FCS). The following bytes contain data.
+ *
+ * @retval  true   The frame was queued.
+ * @retval  false  The queue or the pending bit list is full, or the frame is not addressed to
+ *                 a single device.
+ */
+bool nrf_802154_transmit_raw_indirect(const uint8_t * p_data);
+
+/**
+ * @brief Removes a frame that waits for indirect transmission.
+ *
+ * This function is intended for frames whose transaction persistence time expired.
+ *
+ * @param[in]  p_data  Pointer to a frame queued with @ref nrf_802154_transmit_raw_indirect.
+ *
+ * @retval  true   The frame was removed and is not going to be transmitted.
+ * @retval  false  The frame is not queued. Its transmission might have already started.
+ */
+bool nrf_802154_transmit_indirect_cancel(const uint8_t * p_data);
+
+#endif // NRF_802154_INDIRECT_QUEUE_SIZE > 0
+
+/**
+ * @brief Requests transmission at the specified time.
+ *
+ * @note This function is implemented in a zero-copy fashion. It passes the given buffer pointer to
+ *       the RADIO peripheral.
+ *
+ * This function works as a delayed version of @ref nrf_802154_transmit_raw. It is asynchronous.
+ * It queues the delayed transmission using the Radio Scheduler module and performs it
+ * at the specified time.
+ *
+ * If the delayed transmission is successfully performed, @ref nrf_802154_transmitted is called.
+ * If the delayed transmission cannot be performed (@ref nrf_802154_transmit_raw would return false)
+ * or the requested transmission timeslot is denied, @ref nrf_802154_transmit_failed with the
+ * @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED argument is called.
+ *
+ * This function is designed to transmit the first symbol of SHR at the given time.
+ *
+ * If the requested transmission time is in the past, the function returns false and does not
+ * schedule transmission.
+ *
+ * A successfully scheduled transmission can be cancelled by a call
+ * to @ref nrf_802154_transmit_at_cancel or @ref nrf_802154_transmit_at_frame_cancel.
+ *
+ * Up to @ref NRF_802154_DELAYED_TRX_SCHEDULE_SIZE delayed transmissions and receptions can be
+ * scheduled at the same time. Each scheduled frame must be kept in its own buffer until
+ * the transmission is finished.
+ *
+ * @param[in]  p_data   Pointer to the array with data to transmit. The first byte must contain
+ *                      the frame length (including PHR and FCS). The following bytes contain data.
+ *                      The CRC is computed automatically by the radio hardware. Therefore, the FCS
+ *                      field can contain any bytes.
+ * @param[in]  cca      If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  dt       Delta of delay time from @p t0, in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frame is to be transmitted.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
+                                bool            cca,
+                                uint32_t        t0,
+                                uint32_t        dt,
+                                uint8_t         channel);
+
+/**
+ * @brief Requests a delayed transmission of a frame with the given transmit parameters.
+ *
+ * This function works as @ref nrf_802154_transmit_raw_at, but the frame is transmitted with
+ * @p p_params, as by @ref nrf_802154_transmit_raw_ex. If @p p_params does not select a channel,
+ * the frame is transmitted on the current channel.
+ *
+ * With @ref NRF_802154_TX_PARAM_TIMESTAMP, the driver writes the SFD timestamp of the frame
+ * into the frame buffer just before the transmission starts. This way the frame carries its own
+ * transmission time and no follow-up frame is needed to distribute it.
+ *
+ * @param[in]  p_data    Pointer to the array with data to transmit. See also
+ *                       @ref nrf_802154_transmit_raw_at.
+ * @param[in]  t0        Base of delay time - absolute time used by the Timer Scheduler,
+ *                       in microseconds (us).
+ * @param[in]  dt        Delta of delay time from @p t0, in microseconds (us).
+ * @param[in]  p_params  Pointer to the transmission parameters. The structure is copied, so it
+ *                       does not need to be valid after this function returns.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_at_ex(const uint8_t                * p_data,
+                                   uint32_t                       t0,
+                                   uint32_t                       dt,
+                                   const nrf_802154_tx_params_t * p_params);
+
+/**
+ * @brief Requests transmission at the specified 64-bit time.
+ *
+ * This function works as @ref nrf_802154_transmit_raw_at, but the time of the transmission is
+ * given as an absolute time in the time base of @ref nrf_802154_time64_get.
+ *
+ * @param[in]  p_data   Pointer to the array with data to transmit. See also
+ *                      @ref nrf_802154_transmit_raw_at.
+ * @param[in]  cca      If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  tx_time  Time at which the first symbol of SHR is to be transmitted,
+ *                      in microseconds (us). It must be less than 2^31 microseconds
+ *                      (about 35 minutes) in the future.
+ * @param[in]  channel  Radio channel on which the frame is to be transmitted.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_at64(const uint8_t * p_data,
+                                  bool            cca,
+                                  uint64_t        tx_time,
+                                  uint8_t         channel);
+
+#if NRF_802154_CSL_TX_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Requests a transmission at the next channel sample of a CSL receiver.
+ *
+ * The driver keeps the CSL Phase and CSL Period of the CSL IE last received from each peer,
+ * in a frame or in an Enh-ACK. The frame is scheduled with @ref nrf_802154_transmit_raw_at64
+ * so that the first symbol of its SHR is transmitted at the first channel sample of
+ * its destination that is at least @ref NRF_802154_CSL_TX_LEAD_TIME ahead. The frame is
+ * transmitted on the current channel.
+ *
+ * @note This function is available only if @ref NRF_802154_CSL_TX_ENABLED is set.
+ *
+ * @param[in]  p_data  Pointer to the array with data to transmit. See also
+ *                     @ref nrf_802154_transmit_raw_at.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The destination of the frame is not a known CSL receiver, or the driver could
+ *                 not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_csl(const uint8_t * p_data, bool cca);
+
+#endif // NRF_802154_CSL_TX_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Cancels a delayed transmission scheduled by a call to @ref nrf_802154_transmit_raw_at.
+ *
+ * If a delayed transmission has been scheduled but the transmission has not been started yet,
+ * a call to this function prevents the transmission. If the transmission is ongoing,
+ * it will not be aborted.
+ *
+ * If a delayed transmission has not been scheduled (or has already finished), this function does
+ * not change state and returns false.
+ *
+ * All delayed transmissions scheduled by @ref nrf_802154_transmit_raw_at are cancelled.
+ *
+ * @retval  true    The delayed transmission was scheduled and successfully cancelled.
+ * @retval  false   No delayed transmission was scheduled.
+ */
+bool nrf_802154_transmit_at_cancel(void);
+
+/**
+ * @brief Cancels a delayed transmission of the given frame.
+ *
+ * This function works as @ref nrf_802154_transmit_at_cancel, but it cancels only
+ * the transmissions of the frame in the given buffer.
+ *
+ * @param[in]  p_data  Pointer to the buffer passed to @ref nrf_802154_transmit_raw_at.
+ *
+ * @retval  true    The delayed transmission was scheduled and successfully cancelled.
+ * @retval  false   No delayed transmission of the frame was scheduled.
+ */
+bool nrf_802154_transmit_at_frame_cancel(const uint8_t * p_data);
+
+/**
+ * @brief Changes the radio state to energy detection.
+ *
+ * In the energy detection state, the radio detects the maximum energy for a given time.
  * The result of the detection is reported to the higher layer by @ref nrf_802154_energy_detected.
  *
  * @note @ref nrf_802154_energy_detected can be called before this function returns a result.
@@ -628,6 +1409,70 @@ bool nrf_802154_transmit_at_cancel(void);
  */
 bool nrf_802154_energy_detection(uint32_t time_us);
 
+/**
+ * @brief Performs the energy detection procedure on each of the given channels.
+ *
+ * The channels are scanned one by one, from the lowest one, within a single request. The radio
+ * stays in the energy detection state between the channels. The results are reported to the
+ * higher layer at once by @ref nrf_802154_energy_detection_sweep_done. When the sweep finishes,
+ * the driver returns to reception on the channel set by @ref nrf_802154_channel_set.
+ *
+ * @note If the sweep is aborted, @ref nrf_802154_energy_detection_failed is called and
+ *       no results are reported.
+ *
+ * @param[in]  channel_mask         Mask of the channels to scan. Bit n selects the channel n.
+ *                                  Only bits of @ref NRF_802154_ED_SWEEP_CHANNEL_MASK can be set.
+ * @param[in]  time_per_channel_us  Duration of energy detection procedure on each channel.
+ *                                  The given value is rounded up as in
+ *                                  @ref nrf_802154_energy_detection.
+ *
+ * @retval  true   The energy detection sweep was scheduled.
+ * @retval  false  The driver could not schedule the energy detection sweep or
+ *                 @p channel_mask is invalid.
+ */
+bool nrf_802154_energy_detection_sweep(uint32_t channel_mask, uint32_t time_per_channel_us);
+
+#if NRF_802154_PASSIVE_ED_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Detects the maximum energy on the current channel without leaving the receive state.
+ *
+ * Unlike @ref nrf_802154_energy_detection, the radio stays in the receive state. The RSSI is
+ * sampled at @ref NRF_802154_PASSIVE_ED_SAMPLE_PERIOD_US intervals between frames. A sample due
+ * while a frame is being received is skipped and the frame is received normally. The result is
+ * reported to the higher layer by @ref nrf_802154_energy_detected after @p time_us, or by
+ * @ref nrf_802154_energy_detection_failed if no sample could be taken.
+ *
+ * @note The result does not include the energy of the frames received during the procedure.
+ * @note This procedure must not overlap with @ref nrf_802154_energy_detection, as both report
+ *       the result with the same function.
+ *
+ * @param[in]  time_us  Duration of the procedure in microseconds.
+ *
+ * @retval  true   The energy detection procedure was started.
+ * @retval  false  The radio is not in the receive state or the procedure is already in progress.
+ */
+bool nrf_802154_energy_detection_passive(uint32_t time_us);
+
+#endif
+
+#if NRF_802154_ED_RESULT_EXT_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Gets the extended result of the last energy detection procedure.
+ *
+ * The result is valid when the energy detection procedure ends, so it can be read from
+ * @ref nrf_802154_energy_detected. For @ref nrf_802154_energy_detection_sweep, it concerns
+ * the last scanned channel.
+ *
+ * @note This function is available only if @ref NRF_802154_ED_RESULT_EXT_ENABLED is set.
+ *
+ * @param[out]  p_result  Extended result of the last energy detection procedure.
+ */
+void nrf_802154_energy_detection_result_get(nrf_802154_ed_result_t * p_result);
+
+#endif // NRF_802154_ED_RESULT_EXT_ENABLED || defined(__DOXYGEN__)
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_CCA.
  *
@@ -641,6 +1486,45 @@ bool nrf_802154_energy_detection(uint32_t time_us);
  */
 bool nrf_802154_cca(void);
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+
+/**
+ * @brief Changes the radio state to low-power listening.
+ *
+ * In the low-power listening mode, the driver samples the channel energy for the configured
+ * sample time once per period and sleeps between the samples. If the detected energy exceeds
+ * the CCA energy detection threshold (see @ref nrf_802154_cca_cfg_set), the driver stays in
+ * the receive state for the configured hold time and reports the received frames as in
+ * @ref nrf_802154_receive. A frame being received when the hold time ends is received completely.
+ *
+ * The mode lasts until another state is requested by the higher layer.
+ *
+ * @note Energy detection results are not reported to the higher layer in this mode.
+ *
+ * @retval  true   The low-power listening mode was scheduled.
+ * @retval  false  The driver could not schedule the low-power listening mode.
+ */
+bool nrf_802154_low_power_listening(void);
+
+/**
+ * @brief Configures the low-power listening mode.
+ *
+ * The configuration is applied to the next sample of the channel energy.
+ *
+ * @param[in]  period_us  Time between the starts of consecutive samples in microseconds.
+ * @param[in]  sample_us  Duration of the energy detection in each sample in microseconds.
+ *                        It is rounded up to a multiple of 128 us.
+ * @param[in]  hold_us    Time the receiver is kept on after the energy is detected in microseconds.
+ *
+ * @retval  true   The configuration was applied.
+ * @retval  false  The sample is not shorter than the period, or @p hold_us is 0.
+ */
+bool nrf_802154_low_power_listening_cfg_set(uint32_t period_us,
+                                            uint32_t sample_us,
+                                            uint32_t hold_us);
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 /**
  * @brief Changes the radio state to continuous carrier.
  *
@@ -736,6 +1620,51 @@ extern void nrf_802154_received_timestamp_raw(uint8_t * p_data,
                                               uint8_t   lqi,
                                               uint32_t  time);
 
+/**
+ * @brief Notifies that a frame was received, passing all metadata of the reception.
+ *
+ * The metadata is captured when the reception of the frame ends, so unlike the values returned
+ * by functions like @ref nrf_802154_channel_get or
+ * @ref nrf_802154_antenna_diversity_last_rx_best_antenna_get, it is not affected by frames
+ * received later.
+ *
+ * The default implementation calls @ref nrf_802154_received_raw.
+ *
+ * @note The buffer pointed to by @p p_data must be freed with @ref nrf_802154_buffer_free_raw.
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *                         The first byte in the buffer is the length of the frame (PHR).
+ *                         The following bytes contain the frame itself (PSDU). The length byte
+ *                         (PHR) includes FCS. FCS is already verified by the hardware and may be
+ *                         modified by the hardware.
+ * @param[in]  p_metadata  Pointer to the metadata of the received frame. The structure is valid
+ *                         only during the execution of this function.
+ */
+extern void nrf_802154_received_metadata_raw(uint8_t                        * p_data,
+                                             const nrf_802154_rx_metadata_t * p_metadata);
+
+#if NRF_802154_RX_BATCH_NOTIFY_ENABLED
+
+/**
+ * @brief Notifies that a batch of frames was received.
+ *
+ * This function replaces @ref nrf_802154_received_metadata_raw if
+ * @ref NRF_802154_RX_BATCH_NOTIFY_ENABLED is set. Each frame in the batch must be freed with
+ * @ref nrf_802154_buffer_free_raw, just like a frame passed to @ref nrf_802154_received_raw.
+ * The frames are ordered from the oldest to the newest one.
+ *
+ * The default implementation calls @ref nrf_802154_received_metadata_raw for each frame in
+ * the batch.
+ *
+ * @note The array pointed to by @p p_frames is valid only during the execution of this function.
+ *
+ * @param[in]  p_frames  Pointer to an array of received frames.
+ * @param[in]  count     Number of frames in the array pointed to by @p p_frames.
+ */
+extern void nrf_802154_received_batch_raw(const nrf_802154_rx_frame_t * p_frames, uint8_t count);
+
+#endif // NRF_802154_RX_BATCH_NOTIFY_ENABLED
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -788,6 +1717,24 @@ extern void nrf_802154_received_timestamp(uint8_t * p_data,
                                           uint8_t   lqi,
                                           uint32_t  time);
 
+/**
+ * @brief Notifies that a frame was received, passing all metadata of the reception.
+ *
+ * This function works like @ref nrf_802154_received_metadata_raw, but passes only the payload
+ * of the received frame. The default implementation calls @ref nrf_802154_received.
+ *
+ * @note The buffer pointed to by @p p_data must be freed with @ref nrf_802154_buffer_free.
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains only the payload of the received
+ *                         frame (PSDU without FCS).
+ * @param[in]  length      Length of the received payload.
+ * @param[in]  p_metadata  Pointer to the metadata of the received frame. The structure is valid
+ *                         only during the execution of this function.
+ */
+extern void nrf_802154_received_metadata(uint8_t                        * p_data,
+                                         uint8_t                          length,
+                                         const nrf_802154_rx_metadata_t * p_metadata);
+
 #endif // !NRF_802154_USE_RAW_API
 
 /**
@@ -797,6 +1744,21 @@ extern void nrf_802154_received_timestamp(uint8_t * p_data,
  */
 extern void nrf_802154_receive_failed(nrf_802154_rx_error_t error);
 
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+
+/**
+ * @brief Notifies that the reception of one or more frames failed with the same error.
+ *
+ * This function is called instead of @ref nrf_802154_receive_failed when
+ * @ref NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED is set.
+ *
+ * @param[in]  error  Error code that indicates the reason of the failures.
+ * @param[in]  count  Number of consecutive failures with this error code.
+ */
+extern void nrf_802154_receive_failed_coalesced(nrf_802154_rx_error_t error, uint32_t count);
+
+#endif // NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+
 /**
  * @brief Notifies that transmitting a frame has started.
  *
@@ -957,6 +1919,21 @@ extern void nrf_802154_energy_detected(uint8_t result);
  */
 extern void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies that the energy detection sweep finished.
+ *
+ * The results are passed in the EnergyLevel format, as in @ref nrf_802154_energy_detected.
+ * The result array is valid until the next energy detection sweep is requested.
+ *
+ * @param[in]  channel_mask  Mask of the scanned channels, as passed to
+ *                           @ref nrf_802154_energy_detection_sweep.
+ * @param[in]  p_results     Array of @ref NRF_802154_ED_SWEEP_CHANNELS results, starting from
+ *                           the channel @ref NRF_802154_ED_SWEEP_CHANNEL_FIRST. Only the results
+ *                           of the channels in @p channel_mask are valid.
+ */
+extern void nrf_802154_energy_detection_sweep_done(uint32_t        channel_mask,
+                                                   const uint8_t * p_results);
+
 /**
  * @brief Notifies that the CCA procedure has finished.
  *
@@ -971,6 +1948,42 @@ extern void nrf_802154_cca_done(bool channel_free);
  */
 extern void nrf_802154_cca_failed(nrf_802154_cca_error_t error);
 
+#if NRF_802154_TSCH_ENABLED
+
+/**
+ * @brief Notifies that a cell of the TSCH slotframe was completed.
+ *
+ * The function is called after the operation scheduled for the cell ended, regardless of its
+ * outcome. The outcome itself is notified with the usual transmission and reception calls.
+ *
+ * @param[in]  slot_offset  Slot offset of the completed cell.
+ * @param[in]  asn          Absolute Slot Number of the timeslot in which the cell was performed.
+ */
+extern void nrf_802154_tsch_cell_completed(uint16_t slot_offset, uint64_t asn);
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
+/**
+ * @brief Notifies that a Data Request was received and acknowledged.
+ *
+ * This function is called instead of the receive notification. The Frame Pending bit of the ACK
+ * that was transmitted is reported in @p p_metadata. Data Requests served with a frame from
+ * the indirect transmission queue are not notified.
+ *
+ * @note This notification is dropped if the notification queue is full.
+ *
+ * @param[in]  p_src_addr         Pointer to the source address of the Data Request.
+ * @param[in]  src_addr_extended  If @p p_src_addr is an extended address.
+ * @param[in]  p_metadata         Pointer to the metadata of the Data Request.
+ */
+extern void nrf_802154_data_request_received(const uint8_t                  * p_src_addr,
+                                             bool                             src_addr_extended,
+                                             const nrf_802154_rx_metadata_t * p_metadata);
+
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_memman Driver memory management
@@ -1083,6 +2096,8 @@ int8_t nrf_802154_rssi_last_get(void);
  * with unknown type. Also, frames with a destination address not matching the device address are
  * ignored.
  *
+ * @note If the mode is fixed with @ref NRF_802154_PROMISCUOUS_MODE, only the fixed value can be set.
+ *
  * @param[in]  enabled  If the promiscuous mode is to be enabled.
  */
 void nrf_802154_promiscuous_set(bool enabled);
@@ -1095,37 +2110,480 @@ void nrf_802154_promiscuous_set(bool enabled);
  */
 bool nrf_802154_promiscuous_get(void);
 
+#if NRF_802154_CAPTURE_ENABLED
+
 /**
  * @}
- * @defgroup nrf_802154_autoack Auto ACK management
+ * @defgroup nrf_802154_capture Frame capture
  * @{
  */
 
 /**
- * @brief Enables or disables the automatic acknowledgments (auto ACK).
+ * @brief Starts the capture mode.
  *
- * @note The auto ACK is enabled by default.
+ * In the capture mode, each received frame is written to the given ring buffer as a PCAP record
+ * with the IEEE 802.15.4 TAP header. The record contains the timestamp, RSSI, LQI and channel
+ * of the frame. The FCS is not included. Neither @ref nrf_802154_received_raw nor
+ * @ref nrf_802154_received_timestamp_raw is called for captured frames and no receive buffer is
+ * held by a captured frame. ACKs are not transmitted in response to captured frames. Frames that
+ * do not fit in the free space of the ring buffer are dropped.
  *
- * If the auto ACK is enabled, the driver prepares and sends ACK frames automatically
- * aTurnaroundTime (192 us) after the proper frame is received. The driver prepares an ACK frame
- * according to the data provided by @ref nrf_802154_ack_data_set.
- * When the auto ACK is enabled, the driver notifies the next higher layer about the received frame
- * after the ACK frame is transmitted.
- * If the auto ACK is disabled, the driver does not transmit ACK frames. It notifies the next higher
- * layer about the received frames when a frame is received. In this mode, the next higher layer is
- * responsible for sending the ACK frame. ACK frames should be sent using @ref nrf_802154_transmit.
+ * The capture mode should be combined with the promiscuous mode to capture all frames
+ * on the channel.
  *
- * @param[in]  enabled  If the auto ACK should be enabled.
+ * A PCAP file consists of the header written by @ref nrf_802154_capture_pcap_header_get followed
+ * by the records read with @ref nrf_802154_capture_read_get.
+ *
+ * @param[in]  p_ring  Pointer to the memory to be used as the ring buffer. It must be valid until
+ *                     the capture mode is stopped and all records are read.
+ * @param[in]  size    Size of the memory in bytes.
+ *
+ * @retval  true   The capture mode started.
+ * @retval  false  The memory is too small to hold a record of the longest frame.
  */
-void nrf_802154_auto_ack_set(bool enabled);
+bool nrf_802154_capture_start(uint8_t * p_ring, uint32_t size);
 
 /**
- * @brief Checks if the auto ACK is enabled.
+ * @brief Stops the capture mode.
  *
- * @retval True   Auto ACK is enabled.
- * @retval False  Auto ACK is disabled.
+ * Records already written to the ring buffer can still be read.
  */
-bool nrf_802154_auto_ack_get(void);
+void nrf_802154_capture_stop(void);
+
+/**
+ * @brief Gets the next contiguous block of records from the capture ring buffer.
+ *
+ * The block contains only complete records, so it can be sent to the host as a whole.
+ *
+ * @param[out] pp_data  Pointer to the first byte of the block.
+ *
+ * @returns  Size of the block in bytes, 0 if there are no records to read.
+ */
+uint32_t nrf_802154_capture_read_get(const uint8_t ** pp_data);
+
+/**
+ * @brief Releases the space of records read from the capture ring buffer.
+ *
+ * @param[in]  length  Number of bytes from the beginning of the block returned by
+ *                     @ref nrf_802154_capture_read_get that are no longer needed.
+ */
+void nrf_802154_capture_read_commit(uint32_t length);
+
+/**
+ * @brief Gets the number of frames dropped because the capture ring buffer was full.
+ *
+ * @returns  Number of dropped frames since the capture mode was started.
+ */
+uint32_t nrf_802154_capture_dropped_get(void);
+
+/**
+ * @brief Writes the PCAP global header for the records written in the capture mode.
+ *
+ * @param[out] p_header  Pointer to a buffer of at least @ref NRF_802154_CAPTURE_PCAP_HEADER_SIZE
+ *                       bytes.
+ */
+void nrf_802154_capture_pcap_header_get(uint8_t * p_header);
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
+#if NRF_802154_RSSI_STREAM_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_rssi_stream RSSI streaming
+ * @{
+ */
+
+/**
+ * @brief Starts the RSSI streaming.
+ *
+ * While the RSSI streaming is started, the RSSI is measured every @p interval_us in
+ * the @ref RADIO_STATE_RX state, when no frame is being received. The samples are written with
+ * their timestamps and channels to the given ring buffer. Samples that do not fit in the ring
+ * buffer are dropped. Restarting the streaming discards the samples that were not read.
+ *
+ * @param[in]  p_samples    Pointer to the memory to be used as the ring buffer. It must be valid
+ *                          until the RSSI streaming is stopped and all samples are read.
+ * @param[in]  count        Number of samples that fit in the memory. The ring buffer holds
+ *                          up to @p count - 1 samples.
+ * @param[in]  interval_us  Interval between the RSSI samples in microseconds.
+ *
+ * @retval  true   The RSSI streaming started.
+ * @retval  false  @p count is lower than 2 or @p interval_us is 0.
+ */
+bool nrf_802154_rssi_stream_start(nrf_802154_rssi_sample_t * p_samples,
+                                  uint32_t                   count,
+                                  uint32_t                   interval_us);
+
+/**
+ * @brief Stops the RSSI streaming.
+ *
+ * Samples already written to the ring buffer can still be read.
+ */
+void nrf_802154_rssi_stream_stop(void);
+
+/**
+ * @brief Reads the streamed RSSI samples.
+ *
+ * The samples are copied in the order they were measured and their space in the ring buffer
+ * is released.
+ *
+ * @param[out] p_samples  Pointer to the array the samples are copied to.
+ * @param[in]  max_count  Size of the @p p_samples array.
+ *
+ * @returns  Number of samples copied to @p p_samples.
+ */
+uint32_t nrf_802154_rssi_stream_read(nrf_802154_rssi_sample_t * p_samples, uint32_t max_count);
+
+/**
+ * @brief Gets the number of RSSI samples dropped because the ring buffer was full.
+ *
+ * @returns  Number of dropped samples since the RSSI streaming was started.
+ */
+uint32_t nrf_802154_rssi_stream_dropped_get(void);
+
+#endif // NRF_802154_RSSI_STREAM_ENABLED
+
+#if NRF_802154_HEADER_MONITOR_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_header_monitor Header monitor
+ * @{
+ */
+
+/**
+ * @brief Starts the header monitor.
+ *
+ * While the header monitor is started, the MAC header fields of each received frame are written
+ * with its RSSI, LQI, channel and timestamp as a record to the given ring buffer. Unless full
+ * frames are retained with @ref nrf_802154_header_monitor_frames_retain_set, neither
+ * @ref nrf_802154_received_raw nor @ref nrf_802154_received_timestamp_raw is called for
+ * the recorded frames, no receive buffer is held by them and no ACKs are transmitted in response
+ * to them. Frames whose MAC header cannot be parsed are not recorded. Records that do not fit in
+ * the ring buffer are dropped. Restarting the header monitor discards the records that were not
+ * read.
+ *
+ * The header monitor should be combined with the promiscuous mode to record all frames
+ * on the channel.
+ *
+ * @param[in]  p_records  Pointer to the memory to be used as the ring buffer. It must be valid
+ *                        until the header monitor is stopped and all records are read.
+ * @param[in]  count      Number of records that fit in the memory. The ring buffer holds
+ *                        up to @p count - 1 records.
+ *
+ * @retval  true   The header monitor started.
+ * @retval  false  @p count is lower than 2.
+ */
+bool nrf_802154_header_monitor_start(nrf_802154_header_record_t * p_records, uint32_t count);
+
+/**
+ * @brief Stops the header monitor.
+ *
+ * Records already written to the ring buffer can still be read.
+ */
+void nrf_802154_header_monitor_stop(void);
+
+/**
+ * @brief Sets if the received frames are passed to the higher layer in addition to their records.
+ *
+ * Retaining the full frames lets the higher layer inspect the frames it is interested in, for
+ * example after a record of an unexpected frame was read. While the full frames are retained,
+ * they are received as if the header monitor was stopped. Full frames are not retained by default.
+ *
+ * @param[in]  retain  If the received frames are to be passed to the higher layer.
+ */
+void nrf_802154_header_monitor_frames_retain_set(bool retain);
+
+/**
+ * @brief Reads the records written by the header monitor.
+ *
+ * The records are copied in the order the frames were received and their space in the ring
+ * buffer is released.
+ *
+ * @param[out] p_records  Pointer to the array the records are copied to.
+ * @param[in]  max_count  Size of the @p p_records array.
+ *
+ * @returns  Number of records copied to @p p_records.
+ */
+uint32_t nrf_802154_header_monitor_read(nrf_802154_header_record_t * p_records,
+                                        uint32_t                     max_count);
+
+/**
+ * @brief Gets the number of records dropped because the ring buffer was full.
+ *
+ * @returns  Number of dropped records since the header monitor was started.
+ */
+uint32_t nrf_802154_header_monitor_dropped_get(void);
+
+#endif // NRF_802154_HEADER_MONITOR_ENABLED
+
+#if NRF_802154_PER_TEST_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_per_test Packet error rate test
+ * @{
+ */
+
+/**
+ * @brief Configures the burst of frames sent by the next modulated carrier procedure.
+ *
+ * When the burst is configured, @ref nrf_802154_modulated_carrier transmits the given frame
+ * @p count times. The frames are started every @p interval_us by the TIMER peripheral, without
+ * involving the CPU. After the last frame the radio stops transmitting and stays idle until
+ * another operation is requested. If the burst is interrupted, for example by a lost timeslot,
+ * the remaining frames are sent when the modulated carrier is resumed.
+ *
+ * @note @p interval_us must be longer than the duration of the frame.
+ *
+ * @param[in]  count        Number of frames in the burst. 0 restores the continuous
+ *                          modulated carrier.
+ * @param[in]  interval_us  Interval between the starts of consecutive frames in microseconds.
+ */
+void nrf_802154_per_test_transmit_set(uint32_t count, uint32_t interval_us);
+
+/**
+ * @brief Gets the number of frames left to transmit in the burst.
+ *
+ * @returns  Number of frames left. 0 means that the burst has been sent.
+ */
+uint32_t nrf_802154_per_test_transmit_remaining_get(void);
+
+/**
+ * @brief Enables or disables the counting of received frames.
+ *
+ * When the counting is enabled, the receiver counts the frames received with correct and
+ * incorrect CRC instead of delivering them. The higher layer is not notified about the frames
+ * and the receive buffers are not used. The mode is applied when the reception is started
+ * the next time, for example by @ref nrf_802154_receive. Enabling the counting resets
+ * the counters.
+ *
+ * @param[in]  enabled  If the received frames are to be counted.
+ */
+void nrf_802154_per_test_receive_set(bool enabled);
+
+/**
+ * @brief Gets the numbers of frames counted since the counting was enabled.
+ *
+ * @param[out] p_crcok     Number of frames received with correct CRC.
+ * @param[out] p_crcerror  Number of frames received with incorrect CRC.
+ */
+void nrf_802154_per_test_receive_counters_get(uint32_t * p_crcok, uint32_t * p_crcerror);
+
+#endif // NRF_802154_PER_TEST_ENABLED
+
+#if NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_src_filter Source address filter
+ * @{
+ */
+
+/**
+ * @brief Sets the mode of the source address filter.
+ *
+ * @note The source address filter is disabled by default.
+ *
+ * In the @ref NRF_802154_SRC_ADDR_FILTER_ALLOW mode, only frames with the source address
+ * found in the filter list are received. In the @ref NRF_802154_SRC_ADDR_FILTER_DENY mode, frames
+ * with the source address found in the list are dropped. Frames without the source address field
+ * are not affected by the filter. A frame rejected by the filter is dropped as soon as its
+ * addressing fields are received and the higher layer is not notified about it.
+ * The filter is not applied in the promiscuous mode.
+ *
+ * @param[in]  mode  Source address filter mode.
+ */
+void nrf_802154_src_addr_filter_mode_set(nrf_802154_src_addr_filter_mode_t mode);
+
+/**
+ * @brief Adds an address to the source address filter list.
+ *
+ * @param[in]  p_addr    Pointer to the address in the little-endian byte order.
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The address is in the list.
+ * @retval false  The list is full. Its size is set with
+ *                @ref NRF_802154_SRC_ADDR_FILTER_SHORT_ADDRESSES and
+ *                @ref NRF_802154_SRC_ADDR_FILTER_EXTENDED_ADDRESSES.
+ */
+bool nrf_802154_src_addr_filter_add(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Removes an address from the source address filter list.
+ *
+ * @param[in]  p_addr    Pointer to the address in the little-endian byte order.
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The address has been removed from the list.
+ * @retval false  The address was not in the list.
+ */
+bool nrf_802154_src_addr_filter_remove(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Removes all addresses of the given type from the source address filter list.
+ *
+ * @param[in]  extended  If extended MAC addresses or short MAC addresses are to be removed.
+ */
+void nrf_802154_src_addr_filter_reset(bool extended);
+
+#endif // NRF_802154_SRC_ADDR_FILTER_ENABLED
+
+#if NRF_802154_PEER_TABLE_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_peers Peer link quality
+ * @{
+ */
+
+/**
+ * @brief Gets the link quality of the peers known to the driver.
+ *
+ * A peer is added when a frame with its source address is received, or when a frame
+ * requesting an ACK is transmitted to it. Up to @ref NRF_802154_PEER_TABLE_SIZE peers are kept.
+ * The RSSI and LQI averages include the ACKs received from the peer. If
+ * @ref NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED is set, the transmit power reduction
+ * learned for each peer is reported as well.
+ *
+ * @param[out] p_peers    Pointer to the buffer for the link quality of the peers.
+ * @param[in]  max_count  Number of entries that fit in @p p_peers.
+ *
+ * @returns  Number of entries written to @p p_peers.
+ */
+uint8_t nrf_802154_peers_get(nrf_802154_peer_info_t * p_peers, uint8_t max_count);
+
+/**
+ * @brief Removes all peers known to the driver.
+ */
+void nrf_802154_peers_clear(void);
+
+#endif // NRF_802154_PEER_TABLE_ENABLED
+
+#if NRF_802154_ENCRYPTION_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_security Frame security
+ * @{
+ */
+
+/**
+ * @brief Stores a key used to secure the transmitted frames and Enh-Acks.
+ *
+ * A frame requested to be transmitted with the Security Enabled bit set and the Security Level
+ * other than 0 is secured with the key matching its Key Identifier field. The Frame Counter field
+ * is filled in by the driver from the frame counter of the key, which is incremented for each
+ * frame and Enh-Ack secured with the key. The driver updates only the copy of the frame passed to
+ * the radio, so the buffer of the frame is not modified. A frame for which no key is stored is not
+ * transmitted, and a frame whose Enh-Ack cannot be secured is not acknowledged.
+ *
+ * A key with the same identifier as a stored key replaces it. The frame counter of the key is set
+ * to the @c frame_counter field of @p p_key.
+ *
+ * @note Frames with the Frame Counter Suppression bit set and frames with the Key Identifier Mode
+ *       of 0 are not supported.
+ *
+ * @param[in]  p_key  Pointer to the key to store.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The key is stored.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL        There is no free slot for the key.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  The Key Identifier Mode is not 1-3.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_store(const nrf_802154_key_t * p_key);
+
+/**
+ * @brief Removes the key with the given identifier.
+ *
+ * @param[in]  p_id  Pointer to the identifier of the key.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE           The key is removed.
+ * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND  There is no key with the given identifier.
+ */
+nrf_802154_security_error_t nrf_802154_security_key_remove(const nrf_802154_key_id_t * p_id);
+
+/**
+ * @brief Removes all keys.
+ */
+void nrf_802154_security_key_remove_all(void);
+
+/**
+ * @brief Replaces all stored keys with the given ones.
+ *
+ * The keys are replaced at once, so this function can be used to rotate the keys without
+ * the risk of securing a frame or an Enh-Ack with a mix of the old and new keys.
+ * If any of the keys is invalid, the stored keys are not modified.
+ *
+ * @param[in]  p_keys  Pointer to the array of keys to store.
+ * @param[in]  count   Number of keys in @p p_keys, up to @ref NRF_802154_SECURITY_KEY_STORAGE_SIZE.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE                The keys are stored.
+ * @retval NRF_802154_SECURITY_ERROR_STORAGE_FULL        There are more keys than the storage size.
+ * @retval NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED  A Key Identifier Mode is not 1-3.
+ */
+nrf_802154_security_error_t nrf_802154_security_keys_set(const nrf_802154_key_t * p_keys,
+                                                         uint8_t                  count);
+
+/**
+ * @brief Sets the frame counter of all stored keys.
+ *
+ * When all values of the frame counter of a key are used, no more frames are secured with
+ * the key until its frame counter is set again, or the key is replaced.
+ *
+ * @param[in]  frame_counter  Value of the frame counter.
+ */
+void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter);
+
+#endif // NRF_802154_ENCRYPTION_ENABLED
+
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Sets the sequence number to be assigned to the next transmitted frame.
+ *
+ * The driver increments the number for each new frame it transmits. This function is to be used
+ * to restore the sequence number of the MAC layer, for example after a reset.
+ *
+ * @param[in]  dsn  Sequence number.
+ */
+void nrf_802154_tx_dsn_set(uint8_t dsn);
+
+#endif // NRF_802154_TX_DSN_ASSIGN_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_autoack Auto ACK management
+ * @{
+ */
+
+/**
+ * @brief Enables or disables the automatic acknowledgments (auto ACK).
+ *
+ * @note The auto ACK is enabled by default.
+ *
+ * If the auto ACK is enabled, the driver prepares and sends ACK frames automatically
+ * aTurnaroundTime (192 us) after the proper frame is received. The driver prepares an ACK frame
+ * according to the data provided by @ref nrf_802154_ack_data_set.
+ * When the auto ACK is enabled, the driver notifies the next higher layer about the received frame
+ * after the ACK frame is transmitted.
+ * If the auto ACK is disabled, the driver does not transmit ACK frames. It notifies the next higher
+ * layer about the received frames when a frame is received. In this mode, the next higher layer is
+ * responsible for sending the ACK frame. ACK frames should be sent using @ref nrf_802154_transmit.
+ *
+ * @note If the mode is fixed with @ref NRF_802154_AUTO_ACK_MODE, only the fixed value can be set.
+ *
+ * @param[in]  enabled  If the auto ACK should be enabled.
+ */
+void nrf_802154_auto_ack_set(bool enabled);
+
+/**
+ * @brief Checks if the auto ACK is enabled.
+ *
+ * @retval True   Auto ACK is enabled.
+ * @retval False  Auto ACK is disabled.
+ */
+bool nrf_802154_auto_ack_get(void);
 
 /**
  * @brief Configures the device as the PAN coordinator.
@@ -1144,6 +2602,27 @@ void nrf_802154_pan_coord_set(bool enabled);
  */
 bool nrf_802154_pan_coord_get(void);
 
+/**
+ * @brief Sets the types of frames accepted by the receive filter.
+ *
+ * @note Frames of all types are accepted by default.
+ *
+ * The frame type is checked as soon as the Frame Control field of a frame is received. A frame
+ * of a type not included in @p mask is dropped at once and the higher layer is not notified about
+ * it. The filter is not applied in the promiscuous mode. The frame type filter does not affect
+ * ACK frames received in response to transmitted frames.
+ *
+ * @param[in]  mask  Bitwise OR of @c NRF_802154_FRAME_TYPE_FILTER_* values of accepted frame types.
+ */
+void nrf_802154_frame_type_filter_set(nrf_802154_frame_type_filter_t mask);
+
+/**
+ * @brief Gets the types of frames accepted by the receive filter.
+ *
+ * @returns  Bitwise OR of @c NRF_802154_FRAME_TYPE_FILTER_* values of accepted frame types.
+ */
+nrf_802154_frame_type_filter_t nrf_802154_frame_type_filter_get(void);
+
 /**
  * @brief Select the source matching algorithm.
  *
@@ -1177,7 +2656,7 @@ void nrf_802154_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_m
  * @param[in]  data_type Type of data to be set. Refer to the @ref nrf_802154_ack_data_t type.
  *
  * @retval True   Address successfully added to the list.
- * @retval False  Not enough memory to store this address in the list.
+ * @retval False  Not enough memory to store this address or its IE data in the list.
  */
 bool nrf_802154_ack_data_set(const uint8_t       * p_addr,
                              bool                  extended,
@@ -1210,6 +2689,67 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
                                bool                  extended,
                                nrf_802154_ack_data_t data_type);
 
+/**
+ * @brief Sets the function updating the IE data of Enh-Ack frames just before they are transmitted.
+ *
+ * The function is called for every Enh-Ack containing IE data set with
+ * @ref nrf_802154_ack_data_set. It receives the time at which the Enh-Ack is to be transmitted,
+ * so it can fill time-dependent fields in place, for example the phase in a CSL IE. This way,
+ * the IE data does not need to be refreshed periodically with @ref nrf_802154_ack_data_set.
+ *
+ * @note The function is called from the radio interrupt handler within the ACK turnaround time.
+ *       It must be very short.
+ *
+ * @param[in]  writer  Function to be called or NULL to transmit the IE data unchanged.
+ */
+void nrf_802154_ack_ie_writer_set(nrf_802154_ack_ie_writer_t writer);
+
+/**
+ * @brief Sets the function deciding the pending bit in ACKs instead of the pending bit list.
+ *
+ * The function is called with the source address of each frame that is to be acknowledged, so
+ * a higher layer that keeps its own queues of pending frames can answer from them directly, and
+ * it does not need to mirror them with @ref nrf_802154_ack_data_set. The function takes
+ * precedence over the source address matching method for frames with a source address. Frames
+ * without a source address are still handled by the matching method.
+ *
+ * @note The function is called from the radio interrupt handler within the ACK turnaround time.
+ *       See @ref nrf_802154_pending_bit_decider_t for its time budget.
+ *
+ * @param[in]  decider  Function to be called or NULL to use the pending bit list.
+ */
+void nrf_802154_pending_bit_decider_set(nrf_802154_pending_bit_decider_t decider);
+
+#if NRF_802154_LINK_METRICS_ENABLED
+
+/**
+ * @brief Configures the link metrics written into Enh-Acks sent to an initiator of Enh-Ack based
+ *        probing.
+ *
+ * The driver accumulates the RSSI and LQI of the frames received from the initiator and writes
+ * the requested metrics into the Enh-Ack to each of them. The metrics are written into
+ * the values of the Thread vendor-specific header IE for Enh-Ack based probing, which must be
+ * a part of the IE data set for the initiator with @ref nrf_802154_ack_data_set. The IE data needs
+ * to be set only once, with any values of the metrics.
+ *
+ * @param[in]  p_addr    Pointer to the address of the initiator (little-endian).
+ * @param[in]  extended  Indication if @p p_addr is an extended address or a short address.
+ * @param[in]  metrics   Metrics to write, or 0 to stop writing metrics for the initiator.
+ *
+ * @retval true   The initiator is configured.
+ * @retval false  @ref NRF_802154_LINK_METRICS_INITIATORS initiators are already configured.
+ */
+bool nrf_802154_link_metrics_initiator_configure(const uint8_t           * p_addr,
+                                                 bool                      extended,
+                                                 nrf_802154_link_metrics_t metrics);
+
+/**
+ * @brief Stops writing the link metrics for all initiators.
+ */
+void nrf_802154_link_metrics_reset(void);
+
+#endif // NRF_802154_LINK_METRICS_ENABLED
+
 /**
  * @brief Enables or disables setting a pending bit in automatically transmitted ACK frames.
  *
@@ -1273,6 +2813,42 @@ bool nrf_802154_pending_bit_for_addr_set(const uint8_t * p_addr, bool extended);
  */
 bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended);
 
+/**
+ * @brief Adds addresses of multiple peer nodes to the pending bit list.
+ *
+ * This function is equivalent to calling @ref nrf_802154_pending_bit_for_addr_set for every
+ * address in @p p_addrs, but it is much faster for many addresses. The array is sorted once
+ * and the list is updated in a single pass. ACK frames are never prepared using a partially
+ * updated list.
+ *
+ * @note This function sorts the @p p_addrs array in place and removes duplicated addresses from it.
+ *
+ * @param[inout] p_addrs   Array of addresses of the nodes (little-endian). Addresses are placed
+ *                         one after another, each taking 2 or 8 bytes depending on @p extended.
+ * @param[in]    count     Number of addresses in @p p_addrs.
+ * @param[in]    extended  If the given addresses are extended MAC addresses or short MAC addresses.
+ *
+ * @retval True   All addresses are successfully added to the list.
+ * @retval False  Not enough memory to store all addresses in the list. The list is not modified.
+ */
+bool nrf_802154_pending_bit_for_addr_set_bulk(uint8_t * p_addrs, uint32_t count, bool extended);
+
+/**
+ * @brief Removes addresses of multiple peer nodes from the pending bit list.
+ *
+ * This function is equivalent to calling @ref nrf_802154_pending_bit_for_addr_clear for every
+ * address in @p p_addrs, but it is much faster for many addresses. Addresses missing from the
+ * list are ignored.
+ *
+ * @note This function sorts the @p p_addrs array in place and removes duplicated addresses from it.
+ *
+ * @param[inout] p_addrs   Array of addresses of the nodes (little-endian). Addresses are placed
+ *                         one after another, each taking 2 or 8 bytes depending on @p extended.
+ * @param[in]    count     Number of addresses in @p p_addrs.
+ * @param[in]    extended  If the given addresses are extended MAC addresses or short MAC addresses.
+ */
+void nrf_802154_pending_bit_for_addr_clear_bulk(uint8_t * p_addrs, uint32_t count, bool extended);
+
 /**
  * @brief Removes all addresses of a given type from the pending bit list.
  *
@@ -1337,6 +2913,52 @@ void nrf_802154_cca_cfg_get(nrf_802154_cca_cfg_t * p_cca_cfg);
  */
 void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data);
 
+/**
+ * @brief Performs the CSMA-CA procedure with the given parameters applied to this frame only.
+ *
+ * This function works like @ref nrf_802154_transmit_csma_ca_raw. Additionally, the parameters
+ * selected by @c p_params->flags are applied to each CCA attempt of the procedure and to
+ * the transmission, as in @ref nrf_802154_transmit_raw_ex. With
+ * @ref NRF_802154_TX_PARAM_CCA_CFG, frames of different classes can use a different CCA mode and
+ * energy threshold without modifying the PIB. The @c p_params->cca field is ignored, as
+ * the CSMA-CA procedure always performs the CCA. Retransmissions of the frame use the same
+ * parameters.
+ *
+ * @param[in]  p_data    Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  p_params  Pointer to the transmission parameters. The structure is copied, so it
+ *                       does not need to be valid after this function returns.
+ */
+void nrf_802154_transmit_csma_ca_raw_ex(const uint8_t                * p_data,
+                                        const nrf_802154_tx_params_t * p_params);
+
+/**
+ * @brief Performs the CSMA-CA procedure starting at the given time.
+ *
+ * This function works like @ref nrf_802154_transmit_csma_ca_raw, but the first backoff period
+ * starts @p dt microseconds after @p t0. It is meant for contention-based access in scheduled
+ * periods, like shared TSCH cells or contention access periods.
+ *
+ * If the frame cannot be transmitted within @p window microseconds from the start of
+ * the procedure, @ref nrf_802154_transmit_failed is called with
+ * @ref NRF_802154_TX_ERROR_DEADLINE_MISSED. Retransmissions of the frame are performed
+ * with the immediate CSMA-CA procedure, without the window.
+ *
+ * @param[in]  p_data    Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  t0        Base of delay time, in microseconds.
+ * @param[in]  dt        Delay from @p t0 to the start of the procedure, in microseconds.
+ * @param[in]  window    Time in which CCA attempts can be made, in microseconds.
+ * @param[in]  p_params  Pointer to the transmission parameters, as in
+ *                       @ref nrf_802154_transmit_csma_ca_raw_ex, or NULL to use the PIB.
+ *
+ * @retval  true   The procedure was scheduled.
+ * @retval  false  The procedure was not scheduled, because the requested time is in the past.
+ */
+bool nrf_802154_transmit_csma_ca_raw_at(const uint8_t                * p_data,
+                                        uint32_t                       t0,
+                                        uint32_t                       dt,
+                                        uint32_t                       window,
+                                        const nrf_802154_tx_params_t * p_params);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -1424,6 +3046,10 @@ uint8_t nrf_802154_csma_ca_max_backoffs_get(void);
  *
  * A timeout is notified by @ref nrf_802154_transmit_failed.
  *
+ * The timeout of each frame is computed from the durations of the frame and of the ACK expected
+ * for it, see @ref NRF_802154_ACK_TIMEOUT_ENH_ACK_MAX_LENGTH. The timeout set by this function
+ * is the upper limit of the computed timeout.
+ *
  * @param[in]  time  Timeout in microseconds (us).
  *                   A default value is defined in nrf_802154_config.h.
  */
@@ -1431,6 +3057,49 @@ void nrf_802154_ack_timeout_set(uint32_t time);
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_retransmission Frame retransmission
+ * @{
+ */
+#if NRF_802154_RETRANSMISSION_ENABLED
+
+/**
+ * @brief Sets the maximum number of retransmissions of a frame that was not acknowledged.
+ *
+ * Frames transmitted with @ref nrf_802154_transmit_csma_ca_raw or
+ * @ref nrf_802154_transmit_csma_ca that are not acknowledged are transmitted again, each time
+ * after a new CSMA-CA procedure, until they are acknowledged or the maximum number
+ * of retransmissions is reached. Only the final result is notified to the higher layer.
+ *
+ * @param[in]  max_retries  Maximum number of retransmissions (macMaxFrameRetries). Allowed values
+ *                          are from 0 to 7. 0 disables retransmissions.
+ *
+ * @retval true   When value provided by @p max_retries has been set successfully.
+ * @retval false  Otherwise.
+ */
+bool nrf_802154_max_frame_retries_set(uint8_t max_retries);
+
+/**
+ * @brief Gets the maximum number of retransmissions of a frame that was not acknowledged.
+ *
+ * @return Current maximum number of retransmissions.
+ */
+uint8_t nrf_802154_max_frame_retries_get(void);
+
+/**
+ * @brief Gets the number of transmission attempts of the last frame transmitted with CSMA-CA.
+ *
+ * This function is intended to be called from @ref nrf_802154_transmitted_raw,
+ * @ref nrf_802154_transmitted, or @ref nrf_802154_transmit_failed to get the number of attempts
+ * it took to transmit the notified frame.
+ *
+ * @return Number of transmission attempts, including the first one.
+ */
+uint8_t nrf_802154_transmit_attempts_get(void);
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_coex Wifi Coex feature
@@ -1557,6 +3226,18 @@ void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timest
  */
 void nrf_802154_stat_counters_reset(void);
 
+/**
+ * @brief Get a consistent snapshot of the statistics and the total times.
+ *
+ * Unlike @ref nrf_802154_stats_get and @ref nrf_802154_stat_totals_get, this function returns
+ * all the fields as they were at a single point in time. It does not mask the interrupts. The
+ * values are copied again if the driver updated any of them during the copy, so it should not
+ * be called from an interrupt with higher priority than the radio driver.
+ *
+ * @param[out] p_snapshot Structure that will be filled with the current statistics.
+ */
+void nrf_802154_stat_snapshot_get(nrf_802154_stat_snapshot_t * p_snapshot);
+
 /**
  * @brief Get total times spent in certain states.
  *
@@ -1565,6 +3246,209 @@ void nrf_802154_stat_counters_reset(void);
  */
 void nrf_802154_stat_totals_get(nrf_802154_stat_totals_t * p_stat_totals);
 
+#if NRF_802154_ENERGY_MODEL_ENABLED
+
+/**
+ * @brief Get the charge used by the radio, estimated from the total times.
+ *
+ * The times from @ref nrf_802154_stat_totals_get are multiplied by the currents configured with
+ * the @c NRF_802154_ENERGY_*_CURRENT options.
+ *
+ * @param[out] p_charge Structure that will be filled with the charge used until now.
+ */
+void nrf_802154_stat_charge_get(nrf_802154_stat_charge_t * p_charge);
+
+#endif // NRF_802154_ENERGY_MODEL_ENABLED
+
+/**
+ * @brief Get histograms of the CSMA-CA procedure.
+ *
+ * The histograms describe how many backoffs the transmitted frames needed, how long the single
+ * backoff periods were and how long it took from the start of the procedure to the start of
+ * the transmission. Each bucket is copied atomically, but the snapshot as a whole is not.
+ *
+ * @param[out] p_histogram Structure that will be filled with current histogram values.
+ */
+void nrf_802154_stat_csma_histogram_get(nrf_802154_stat_csma_histogram_t * p_histogram);
+
+/**
+ * @brief Resets histograms of the CSMA-CA procedure to 0.
+ */
+void nrf_802154_stat_csma_histogram_reset(void);
+
+/**
+ * @brief Get statistics of the notification and request queues.
+ *
+ * The statistics contain the highest number of items the queues held, the number of items
+ * pushed when the queue had at most one free slot left and a histogram of the time the items
+ * spent in the queue. Bucket n of the histogram counts items that waited less than
+ * (@ref NRF_802154_STAT_LATENCY_BUCKET_BASE_US << n) microseconds, the last bucket counts
+ * all the longer waits. The time is measured with the high precision timer, which runs only
+ * while the radio driver is granted the timeslot. The statistics are updated only if
+ * @ref NRF_802154_QUEUE_STATS_ENABLED is set.
+ *
+ * @param[out] p_stat_queues Structure that will be filled with current queues statistics.
+ */
+void nrf_802154_stat_queues_get(nrf_802154_stat_queues_t * p_stat_queues);
+
+/**
+ * @brief Resets statistics of the notification and request queues to 0.
+ */
+void nrf_802154_stat_queues_reset(void);
+
+/**
+ * @brief Get statistic counters of each channel.
+ *
+ * The counters are updated only if @ref NRF_802154_STATS_PER_CHANNEL_ENABLED is set. Events
+ * of transmissions with per-frame transmit parameters are counted for the channel the frame
+ * was transmitted on.
+ *
+ * @param[out] p_stat_channels Structure that will be filled with current counter values.
+ */
+void nrf_802154_stat_channels_get(nrf_802154_stat_channels_t * p_stat_channels);
+
+/**
+ * @brief Resets statistic counters of each channel to 0.
+ */
+void nrf_802154_stat_channels_reset(void);
+
+/**
+ * @brief Get latency histograms of the notifications and requests.
+ *
+ * The histograms describe the time from the end of a received frame to the call of its
+ * notification, from the end of a transmitted frame or its ACK to the call of the transmitted
+ * notification and from a request call to the start of its handling by the core. The buckets
+ * are defined as in @ref nrf_802154_stat_queues_get. The histograms are updated only if
+ * @ref NRF_802154_LATENCY_STATS_ENABLED is set.
+ *
+ * @param[out] p_histogram Structure that will be filled with current histogram values.
+ */
+void nrf_802154_stat_latency_histogram_get(nrf_802154_stat_latency_histogram_t * p_histogram);
+
+/**
+ * @brief Resets latency histograms of the notifications and requests to 0.
+ */
+void nrf_802154_stat_latency_histogram_reset(void);
+
+/**
+ * @brief Get hold times of the critical section of the driver.
+ *
+ * Only the outermost critical sections are measured, so the time of a nested critical section
+ * is a part of the hold time of its outermost one. The hold times are counted by the module that
+ * entered the critical section and by the priority of the interrupt it was entered from.
+ * The profile is updated only if @ref NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED is set.
+ *
+ * @param[out] p_stat_crit_sect Structure that will be filled with the current profile.
+ */
+void nrf_802154_stat_crit_sect_get(nrf_802154_stat_crit_sect_t * p_stat_crit_sect);
+
+/**
+ * @brief Resets hold times of the critical section of the driver to 0.
+ */
+void nrf_802154_stat_crit_sect_reset(void);
+
+/**
+ * @brief Get execution times of the RADIO interrupt handler in CPU cycles.
+ *
+ * The times are provided for the whole handler, for the handler of each RADIO event and for
+ * the core callbacks called for received frames. The times of the nested items are included
+ * in the times of the items they are called from. The profile is updated only if
+ * @ref NRF_802154_IRQ_PROFILER_ENABLED is set.
+ *
+ * @param[out] p_stat_irq_cycles Structure that will be filled with the current profile.
+ */
+void nrf_802154_stat_irq_cycles_get(nrf_802154_stat_irq_cycles_t * p_stat_irq_cycles);
+
+/**
+ * @brief Resets execution times of the RADIO interrupt handler to 0.
+ */
+void nrf_802154_stat_irq_cycles_reset(void);
+
+/**
+ * @brief Get histograms of the power sampled on each channel while no frame was received.
+ *
+ * The power is sampled periodically while the driver is in the receive state and no frame is
+ * being received. The histograms describe how busy the channels were without performing
+ * the energy detection procedure. They are updated only if
+ * @ref NRF_802154_OCCUPANCY_MONITOR_ENABLED is set.
+ *
+ * @param[out] p_stat_occupancy Structure that will be filled with current histogram values.
+ */
+void nrf_802154_stat_occupancy_get(nrf_802154_stat_occupancy_t * p_stat_occupancy);
+
+/**
+ * @brief Resets histograms of the power sampled on each channel to 0.
+ */
+void nrf_802154_stat_occupancy_reset(void);
+
+/**
+ * @brief Get statistics of the access to the medium granted by the Wi-Fi coexistence PTA.
+ *
+ * A transmission requested from the PTA is counted as an ACK transmission if the driver is
+ * transmitting an ACK when the request changes. The buckets of the grant latency histograms
+ * are defined as in @ref nrf_802154_stat_queues_get. The statistics are updated only if
+ * @ref NRF_802154_COEX_STATS_ENABLED is set.
+ *
+ * @param[out] p_stat_coex Structure that will be filled with current statistics.
+ */
+void nrf_802154_stat_coex_get(nrf_802154_stat_coex_t * p_stat_coex);
+
+/**
+ * @brief Resets statistics of the access to the medium granted by the Wi-Fi coexistence PTA to 0.
+ */
+void nrf_802154_stat_coex_reset(void);
+
+/**
+ * @brief Get statistics of the antenna diversity in the receive operations.
+ *
+ * The RSSI histograms and the antenna changes are counted for the frames received while
+ * the antenna diversity selects the antenna for reception. The decision latency is measured from
+ * the detection of a possible preamble to the start of the frame with the high precision timer.
+ * The statistics are updated only if @ref NRF_802154_ANT_DIV_STATS_ENABLED is set.
+ *
+ * @param[out] p_stat_ant_div Structure that will be filled with current statistics.
+ */
+void nrf_802154_stat_ant_div_get(nrf_802154_stat_ant_div_t * p_stat_ant_div);
+
+/**
+ * @brief Resets statistics of the antenna diversity in the receive operations to 0.
+ */
+void nrf_802154_stat_ant_div_reset(void);
+
+/**
+ * @brief Get statistics of the timeslots granted by the radio scheduler.
+ *
+ * A timeslot that ends while the driver is not going to sleep is counted as revoked, for
+ * example when another protocol preempts the driver in a multiprotocol build. The lost time
+ * is measured from a revocation to the next grant. The statistics are updated only if
+ * @ref NRF_802154_TIMESLOT_STATS_ENABLED is set.
+ *
+ * @param[out] p_stat_timeslot Structure that will be filled with current statistics.
+ */
+void nrf_802154_stat_timeslot_get(nrf_802154_stat_timeslot_t * p_stat_timeslot);
+
+/**
+ * @brief Resets statistics of the timeslots granted by the radio scheduler to 0.
+ *
+ * The log read by @ref nrf_802154_stat_timeslot_log_read is not affected.
+ */
+void nrf_802154_stat_timeslot_reset(void);
+
+/**
+ * @brief Reads the log of the granted and ended timeslots.
+ *
+ * The events are copied from the oldest one and removed from the log. Up to
+ * @ref NRF_802154_TIMESLOT_STATS_LOG_SIZE last events are kept.
+ *
+ * @param[out] p_events   Pointer to the array the events are copied to.
+ * @param[in]  max_count  Size of the @p p_events array.
+ *
+ * @returns  Number of events copied to @p p_events. Always 0 if
+ *           @ref NRF_802154_TIMESLOT_STATS_ENABLED is not set.
+ */
+uint32_t nrf_802154_stat_timeslot_log_read(nrf_802154_stat_timeslot_event_t * p_events,
+                                           uint32_t                           max_count);
+
 /**
  * @}
  * @defgroup nrf_802154_ifs Inter-frame spacing feature
@@ -1619,6 +3503,207 @@ void nrf_802154_ifs_min_lifs_period_set(uint16_t period);
 
 #endif // NRF_802154_IFS_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_tsch TSCH slotframe engine
+ * @{
+ */
+#if NRF_802154_TSCH_ENABLED
+
+/**
+ * @brief Starts the TSCH slotframe engine.
+ *
+ * The engine schedules the operations of the cells added with @ref nrf_802154_tsch_cell_add
+ * on its own, on the channels selected by the hopping sequence. Completed cells are notified with
+ * @ref nrf_802154_tsch_cell_completed.
+ *
+ * @param[in]  p_config  Pointer to the slotframe configuration. It is copied by the driver.
+ *
+ * @retval true   The slotframe engine started.
+ * @retval false  The engine is already running, the configuration is invalid, or no cells
+ *                were added.
+ */
+bool nrf_802154_tsch_start(const nrf_802154_tsch_config_t * p_config);
+
+/**
+ * @brief Stops the TSCH slotframe engine.
+ *
+ * @retval true   The slotframe engine stopped.
+ * @retval false  The slotframe engine was not running.
+ */
+bool nrf_802154_tsch_stop(void);
+
+/**
+ * @brief Adds a cell to the TSCH slotframe.
+ *
+ * @param[in]  p_cell  Pointer to the cell to be added. It is copied by the driver.
+ *
+ * @retval true   The cell was added.
+ * @retval false  There are already @ref NRF_802154_TSCH_MAX_CELLS cells or a cell with the same
+ *                slot offset.
+ */
+bool nrf_802154_tsch_cell_add(const nrf_802154_tsch_cell_t * p_cell);
+
+/**
+ * @brief Removes a cell from the TSCH slotframe.
+ *
+ * @param[in]  slot_offset  Slot offset of the cell to be removed.
+ *
+ * @retval true   The cell was removed.
+ * @retval false  There is no cell with the given slot offset.
+ */
+bool nrf_802154_tsch_cell_remove(uint16_t slot_offset);
+
+/**
+ * @brief Assigns a frame to be transmitted in the next occurrence of a TSCH cell.
+ *
+ * @param[in]  slot_offset  Slot offset of a @ref NRF_802154_TSCH_CELL_TYPE_TX or
+ *                          @ref NRF_802154_TSCH_CELL_TYPE_SHARED cell.
+ * @param[in]  p_data       Pointer to a buffer containing PHR and PSDU of the frame. The buffer
+ *                          must stay valid until the transmission is notified. Pass NULL to clear
+ *                          the frame assigned to the cell.
+ *
+ * @retval true   The frame was assigned to the cell.
+ * @retval false  There is no cell with the given slot offset that can be used to transmit.
+ */
+bool nrf_802154_tsch_cell_frame_set(uint16_t slot_offset, const uint8_t * p_data);
+
+#endif // NRF_802154_TSCH_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_rx_hopping Receive hopping schedule
+ * @{
+ */
+#if NRF_802154_RX_HOPPING_ENABLED
+
+/**
+ * @brief Starts switching the receiver between the channels of a list.
+ *
+ * The driver stays on each channel for its dwell time and then switches to the next one, starting
+ * again from the first channel after the last one. The switch does not restart the receive
+ * operation. If a frame is being received or transmitted when the dwell time ends, the switch
+ * is retried after @ref NRF_802154_RX_HOPPING_RETRY_DELAY, so the frame and its ACK are completed
+ * on the current channel. The channel of each received frame is reported in
+ * @ref nrf_802154_rx_metadata_t.
+ *
+ * While the schedule is running, it sets the channel in place of @ref nrf_802154_channel_set.
+ * The first channel is set when this function is called.
+ *
+ * @param[in]  p_hops  Array of the channels with their dwell times. It is copied by the driver.
+ * @param[in]  count   Number of channels in @p p_hops.
+ *
+ * @retval true   The schedule started.
+ * @retval false  The schedule is already running, or the list is empty or longer than
+ *                @ref NRF_802154_RX_HOPPING_MAX_CHANNELS.
+ */
+bool nrf_802154_rx_hopping_start(const nrf_802154_rx_hop_t * p_hops, uint8_t count);
+
+/**
+ * @brief Stops switching the receiver between channels.
+ *
+ * The receiver stays on the current channel, which can be read with
+ * @ref nrf_802154_channel_get.
+ *
+ * @retval true   The schedule stopped.
+ * @retval false  The schedule was not running.
+ */
+bool nrf_802154_rx_hopping_stop(void);
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_async Asynchronous requests
+ * @{
+ */
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+
+/**
+ * @brief Requests entering the sleep state without waiting until the request is processed.
+ *
+ * The result of the request, equal to the value that @ref nrf_802154_sleep would return, is passed
+ * to @ref nrf_802154_async_request_done with @ref NRF_802154_ASYNC_REQUEST_SLEEP.
+ *
+ * @retval true   The request was queued.
+ * @retval false  The request queue is full. The request is not notified.
+ */
+bool nrf_802154_sleep_async(void);
+
+/**
+ * @brief Requests entering the receive state without waiting until the request is processed.
+ *
+ * The result of the request, equal to the value that @ref nrf_802154_receive would return,
+ * is passed to @ref nrf_802154_async_request_done with @ref NRF_802154_ASYNC_REQUEST_RECEIVE.
+ *
+ * @retval true   The request was queued.
+ * @retval false  The request queue is full. The request is not notified.
+ */
+bool nrf_802154_receive_async(void);
+
+#if NRF_802154_USE_RAW_API
+
+/**
+ * @brief Requests a frame transmission without waiting until the request is processed.
+ *
+ * The result of the request, equal to the value that @ref nrf_802154_transmit_raw would return,
+ * is passed to @ref nrf_802154_async_request_done with @ref NRF_802154_ASYNC_REQUEST_TRANSMIT.
+ * If the result is true, the end of the transmission is notified as for
+ * @ref nrf_802154_transmit_raw.
+ *
+ * @param[in]  p_data  Pointer to the array with data to transmit. The first byte must contain
+ *                     the frame length (including FCS). The buffer must stay untouched until
+ *                     the request is notified and, if it succeeded, until the end of
+ *                     the transmission is notified.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ *
+ * @retval true   The request was queued.
+ * @retval false  The request queue is full. The request is not notified.
+ */
+bool nrf_802154_transmit_raw_async(const uint8_t * p_data, bool cca);
+
+#endif // NRF_802154_USE_RAW_API
+
+/**
+ * @brief Changes the channel without waiting until the radio is reconfigured.
+ *
+ * The new channel is stored at once, so @ref nrf_802154_channel_get returns it. If the channel
+ * changed, applying it to the radio is notified with @ref nrf_802154_async_request_done with
+ * @ref NRF_802154_ASYNC_REQUEST_CHANNEL_UPDATE.
+ *
+ * @param[in]  channel  Channel number (11-26).
+ *
+ * @retval true   The channel did not change or the request was queued.
+ * @retval false  The request queue is full. The new channel is applied with the next operation.
+ */
+bool nrf_802154_channel_set_async(uint8_t channel);
+
+/**
+ * @brief Changes the CCA configuration without waiting until the radio is reconfigured.
+ *
+ * Applying the configuration to the radio is notified with @ref nrf_802154_async_request_done
+ * with @ref NRF_802154_ASYNC_REQUEST_CCA_CFG_UPDATE.
+ *
+ * @param[in]  p_cca_cfg  Pointer to the CCA configuration structure. Only fields relevant to
+ *                        the selected mode are updated.
+ *
+ * @retval true   The request was queued.
+ * @retval false  The request queue is full. The new configuration is applied with the next
+ *                operation.
+ */
+bool nrf_802154_cca_cfg_set_async(const nrf_802154_cca_cfg_t * p_cca_cfg);
+
+/**
+ * @brief Notifies that an asynchronous request was processed.
+ *
+ * @param[in]  request  Type of the processed request.
+ * @param[in]  result   Result of the request. Its meaning is the same as the value returned
+ *                      by the synchronous variant of the request.
+ */
+extern void nrf_802154_async_request_done(nrf_802154_async_request_t request, bool result);
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements capturing of received frames to a ring buffer in the PCAP record format.
+ *
+ * Each record consists of the PCAP record header followed by the IEEE 802.15.4 TAP header
+ * (link type LINKTYPE_IEEE802_15_4_TAP) and the PSDU of the frame without the FCS. The FCS is not
+ * included, because the radio overwrites part of it with the LQI value. Records are never split
+ * at the end of the ring buffer, so the ring can be read out in contiguous blocks, for example
+ * by a DMA transfer, without parsing the records.
+ *
+ */
+
+#include "nrf_802154_capture_ring.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_CAPTURE_ENABLED
+
+#define PCAP_MAGIC                 0xa1b2c3d4UL ///< PCAP magic number, timestamps in us.
+#define PCAP_VERSION_MAJOR         2            ///< Major version of the PCAP file format.
+#define PCAP_VERSION_MINOR         4            ///< Minor version of the PCAP file format.
+#define PCAP_SNAPLEN               256          ///< Maximum length of a captured frame.
+#define PCAP_LINKTYPE_802154_TAP   283          ///< LINKTYPE_IEEE802_15_4_TAP link type.
+#define PCAP_RECORD_HEADER_SIZE    16           ///< Size of the PCAP record header.
+
+#define TAP_HEADER_SIZE            4            ///< Size of the TAP header without TLVs.
+#define TAP_TLV_SIZE               8            ///< Size of each TLV, with padding.
+#define TAP_TLV_COUNT              4            ///< Number of TLVs in each record.
+#define TAP_TLV_FCS_TYPE           0            ///< TLV with the type of the FCS.
+#define TAP_TLV_RSS                1            ///< TLV with the received signal strength in dBm.
+#define TAP_TLV_CHANNEL_ASSIGNMENT 3            ///< TLV with the channel and page.
+#define TAP_TLV_LQI                10           ///< TLV with the link quality indicator.
+#define TAP_FCS_TYPE_NONE          0            ///< No FCS is included in the frame.
+
+/// Size of the record overhead added to the PSDU of each frame.
+#define RECORD_OVERHEAD_SIZE \
+    (PCAP_RECORD_HEADER_SIZE + TAP_HEADER_SIZE + (TAP_TLV_COUNT * TAP_TLV_SIZE))
+
+/// Size of the record of the longest frame.
+#define RECORD_MAX_SIZE      (RECORD_OVERHEAD_SIZE + MAX_PACKET_SIZE - FCS_SIZE)
+
+static uint8_t         * mp_ring;     ///< Memory of the ring buffer.
+static uint32_t          m_size;      ///< Size of the ring buffer.
+static volatile uint32_t m_write_idx; ///< Index at which the next record is written.
+static volatile uint32_t m_read_idx;  ///< Index of the first byte not read yet.
+static volatile uint32_t m_wrap_idx;  ///< End of valid data if records continue from the start.
+static volatile uint32_t m_dropped;   ///< Number of frames dropped due to lack of space.
+static volatile bool     m_enabled;   ///< If received frames are captured.
+
+static uint8_t * le16_write(uint8_t * p_buf, uint16_t value)
+{
+    p_buf[0] = (uint8_t)value;
+    p_buf[1] = (uint8_t)(value >> 8);
+
+    return p_buf + sizeof(uint16_t);
+}
+
+static uint8_t * le32_write(uint8_t * p_buf, uint32_t value)
+{
+    p_buf[0] = (uint8_t)value;
+    p_buf[1] = (uint8_t)(value >> 8);
+    p_buf[2] = (uint8_t)(value >> 16);
+    p_buf[3] = (uint8_t)(value >> 24);
+
+    return p_buf + sizeof(uint32_t);
+}
+
+/**
+ * @brief Write a TLV of the TAP header padded to @ref TAP_TLV_SIZE bytes.
+ *
+ * @param[out] p_buf     Pointer to the buffer the TLV is written to.
+ * @param[in]  type      Type of the TLV.
+ * @param[in]  p_value   Pointer to the value of the TLV.
+ * @param[in]  length    Length of the value, at most 4 bytes.
+ *
+ * @returns  Pointer to the first byte following the TLV.
+ */
+static uint8_t * tap_tlv_write(uint8_t    * p_buf,
+                               uint16_t     type,
+                               const void * p_value,
+                               uint16_t     length)
+{
+    assert(length <= (TAP_TLV_SIZE - 2 * sizeof(uint16_t)));
+
+    p_buf = le16_write(p_buf, type);
+    p_buf = le16_write(p_buf, length);
+
+    memset(p_buf, 0, TAP_TLV_SIZE - 2 * sizeof(uint16_t));
+    memcpy(p_buf, p_value, length);
+
+    return p_buf + TAP_TLV_SIZE - 2 * sizeof(uint16_t);
+}
+
+/**
+ * @brief Reserve space for a record in the ring buffer.
+ *
+ * @param[in]  length       Length of the record.
+ * @param[out] p_write_idx  Index of the reserved space in the ring buffer.
+ *
+ * @returns  Pointer to the reserved space, or NULL if there is not enough free space.
+ */
+static uint8_t * record_space_get(uint32_t length, uint32_t * p_write_idx)
+{
+    uint32_t read_idx  = m_read_idx;
+    uint32_t write_idx = m_write_idx;
+
+    if (write_idx >= read_idx)
+    {
+        if (write_idx + length <= m_size)
+        {
+            *p_write_idx = write_idx;
+            return &mp_ring[write_idx];
+        }
+
+        // The write index must not reach the read index, which would mean an empty ring.
+        if (length < read_idx)
+        {
+            m_wrap_idx   = write_idx;
+            *p_write_idx = 0;
+            return &mp_ring[0];
+        }
+    }
+    else if (write_idx + length < read_idx)
+    {
+        *p_write_idx = write_idx;
+        return &mp_ring[write_idx];
+    }
+
+    return NULL;
+}
+
+bool nrf_802154_capture_ring_start(uint8_t * p_ring, uint32_t size)
+{
+    if ((p_ring == NULL) || (size <= RECORD_MAX_SIZE))
+    {
+        return false;
+    }
+
+    m_enabled = false;
+    __DMB();
+
+    mp_ring     = p_ring;
+    m_size      = size;
+    m_write_idx = 0;
+    m_read_idx  = 0;
+    m_wrap_idx  = size;
+    m_dropped   = 0;
+
+    __DMB();
+    m_enabled = true;
+
+    return true;
+}
+
+void nrf_802154_capture_ring_stop(void)
+{
+    m_enabled = false;
+}
+
+bool nrf_802154_capture_ring_is_enabled(void)
+{
+    return m_enabled;
+}
+
+void nrf_802154_capture_ring_frame_write(const uint8_t                  * p_data,
+                                         const nrf_802154_rx_metadata_t * p_metadata)
+{
+    uint8_t   psdu_len = (p_data[PHR_OFFSET] > FCS_SIZE) ? (p_data[PHR_OFFSET] - FCS_SIZE) : 0;
+    uint32_t  length   = RECORD_OVERHEAD_SIZE + psdu_len;
+    uint32_t  write_idx;
+    uint8_t * p_record = record_space_get(length, &write_idx);
+
+    if (p_record == NULL)
+    {
+        m_dropped++;
+        return;
+    }
+
+    uint32_t  time      = p_metadata->time;
+    float     rss       = p_metadata->power;
+    uint8_t   fcs_type  = TAP_FCS_TYPE_NONE;
+    uint8_t   channel[] = {p_metadata->channel, 0, 0}; // Channel number (16 bits) and page 0.
+    uint8_t   lqi       = p_metadata->lqi;
+    uint8_t * p_buf     = p_record;
+
+    // PCAP record header.
+    p_buf = le32_write(p_buf, time / 1000000UL);
+    p_buf = le32_write(p_buf, time % 1000000UL);
+    p_buf = le32_write(p_buf, length - PCAP_RECORD_HEADER_SIZE);
+    p_buf = le32_write(p_buf, length - PCAP_RECORD_HEADER_SIZE);
+
+    // TAP header.
+    *p_buf++ = 0; // Version.
+    *p_buf++ = 0; // Reserved.
+    p_buf    = le16_write(p_buf, TAP_HEADER_SIZE + (TAP_TLV_COUNT * TAP_TLV_SIZE));
+    p_buf    = tap_tlv_write(p_buf, TAP_TLV_FCS_TYPE, &fcs_type, sizeof(fcs_type));
+    p_buf    = tap_tlv_write(p_buf, TAP_TLV_RSS, &rss, sizeof(rss));
+    p_buf    = tap_tlv_write(p_buf, TAP_TLV_CHANNEL_ASSIGNMENT, channel, sizeof(channel));
+    p_buf    = tap_tlv_write(p_buf, TAP_TLV_LQI, &lqi, sizeof(lqi));
+
+    memcpy(p_buf, &p_data[PHR_SIZE], psdu_len);
+
+    // Publish the record after its content is written.
+    __DMB();
+    m_write_idx = write_idx + length;
+}
+
+uint32_t nrf_802154_capture_ring_read_get(const uint8_t ** pp_data)
+{
+    uint32_t write_idx = m_write_idx;
+    uint32_t read_idx  = m_read_idx;
+
+    if (write_idx < read_idx)
+    {
+        if (read_idx == m_wrap_idx)
+        {
+            // All records before the wrap are read, continue from the start of the ring.
+            m_read_idx = 0;
+            read_idx   = 0;
+        }
+        else
+        {
+            *pp_data = &mp_ring[read_idx];
+            return m_wrap_idx - read_idx;
+        }
+    }
+
+    *pp_data = &mp_ring[read_idx];
+    return write_idx - read_idx;
+}
+
+void nrf_802154_capture_ring_read_commit(uint32_t length)
+{
+    __DMB();
+    m_read_idx += length;
+}
+
+uint32_t nrf_802154_capture_ring_dropped_get(void)
+{
+    return m_dropped;
+}
+
+void nrf_802154_capture_ring_pcap_header_get(uint8_t * p_header)
+{
+    p_header = le32_write(p_header, PCAP_MAGIC);
+    p_header = le16_write(p_header, PCAP_VERSION_MAJOR);
+    p_header = le16_write(p_header, PCAP_VERSION_MINOR);
+    p_header = le32_write(p_header, 0); // Time zone offset.
+    p_header = le32_write(p_header, 0); // Timestamp accuracy.
+    p_header = le32_write(p_header, PCAP_SNAPLEN);
+    (void)le32_write(p_header, PCAP_LINKTYPE_802154_TAP);
+}
+
+#endif // NRF_802154_CAPTURE_ENABLED
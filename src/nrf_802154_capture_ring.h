@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that captures received frames to a ring buffer in the PCAP record format.
+ *
+ */
+
+#ifndef NRF_802154_CAPTURE_RING_H_
+#define NRF_802154_CAPTURE_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts capturing of received frames to the given ring buffer.
+ *
+ * @param[in]  p_ring  Pointer to the memory to be used as the ring buffer.
+ * @param[in]  size    Size of the memory in bytes.
+ *
+ * @retval  true   Capturing started.
+ * @retval  false  The memory is too small to hold a record of the longest frame.
+ */
+bool nrf_802154_capture_ring_start(uint8_t * p_ring, uint32_t size);
+
+/**
+ * @brief Stops capturing of received frames.
+ *
+ * Records already written to the ring buffer can still be read.
+ */
+void nrf_802154_capture_ring_stop(void);
+
+/**
+ * @brief Checks if received frames are being captured.
+ *
+ * @retval  true   Received frames are captured.
+ * @retval  false  Received frames are passed to the higher layer.
+ */
+bool nrf_802154_capture_ring_is_enabled(void);
+
+/**
+ * @brief Writes a record of the received frame to the ring buffer.
+ *
+ * If there is not enough free space in the ring buffer, the frame is dropped.
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the received frame.
+ */
+void nrf_802154_capture_ring_frame_write(const uint8_t                  * p_data,
+                                         const nrf_802154_rx_metadata_t * p_metadata);
+
+/**
+ * @brief Gets the contiguous block of records waiting in the ring buffer.
+ *
+ * @param[out] pp_data  Pointer to the first byte of the block.
+ *
+ * @returns  Size of the block in bytes, 0 if the ring buffer is empty.
+ */
+uint32_t nrf_802154_capture_ring_read_get(const uint8_t ** pp_data);
+
+/**
+ * @brief Releases the space of records read from the ring buffer.
+ *
+ * @param[in]  length  Number of bytes from the block returned by
+ *                     @ref nrf_802154_capture_ring_read_get that are no longer needed.
+ */
+void nrf_802154_capture_ring_read_commit(uint32_t length);
+
+/**
+ * @brief Gets the number of frames dropped because the ring buffer was full.
+ *
+ * @returns  Number of dropped frames since capturing started.
+ */
+uint32_t nrf_802154_capture_ring_dropped_get(void);
+
+/**
+ * @brief Writes the PCAP global header matching the records of this module.
+ *
+ * @param[out] p_header  Pointer to a buffer of at least @ref NRF_802154_CAPTURE_PCAP_HEADER_SIZE
+ *                       bytes.
+ */
+void nrf_802154_capture_ring_pcap_header_get(uint8_t * p_header);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_CAPTURE_RING_H_ */
@@ -49,6 +49,192 @@ extern "C" {
  * @brief Configuration of the 802.15.4 radio driver for nRF SoCs.
  */
 
+/**
+ * @defgroup nrf_802154_config_profile Feature profile configuration
+ * @{
+ */
+
+#define NRF_802154_PROFILE_NONE               0 ///< No profile. Each option takes its own default.
+#define NRF_802154_PROFILE_THREAD_SED         1 ///< Thread Sleepy End Device.
+#define NRF_802154_PROFILE_THREAD_ROUTER      2 ///< Thread Router or Full Thread Device.
+#define NRF_802154_PROFILE_ZIGBEE_COORDINATOR 3 ///< Zigbee Coordinator or Router.
+#define NRF_802154_PROFILE_SNIFFER            4 ///< Receive-only packet sniffer.
+
+/**
+ * @def NRF_802154_PROFILE
+ *
+ * The feature profile the driver is built for.
+ *
+ * A profile changes the defaults of the options that select the enabled features, the buffer
+ * counts and the fixed radio modes, so that the features not used by the product are removed
+ * from the driver at compile time. Every option can still be overridden individually.
+ *
+ * - @ref NRF_802154_PROFILE_THREAD_SED: few receive buffers, CSMA-CA, ACK timeout and delayed
+ *   operations for CSL, without IFS, statistics, CRC error notifications and promiscuous mode.
+ * - @ref NRF_802154_PROFILE_THREAD_ROUTER: CSMA-CA, ACK timeout, IFS and delayed operations,
+ *   with the auto ACK always enabled and the promiscuous mode always disabled.
+ * - @ref NRF_802154_PROFILE_ZIGBEE_COORDINATOR: like the Thread Router, without delayed
+ *   operations and with larger pending bit address lists.
+ * - @ref NRF_802154_PROFILE_SNIFFER: reception only, with the promiscuous mode always enabled
+ *   and the auto ACK always disabled. CSMA-CA, ACK timeout, IFS and delayed operations are removed.
+ *
+ */
+#ifndef NRF_802154_PROFILE
+#define NRF_802154_PROFILE NRF_802154_PROFILE_NONE
+#endif
+
+#define NRF_802154_MODE_RUNTIME   0 ///< The mode is changed at runtime through the driver API.
+#define NRF_802154_MODE_FIXED_OFF 1 ///< The mode is always disabled.
+#define NRF_802154_MODE_FIXED_ON  2 ///< The mode is always enabled.
+
+#if NRF_802154_PROFILE == NRF_802154_PROFILE_THREAD_SED
+
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 2
+#endif
+#ifndef NRF_802154_CSMA_CA_ENABLED
+#define NRF_802154_CSMA_CA_ENABLED 1
+#endif
+#ifndef NRF_802154_ACK_TIMEOUT_ENABLED
+#define NRF_802154_ACK_TIMEOUT_ENABLED 1
+#endif
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 1
+#endif
+#ifndef NRF_802154_IFS_ENABLED
+#define NRF_802154_IFS_ENABLED 0
+#endif
+#ifndef NRF_802154_NOTIFY_CRCERROR
+#define NRF_802154_NOTIFY_CRCERROR 0
+#endif
+#ifndef NRF_802154_STATS_ENABLED
+#define NRF_802154_STATS_ENABLED 0
+#endif
+#ifndef NRF_802154_PENDING_SHORT_ADDRESSES
+#define NRF_802154_PENDING_SHORT_ADDRESSES 1
+#endif
+#ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES 1
+#endif
+#ifndef NRF_802154_PROMISCUOUS_MODE
+#define NRF_802154_PROMISCUOUS_MODE NRF_802154_MODE_FIXED_OFF
+#endif
+#ifndef NRF_802154_AUTO_ACK_MODE
+#define NRF_802154_AUTO_ACK_MODE NRF_802154_MODE_FIXED_ON
+#endif
+
+#elif NRF_802154_PROFILE == NRF_802154_PROFILE_THREAD_ROUTER
+
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 16
+#endif
+#ifndef NRF_802154_CSMA_CA_ENABLED
+#define NRF_802154_CSMA_CA_ENABLED 1
+#endif
+#ifndef NRF_802154_ACK_TIMEOUT_ENABLED
+#define NRF_802154_ACK_TIMEOUT_ENABLED 1
+#endif
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 1
+#endif
+#ifndef NRF_802154_IFS_ENABLED
+#define NRF_802154_IFS_ENABLED 1
+#endif
+#ifndef NRF_802154_PROMISCUOUS_MODE
+#define NRF_802154_PROMISCUOUS_MODE NRF_802154_MODE_FIXED_OFF
+#endif
+#ifndef NRF_802154_AUTO_ACK_MODE
+#define NRF_802154_AUTO_ACK_MODE NRF_802154_MODE_FIXED_ON
+#endif
+
+#elif NRF_802154_PROFILE == NRF_802154_PROFILE_ZIGBEE_COORDINATOR
+
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 16
+#endif
+#ifndef NRF_802154_CSMA_CA_ENABLED
+#define NRF_802154_CSMA_CA_ENABLED 1
+#endif
+#ifndef NRF_802154_ACK_TIMEOUT_ENABLED
+#define NRF_802154_ACK_TIMEOUT_ENABLED 1
+#endif
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 0
+#endif
+#ifndef NRF_802154_IFS_ENABLED
+#define NRF_802154_IFS_ENABLED 1
+#endif
+#ifndef NRF_802154_PENDING_SHORT_ADDRESSES
+#define NRF_802154_PENDING_SHORT_ADDRESSES 32
+#endif
+#ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES 32
+#endif
+#ifndef NRF_802154_PROMISCUOUS_MODE
+#define NRF_802154_PROMISCUOUS_MODE NRF_802154_MODE_FIXED_OFF
+#endif
+#ifndef NRF_802154_AUTO_ACK_MODE
+#define NRF_802154_AUTO_ACK_MODE NRF_802154_MODE_FIXED_ON
+#endif
+
+#elif NRF_802154_PROFILE == NRF_802154_PROFILE_SNIFFER
+
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 16
+#endif
+#ifndef NRF_802154_CSMA_CA_ENABLED
+#define NRF_802154_CSMA_CA_ENABLED 0
+#endif
+#ifndef NRF_802154_ACK_TIMEOUT_ENABLED
+#define NRF_802154_ACK_TIMEOUT_ENABLED 0
+#endif
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 0
+#endif
+#ifndef NRF_802154_IFS_ENABLED
+#define NRF_802154_IFS_ENABLED 0
+#endif
+#ifndef NRF_802154_PROMISCUOUS_MODE
+#define NRF_802154_PROMISCUOUS_MODE NRF_802154_MODE_FIXED_ON
+#endif
+#ifndef NRF_802154_AUTO_ACK_MODE
+#define NRF_802154_AUTO_ACK_MODE NRF_802154_MODE_FIXED_OFF
+#endif
+
+#elif NRF_802154_PROFILE != NRF_802154_PROFILE_NONE
+#error Unknown NRF_802154_PROFILE.
+#endif
+
+/**
+ * @def NRF_802154_PROMISCUOUS_MODE
+ *
+ * Whether the promiscuous mode is set at runtime or fixed at compile time.
+ *
+ * When the mode is fixed, @ref nrf_802154_promiscuous_set accepts only the fixed value and the
+ * checks of the mode are removed from the frame reception path.
+ *
+ */
+#ifndef NRF_802154_PROMISCUOUS_MODE
+#define NRF_802154_PROMISCUOUS_MODE NRF_802154_MODE_RUNTIME
+#endif
+
+/**
+ * @def NRF_802154_AUTO_ACK_MODE
+ *
+ * Whether the auto ACK is set at runtime or fixed at compile time.
+ *
+ * When the mode is fixed, @ref nrf_802154_auto_ack_set accepts only the fixed value and the
+ * checks of the mode are removed from the frame reception path.
+ *
+ */
+#ifndef NRF_802154_AUTO_ACK_MODE
+#define NRF_802154_AUTO_ACK_MODE NRF_802154_MODE_RUNTIME
+#endif
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup nrf_802154_config_radio Radio driver configuration
  * @{
@@ -94,6 +280,79 @@ extern "C" {
 #define NRF_802154_CCA_CORR_LIMIT_DEFAULT 0x02
 #endif
 
+/**
+ * @def NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+ *
+ * If the channel is assessed on both antennas when the antenna diversity is used.
+ *
+ * When this option is enabled and the antenna diversity mode for transmission is
+ * @ref NRF_802154_SL_ANT_DIV_MODE_MANUAL, the CCA procedure is performed on the other antenna
+ * first and then on the antenna used for the operation. The channel is reported busy if it is
+ * busy on any of the antennas. This applies both to the CCA before transmission and to
+ * @ref nrf_802154_cca. Additionally, the highest energy detected on each antenna during
+ * the last energy detection procedure can be read with
+ * @ref nrf_802154_antenna_diversity_ed_result_get.
+ *
+ * @note The CCA before transmission takes twice as long when this option is enabled.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+#define NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US
+ *
+ * Time in microseconds between antenna switches in the automatic antenna diversity mode for
+ * reception while the best antenna is known from a recently received frame, or 0 to always use
+ * the toggle time of the antenna diversity configuration.
+ *
+ * A shorter toggle time reduces the time needed to assess both antennas, while the toggling
+ * overhead is lower when no antenna is known to be better.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US
+#define NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US 0
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_BEST_ANTENNA_VALID_US
+ *
+ * Time in microseconds after the reception of a frame for which the best antenna selected for it
+ * is considered known. See @ref NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_BEST_ANTENNA_VALID_US
+#define NRF_802154_ANT_DIV_BEST_ANTENNA_VALID_US 1000000UL
+#endif
+
+/**
+ * @def NRF_802154_ED_RESULT_EXT_ENABLED
+ *
+ * If the extended result of the energy detection procedure is to be collected. Besides
+ * the highest energy, the extended result holds the mean energy and the number of samples above
+ * the CCA energy threshold. It can be read with @ref nrf_802154_energy_detection_result_get.
+ *
+ * @note When this option is enabled, the energy is sampled in single 128 us iterations, each of
+ *       which is handled by the radio interrupt.
+ *
+ */
+#ifndef NRF_802154_ED_RESULT_EXT_ENABLED
+#define NRF_802154_ED_RESULT_EXT_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ED_RESULT_EXT_SAMPLES
+ *
+ * The number of the first energy samples stored in the extended result of the energy detection
+ * procedure. Set to 0 not to store the samples. It requires
+ * @ref NRF_802154_ED_RESULT_EXT_ENABLED.
+ *
+ */
+#ifndef NRF_802154_ED_RESULT_EXT_SAMPLES
+#define NRF_802154_ED_RESULT_EXT_SAMPLES 0
+#endif
+
 /**
  * @def NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
  *
@@ -155,6 +414,21 @@ extern "C" {
 #define NRF_802154_SWI_PRIORITY 4
 #endif
 
+/**
+ * @def NRF_802154_RADIO_FAST_ENABLE_ENABLED
+ *
+ * If the RADIO is re-enabled from a cached register image at the start of each timeslot.
+ *
+ * When enabled, the RADIO configuration that does not depend on the PIB is computed only once
+ * and written back in bulk when the next timeslot starts. The RADIO is not power-cycled at
+ * the start of a timeslot if it is still in the reset state left by the end of the previous one,
+ * which means that no other protocol has used it in the meantime.
+ *
+ */
+#ifndef NRF_802154_RADIO_FAST_ENABLE_ENABLED
+#define NRF_802154_RADIO_FAST_ENABLE_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_USE_RAW_API
  *
@@ -174,6 +448,8 @@ extern "C" {
  *
  * The number of slots containing short addresses of nodes for which the pending data is stored.
  *
+ * A node for which both the pending bit and ACK IE data are set occupies a single slot.
+ *
  */
 #ifndef NRF_802154_PENDING_SHORT_ADDRESSES
 #define NRF_802154_PENDING_SHORT_ADDRESSES 10
@@ -184,299 +460,2396 @@ extern "C" {
  *
  * The number of slots containing extended addresses of nodes for which the pending data is stored.
  *
+ * A node for which both the pending bit and ACK IE data are set occupies a single slot.
+ *
  */
 #ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
 #define NRF_802154_PENDING_EXTENDED_ADDRESSES 10
 #endif
 
 /**
- * @def NRF_802154_RX_BUFFERS
+ * @def NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
  *
- * The number of buffers in the receive queue.
+ * If the addresses for which the pending bit or ACK IE data is set are to be kept in hash tables
+ * instead of sorted arrays.
+ *
+ * Hash tables make adding, removing and looking up an address take constant time on average,
+ * which pays off with large @ref NRF_802154_PENDING_SHORT_ADDRESSES and
+ * @ref NRF_802154_PENDING_EXTENDED_ADDRESSES values. Each table has twice as many slots
+ * as the number of addresses it can hold, so this option doubles the RAM used to store them.
  *
  */
-#ifndef NRF_802154_RX_BUFFERS
-#define NRF_802154_RX_BUFFERS 16
+#ifndef NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+#define NRF_802154_ACK_DATA_HASH_TABLE_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_DISABLE_BCC_MATCHING
+ * @def NRF_802154_CAPTURE_ENABLED
  *
- * Setting this flag disables NRF_RADIO_EVENT_BCMATCH handling, and therefore the address filtering
- * during the frame reception. With this flag set to 1, the address filtering is done after
- * receiving a frame, during NRF_RADIO_EVENT_END handling.
+ * If the capture mode is to be built in.
  *
- * @note This option is incompatible with antenna diversity. If set to 1, antenna diversity
- * must not be used.
+ * In the capture mode, received frames are written with their metadata to a ring buffer
+ * in the PCAP record format instead of being passed to the higher layer one by one.
  *
  */
-#ifndef NRF_802154_DISABLE_BCC_MATCHING
-#define NRF_802154_DISABLE_BCC_MATCHING 0
+#ifndef NRF_802154_CAPTURE_ENABLED
+#define NRF_802154_CAPTURE_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_NOTIFY_CRCERROR
+ * @def NRF_802154_IPC_RING_ENABLED
  *
- * With this flag set to 1, the CRC errors are notified to upper layers. This requires an interrupt
- * handler to be used.
+ * If the shared memory transport of frames between cores is to be built in.
+ *
+ * The transport passes received frames, transmit requests and their results between the core
+ * that runs the driver and the core that runs the higher layer as small descriptors in a pair of
+ * rings in shared memory. Frames are passed by pointer and are not copied, so the frame buffers
+ * must be placed in memory accessible by both cores with @ref NRF_802154_BUFFERS_SECTION.
  *
  */
-#ifndef NRF_802154_NOTIFY_CRCERROR
-#define NRF_802154_NOTIFY_CRCERROR 1
+#ifndef NRF_802154_IPC_RING_ENABLED
+#define NRF_802154_IPC_RING_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_FRAME_TIMESTAMP_ENABLED
+ * @def NRF_802154_IPC_RING_SIZE
  *
- * If timestamps are to be added to the frames received.
- * Enabling this feature enables the functions @ref nrf_802154_received_timestamp_raw,
- * @ref nrf_802154_received_timestamp, @ref nrf_802154_transmitted_timestamp_raw, and
- * @ref nrf_802154_transmitted_timestamp, which add timestamps to the frames received.
- * This option also enables timestamping in stats.
+ * The number of descriptors in each ring of the shared memory transport. It must be a power of two.
+ *
+ * The ring from the driver holds a descriptor for every received frame until it is read by
+ * the higher layer, so it is best to make it larger than @ref NRF_802154_RX_BUFFERS.
  *
  */
-#ifndef NRF_802154_FRAME_TIMESTAMP_ENABLED
-#define NRF_802154_FRAME_TIMESTAMP_ENABLED 1
+#ifndef NRF_802154_IPC_RING_SIZE
+#define NRF_802154_IPC_RING_SIZE 32
 #endif
 
 /**
- * @def NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+ * @def NRF_802154_RSSI_STREAM_ENABLED
  *
- * If measurement of total time spent in certain states is to be calculated.
+ * If the RSSI streaming is to be built in.
+ *
+ * While the RSSI streaming is started, the driver measures the RSSI at a given interval in
+ * the receive state, when no frame is being received, and writes the timestamped samples to
+ * a ring buffer, which the higher layer reads in batches.
  *
- * This option can be enabled when @ref NRF_802154_FRAME_TIMESTAMP_ENABLED is 1
- * and @ref NRF_802154_DISABLE_BCC_MATCHING is 0.
  */
-#ifndef NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-#define NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED \
-    (1 && NRF_802154_FRAME_TIMESTAMP_ENABLED && !NRF_802154_DISABLE_BCC_MATCHING)
+#ifndef NRF_802154_RSSI_STREAM_ENABLED
+#define NRF_802154_RSSI_STREAM_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_DELAYED_TRX_ENABLED
+ * @def NRF_802154_HEADER_MONITOR_ENABLED
  *
- * If the delayed transmission and the receive window features are available.
+ * If the header monitor is to be built in.
+ *
+ * While the header monitor is started, the fields of the MAC header of each received frame are
+ * written with its RSSI, LQI, channel and timestamp to a ring buffer of compact records. The
+ * receive buffer is reused for the next frame immediately, unless the full frames are retained
+ * on demand of the higher layer.
  *
  */
-#ifndef NRF_802154_DELAYED_TRX_ENABLED
-#define NRF_802154_DELAYED_TRX_ENABLED 1
+#ifndef NRF_802154_HEADER_MONITOR_ENABLED
+#define NRF_802154_HEADER_MONITOR_ENABLED 0
 #endif
 
 /**
- * @}
- * @defgroup nrf_802154_config_csma CSMA/CA procedure configuration
- * @{
+ * @def NRF_802154_TX_DSN_ASSIGN_ENABLED
+ *
+ * If the driver assigns the sequence numbers of the transmitted frames.
+ *
+ * If enabled, the driver writes the next value of its sequence number counter to each frame when
+ * the transmission of the frame starts, unless the frame has the Sequence Number Suppression bit
+ * set. A frame retransmitted by the driver keeps its sequence number. The assigned value can be
+ * read from the frame passed to @ref nrf_802154_transmitted_raw or
+ * @ref nrf_802154_transmit_failed. The frame counter of a secured frame, which is always assigned
+ * by the driver, is also written back to the frame, see @ref NRF_802154_ENCRYPTION_ENABLED.
+ *
  */
+#ifndef NRF_802154_TX_DSN_ASSIGN_ENABLED
+#define NRF_802154_TX_DSN_ASSIGN_ENABLED 0
+#endif
 
 /**
- * @def NRF_802154_CSMA_CA_ENABLED
+ * @def NRF_802154_PASSIVE_ED_ENABLED
  *
- * If CSMA-CA is to be enabled by the driver. Disabling CSMA-CA improves
- * the driver performance.
+ * If the energy detection without leaving the receive state is to be built in.
+ *
+ * The passive energy detection samples the RSSI at @ref NRF_802154_PASSIVE_ED_SAMPLE_PERIOD_US
+ * intervals when no frame is being received, so frames arriving during the procedure are received
+ * normally.
  *
  */
-#ifndef NRF_802154_CSMA_CA_ENABLED
-#define NRF_802154_CSMA_CA_ENABLED 1
+#ifndef NRF_802154_PASSIVE_ED_ENABLED
+#define NRF_802154_PASSIVE_ED_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_CSMA_CA_MIN_BE_DEFAULT
+ * @def NRF_802154_PASSIVE_ED_SAMPLE_PERIOD_US
  *
- * The default minimum value of the backoff exponent (BE) in the CSMA-CA algorithm
- * (see IEEE 802.15.4-2015: 6.2.5.1).
- *
- * @note The minimum value of the backoff exponent may be changed from default by calling the
- *       @ref nrf_802154_pib_csmaca_min_be_set function.
+ * Interval between the RSSI samples of the passive energy detection, in microseconds.
  *
  */
-#ifdef NRF_802154_CSMA_CA_MIN_BE
-#error "NRF_802154_CSMA_CA_MIN_BE was replaced with NRF_802154_CSMA_CA_MIN_BE_DEFAULT"
-#endif
-#ifndef NRF_802154_CSMA_CA_MIN_BE_DEFAULT
-#define NRF_802154_CSMA_CA_MIN_BE_DEFAULT 3
+#ifndef NRF_802154_PASSIVE_ED_SAMPLE_PERIOD_US
+#define NRF_802154_PASSIVE_ED_SAMPLE_PERIOD_US 128
 #endif
 
 /**
- * @def NRF_802154_CSMA_CA_MAX_BE_DEFAULT
- *
- * The default maximum value of the backoff exponent, BE, in the CSMA-CA algorithm
- * (see IEEE 802.15.4-2015: 6.2.5.1).
+ * @def NRF_802154_PIB_TRANSACTION_ENABLED
  *
- * @note The maximum value of the backoff exponent may be changed from default by calling the
- *       @ref nrf_802154_pib_csmaca_max_be_set function.
+ * If the PIB transaction API is to be built in. Channel and CCA configuration changes made within
+ * a transaction are applied together when the transaction is committed, restarting the receiver
+ * at most once.
  *
  */
-#ifdef NRF_802154_CSMA_CA_MAX_BE
-#error "NRF_802154_CSMA_CA_MAX_BE was replaced with NRF_802154_CSMA_CA_MAX_BE_DEFAULT"
-#endif
-#ifndef NRF_802154_CSMA_CA_MAX_BE_DEFAULT
-#define NRF_802154_CSMA_CA_MAX_BE_DEFAULT 5
+#ifndef NRF_802154_PIB_TRANSACTION_ENABLED
+#define NRF_802154_PIB_TRANSACTION_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT
- *
- * The default maximum number of backoffs that the CSMA-CA algorithm will attempt before declaring
- * a channel access failure.
+ * @def NRF_802154_WARM_START_ENABLED
  *
- * @note The maximum number of backoffs may be changed from default by calling the
- *       @ref nrf_802154_pib_csmaca_max_backoffs_set function.
+ * If the driver is to be built with the warm start API, which stores the PIB and the ACK data
+ * in a snapshot that can be kept in retained RAM or flash and restored during the initialization.
  *
  */
-#ifdef NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT
-#error \
-    "NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS was replaced with NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT"
-#endif
-#ifndef NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT
-#define NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT 4
+#ifndef NRF_802154_WARM_START_ENABLED
+#define NRF_802154_WARM_START_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT
+ * @def NRF_802154_DEFERRED_INIT_ENABLED
  *
- * Indicates whether the CSMA-CA algorithm waits for an available timeslot before it performs
- * the CCA procedure.
+ * If @ref nrf_802154_init is to return without waiting for the LFCLK. The readiness of the driver
+ * is reported with @ref nrf_802154_ready.
  *
- * @note When this option is enabled, the CSMA-CA procedure can be synchronized with timeslots of
- *       other protocols. This decreases the robustness of the CSMA-CA procedure. On the other hand,
- *       enabling this function increases the performance of multi-protocol applications, especially
- *       when protocols other than 802.15.4 use much of the radio time (like the BLE scanning
- *       operation).
+ * @note This option requires NRF_802154_SL_LP_TIMER_DEFERRED_INIT_ENABLED to be set in the
+ *       service layer.
  *
  */
-#ifndef NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT
-#define NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT 1
+#ifndef NRF_802154_DEFERRED_INIT_ENABLED
+#define NRF_802154_DEFERRED_INIT_ENABLED 0
 #endif
 
 /**
- * @}
+ * @def NRF_802154_PER_TEST_ENABLED
+ *
+ * If the packet error rate (PER) test mode is to be built in.
+ *
+ * In the PER test mode, the modulated carrier transmits a counted burst of frames started at
+ * a fixed interval by the TIMER, and the receiver counts the received frames with correct and
+ * incorrect CRC without notifying the higher layer or using the receive buffers.
+ *
+ */
+#ifndef NRF_802154_PER_TEST_ENABLED
+#define NRF_802154_PER_TEST_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_SRC_ADDR_FILTER_ENABLED
+ *
+ * If the filter of received frames by their source address is to be built in.
+ *
+ * The filter is checked when the addressing fields of a frame are received. A rejected frame is
+ * dropped at once, so it does not occupy a receive buffer and it is not notified to the higher
+ * layer in any way.
+ *
+ */
+#ifndef NRF_802154_SRC_ADDR_FILTER_ENABLED
+#define NRF_802154_SRC_ADDR_FILTER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_SRC_ADDR_FILTER_SHORT_ADDRESSES
+ *
+ * The number of short addresses the source address filter can hold.
+ *
+ */
+#ifndef NRF_802154_SRC_ADDR_FILTER_SHORT_ADDRESSES
+#define NRF_802154_SRC_ADDR_FILTER_SHORT_ADDRESSES 16
+#endif
+
+/**
+ * @def NRF_802154_SRC_ADDR_FILTER_EXTENDED_ADDRESSES
+ *
+ * The number of extended addresses the source address filter can hold.
+ *
+ */
+#ifndef NRF_802154_SRC_ADDR_FILTER_EXTENDED_ADDRESSES
+#define NRF_802154_SRC_ADDR_FILTER_EXTENDED_ADDRESSES 16
+#endif
+
+/**
+ * @def NRF_802154_PAN_CONTEXTS
+ *
+ * The number of PAN contexts the driver receives frames for.
+ *
+ * Context 0 is configured with the PAN ID, the addresses and the auto ACK and the source address
+ * matching settings of the device. The remaining contexts are configured with
+ * @ref nrf_802154_pan_context_set. A received frame is accepted if it is addressed to any of
+ * the contexts, and the context it matched is reported in @ref nrf_802154_rx_metadata_t.
+ *
+ */
+#ifndef NRF_802154_PAN_CONTEXTS
+#define NRF_802154_PAN_CONTEXTS 1
+#endif
+
+/**
+ * @def NRF_802154_RX_BUFFERS
+ *
+ * The number of buffers in the receive queue.
+ *
+ */
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 16
+#endif
+
+/**
+ * @def NRF_802154_RX_SMALL_BUFFERS
+ *
+ * The number of small buffers in the receive queue.
+ *
+ * A received frame that fits in @ref NRF_802154_RX_SMALL_BUFFER_SIZE bytes is moved to a small
+ * buffer before it is passed to the higher layer. The full-size buffer the frame was received to
+ * is then immediately available for the next reception. Short frames, like MAC commands
+ * and ACKs, can be held in flight using much less RAM than with @ref NRF_802154_RX_BUFFERS alone.
+ *
+ * Setting this option to 0 disables the small buffers.
+ *
+ */
+#ifndef NRF_802154_RX_SMALL_BUFFERS
+#define NRF_802154_RX_SMALL_BUFFERS 0
+#endif
+
+/**
+ * @def NRF_802154_RX_SMALL_BUFFER_SIZE
+ *
+ * The size of a single small receive buffer in bytes, including the PHR.
+ *
+ */
+#ifndef NRF_802154_RX_SMALL_BUFFER_SIZE
+#define NRF_802154_RX_SMALL_BUFFER_SIZE 40
+#endif
+
+/**
+ * @def NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED
+ *
+ * If the buffers freed with @ref nrf_802154_buffer_free_immediately are returned to the pool
+ * without a request to the driver core.
+ *
+ * A request is then issued only when the receiver waits for a free buffer and must be restarted
+ * with it.
+ *
+ */
+#ifndef NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED
+#define NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_BUFFERS
+ *
+ * The number of transmit buffers owned by the driver.
+ *
+ * The buffers can be allocated with @ref nrf_802154_tx_buffer_alloc, filled with a frame and
+ * transmitted with @ref nrf_802154_tx_buffer_submit. The driver returns a submitted buffer
+ * to the pool by itself when the transmission ends. Setting this option to 0 disables the pool.
+ *
+ */
+#ifndef NRF_802154_TX_BUFFERS
+#define NRF_802154_TX_BUFFERS 0
+#endif
+
+/**
+ * @def NRF_802154_BUFFERS_SECTION
+ *
+ * The name of the linker section in which the receive buffers, the small receive buffers and
+ * the transmit buffers are placed, for example @c ".radio_buffers".
+ *
+ * Use it to keep the frame buffers in a RAM block that stays powered while the other blocks are
+ * turned off in System ON idle, or in a memory region shared with another core, so that frames can
+ * be passed to it without copying. The driver never reads a buffer before a frame is written to it,
+ * so the section does not need to be cleared by the startup code and can be a @c NOLOAD one.
+ *
+ * If this option is not defined, the buffers are placed by the compiler like other variables.
+ *
+ */
+
+/**
+ * @def NRF_802154_BUFFERS_ALIGNMENT
+ *
+ * The alignment in bytes of the receive buffers, the small receive buffers and the transmit
+ * buffers. It must be a power of two.
+ *
+ */
+#ifndef NRF_802154_BUFFERS_ALIGNMENT
+#define NRF_802154_BUFFERS_ALIGNMENT 4
+#endif
+
+#if (NRF_802154_BUFFERS_ALIGNMENT < 1) || \
+    ((NRF_802154_BUFFERS_ALIGNMENT & (NRF_802154_BUFFERS_ALIGNMENT - 1)) != 0)
+#error NRF_802154_BUFFERS_ALIGNMENT must be a power of two.
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_SIZE
+ *
+ * The number of frames that can wait for transmission in the transmit queue.
+ *
+ * Frames added with @ref nrf_802154_transmit_raw_enqueue while a transmission is in progress are
+ * transmitted back-to-back, without returning to the higher layer between frames. Setting this
+ * option to 0 disables the transmit queue.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_SIZE
+#define NRF_802154_TX_QUEUE_SIZE 0
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED
+ *
+ * If the frames waiting in the transmit queue can be reordered to fit the remaining timeslot.
+ *
+ * When the time left in the timeslot granted by the radio scheduler is too short for the first
+ * queued frame, the largest queued frame that fits is transmitted first instead of waiting for
+ * the next timeslot. A frame is never moved before a frame queued earlier for the same
+ * destination, so the order of frames sent to each peer is kept. This option has effect only if
+ * @ref NRF_802154_TX_QUEUE_SIZE is greater than 0.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED
+#define NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+ *
+ * If the frames waiting in the transmit queue are ordered by priority classes and deadlines.
+ *
+ * Frames added with @ref nrf_802154_transmit_raw_enqueue_ex are transmitted before the waiting
+ * frames of lower priority classes, and in the order of their deadlines within a class. A frame
+ * that would end its transmission after its deadline is dropped and reported with
+ * @ref NRF_802154_TX_ERROR_DEADLINE_MISSED. This option has effect only if
+ * @ref NRF_802154_TX_QUEUE_SIZE is greater than 0.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_PRIORITY_ENABLED
+#define NRF_802154_TX_QUEUE_PRIORITY_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_DEFAULT_PRIORITY
+ *
+ * Priority class of the frames added to the transmit queue without parameters.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_DEFAULT_PRIORITY
+#define NRF_802154_TX_QUEUE_DEFAULT_PRIORITY 1
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+ *
+ * If the transmit queue is to share the airtime fairly between the destinations. A frame to
+ * a destination whose ACK success is below @ref NRF_802154_TX_QUEUE_FAIRNESS_ACK_SUCCESS_MIN
+ * lets frames of the same priority to other destinations be transmitted first, up to
+ * @ref NRF_802154_TX_QUEUE_FAIRNESS_MAX_DEFERRALS times. A failed transmission drops only
+ * the queued frames to the same destination instead of the whole queue.
+ *
+ * @note This option requires @ref NRF_802154_PEER_TABLE_ENABLED, which provides the ACK success
+ *       of the destinations.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+#define NRF_802154_TX_QUEUE_FAIRNESS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_FAIRNESS_ACK_SUCCESS_MIN
+ *
+ * Average percentage of acknowledged transmissions below which the frames to a destination give
+ * way to frames to other destinations.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_FAIRNESS_ACK_SUCCESS_MIN
+#define NRF_802154_TX_QUEUE_FAIRNESS_ACK_SUCCESS_MIN 50
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_FAIRNESS_MAX_DEFERRALS
+ *
+ * Maximum number of frames to other destinations that can be transmitted before a frame to
+ * a destination with a poor link.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_FAIRNESS_MAX_DEFERRALS
+#define NRF_802154_TX_QUEUE_FAIRNESS_MAX_DEFERRALS 3
+#endif
+
+/**
+ * @def NRF_802154_INDIRECT_QUEUE_SIZE
+ *
+ * The number of frames that can wait for indirect transmission.
+ *
+ * Frames added with @ref nrf_802154_transmit_raw_indirect are held by the driver until their
+ * destination polls with a Data Request. The driver acknowledges the Data Request with the Frame
+ * Pending bit set and transmits the frame right after the ACK, without waiting for the higher
+ * layer. Setting this option to 0 disables the indirect transmission queue.
+ *
+ */
+#ifndef NRF_802154_INDIRECT_QUEUE_SIZE
+#define NRF_802154_INDIRECT_QUEUE_SIZE 0
+#endif
+
+/**
+ * @def NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+ *
+ * Indicates whether acknowledged Data Requests are handled by the driver instead of being passed
+ * to the higher layer as received frames.
+ *
+ * If a frame is waiting for the polling node in the indirect transmission queue, the driver
+ * transmits it and does not notify the Data Request at all. Otherwise, the Data Request is
+ * reported with @ref nrf_802154_data_request_received, which carries only the address of the
+ * polling node and the metadata of the frame. The receive buffer is reused at once.
+ *
+ */
+#ifndef NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+#define NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DISABLE_BCC_MATCHING
+ *
+ * Setting this flag disables NRF_RADIO_EVENT_BCMATCH handling, and therefore the address filtering
+ * during the frame reception. With this flag set to 1, the address filtering is done after
+ * receiving a frame, during NRF_RADIO_EVENT_END handling.
+ *
+ * @note This option is incompatible with antenna diversity. If set to 1, antenna diversity
+ * must not be used.
+ *
+ */
+#ifndef NRF_802154_DISABLE_BCC_MATCHING
+#define NRF_802154_DISABLE_BCC_MATCHING 0
+#endif
+
+/**
+ * @def NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+ *
+ * If the first NRF_RADIO_EVENT_BCMATCH during the frame reception is to be postponed until the
+ * destination PAN ID and the short destination address of the most common frame layout are
+ * received. In that case, the Frame Control field and the destination address are verified in
+ * a single interrupt, so that most frames not destined to this node are rejected with one
+ * interrupt instead of two. Frames with longer addressing fields still need more interrupts.
+ *
+ * Frames that end before the first NRF_RADIO_EVENT_BCMATCH are filtered during
+ * NRF_RADIO_EVENT_END handling.
+ *
+ * @note This option can be enabled only when @ref NRF_802154_DISABLE_BCC_MATCHING is 0.
+ *
+ */
+#ifndef NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+#define NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED 0
+#endif
+
+#if NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED && NRF_802154_DISABLE_BCC_MATCHING
+#error NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED requires BCC matching to be enabled.
+#endif
+
+/**
+ * @def NRF_802154_NOTIFY_CRCERROR
+ *
+ * With this flag set to 1, the CRC errors are notified to upper layers. This requires an interrupt
+ * handler to be used.
+ *
+ */
+#ifndef NRF_802154_NOTIFY_CRCERROR
+#define NRF_802154_NOTIFY_CRCERROR 1
+#endif
+
+/**
+ * @def NRF_802154_FRAME_TIMESTAMP_ENABLED
+ *
+ * If timestamps are to be added to the frames received.
+ * Enabling this feature enables the functions @ref nrf_802154_received_timestamp_raw,
+ * @ref nrf_802154_received_timestamp, @ref nrf_802154_transmitted_timestamp_raw, and
+ * @ref nrf_802154_transmitted_timestamp, which add timestamps to the frames received.
+ * This option also enables timestamping in stats.
+ *
+ */
+#ifndef NRF_802154_FRAME_TIMESTAMP_ENABLED
+#define NRF_802154_FRAME_TIMESTAMP_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+ *
+ * If the end of every received frame and ACK is to be captured by the high precision timer through
+ * a (D)PPI channel that stays connected while the radio is in use.
+ *
+ * When enabled, the timer coordinator is no longer prepared for each reception, which removes
+ * the per-frame timestamp setup from the radio IRQ. Timestamps of transmitted frames are still
+ * captured by the timer coordinator.
+ *
+ * This option can be enabled only when @ref NRF_802154_FRAME_TIMESTAMP_ENABLED is 1.
+ *
+ */
+#ifndef NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+#define NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED 0
+#endif
+
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED && !NRF_802154_FRAME_TIMESTAMP_ENABLED
+#error NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED requires NRF_802154_FRAME_TIMESTAMP_ENABLED.
+#endif
+
+/**
+ * @def NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+ *
+ * If measurement of total time spent in certain states is to be calculated.
+ *
+ * This option can be enabled when @ref NRF_802154_FRAME_TIMESTAMP_ENABLED is 1
+ * and @ref NRF_802154_DISABLE_BCC_MATCHING is 0.
+ */
+#ifndef NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+#define NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED \
+    (1 && NRF_802154_FRAME_TIMESTAMP_ENABLED && !NRF_802154_DISABLE_BCC_MATCHING)
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_ENABLED
+ *
+ * If the delayed transmission and the receive window features are available.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SCHEDULE_SIZE
+ *
+ * The number of delayed transmissions and receive windows that can be scheduled at the same time.
+ *
+ * Scheduled operations are kept ordered by their start time and only the earliest one is requested
+ * from the Radio Scheduler.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SCHEDULE_SIZE
+#define NRF_802154_DELAYED_TRX_SCHEDULE_SIZE 4
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+ *
+ * If the time needed to prepare delayed transmissions and receptions is measured at runtime.
+ *
+ * When disabled, the delayed timeslots are requested early enough for the worst-case setup time.
+ * When enabled, the running maximum of the measured setup times increased by
+ * @ref NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_MARGIN is used instead, once
+ * @ref NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_SAMPLES measurements are collected. The calibrated
+ * time never exceeds the worst-case one.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED
+#define NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_SAMPLES
+ *
+ * The number of setup time measurements collected before the calibrated setup time is used.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_SAMPLES
+#define NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_SAMPLES 8
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_MARGIN
+ *
+ * The safety margin in microseconds added to the longest measured setup time. It must cover
+ * the granularity of the timer used for the measurements.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_MARGIN
+#define NRF_802154_DELAYED_TRX_SETUP_CALIBRATION_MARGIN 40
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US
+ *
+ * The time in microseconds by which the delayed timeslots are requested earlier while WiFi coex
+ * is enabled. RSCH raises the coex request when the timeslot starts, so the PTA is notified
+ * about the delayed transmissions and receptions this long before they start. The operation
+ * itself is started at the requested time. If the operation is scheduled too late to respect
+ * the lead time, its timeslot is requested without it.
+ *
+ * Set to 0 to request the coex only when the operation starts.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US
+#define NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US 0
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+ *
+ * If the delayed operations request the HFCLK ahead of their timeslots. The HFCLK is requested
+ * one HFCLK start-up time before the timeslot of the next delayed operation and is released when
+ * the timeslot starts or the operation is cancelled. The start-up time is measured each time
+ * the HFCLK is started this way, and the longest measurement is used.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED
+#define NRF_802154_DELAYED_TRX_HFCLK_PRESTART_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_HFCLK_STARTUP_TIME
+ *
+ * The HFCLK start-up time in microseconds assumed before the first measurement is available.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_HFCLK_STARTUP_TIME
+#define NRF_802154_DELAYED_TRX_HFCLK_STARTUP_TIME 1000
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_HFCLK_STARTUP_MARGIN
+ *
+ * The time in microseconds added to the measured HFCLK start-up time to cover the granularity
+ * of the timer that starts the HFCLK.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_HFCLK_STARTUP_MARGIN
+#define NRF_802154_DELAYED_TRX_HFCLK_STARTUP_MARGIN 31
+#endif
+
+/**
+ * @def NRF_802154_LIGHT_SLEEP_THRESHOLD_US
+ *
+ * The time in microseconds to the next delayed operation below which the sleep state keeps
+ * the radio ready. If the next delayed transmission or reception starts sooner than this time
+ * after the sleep is requested, the driver sleeps with the HF clock requested and the radio
+ * configured, so waking up for the operation does not wait for the HF clock start-up. The light
+ * sleep ends when the threshold elapses, if the driver is still sleeping.
+ *
+ * Set to 0 to release the HF clock in each sleep. It requires
+ * @ref NRF_802154_DELAYED_TRX_ENABLED.
+ *
+ */
+#ifndef NRF_802154_LIGHT_SLEEP_THRESHOLD_US
+#define NRF_802154_LIGHT_SLEEP_THRESHOLD_US 0
+#endif
+
+/**
+ * @def NRF_802154_HFCLK_STOP_HYSTERESIS_US
+ *
+ * The time in microseconds for which the HF clock is kept running after RSCH releases it. If
+ * the HF clock is requested again within this time, its start-up is avoided.
+ *
+ * Set to 0 to stop the HF clock as soon as it is released.
+ *
+ */
+#ifndef NRF_802154_HFCLK_STOP_HYSTERESIS_US
+#define NRF_802154_HFCLK_STOP_HYSTERESIS_US 0
+#endif
+
+/**
+ * @def NRF_802154_HFCLK_STOP_PREDICTION_MAX_US
+ *
+ * The longest time in microseconds for which the HF clock stop is deferred when the next HF clock
+ * request is predicted. The next request is predicted from the earliest scheduled delayed
+ * operation and from the average time after which the HF clock was requested again recently.
+ * If the predicted request comes sooner than this time, the HF clock is kept running until then.
+ *
+ * Set to 0 to use only @ref NRF_802154_HFCLK_STOP_HYSTERESIS_US.
+ *
+ */
+#ifndef NRF_802154_HFCLK_STOP_PREDICTION_MAX_US
+#define NRF_802154_HFCLK_STOP_PREDICTION_MAX_US 0
+#endif
+
+/**
+ * @def NRF_802154_LOW_POWER_LISTENING_ENABLED
+ *
+ * If the low-power listening receive mode is to be enabled in the driver. In this mode
+ * the driver samples the channel energy periodically and sleeps between the samples. The receiver
+ * is kept on only after energy is detected.
+ *
+ */
+#ifndef NRF_802154_LOW_POWER_LISTENING_ENABLED
+#define NRF_802154_LOW_POWER_LISTENING_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TSCH_ENABLED
+ *
+ * If the TSCH slotframe engine is available. The engine schedules the cells of a slotframe
+ * on its own using the delayed transmission and reception features and notifies the next higher
+ * layer only about completed cells. It requires @ref NRF_802154_DELAYED_TRX_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_ENABLED
+#define NRF_802154_TSCH_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TSCH_MAX_CELLS
+ *
+ * The maximum number of cells in the slotframe handled by the TSCH slotframe engine.
+ *
+ */
+#ifndef NRF_802154_TSCH_MAX_CELLS
+#define NRF_802154_TSCH_MAX_CELLS 16
+#endif
+
+/**
+ * @def NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE
+ *
+ * The maximum length of the channel hopping sequence used by the TSCH slotframe engine.
+ *
+ */
+#ifndef NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE
+#define NRF_802154_TSCH_HOPPING_SEQUENCE_MAX_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_TSCH_SCHEDULE_LEAD_TIME
+ *
+ * The time in microseconds before the start of a timeslot at which the TSCH slotframe engine
+ * schedules the operation of the cell. It must be long enough for the delayed operation to be
+ * requested before the radio must be prepared for it.
+ *
+ */
+#ifndef NRF_802154_TSCH_SCHEDULE_LEAD_TIME
+#define NRF_802154_TSCH_SCHEDULE_LEAD_TIME 1000
+#endif
+
+/**
+ * @def NRF_802154_RX_HOPPING_ENABLED
+ *
+ * If the receive hopping schedule is available. The driver switches the receiver between
+ * the channels of a list on its own, staying on each channel for its dwell time. A frame being
+ * received when the dwell time ends is completed on its channel before the switch.
+ *
+ */
+#ifndef NRF_802154_RX_HOPPING_ENABLED
+#define NRF_802154_RX_HOPPING_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RX_HOPPING_MAX_CHANNELS
+ *
+ * The maximum number of channels in the receive hopping schedule.
+ *
+ */
+#ifndef NRF_802154_RX_HOPPING_MAX_CHANNELS
+#define NRF_802154_RX_HOPPING_MAX_CHANNELS 4
+#endif
+
+/**
+ * @def NRF_802154_RX_HOPPING_RETRY_DELAY
+ *
+ * The time in microseconds after which a channel switch of the receive hopping schedule is
+ * retried if a frame is being received or transmitted when the dwell time ends.
+ *
+ */
+#ifndef NRF_802154_RX_HOPPING_RETRY_DELAY
+#define NRF_802154_RX_HOPPING_RETRY_DELAY 500
+#endif
+
+/**
+ * @def NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED
+ *
+ * Indicates whether the durations of transmissions and receptions are read from tables instead
+ * of being computed.
+ *
+ * The tables hold the durations for all PSDU lengths, with and without CCA and ACK. They are
+ * generated at compile time and take 1.5 kB of flash. The durations are queried to request
+ * timeslots for every radio operation.
+ *
+ */
+#ifndef NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED
+#define NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_csma CSMA/CA procedure configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CSMA_CA_ENABLED
+ *
+ * If CSMA-CA is to be enabled by the driver. Disabling CSMA-CA improves
+ * the driver performance.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_ENABLED
+#define NRF_802154_CSMA_CA_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_MIN_BE_DEFAULT
+ *
+ * The default minimum value of the backoff exponent (BE) in the CSMA-CA algorithm
+ * (see IEEE 802.15.4-2015: 6.2.5.1).
+ *
+ * @note The minimum value of the backoff exponent may be changed from default by calling the
+ *       @ref nrf_802154_pib_csmaca_min_be_set function.
+ *
+ */
+#ifdef NRF_802154_CSMA_CA_MIN_BE
+#error "NRF_802154_CSMA_CA_MIN_BE was replaced with NRF_802154_CSMA_CA_MIN_BE_DEFAULT"
+#endif
+#ifndef NRF_802154_CSMA_CA_MIN_BE_DEFAULT
+#define NRF_802154_CSMA_CA_MIN_BE_DEFAULT 3
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_MAX_BE_DEFAULT
+ *
+ * The default maximum value of the backoff exponent, BE, in the CSMA-CA algorithm
+ * (see IEEE 802.15.4-2015: 6.2.5.1).
+ *
+ * @note The maximum value of the backoff exponent may be changed from default by calling the
+ *       @ref nrf_802154_pib_csmaca_max_be_set function.
+ *
+ */
+#ifdef NRF_802154_CSMA_CA_MAX_BE
+#error "NRF_802154_CSMA_CA_MAX_BE was replaced with NRF_802154_CSMA_CA_MAX_BE_DEFAULT"
+#endif
+#ifndef NRF_802154_CSMA_CA_MAX_BE_DEFAULT
+#define NRF_802154_CSMA_CA_MAX_BE_DEFAULT 5
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT
+ *
+ * The default maximum number of backoffs that the CSMA-CA algorithm will attempt before declaring
+ * a channel access failure.
+ *
+ * @note The maximum number of backoffs may be changed from default by calling the
+ *       @ref nrf_802154_pib_csmaca_max_backoffs_set function.
+ *
+ */
+#ifdef NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT
+#error \
+    "NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS was replaced with NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT"
+#endif
+#ifndef NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT
+#define NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT 4
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT
+ *
+ * Indicates whether the CSMA-CA algorithm waits for an available timeslot before it performs
+ * the CCA procedure.
+ *
+ * @note When this option is enabled, the CSMA-CA procedure can be synchronized with timeslots of
+ *       other protocols. This decreases the robustness of the CSMA-CA procedure. On the other hand,
+ *       enabling this function increases the performance of multi-protocol applications, especially
+ *       when protocols other than 802.15.4 use much of the radio time (like the BLE scanning
+ *       operation).
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT
+#define NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT 1
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_RX_DURING_BACKOFF
+ *
+ * Indicates whether the receiver is kept enabled during the backoff periods of the CSMA-CA
+ * procedure.
+ *
+ * When this option is enabled, the CSMA-CA procedure requests the receive state when it starts,
+ * so that frames destined to this device are received and acknowledged while the procedure waits
+ * for the next CCA. The CCA and the transmission are then started directly from the receive state.
+ * If a frame is being received or acknowledged when a backoff period ends, the channel is
+ * considered busy and the next backoff period is started.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_RX_DURING_BACKOFF
+#define NRF_802154_CSMA_CA_RX_DURING_BACKOFF 0
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+ *
+ * Indicates whether the CSMA-CA parameters are adapted to the measured channel busy ratio.
+ *
+ * When this option is enabled, the driver keeps a moving average of the CCA results of the
+ * CSMA-CA procedure and of the energy detection results. At the start of each CSMA-CA procedure,
+ * the initial backoff exponent is raised from macMinBE towards macMaxBE and the maximum number of
+ * backoffs is raised by up to @ref NRF_802154_CSMA_CA_ADAPTIVE_MAX_EXTRA_BACKOFFS, proportionally
+ * to the busy ratio.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+#define NRF_802154_CSMA_CA_ADAPTIVE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_ADAPTIVE_EWMA_SHIFT
+ *
+ * The weight of a new sample in the moving average of the channel busy ratio, expressed as
+ * a power of two. Each sample contributes 1/(2^@ref NRF_802154_CSMA_CA_ADAPTIVE_EWMA_SHIFT) to
+ * the average.
+ *
+ * @note This option is used only if @ref NRF_802154_CSMA_CA_ADAPTIVE_ENABLED is enabled.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_ADAPTIVE_EWMA_SHIFT
+#define NRF_802154_CSMA_CA_ADAPTIVE_EWMA_SHIFT 3
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_ADAPTIVE_MAX_EXTRA_BACKOFFS
+ *
+ * The maximum number of backoffs added to macMaxCsmaBackoffs when the channel is busy all the time.
+ *
+ * @note This option is used only if @ref NRF_802154_CSMA_CA_ADAPTIVE_ENABLED is enabled.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_ADAPTIVE_MAX_EXTRA_BACKOFFS
+#define NRF_802154_CSMA_CA_ADAPTIVE_MAX_EXTRA_BACKOFFS 2
+#endif
+
+/**
+ * @def NRF_802154_RANDOM_POOL_SIZE
+ *
+ * The number of pseudo-random numbers generated in advance for the CSMA-CA backoff periods.
+ *
+ * The pool is filled at initialization and refilled each time the higher layer requests a CSMA-CA
+ * transmission, so the backoff periods do not wait for the random number generator. If the pool
+ * runs out, the numbers are requested from the random number generator directly. Set to 0 to
+ * disable the pool. The value must be a power of 2.
+ *
+ */
+#ifndef NRF_802154_RANDOM_POOL_SIZE
+#define NRF_802154_RANDOM_POOL_SIZE 0
+#endif
+
+/**
+ * @}
  * @defgroup nrf_802154_config_timeout ACK timeout feature configuration
  * @{
  */
 
 /**
- * @def NRF_802154_ACK_TIMEOUT_ENABLED
+ * @def NRF_802154_ACK_TIMEOUT_ENABLED
+ *
+ * Indicates whether the ACK timeout feature is to be enabled in the driver.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_ENABLED
+#define NRF_802154_ACK_TIMEOUT_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT
+ *
+ * The default timeout in microseconds (us) for the ACK timeout feature.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT
+#define NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT 7000
+#endif
+
+/**
+ * @def NRF_802154_ACK_TIMEOUT_ENH_ACK_MAX_LENGTH
+ *
+ * The longest Enh-Ack PSDU in bytes expected by the ACK timeout feature.
+ *
+ * The ACK timeout of each frame is computed from the duration of the frame and of the ACK
+ * expected for it: an Imm-Ack for frames of version 2003 and 2006, and an Enh-Ack of this length
+ * for frames of version 2015. The timeout set with @ref nrf_802154_ack_timeout_set is the upper
+ * limit of the computed timeout. Set this option to the length of the longest Enh-Ack used
+ * in the network to shorten the wait for a lost Enh-Ack.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_ENH_ACK_MAX_LENGTH
+#define NRF_802154_ACK_TIMEOUT_ENH_ACK_MAX_LENGTH MAX_PACKET_SIZE
+#endif
+
+/**
+ * @def NRF_802154_ACK_TIMEOUT_MARGIN
+ *
+ * The time in microseconds (us) added to the ACK timeout computed for each frame. It covers
+ * the resolution of the timer and the latency of ending the ACK reception.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_MARGIN
+#define NRF_802154_ACK_TIMEOUT_MARGIN 200
+#endif
+
+/**
+ * @def NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT
+ *
+ * The default timeout in microseconds (us) for the precise ACK timeout feature.
+ *
+ */
+#ifndef NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT
+#define NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT 210
+#endif
+
+/**
+ * @def NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+ *
+ * Indicates whether the precise ACK timeout feature measures the ACK wait with the RADIO TIMER.
+ *
+ * When enabled, a compare channel of the TIMER that is started at the end of the transmitted frame
+ * disables the receiver through (D)PPI if the ACK SHR is not received in time. The RADIO interrupt
+ * is raised only on the ADDRESS event and on the expiry, and no timer of the timer scheduler is
+ * used. The ACK wait is @ref TURNAROUND_TIME plus the duration of the SHR plus the timeout set
+ * with @ref nrf_802154_ack_timeout_set.
+ *
+ * @note This option requires the precise ACK timeout module to be built instead of the default
+ *       ACK timeout module.
+ *
+ */
+#ifndef NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+#define NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_MAX_ACK_IE_SIZE
+ *
+ * The maximum supported size of the 802.15.4-2015 IE header and content fields in an Enh-Ack.
+ *
+ * The Enh-Ack buffers of the Enh-Ack generator are sized for IE data of this length, so a lower value
+ * also reduces the RAM reserved for Enh-Acks.
+ *
+ */
+#ifndef NRF_802154_MAX_ACK_IE_SIZE
+#define NRF_802154_MAX_ACK_IE_SIZE 8
+#endif
+
+/**
+ * @def NRF_802154_ACK_IE_ARENA_SIZE
+ *
+ * The size in bytes of the memory shared by the IE data of all peer nodes.
+ *
+ * The memory is divided into chunks of @ref NRF_802154_MAX_ACK_IE_SIZE bytes. Each peer node with
+ * IE data takes one chunk, so peer nodes for which only the pending bit is set do not use it at all.
+ * By default, there is a chunk for every slot of @ref NRF_802154_PENDING_SHORT_ADDRESSES and
+ * @ref NRF_802154_PENDING_EXTENDED_ADDRESSES. Set it to a lower value if only a few peer nodes
+ * have IE data, to reduce RAM usage.
+ *
+ */
+#ifndef NRF_802154_ACK_IE_ARENA_SIZE
+#define NRF_802154_ACK_IE_ARENA_SIZE                                               \
+    (NRF_802154_MAX_ACK_IE_SIZE *                                                  \
+     (NRF_802154_PENDING_SHORT_ADDRESSES + NRF_802154_PENDING_EXTENDED_ADDRESSES))
+#endif
+
+/**
+ * @def NRF_802154_ENH_ACK_TEMPLATES
+ *
+ * The number of Enh-Ack frames cached by the Enh-Ack generator.
+ *
+ * An Enh-Ack sent in response to a frame with the same addressing and security fields as one of
+ * the cached frames is copied from the cache instead of being built from scratch. Only the
+ * sequence number and the frame pending bit are updated. The cache is flushed every time the ACK
+ * data is modified. Each cached frame takes about 150 bytes of RAM.
+ *
+ * Set to 0 to build every Enh-Ack from scratch.
+ *
+ */
+#ifndef NRF_802154_ENH_ACK_TEMPLATES
+#define NRF_802154_ENH_ACK_TEMPLATES 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_retransmission Frame retransmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RETRANSMISSION_ENABLED
+ *
+ * Indicates whether the driver is to retransmit frames that were transmitted with the CSMA-CA
+ * procedure and were not acknowledged. If enabled, the MAC layer is notified only about the final
+ * result of the transmission.
+ *
+ * @note This feature requires @ref NRF_802154_CSMA_CA_ENABLED and
+ *       @ref NRF_802154_ACK_TIMEOUT_ENABLED.
+ *
+ */
+#ifndef NRF_802154_RETRANSMISSION_ENABLED
+#define NRF_802154_RETRANSMISSION_ENABLED 0
+#endif
+
+#if NRF_802154_RETRANSMISSION_ENABLED && \
+    !(NRF_802154_CSMA_CA_ENABLED && NRF_802154_ACK_TIMEOUT_ENABLED)
+#error NRF_802154_RETRANSMISSION_ENABLED requires CSMA-CA and ACK timeout features.
+#endif
+
+/**
+ * @def NRF_802154_MAX_FRAME_RETRIES_DEFAULT
+ *
+ * The default maximum number of retransmissions of a frame that was not acknowledged
+ * (macMaxFrameRetries, see IEEE 802.15.4-2015: 6.7.4.3).
+ *
+ * @note The maximum number of retransmissions may be changed from default by calling the
+ *       @ref nrf_802154_max_frame_retries_set function.
+ *
+ */
+#ifndef NRF_802154_MAX_FRAME_RETRIES_DEFAULT
+#define NRF_802154_MAX_FRAME_RETRIES_DEFAULT 3
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_ifs Interframe spacing feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_IFS_ENABLED
+ *
+ * Indicates whether the Short/Long Interframe spacing feature is to be enabled in the driver.
+ *
+ */
+#ifndef NRF_802154_IFS_ENABLED
+#define NRF_802154_IFS_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_IFS_HW_TIMED_ENABLED
+ *
+ * Indicates whether a transmission without CCA delayed by the interframe spacing is to be started
+ * by the TIMER peripheral through (D)PPI exactly at the end of the IFS instead of by the timer
+ * scheduler.
+ *
+ * The end of the IFS is measured with the high precision timer. Transmissions with CCA and
+ * transmissions for which the high precision measurement is not reliable use the timer scheduler.
+ *
+ */
+#ifndef NRF_802154_IFS_HW_TIMED_ENABLED
+#define NRF_802154_IFS_HW_TIMED_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_duplicate_filter Duplicate frame filter configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_DUPLICATE_FILTER_ENABLED
+ *
+ * Indicates whether the driver is to filter out retransmitted frames.
+ *
+ * A frame that has the same source address, sequence number and frame counter as the previous
+ * frame from that sender is acknowledged, but it is not passed to the higher layer again.
+ * Only frames acknowledged automatically by the driver are filtered.
+ *
+ */
+#ifndef NRF_802154_DUPLICATE_FILTER_ENABLED
+#define NRF_802154_DUPLICATE_FILTER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DUPLICATE_FILTER_SIZE
+ *
+ * The number of recent peers for which the last received frame is remembered by the duplicate
+ * frame filter.
+ *
+ */
+#ifndef NRF_802154_DUPLICATE_FILTER_SIZE
+#define NRF_802154_DUPLICATE_FILTER_SIZE 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_peer_table Peer table configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_PEER_TABLE_ENABLED
+ *
+ * Indicates whether the driver is to keep the link quality of its peers.
+ *
+ * The RSSI and LQI of the frames received from a peer, the time of the last such frame and the
+ * rate of acknowledged transmissions to the peer are stored for its address. They can be read
+ * with @ref nrf_802154_peers_get.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_ENABLED
+#define NRF_802154_PEER_TABLE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_SIZE
+ *
+ * The number of peers kept in the peer table. When the table is full, the peer added first
+ * is replaced.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_SIZE
+#define NRF_802154_PEER_TABLE_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_EWMA_SHIFT
+ *
+ * The weight of a new sample in the averages kept by the peer table, as a power of 2.
+ * Each sample contributes 1/2^NRF_802154_PEER_TABLE_EWMA_SHIFT to the average.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_EWMA_SHIFT
+#define NRF_802154_PEER_TABLE_EWMA_SHIFT 3
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_TX_ANTENNA_ENABLED
+ *
+ * Indicates whether the antenna learned from the frames received from a peer is used to
+ * transmit frames to that peer.
+ *
+ * The best antenna selected by the antenna diversity for the last frame received from a peer is
+ * stored in the peer table. When the antenna diversity mode for transmission is
+ * @ref NRF_802154_SL_ANT_DIV_MODE_MANUAL, frames destined to a known peer are transmitted with its
+ * learned antenna instead of the one set by @ref nrf_802154_antenna_diversity_tx_antenna_set.
+ * This option has effect only if @ref NRF_802154_PEER_TABLE_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_TX_ANTENNA_ENABLED
+#define NRF_802154_PEER_TABLE_TX_ANTENNA_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+ *
+ * Indicates whether the transmit power is adapted to each peer.
+ *
+ * The peer table keeps a transmit power reduction for each peer. It is increased by
+ * @ref NRF_802154_PEER_TABLE_TX_POWER_STEP when an ACK from the peer is received with RSSI above
+ * @ref NRF_802154_PEER_TABLE_TX_POWER_TARGET_RSSI by more than
+ * @ref NRF_802154_PEER_TABLE_TX_POWER_HYSTERESIS, and decreased by the same step when the RSSI is
+ * below the target. When an ACK from the peer is not received, the reduction is cleared, so the
+ * retransmissions use the full power. Frames destined to the peer are transmitted with the power
+ * set by @ref nrf_802154_tx_power_set lowered by the reduction of the peer. Frames with
+ * the transmit power given in their transmit parameters are not affected.
+ *
+ * The control assumes that the link is symmetric, that is the peer transmits its ACKs with
+ * a power similar to the one the frames are transmitted with.
+ * This option has effect only if @ref NRF_802154_PEER_TABLE_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+#define NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_TX_POWER_TARGET_RSSI
+ *
+ * The lowest RSSI of an ACK, in dBm, for which the transmit power to its sender is not increased.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_TX_POWER_TARGET_RSSI
+#define NRF_802154_PEER_TABLE_TX_POWER_TARGET_RSSI (-75)
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_TX_POWER_HYSTERESIS
+ *
+ * The margin above @ref NRF_802154_PEER_TABLE_TX_POWER_TARGET_RSSI, in dB, that the RSSI of
+ * an ACK must exceed for the transmit power to its sender to be decreased.
+ *
+ * It must not be lower than @ref NRF_802154_PEER_TABLE_TX_POWER_STEP, or the power oscillates
+ * between two steps.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_TX_POWER_HYSTERESIS
+#define NRF_802154_PEER_TABLE_TX_POWER_HYSTERESIS 8
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_TX_POWER_STEP
+ *
+ * The change of the transmit power reduction of a peer after a received ACK, in dB.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_TX_POWER_STEP
+#define NRF_802154_PEER_TABLE_TX_POWER_STEP 4
+#endif
+
+/**
+ * @def NRF_802154_PEER_TABLE_TX_POWER_MAX_REDUCTION
+ *
+ * The maximum transmit power reduction of a peer, in dB.
+ *
+ */
+#ifndef NRF_802154_PEER_TABLE_TX_POWER_MAX_REDUCTION
+#define NRF_802154_PEER_TABLE_TX_POWER_MAX_REDUCTION 24
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_csl_tx CSL transmitter configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CSL_TX_ENABLED
+ *
+ * If the CSL transmitter is to be built in.
+ *
+ * The driver reads the CSL IE from the received frames and Enh-ACKs and keeps the time of
+ * the next channel sample and the sampling period of each CSL receiver. The frames passed to
+ * @ref nrf_802154_transmit_csl are scheduled at the next channel sample of their destination.
+ * This option requires @ref NRF_802154_DELAYED_TRX_ENABLED and
+ * @ref NRF_802154_FRAME_TIMESTAMP_ENABLED.
+ *
+ */
+#ifndef NRF_802154_CSL_TX_ENABLED
+#define NRF_802154_CSL_TX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CSL_TX_PEERS
+ *
+ * The number of CSL receivers tracked by the CSL transmitter. When a new receiver is heard and
+ * there is no free entry, the oldest added receiver is replaced.
+ *
+ */
+#ifndef NRF_802154_CSL_TX_PEERS
+#define NRF_802154_CSL_TX_PEERS 4
+#endif
+
+/**
+ * @def NRF_802154_CSL_TX_LEAD_TIME
+ *
+ * The minimum time, in microseconds, between a call to @ref nrf_802154_transmit_csl and
+ * the channel sample the frame is scheduled at. A channel sample closer than this is skipped, so
+ * the delayed transmission has time to be set up.
+ *
+ */
+#ifndef NRF_802154_CSL_TX_LEAD_TIME
+#define NRF_802154_CSL_TX_LEAD_TIME 1000
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_link_metrics Enh-Ack link metrics configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_LINK_METRICS_ENABLED
+ *
+ * Indicates whether the driver is to write the link metrics of Enh-Ack based probing into
+ * the Enh-Acks.
+ *
+ * The link metrics of the frames received from each initiator configured with
+ * @ref nrf_802154_link_metrics_initiator_configure are written into the Thread vendor-specific
+ * header IE of the IE data set for the initiator with @ref nrf_802154_ack_data_set, just before
+ * the Enh-Ack is transmitted.
+ *
+ */
+#ifndef NRF_802154_LINK_METRICS_ENABLED
+#define NRF_802154_LINK_METRICS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_LINK_METRICS_INITIATORS
+ *
+ * The number of initiators for which the link metrics can be configured at the same time.
+ *
+ */
+#ifndef NRF_802154_LINK_METRICS_INITIATORS
+#define NRF_802154_LINK_METRICS_INITIATORS 8
+#endif
+
+/**
+ * @def NRF_802154_LINK_METRICS_EWMA_SHIFT
+ *
+ * The weight of a new frame in the link metrics of an initiator, as a power of 2.
+ * Each frame contributes 1/2^NRF_802154_LINK_METRICS_EWMA_SHIFT to the metrics. The default
+ * value 0 reports the metrics of the frame the Enh-Ack is sent for, as Thread requires.
+ *
+ */
+#ifndef NRF_802154_LINK_METRICS_EWMA_SHIFT
+#define NRF_802154_LINK_METRICS_EWMA_SHIFT 0
+#endif
+
+/**
+ * @def NRF_802154_LINK_METRICS_NOISE_FLOOR
+ *
+ * The noise floor in dBm the link margin is computed against.
+ *
+ */
+#ifndef NRF_802154_LINK_METRICS_NOISE_FLOOR
+#define NRF_802154_LINK_METRICS_NOISE_FLOOR (-100)
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_security Frame security configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_ENCRYPTION_ENABLED
+ *
+ * Indicates whether the driver is to secure the transmitted frames and Enh-Acks with AES-CCM*.
+ *
+ * Frames with the Security Enabled bit set are secured just before each transmission attempt,
+ * using the key found by the Key Identifier field of their auxiliary security header. See
+ * @ref nrf_802154_security_key_store. The ECB peripheral is used for AES.
+ *
+ */
+#ifndef NRF_802154_ENCRYPTION_ENABLED
+#define NRF_802154_ENCRYPTION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DECRYPTION_ENABLED
+ *
+ * Indicates whether the driver is to verify and decrypt the received secured frames.
+ *
+ * Frames are processed in the notification context, just before they are passed to the higher
+ * layer, so the RADIO interrupt is not extended. Frames with an invalid MIC are dropped. Frames
+ * that are verified have the @c decrypted field of @ref nrf_802154_rx_metadata_t set. Frames for
+ * which there is no matching key, or that the driver cannot process, are passed unchanged.
+ *
+ * @note This option requires @ref NRF_802154_ENCRYPTION_ENABLED, which provides the key storage.
+ *
+ */
+#ifndef NRF_802154_DECRYPTION_ENABLED
+#define NRF_802154_DECRYPTION_ENABLED 0
+#endif
+
+#if NRF_802154_DECRYPTION_ENABLED && !NRF_802154_ENCRYPTION_ENABLED
+#error NRF_802154_DECRYPTION_ENABLED requires NRF_802154_ENCRYPTION_ENABLED.
+#endif
+
+/**
+ * @def NRF_802154_SECURITY_KEY_STORAGE_SIZE
+ *
+ * The number of keys that can be stored in the driver to secure frames.
+ *
+ * This option has effect only if @ref NRF_802154_ENCRYPTION_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_SECURITY_KEY_STORAGE_SIZE
+#define NRF_802154_SECURITY_KEY_STORAGE_SIZE 3
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_STARTED_NOTIFY_ENABLED
+ *
+ * Indicates whether the notifications of the started transmissions are to be enabled in the driver.
+ *
+ * @note This feature is enabled by default if the ACK timeout feature or CSMA-CA is enabled.
+ *       These features depend on the notifications of the transmission start.
+ */
+#ifndef NRF_802154_TX_STARTED_NOTIFY_ENABLED
+#if NRF_802154_ACK_TIMEOUT_ENABLED || NRF_802154_CSMA_CA_ENABLED
+#define NRF_802154_TX_STARTED_NOTIFY_ENABLED 1
+#else
+#define NRF_802154_TX_STARTED_NOTIFY_ENABLED 0
+#endif
+#endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_rx_batch Batched reception notification feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RX_BATCH_NOTIFY_ENABLED
+ *
+ * Indicates whether received frames are to be passed to the higher layer in batches.
+ *
+ * If enabled, all consecutive frame reception notifications waiting in the notification queue
+ * are passed to the higher layer in a single call to @ref nrf_802154_received_batch_raw instead
+ * of one call to @ref nrf_802154_received_raw per frame.
+ *
+ * @note This feature is available only with @ref NRF_802154_USE_RAW_API enabled.
+ *
+ */
+#ifndef NRF_802154_RX_BATCH_NOTIFY_ENABLED
+#define NRF_802154_RX_BATCH_NOTIFY_ENABLED 0
+#endif
+
+#if NRF_802154_RX_BATCH_NOTIFY_ENABLED && !NRF_802154_USE_RAW_API
+#error NRF_802154_RX_BATCH_NOTIFY_ENABLED requires NRF_802154_USE_RAW_API.
+#endif
+
+/**
+ * @def NRF_802154_ASYNC_REQUESTS_ENABLED
+ *
+ * Indicates whether the asynchronous variants of the requests are available.
+ *
+ * An asynchronous request is only queued for the SWI priority and the function returns at once.
+ * The result of the request is passed to the higher layer later, with
+ * @ref nrf_802154_async_request_done called from the notification queue.
+ *
+ */
+#ifndef NRF_802154_ASYNC_REQUESTS_ENABLED
+#define NRF_802154_ASYNC_REQUESTS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_REQUEST_QUEUE_SIZE
+ *
+ * Number of slots in the queue of requests passed to the SWI priority.
+ *
+ * Synchronous requests are processed before the request function returns, so two slots are
+ * enough for them. Each pending asynchronous request occupies one slot until it is processed,
+ * and a synchronous request issued while the queue is full is a fatal error.
+ *
+ * @note One slot is lost due to simplified queue implementation.
+ *
+ */
+#ifndef NRF_802154_REQUEST_QUEUE_SIZE
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+#define NRF_802154_REQUEST_QUEUE_SIZE 8
+#else
+#define NRF_802154_REQUEST_QUEUE_SIZE 2
+#endif
+#endif
+
+#if NRF_802154_REQUEST_QUEUE_SIZE < 2
+#error NRF_802154_REQUEST_QUEUE_SIZE must be at least 2.
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_QUEUE_LOCK_FREE
+ *
+ * Indicates whether notifications issued at the highest interrupt priority are queued for the SWI
+ * priority without masking interrupts.
+ *
+ * The notification queue has a single reader, the SWI handler, and tolerates only one writer
+ * at a time. A notifier running at priority 0, like the RADIO IRQ handler with the default
+ * @ref NRF_802154_IRQ_PRIORITY, cannot be preempted by another notifier, so it writes to the
+ * queue without masking interrupts. Notifiers running at lower priorities, for example
+ * the timers of delayed operations that notify outside of the driver critical section, still
+ * mask interrupts while they write to the queue.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_QUEUE_LOCK_FREE
+#define NRF_802154_NOTIFICATION_QUEUE_LOCK_FREE 0
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_QUEUE_SIZE
+ *
+ * The number of notifications that can be pending in the SWI notification queue of each priority
+ * class.
+ *
+ * If set to 0, the queue is sized for the worst case: one notification for each receive buffer,
+ * each frame in the transmit queue and each queued asynchronous request, plus the transmission and
+ * energy detection results. Set it to the largest burst of notifications that the application can
+ * leave unprocessed, to reduce RAM usage on devices with many receive buffers.
+ *
+ * @note This option has no effect if the direct variant of the notification module is used.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_QUEUE_SIZE
+#define NRF_802154_NOTIFICATION_QUEUE_SIZE 0
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_PRIORITY_ENABLED
+ *
+ * Indicates whether notifications passed from the SWI priority are ordered by priority classes.
+ *
+ * If enabled, results of transmissions, CCA and energy detection procedures, and of
+ * asynchronous requests are passed to the higher layer before any pending notifications of
+ * received frames, reception failures and completed TSCH cells. Notifications within a class are
+ * passed in the order in which they were issued.
+ *
+ * @note This option has no effect if the direct variant of the notification module is used.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_PRIORITY_ENABLED
+#define NRF_802154_NOTIFICATION_PRIORITY_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+ *
+ * Indicates whether consecutive reception failures with the same error code are notified once.
+ *
+ * If enabled, reception failures are passed to @ref nrf_802154_receive_failed_coalesced with
+ * the number of failures instead of to @ref nrf_802154_receive_failed. A failure with the same
+ * error code as the one still waiting in the notification queue only increments its count,
+ * so interference does not fill the notification queue.
+ *
+ */
+#ifndef NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+#define NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_THREAD_ENABLED
+ *
+ * Indicates whether notifications are passed from a thread of the operating system instead of
+ * from the SWI priority.
+ *
+ * If enabled, the notification queue is not processed in the SWI handler. Each notification only
+ * calls @ref nrf_802154_notification_thread_wakeup, and the thread of the higher layer passes all
+ * pending notifications by calling @ref nrf_802154_notification_thread_process. This removes the
+ * hop through the SWI interrupt from the latency of the reception and transmission results.
+ *
+ * @note This option has no effect if the direct variant of the notification module is used.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_THREAD_ENABLED
+#define NRF_802154_NOTIFICATION_THREAD_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_THREAD_WAKEUP_BATCHED
+ *
+ * Indicates whether the thread processing notifications is woken up once for a batch of
+ * notifications.
+ *
+ * If enabled, @ref nrf_802154_notification_thread_wakeup is called only for the first
+ * notification issued after the thread started processing the queue. Notifications issued before
+ * the thread runs are passed with a single call to @ref nrf_802154_notification_thread_process.
+ * If disabled, the wake-up function is called for each notification.
+ *
+ * @note This option has no effect if @ref NRF_802154_NOTIFICATION_THREAD_ENABLED is disabled.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_THREAD_WAKEUP_BATCHED
+#define NRF_802154_NOTIFICATION_THREAD_WAKEUP_BATCHED 1
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_DIRECT_TX_ENABLED
+ *
+ * Indicates whether the results of transmissions bypass the SWI notification queue.
+ *
+ * If enabled, @ref nrf_802154_transmitted_raw and @ref nrf_802154_transmit_failed are called
+ * directly from the context of the driver that ended the transmission, usually the RADIO IRQ,
+ * while the other notifications are still passed from the SWI priority. A transmission result can
+ * then be passed before the pending notifications of frames received earlier.
+ *
+ * @note This option has no effect if the direct variant of the notification module is used.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_DIRECT_TX_ENABLED
+#define NRF_802154_NOTIFICATION_DIRECT_TX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED
+ *
+ * Indicates whether the results of the energy detection and CCA procedures bypass the SWI
+ * notification queue.
+ *
+ * If enabled, these results are passed directly from the context of the driver that ended the
+ * procedure, while the other notifications are still passed from the SWI priority.
+ *
+ * @note This option has no effect if the direct variant of the notification module is used.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED
+#define NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_FEM_PA_ACTIVATION_DELAY_US
+ *
+ * The initial time in microseconds by which the activation of the PA is delayed with respect to
+ * the time gap configured in the FEM. It must be lower than the TX ramp-up time and must not
+ * exceed the PA time gap. The value can be changed at runtime with
+ * @ref nrf_802154_fem_activation_delay_set, to trim the PA on-time to the part of a board.
+ *
+ */
+#ifndef NRF_802154_FEM_PA_ACTIVATION_DELAY_US
+#define NRF_802154_FEM_PA_ACTIVATION_DELAY_US 0
+#endif
+
+/**
+ * @def NRF_802154_FEM_LNA_ACTIVATION_DELAY_US
+ *
+ * The initial time in microseconds by which the activation of the LNA is delayed with respect to
+ * the time gap configured in the FEM. It must be lower than the RX ramp-up time and must not
+ * exceed the LNA time gap. The value can be changed at runtime with
+ * @ref nrf_802154_fem_activation_delay_set.
+ *
+ */
+#ifndef NRF_802154_FEM_LNA_ACTIVATION_DELAY_US
+#define NRF_802154_FEM_LNA_ACTIVATION_DELAY_US 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_coex WiFi coexistence feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_COEX_INITIALLY_ENABLED
+ *
+ * Configures if WiFi coex is initially enabled or disabled.
+ */
+#ifndef NRF_802154_COEX_INITIALLY_ENABLED
+#define NRF_802154_COEX_INITIALLY_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_COEX_STATS_ENABLED
+ *
+ * Configures if the statistics of the access to the medium granted by the PTA are collected.
+ * When this option is enabled, histograms of the time from a request to the PTA to its grant
+ * and the numbers of denials are stored separately for reception, transmission and ACK
+ * transmission. The times are measured with the high precision timer, so only the grants that
+ * arrive while the radio driver is granted the timeslot are counted in the histograms. The
+ * statistics can be retrieved by a call to @ref nrf_802154_stat_coex_get.
+ */
+#ifndef NRF_802154_COEX_STATS_ENABLED
+#define NRF_802154_COEX_STATS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_COEX_PRIORITY_ENABLED
+ *
+ * Configures if the priority signalled to the PTA is selected per operation. When this option is
+ * enabled, ACKs, frames transmitted at a given time (including CSL transmissions) and frames
+ * transmitted with @ref NRF_802154_TX_PARAM_COEX_HIGH are requested with the high priority, along
+ * with the reception of their ACKs. Reception and other transmissions are requested with the normal
+ * priority, so that Wi-Fi yields only to the time-critical traffic. When this option is disabled,
+ * all operations are requested with the same priority.
+ */
+#ifndef NRF_802154_COEX_PRIORITY_ENABLED
+#define NRF_802154_COEX_PRIORITY_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_stats Statistics configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_STATS_ENABLED
+ *
+ * Configures if the statistic counters, the total times, and the CSMA-CA and channel histograms
+ * are updated.
+ *
+ * Disabling this option removes all their updates from the driver at compile time, including
+ * the ones in the RADIO interrupt handler, and by default also disables
+ * @ref NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS and
+ * @ref NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES. The functions that return the statistics are
+ * still available, but return zeros. The timestamps in @ref nrf_802154_stat_timestamps_t are
+ * always updated, as the driver uses them to timestamp the notified frames.
+ */
+#ifndef NRF_802154_STATS_ENABLED
+#define NRF_802154_STATS_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_MODEL_ENABLED
+ *
+ * Configures if the charge used by the radio can be estimated with
+ * @ref nrf_802154_stat_charge_get.
+ *
+ * The charge is calculated from the total times of @ref nrf_802154_stat_totals_t and the currents
+ * of the states given by the @c NRF_802154_ENERGY_*_CURRENT options, so the model is only as
+ * accurate as these currents for the given device, supply voltage and DC/DC converter setting.
+ * The defaults are typical values of nRF52840 with the DC/DC converter enabled at 3 V.
+ *
+ * This option requires @ref NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED.
+ */
+#ifndef NRF_802154_ENERGY_MODEL_ENABLED
+#define NRF_802154_ENERGY_MODEL_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_RX_CURRENT
+ *
+ * The current in microamperes drawn while the receiver is turned on.
+ */
+#ifndef NRF_802154_ENERGY_RX_CURRENT
+#define NRF_802154_ENERGY_RX_CURRENT 4600
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_TX_CURRENTS
+ *
+ * The currents in microamperes drawn while transmitting at each transmit power level, as
+ * an initializer of an array of @ref NRF_802154_STAT_TX_POWER_LEVELS elements.
+ */
+#ifndef NRF_802154_ENERGY_TX_CURRENTS
+#define NRF_802154_ENERGY_TX_CURRENTS {2700, 3300, 3700, 4200, 4800, 6400, 9600, 14800}
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_LNA_CURRENT
+ *
+ * The current in microamperes drawn by the LNA of the front-end module while it is active.
+ */
+#ifndef NRF_802154_ENERGY_LNA_CURRENT
+#define NRF_802154_ENERGY_LNA_CURRENT 0
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_PA_CURRENT
+ *
+ * The current in microamperes drawn by the PA of the front-end module while it is active.
+ */
+#ifndef NRF_802154_ENERGY_PA_CURRENT
+#define NRF_802154_ENERGY_PA_CURRENT 0
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_HFXO_CURRENT
  *
- * Indicates whether the ACK timeout feature is to be enabled in the driver.
+ * The current in microamperes drawn by the HFXO while it is running.
+ */
+#ifndef NRF_802154_ENERGY_HFXO_CURRENT
+#define NRF_802154_ENERGY_HFXO_CURRENT 250
+#endif
+
+#if NRF_802154_ENERGY_MODEL_ENABLED && !NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+#error NRF_802154_ENERGY_MODEL_ENABLED requires NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED.
+#endif
+
+/**
+ * @def NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS
  *
+ * Configures if energy detected events will be counted in receive mode.
+ * When this option is enabled additional interrupts on energy detected events will occur
+ * increasing power consumption. The events counter is stored in
+ * @ref nrf_802154_stat_counters_t::received_energy_events field and can be retrieved by
+ * a call to @ref nrf_802154_stats_get or @ref nrf_802154_stat_counters_get.
  */
-#ifndef NRF_802154_ACK_TIMEOUT_ENABLED
-#define NRF_802154_ACK_TIMEOUT_ENABLED 1
+#ifndef NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS
+#define NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS NRF_802154_STATS_ENABLED
 #endif
 
 /**
- * @def NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT
+ * @def NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES
  *
- * The default timeout in microseconds (us) for the ACK timeout feature.
+ * Configures if number of received preambles will be counted in receive mode.
+ * When this option is enabled additional interrupts on preamble reveived will occur
+ * increasing power consumption. The events counter is stored in
+ * @ref nrf_802154_stat_counters_t::received_preambles field and can be retrieved by
+ * a call to @ref nrf_802154_stats_get or @ref nrf_802154_stat_counters_get.
+ */
+#ifndef NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES
+#define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES NRF_802154_STATS_ENABLED
+#endif
+
+/**
+ * @def NRF_802154_QUEUE_STATS_ENABLED
  *
+ * Configures if the usage of the notification and request queues is measured.
+ * When this option is enabled, the high watermark, the number of writes that almost filled
+ * the queue and the histogram of times the items waited in the queue are stored for each queue.
+ * The times are measured with the high precision timer. They can be retrieved by a call to
+ * @ref nrf_802154_stat_queues_get.
  */
-#ifndef NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT
-#define NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT 7000
+#ifndef NRF_802154_QUEUE_STATS_ENABLED
+#define NRF_802154_QUEUE_STATS_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT
+ * @def NRF_802154_STATS_PER_CHANNEL_ENABLED
  *
- * The default timeout in microseconds (us) for the precise ACK timeout feature.
+ * Configures if the driver counts events separately for each channel.
+ * When this option is enabled, the received frames, CRC errors, CCA results, energy detection
+ * samples and transmission attempts are counted for the channel they happened on. The counters
+ * can be retrieved by a call to @ref nrf_802154_stat_channels_get.
+ */
+#ifndef NRF_802154_STATS_PER_CHANNEL_ENABLED
+#define NRF_802154_STATS_PER_CHANNEL_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_LATENCY_STATS_ENABLED
+ *
+ * Configures if the latencies of notifications and requests are measured.
+ * When this option is enabled, histograms of the time from the end of a received frame to its
+ * notification, from the end of a transmission to its notification and from a request call to its
+ * handling by the core are stored. The times are measured with the high precision timer, so only
+ * the latencies that start and end while the radio driver is granted the timeslot are counted.
+ * They can be retrieved by a call to @ref nrf_802154_stat_latency_histogram_get.
+ */
+#ifndef NRF_802154_LATENCY_STATS_ENABLED
+#define NRF_802154_LATENCY_STATS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+ *
+ * Configures if the hold times of the critical section are measured.
+ * When this option is enabled, the longest and the total time the outermost critical section
+ * was held are stored for each calling module and each interrupt priority. The times are measured
+ * with the high precision timer, so only critical sections entered while the radio driver is
+ * granted the timeslot are counted. They can be retrieved by a call to
+ * @ref nrf_802154_stat_crit_sect_get.
+ */
+#ifndef NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+#define NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_IRQ_PROFILER_ENABLED
  *
+ * Configures if the execution times of the RADIO interrupt handlers are measured.
+ * When this option is enabled, the DWT cycle counter is started during the initialization of
+ * the driver, and the number of CPU cycles spent in the RADIO IRQ handler, in the handler of each
+ * RADIO event and in the core callbacks called for received frames are stored. They can be
+ * retrieved by a call to @ref nrf_802154_stat_irq_cycles_get.
+ *
+ * @note The application must not use the DWT cycle counter for other purposes when this option
+ *       is enabled.
  */
-#ifndef NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT
-#define NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT 210
+#ifndef NRF_802154_IRQ_PROFILER_ENABLED
+#define NRF_802154_IRQ_PROFILER_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_MAX_ACK_IE_SIZE
+ * @def NRF_802154_OCCUPANCY_MONITOR_ENABLED
  *
- * The maximum supported size of the 802.15.4-2015 IE header and content fields in an Enh-Ack.
+ * Configures if the driver samples the power on the channel while it is idle listening.
+ * When this option is enabled, the RSSI is measured every
+ * @ref NRF_802154_OCCUPANCY_MONITOR_PERIOD_US while the driver is in the receive state and no
+ * frame is being received. The samples are counted in a histogram of each channel, that can be
+ * retrieved by a call to @ref nrf_802154_stat_occupancy_get.
+ */
+#ifndef NRF_802154_OCCUPANCY_MONITOR_ENABLED
+#define NRF_802154_OCCUPANCY_MONITOR_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_STATS_ENABLED
+ *
+ * Configures if the statistics of the antenna diversity in the receive operations are collected.
+ * When this option is enabled, histograms of the RSSI of the frames received on each antenna,
+ * the number of changes of the selected antenna and the histogram of the time from the detection
+ * of a preamble to the start of the frame are stored, together with the number of selections
+ * not followed by a frame. The statistics can be retrieved by a call to
+ * @ref nrf_802154_stat_ant_div_get.
+ */
+#ifndef NRF_802154_ANT_DIV_STATS_ENABLED
+#define NRF_802154_ANT_DIV_STATS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_OCCUPANCY_MONITOR_PERIOD_US
  *
+ * Period of the RSSI sampling performed when @ref NRF_802154_OCCUPANCY_MONITOR_ENABLED is set.
  */
-#ifndef NRF_802154_MAX_ACK_IE_SIZE
-#define NRF_802154_MAX_ACK_IE_SIZE 8
+#ifndef NRF_802154_OCCUPANCY_MONITOR_PERIOD_US
+#define NRF_802154_OCCUPANCY_MONITOR_PERIOD_US 1000
 #endif
 
 /**
- * @}
- * @defgroup nrf_802154_config_ifs Interframe spacing feature configuration
- * @{
+ * @def NRF_802154_TIMESLOT_STATS_ENABLED
+ *
+ * Configures if the statistics of the timeslots granted by the radio scheduler are collected.
+ * When this option is enabled, the driver counts the granted and revoked timeslots,
+ * the operations aborted by the revocations and the time spent without a timeslot after
+ * a revocation. The last @ref NRF_802154_TIMESLOT_STATS_LOG_SIZE grants and revocations are kept
+ * with their times in a log. The statistics can be retrieved by a call to
+ * @ref nrf_802154_stat_timeslot_get and the log by a call to
+ * @ref nrf_802154_stat_timeslot_log_read.
+ *
  */
+#ifndef NRF_802154_TIMESLOT_STATS_ENABLED
+#define NRF_802154_TIMESLOT_STATS_ENABLED 0
+#endif
 
 /**
- * @def NRF_802154_IFS_ENABLED
+ * @def NRF_802154_TIMESLOT_STATS_LOG_SIZE
  *
- * Indicates whether the Short/Long Interframe spacing feature is to be enabled in the driver.
+ * The number of events kept in the log of the timeslot statistics. When the log is full,
+ * the oldest event is overwritten.
  *
  */
-#ifndef NRF_802154_IFS_ENABLED
-#define NRF_802154_IFS_ENABLED 1
+#ifndef NRF_802154_TIMESLOT_STATS_LOG_SIZE
+#define NRF_802154_TIMESLOT_STATS_LOG_SIZE 32
 #endif
 
 /**
  * @}
- * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
+ * @defgroup nrf_802154_config_hooks External core hooks configuration
  * @{
+ *
+ * Modules kept outside of the driver can attach to the core events without modifying
+ * @c nrf_802154_core_hooks.c. Each list below is a macro that takes a macro @c X as its argument
+ * and applies it to every hook function, for example:
+ *
+ * @code
+ * #define NRF_802154_CORE_HOOKS_EXTERNAL_TRANSMITTED(X) X(my_mac_transmitted) X(my_log_transmitted)
+ * @endcode
+ *
+ * The hooks are collected in constant arrays at compile time and are called after the hooks of
+ * the driver features, in the order of the list. They are called regardless of the procedures
+ * marked with @ref nrf_802154_core_hooks_proc_activate, so they must check their own state.
+ * The core declares the listed functions itself, with the signatures given below. Hooks that return
+ * @c bool stop the processing of the remaining hooks by returning false, in the same way as
+ * the hooks of the driver features.
  */
 
 /**
- * @def NRF_802154_TX_STARTED_NOTIFY_ENABLED
+ * @def NRF_802154_CORE_HOOKS_EXTERNAL_ABORT
  *
- * Indicates whether the notifications of the started transmissions are to be enabled in the driver.
+ * List of external hooks called by @ref nrf_802154_core_hooks_terminate.
+ * The signature of each hook is
+ * @c bool hook(nrf_802154_term_t term_lvl, req_originator_t req_orig).
  *
- * @note This feature is enabled by default if the ACK timeout feature or CSMA-CA is enabled.
- *       These features depend on the notifications of the transmission start.
  */
-#ifndef NRF_802154_TX_STARTED_NOTIFY_ENABLED
-#if NRF_802154_ACK_TIMEOUT_ENABLED || NRF_802154_CSMA_CA_ENABLED
-#define NRF_802154_TX_STARTED_NOTIFY_ENABLED 1
-#else
-#define NRF_802154_TX_STARTED_NOTIFY_ENABLED 0
+#ifndef NRF_802154_CORE_HOOKS_EXTERNAL_ABORT
+#define NRF_802154_CORE_HOOKS_EXTERNAL_ABORT(X)
 #endif
-#endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
 
 /**
- * @}
- * @defgroup nrf_802154_coex WiFi coexistence feature configuration
- * @{
+ * @def NRF_802154_CORE_HOOKS_EXTERNAL_PRE_TRANSMISSION
+ *
+ * List of external hooks called by @ref nrf_802154_core_hooks_pre_transmission.
+ * The signature of each hook is
+ * @c bool hook(const uint8_t * p_frame, bool cca).
+ *
  */
+#ifndef NRF_802154_CORE_HOOKS_EXTERNAL_PRE_TRANSMISSION
+#define NRF_802154_CORE_HOOKS_EXTERNAL_PRE_TRANSMISSION(X)
+#endif
 
 /**
- * @def NRF_802154_COEX_INITIALLY_ENABLED
+ * @def NRF_802154_CORE_HOOKS_EXTERNAL_TRANSMITTED
+ *
+ * List of external hooks called by @ref nrf_802154_core_hooks_transmitted.
+ * The signature of each hook is
+ * @c void hook(const uint8_t * p_frame).
  *
- * Configures if WiFi coex is initially enabled or disabled.
  */
-#ifndef NRF_802154_COEX_INITIALLY_ENABLED
-#define NRF_802154_COEX_INITIALLY_ENABLED 1
+#ifndef NRF_802154_CORE_HOOKS_EXTERNAL_TRANSMITTED
+#define NRF_802154_CORE_HOOKS_EXTERNAL_TRANSMITTED(X)
+#endif
+
+/**
+ * @def NRF_802154_CORE_HOOKS_EXTERNAL_TX_FAILED
+ *
+ * List of external hooks called by @ref nrf_802154_core_hooks_tx_failed.
+ * The signature of each hook is
+ * @c bool hook(const uint8_t * p_frame, nrf_802154_tx_error_t error).
+ *
+ */
+#ifndef NRF_802154_CORE_HOOKS_EXTERNAL_TX_FAILED
+#define NRF_802154_CORE_HOOKS_EXTERNAL_TX_FAILED(X)
+#endif
+
+/**
+ * @def NRF_802154_CORE_HOOKS_EXTERNAL_TX_STARTED
+ *
+ * List of external hooks called by @ref nrf_802154_core_hooks_tx_started.
+ * The signature of each hook is
+ * @c bool hook(const uint8_t * p_frame).
+ *
+ */
+#ifndef NRF_802154_CORE_HOOKS_EXTERNAL_TX_STARTED
+#define NRF_802154_CORE_HOOKS_EXTERNAL_TX_STARTED(X)
+#endif
+
+/**
+ * @def NRF_802154_CORE_HOOKS_EXTERNAL_RX_STARTED
+ *
+ * List of external hooks called by @ref nrf_802154_core_hooks_rx_started.
+ * The signature of each hook is
+ * @c void hook(const uint8_t * p_frame).
+ *
+ */
+#ifndef NRF_802154_CORE_HOOKS_EXTERNAL_RX_STARTED
+#define NRF_802154_CORE_HOOKS_EXTERNAL_RX_STARTED(X)
+#endif
+
+/**
+ * @def NRF_802154_CORE_HOOKS_EXTERNAL_RX_ACK_STARTED
+ *
+ * List of external hooks called by @ref nrf_802154_core_hooks_rx_ack_started.
+ * The signature of each hook is
+ * @c void hook(void).
+ *
+ */
+#ifndef NRF_802154_CORE_HOOKS_EXTERNAL_RX_ACK_STARTED
+#define NRF_802154_CORE_HOOKS_EXTERNAL_RX_ACK_STARTED(X)
 #endif
 
 /**
  * @}
- * @defgroup nrf_802154_stats Statistics configuration
+ * @defgroup nrf_802154_config_trace Debug log and binary trace configuration
  * @{
  */
 
 /**
- * @def NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS
+ * @def NRF_802154_RAM_USAGE_REPORT_ENABLED
+ *
+ * Indicates whether the driver modules report the size of their static buffers.
+ *
+ * If enabled, every module with large static buffers defines a constant
+ * @c nrf_802154_ram_usage_<module> that holds the number of bytes the buffers take for the current
+ * configuration. The constants can be read from the built image, for example with @c nm or
+ * a debugger, to find out which options to reduce.
  *
- * Configures if energy detected events will be counted in receive mode.
- * When this option is enabled additional interrupts on energy detected events will occur
- * increasing power consumption. The events counter is stored in
- * @ref nrf_802154_stat_counters_t::received_energy_events field and can be retrieved by
- * a call to @ref nrf_802154_stats_get or @ref nrf_802154_stat_counters_get.
  */
-#ifndef NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS
-#define NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS 1
+#ifndef NRF_802154_RAM_USAGE_REPORT_ENABLED
+#define NRF_802154_RAM_USAGE_REPORT_ENABLED 0
 #endif
 
 /**
- * @def NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES
+ * @def NRF_802154_RAM_USAGE_MODULE_LIMIT
+ *
+ * The maximum number of bytes the static buffers of a single driver module can take.
+ *
+ * The build fails if any module takes more. The limit is checked regardless of
+ * @ref NRF_802154_RAM_USAGE_REPORT_ENABLED.
  *
- * Configures if number of received preambles will be counted in receive mode.
- * When this option is enabled additional interrupts on preamble reveived will occur
- * increasing power consumption. The events counter is stored in
- * @ref nrf_802154_stat_counters_t::received_preambles field and can be retrieved by
- * a call to @ref nrf_802154_stats_get or @ref nrf_802154_stat_counters_get.
  */
-#ifndef NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES
-#define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES 1
+#ifndef NRF_802154_RAM_USAGE_MODULE_LIMIT
+#define NRF_802154_RAM_USAGE_MODULE_LIMIT UINT32_MAX
+#endif
+
+/**
+ * @def NRF_802154_LOG_VERBOSITY_DEFAULT
+ *
+ * The default verbosity of the debug log and the binary trace in the driver modules.
+ * Log entries with a higher verbosity are removed at compile time.
+ * Use @c NRF_802154_LOG_VERBOSITY_NONE to remove all entries.
+ *
+ * The verbosity of a module is overridden with the @c NRF_802154_<module>_LOG_VERBOSITY option.
+ */
+#ifndef NRF_802154_LOG_VERBOSITY_DEFAULT
+#define NRF_802154_LOG_VERBOSITY_DEFAULT NRF_802154_LOG_VERBOSITY_LOW
+#endif
+
+/**
+ * @def NRF_802154_APPLICATION_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the application (public API) module.
+ */
+#ifndef NRF_802154_APPLICATION_LOG_VERBOSITY
+#define NRF_802154_APPLICATION_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_CORE_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the core module.
+ */
+#ifndef NRF_802154_CORE_LOG_VERBOSITY
+#define NRF_802154_CORE_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_CRITICAL_SECTION_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the critical section module.
+ */
+#ifndef NRF_802154_CRITICAL_SECTION_LOG_VERBOSITY
+#define NRF_802154_CRITICAL_SECTION_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_TRX_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the trx module.
+ */
+#ifndef NRF_802154_TRX_LOG_VERBOSITY
+#define NRF_802154_TRX_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_TRX_PPI_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the trx PPI or DPPI module.
+ */
+#ifndef NRF_802154_TRX_PPI_LOG_VERBOSITY
+#define NRF_802154_TRX_PPI_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_CSMACA_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the CSMA-CA module.
+ */
+#ifndef NRF_802154_CSMACA_LOG_VERBOSITY
+#define NRF_802154_CSMACA_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the delayed trx module.
+ */
+#ifndef NRF_802154_DELAYED_TRX_LOG_VERBOSITY
+#define NRF_802154_DELAYED_TRX_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_ACK_TIMEOUT_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the ACK timeout module.
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_LOG_VERBOSITY
+#define NRF_802154_ACK_TIMEOUT_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_TSCH_LOG_VERBOSITY
+ *
+ * The verbosity of the debug log and the binary trace in the TSCH slotframe module.
+ */
+#ifndef NRF_802154_TSCH_LOG_VERBOSITY
+#define NRF_802154_TSCH_LOG_VERBOSITY NRF_802154_LOG_VERBOSITY_DEFAULT
+#endif
+
+/**
+ * @def NRF_802154_LOG_RUNTIME_MASK_ENABLED
+ *
+ * Configures if the driver modules check the runtime mask of enabled verbosity levels before
+ * recording a log entry. The mask is set with @ref nrf_802154_debug_log_verbosity_mask_set.
+ * The check is made only for the entries not removed at compile time.
+ */
+#ifndef NRF_802154_LOG_RUNTIME_MASK_ENABLED
+#define NRF_802154_LOG_RUNTIME_MASK_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRACE_ENABLED
+ *
+ * Configures if the debug log macros also write timestamped records to the binary trace buffer.
+ * Each record holds the time of the high precision timer, the ID of the module, the ID of the
+ * event and its parameter. The records are written without disabling interrupts, so the trace
+ * can be used to debug timing in production builds. The buffer is decoded from a RAM dump with
+ * @c tools/event_decoder/decoder.py or @c decoder.html.
+ *
+ * The verbosity of the traced records is the same as of the debug log,
+ * see @ref NRF_802154_LOG_VERBOSITY_DEFAULT.
+ */
+#ifndef NRF_802154_TRACE_ENABLED
+#define NRF_802154_TRACE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRACE_BUFFER_LEN
+ *
+ * The number of records in the binary trace buffer. When the buffer is full, the oldest records
+ * are overwritten. This value must be a power of 2.
+ */
+#ifndef NRF_802154_TRACE_BUFFER_LEN
+#define NRF_802154_TRACE_BUFFER_LEN 256U
+#endif
+
+/**
+ * @def NRF_802154_TRACE_INPUT_ENABLED
+ *
+ * Configures if the inputs of the driver state machine are recorded in the binary trace buffer,
+ * independently of the verbosity of the debug log. A record is written when a RADIO event or
+ * a core callback of the RADIO IRQ handler starts, when a queued request is processed and when
+ * the timeslot priority changes, and another one when its handling is finished. A capture of
+ * a field scenario can then be reduced to its input sequence and the handling cost of each
+ * input with @c tools/event_decoder/decoder.py @c --inputs, and compared against the capture
+ * of a candidate fix with @c --baseline.
+ *
+ * This option requires @ref NRF_802154_TRACE_ENABLED.
+ */
+#ifndef NRF_802154_TRACE_INPUT_ENABLED
+#define NRF_802154_TRACE_INPUT_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_ENABLED
+ *
+ * Configures if the records of the binary trace buffer are streamed to the host. The records are
+ * copied from the trace buffer in @ref nrf_802154_trace_export_process, which is to be called by
+ * the application from a low-priority context, and written by the trace export backend linked
+ * with the driver (@c nrf_802154_trace_export_rtt.c or @c nrf_802154_trace_export_uarte.c).
+ * Records overwritten before they were exported are counted and reported in the stream.
+ *
+ * This option requires @ref NRF_802154_TRACE_ENABLED.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_ENABLED
+#define NRF_802154_TRACE_EXPORT_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_CHUNK_LEN
+ *
+ * The number of records passed to the trace export backend in a single write. Two buffers
+ * of this size are used, so that one is filled while the other one is written.
+ *
+ * @note The UARTE backend with the 8-bit EasyDMA counter (nRF52832) cannot write more than
+ *       31 records at once.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_CHUNK_LEN
+#define NRF_802154_TRACE_EXPORT_CHUNK_LEN 16U
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_RTT_CHANNEL
+ *
+ * The SEGGER RTT up channel used by the RTT backend of the trace export.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_RTT_CHANNEL
+#define NRF_802154_TRACE_EXPORT_RTT_CHANNEL 1U
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_UARTE_INSTANCE
+ *
+ * The UARTE instance used by the UARTE backend of the trace export.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_UARTE_INSTANCE
+#define NRF_802154_TRACE_EXPORT_UARTE_INSTANCE NRF_UARTE0
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_UARTE_IRQN
+ *
+ * The IRQ number of @ref NRF_802154_TRACE_EXPORT_UARTE_INSTANCE.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_UARTE_IRQN
+#define NRF_802154_TRACE_EXPORT_UARTE_IRQN UARTE0_UART0_IRQn
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_UARTE_IRQ_PRIORITY
+ *
+ * The priority of the UARTE interrupt used by the UARTE backend of the trace export.
+ * It should be lower than the priorities of the driver interrupts.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_UARTE_IRQ_PRIORITY
+#define NRF_802154_TRACE_EXPORT_UARTE_IRQ_PRIORITY 7
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_UARTE_TX_PIN
+ *
+ * The pin used as TXD by the UARTE backend of the trace export.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_UARTE_TX_PIN
+#define NRF_802154_TRACE_EXPORT_UARTE_TX_PIN 6
+#endif
+
+/**
+ * @def NRF_802154_TRACE_EXPORT_UARTE_BAUDRATE
+ *
+ * The baud rate used by the UARTE backend of the trace export.
+ */
+#ifndef NRF_802154_TRACE_EXPORT_UARTE_BAUDRATE
+#define NRF_802154_TRACE_EXPORT_UARTE_BAUDRATE NRF_UARTE_BAUDRATE_1000000
 #endif
 
 #ifdef __cplusplus
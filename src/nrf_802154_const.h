@@ -148,6 +148,7 @@
 #define TURNAROUND_TIME              192UL                                        ///< RX-to-TX or TX-to-RX turnaround time (aTurnaroundTime), in microseconds (us).
 #define CCA_TIME                     128UL                                        ///< Time required to perform CCA detection (aCcaTime), in microseconds (us).
 #define UNIT_BACKOFF_PERIOD          (TURNAROUND_TIME + CCA_TIME)                 ///< Number of symbols in the basic time period used by CSMA-CA algorithm (aUnitBackoffPeriod), in (us).
+#define MAX_FRAME_RETRIES_MAX        7                                            ///< Maximum number of retransmissions of a frame that was not acknowledged (macMaxFrameRetries).
 
 #define PHY_US_PER_SYMBOL            16                                           ///< Duration of a single symbol in microseconds (us).
 #define PHY_SYMBOLS_PER_OCTET        2                                            ///< Number of symbols in a single byte (octet).
@@ -35,7 +35,8 @@
  *
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_CORE
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_CORE
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_CORE_LOG_VERBOSITY
 
 #include "nrf_802154_core.h"
 
@@ -45,6 +46,9 @@
 #include <string.h>
 
 #include "nrf_802154.h"
+#include "nrf_802154_capture_ring.h"
+#include "nrf_802154_header_ring.h"
+#include "nrf_802154_rssi_ring.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_critical_section.h"
@@ -57,6 +61,7 @@
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_stats.h"
+#include "nrf_802154_trace.h"
 #include "nrf_802154_utils.h"
 #include "nrf_802154_trx.h"
 #include "nrf_802154_types.h"
@@ -64,9 +69,19 @@
 #include "drivers/nrfx_errors.h"
 #include "hal/nrf_radio.h"
 #include "fem/nrf_fem_protocol_api.h"
+#include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_csl_tx.h"
+#include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_duplicate_filter.h"
+#include "mac_features/nrf_802154_encrypt.h"
+#include "mac_features/nrf_802154_link_metrics.h"
+#include "mac_features/nrf_802154_peer_table.h"
 #include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_indirect_queue.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 #include "mac_features/ack_generator/nrf_802154_ack_generator.h"
 #include "rsch/nrf_802154_rsch.h"
@@ -74,13 +89,21 @@
 #include "timer/nrf_802154_timer_coord.h"
 #include "timer/nrf_802154_timer_sched.h"
 #include "platform/hp_timer/nrf_802154_hp_timer.h"
+#include "platform/lp_timer/nrf_802154_lp_timer.h"
 #include "platform/irq/nrf_802154_irq.h"
 
 #include "nrf_802154_core_hooks.h"
 #include "nrf_802154_sl_ant_div.h"
+#include "nrf_802154_sl_coex.h"
 
+#if NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+/// Delay before first check of received frame: 64 bits is PHY header, MAC Frame Control field,
+/// Sequence Number, destination PAN ID and short destination address.
+#define BCC_INIT                    (8 * 8)
+#else
 /// Delay before first check of received frame: 24 bits is PHY header and MAC Frame Control field.
 #define BCC_INIT                    (3 * 8)
+#endif
 
 /// Duration of single iteration of Energy Detection procedure
 #define ED_ITER_DURATION            128U
@@ -108,25 +131,72 @@
 /// Pointer to currently used receive buffer.
 static rx_buffer_t * mp_current_rx_buffer;
 
+/// Pointer to a free receive buffer used when the frame in the current buffer is taken.
+static rx_buffer_t * mp_next_rx_buffer;
+
 #else
 /// If there is only one buffer use const pointer to the receive buffer.
 static rx_buffer_t * const mp_current_rx_buffer = &nrf_802154_rx_buffers[0];
 
 #endif
 
+static nrf_802154_rx_metadata_t m_rx_metadata; ///< Metadata of the last received frame.
+
 static const uint8_t * mp_ack;         ///< Pointer to Ack frame buffer.
 static const uint8_t * mp_tx_data;     ///< Pointer to the data to transmit.
 static uint32_t        m_ed_time_left; ///< Remaining time of the current energy detection procedure [us].
 static uint8_t         m_ed_result;    ///< Result of the current energy detection procedure.
 
+static uint32_t m_ed_sweep_mask;                                  ///< Channels left to scan in the current energy detection sweep, or 0 if no sweep is in progress.
+static uint32_t m_ed_sweep_channels;                              ///< Channels requested in the current energy detection sweep.
+static uint32_t m_ed_sweep_time;                                  ///< Duration of energy detection on each channel of the sweep [us].
+static uint8_t  m_ed_sweep_channel;                               ///< Channel currently scanned by the energy detection sweep.
+static uint8_t  m_ed_sweep_results[NRF_802154_ED_SWEEP_CHANNELS]; ///< Results of the energy detection sweep.
+
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+static uint8_t m_ed_antenna_results[NRF_802154_SL_ANT_DIV_ANTENNA_NONE]; ///< Highest energy detected on each antenna.
+#endif
+
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+static uint32_t               m_ed_ext_sum;       ///< Sum of the energy samples of the current energy detection procedure.
+static uint16_t               m_ed_ext_count;     ///< Number of the energy samples of the current energy detection procedure.
+static uint16_t               m_ed_ext_busy;      ///< Number of the energy samples above the CCA energy threshold.
+static uint8_t                m_ed_ext_threshold; ///< CCA energy threshold of the current energy detection procedure.
+static nrf_802154_ed_result_t m_ed_ext_result;    ///< Extended result of the last energy detection procedure.
+
+#if NRF_802154_ED_RESULT_EXT_SAMPLES > 0
+static uint8_t m_ed_ext_samples[2][NRF_802154_ED_RESULT_EXT_SAMPLES]; ///< Stored energy samples of the current and of the last energy detection procedure.
+static uint8_t m_ed_ext_samples_idx;                                 ///< Index of @ref m_ed_ext_samples filled by the current energy detection procedure.
+#endif
+#endif
+
 static volatile radio_state_t m_state; ///< State of the radio driver.
 
+static nrf_802154_tx_params_t m_tx_params;        ///< Per-frame transmit parameters of the frame pointed by @ref mp_tx_params_frame.
+static const uint8_t        * mp_tx_params_frame; ///< Pointer to the frame to which @ref m_tx_params apply, or NULL.
+
+#if NRF_802154_COEX_PRIORITY_ENABLED
+static bool m_tx_coex_priority_high; ///< If the frame being transmitted is requested from the PTA with the high priority.
+#endif
+
+#if NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US > 0
+static bool     m_ant_div_best_known; ///< If the best antenna is known from a recently received frame.
+static uint32_t m_ant_div_best_time;  ///< Time at which the best antenna was last selected for a received frame.
+#endif
+
 typedef struct
 {
     bool frame_filtered        : 1;                           ///< If frame being received passed filtering operation.
     bool rx_timeslot_requested : 1;                           ///< If timeslot for the frame being received is already requested.
     bool tx_with_cca           : 1;                           ///< If currently transmitted frame is transmitted with cca.
     bool tx_diminished_prio    : 1;                           ///< If priority of the current transmission should be diminished.
+    bool tx_params_applied     : 1;                           ///< If the radio is configured with per-frame transmit parameters.
+    bool rx_duplicate          : 1;                           ///< If frame being acknowledged is a duplicate of the previous one from its sender.
+    bool cca_other_antenna     : 1;                           ///< If standalone CCA is being performed on the antenna other than the configured one.
+    bool light_sleep           : 1;                           ///< If the radio is kept ready in the sleep state.
+    bool lpl                   : 1;                           ///< If low-power listening is active.
+    bool post_tx_rx_window     : 1;                           ///< If the receive window after a transmission is open.
+    bool rx_data_request       : 1;                           ///< If frame being acknowledged is a Data Request handled by the driver.
 } nrf_802154_flags_t;
 
 static nrf_802154_flags_t m_flags;                            ///< Flags used to store the current driver state.
@@ -141,6 +211,55 @@ static nrf_802154_trx_transmit_notifications_t m_trx_transmit_frame_notification
 
 static nrf_802154_timer_t m_rx_prestarted_timer;
 
+#define POST_TX_RX_WINDOW_RETRY_TIME_US 100 ///< Time after which the end of the RX window is retried [us].
+
+static nrf_802154_timer_t m_post_tx_rx_window_timer; ///< Timer closing the RX window after a transmission.
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+#define TX_QUEUE_RESUME_RETRY_TIME_US 100 ///< Time after which the start of the queue is retried [us].
+
+static nrf_802154_timer_t m_tx_queue_resume_timer; ///< Timer starting the queue after a failure.
+#endif
+
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+#define LPL_RETRY_TIME_US 100 ///< Time after which an LPL transition is retried [us].
+
+static nrf_802154_timer_t m_lpl_timer;       ///< Timer of the low-power listening transitions.
+static uint32_t           m_lpl_sample_time; ///< Start time of the last LPL sample.
+#endif
+
+#if NRF_802154_LIGHT_SLEEP_THRESHOLD_US > 0
+#if !NRF_802154_DELAYED_TRX_ENABLED
+#error NRF_802154_LIGHT_SLEEP_THRESHOLD_US requires NRF_802154_DELAYED_TRX_ENABLED.
+#endif
+
+#define LIGHT_SLEEP_RETRY_TIME_US 100 ///< Time after which the end of light sleep is retried [us].
+
+static nrf_802154_timer_t m_light_sleep_timer; ///< Timer ending the light sleep.
+#endif
+
+#if NRF_802154_OCCUPANCY_MONITOR_ENABLED
+static nrf_802154_timer_t m_occupancy_timer; ///< Timer of the RSSI sampling during idle reception.
+#endif
+
+#if NRF_802154_RSSI_STREAM_ENABLED
+static nrf_802154_timer_t m_rssi_stream_timer; ///< Timer of the RSSI streaming.
+#endif
+
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+static uint8_t         m_tx_dsn;        ///< Sequence number to be assigned to the next transmitted frame.
+static const uint8_t * mp_tx_dsn_frame; ///< Frame that the last sequence number was assigned to.
+#endif
+
+#if NRF_802154_PASSIVE_ED_ENABLED
+static nrf_802154_timer_t m_passive_ed_timer;   ///< Timer of the passive energy detection sampling.
+static volatile bool      m_passive_ed_active;  ///< If the passive energy detection is in progress.
+static uint32_t           m_passive_ed_start;   ///< Start time of the passive energy detection [us].
+static uint32_t           m_passive_ed_time;    ///< Duration of the passive energy detection [us].
+static int8_t             m_passive_ed_max;     ///< Highest RSSI sampled by the passive energy detection.
+static bool               m_passive_ed_sampled; ///< If any RSSI sample was taken.
+#endif
+
 /** @brief Value of Coex TX Request mode */
 static nrf_802154_coex_tx_request_mode_t m_coex_tx_request_mode;
 
@@ -155,6 +274,8 @@ static nrf_802154_coex_tx_request_mode_t m_coex_tx_request_mode;
 
 #if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
 static uint32_t m_listening_start_hp_timestamp;
+static int8_t   m_tx_power_dbm;        ///< Transmit power of the current transmission in dBm.
+static uint64_t m_timeslot_start_time; ///< LP timer time at which the timeslot was granted.
 
 #endif
 
@@ -169,12 +290,67 @@ static void request_preconditions_for_state(radio_state_t state)
     nrf_802154_rsch_crit_sect_prio_request(min_required_rsch_prio(state));
 }
 
+#if NRF_802154_COEX_PRIORITY_ENABLED
+/** Select the priority signalled to the PTA for the operation that is started next. */
+static void coex_priority_set(bool high)
+{
+    nrf_802154_wifi_coex_priority_set(high ? NRF_802154_WIFI_COEX_PRIORITY_HIGH :
+                                      NRF_802154_WIFI_COEX_PRIORITY_NORMAL);
+}
+
+#endif
+
+/** Restore the radio configuration from PIB if it was changed by per-frame transmit parameters.
+ *
+ * The radio is configured by this function, so it is to be called only when the timeslot is
+ * granted, right before the radio operation is started.
+ */
+static void tx_params_restore(void)
+{
+    if (m_flags.tx_params_applied)
+    {
+        nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+        nrf_802154_trx_cca_configuration_update();
+
+        m_flags.tx_params_applied = false;
+    }
+}
+
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+/** Get the channel the radio is currently configured to. */
+static uint8_t stat_channel_get(void)
+{
+    if (m_ed_sweep_mask != 0U)
+    {
+        return m_ed_sweep_channel;
+    }
+
+    if (m_flags.tx_params_applied && ((m_tx_params.flags & NRF_802154_TX_PARAM_CHANNEL) != 0U))
+    {
+        return m_tx_params.channel;
+    }
+
+    return nrf_802154_pib_channel_get();
+}
+
+#endif // NRF_802154_STATS_PER_CHANNEL_ENABLED
+
 /** Set driver state.
  *
  * @param[in]  state  Driver state to set.
  */
 static void state_set(radio_state_t state)
 {
+    if ((state != RADIO_STATE_SLEEP) && (state != RADIO_STATE_FALLING_ASLEEP))
+    {
+        m_flags.light_sleep = false;
+    }
+
+    if ((state != RADIO_STATE_RX) && (state != RADIO_STATE_TX_ACK))
+    {
+        m_flags.post_tx_rx_window = false;
+    }
+
     m_state = state;
 
     nrf_802154_log_local_event(NRF_802154_LOG_VERBOSITY_LOW,
@@ -188,6 +364,8 @@ static void rx_flags_clear(void)
 {
     m_flags.frame_filtered        = false;
     m_flags.rx_timeslot_requested = false;
+    m_flags.rx_duplicate          = false;
+    m_flags.rx_data_request       = false;
 }
 
 /** Wait for the RSSI measurement. */
@@ -265,13 +443,204 @@ static uint32_t timer_coord_timestamp_get(void)
     return timestamp;
 }
 
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+static bool     m_frame_ts_sync_valid;   ///< If the cached timer synchronization pair is valid.
+static uint32_t m_frame_ts_sync_hp_time; ///< HP timer time of the cached synchronization.
+static uint32_t m_frame_ts_sync_lp_time; ///< LP timer time of the cached synchronization.
+
+/** Invalidate the synchronization pair cached by @ref frame_end_timestamp_get. */
+static void frame_end_timestamp_sync_invalidate(void)
+{
+    m_frame_ts_sync_valid = false;
+}
+
+/** Cache the last synchronization of the HP timer with the LP timer, if there is a new one. */
+static void frame_ts_sync_update(void)
+{
+    uint32_t hp_sync_time;
+
+    if (nrf_802154_hp_timer_sync_time_get(&hp_sync_time))
+    {
+        m_frame_ts_sync_hp_time = hp_sync_time;
+        m_frame_ts_sync_lp_time = nrf_802154_lp_timer_sync_time_get();
+        m_frame_ts_sync_valid   = true;
+    }
+}
+
+/**
+ * @brief Get the current time in the time base of the Timer Scheduler with the resolution of
+ *        the HP timer.
+ *
+ * @returns Current time [us]. If the timers are not synchronized, the time of the Timer
+ *          Scheduler is returned, which has the resolution of the LP timer.
+ */
+static uint32_t precise_time_get(void)
+{
+    frame_ts_sync_update();
+
+    if (!m_frame_ts_sync_valid)
+    {
+        return nrf_802154_timer_sched_time_get();
+    }
+
+    return m_frame_ts_sync_lp_time +
+           (nrf_802154_hp_timer_current_time_get() - m_frame_ts_sync_hp_time);
+}
+
+#endif
+
+/**
+ * @brief Get HP timer time of the end of the last received frame.
+ *
+ * @returns Time [us] of the HP timer at which the last frame ended.
+ */
+static inline uint32_t frame_end_hp_timestamp_get(void)
+{
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+    return nrf_802154_hp_timer_frame_timestamp_get();
+#else
+    return nrf_802154_hp_timer_timestamp_get();
+#endif
+}
+
+/**
+ * @brief Get timestamp of the end of the last received frame.
+ *
+ * With @ref NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED the END event is captured by the HP timer
+ * through a PPI connected permanently, which is converted here to the LP timer time base using
+ * the last synchronization of the timers. Otherwise the timestamp made by timer coordinator
+ * is returned.
+ *
+ * @returns Timestamp [us] of the end of the last received frame or
+ *          @ref NRF_802154_NO_TIMESTAMP if the timestamp is inaccurate.
+ */
+static uint32_t frame_end_timestamp_get(void)
+{
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+    uint32_t timestamp;
+
+    frame_ts_sync_update();
+
+    if (!m_frame_ts_sync_valid)
+    {
+        return NRF_802154_NO_TIMESTAMP;
+    }
+
+    timestamp = m_frame_ts_sync_lp_time +
+                (nrf_802154_hp_timer_frame_timestamp_get() - m_frame_ts_sync_hp_time);
+
+    if (timestamp == NRF_802154_NO_TIMESTAMP)
+    {
+        timestamp++;
+    }
+
+    return timestamp;
+#else
+    return timer_coord_timestamp_get();
+#endif
+}
+
+#endif
+
+/** Capture metadata of the frame received to the current rx buffer.
+ *
+ * @note This function must be called when the reception of the frame ends, before any other
+ *       frame is received.
+ */
+static void rx_metadata_capture(void)
+{
+    const uint8_t * p_data = mp_current_rx_buffer->data;
+
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+    uint32_t end_timestamp = frame_end_timestamp_get();
+
+    m_rx_metadata.time = (end_timestamp == NRF_802154_NO_TIMESTAMP) ?
+                         NRF_802154_NO_TIMESTAMP :
+                         end_timestamp - nrf_802154_frame_duration_get(p_data[PHR_OFFSET],
+                                                                       false,
+                                                                       true);
+    m_rx_metadata.time64 = nrf_802154_time64_extend(nrf_802154_lp_timer_time64_get(),
+                                                    m_rx_metadata.time);
+#else
+    m_rx_metadata.time   = NRF_802154_NO_TIMESTAMP;
+    m_rx_metadata.time64 = 0;
+#endif
+
+    m_rx_metadata.power   = rssi_last_measurement_get();
+    m_rx_metadata.lqi     = lqi_get(p_data);
+    m_rx_metadata.channel = nrf_802154_pib_channel_get();
+    m_rx_metadata.antenna = nrf_802154_sl_ant_div_last_rx_best_antenna_get();
+    m_rx_metadata.ack_fpb   = false;
+    m_rx_metadata.ack_late  = false;
+    m_rx_metadata.decrypted = false;
+
+    m_rx_metadata.pan_context = m_flags.frame_filtered ? nrf_802154_filter_pan_context_get() :
+                                NRF_802154_PAN_CONTEXT_NONE;
+}
+
+/** Check if the auto ACK procedure is enabled for the PAN context matched by the received frame.
+ *
+ * @note This function must be called after @ref rx_metadata_capture.
+ */
+static bool auto_ack_is_enabled(void)
+{
+#if NRF_802154_PAN_CONTEXTS > 1
+    const nrf_802154_pan_context_t * p_context =
+        nrf_802154_pib_pan_context_get(m_rx_metadata.pan_context);
+
+    if (p_context != NULL)
+    {
+        return p_context->auto_ack;
+    }
+#endif
+
+    return nrf_802154_pib_auto_ack_get();
+}
+
+/** Get the time at which the PHR of the ACK to the frame in the current rx buffer is transmitted.
+ *
+ * @note This function must be called after @ref rx_metadata_capture.
+ */
+static uint32_t ack_phr_time_get(void)
+{
+    const uint8_t * p_data = mp_current_rx_buffer->data;
+
+    if (m_rx_metadata.time == NRF_802154_NO_TIMESTAMP)
+    {
+        return NRF_802154_NO_TIMESTAMP;
+    }
+
+    return m_rx_metadata.time +
+           nrf_802154_frame_duration_get(p_data[PHR_OFFSET], false, true) +
+           ACK_IFS +
+           nrf_802154_frame_duration_get(0, true, false);
+}
+
+#if NRF_802154_CSL_TX_ENABLED
+/** Update the CSL transmitter with the CSL IE of the frame in the current rx buffer.
+ *
+ * @note This function must be called after @ref rx_metadata_capture.
+ */
+static void csl_tx_frame_received(const uint8_t * p_data)
+{
+    if (m_rx_metadata.time != NRF_802154_NO_TIMESTAMP)
+    {
+        nrf_802154_csl_tx_frame_received(p_data, m_rx_metadata.time64);
+    }
+}
+
 #endif
 
 static void received_frame_notify(uint8_t * p_data)
 {
-    nrf_802154_notify_received(p_data,                      // data
-                               rssi_last_measurement_get(), // rssi
-                               lqi_get(p_data));            // lqi
+#if NRF_802154_PEER_TABLE_ENABLED
+    nrf_802154_peer_table_frame_received(p_data, &m_rx_metadata);
+#endif
+#if NRF_802154_CSL_TX_ENABLED
+    csl_tx_frame_received(p_data);
+#endif
+
+    nrf_802154_notify_received(p_data, &m_rx_metadata);
 }
 
 /** Allow nesting critical sections and notify MAC layer that a frame was received. */
@@ -294,6 +663,33 @@ static void receive_failed_notify(nrf_802154_rx_error_t error)
     nrf_802154_critical_section_nesting_deny();
 }
 
+/**
+ * @brief Check if the MAC layer is to be notified about a frame rejected by the filter.
+ *
+ * ACK frames and frames dropped on purpose by the source address or frame type filters
+ * are not notified.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the rejected frame.
+ * @param[in]  error   Result of filtering of the frame.
+ */
+static bool filter_error_is_notified(const uint8_t * p_data, nrf_802154_rx_error_t error)
+{
+    if ((p_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) == FRAME_TYPE_ACK)
+    {
+        return false;
+    }
+
+    switch (error)
+    {
+        case NRF_802154_RX_ERROR_SRC_ADDR_FILTERED:
+        case NRF_802154_RX_ERROR_FRAME_TYPE_FILTERED:
+            return false;
+
+        default:
+            return true;
+    }
+}
+
 /** Notify MAC layer that transmission of requested frame has started. */
 static void transmit_started_notify(void)
 {
@@ -317,14 +713,84 @@ static void receive_started_notify(void)
 
 #endif
 
-/** Notify MAC layer that a frame was transmitted. */
-static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
+/** Forget per-frame transmit parameters of the given frame once its transmission has ended. */
+static void tx_params_release(const uint8_t * p_frame)
 {
-    const uint8_t * p_frame = mp_tx_data;
+    if (p_frame == mp_tx_params_frame)
+    {
+        mp_tx_params_frame = NULL;
+    }
+}
+
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+/** Write the next sequence number to the given frame, unless it is a retransmission.
+ *
+ * The frame keeps its sequence number until its result is notified to the higher layer, so
+ * retransmissions and CCA retries by the core hooks use the same number.
+ */
+static void tx_dsn_assign(const uint8_t * p_data)
+{
+    if ((p_data == mp_tx_dsn_frame) || nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_data))
+    {
+        return;
+    }
+
+    // The frame buffer is owned by the driver until the transmission ends.
+    ((uint8_t *)p_data)[DSN_OFFSET] = m_tx_dsn++;
+    mp_tx_dsn_frame                 = p_data;
+}
+
+/** Forget the frame the sequence number was assigned to once its result is notified. */
+static void tx_dsn_release(const uint8_t * p_frame)
+{
+    if (p_frame == mp_tx_dsn_frame)
+    {
+        mp_tx_dsn_frame = NULL;
+    }
+}
+
+#endif // NRF_802154_TX_DSN_ASSIGN_ENABLED
+
+/** Notify core hooks that the current frame was transmitted. */
+static void transmitted_frame_hooks_notify(void)
+{
+    tx_params_release(mp_tx_data);
+
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+    tx_dsn_release(mp_tx_data);
+#endif
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    nrf_802154_encrypt_tx_ended(mp_tx_data);
+#endif
+
+    nrf_802154_critical_section_nesting_allow();
+
+    nrf_802154_core_hooks_transmitted(mp_tx_data);
+
+    nrf_802154_critical_section_nesting_deny();
+}
+
+/** Notify MAC layer that a frame was transmitted.
+ *
+ * @note Core hooks must be notified with @ref transmitted_frame_hooks_notify before.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ * @param[in]  p_ack    Pointer to a buffer that contains PHR and PSDU of the received ACK or NULL.
+ * @param[in]  power    RSSI of the received ACK or 0.
+ * @param[in]  lqi      LQI of the received ACK or 0.
+ */
+static void transmitted_frame_notify(const uint8_t * p_frame,
+                                     uint8_t       * p_ack,
+                                     int8_t          power,
+                                     uint8_t         lqi)
+{
+#if NRF_802154_PEER_TABLE_ENABLED
+    nrf_802154_peer_table_frame_transmitted(p_frame, p_ack, power, lqi);
+#endif
 
     nrf_802154_critical_section_nesting_allow();
 
-    nrf_802154_core_hooks_transmitted(p_frame);
     nrf_802154_notify_transmitted(p_frame, p_ack, power, lqi);
 
     nrf_802154_critical_section_nesting_deny();
@@ -335,8 +801,26 @@ static void transmit_failed_notify(nrf_802154_tx_error_t error)
 {
     const uint8_t * p_frame = mp_tx_data;
 
+    tx_params_release(p_frame);
+
+#if NRF_802154_PEER_TABLE_ENABLED
+    if (error == NRF_802154_TX_ERROR_NO_ACK)
+    {
+        // Each attempt is counted, also the ones retransmitted by the core hooks.
+        nrf_802154_peer_table_frame_transmitted(p_frame, NULL, 0, 0);
+    }
+#endif
+
     if (nrf_802154_core_hooks_tx_failed(p_frame, error))
     {
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+        tx_dsn_release(p_frame);
+#endif
+
+#if NRF_802154_ENCRYPTION_ENABLED
+        nrf_802154_encrypt_tx_ended(p_frame);
+#endif
+
         nrf_802154_notify_transmit_failed(p_frame, error);
     }
 }
@@ -361,6 +845,16 @@ static void energy_detected_notify(uint8_t result)
     nrf_802154_critical_section_nesting_deny();
 }
 
+/** Notify MAC layer that energy detection sweep ended. */
+static void energy_sweep_done_notify(void)
+{
+    nrf_802154_critical_section_nesting_allow();
+
+    nrf_802154_notify_energy_detection_sweep_done(m_ed_sweep_channels, m_ed_sweep_results);
+
+    nrf_802154_critical_section_nesting_deny();
+}
+
 /** Notify MAC layer that CCA procedure ended. */
 static void cca_notify(bool result)
 {
@@ -387,6 +881,38 @@ static bool antenna_diversity_is_enabled(void)
             nrf_802154_sl_ant_div_cfg_mode_get(NRF_802154_SL_ANT_DIV_OP_RX));
 }
 
+#if NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US > 0
+
+#if NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US > UINT8_MAX
+#error NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US is too big.
+#endif
+
+/** Remember the antenna selected for a received frame as the best one. */
+static void ant_div_best_antenna_update(uint8_t antenna)
+{
+    if (antenna != NRF_802154_SL_ANT_DIV_ANTENNA_NONE)
+    {
+        m_ant_div_best_known = true;
+        m_ant_div_best_time  = nrf_802154_timer_sched_time_get();
+    }
+}
+
+/** Select the time between antenna switches depending on whether the best antenna is known. */
+static void ant_div_toggle_time_update(void)
+{
+    if (m_ant_div_best_known &&
+        ((nrf_802154_timer_sched_time_get() - m_ant_div_best_time) >=
+         NRF_802154_ANT_DIV_BEST_ANTENNA_VALID_US))
+    {
+        m_ant_div_best_known = false;
+    }
+
+    nrf_802154_sl_ant_div_toggle_time_override_set(
+        m_ant_div_best_known ? NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US : 0U);
+}
+
+#endif // NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US > 0
+
 /***************************************************************************************************
  * @section RX buffer management
  **************************************************************************************************/
@@ -411,7 +937,7 @@ static void rx_buffer_in_use_set(rx_buffer_t * p_rx_buffer)
  */
 static bool rx_buffer_is_available(void)
 {
-    return (mp_current_rx_buffer != NULL) && (mp_current_rx_buffer->free);
+    return (mp_current_rx_buffer != NULL) && nrf_802154_rx_buffer_is_free(mp_current_rx_buffer);
 }
 
 /** Get pointer to available rx buffer.
@@ -423,18 +949,71 @@ static uint8_t * rx_buffer_get(void)
     return rx_buffer_is_available() ? mp_current_rx_buffer->data : NULL;
 }
 
-/***************************************************************************************************
- * @section ACK transmission management
- **************************************************************************************************/
-
-/** Check if ACK is requested in given frame.
- *
- * @param[in]  p_frame  Pointer to a frame to check.
+/** Select the free rx buffer to be used when the frame in the current rx buffer is taken.
  *
- * @retval  true   ACK is requested in given frame.
- * @retval  false  ACK is not requested in given frame.
+ * The search is done while the receiver is already armed, so that re-arming the receiver after
+ * a frame is received does not wait for the buffer allocator.
  */
-static bool ack_is_requested(const uint8_t * p_frame)
+static void rx_buffer_next_prepare(void)
+{
+#if NRF_802154_RX_BUFFERS > 1
+    if ((mp_next_rx_buffer == NULL) || (mp_next_rx_buffer == mp_current_rx_buffer) ||
+        !nrf_802154_rx_buffer_is_free(mp_next_rx_buffer))
+    {
+        mp_next_rx_buffer = nrf_802154_rx_buffer_free_find_except(mp_current_rx_buffer);
+    }
+#endif
+}
+
+/** Take the frame received to the current rx buffer to pass it to the higher layer.
+ *
+ * If the frame fits in a small rx buffer, it is moved there and the current rx buffer stays free
+ * for the next reception. Otherwise the current rx buffer is marked as containing a frame and
+ * the buffer selected by @ref rx_buffer_next_prepare becomes the current rx buffer.
+ *
+ * @note This function must be called before the receiver is reenabled to the current rx buffer.
+ *
+ * @returns Pointer to the received frame (PHR + PSDU) to be passed to the higher layer.
+ */
+static uint8_t * rx_buffer_frame_take(void)
+{
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+    uint8_t * p_small_data = nrf_802154_rx_buffer_small_move(mp_current_rx_buffer);
+
+    if (p_small_data != NULL)
+    {
+        return p_small_data;
+    }
+#endif
+
+    uint8_t * p_data = mp_current_rx_buffer->data;
+
+    nrf_802154_rx_buffer_claim(mp_current_rx_buffer);
+
+#if NRF_802154_RX_BUFFERS > 1
+    if ((mp_next_rx_buffer != NULL) && nrf_802154_rx_buffer_is_free(mp_next_rx_buffer))
+    {
+        mp_current_rx_buffer = mp_next_rx_buffer;
+    }
+
+    mp_next_rx_buffer = NULL;
+#endif
+
+    return p_data;
+}
+
+/***************************************************************************************************
+ * @section ACK transmission management
+ **************************************************************************************************/
+
+/** Check if ACK is requested in given frame.
+ *
+ * @param[in]  p_frame  Pointer to a frame to check.
+ *
+ * @retval  true   ACK is requested in given frame.
+ * @retval  false  ACK is not requested in given frame.
+ */
+static bool ack_is_requested(const uint8_t * p_frame)
 {
     return nrf_802154_frame_parser_ar_bit_is_set(p_frame);
 }
@@ -485,6 +1064,11 @@ static bool ed_iter_setup(uint32_t * p_requested_ed_time_us, uint32_t * p_next_t
         /* Note that in single phy iters_left_in_timeslot will always be very big thus we will get here. */
         iters_left_in_timeslot -= ED_ITERS_OVERHEAD;
 
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+        // Sample the energy in single iterations to collect each sample in the extended result.
+        iters_left_in_timeslot = 1U;
+#endif
+
         uint32_t requested_iters = *p_requested_ed_time_us / ED_ITER_DURATION;
 
         if (requested_iters < iters_left_in_timeslot)
@@ -507,6 +1091,72 @@ static bool ed_iter_setup(uint32_t * p_requested_ed_time_us, uint32_t * p_next_t
     return false;
 }
 
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+/** Clear the extended result accumulated by the current energy detection procedure. */
+static void ed_ext_reset(void)
+{
+    nrf_802154_cca_cfg_t cca_cfg;
+
+    nrf_802154_pib_cca_cfg_get(&cca_cfg);
+
+    m_ed_ext_sum       = 0U;
+    m_ed_ext_count     = 0U;
+    m_ed_ext_busy      = 0U;
+    m_ed_ext_threshold = cca_cfg.ed_threshold;
+}
+
+/** Add an energy sample gathered from TRX module to the extended result. */
+static void ed_ext_sample_add(uint8_t ed_sample)
+{
+    uint8_t result = ed_result_get(ed_sample);
+
+#if NRF_802154_ED_RESULT_EXT_SAMPLES > 0
+    if (m_ed_ext_count < NRF_802154_ED_RESULT_EXT_SAMPLES)
+    {
+        m_ed_ext_samples[m_ed_ext_samples_idx][m_ed_ext_count] = result;
+    }
+#endif
+
+    if (m_ed_ext_count < UINT16_MAX)
+    {
+        m_ed_ext_sum += result;
+        m_ed_ext_count++;
+
+        if (ed_sample > m_ed_ext_threshold)
+        {
+            m_ed_ext_busy++;
+        }
+    }
+}
+
+/** Store the extended result of the energy detection procedure that has just ended. */
+static void ed_ext_publish(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_ed_ext_result.max          = ed_result_get(m_ed_result);
+    m_ed_ext_result.mean         =
+        (m_ed_ext_count > 0U) ? (uint8_t)(m_ed_ext_sum / m_ed_ext_count) : 0U;
+    m_ed_ext_result.sample_count = m_ed_ext_count;
+    m_ed_ext_result.busy_count   = m_ed_ext_busy;
+
+#if NRF_802154_ED_RESULT_EXT_SAMPLES > 0
+    m_ed_ext_result.p_samples    = m_ed_ext_samples[m_ed_ext_samples_idx];
+    m_ed_ext_result.stored_count = (m_ed_ext_count < NRF_802154_ED_RESULT_EXT_SAMPLES) ?
+                                   m_ed_ext_count : NRF_802154_ED_RESULT_EXT_SAMPLES;
+    m_ed_ext_samples_idx ^= 1U;
+#else
+    m_ed_ext_result.p_samples    = NULL;
+    m_ed_ext_result.stored_count = 0U;
+#endif
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_ED_RESULT_EXT_ENABLED
+
 /***************************************************************************************************
  * @section FSM transition request sub-procedures
  **************************************************************************************************/
@@ -516,7 +1166,7 @@ static rsch_prio_t min_required_rsch_prio(radio_state_t state)
     switch (state)
     {
         case RADIO_STATE_SLEEP:
-            return RSCH_PRIO_IDLE;
+            return m_flags.light_sleep ? RSCH_PRIO_IDLE_LISTENING : RSCH_PRIO_IDLE;
 
         case RADIO_STATE_FALLING_ASLEEP:
         case RADIO_STATE_RX:
@@ -674,8 +1324,7 @@ static void operation_terminated_notify(radio_state_t state, bool receiving_psdu
             break;
 
         case RADIO_STATE_TX_ACK:
-            mp_current_rx_buffer->free = false;
-            received_frame_notify(mp_current_rx_buffer->data);
+            received_frame_notify(rx_buffer_frame_take());
             break;
 
         case RADIO_STATE_CCA_TX:
@@ -776,6 +1425,16 @@ static void trx_disable(void)
 #endif
 }
 
+/** End the low-power listening mode and cancel its pending transition. */
+static void lpl_stop(void)
+{
+    m_flags.lpl = false;
+
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+    nrf_802154_timer_sched_remove(&m_lpl_timer, NULL);
+#endif
+}
+
 /** Terminate ongoing operation.
  *
  * This function is called when MAC layer requests transition to another operation.
@@ -830,12 +1489,24 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
             if (m_state == RADIO_STATE_ED)
             {
                 nrf_802154_sl_ant_div_energy_detection_aborted_notify();
+
+                if (m_ed_sweep_channels != 0U)
+                {
+                    /* Energy detection sweep changed the channel. Restore it from PIB. */
+                    m_ed_sweep_mask     = 0U;
+                    m_ed_sweep_channels = 0U;
+                    nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+                }
             }
 
-            if (notify)
+            // Samples of the low-power listening are not visible to the higher layer.
+            if (notify && !(m_flags.lpl && (m_state == RADIO_STATE_ED)))
             {
                 operation_terminated_notify(m_state, receiving_psdu_now);
             }
+
+            // Any requested operation ends the low-power listening mode.
+            lpl_stop();
         }
 
     }
@@ -849,6 +1520,63 @@ static void sleep_init(void)
     nrf_802154_timer_coord_stop();
 }
 
+#if NRF_802154_LIGHT_SLEEP_THRESHOLD_US > 0
+
+/** Release the radio if the driver still sleeps with the radio kept ready. */
+static void on_light_sleep_timeout(void * p_context)
+{
+    (void)p_context;
+
+    if (nrf_802154_critical_section_enter())
+    {
+        if (m_flags.light_sleep)
+        {
+            m_flags.light_sleep = false;
+
+            if (m_state == RADIO_STATE_SLEEP)
+            {
+                request_preconditions_for_state(m_state);
+            }
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+    else
+    {
+        // The radio must not be kept ready indefinitely.
+        m_light_sleep_timer.t0 = nrf_802154_timer_sched_time_get();
+        m_light_sleep_timer.dt = LIGHT_SLEEP_RETRY_TIME_US;
+
+        nrf_802154_timer_sched_add(&m_light_sleep_timer, false);
+    }
+}
+
+#endif // NRF_802154_LIGHT_SLEEP_THRESHOLD_US > 0
+
+/** Select if the sleep state being entered keeps the radio ready for the next delayed operation. */
+static void sleep_mode_select(void)
+{
+#if NRF_802154_LIGHT_SLEEP_THRESHOLD_US > 0
+    uint32_t now = nrf_802154_timer_sched_time_get();
+    uint32_t op_time;
+
+    m_flags.light_sleep = nrf_802154_delayed_trx_nearest_op_time_get(&op_time) &&
+                          ((uint32_t)(op_time - now) < NRF_802154_LIGHT_SLEEP_THRESHOLD_US);
+
+    if (m_flags.light_sleep)
+    {
+        nrf_802154_timer_sched_remove(&m_light_sleep_timer, NULL);
+
+        m_light_sleep_timer.t0        = now;
+        m_light_sleep_timer.dt        = NRF_802154_LIGHT_SLEEP_THRESHOLD_US;
+        m_light_sleep_timer.callback  = on_light_sleep_timeout;
+        m_light_sleep_timer.p_context = NULL;
+
+        nrf_802154_timer_sched_add(&m_light_sleep_timer, false);
+    }
+#endif
+}
+
 /** Initialize Falling Asleep operation. */
 static void falling_asleep_init(void)
 {
@@ -939,159 +1667,193 @@ static nrf_802154_trx_transmit_notifications_t make_trx_frame_transmit_notificat
     return result;
 }
 
-/** Initialize RX operation. */
-static void rx_init(void)
+#if NRF_802154_OCCUPANCY_MONITOR_ENABLED
+
+/** Sample the power on the channel if no frame is being received. */
+static void on_occupancy_timeout(void * p_context)
 {
-    bool free_buffer;
+    (void)p_context;
 
-    if (!timeslot_is_granted())
+    if (nrf_802154_critical_section_enter())
     {
-        return;
-    }
+        if ((m_state == RADIO_STATE_RX) &&
+            timeslot_is_granted() &&
+            !nrf_802154_trx_psdu_is_being_received() &&
+            nrf_802154_trx_rssi_measure())
+        {
+            rssi_measurement_wait();
+            nrf_802154_stat_occupancy_sample_add(nrf_802154_pib_channel_get(),
+                                                 rssi_last_measurement_get());
+        }
 
-    if (!are_preconditions_met())
-    {
-        return;
+        nrf_802154_critical_section_exit();
     }
 
-    // Clear filtering flag
-    rx_flags_clear();
-
-    // Find available RX buffer
-    free_buffer = rx_buffer_is_available();
-
-    nrf_802154_trx_receive_buffer_set(rx_buffer_get());
-
-    nrf_802154_trx_receive_frame(BCC_INIT / 8U, m_trx_receive_frame_notifications_mask);
-
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-    m_listening_start_hp_timestamp = nrf_802154_hp_timer_current_time_get();
-#endif
-
-#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-    // Configure the timer coordinator to get a timestamp of the END event which
-    // fires several cycles after CRCOK or CRCERROR events.
-    nrf_802154_timer_coord_timestamp_prepare(
-        nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_END));
-#else
-    // Configure the timer coordinator to get a timestamp of the CRCOK event.
-    nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
-                                                                         NRF_RADIO_EVENT_CRCOK));
-#endif
-#endif
-
-    // Find RX buffer if none available
-    if (!free_buffer)
+    // The sampling is restarted by rx_init() when the driver enters the receive state again.
+    if (m_state == RADIO_STATE_RX)
     {
-        rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+        m_occupancy_timer.t0 += m_occupancy_timer.dt;
 
-        nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+        nrf_802154_timer_sched_add(&m_occupancy_timer, false);
     }
 }
 
-/** Initialize TX operation. */
-static bool tx_init(const uint8_t * p_data, bool cca)
+/** Start periodic sampling of the power on the channel if it is not running yet. */
+static void occupancy_monitor_start(void)
 {
-    if (!timeslot_is_granted() || !nrf_802154_rsch_timeslot_request(
-            nrf_802154_tx_duration_get(p_data[0], cca, ack_is_requested(p_data))))
+    if (nrf_802154_timer_sched_is_running(&m_occupancy_timer))
     {
-        return false;
+        return;
     }
 
-    if (!are_preconditions_met())
-    {
-        return false;
-    }
+    m_occupancy_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_occupancy_timer.dt        = NRF_802154_OCCUPANCY_MONITOR_PERIOD_US;
+    m_occupancy_timer.callback  = on_occupancy_timeout;
+    m_occupancy_timer.p_context = NULL;
 
-#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-    if (cca)
-    {
-        // Configure the timer coordinator to get a time stamp of the READY event.
-        // Note: This event triggers CCASTART, so the time stamp of READY event
-        // is the time stamp when CCA started.
-        nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
-                                                                             NRF_RADIO_EVENT_READY));
-    }
-    else
-    {
-        // Configure the timer coordinator to get a time stamp of the PHYEND event.
-        nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
-                                                                             NRF_RADIO_EVENT_PHYEND));
-    }
-#endif
+    nrf_802154_timer_sched_add(&m_occupancy_timer, false);
+}
 
-    m_flags.tx_with_cca = cca;
-    nrf_802154_trx_transmit_frame(p_data,
-                                  cca,
-                                  m_trx_transmit_frame_notifications_mask);
+#endif // NRF_802154_OCCUPANCY_MONITOR_ENABLED
 
-    return true;
-}
+#if NRF_802154_RSSI_STREAM_ENABLED
 
-/** Initialize ED operation */
-static void ed_init(void)
+/** Stream an RSSI sample if no frame is being received. */
+static void on_rssi_stream_timeout(void * p_context)
 {
-    if (!timeslot_is_granted())
+    (void)p_context;
+
+    if (!nrf_802154_rssi_ring_is_enabled())
     {
         return;
     }
 
-    if (!are_preconditions_met())
+    if (nrf_802154_critical_section_enter())
     {
-        return;
+        if ((m_state == RADIO_STATE_RX) &&
+            timeslot_is_granted() &&
+            !nrf_802154_trx_psdu_is_being_received() &&
+            nrf_802154_trx_rssi_measure())
+        {
+            rssi_measurement_wait();
+            nrf_802154_rssi_ring_sample_write(nrf_802154_timer_sched_time_get(),
+                                              rssi_last_measurement_get(),
+                                              nrf_802154_pib_channel_get());
+        }
+
+        nrf_802154_critical_section_exit();
     }
 
-    uint32_t trx_ed_count = 0U;
+    // The streaming is restarted by rx_init() when the driver enters the receive state again.
+    if (m_state == RADIO_STATE_RX)
+    {
+        m_rssi_stream_timer.t0 += m_rssi_stream_timer.dt;
 
-    // Notify antenna diversity about energy detection request. Antenna diversity state
-    // will be updated, and m_ed_time_left reduced accordingly.
-    nrf_802154_sl_ant_div_energy_detection_requested_notify(&m_ed_time_left);
+        nrf_802154_timer_sched_add(&m_rssi_stream_timer, false);
+    }
+}
 
-    if (!ed_iter_setup(&m_ed_time_left, &trx_ed_count))
+/** Start periodic RSSI streaming if it is enabled and not running yet. */
+static void rssi_stream_start(void)
+{
+    if (!nrf_802154_rssi_ring_is_enabled() ||
+        nrf_802154_timer_sched_is_running(&m_rssi_stream_timer))
     {
-        // Just wait for next timeslot if there is not enough time in this one.
         return;
     }
 
-    nrf_802154_trx_energy_detection(trx_ed_count);
+    m_rssi_stream_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_rssi_stream_timer.dt        = nrf_802154_rssi_ring_interval_get();
+    m_rssi_stream_timer.callback  = on_rssi_stream_timeout;
+    m_rssi_stream_timer.p_context = NULL;
+
+    nrf_802154_timer_sched_add(&m_rssi_stream_timer, false);
 }
 
-/** Initialize CCA operation. */
-static void cca_init(void)
+#endif // NRF_802154_RSSI_STREAM_ENABLED
+
+#if NRF_802154_PASSIVE_ED_ENABLED
+
+/** Convert RSSI in dBm to the format of the energy detection result. */
+static uint8_t passive_ed_result_get(int8_t rssi)
 {
-    if (!timeslot_is_granted() || !nrf_802154_rsch_timeslot_request(nrf_802154_cca_duration_get()))
+    int32_t result = ((int32_t)rssi - ED_MIN_DBM) * ED_RESULT_FACTOR;
+
+    if (result < 0)
     {
-        return;
+        result = 0;
     }
-
-    if (!are_preconditions_met())
+    else if (result > ED_RESULT_MAX)
     {
-        return;
+        result = ED_RESULT_MAX;
     }
 
-    nrf_802154_trx_standalone_cca();
+    return (uint8_t)result;
 }
 
-/** Initialize Continuous Carrier operation. */
-static void continuous_carrier_init(void)
+/** Sample the RSSI for the passive energy detection and notify the result when it ends. */
+static void on_passive_ed_timeout(void * p_context)
 {
-    if (!timeslot_is_granted())
+    (void)p_context;
+
+    if (!nrf_802154_critical_section_enter())
     {
+        // Try again with the next sample.
+        m_passive_ed_timer.t0 += m_passive_ed_timer.dt;
+        nrf_802154_timer_sched_add(&m_passive_ed_timer, false);
         return;
     }
 
-    if (!are_preconditions_met())
+    // The sample is skipped if a frame is being received, so that the frame is not lost.
+    if ((m_state == RADIO_STATE_RX) &&
+        timeslot_is_granted() &&
+        !nrf_802154_trx_psdu_is_being_received() &&
+        nrf_802154_trx_rssi_measure())
     {
-        return;
+        rssi_measurement_wait();
+
+        int8_t rssi = rssi_last_measurement_get();
+
+        if (!m_passive_ed_sampled || (rssi > m_passive_ed_max))
+        {
+            m_passive_ed_max = rssi;
+        }
+
+        m_passive_ed_sampled = true;
     }
 
-    nrf_802154_trx_continuous_carrier();
+    if (nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(),
+                                                 m_passive_ed_start,
+                                                 m_passive_ed_time))
+    {
+        m_passive_ed_timer.t0 += m_passive_ed_timer.dt;
+        nrf_802154_timer_sched_add(&m_passive_ed_timer, false);
+    }
+    else
+    {
+        m_passive_ed_active = false;
+
+        if (m_passive_ed_sampled)
+        {
+            nrf_802154_notify_energy_detected(passive_ed_result_get(m_passive_ed_max));
+        }
+        else
+        {
+            // The radio was busy with frames or other operations for the whole procedure.
+            nrf_802154_notify_energy_detection_failed(NRF_802154_ED_ERROR_ABORTED);
+        }
+    }
+
+    nrf_802154_critical_section_exit();
 }
 
-/** Initialize Modulated Carrier operation. */
-static void modulated_carrier_init(const uint8_t * p_data)
+#endif // NRF_802154_PASSIVE_ED_ENABLED
+
+/** Initialize RX operation. */
+static void rx_init(void)
 {
+    bool free_buffer;
+
     if (!timeslot_is_granted())
     {
         return;
@@ -1102,1291 +1864,3152 @@ static void modulated_carrier_init(const uint8_t * p_data)
         return;
     }
 
-    nrf_802154_trx_modulated_carrier((const void *)p_data);
+    // Clear filtering flag
+    rx_flags_clear();
+
+#if NRF_802154_COEX_PRIORITY_ENABLED
+    coex_priority_set(false);
+#endif
+
+#if NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US > 0
+    if (antenna_diversity_is_enabled())
+    {
+        ant_div_toggle_time_update();
+    }
+#endif
+
+    tx_params_restore();
+
+    // Re-apply the CCA configuration between frames if the temperature changed and the request
+    // issued by nrf_802154_temperature_changed() could not be processed.
+    if (nrf_802154_trx_cca_configuration_is_outdated())
+    {
+        nrf_802154_trx_cca_configuration_update();
+    }
+
+    // Find available RX buffer
+    free_buffer = rx_buffer_is_available();
+
+    nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+
+    nrf_802154_trx_receive_frame(BCC_INIT / 8U, m_trx_receive_frame_notifications_mask);
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    m_listening_start_hp_timestamp = nrf_802154_hp_timer_current_time_get();
+    nrf_802154_stat_totals_increment(total_ramp_up_time, RX_RAMP_UP_TIME);
+#endif
+
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED) && !NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+    // Configure the timer coordinator to get a timestamp of the END event which
+    // fires several cycles after CRCOK or CRCERROR events.
+    nrf_802154_timer_coord_timestamp_prepare(
+        nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_END));
+#else
+    // Configure the timer coordinator to get a timestamp of the CRCOK event.
+    nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
+                                                                         NRF_RADIO_EVENT_CRCOK));
+#endif
+#endif
+
+    // Find RX buffer if none available
+    if (!free_buffer)
+    {
+        rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+
+        nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+    }
+
+    rx_buffer_next_prepare();
+
+#if NRF_802154_OCCUPANCY_MONITOR_ENABLED
+    occupancy_monitor_start();
+#endif
+
+#if NRF_802154_RSSI_STREAM_ENABLED
+    rssi_stream_start();
+#endif
 }
 
-/***************************************************************************************************
- * @section Radio Scheduler notification handlers
- **************************************************************************************************/
-static void on_timeslot_ended(void)
+/** Get the transmit power for the destination of the given frame.
+ *
+ * The power set in PIB is lowered by the transmit power reduction learned for the destination.
+ *
+ * @param[in]  p_data   Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ * @param[in]  channel  Channel the frame is transmitted on.
+ *
+ * @returns  Transmit power to use for the frame.
+ */
+static nrf_radio_txpower_t tx_power_for_peer_get(const uint8_t * p_data, uint8_t channel)
 {
-    bool result;
+#if NRF_802154_PEER_TABLE_ENABLED && NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED
+    uint8_t reduction = nrf_802154_peer_table_tx_power_reduction_get(p_data);
 
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    if (reduction != 0U)
+    {
+        return nrf_802154_pib_tx_power_reduced_get(channel, reduction);
+    }
+#else
+    (void)p_data;
+#endif
 
-    if (timeslot_is_granted())
+    return nrf_802154_pib_tx_power_on_channel_get(channel);
+}
+
+/** Configure the radio with per-frame transmit parameters of the given frame.
+ *
+ * If the frame has no parameters, the radio configuration changed by the previous frame is
+ * restored from PIB.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ *
+ * @returns  Transmit power to use for the frame.
+ */
+static nrf_radio_txpower_t tx_params_apply(const uint8_t * p_data)
+{
+    if (p_data != mp_tx_params_frame)
     {
-        m_rsch_timeslot_is_granted = false;
+        tx_params_restore();
+        nrf_802154_trx_tx_fem_bypass_set(false);
 
-        bool receiving_psdu_now = false;
+        return tx_power_for_peer_get(p_data, nrf_802154_pib_channel_get());
+    }
 
-        if (m_state == RADIO_STATE_RX)
+    nrf_802154_tx_params_flags_t flags   = m_tx_params.flags;
+    uint8_t                      channel = nrf_802154_pib_channel_get();
+
+    if ((flags & NRF_802154_TX_PARAM_CHANNEL) != 0U)
+    {
+        channel = m_tx_params.channel;
+    }
+
+    if ((flags & (NRF_802154_TX_PARAM_CHANNEL | NRF_802154_TX_PARAM_CCA_CFG)) != 0U)
+    {
+        nrf_802154_trx_channel_set(channel);
+
+        if ((flags & NRF_802154_TX_PARAM_CCA_CFG) != 0U)
         {
-            receiving_psdu_now = nrf_802154_trx_psdu_is_being_received();
+            nrf_802154_trx_cca_configuration_set(&m_tx_params.cca_cfg);
+        }
+        else
+        {
+            nrf_802154_trx_cca_configuration_update();
         }
 
-        trx_disable();
-
-        nrf_802154_timer_coord_stop();
+        m_flags.tx_params_applied = true;
+    }
+    else
+    {
+        tx_params_restore();
+    }
 
-        nrf_802154_rsch_continuous_ended();
+    bool fem_bypass = (flags & NRF_802154_TX_PARAM_FEM_BYPASS) != 0U;
 
-        result = nrf_802154_core_hooks_terminate(NRF_802154_TERM_802154, REQ_ORIG_RSCH);
-        assert(result);
-        (void)result;
+    nrf_802154_trx_tx_fem_bypass_set(fem_bypass);
 
-        switch (m_state)
-        {
-            case RADIO_STATE_FALLING_ASLEEP:
-                state_set(RADIO_STATE_SLEEP);
-                break;
+    if (fem_bypass)
+    {
+        // The whole transmit power is delivered by the radio.
+        return ((flags & NRF_802154_TX_PARAM_POWER) != 0U) ?
+               nrf_802154_pib_tx_power_fem_bypass_convert(m_tx_params.power) :
+               nrf_802154_pib_tx_power_fem_bypass_get();
+    }
+    else if ((flags & NRF_802154_TX_PARAM_POWER) != 0U)
+    {
+        return nrf_802154_pib_tx_power_convert(channel, m_tx_params.power);
+    }
+    else
+    {
+        // Front-end adjustment of the power depends on the channel.
+        return tx_power_for_peer_get(p_data, channel);
+    }
+}
 
-            case RADIO_STATE_RX:
-                if (receiving_psdu_now)
-                {
-                    receive_failed_notify(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
-                }
+/** Write the SFD timestamp into the frame if requested by its transmit parameters.
+ *
+ * The timestamp is computed from the current time and the known durations of the procedures
+ * preceding the end of the SFD, so this function must be called just before the transmission
+ * is started. With @ref NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED the current time is read from
+ * the HP timer and converted with the last timer synchronization. Otherwise it is read from
+ * the Timer Scheduler, which has the resolution of the LP timer.
+ *
+ * @param[in]  p_data    Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ * @param[in]  cca       If the transmission is preceded by the CCA procedure.
+ * @param[in]  delay_us  Time by which the start of the transmission is delayed, for example
+ *                       until the end of the IFS.
+ */
+static void tx_timestamp_insert(const uint8_t * p_data, bool cca, uint32_t delay_us)
+{
+    if ((p_data != mp_tx_params_frame) ||
+        ((m_tx_params.flags & NRF_802154_TX_PARAM_TIMESTAMP) == 0U))
+    {
+        return;
+    }
 
-                break;
+    uint8_t  offset = m_tx_params.timestamp_offset;
+    uint8_t  width  = m_tx_params.timestamp_width;
+    uint32_t sfd_time;
 
-            case RADIO_STATE_TX_ACK:
-                state_set(RADIO_STATE_RX);
-                mp_current_rx_buffer->free = false;
-                received_frame_notify_and_nesting_allow(mp_current_rx_buffer->data);
-                break;
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+    sfd_time = precise_time_get();
+#else
+    sfd_time = nrf_802154_timer_sched_time_get();
+#endif
 
-            case RADIO_STATE_CCA_TX:
-            case RADIO_STATE_TX:
-            case RADIO_STATE_RX_ACK:
-                state_set(RADIO_STATE_RX);
-                transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_TIMESLOT_ENDED);
-                break;
+    sfd_time += delay_us + TX_RAMP_UP_TIME + PHY_US_TIME_FROM_SYMBOLS(PHY_SHR_SYMBOLS);
 
-            case RADIO_STATE_ED:
-            case RADIO_STATE_CCA:
-            case RADIO_STATE_CONTINUOUS_CARRIER:
-            case RADIO_STATE_MODULATED_CARRIER:
-            case RADIO_STATE_SLEEP:
-                // Intentionally empty.
-                break;
+    if ((width > sizeof(sfd_time)) ||
+        ((offset + width + FCS_SIZE) > p_data[PHR_OFFSET]))
+    {
+        assert(false);
+        return;
+    }
 
-            default:
-                assert(false);
-        }
+    if (cca)
+    {
+        sfd_time += RX_RAMP_UP_TIME + nrf_802154_cca_before_tx_duration_get();
     }
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    // The frame is provided by the higher layer, which requested it to be modified.
+    uint8_t * p_timestamp = (uint8_t *)&p_data[PHR_SIZE + offset];
+
+    for (uint8_t i = 0; i < width; i++)
+    {
+        p_timestamp[i] = (uint8_t)(sfd_time >> (i * 8U));
+    }
 }
 
-static void on_preconditions_denied(radio_state_t state)
+/** Request a timeslot long enough to transmit the given frame.
+ *
+ * If frames wait in the transmit queue, the timeslot is requested for the whole burst first, so
+ * that the queued frames are not denied one by one near the end of a shorter timeslot. If the
+ * whole burst does not fit, the timeslot is requested for the given frame only.
+ */
+static bool tx_timeslot_request(const uint8_t * p_data, bool cca)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    uint32_t frame_time = nrf_802154_tx_duration_get(p_data[0], cca, ack_is_requested(p_data));
 
-    bool result;
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    uint32_t burst_time = nrf_802154_tx_queue_duration_get();
 
-    result = nrf_802154_core_hooks_terminate(NRF_802154_TERM_802154, REQ_ORIG_CORE);
-    assert(result);
-    (void)result;
+    if ((burst_time > 0U) && nrf_802154_rsch_timeslot_request(frame_time + burst_time))
+    {
+        return true;
+    }
+#endif
 
-    bool receiving_psdu_now = false;
+    return nrf_802154_rsch_timeslot_request(frame_time);
+}
 
-    if (state == RADIO_STATE_RX)
+/** Initialize TX operation. */
+static bool tx_init(const uint8_t * p_data, bool cca)
+{
+    if (!timeslot_is_granted() || !tx_timeslot_request(p_data, cca))
     {
-        receiving_psdu_now = nrf_802154_trx_psdu_is_being_received();
+        return false;
     }
 
-    trx_abort();
+    if (!are_preconditions_met())
+    {
+        return false;
+    }
 
-    switch (state)
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+    if (cca)
     {
-        case RADIO_STATE_FALLING_ASLEEP:
-            // There should be on_timeslot_ended event
-            break;
+        // Configure the timer coordinator to get a time stamp of the READY event.
+        // Note: This event triggers CCASTART, so the time stamp of READY event
+        // is the time stamp when CCA started.
+        nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
+                                                                             NRF_RADIO_EVENT_READY));
+    }
+    else
+    {
+        // Configure the timer coordinator to get a time stamp of the PHYEND event.
+        nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
+                                                                             NRF_RADIO_EVENT_PHYEND));
+    }
+#endif
 
-        case RADIO_STATE_RX:
-            if (receiving_psdu_now)
-            {
-                receive_failed_notify(NRF_802154_RX_ERROR_ABORTED);
-            }
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+    // The sequence number is written before the frame is secured, as it is authenticated.
+    tx_dsn_assign(p_data);
+#endif
 
-            break;
+    nrf_radio_txpower_t tx_power   = tx_params_apply(p_data);
+    const uint8_t     * p_tx_frame = p_data;
 
-        case RADIO_STATE_TX_ACK:
-            state_set(RADIO_STATE_RX);
-            break;
+#if NRF_802154_COEX_PRIORITY_ENABLED
+    // The reception of the ACK that follows keeps the priority of the frame.
+    coex_priority_set(m_tx_coex_priority_high);
+#endif
 
-        case RADIO_STATE_CCA_TX:
-            m_flags.tx_diminished_prio = false;
-        // Fallthrough
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    // The TXPOWER register holds the power in dBm as a two's complement value.
+    m_tx_power_dbm = (int8_t)tx_power;
+#endif
 
-        case RADIO_STATE_TX:
-        case RADIO_STATE_RX_ACK:
-            state_set(RADIO_STATE_RX);
-            break;
+#if NRF_802154_PEER_TABLE_ENABLED && NRF_802154_PEER_TABLE_TX_ANTENNA_ENABLED
+    nrf_802154_trx_tx_antenna_select(nrf_802154_peer_table_antenna_get(p_data));
+#else
+    nrf_802154_trx_tx_antenna_select(NRF_802154_SL_ANT_DIV_ANTENNA_NONE);
+#endif
 
-        case RADIO_STATE_ED:
-        case RADIO_STATE_CCA:
-        case RADIO_STATE_CONTINUOUS_CARRIER:
-        case RADIO_STATE_MODULATED_CARRIER:
-        case RADIO_STATE_SLEEP:
-            // Intentionally empty.
-            break;
+    uint32_t tx_delay = 0U;
 
-        default:
-            assert(false);
+#if NRF_802154_IFS_ENABLED && NRF_802154_IFS_HW_TIMED_ENABLED
+    // The frame transmitted at the end of the IFS has its SFD delayed by the remaining IFS.
+    if (!cca)
+    {
+        (void)nrf_802154_ifs_tx_delay_peek(p_data, &tx_delay);
     }
+#endif
 
-    operation_terminated_notify(state, receiving_psdu_now);
+    tx_timestamp_insert(p_data, cca, tx_delay);
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+#if NRF_802154_ENCRYPTION_ENABLED
+    // The frame is secured after the time stamp is inserted, so the time stamp is authenticated.
+    p_tx_frame = nrf_802154_encrypt_tx_frame_get(p_data);
+#endif
+
+    m_flags.tx_with_cca = cca;
+
+#if NRF_802154_IFS_ENABLED && NRF_802154_IFS_HW_TIMED_ENABLED
+    uint32_t ifs_delay;
+
+    if (!cca && nrf_802154_ifs_tx_delay_get(p_data, &ifs_delay))
+    {
+        nrf_802154_trx_transmit_frame_delayed(p_tx_frame, ifs_delay, tx_power);
+
+        return true;
+    }
+#endif
+
+    nrf_802154_trx_transmit_frame(p_tx_frame,
+                                  cca,
+                                  m_trx_transmit_frame_notifications_mask,
+                                  tx_power);
+
+    return true;
 }
 
-static void on_preconditions_approved(radio_state_t state)
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+
+/** Check if the channel is to be assessed on both antennas. */
+static bool dual_assessment_is_enabled(void)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    return nrf_802154_sl_ant_div_cfg_mode_get(NRF_802154_SL_ANT_DIV_OP_TX) ==
+           NRF_802154_SL_ANT_DIV_MODE_MANUAL;
+}
+
+/** Get the antenna other than the given one. */
+static nrf_802154_sl_ant_div_antenna_t other_antenna_get(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    return (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_1) ?
+           NRF_802154_SL_ANT_DIV_ANTENNA_2 : NRF_802154_SL_ANT_DIV_ANTENNA_1;
+}
+
+/** Get the antenna the given frame is to be transmitted with. */
+static nrf_802154_sl_ant_div_antenna_t tx_antenna_get(const uint8_t * p_data)
+{
+    nrf_802154_sl_ant_div_antenna_t antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+
+#if NRF_802154_PEER_TABLE_ENABLED && NRF_802154_PEER_TABLE_TX_ANTENNA_ENABLED
+    antenna = nrf_802154_peer_table_antenna_get(p_data);
+#else
+    (void)p_data;
+#endif
+
+    if (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_NONE)
+    {
+        antenna = nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX);
+    }
+
+    return antenna;
+}
+
+/** Initialize CCA on the antenna other than the one used for the transmission of the frame.
+ *
+ * The transmission with CCA on the transmit antenna is started by
+ * @ref nrf_802154_trx_standalone_cca_finished if the channel is idle.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ *
+ * @retval  true   CCA operation was initialized.
+ * @retval  false  CCA operation was not initialized yet.
+ */
+static bool tx_other_antenna_cca_init(const uint8_t * p_data)
+{
+    if (!timeslot_is_granted() || !nrf_802154_rsch_timeslot_request(nrf_802154_cca_duration_get()))
+    {
+        return false;
+    }
+
+    if (!are_preconditions_met())
+    {
+        return false;
+    }
+
+    nrf_802154_trx_tx_antenna_select(other_antenna_get(tx_antenna_get(p_data)));
+    nrf_802154_trx_standalone_cca();
+
+    return true;
+}
+
+#endif // NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+
+/** Initialize TX operation, preceded by CCA on the other antenna if it is enabled. */
+static bool tx_assessed_init(const uint8_t * p_data, bool cca)
+{
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+    if (cca && dual_assessment_is_enabled())
+    {
+        return tx_other_antenna_cca_init(p_data);
+    }
+#endif
+
+    return tx_init(p_data, cca);
+}
+
+/** Enter the transmit state and initialize TX operation of the given frame.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame to transmit.
+ * @param[in]  cca     If the driver is to perform CCA procedure before transmission.
+ *
+ * @retval  true   TX operation was initialized.
+ * @retval  false  TX operation was not initialized yet. It is initialized when the timeslot
+ *                 is granted and TX preconditions are met.
+ */
+static bool tx_procedure_start(const uint8_t * p_data, bool cca)
+{
+    m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
+    m_trx_transmit_frame_notifications_mask = make_trx_frame_transmit_notification_mask(cca);
+    m_flags.tx_diminished_prio              =
+        m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
+
+    state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+    mp_tx_data = p_data;
+
+    return tx_assessed_init(p_data, cca);
+}
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+/** Check if a transmission is in progress, including waiting for an ACK. */
+static bool tx_is_in_progress(void)
+{
+    return (m_state == RADIO_STATE_TX) ||
+           (m_state == RADIO_STATE_CCA_TX) ||
+           (m_state == RADIO_STATE_RX_ACK);
+}
+
+#endif
+
+/** Start transmission of the next frame waiting in the transmit queue.
+ *
+ * This function is to be called right after the current transmission ends successfully,
+ * before the receiver is enabled.
+ *
+ * @retval  true   Transmission of the next frame was started. The core is in a transmit state.
+ * @retval  false  The transmit queue is empty, or the next frame is transmitted later by a core
+ *                 hook. The caller is to enter the receive state.
+ */
+static bool tx_queue_next_start(void)
+{
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    const uint8_t * p_data;
+    bool            cca;
+
+#if NRF_802154_TX_QUEUE_TIMESLOT_ADMISSION_ENABLED
+    if (timeslot_is_granted())
+    {
+        // Send a frame that fits in this timeslot rather than wait for the next one.
+        (void)nrf_802154_tx_queue_fitting_frame_advance(nrf_802154_rsch_timeslot_us_left_get());
+    }
+#endif
+
+    if (!nrf_802154_tx_queue_pop(&p_data, &cca))
+    {
+        nrf_802154_tx_queue_in_flight_set(NULL);
+        return false;
+    }
+
+    nrf_802154_tx_queue_in_flight_set(p_data);
+
+    if (!nrf_802154_core_hooks_pre_transmission(p_data, cca))
+    {
+        // The frame was taken over by a hook that transmits it later.
+        return false;
+    }
+
+    // If TX operation cannot be initialized now, it is initialized when the timeslot is granted.
+    (void)tx_procedure_start(p_data, cca);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+
+static void on_tx_queue_resume_timeout(void * p_context);
+
+static void tx_queue_resume_timer_start(uint32_t dt)
+{
+    m_tx_queue_resume_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_tx_queue_resume_timer.dt        = dt;
+    m_tx_queue_resume_timer.callback  = on_tx_queue_resume_timeout;
+    m_tx_queue_resume_timer.p_context = NULL;
+
+    nrf_802154_timer_sched_add(&m_tx_queue_resume_timer, false);
+}
+
+/** Start the next frame waiting in the transmit queue after a failed transmission. */
+static void on_tx_queue_resume_timeout(void * p_context)
+{
+    (void)p_context;
+
+    bool retry = true;
+
+    if (nrf_802154_critical_section_enter())
+    {
+        if (nrf_802154_tx_queue_in_flight_is_set() || nrf_802154_tx_queue_is_empty())
+        {
+            // The queue was started by another operation or has nothing to transmit.
+            retry = false;
+        }
+        else
+        {
+            switch (m_state)
+            {
+                case RADIO_STATE_RX:
+                    if (current_operation_terminate(NRF_802154_TERM_NONE, REQ_ORIG_CORE, false))
+                    {
+                        if (!tx_queue_next_start())
+                        {
+                            rx_init();
+                        }
+
+                        retry = false;
+                    }
+                    break;
+
+                case RADIO_STATE_SLEEP:
+                case RADIO_STATE_FALLING_ASLEEP:
+                    // The queue is resumed by the request that wakes the driver up.
+                    retry = false;
+                    break;
+
+                case RADIO_STATE_CCA_TX:
+                case RADIO_STATE_TX:
+                case RADIO_STATE_RX_ACK:
+                    // The end of the transmission starts the queue.
+                    retry = false;
+                    break;
+
+                default:
+                    // A frame is being acknowledged or another procedure is in progress.
+                    break;
+            }
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    if (retry)
+    {
+        tx_queue_resume_timer_start(TX_QUEUE_RESUME_RETRY_TIME_US);
+    }
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
+
+/** Resume the transmit queue if no frame of the queue is in flight after a failed transmission.
+ *
+ * A failed transmission drops only the frames to its destination if
+ * @ref NRF_802154_TX_QUEUE_FAIRNESS_ENABLED is set, and no frame is started after it. The next
+ * frame is started by a timer, because the procedure that reported the failure may hold the radio
+ * until its request returns.
+ */
+static void tx_queue_resume(void)
+{
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    if (!nrf_802154_tx_queue_in_flight_is_set() &&
+        !nrf_802154_tx_queue_is_empty() &&
+        !nrf_802154_timer_sched_is_running(&m_tx_queue_resume_timer))
+    {
+        tx_queue_resume_timer_start(0U);
+    }
+#endif
+}
+
+/** Start transmission of the frame queued for the source of the received Data Request.
+ *
+ * This function is to be called right after the ACK with the Frame Pending bit set is
+ * transmitted, before the receiver is enabled.
+ *
+ * @param[in]  p_received_data  Pointer to the frame that was acknowledged.
+ *
+ * @retval  true   Transmission of the queued frame was started. The core is in a transmit state.
+ * @retval  false  No frame is queued for the source of @p p_received_data, or the frame is
+ *                 transmitted later by a core hook. The caller is to enter the receive state.
+ */
+static bool indirect_frame_start(const uint8_t * p_received_data)
+{
+#if NRF_802154_INDIRECT_QUEUE_SIZE > 0
+    const uint8_t * p_data = nrf_802154_indirect_queue_data_request_pop(p_received_data);
+
+    if (p_data == NULL)
+    {
+        return false;
+    }
+
+    // The queued frame uses the PIB configuration, like a new frame from the higher layer.
+    mp_tx_params_frame = NULL;
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    if (!nrf_802154_encrypt_tx_setup(p_data))
+    {
+        nrf_802154_notify_transmit_failed(p_data, NRF_802154_TX_ERROR_ABORTED);
+        return false;
+    }
+#endif
+
+    if (!nrf_802154_core_hooks_pre_transmission(p_data, true))
+    {
+        // The frame was taken over by a hook that transmits it later.
+        return false;
+    }
+
+    // If TX operation cannot be initialized now, it is initialized when the timeslot is granted.
+    (void)tx_procedure_start(p_data, true);
+
+    return true;
+#else
+    (void)p_received_data;
+
+    return false;
+#endif
+}
+
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
+/** Check if the given frame is a Data Request handled by the driver.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *
+ * @retval  true   The frame is a Data Request with a source address.
+ * @retval  false  The frame is to be passed to the higher layer.
+ */
+static bool data_request_is(const uint8_t * p_data)
+{
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_parse_cached(p_data);
+
+    return (p_mhr_data != NULL) &&
+           (p_mhr_data->p_src_addr != NULL) &&
+           nrf_802154_frame_parser_data_request_is(p_data, p_mhr_data);
+}
+
+/** Handle the acknowledged Data Request in the current rx buffer without passing it to
+ *  the higher layer.
+ *
+ * The frame queued for the polling node is transmitted if there is one. Otherwise, the Data
+ * Request is notified with its source address and metadata. In both cases the rx buffer is reused.
+ */
+static void data_request_handle(void)
+{
+    const uint8_t * p_data = mp_current_rx_buffer->data;
+
+#if NRF_802154_PEER_TABLE_ENABLED
+    nrf_802154_peer_table_frame_received(p_data, &m_rx_metadata);
+#endif
+#if NRF_802154_CSL_TX_ENABLED
+    csl_tx_frame_received(p_data);
+#endif
+
+    if (m_rx_metadata.ack_fpb && indirect_frame_start(p_data))
+    {
+        return;
+    }
+
+    bool            src_addr_extended;
+    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_data, &src_addr_extended);
+
+    nrf_802154_notify_data_request_received(p_src_addr, src_addr_extended, &m_rx_metadata);
+
+    state_set(RADIO_STATE_RX);
+
+    rx_init();
+}
+
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
+/** Initialize ED operation */
+static void ed_init(void)
+{
+    if (!timeslot_is_granted())
+    {
+        return;
+    }
+
+    if (!are_preconditions_met())
+    {
+        return;
+    }
+
+    uint32_t trx_ed_count = 0U;
+
+    tx_params_restore();
+
+    if (m_ed_sweep_mask != 0U)
+    {
+        nrf_802154_trx_channel_set(m_ed_sweep_channel);
+    }
+
+    // Notify antenna diversity about energy detection request. Antenna diversity state
+    // will be updated, and m_ed_time_left reduced accordingly.
+    nrf_802154_sl_ant_div_energy_detection_requested_notify(&m_ed_time_left);
+
+    if (!ed_iter_setup(&m_ed_time_left, &trx_ed_count))
+    {
+        // Just wait for next timeslot if there is not enough time in this one.
+        return;
+    }
+
+    nrf_802154_trx_energy_detection(trx_ed_count);
+}
+
+/** Select the lowest channel left to scan in the energy detection sweep. */
+static void ed_sweep_channel_select(void)
+{
+    m_ed_sweep_channel = (uint8_t)__CLZ(__RBIT(m_ed_sweep_mask));
+    m_ed_time_left     = m_ed_sweep_time;
+    m_ed_result        = 0;
+
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+    ed_ext_reset();
+#endif
+
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+    memset(m_ed_antenna_results, 0, sizeof(m_ed_antenna_results));
+#endif
+}
+
+/**
+ * @brief Store the result of the scanned channel and proceed to the next channel of the sweep.
+ *
+ * @retval  true   There is another channel to scan.
+ * @retval  false  The energy detection sweep is complete or no sweep is in progress.
+ */
+static bool ed_sweep_next(void)
+{
+    if (m_ed_sweep_mask == 0U)
+    {
+        return false;
+    }
+
+    m_ed_sweep_results[m_ed_sweep_channel - NRF_802154_ED_SWEEP_CHANNEL_FIRST] =
+        ed_result_get(m_ed_result);
+    m_ed_sweep_mask &= ~(1UL << m_ed_sweep_channel);
+
+    if (m_ed_sweep_mask == 0U)
+    {
+        return false;
+    }
+
+    ed_sweep_channel_select();
+
+    return true;
+}
+
+/** Initialize CCA operation. */
+static void cca_init(void)
+{
+    if (!timeslot_is_granted() || !nrf_802154_rsch_timeslot_request(nrf_802154_cca_duration_get()))
+    {
+        return;
+    }
+
+    if (!are_preconditions_met())
+    {
+        return;
+    }
+
+    nrf_802154_sl_ant_div_antenna_t antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+
+    tx_params_restore();
+
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+    if (m_flags.cca_other_antenna)
+    {
+        antenna = other_antenna_get(
+            nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX));
+    }
+#endif
+
+    nrf_802154_trx_tx_antenna_select(antenna);
+    nrf_802154_trx_standalone_cca();
+}
+
+/** Initialize Continuous Carrier operation. */
+static void continuous_carrier_init(void)
+{
+    if (!timeslot_is_granted())
+    {
+        return;
+    }
+
+    if (!are_preconditions_met())
+    {
+        return;
+    }
+
+    tx_params_restore();
+
+    nrf_802154_trx_continuous_carrier();
+}
+
+/** Initialize Modulated Carrier operation. */
+static void modulated_carrier_init(const uint8_t * p_data)
+{
+    if (!timeslot_is_granted())
+    {
+        return;
+    }
+
+    if (!are_preconditions_met())
+    {
+        return;
+    }
+
+    tx_params_restore();
+
+    nrf_802154_trx_modulated_carrier((const void *)p_data);
+}
+
+/***************************************************************************************************
+ * @section Radio Scheduler notification handlers
+ **************************************************************************************************/
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+/** Count the end of the timeslot with the operation it aborts.
+ *
+ * @param[in]  receiving_psdu_now  If a frame is being received in the @ref RADIO_STATE_RX state.
+ */
+static void timeslot_stat_ended(bool receiving_psdu_now)
+{
+    nrf_802154_stat_timeslot_op_t op      = NRF_802154_STAT_TIMESLOT_OP_NONE;
+    bool                          revoked = true;
+
+    switch (m_state)
+    {
+        case RADIO_STATE_SLEEP:
+        case RADIO_STATE_FALLING_ASLEEP:
+            revoked = false;
+            break;
+
+        case RADIO_STATE_RX:
+            op = receiving_psdu_now ? NRF_802154_STAT_TIMESLOT_OP_RX :
+                 NRF_802154_STAT_TIMESLOT_OP_NONE;
+            break;
+
+        case RADIO_STATE_CCA_TX:
+        case RADIO_STATE_TX:
+            op = NRF_802154_STAT_TIMESLOT_OP_TX;
+            break;
+
+        case RADIO_STATE_RX_ACK:
+            op = NRF_802154_STAT_TIMESLOT_OP_RX_ACK;
+            break;
+
+        case RADIO_STATE_TX_ACK:
+            op = NRF_802154_STAT_TIMESLOT_OP_TX_ACK;
+            break;
+
+        default:
+            op = NRF_802154_STAT_TIMESLOT_OP_OTHER;
+            break;
+    }
+
+    nrf_802154_stat_timeslot_ended(revoked, op);
+}
+
+#endif
+
+static void on_timeslot_ended(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (timeslot_is_granted())
+    {
+        m_rsch_timeslot_is_granted = false;
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+        nrf_802154_stat_totals_increment(total_hfxo_time,
+                                         nrf_802154_lp_timer_time64_get() - m_timeslot_start_time);
+#endif
+
+        bool receiving_psdu_now = false;
+
+        if (m_state == RADIO_STATE_RX)
+        {
+            receiving_psdu_now = nrf_802154_trx_psdu_is_being_received();
+        }
+
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+        timeslot_stat_ended(receiving_psdu_now);
+#endif
+
+        trx_disable();
+
+        nrf_802154_timer_coord_stop();
+
+        nrf_802154_rsch_continuous_ended();
+
+        result = nrf_802154_core_hooks_terminate(NRF_802154_TERM_802154, REQ_ORIG_RSCH);
+        assert(result);
+        (void)result;
+
+        switch (m_state)
+        {
+            case RADIO_STATE_FALLING_ASLEEP:
+                state_set(RADIO_STATE_SLEEP);
+                break;
+
+            case RADIO_STATE_RX:
+                if (receiving_psdu_now)
+                {
+                    receive_failed_notify(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
+                }
+
+                break;
+
+            case RADIO_STATE_TX_ACK:
+                state_set(RADIO_STATE_RX);
+                received_frame_notify_and_nesting_allow(rx_buffer_frame_take());
+                break;
+
+            case RADIO_STATE_CCA_TX:
+            case RADIO_STATE_TX:
+            case RADIO_STATE_RX_ACK:
+                state_set(RADIO_STATE_RX);
+                transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_TIMESLOT_ENDED);
+                break;
+
+            case RADIO_STATE_ED:
+            case RADIO_STATE_CCA:
+            case RADIO_STATE_CONTINUOUS_CARRIER:
+            case RADIO_STATE_MODULATED_CARRIER:
+            case RADIO_STATE_SLEEP:
+                // Intentionally empty.
+                break;
+
+            default:
+                assert(false);
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+static void on_preconditions_denied(radio_state_t state)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result;
+
+    result = nrf_802154_core_hooks_terminate(NRF_802154_TERM_802154, REQ_ORIG_CORE);
+    assert(result);
+    (void)result;
+
+    bool receiving_psdu_now = false;
+
+    if (state == RADIO_STATE_RX)
+    {
+        receiving_psdu_now = nrf_802154_trx_psdu_is_being_received();
+    }
+
+    trx_abort();
+
+    switch (state)
+    {
+        case RADIO_STATE_FALLING_ASLEEP:
+            // There should be on_timeslot_ended event
+            break;
+
+        case RADIO_STATE_RX:
+            if (receiving_psdu_now)
+            {
+                receive_failed_notify(NRF_802154_RX_ERROR_ABORTED);
+            }
+
+            break;
+
+        case RADIO_STATE_TX_ACK:
+            state_set(RADIO_STATE_RX);
+            break;
+
+        case RADIO_STATE_CCA_TX:
+            m_flags.tx_diminished_prio = false;
+        // Fallthrough
+
+        case RADIO_STATE_TX:
+        case RADIO_STATE_RX_ACK:
+            state_set(RADIO_STATE_RX);
+            break;
+
+        case RADIO_STATE_ED:
+        case RADIO_STATE_CCA:
+        case RADIO_STATE_CONTINUOUS_CARRIER:
+        case RADIO_STATE_MODULATED_CARRIER:
+        case RADIO_STATE_SLEEP:
+            // Intentionally empty.
+            break;
+
+        default:
+            assert(false);
+    }
+
+    operation_terminated_notify(state, receiving_psdu_now);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+static void on_preconditions_approved(radio_state_t state)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    trx_abort();
+
+    switch (state)
+    {
+        case RADIO_STATE_SLEEP:
+            // Intentionally empty. Appropriate action will be performed on state change.
+            break;
+
+        case RADIO_STATE_RX:
+            rx_init();
+            break;
+
+        case RADIO_STATE_CCA_TX:
+            (void)tx_assessed_init(mp_tx_data, true);
+            break;
+
+        case RADIO_STATE_TX:
+            (void)tx_init(mp_tx_data, false);
+            break;
+
+        case RADIO_STATE_ED:
+            ed_init();
+            break;
+
+        case RADIO_STATE_CCA:
+            cca_init();
+            break;
+
+        case RADIO_STATE_CONTINUOUS_CARRIER:
+            continuous_carrier_init();
+            break;
+
+        case RADIO_STATE_MODULATED_CARRIER:
+            modulated_carrier_init(mp_tx_data);
+            break;
+
+        default:
+            assert(false);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+static void on_timeslot_started(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_trx_enable();
+
+    // The radio is configured from PIB when enabled.
+    m_flags.tx_params_applied  = false;
+    m_rsch_timeslot_is_granted = true;
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    m_timeslot_start_time = nrf_802154_lp_timer_time64_get();
+#endif
+
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+    nrf_802154_stat_timeslot_granted();
+#endif
+
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+    // The HP timer is restarted with the timer coordinator, the old synchronization is useless.
+    frame_end_timestamp_sync_invalidate();
+#endif
+    nrf_802154_timer_coord_start();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+static bool preconditions_approved_should_be_ignored(rsch_prio_t previously_approved_prio,
+                                                     rsch_prio_t currently_approved_prio)
+{
+    // Approved preconditions should only be ignored only all the following conditions are met:
+    // * all preconditions apart from Coex had already been approved;
+    // * the call is a result of Coex becoming approved at the highest priority;
+    // * currently performed operation is transmission with CCA;
+    // * Coex for transmission is requested after CCA reports idle channel
+    bool only_coex_was_unapproved       = (previously_approved_prio == RSCH_PRIO_RX);
+    bool all_preconditions_are_approved = (currently_approved_prio == RSCH_PRIO_MAX);
+    bool current_state_is_cca_tx        = (m_state == RADIO_STATE_CCA_TX);
+    bool coex_tx_request_mode_allows    = (m_coex_tx_request_mode ==
+                                           NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE);
+
+    return (only_coex_was_unapproved &&
+            all_preconditions_are_approved &&
+            current_state_is_cca_tx &&
+            coex_tx_request_mode_allows);
+}
+
+/** Handle the change of the timeslot priority notified by the radio scheduler. */
+static void crit_sect_prio_changed(rsch_prio_t prio)
+{
+    rsch_prio_t old_prio = m_rsch_priority;
+
+    m_rsch_priority = prio;
+
+    if ((old_prio == RSCH_PRIO_IDLE) && (prio != RSCH_PRIO_IDLE))
+    {
+        // We have just got a timeslot.
+        on_timeslot_started();
+    }
+    else if ((old_prio != RSCH_PRIO_IDLE) && (prio == RSCH_PRIO_IDLE))
+    {
+        // We are giving back timeslot.
+        on_timeslot_ended();
+        return;
+    }
+    else if (prio == RSCH_PRIO_IDLE)
+    {
+        // It might happen that even though IDLE has already been notified, this function is called
+        // again as a result of preemptions caused by unexpected timeslot change (e.g. the application
+        // requested transition to sleep while out of timeslot and RAAL notified timeslot start
+        // in the middle of that sleep request). The following block makes RAAL finish its processing.
+        nrf_802154_rsch_continuous_ended();
+    }
+    else
+    {
+        // Intentionally empty
+    }
+
+    int_fast8_t transition = action_needed(old_prio, prio, m_state);
+
+    if (transition == 0)
+    {
+        return;
+    }
+    else if (transition < 0)
+    {
+        on_preconditions_denied(m_state);
+
+        // After denying preconditions, TRX is disabled. However, it is possible that the existing
+        // preconditions are enough for the new state (entered due to denied preconditions) and TRX
+        // could be enabled for the new state. If this is the case, on_preconditions_approved() is
+        // called to fully switch to the new state.
+        radio_state_t new_state = m_state;
+
+        if (is_state_allowed_for_prio(prio, new_state))
+        {
+            on_preconditions_approved(new_state);
+        }
+    }
+    else
+    {
+        if (!preconditions_approved_should_be_ignored(old_prio, prio))
+        {
+            on_preconditions_approved(m_state);
+        }
+    }
+}
+
+void nrf_802154_rsch_crit_sect_prio_changed(rsch_prio_t prio)
+{
+    nrf_802154_trace_input(NRF_802154_TRACE_INPUT_SOURCE_TIMESLOT, prio, m_state);
+    crit_sect_prio_changed(prio);
+    nrf_802154_trace_input_done(NRF_802154_TRACE_INPUT_SOURCE_TIMESLOT, prio);
+}
+
+/***************************************************************************************************
+ * @section RADIO interrupt handler
+ **************************************************************************************************/
+
+void nrf_802154_trx_receive_ack_started(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(m_state == RADIO_STATE_RX_ACK);
+    nrf_802154_core_hooks_rx_ack_started();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+static void on_rx_prestarted_timeout(void * p_context)
+{
+    (void)p_context;
+
+    /* If we were in critical section this handler would not be called.
+     * If we were outside of critical section this handler could be called,
+     * and nrf_802154_critical_section_enter must succeed.
+     * Justification:
+     * - If higher priority interrupt preempts this handler before it takes critical section, that
+     * interrupt may enter/exit critical section, but when it returns to this handler
+     * entering critical section will succeed.
+     * - If we entered critical section here the higher priority interrupt from radio
+     * will not occur.
+     * - The only related interrupt that can preempt this handler while it owns critical section
+     * is from raal timeslot margin, which will fail to enter critical section and schedule
+     * priority change to be called by nrf_802154_critical_section_exit.
+     *
+     * Critical section is entered forcefully here nonetheless, due to a rare issue with
+     * nrf_802154_critical_section_exit being preempted before the nested critical section counter
+     * could be decremented. Allowing for critical section nesting here resolves the problem.
+     * TODO: After the bug is fixed, change to nrf_802154_critical_section_enter and check if
+     * critical section was successfully entered.
+     */
+
+    nrf_802154_critical_section_forcefully_enter();
+
+    nrf_802154_sl_ant_div_rx_preamble_timeout_notify();
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+    if (antenna_diversity_is_enabled())
+    {
+        nrf_802154_stat_ant_div_decision_late();
+    }
+#endif
+
+    /**
+     * If timer is still running here, it means that timer handling has been preempted by HELPER1
+     * radio event after removing the timer from scheduler, but before handling this callback.
+     * In that case, process the timeout as usual, but notify antenna diversity module that another
+     * preamble was detected in order to repeat RSSI measurements.
+     */
+    if (nrf_802154_timer_sched_is_running(&m_rx_prestarted_timer))
+    {
+        nrf_802154_sl_ant_div_rx_preamble_detected_notify();
+    }
+
+    /* If nrf_802154_trx_receive_frame_prestarted boosted preconditions beyond those normally
+     * required by current state, they need to be restored now.
+     */
+    if (nrf_802154_pib_coex_rx_request_mode_get() ==
+        NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION)
+    {
+        request_preconditions_for_state(m_state);
+    }
+    nrf_802154_critical_section_exit();
+}
+
+void nrf_802154_trx_receive_frame_prestarted(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (!antenna_diversity_is_enabled())
+    {
+        // Only assert if notifications mask would not allow for calling this function.
+        assert((m_trx_receive_frame_notifications_mask & TRX_RECEIVE_NOTIFICATION_PRESTARTED) !=
+               0U);
+    }
+    else
+    {
+        // Antenna diversity uses this function for detecting possible preamble on air.
+    }
+
+    assert(m_state == RADIO_STATE_RX);
+
+#if (NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS)
+    nrf_802154_stat_counter_increment(received_energy_events);
+#endif
+
+    nrf_802154_sl_ant_div_rx_preamble_detected_notify();
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+    if (antenna_diversity_is_enabled())
+    {
+        nrf_802154_stat_ant_div_preamble_detected();
+    }
+#endif
+
+    // Antenna diversity module should be notified if framestart doesn't come.
+    bool rx_timeout_should_be_started = antenna_diversity_is_enabled();
+
+    if (nrf_802154_pib_coex_rx_request_mode_get() ==
+        NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION)
+    {
+        // Request boosted preconditions for receive
+        nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
+        // Boosted preconditions should be reverted if the framestart doesn't come.
+        rx_timeout_should_be_started = true;
+    }
+
+    /*
+     * This handler might not be followed by nrf_802154_trx_receive_frame_started. The timer
+     * below is used for timing out if the framestart doesn't come.
+     * There are two reasons for that: reverting boosted preconditions and notifying antenna diversity
+     * module.
+     */
+    if (rx_timeout_should_be_started)
+    {
+
+        uint32_t now = nrf_802154_timer_sched_time_get();
+
+        nrf_802154_timer_sched_remove(&m_rx_prestarted_timer, NULL);
+
+        m_rx_prestarted_timer.t0       = now;
+        m_rx_prestarted_timer.dt       = PRESTARTED_TIMER_TIMEOUT_US;
+        m_rx_prestarted_timer.callback = on_rx_prestarted_timeout;
+
+        nrf_802154_timer_sched_add(&m_rx_prestarted_timer, true);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+void nrf_802154_trx_receive_frame_started(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(m_state == RADIO_STATE_RX);
+    assert((m_trx_receive_frame_notifications_mask & TRX_RECEIVE_NOTIFICATION_STARTED) != 0U);
+
+#if (NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES)
+    nrf_802154_stat_counter_increment(received_preambles);
+#endif
+
+    switch (nrf_802154_pib_coex_rx_request_mode_get())
+    {
+        case NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION:
+            nrf_802154_timer_sched_remove(&m_rx_prestarted_timer, NULL);
+        /* Fallthrough */
+
+        case NRF_802154_COEX_RX_REQUEST_MODE_PREAMBLE:
+            /* Request boosted preconditions */
+            nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
+            break;
+
+        default:
+            break;
+    }
+
+    if (antenna_diversity_is_enabled())
+    {
+        // If antenna diversity is enabled, rx_prestarted_timer would be started even
+        // in different coex rx request modes than NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION
+        nrf_802154_timer_sched_remove(&m_rx_prestarted_timer, NULL);
+        nrf_802154_sl_ant_div_rx_frame_started_notify();
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+        nrf_802154_stat_ant_div_frame_started();
+#endif
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+/** Filter the next part of the received frame header, recording the time it takes. */
+static nrf_802154_rx_error_t frame_filter_part(const uint8_t * p_data, uint8_t * p_num_bytes)
+{
+    uint32_t              filter_start = nrf_802154_stat_irq_cycles_start();
+    nrf_802154_rx_error_t result       = nrf_802154_filter_frame_part(p_data, p_num_bytes);
+
+    nrf_802154_stat_irq_cycles_record(NRF_802154_STAT_IRQ_CYCLES_FRAME_FILTER, filter_start);
+
+    return result;
+}
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    uint8_t               prev_num_data_bytes;
+    uint8_t               num_data_bytes;
+    nrf_802154_rx_error_t filter_result;
+    bool                  frame_accepted = true;
+
+#if NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+    // The first check starts from the FCF, even though more bytes are already received.
+    num_data_bytes = (bcc == (BCC_INIT / 8U)) ? (PHR_SIZE + FCF_SIZE) : bcc;
+#else
+    num_data_bytes = bcc;
+#endif
+    prev_num_data_bytes = num_data_bytes;
+
+    assert(num_data_bytes >= PHR_SIZE + FCF_SIZE);
+    assert(m_state == RADIO_STATE_RX);
+
+    if (!m_flags.frame_filtered)
+    {
+        filter_result = frame_filter_part(mp_current_rx_buffer->data, &num_data_bytes);
+
+#if NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+        // Keep checking consecutive parts of the frame header as long as they are received.
+        while ((filter_result == NRF_802154_RX_ERROR_NONE) &&
+               (num_data_bytes != prev_num_data_bytes) &&
+               (num_data_bytes <= bcc))
+        {
+            prev_num_data_bytes = num_data_bytes;
+            filter_result       = frame_filter_part(mp_current_rx_buffer->data,
+                                                    &num_data_bytes);
+        }
+#endif
+
+        if (filter_result == NRF_802154_RX_ERROR_NONE)
+        {
+            if (num_data_bytes != prev_num_data_bytes)
+            {
+                bcc = num_data_bytes;
+            }
+            else
+            {
+                m_flags.frame_filtered = true;
+
+                /* Request boosted preconditions */
+                nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
+            }
+        }
+        else if ((filter_result == NRF_802154_RX_ERROR_INVALID_LENGTH) ||
+                 (!nrf_802154_pib_promiscuous_get()))
+        {
+            if (nrf_802154_trx_receive_frame_drop())
+            {
+                // The receiver listens again in the same buffer.
+                rx_flags_clear();
+            }
+            else
+            {
+                trx_abort();
+                rx_init();
+            }
+
+            frame_accepted = false;
+
+            /* Release boosted preconditions */
+            request_preconditions_for_state(m_state);
+
+            if (filter_error_is_notified(mp_current_rx_buffer->data, filter_result))
+            {
+                receive_failed_notify(filter_result);
+            }
+        }
+        else
+        {
+            // Promiscuous mode, allow incorrect frames. Nothing to do here.
+        }
+    }
+
+    if ((!m_flags.rx_timeslot_requested) && (frame_accepted))
+    {
+        if (nrf_802154_rsch_timeslot_request(nrf_802154_rx_duration_get(
+                                                 mp_current_rx_buffer->data[0],
+                                                 ack_is_requested(mp_current_rx_buffer->data))))
+        {
+            m_flags.rx_timeslot_requested = true;
+
+            receive_started_notify();
+        }
+        else
+        {
+            // Disable receiver and wait for a new timeslot.
+            trx_abort();
+
+            // We should not leave trx in temporary state, let's receive then.
+            // We avoid hard reset of radio during TX ACK phase due to timeslot end,
+            // which could result in spurious RF emission.
+            rx_init();
+
+            nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return bcc;
+}
+
+#endif
+
+void nrf_802154_trx_go_idle_finished(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    sleep_init();
+    state_set(RADIO_STATE_SLEEP);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+static void on_bad_ack(void);
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+static void update_total_times_on_receive_end(uint32_t listening_start_hp_timestamp,
+                                              uint32_t receive_end_hp_timestamp, uint8_t phr)
+{
+    uint32_t t_listening;
+    uint32_t t_frame;
+
+    t_frame     = nrf_802154_frame_duration_get(phr, true, true);
+    t_listening = receive_end_hp_timestamp - listening_start_hp_timestamp;
+
+    if (t_frame > t_listening)
+    {
+        t_frame = t_listening;
+    }
+
+    t_listening -= t_frame;
+
+    nrf_802154_stat_totals_increment(total_listening_time, t_listening);
+    nrf_802154_stat_totals_increment(total_receive_time, t_frame);
+}
+
+#endif
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+void nrf_802154_stat_totals_get_notify(void)
+{
+    // Total times are going to be read, update stat_totals to hold
+    // correct times until now.
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    trx_state_t trx_state = nrf_802154_trx_state_get();
+
+    if ((trx_state == TRX_STATE_RXFRAME) || (trx_state == TRX_STATE_RXACK))
+    {
+        uint32_t listening_end_timestamp = nrf_802154_hp_timer_current_time_get();
+
+        if (listening_end_timestamp - m_listening_start_hp_timestamp >= MAX_PHY_FRAME_TIME_US)
+        {
+            /* m_listening_start_hp_timestamp ... now - MAX_PHY_FRAME_TIME_US must be listening.
+             * Last MAX_PHY_FRAME_TIME_US is considered uncertain.
+             */
+            listening_end_timestamp -= MAX_PHY_FRAME_TIME_US;
+
+            uint32_t t_listening = listening_end_timestamp - m_listening_start_hp_timestamp;
+
+            m_listening_start_hp_timestamp = listening_end_timestamp;
+
+            nrf_802154_stat_totals_increment(total_listening_time, t_listening);
+        }
+        else
+        {
+            /* Too little time passed since m_listening_start_hp_timestamp, we don't know
+             * if frame is being received now until it is received. */
+        }
+    }
+
+    if (timeslot_is_granted())
+    {
+        uint64_t now = nrf_802154_lp_timer_time64_get();
+
+        nrf_802154_stat_totals_increment(total_hfxo_time, now - m_timeslot_start_time);
+        m_timeslot_start_time = now;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+}
+
+#endif
+
+void nrf_802154_trx_receive_frame_crcerror(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+    nrf_802154_stat_channel_counter_increment(stat_channel_get(), crc_errors);
+#endif
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    uint32_t receive_end_hp_timestamp     = frame_end_hp_timestamp_get();
+    uint32_t listening_start_hp_timestamp = m_listening_start_hp_timestamp;
+
+#endif
+
+    assert(m_state == RADIO_STATE_RX);
+    rx_flags_clear();
+
+    // We don't change receive buffer, receive will go to the same that was already used
+#if !NRF_802154_DISABLE_BCC_MATCHING
+    request_preconditions_for_state(m_state);
+    nrf_802154_trx_receive_frame(BCC_INIT / 8U, m_trx_receive_frame_notifications_mask);
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    m_listening_start_hp_timestamp = nrf_802154_hp_timer_current_time_get();
+
+#if !NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+    // Configure the timer coordinator to get a timestamp of the END event which
+    // fires several cycles after CRCOK or CRCERROR events.
+    nrf_802154_timer_coord_timestamp_prepare(
+        nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_END));
+#endif
+#endif
+
+#else
+    // With BCC matching disabled trx module will re-arm automatically
+#endif
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    update_total_times_on_receive_end(listening_start_hp_timestamp, receive_end_hp_timestamp,
+                                      mp_current_rx_buffer->data[PHR_OFFSET]);
+#endif
+
+#if NRF_802154_NOTIFY_CRCERROR
+    receive_failed_notify(NRF_802154_RX_ERROR_INVALID_FCS);
+#endif // NRF_802154_NOTIFY_CRCERROR
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+void nrf_802154_trx_receive_ack_crcerror(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(m_state == RADIO_STATE_RX_ACK);
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    uint32_t receive_end_hp_timestamp     = frame_end_hp_timestamp_get();
+    uint32_t listening_start_hp_timestamp = m_listening_start_hp_timestamp;
+
+    update_total_times_on_receive_end(listening_start_hp_timestamp, receive_end_hp_timestamp,
+                                      mp_current_rx_buffer->data[PHR_OFFSET]);
+#endif
+
+    on_bad_ack();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+void nrf_802154_trx_receive_frame_received(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+#if NRF_802154_LATENCY_STATS_ENABLED
+    nrf_802154_stat_latency_start_mark(NRF_802154_STAT_LATENCY_RX_DELIVERY);
+#endif
+
+    uint8_t * p_received_data = mp_current_rx_buffer->data;
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    uint32_t receive_end_hp_timestamp     = frame_end_hp_timestamp_get();
+    uint32_t listening_start_hp_timestamp = m_listening_start_hp_timestamp;
+
+    update_total_times_on_receive_end(listening_start_hp_timestamp, receive_end_hp_timestamp,
+                                      mp_current_rx_buffer->data[PHR_OFFSET]);
+#endif
+
+#if NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+    nrf_802154_rx_error_t filter_result = NRF_802154_RX_ERROR_RUNTIME;
+
+#if NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+    // Frames ending before the first BCMATCH event are not filtered yet.
+    if (!m_flags.frame_filtered &&
+        ((p_received_data[PHR_OFFSET] + PHR_SIZE) <= (BCC_INIT / 8U)))
+#endif
+    {
+        uint8_t num_data_bytes      = PHR_SIZE + FCF_SIZE;
+        uint8_t prev_num_data_bytes = 0;
+
+        // Frame filtering
+        while (num_data_bytes != prev_num_data_bytes)
+        {
+            prev_num_data_bytes = num_data_bytes;
+
+            // Keep checking consecutive parts of the frame header.
+            filter_result = frame_filter_part(mp_current_rx_buffer->data, &num_data_bytes);
+
+            if (filter_result == NRF_802154_RX_ERROR_NONE)
+            {
+                if (num_data_bytes == prev_num_data_bytes)
+                {
+                    m_flags.frame_filtered = true;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        // Timeslot request
+        if (m_flags.frame_filtered &&
+            ack_is_requested(p_received_data) &&
+            !nrf_802154_rsch_timeslot_request(nrf_802154_rx_duration_get(0, true)))
+        {
+            // Frame is destined to this node but there is no timeslot to transmit ACK.
+            // Just disable receiver and wait for a new timeslot.
+            nrf_802154_trx_abort();
+
+            // Filter out received ACK frame if promiscuous mode is disabled.
+            if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
+                nrf_802154_pib_promiscuous_get())
+            {
+                // Metadata is captured before the flags are cleared to report the PAN context.
+                rx_metadata_capture();
+                rx_flags_clear();
+                received_frame_notify_and_nesting_allow(rx_buffer_frame_take());
+            }
+            else
+            {
+                rx_flags_clear();
+            }
+
+            nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+            return;
+        }
+    }
+#endif // NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+
+    if (m_flags.frame_filtered || nrf_802154_pib_promiscuous_get())
+    {
+        nrf_802154_stat_counter_increment(received_frames);
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+        nrf_802154_stat_channel_counter_increment(stat_channel_get(), received_frames);
+#endif
+
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+        uint32_t ts = frame_end_timestamp_get();
+
+        nrf_802154_stat_timestamp_write(last_rx_end_timestamp, ts);
+#endif
+
+        nrf_802154_sl_ant_div_rx_frame_received_notify();
+
+        rx_metadata_capture();
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+        if (antenna_diversity_is_enabled())
+        {
+            nrf_802154_stat_ant_div_frame_received(m_rx_metadata.antenna, m_rx_metadata.power);
+        }
+#endif
+#if NRF_802154_ANT_DIV_FAST_TOGGLE_TIME_US > 0
+        ant_div_best_antenna_update(m_rx_metadata.antenna);
+#endif
+
+#if NRF_802154_LINK_METRICS_ENABLED
+        if (m_flags.frame_filtered)
+        {
+            // The metrics are updated before the Enh-Ack to the frame is written.
+            nrf_802154_link_metrics_frame_received(mp_current_rx_buffer->data, &m_rx_metadata);
+        }
+#endif
+
+#if NRF_802154_CAPTURE_ENABLED
+        if (nrf_802154_capture_ring_is_enabled())
+        {
+            // The frame is copied to the capture ring, so the buffer is reused for the next frame.
+            nrf_802154_capture_ring_frame_write(p_received_data, &m_rx_metadata);
+
+            request_preconditions_for_state(m_state);
+            rx_init();
+
+            nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+            return;
+        }
+#endif
+
+#if NRF_802154_HEADER_MONITOR_ENABLED
+        if (nrf_802154_header_ring_is_enabled())
+        {
+            const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+                nrf_802154_frame_parser_mhr_parse_cached(p_received_data);
+
+            if (p_mhr_data != NULL)
+            {
+                nrf_802154_header_ring_frame_write(p_received_data, p_mhr_data, &m_rx_metadata);
+            }
+
+            if (!nrf_802154_header_ring_frames_retain_get())
+            {
+                // Only the header record is kept, so the buffer is reused for the next frame.
+                request_preconditions_for_state(m_state);
+                rx_init();
+
+                nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+                return;
+            }
+        }
+#endif
+
+        bool send_ack = false;
+
+        if (m_flags.frame_filtered &&
+            ack_is_requested(mp_current_rx_buffer->data) &&
+            auto_ack_is_enabled())
+        {
+            mp_ack = nrf_802154_ack_generator_create(mp_current_rx_buffer->data);
+            if (NULL != mp_ack)
+            {
+                send_ack = true;
+            }
+        }
+
+        if (send_ack)
+        {
+            state_set(RADIO_STATE_TX_ACK);
+
+            if (is_state_allowed_for_prio(m_rsch_priority, RADIO_STATE_TX_ACK))
+            {
+                nrf_802154_ack_generator_ie_write(mp_current_rx_buffer->data, ack_phr_time_get());
+
+#if NRF_802154_COEX_PRIORITY_ENABLED
+                // Restored to normal by rx_init() if the ACK is not transmitted.
+                coex_priority_set(true);
+#endif
+
+#if NRF_802154_ENCRYPTION_ENABLED
+                if (!nrf_802154_encrypt_ack((uint8_t *)mp_ack))
+                {
+                    // The Enh-Ack cannot be secured, so the frame is received without ACK.
+                    p_received_data = rx_buffer_frame_take();
+
+                    state_set(RADIO_STATE_RX);
+                    rx_init();
+
+                    received_frame_notify_and_nesting_allow(p_received_data);
+                }
+                else
+#endif
+                if (nrf_802154_trx_transmit_ack(mp_ack, ACK_IFS))
+                {
+                    // Transmitting ack, because we can
+#if NRF_802154_DUPLICATE_FILTER_ENABLED
+                    m_flags.rx_duplicate =
+                        nrf_802154_duplicate_filter_check(mp_current_rx_buffer->data);
+#endif
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+                    m_flags.rx_data_request = data_request_is(mp_current_rx_buffer->data);
+#endif
+                }
+                else
+                {
+                    // The TIMER passed the ramp-up time of the ACK before it was armed.
+                    nrf_802154_stat_counter_increment(ack_deadline_misses);
+                    m_rx_metadata.ack_late = true;
 
-    trx_abort();
+                    p_received_data = rx_buffer_frame_take();
 
-    switch (state)
-    {
-        case RADIO_STATE_SLEEP:
-            // Intentionally empty. Appropriate action will be performed on state change.
-            break;
+                    state_set(RADIO_STATE_RX);
+                    rx_init();
 
-        case RADIO_STATE_RX:
-            rx_init();
-            break;
+                    received_frame_notify_and_nesting_allow(p_received_data);
+                }
+            }
+            else
+            {
+                if (!nrf_802154_rsch_prec_is_approved(RSCH_PREC_COEX,
+                                                      min_required_rsch_prio(RADIO_STATE_TX_ACK)))
+                {
+                    nrf_802154_stat_counter_increment(coex_denied_requests);
+                }
 
-        case RADIO_STATE_CCA_TX:
-            (void)tx_init(mp_tx_data, true);
-            break;
+                p_received_data = rx_buffer_frame_take();
 
-        case RADIO_STATE_TX:
-            (void)tx_init(mp_tx_data, false);
-            break;
+                state_set(RADIO_STATE_RX);
+                rx_init();
 
-        case RADIO_STATE_ED:
-            ed_init();
-            break;
+                received_frame_notify_and_nesting_allow(p_received_data);
+            }
+        }
+        else
+        {
+            request_preconditions_for_state(m_state);
+            // Filter out received ACK frame if promiscuous mode is disabled.
+            if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
+                nrf_802154_pib_promiscuous_get())
+            {
+                // Current buffer or its copy will be passed to the application
+                p_received_data = rx_buffer_frame_take();
 
-        case RADIO_STATE_CCA:
-            cca_init();
-            break;
+                // Find new buffer if the prepared one could not be used
+                if (!rx_buffer_is_available())
+                {
+                    rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+                }
 
-        case RADIO_STATE_CONTINUOUS_CARRIER:
-            continuous_carrier_init();
-            break;
+                rx_init();
 
-        case RADIO_STATE_MODULATED_CARRIER:
-            modulated_carrier_init(mp_tx_data);
-            break;
+                received_frame_notify_and_nesting_allow(p_received_data);
+            }
+            else
+            {
+                // Receive to the same buffer
+                rx_init();
+            }
+        }
+    }
+    else
+    {
+        // CRC is OK, but filtering operation did not end - it is invalid frame with valid CRC
+        // or problem due to software latency (i.e. handled BCMATCH, CRCERROR, CRCOK from two
+        // consecutively received frames).
+        request_preconditions_for_state(m_state);
+        rx_init();
 
-        default:
-            assert(false);
+#if NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+        if ((filter_result == NRF_802154_RX_ERROR_RUNTIME) ||
+            filter_error_is_notified(p_received_data, filter_result))
+        {
+            receive_failed_notify(filter_result);
+        }
+#else // NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
+        receive_failed_notify(NRF_802154_RX_ERROR_RUNTIME);
+#endif  // NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_BCC_MATCHING_SINGLE_PASS_ENABLED
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-static void on_timeslot_started(void)
+void nrf_802154_trx_transmit_frame_started(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    nrf_802154_trx_enable();
+    assert((m_state == RADIO_STATE_TX) || (m_state == RADIO_STATE_CCA_TX));
 
-    m_rsch_timeslot_is_granted = true;
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+    nrf_802154_stat_channel_counter_increment(stat_channel_get(), tx_attempts);
+#endif
 
-    nrf_802154_timer_coord_start();
+    transmit_started_notify();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-static bool preconditions_approved_should_be_ignored(rsch_prio_t previously_approved_prio,
-                                                     rsch_prio_t currently_approved_prio)
+void nrf_802154_trx_transmit_ack_started(void)
 {
-    // Approved preconditions should only be ignored only all the following conditions are met:
-    // * all preconditions apart from Coex had already been approved;
-    // * the call is a result of Coex becoming approved at the highest priority;
-    // * currently performed operation is transmission with CCA;
-    // * Coex for transmission is requested after CCA reports idle channel
-    bool only_coex_was_unapproved       = (previously_approved_prio == RSCH_PRIO_RX);
-    bool all_preconditions_are_approved = (currently_approved_prio == RSCH_PRIO_MAX);
-    bool current_state_is_cca_tx        = (m_state == RADIO_STATE_CCA_TX);
-    bool coex_tx_request_mode_allows    = (m_coex_tx_request_mode ==
-                                           NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE);
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    return (only_coex_was_unapproved &&
-            all_preconditions_are_approved &&
-            current_state_is_cca_tx &&
-            coex_tx_request_mode_allows);
+    assert(m_state == RADIO_STATE_TX_ACK);
+    nrf_802154_tx_ack_started(mp_ack);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_rsch_crit_sect_prio_changed(rsch_prio_t prio)
+void nrf_802154_trx_transmit_ack_transmitted(void)
 {
-    rsch_prio_t old_prio = m_rsch_priority;
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    m_rsch_priority = prio;
+    assert(m_state == RADIO_STATE_TX_ACK);
 
-    if ((old_prio == RSCH_PRIO_IDLE) && (prio != RSCH_PRIO_IDLE))
-    {
-        // We have just got a timeslot.
-        on_timeslot_started();
-    }
-    else if ((old_prio != RSCH_PRIO_IDLE) && (prio == RSCH_PRIO_IDLE))
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+    uint32_t t_transmit = TX_RAMP_UP_TIME + nrf_802154_frame_duration_get(mp_ack[PHR_OFFSET],
+                                                                          true,
+                                                                          true);
+    uint32_t level = nrf_802154_stat_tx_power_level_get(nrf_802154_pib_tx_power_dbm_get());
+
+    nrf_802154_stat_totals_increment(total_transmit_time, t_transmit);
+    nrf_802154_stat_totals_increment(total_ramp_up_time, TX_RAMP_UP_TIME);
+    nrf_802154_stat_totals_increment(total_transmit_time_per_power[level], t_transmit);
+#endif
+
+    m_rx_metadata.ack_fpb = (mp_ack[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT) != 0;
+
+    if (m_flags.rx_duplicate)
     {
-        // We are giving back timeslot.
-        on_timeslot_ended();
+        // The frame is already acknowledged, the buffer is reused for the next frame.
+        nrf_802154_stat_counter_increment(duplicate_frames);
+
+        state_set(RADIO_STATE_RX);
+
+        rx_init();
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
         return;
     }
-    else if (prio == RSCH_PRIO_IDLE)
-    {
-        // It might happen that even though IDLE has already been notified, this function is called
-        // again as a result of preemptions caused by unexpected timeslot change (e.g. the application
-        // requested transition to sleep while out of timeslot and RAAL notified timeslot start
-        // in the middle of that sleep request). The following block makes RAAL finish its processing.
-        nrf_802154_rsch_continuous_ended();
-    }
-    else
-    {
-        // Intentionally empty
-    }
-
-    int_fast8_t transition = action_needed(old_prio, prio, m_state);
 
-    if (transition == 0)
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+    if (m_flags.rx_data_request)
     {
+        data_request_handle();
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
         return;
     }
-    else if (transition < 0)
-    {
-        on_preconditions_denied(m_state);
+#endif
 
-        // After denying preconditions, TRX is disabled. However, it is possible that the existing
-        // preconditions are enough for the new state (entered due to denied preconditions) and TRX
-        // could be enabled for the new state. If this is the case, on_preconditions_approved() is
-        // called to fully switch to the new state.
-        radio_state_t new_state = m_state;
+    // Current buffer used for receive operation or its copy will be passed to the application
+    uint8_t * p_received_data = rx_buffer_frame_take();
 
-        if (is_state_allowed_for_prio(prio, new_state))
-        {
-            on_preconditions_approved(new_state);
-        }
-    }
-    else
+    if (!m_rx_metadata.ack_fpb || !indirect_frame_start(p_received_data))
     {
-        if (!preconditions_approved_should_be_ignored(old_prio, prio))
-        {
-            on_preconditions_approved(m_state);
-        }
+        state_set(RADIO_STATE_RX);
+
+        rx_init();
     }
+
+    received_frame_notify_and_nesting_allow(p_received_data);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-/***************************************************************************************************
- * @section RADIO interrupt handler
- **************************************************************************************************/
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
 
-void nrf_802154_trx_receive_ack_started(void)
+static void on_lpl_timeout(void * p_context);
+
+/** Arm the timer of the next low-power listening transition. */
+static void lpl_timer_start(uint32_t t0, uint32_t dt)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_timer_sched_remove(&m_lpl_timer, NULL);
 
-    assert(m_state == RADIO_STATE_RX_ACK);
-    nrf_802154_core_hooks_rx_ack_started();
+    m_lpl_timer.t0        = t0;
+    m_lpl_timer.dt        = dt;
+    m_lpl_timer.callback  = on_lpl_timeout;
+    m_lpl_timer.p_context = NULL;
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_timer_sched_add(&m_lpl_timer, false);
 }
 
-static void on_rx_prestarted_timeout(void * p_context)
+/** Start sampling the channel energy in the low-power listening mode. */
+static void lpl_sample_start(void)
 {
-    (void)p_context;
+    uint32_t sample_us = nrf_802154_pib_lpl_sample_time_get();
 
-    /* If we were in critical section this handler would not be called.
-     * If we were outside of critical section this handler could be called,
-     * and nrf_802154_critical_section_enter must succeed.
-     * Justification:
-     * - If higher priority interrupt preempts this handler before it takes critical section, that
-     * interrupt may enter/exit critical section, but when it returns to this handler
-     * entering critical section will succeed.
-     * - If we entered critical section here the higher priority interrupt from radio
-     * will not occur.
-     * - The only related interrupt that can preempt this handler while it owns critical section
-     * is from raal timeslot margin, which will fail to enter critical section and schedule
-     * priority change to be called by nrf_802154_critical_section_exit.
-     *
-     * Critical section is entered forcefully here nonetheless, due to a rare issue with
-     * nrf_802154_critical_section_exit being preempted before the nested critical section counter
-     * could be decremented. Allowing for critical section nesting here resolves the problem.
-     * TODO: After the bug is fixed, change to nrf_802154_critical_section_enter and check if
-     * critical section was successfully entered.
-     */
+    m_lpl_sample_time   = nrf_802154_timer_sched_time_get();
+    m_ed_time_left      = (sample_us < ED_ITER_DURATION) ? ED_ITER_DURATION : sample_us;
+    m_ed_result         = 0;
+    m_ed_sweep_mask     = 0U;
+    m_ed_sweep_channels = 0U;
 
-    nrf_802154_critical_section_forcefully_enter();
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+    ed_ext_reset();
+#endif
 
-    nrf_802154_sl_ant_div_rx_preamble_timeout_notify();
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+    memset(m_ed_antenna_results, 0, sizeof(m_ed_antenna_results));
+#endif
 
-    /**
-     * If timer is still running here, it means that timer handling has been preempted by HELPER1
-     * radio event after removing the timer from scheduler, but before handling this callback.
-     * In that case, process the timeout as usual, but notify antenna diversity module that another
-     * preamble was detected in order to repeat RSSI measurements.
-     */
-    if (nrf_802154_timer_sched_is_running(&m_rx_prestarted_timer))
+    state_set(RADIO_STATE_ED);
+    ed_init();
+}
+
+/** Sleep until the next low-power listening sample, which starts @p dt after @p t0. */
+static void lpl_sleep(uint32_t t0, uint32_t dt)
+{
+    // The order of calls in the following blocks is inverted to avoid RAAL races.
+    if (timeslot_is_granted())
     {
-        nrf_802154_sl_ant_div_rx_preamble_detected_notify();
+        state_set(RADIO_STATE_FALLING_ASLEEP);
+        falling_asleep_init();
+    }
+    else
+    {
+        sleep_init();
+        state_set(RADIO_STATE_SLEEP);
     }
 
-    /* If nrf_802154_trx_receive_frame_prestarted boosted preconditions beyond those normally
-     * required by current state, they need to be restored now.
-     */
-    if (nrf_802154_pib_coex_rx_request_mode_get() ==
-        NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION)
+    lpl_timer_start(t0, dt);
+}
+
+/**
+ * @brief Handle the end of the energy detection in the low-power listening mode.
+ *
+ * @retval  true   The energy detection was a low-power listening sample and it was handled.
+ * @retval  false  The low-power listening mode is not active.
+ */
+static bool lpl_sample_finished(void)
+{
+    if (!m_flags.lpl)
+    {
+        return false;
+    }
+
+    nrf_802154_cca_cfg_t cca_cfg;
+
+    nrf_802154_pib_cca_cfg_get(&cca_cfg);
+
+    if (m_ed_result > cca_cfg.ed_threshold)
+    {
+        state_set(RADIO_STATE_RX);
+        rx_init();
+
+        lpl_timer_start(nrf_802154_timer_sched_time_get(), nrf_802154_pib_lpl_hold_time_get());
+    }
+    else
     {
-        request_preconditions_for_state(m_state);
+        lpl_sleep(m_lpl_sample_time, nrf_802154_pib_lpl_period_get());
     }
-    nrf_802154_critical_section_exit();
+
+    return true;
 }
 
-void nrf_802154_trx_receive_frame_prestarted(void)
+/** Perform the next low-power listening transition. */
+static void on_lpl_timeout(void * p_context)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    (void)p_context;
 
-    if (!antenna_diversity_is_enabled())
+    bool retry = m_flags.lpl;
+
+    if (retry && nrf_802154_critical_section_enter())
     {
-        // Only assert if notifications mask would not allow for calling this function.
-        assert((m_trx_receive_frame_notifications_mask & TRX_RECEIVE_NOTIFICATION_PRESTARTED) !=
-               0U);
+        if (m_state == RADIO_STATE_SLEEP)
+        {
+            lpl_sample_start();
+            retry = false;
+        }
+        else if ((m_state == RADIO_STATE_RX) &&
+                 current_operation_terminate(NRF_802154_TERM_NONE, REQ_ORIG_CORE, false))
+        {
+            // Terminating the reception ended the mode, but it continues with the next sample.
+            m_flags.lpl = true;
+
+            lpl_sleep(nrf_802154_timer_sched_time_get(), nrf_802154_pib_lpl_period_get());
+            retry = false;
+        }
+        else
+        {
+            // A frame is being received or the driver is busy. Retry when it is done.
+        }
+
+        nrf_802154_critical_section_exit();
     }
-    else
+
+    if (retry)
     {
-        // Antenna diversity uses this function for detecting possible preamble on air.
+        lpl_timer_start(nrf_802154_timer_sched_time_get(), LPL_RETRY_TIME_US);
     }
+}
 
-    assert(m_state == RADIO_STATE_RX);
-
-#if (NRF_802154_STATS_COUNT_ENERGY_DETECTED_EVENTS)
-    nrf_802154_stat_counter_increment(received_energy_events);
-#endif
-
-    nrf_802154_sl_ant_div_rx_preamble_detected_notify();
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
 
-    // Antenna diversity module should be notified if framestart doesn't come.
-    bool rx_timeout_should_be_started = antenna_diversity_is_enabled();
+/** Put the radio to sleep when the receive window following a transmission ends. */
+static void on_post_tx_rx_window_timeout(void * p_context)
+{
+    (void)p_context;
 
-    if (nrf_802154_pib_coex_rx_request_mode_get() ==
-        NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION)
+    if (m_flags.post_tx_rx_window && !nrf_802154_core_sleep(NRF_802154_TERM_NONE))
     {
-        // Request boosted preconditions for receive
-        nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
-        // Boosted preconditions should be reverted if the framestart doesn't come.
-        rx_timeout_should_be_started = true;
+        // A frame is being received or the driver is busy. Retry when it is done.
+        m_post_tx_rx_window_timer.t0 = nrf_802154_timer_sched_time_get();
+        m_post_tx_rx_window_timer.dt = POST_TX_RX_WINDOW_RETRY_TIME_US;
+
+        nrf_802154_timer_sched_add(&m_post_tx_rx_window_timer, false);
     }
+}
 
-    /*
-     * This handler might not be followed by nrf_802154_trx_receive_frame_started. The timer
-     * below is used for timing out if the framestart doesn't come.
-     * There are two reasons for that: reverting boosted preconditions and notifying antenna diversity
-     * module.
-     */
-    if (rx_timeout_should_be_started)
+/** Enter the state selected to follow successful transmissions. */
+static void post_tx_state_enter(void)
+{
+    switch (nrf_802154_pib_post_tx_state_get())
     {
+        case NRF_802154_POST_TX_STATE_SLEEP:
+            sleep_mode_select();
+            state_set(RADIO_STATE_FALLING_ASLEEP);
+            falling_asleep_init();
+            break;
 
-        uint32_t now = nrf_802154_timer_sched_time_get();
+        case NRF_802154_POST_TX_STATE_RX_WINDOW:
+            state_set(RADIO_STATE_RX);
+            rx_init();
 
-        nrf_802154_timer_sched_remove(&m_rx_prestarted_timer, NULL);
+            nrf_802154_timer_sched_remove(&m_post_tx_rx_window_timer, NULL);
 
-        m_rx_prestarted_timer.t0       = now;
-        m_rx_prestarted_timer.dt       = PRESTARTED_TIMER_TIMEOUT_US;
-        m_rx_prestarted_timer.callback = on_rx_prestarted_timeout;
+            m_flags.post_tx_rx_window = true;
 
-        nrf_802154_timer_sched_add(&m_rx_prestarted_timer, true);
-    }
+            m_post_tx_rx_window_timer.t0        = nrf_802154_timer_sched_time_get();
+            m_post_tx_rx_window_timer.dt        = nrf_802154_pib_post_tx_rx_window_get();
+            m_post_tx_rx_window_timer.callback  = on_post_tx_rx_window_timeout;
+            m_post_tx_rx_window_timer.p_context = NULL;
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+            nrf_802154_timer_sched_add(&m_post_tx_rx_window_timer, false);
+            break;
+
+        default:
+            state_set(RADIO_STATE_RX);
+            rx_init();
+            break;
+    }
 }
 
-void nrf_802154_trx_receive_frame_started(void)
+void nrf_802154_trx_transmit_frame_transmitted(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    assert(m_state == RADIO_STATE_RX);
-    assert((m_trx_receive_frame_notifications_mask & TRX_RECEIVE_NOTIFICATION_STARTED) != 0U);
+#if NRF_802154_LATENCY_STATS_ENABLED
+    nrf_802154_stat_latency_start_mark(NRF_802154_STAT_LATENCY_TX_COMPLETION);
+#endif
+
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+    uint32_t t_listening = 0U;
+    uint32_t t_transmit  = 0U;
+    uint32_t t_ramp_up   = 0U;
 
-#if (NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES)
-    nrf_802154_stat_counter_increment(received_preambles);
 #endif
 
-    switch (nrf_802154_pib_coex_rx_request_mode_get())
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+    uint32_t ts = timer_coord_timestamp_get();
+
+    // ts holds now timestamp of the PHYEND event
+    nrf_802154_stat_timestamp_write(last_tx_end_timestamp, ts);
+
+    if (m_flags.tx_with_cca)
     {
-        case NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION:
-            nrf_802154_timer_sched_remove(&m_rx_prestarted_timer, NULL);
-        /* Fallthrough */
+        m_flags.tx_diminished_prio = false;
 
-        case NRF_802154_COEX_RX_REQUEST_MODE_PREAMBLE:
-            /* Request boosted preconditions */
-            nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
-            break;
+        // We calculate the timestamp when ccaidle must happened.
+        ts -= nrf_802154_frame_duration_get(mp_tx_data[0], true, true) + RX_TX_TURNAROUND_TIME;
 
-        default:
-            break;
-    }
+        nrf_802154_stat_timestamp_write(last_cca_idle_timestamp, ts);
 
-    if (antenna_diversity_is_enabled())
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+        t_listening += RX_RAMP_UP_TIME +
+                       (ts - nrf_802154_stat_timestamp_read(last_cca_start_timestamp));
+        t_transmit += RX_TX_TURNAROUND_TIME;
+        t_ramp_up  += RX_RAMP_UP_TIME;
+#endif
+    }
+    else
     {
-        // If antenna diversity is enabled, rx_prestarted_timer would be started even
-        // in different coex rx request modes than NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION
-        nrf_802154_timer_sched_remove(&m_rx_prestarted_timer, NULL);
-        nrf_802154_sl_ant_div_rx_frame_started_notify();
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+        t_transmit += TX_RAMP_UP_TIME;
+        t_ramp_up  += TX_RAMP_UP_TIME;
+#endif
     }
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-}
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+    t_transmit += nrf_802154_frame_duration_get(mp_tx_data[PHR_OFFSET], true, true);
 
-#if !NRF_802154_DISABLE_BCC_MATCHING
-uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
-{
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    uint32_t level = nrf_802154_stat_tx_power_level_get(m_tx_power_dbm);
 
-    uint8_t               prev_num_data_bytes;
-    uint8_t               num_data_bytes;
-    nrf_802154_rx_error_t filter_result;
-    bool                  frame_accepted = true;
+    nrf_802154_stat_totals_increment(total_listening_time, t_listening);
+    nrf_802154_stat_totals_increment(total_transmit_time, t_transmit);
+    nrf_802154_stat_totals_increment(total_ramp_up_time, t_ramp_up);
+    nrf_802154_stat_totals_increment(total_transmit_time_per_power[level], t_transmit);
+#endif
+#endif
 
-    num_data_bytes      = bcc;
-    prev_num_data_bytes = num_data_bytes;
+    if (ack_is_requested(mp_tx_data))
+    {
+        state_set(RADIO_STATE_RX_ACK);
 
-    assert(num_data_bytes >= PHR_SIZE + FCF_SIZE);
-    assert(m_state == RADIO_STATE_RX);
+        bool rx_buffer_free = rx_buffer_is_available();
 
-    if (!m_flags.frame_filtered)
-    {
-        filter_result = nrf_802154_filter_frame_part(mp_current_rx_buffer->data,
-                                                     &num_data_bytes);
+        nrf_802154_trx_receive_buffer_set(rx_buffer_get());
 
-        if (filter_result == NRF_802154_RX_ERROR_NONE)
-        {
-            if (num_data_bytes != prev_num_data_bytes)
-            {
-                bcc = num_data_bytes;
-            }
-            else
-            {
-                m_flags.frame_filtered = true;
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED) && !NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+        // Configure the timer coordinator to get a timestamp of the END event which
+        // fires several cycles after CRCOK or CRCERROR events.
+        nrf_802154_timer_coord_timestamp_prepare(
+            nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_END));
+#else
+        // Configure the timer coordinator to get a timestamp of the CRCOK event.
+        nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
+                                                                             NRF_RADIO_EVENT_CRCOK));
+#endif
+#endif
 
-                /* Request boosted preconditions */
-                nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
-            }
-        }
-        else if ((filter_result == NRF_802154_RX_ERROR_INVALID_LENGTH) ||
-                 (!nrf_802154_pib_promiscuous_get()))
-        {
-            trx_abort();
-            rx_init();
+#if NRF_802154_ACK_TIMEOUT_ENABLED && NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+        nrf_802154_trx_receive_ack_timeout_set(nrf_802154_ack_timeout_hw_time_get());
+#endif
 
-            frame_accepted = false;
+        nrf_802154_trx_receive_ack();
 
-            /* Release boosted preconditions */
-            request_preconditions_for_state(m_state);
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+        m_listening_start_hp_timestamp = nrf_802154_hp_timer_current_time_get();
+#endif
 
-            if ((mp_current_rx_buffer->data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) !=
-                FRAME_TYPE_ACK)
-            {
-                receive_failed_notify(filter_result);
-            }
-        }
-        else
+        if (!rx_buffer_free)
         {
-            // Promiscuous mode, allow incorrect frames. Nothing to do here.
+            rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+
+            nrf_802154_trx_receive_buffer_set(rx_buffer_get());
         }
-    }
 
-    if ((!m_flags.rx_timeslot_requested) && (frame_accepted))
+        rx_buffer_next_prepare();
+    }
+    else
     {
-        if (nrf_802154_rsch_timeslot_request(nrf_802154_rx_duration_get(
-                                                 mp_current_rx_buffer->data[0],
-                                                 ack_is_requested(mp_current_rx_buffer->data))))
-        {
-            m_flags.rx_timeslot_requested = true;
-
-            receive_started_notify();
-        }
-        else
-        {
-            // Disable receiver and wait for a new timeslot.
-            trx_abort();
+        const uint8_t * p_frame = mp_tx_data;
 
-            // We should not leave trx in temporary state, let's receive then.
-            // We avoid hard reset of radio during TX ACK phase due to timeslot end,
-            // which could result in spurious RF emission.
-            rx_init();
+        transmitted_frame_hooks_notify();
 
-            nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
+        if (!tx_queue_next_start())
+        {
+            post_tx_state_enter();
         }
+
+        transmitted_frame_notify(p_frame, NULL, 0, 0);
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-
-    return bcc;
 }
 
-#endif
-
-void nrf_802154_trx_go_idle_finished(void)
+static bool ack_match_check_version_not_2(const uint8_t * p_tx_data, const uint8_t * p_ack_data)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
-
-    sleep_init();
-    state_set(RADIO_STATE_SLEEP);
-
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-}
+    // Frame Version != 2
 
-static void on_bad_ack(void);
+    // Check: Phy length
+    if (p_ack_data[PHR_OFFSET] != IMM_ACK_LENGTH)
+    {
+        return false;
+    }
 
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-static void update_total_times_on_receive_end(uint32_t listening_start_hp_timestamp,
-                                              uint32_t receive_end_hp_timestamp, uint8_t phr)
-{
-    uint32_t t_listening;
-    uint32_t t_frame;
+    // Check if Frame version is 0 or 1.
+    switch (p_ack_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK)
+    {
+        case FRAME_VERSION_0:
+        case FRAME_VERSION_1:
+            break;
 
-    t_frame     = nrf_802154_frame_duration_get(phr, true, true);
-    t_listening = receive_end_hp_timestamp - listening_start_hp_timestamp;
+        default:
+            return false;
+    }
 
-    if (t_frame > t_listening)
+    // Check: Sequence number match
+    if (p_ack_data[DSN_OFFSET] != p_tx_data[DSN_OFFSET])
     {
-        t_frame = t_listening;
+        return false;
     }
 
-    t_listening -= t_frame;
-
-    nrf_802154_stat_totals_increment(total_listening_time, t_listening);
-    nrf_802154_stat_totals_increment(total_receive_time, t_frame);
+    return true;
 }
 
-#endif
-
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-void nrf_802154_stat_totals_get_notify(void)
+static bool ack_match_check_version_2(const uint8_t * p_tx_data, const uint8_t * p_ack_data)
 {
-    // Total times are going to be read, update stat_totals to hold
-    // correct times until now.
-
-    nrf_802154_mcu_critical_state_t mcu_cs;
+    if ((p_ack_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) != FRAME_VERSION_2)
+    {
+        return false;
+    }
 
-    nrf_802154_mcu_critical_enter(mcu_cs);
+    // Transmitted frame was Version 2
+    // For frame version 2 sequence number bit may be suppressed and its check fails.
+    // Verify ACK frame using its destination address.
+    nrf_802154_frame_parser_mhr_data_t tx_mhr_data;
+    nrf_802154_frame_parser_mhr_data_t ack_mhr_data;
+    bool                               parse_result;
 
-    trx_state_t trx_state = nrf_802154_trx_state_get();
+    parse_result = nrf_802154_frame_parser_mhr_parse(p_tx_data, &tx_mhr_data);
+    assert(parse_result);
+    parse_result = nrf_802154_frame_parser_mhr_parse(p_ack_data, &ack_mhr_data);
 
-    if ((trx_state == TRX_STATE_RXFRAME) || (trx_state == TRX_STATE_RXACK))
+    if (!parse_result ||
+        (tx_mhr_data.p_src_addr == NULL) ||
+        (ack_mhr_data.p_dst_addr == NULL) ||
+        (tx_mhr_data.src_addr_size != ack_mhr_data.dst_addr_size) ||
+        (0 != memcmp(tx_mhr_data.p_src_addr,
+                     ack_mhr_data.p_dst_addr,
+                     tx_mhr_data.src_addr_size)))
     {
-        uint32_t listening_end_timestamp = nrf_802154_hp_timer_current_time_get();
-
-        if (listening_end_timestamp - m_listening_start_hp_timestamp >= MAX_PHY_FRAME_TIME_US)
-        {
-            /* m_listening_start_hp_timestamp ... now - MAX_PHY_FRAME_TIME_US must be listening.
-             * Last MAX_PHY_FRAME_TIME_US is considered uncertain.
-             */
-            listening_end_timestamp -= MAX_PHY_FRAME_TIME_US;
+        // Mismatch
+        return false;
+    }
 
-            uint32_t t_listening = listening_end_timestamp - m_listening_start_hp_timestamp;
+    return true;
+}
 
-            m_listening_start_hp_timestamp = listening_end_timestamp;
+static bool ack_match_check(const uint8_t * p_tx_data, const uint8_t * p_ack_data)
+{
+    if ((p_tx_data == NULL) || (p_ack_data == NULL))
+    {
+        return false;
+    }
 
-            nrf_802154_stat_totals_increment(total_listening_time, t_listening);
-        }
-        else
-        {
-            /* Too little time passed since m_listening_start_hp_timestamp, we don't know
-             * if frame is being received now until it is received. */
-        }
+    // Check: Frame Control Field -> Frame type
+    if ((p_ack_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK)
+    {
+        return false; // This is not an ACK frame
     }
 
-    nrf_802154_mcu_critical_exit(mcu_cs);
+    // Check: Frame Control Field -> Frame version
+    if ((p_tx_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2)
+    {
+        return ack_match_check_version_2(p_tx_data, p_ack_data);
+    }
 
+    return ack_match_check_version_not_2(p_tx_data, p_ack_data);
 }
 
-#endif
-
-void nrf_802154_trx_receive_frame_crcerror(void)
+static void on_bad_ack(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-    uint32_t receive_end_hp_timestamp     = nrf_802154_hp_timer_timestamp_get();
-    uint32_t listening_start_hp_timestamp = m_listening_start_hp_timestamp;
-
-#endif
-
-    assert(m_state == RADIO_STATE_RX);
-    rx_flags_clear();
-
-    // We don't change receive buffer, receive will go to the same that was already used
-#if !NRF_802154_DISABLE_BCC_MATCHING
-    request_preconditions_for_state(m_state);
-    nrf_802154_trx_receive_frame(BCC_INIT / 8U, m_trx_receive_frame_notifications_mask);
-
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-    m_listening_start_hp_timestamp = nrf_802154_hp_timer_current_time_get();
-
-    // Configure the timer coordinator to get a timestamp of the END event which
-    // fires several cycles after CRCOK or CRCERROR events.
-    nrf_802154_timer_coord_timestamp_prepare(
-        nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_END));
-#endif
-
-#else
-    // With BCC matching disabled trx module will re-arm automatically
-#endif
+    // We received either a frame with incorrect CRC or not an ACK frame or not matching ACK
+    state_set(RADIO_STATE_RX);
 
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-    update_total_times_on_receive_end(listening_start_hp_timestamp, receive_end_hp_timestamp,
-                                      mp_current_rx_buffer->data[PHR_OFFSET]);
-#endif
+    rx_init();
 
-#if NRF_802154_NOTIFY_CRCERROR
-    receive_failed_notify(NRF_802154_RX_ERROR_INVALID_FCS);
-#endif // NRF_802154_NOTIFY_CRCERROR
+    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_INVALID_ACK);
+    tx_queue_resume();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_receive_ack_crcerror(void)
+#if NRF_802154_ACK_TIMEOUT_ENABLED && NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+void nrf_802154_trx_receive_ack_timeout(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
     assert(m_state == RADIO_STATE_RX_ACK);
 
 #if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-    uint32_t receive_end_hp_timestamp     = nrf_802154_hp_timer_timestamp_get();
-    uint32_t listening_start_hp_timestamp = m_listening_start_hp_timestamp;
-
-    update_total_times_on_receive_end(listening_start_hp_timestamp, receive_end_hp_timestamp,
-                                      mp_current_rx_buffer->data[PHR_OFFSET]);
+    nrf_802154_stat_totals_increment(total_listening_time,
+                                     nrf_802154_hp_timer_current_time_get() -
+                                     m_listening_start_hp_timestamp);
 #endif
 
-    on_bad_ack();
+    state_set(RADIO_STATE_RX);
+
+    rx_init();
+
+    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_NO_ACK);
+    tx_queue_resume();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_receive_frame_received(void)
+#endif // NRF_802154_ACK_TIMEOUT_ENABLED && NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
+void nrf_802154_trx_receive_ack_received(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    uint8_t * p_received_data = mp_current_rx_buffer->data;
+#if NRF_802154_LATENCY_STATS_ENABLED
+    // The transmission is complete when the ACK is received.
+    nrf_802154_stat_latency_start_mark(NRF_802154_STAT_LATENCY_TX_COMPLETION);
+#endif
+
+    // CRC of received frame is correct
+    uint8_t * p_ack_data = mp_current_rx_buffer->data;
 
 #if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-    uint32_t receive_end_hp_timestamp     = nrf_802154_hp_timer_timestamp_get();
+    uint32_t receive_end_hp_timestamp     = frame_end_hp_timestamp_get();
     uint32_t listening_start_hp_timestamp = m_listening_start_hp_timestamp;
 
     update_total_times_on_receive_end(listening_start_hp_timestamp, receive_end_hp_timestamp,
                                       mp_current_rx_buffer->data[PHR_OFFSET]);
 #endif
 
-#if NRF_802154_DISABLE_BCC_MATCHING
-    uint8_t               num_data_bytes      = PHR_SIZE + FCF_SIZE;
-    uint8_t               prev_num_data_bytes = 0;
-    nrf_802154_rx_error_t filter_result;
-
-    // Frame filtering
-    while (num_data_bytes != prev_num_data_bytes)
+    if (ack_match_check(mp_tx_data, p_ack_data))
     {
-        prev_num_data_bytes = num_data_bytes;
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+        uint32_t ts = frame_end_timestamp_get();
 
-        // Keep checking consecutive parts of the frame header.
-        filter_result = nrf_802154_filter_frame_part(mp_current_rx_buffer->data, &num_data_bytes);
+        nrf_802154_stat_timestamp_write(last_ack_end_timestamp, ts);
 
-        if (filter_result == NRF_802154_RX_ERROR_NONE)
+#if NRF_802154_CSL_TX_ENABLED
+        if (ts != NRF_802154_NO_TIMESTAMP)
         {
-            if (num_data_bytes == prev_num_data_bytes)
-            {
-                m_flags.frame_filtered = true;
-            }
-        }
-        else
-        {
-            break;
-        }
-    }
-
-    // Timeslot request
-    if (m_flags.frame_filtered &&
-        ack_is_requested(p_received_data) &&
-        !nrf_802154_rsch_timeslot_request(nrf_802154_rx_duration_get(0, true)))
-    {
-        // Frame is destined to this node but there is no timeslot to transmit ACK.
-        // Just disable receiver and wait for a new timeslot.
-        nrf_802154_trx_abort();
-
-        rx_flags_clear();
+            uint32_t sfd_time = ts - nrf_802154_frame_duration_get(p_ack_data[PHR_OFFSET],
+                                                                   false,
+                                                                   true);
+            uint64_t sfd_time64 = nrf_802154_time64_extend(nrf_802154_lp_timer_time64_get(),
+                                                           sfd_time);
 
-        // Filter out received ACK frame if promiscuous mode is disabled.
-        if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
-            nrf_802154_pib_promiscuous_get())
-        {
-            mp_current_rx_buffer->free = false;
-            received_frame_notify_and_nesting_allow(p_received_data);
+            nrf_802154_csl_tx_ack_received(mp_tx_data, p_ack_data, sfd_time64);
         }
-
-        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-        return;
-    }
-#endif // NRF_802154_DISABLE_BCC_MATCHING
-
-    if (m_flags.frame_filtered || nrf_802154_pib_promiscuous_get())
-    {
-        nrf_802154_stat_counter_increment(received_frames);
-
-#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-        uint32_t ts = timer_coord_timestamp_get();
-
-        nrf_802154_stat_timestamp_write(last_rx_end_timestamp, ts);
+#endif
 #endif
 
-        nrf_802154_sl_ant_div_rx_frame_received_notify();
+        const uint8_t * p_frame = mp_tx_data;
+        int8_t          power   = rssi_last_measurement_get();
 
-        bool send_ack = false;
+        p_ack_data = rx_buffer_frame_take();
 
-        if (m_flags.frame_filtered &&
-            ack_is_requested(mp_current_rx_buffer->data) &&
-            nrf_802154_pib_auto_ack_get())
-        {
-            mp_ack = nrf_802154_ack_generator_create(mp_current_rx_buffer->data);
-            if (NULL != mp_ack)
-            {
-                send_ack = true;
-            }
-        }
+        transmitted_frame_hooks_notify();
 
-        if (send_ack)
+        if (!tx_queue_next_start())
         {
-            state_set(RADIO_STATE_TX_ACK);
-
-            if (is_state_allowed_for_prio(m_rsch_priority, RADIO_STATE_TX_ACK))
-            {
-                if (nrf_802154_trx_transmit_ack(mp_ack, ACK_IFS))
-                {
-                    // Intentionally empty: transmitting ack, because we can
-                }
-                else
-                {
-                    mp_current_rx_buffer->free = false;
-
-                    state_set(RADIO_STATE_RX);
-                    rx_init();
-
-                    received_frame_notify_and_nesting_allow(p_received_data);
-                }
-            }
-            else
-            {
-                if (!nrf_802154_rsch_prec_is_approved(RSCH_PREC_COEX,
-                                                      min_required_rsch_prio(RADIO_STATE_TX_ACK)))
-                {
-                    nrf_802154_stat_counter_increment(coex_denied_requests);
-                }
-
-                mp_current_rx_buffer->free = false;
-
-                state_set(RADIO_STATE_RX);
-                rx_init();
-
-                received_frame_notify_and_nesting_allow(p_received_data);
-            }
+            post_tx_state_enter();
         }
-        else
-        {
-            request_preconditions_for_state(m_state);
-            // Filter out received ACK frame if promiscuous mode is disabled.
-            if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
-                nrf_802154_pib_promiscuous_get())
-            {
-                // Current buffer will be passed to the application
-                mp_current_rx_buffer->free = false;
-
-                // Find new buffer
-                rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
 
-                rx_init();
-
-                received_frame_notify_and_nesting_allow(p_received_data);
-            }
-            else
-            {
-                // Receive to the same buffer
-                rx_init();
-            }
-        }
+        transmitted_frame_notify(p_frame,              // frame
+                                 p_ack_data,           // phr + psdu
+                                 power,                // rssi
+                                 lqi_get(p_ack_data)); // lqi
     }
     else
     {
-        // CRC is OK, but filtering operation did not end - it is invalid frame with valid CRC
-        // or problem due to software latency (i.e. handled BCMATCH, CRCERROR, CRCOK from two
-        // consecutively received frames).
-        request_preconditions_for_state(m_state);
-        rx_init();
-
-#if NRF_802154_DISABLE_BCC_MATCHING
-        if ((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK)
-        {
-            receive_failed_notify(filter_result);
-        }
-#else // NRF_802154_DISABLE_BCC_MATCHING
-        receive_failed_notify(NRF_802154_RX_ERROR_RUNTIME);
-#endif  // NRF_802154_DISABLE_BCC_MATCHING
+        on_bad_ack();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_transmit_frame_started(void)
+void nrf_802154_trx_standalone_cca_finished(bool channel_was_idle)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    assert((m_state == RADIO_STATE_TX) || (m_state == RADIO_STATE_CCA_TX));
-    transmit_started_notify();
-
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-}
-
-void nrf_802154_trx_transmit_ack_started(void)
-{
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+    if (channel_was_idle)
+    {
+        nrf_802154_stat_channel_counter_increment(stat_channel_get(), cca_idle);
+    }
+    else
+    {
+        nrf_802154_stat_channel_counter_increment(stat_channel_get(), cca_busy);
+    }
+#endif
 
-    assert(m_state == RADIO_STATE_TX_ACK);
-    nrf_802154_tx_ack_started(mp_ack);
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+    if (m_state == RADIO_STATE_CCA_TX)
+    {
+        // CCA on the other antenna preceding the transmission.
+        nrf_802154_trx_tx_antenna_select(NRF_802154_SL_ANT_DIV_ANTENNA_NONE);
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-}
+        if (channel_was_idle)
+        {
+            (void)tx_init(mp_tx_data, true);
+        }
+        else
+        {
+            nrf_802154_stat_counter_increment(cca_failed_attempts);
 
-void nrf_802154_trx_transmit_ack_transmitted(void)
-{
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+            state_set(RADIO_STATE_RX);
+            rx_init();
 
-    assert(m_state == RADIO_STATE_TX_ACK);
+            transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_BUSY_CHANNEL);
+            tx_queue_resume();
+        }
 
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-    uint32_t t_transmit = TX_RAMP_UP_TIME + nrf_802154_frame_duration_get(mp_ack[PHR_OFFSET],
-                                                                          true,
-                                                                          true);
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
 
-    nrf_802154_stat_totals_increment(total_transmit_time, t_transmit);
-#endif
+    if (channel_was_idle && !m_flags.cca_other_antenna && dual_assessment_is_enabled())
+    {
+        // Repeat the procedure on the other antenna.
+        m_flags.cca_other_antenna = true;
+        cca_init();
 
-    uint8_t * p_received_data = mp_current_rx_buffer->data;
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
 
-    // Current buffer used for receive operation will be passed to the application
-    mp_current_rx_buffer->free = false;
+    m_flags.cca_other_antenna = false;
+#endif
 
     state_set(RADIO_STATE_RX);
-
     rx_init();
 
-    received_frame_notify_and_nesting_allow(p_received_data);
+    cca_notify(channel_was_idle);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_transmit_frame_transmitted(void)
+void nrf_802154_trx_transmit_frame_ccastarted(void)
+{
+    // This handler provided by trx is never called because parameter notifications_mask
+    // of the nrf_802154_trx_transmit_frame does not contain TRX_TRANSMIT_NOTIFICATION_CCASTARTED.
+    assert(false);
+}
+
+void nrf_802154_trx_transmit_frame_ccaidle(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-    uint32_t t_listening = 0U;
-    uint32_t t_transmit  = 0U;
+    assert(m_state == RADIO_STATE_CCA_TX);
+    assert(m_trx_transmit_frame_notifications_mask & TRX_TRANSMIT_NOTIFICATION_CCAIDLE);
 
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+    nrf_802154_stat_channel_counter_increment(stat_channel_get(), cca_idle);
 #endif
 
 #if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
     uint32_t ts = timer_coord_timestamp_get();
 
-    // ts holds now timestamp of the PHYEND event
-    nrf_802154_stat_timestamp_write(last_tx_end_timestamp, ts);
+    // Configure the timer coordinator to get a timestamp of the PHYEND event.
+    nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
+                                                                         NRF_RADIO_EVENT_PHYEND));
 
-    if (m_flags.tx_with_cca)
+    // Update stat timestamp of CCASTART event
+    nrf_802154_stat_timestamp_write(last_cca_start_timestamp, ts);
+#endif
+
+    if (m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE)
     {
+        nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_TX);
         m_flags.tx_diminished_prio = false;
+    }
 
-        // We calculate the timestamp when ccaidle must happened.
-        ts -= nrf_802154_frame_duration_get(mp_tx_data[0], true, true) + RX_TX_TURNAROUND_TIME;
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
 
-        nrf_802154_stat_timestamp_write(last_cca_idle_timestamp, ts);
+void nrf_802154_trx_transmit_frame_ccabusy(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-        t_listening += RX_RAMP_UP_TIME +
-                       (ts - nrf_802154_stat_timestamp_read(last_cca_start_timestamp));
-        t_transmit += RX_TX_TURNAROUND_TIME;
-#endif
-    }
-    else
-    {
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-        t_transmit += TX_RAMP_UP_TIME;
+    nrf_802154_stat_counter_increment(cca_failed_attempts);
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+    nrf_802154_stat_channel_counter_increment(stat_channel_get(), cca_busy);
 #endif
-    }
 
 #if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-    t_transmit += nrf_802154_frame_duration_get(mp_tx_data[PHR_OFFSET], true, true);
+    uint32_t t_listening = RX_RAMP_UP_TIME + PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS);
 
     nrf_802154_stat_totals_increment(total_listening_time, t_listening);
-    nrf_802154_stat_totals_increment(total_transmit_time, t_transmit);
 #endif
-#endif
-
-    if (ack_is_requested(mp_tx_data))
-    {
-        state_set(RADIO_STATE_RX_ACK);
 
-        bool rx_buffer_free = rx_buffer_is_available();
+    state_set(RADIO_STATE_RX);
+    rx_init();
 
-        nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_BUSY_CHANNEL);
+    tx_queue_resume();
 
-#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-        // Configure the timer coordinator to get a timestamp of the END event which
-        // fires several cycles after CRCOK or CRCERROR events.
-        nrf_802154_timer_coord_timestamp_prepare(
-            nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_END));
-#else
-        // Configure the timer coordinator to get a timestamp of the CRCOK event.
-        nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
-                                                                             NRF_RADIO_EVENT_CRCOK));
-#endif
-#endif
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
 
-        nrf_802154_trx_receive_ack();
+void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-        m_listening_start_hp_timestamp = nrf_802154_hp_timer_current_time_get();
+#if NRF_802154_STATS_PER_CHANNEL_ENABLED
+    nrf_802154_stat_channel_counter_increment(stat_channel_get(), energy_detections);
 #endif
 
-        if (!rx_buffer_free)
-        {
-            rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
-
-            nrf_802154_trx_receive_buffer_set(rx_buffer_get());
-        }
-    }
-    else
+    if (m_ed_result < ed_sample)
     {
-        state_set(RADIO_STATE_RX);
-
-        rx_init();
-
-        transmitted_frame_notify(NULL, 0, 0);
+        // Collect maximum value of samples provided by trx
+        m_ed_result = ed_sample;
     }
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-}
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+    ed_ext_sample_add(ed_sample);
+#endif
 
-static bool ack_match_check_version_not_2(const uint8_t * p_tx_data, const uint8_t * p_ack_data)
-{
-    // Frame Version != 2
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+    nrf_802154_sl_ant_div_antenna_t antenna = nrf_802154_sl_ant_div_antenna_get();
 
-    // Check: Phy length
-    if (p_ack_data[PHR_OFFSET] != IMM_ACK_LENGTH)
+    if ((antenna < NRF_802154_SL_ANT_DIV_ANTENNA_NONE) &&
+        (m_ed_antenna_results[antenna] < ed_sample))
     {
-        return false;
+        m_ed_antenna_results[antenna] = ed_sample;
     }
+#endif
 
-    // Check if Frame version is 0 or 1.
-    switch (p_ack_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK)
+    if (m_ed_time_left >= ED_ITER_DURATION)
     {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            break;
+        uint32_t trx_ed_count = 0U;
 
-        default:
-            return false;
+        if (ed_iter_setup(&m_ed_time_left, &trx_ed_count))
+        {
+            nrf_802154_trx_energy_detection(trx_ed_count);
+        }
+        else
+        {
+            /* There is too little time in current timeslot, just wait for timeslot end.
+             * Operation will be resumed in next timeslot */
+        }
     }
-
-    // Check: Sequence number match
-    if (p_ack_data[DSN_OFFSET] != p_tx_data[DSN_OFFSET])
+    else if (nrf_802154_sl_ant_div_energy_detection_finished_notify())
     {
-        return false;
+        ed_init();
     }
-
-    return true;
-}
-
-static bool ack_match_check_version_2(const uint8_t * p_tx_data, const uint8_t * p_ack_data)
-{
-    if ((p_ack_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) != FRAME_VERSION_2)
+    else if (ed_sweep_next())
     {
-        return false;
+        ed_init();
     }
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+    else if (lpl_sample_finished())
+    {
+        // The sample result is processed internally and it is not notified.
+    }
+#endif
+    else
+    {
+        bool sweep = (m_ed_sweep_channels != 0U);
 
-    // Transmitted frame was Version 2
-    // For frame version 2 sequence number bit may be suppressed and its check fails.
-    // Verify ACK frame using its destination address.
-    nrf_802154_frame_parser_mhr_data_t tx_mhr_data;
-    nrf_802154_frame_parser_mhr_data_t ack_mhr_data;
-    bool                               parse_result;
+        m_ed_sweep_channels = 0U;
 
-    parse_result = nrf_802154_frame_parser_mhr_parse(p_tx_data, &tx_mhr_data);
-    assert(parse_result);
-    parse_result = nrf_802154_frame_parser_mhr_parse(p_ack_data, &ack_mhr_data);
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+        ed_ext_publish();
+#endif
 
-    if (!parse_result ||
-        (tx_mhr_data.p_src_addr == NULL) ||
-        (ack_mhr_data.p_dst_addr == NULL) ||
-        (tx_mhr_data.src_addr_size != ack_mhr_data.dst_addr_size) ||
-        (0 != memcmp(tx_mhr_data.p_src_addr,
-                     ack_mhr_data.p_dst_addr,
-                     tx_mhr_data.src_addr_size)))
-    {
-        // Mismatch
-        return false;
+        nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+
+        state_set(RADIO_STATE_RX);
+        rx_init();
+
+        if (sweep)
+        {
+            energy_sweep_done_notify();
+        }
+        else
+        {
+#if NRF_802154_CSMA_CA_ENABLED && NRF_802154_CSMA_CA_ADAPTIVE_ENABLED
+            nrf_802154_csma_ca_ed_sample_process(m_ed_result);
+#endif
+
+            energy_detected_notify(ed_result_get(m_ed_result));
+        }
     }
 
-    return true;
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-static bool ack_match_check(const uint8_t * p_tx_data, const uint8_t * p_ack_data)
+/***************************************************************************************************
+ * @section API functions
+ **************************************************************************************************/
+
+void nrf_802154_core_init(void)
 {
-    if ((p_tx_data == NULL) || (p_ack_data == NULL))
-    {
-        return false;
-    }
+    m_state                    = RADIO_STATE_SLEEP;
+    m_rsch_timeslot_is_granted = false;
 
-    // Check: Frame Control Field -> Frame type
-    if ((p_ack_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK)
-    {
-        return false; // This is not an ACK frame
-    }
+    nrf_802154_trx_init();
+    nrf_802154_ack_generator_init();
+}
 
-    // Check: Frame Control Field -> Frame version
-    if ((p_tx_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2)
+void nrf_802154_core_deinit(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (timeslot_is_granted())
     {
-        return ack_match_check_version_2(p_tx_data, p_ack_data);
+        nrf_802154_trx_disable();
     }
 
-    return ack_match_check_version_not_2(p_tx_data, p_ack_data);
-}
+    nrf_802154_fal_cleanup();
 
-static void on_bad_ack(void)
-{
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+#if NRF_802154_OCCUPANCY_MONITOR_ENABLED
+    nrf_802154_timer_sched_remove(&m_occupancy_timer, NULL);
+#endif
+
+#if NRF_802154_RSSI_STREAM_ENABLED
+    nrf_802154_timer_sched_remove(&m_rssi_stream_timer, NULL);
+#endif
+
+#if NRF_802154_PASSIVE_ED_ENABLED
+    nrf_802154_timer_sched_remove(&m_passive_ed_timer, NULL);
+    m_passive_ed_active = false;
+#endif
+
+    nrf_802154_timer_sched_remove(&m_post_tx_rx_window_timer, NULL);
 
-    // We received either a frame with incorrect CRC or not an ACK frame or not matching ACK
-    state_set(RADIO_STATE_RX);
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    nrf_802154_timer_sched_remove(&m_tx_queue_resume_timer, NULL);
+#endif
 
-    rx_init();
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+    nrf_802154_timer_sched_remove(&m_lpl_timer, NULL);
+#endif
 
-    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_INVALID_ACK);
+#if NRF_802154_LIGHT_SLEEP_THRESHOLD_US > 0
+    nrf_802154_timer_sched_remove(&m_light_sleep_timer, NULL);
+#endif
+
+    nrf_802154_irq_disable(RADIO_IRQn);
+    nrf_802154_irq_clear_pending(RADIO_IRQn);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_receive_ack_received(void)
+radio_state_t nrf_802154_core_state_get(void)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    return m_state;
+}
 
-    // CRC of received frame is correct
-    uint8_t * p_ack_data = mp_current_rx_buffer->data;
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+uint8_t nrf_802154_core_ed_antenna_result_get(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    if ((antenna >= NRF_802154_SL_ANT_DIV_ANTENNA_NONE) || (m_ed_antenna_results[antenna] == 0U))
+    {
+        // The energy was not sampled on the antenna.
+        return 0U;
+    }
 
-#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
-    uint32_t receive_end_hp_timestamp     = nrf_802154_hp_timer_timestamp_get();
-    uint32_t listening_start_hp_timestamp = m_listening_start_hp_timestamp;
+    return ed_result_get(m_ed_antenna_results[antenna]);
+}
 
-    update_total_times_on_receive_end(listening_start_hp_timestamp, receive_end_hp_timestamp,
-                                      mp_current_rx_buffer->data[PHR_OFFSET]);
 #endif
 
-    if (ack_match_check(mp_tx_data, p_ack_data))
+#if NRF_802154_RSSI_STREAM_ENABLED
+void nrf_802154_core_rssi_stream_start(void)
+{
+    // Restart the sampling with the new interval.
+    nrf_802154_timer_sched_remove(&m_rssi_stream_timer, NULL);
+
+    if (m_state == RADIO_STATE_RX)
     {
-#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-        uint32_t ts = timer_coord_timestamp_get();
+        rssi_stream_start();
+    }
+}
 
-        nrf_802154_stat_timestamp_write(last_ack_end_timestamp, ts);
 #endif
 
-        rx_buffer_t * p_ack_buffer = mp_current_rx_buffer;
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+void nrf_802154_core_tx_dsn_set(uint8_t dsn)
+{
+    m_tx_dsn = dsn;
+}
 
-        mp_current_rx_buffer->free = false;
+#endif
 
-        state_set(RADIO_STATE_RX);
-        rx_init();
+#if NRF_802154_PASSIVE_ED_ENABLED
+bool nrf_802154_core_energy_detection_passive(uint32_t time_us)
+{
+    bool result = false;
 
-        transmitted_frame_notify(p_ack_buffer->data,           // phr + psdu
-                                 rssi_last_measurement_get(),  // rssi
-                                 lqi_get(p_ack_buffer->data)); // lqi;
-    }
-    else
+    if (nrf_802154_critical_section_enter())
     {
-        on_bad_ack();
+        if ((m_state == RADIO_STATE_RX) && !m_passive_ed_active)
+        {
+            m_passive_ed_active  = true;
+            m_passive_ed_sampled = false;
+            m_passive_ed_start   = nrf_802154_timer_sched_time_get();
+            m_passive_ed_time    = time_us;
+
+            m_passive_ed_timer.t0        = m_passive_ed_start;
+            m_passive_ed_timer.dt        = NRF_802154_PASSIVE_ED_SAMPLE_PERIOD_US;
+            m_passive_ed_timer.callback  = on_passive_ed_timeout;
+            m_passive_ed_timer.p_context = NULL;
+
+            nrf_802154_timer_sched_add(&m_passive_ed_timer, false);
+
+            result = true;
+        }
+
+        nrf_802154_critical_section_exit();
     }
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
 }
 
-void nrf_802154_trx_standalone_cca_finished(bool channel_was_idle)
+#endif
+
+#if NRF_802154_PER_TEST_ENABLED
+void nrf_802154_core_per_test_transmit_set(uint32_t count, uint32_t interval_us)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_mcu_critical_state_t mcu_cs;
 
-    state_set(RADIO_STATE_RX);
-    rx_init();
+    nrf_802154_mcu_critical_enter(mcu_cs);
 
-    cca_notify(channel_was_idle);
+    nrf_802154_trx_per_test_transmit_set(count, interval_us);
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_mcu_critical_exit(mcu_cs);
 }
 
-void nrf_802154_trx_transmit_frame_ccastarted(void)
+uint32_t nrf_802154_core_per_test_transmit_remaining_get(void)
 {
-    // This handler provided by trx is never called because parameter notifications_mask
-    // of the nrf_802154_trx_transmit_frame does not contain TRX_TRANSMIT_NOTIFICATION_CCASTARTED.
-    assert(false);
+    return nrf_802154_trx_per_test_transmit_remaining_get();
 }
 
-void nrf_802154_trx_transmit_frame_ccaidle(void)
+void nrf_802154_core_per_test_receive_set(bool enabled)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_mcu_critical_state_t mcu_cs;
 
-    assert(m_state == RADIO_STATE_CCA_TX);
-    assert(m_trx_transmit_frame_notifications_mask & TRX_TRANSMIT_NOTIFICATION_CCAIDLE);
+    nrf_802154_mcu_critical_enter(mcu_cs);
 
-#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-    uint32_t ts = timer_coord_timestamp_get();
+    nrf_802154_trx_per_test_receive_set(enabled);
 
-    // Configure the timer coordinator to get a timestamp of the PHYEND event.
-    nrf_802154_timer_coord_timestamp_prepare(nrf_radio_event_address_get(NRF_RADIO,
-                                                                         NRF_RADIO_EVENT_PHYEND));
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_core_per_test_receive_counters_get(uint32_t * p_crcok, uint32_t * p_crcerror)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    nrf_802154_trx_per_test_receive_counters_get(p_crcok, p_crcerror);
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
 
-    // Update stat timestamp of CCASTART event
-    nrf_802154_stat_timestamp_write(last_cca_start_timestamp, ts);
 #endif
 
-    if (m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE)
-    {
-        nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_TX);
-        m_flags.tx_diminished_prio = false;
-    }
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+void nrf_802154_core_ed_result_get(nrf_802154_ed_result_t * p_result)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    *p_result = m_ed_ext_result;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
 }
 
-void nrf_802154_trx_transmit_frame_ccabusy(void)
+#endif
+
+bool nrf_802154_core_sleep(nrf_802154_term_t term_lvl)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    nrf_802154_stat_counter_increment(cca_failed_attempts);
+    bool result = nrf_802154_critical_section_enter();
 
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-    uint32_t t_listening = RX_RAMP_UP_TIME + PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS);
+    if (result)
+    {
+        if ((m_state != RADIO_STATE_SLEEP) && (m_state != RADIO_STATE_FALLING_ASLEEP))
+        {
+            result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
 
-    nrf_802154_stat_totals_increment(total_listening_time, t_listening);
-#endif
+            if (result)
+            {
+                sleep_mode_select();
 
-    state_set(RADIO_STATE_RX);
-    rx_init();
+                // The order of calls in the following blocks is inverted to avoid RAAL races.
+                if (timeslot_is_granted())
+                {
+                    state_set(RADIO_STATE_FALLING_ASLEEP);
+                    falling_asleep_init();
+                }
+                else
+                {
+                    sleep_init();
+                    state_set(RADIO_STATE_SLEEP);
+                }
+            }
+        }
+        else
+        {
+            // Between the samples of the low-power listening the driver sleeps, but the mode
+            // is ended by the request as well.
+            lpl_stop();
+        }
 
-    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_BUSY_CHANNEL);
+        nrf_802154_critical_section_exit();
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
 }
 
-void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
+bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
+                             req_originator_t               req_orig,
+                             nrf_802154_notification_func_t notify_function,
+                             bool                           notify_abort)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    if (m_ed_result < ed_sample)
-    {
-        // Collect maximum value of samples provided by trx
-        m_ed_result = ed_sample;
-    }
+    bool result = nrf_802154_critical_section_enter();
 
-    if (m_ed_time_left >= ED_ITER_DURATION)
+    if (result)
     {
-        uint32_t trx_ed_count = 0U;
+        if ((m_state != RADIO_STATE_RX) && (m_state != RADIO_STATE_TX_ACK))
+        {
+            if (critical_section_can_be_processed_now())
+            {
+                result = current_operation_terminate(term_lvl, req_orig, notify_abort);
 
-        if (ed_iter_setup(&m_ed_time_left, &trx_ed_count))
+                if (result)
+                {
+                    m_trx_receive_frame_notifications_mask =
+                        make_trx_frame_receive_notification_mask();
+                    state_set(RADIO_STATE_RX);
+                    rx_init();
+                }
+            }
+            else
+            {
+                result = false;
+            }
+        }
+
+        if (result && (req_orig == REQ_ORIG_HIGHER_LAYER))
         {
-            nrf_802154_trx_energy_detection(trx_ed_count);
+            // The receive state is requested explicitly, so it does not end with the window.
+            m_flags.post_tx_rx_window = false;
+            lpl_stop();
         }
-        else
+
+        if (notify_function != NULL)
         {
-            /* There is too little time in current timeslot, just wait for timeslot end.
-             * Operation will be resumed in next timeslot */
+            notify_function(result);
         }
+
+        // The request may end a transmission that the notification reports as failed.
+        tx_queue_resume();
+
+        nrf_802154_critical_section_exit();
     }
-    else if (nrf_802154_sl_ant_div_energy_detection_finished_notify())
+    else
     {
-        ed_init();
+        if (notify_function != NULL)
+        {
+            notify_function(false);
+        }
     }
-    else
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+/** Handle a request to transmit a frame.
+ *
+ * @note This function must be called from the critical section.
+ *
+ * @param[in]  term_lvl   Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig   Module that originates this request.
+ * @param[in]  p_data     Pointer to a frame to transmit.
+ * @param[in]  cca        If the driver is to perform CCA procedure before transmission.
+ * @param[in]  immediate  If true, the driver schedules transmission immediately or never.
+ *
+ * @retval  true   Entering the transmit state succeeded.
+ * @retval  false  Entering the transmit state failed.
+ */
+static bool transmit_request_handle(nrf_802154_term_t term_lvl,
+                                    req_originator_t  req_orig,
+                                    const uint8_t   * p_data,
+                                    bool              cca,
+                                    bool              immediate)
+{
+    bool result = false;
+
+    /* Short-circuit evaluation in place. */
+    if ((immediate) || (nrf_802154_core_hooks_pre_transmission(p_data, cca)))
     {
-        nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+        result = current_operation_terminate(term_lvl, req_orig, true);
 
-        state_set(RADIO_STATE_RX);
-        rx_init();
+#if NRF_802154_ENCRYPTION_ENABLED
+        if (result && !nrf_802154_encrypt_tx_setup(p_data))
+        {
+            // The frame cannot be secured, so it is rejected.
+            state_set(RADIO_STATE_RX);
+            rx_init();
 
-        energy_detected_notify(ed_result_get(m_ed_result));
+            return false;
+        }
+#endif
 
+        if (result)
+        {
+            result = tx_procedure_start(p_data, cca);
+            if (immediate)
+            {
+                if (!result)
+                {
+                    state_set(RADIO_STATE_RX);
+                    rx_init();
+                }
+            }
+            else
+            {
+                result = true;
+            }
+        }
     }
 
-    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
 }
 
-/***************************************************************************************************
- * @section API functions
- **************************************************************************************************/
-
-void nrf_802154_core_init(void)
+/** Store per-frame transmit parameters passed with a transmit request.
+ *
+ * Parameters are kept along with the pointer to the frame, so they are also applied if
+ * the transmission is postponed and requested again by another module (e.g. IFS).
+ *
+ * @param[in]  req_orig  Module that originates the transmit request.
+ * @param[in]  p_data    Pointer to a frame to transmit.
+ * @param[in]  p_params  Pointer to the transmit parameters of the frame or NULL.
+ */
+static void tx_params_store(req_originator_t               req_orig,
+                            const uint8_t                * p_data,
+                            const nrf_802154_tx_params_t * p_params)
 {
-    m_state                    = RADIO_STATE_SLEEP;
-    m_rsch_timeslot_is_granted = false;
+    if (p_params != NULL)
+    {
+        m_tx_params        = *p_params;
+        mp_tx_params_frame = p_data;
+    }
+    else if (req_orig == REQ_ORIG_HIGHER_LAYER)
+    {
+        // A new frame from the higher layer uses the PIB configuration.
+        mp_tx_params_frame = NULL;
+    }
+    else
+    {
+        // Other modules retransmit the frame requested by the higher layer, keep its parameters.
+    }
 
-    nrf_802154_trx_init();
-    nrf_802154_ack_generator_init();
+#if NRF_802154_COEX_PRIORITY_ENABLED
+    if ((p_params != NULL) || (req_orig == REQ_ORIG_HIGHER_LAYER))
+    {
+        m_tx_coex_priority_high = (p_params != NULL) &&
+                                  ((p_params->flags & NRF_802154_TX_PARAM_COEX_HIGH) != 0U);
+    }
+
+    // Frames transmitted at a given time must not miss their slot.
+    m_tx_coex_priority_high |= (req_orig == REQ_ORIG_DELAYED_TRX);
+#endif
 }
 
-void nrf_802154_core_deinit(void)
+bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
+                              req_originator_t               req_orig,
+                              const uint8_t                * p_data,
+                              bool                           cca,
+                              bool                           immediate,
+                              nrf_802154_notification_func_t notify_function,
+                              const nrf_802154_tx_params_t * p_params)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    if (timeslot_is_granted())
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
     {
-        nrf_802154_trx_disable();
-    }
+        tx_params_store(req_orig, p_data, p_params);
 
-    nrf_802154_fal_cleanup();
+        result = transmit_request_handle(term_lvl, req_orig, p_data, cca, immediate);
 
-    nrf_802154_irq_disable(RADIO_IRQn);
-    nrf_802154_irq_clear_pending(RADIO_IRQn);
+        if (notify_function != NULL)
+        {
+            notify_function(result);
+        }
+
+        // A retransmission that is not accepted may be reported as failed by the notification.
+        tx_queue_resume();
+
+        nrf_802154_critical_section_exit();
+    }
+    else
+    {
+        if (notify_function != NULL)
+        {
+            notify_function(false);
+        }
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
-}
 
-radio_state_t nrf_802154_core_state_get(void)
-{
-    return m_state;
+    return result;
 }
 
-bool nrf_802154_core_sleep(nrf_802154_term_t term_lvl)
+#if NRF_802154_TX_QUEUE_SIZE > 0
+bool nrf_802154_core_transmit_enqueue(const uint8_t                      * p_data,
+                                      bool                                 cca,
+                                      const nrf_802154_tx_queue_params_t * p_queue_params)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    bool result = nrf_802154_critical_section_enter();
+    bool result = critical_section_enter_and_verify_timeslot_length();
 
     if (result)
     {
-        if ((m_state != RADIO_STATE_SLEEP) && (m_state != RADIO_STATE_FALLING_ASLEEP))
+        if (tx_is_in_progress() || !nrf_802154_tx_queue_is_empty())
         {
-            result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
+            // The frame is transmitted when the frames before it are done.
+            result = nrf_802154_tx_queue_push(p_data, cca, p_queue_params);
 
-            if (result)
+            // Start the queue if a failure left it without a frame in flight.
+            tx_queue_resume();
+        }
+        else
+        {
+            nrf_802154_tx_queue_in_flight_set(p_data);
+
+            result = transmit_request_handle(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_HIGHER_LAYER,
+                                             p_data,
+                                             cca,
+                                             false);
+
+            if (!result)
             {
-                // The order of calls in the following blocks is inverted to avoid RAAL races.
-                if (timeslot_is_granted())
-                {
-                    state_set(RADIO_STATE_FALLING_ASLEEP);
-                    falling_asleep_init();
-                }
-                else
-                {
-                    sleep_init();
-                    state_set(RADIO_STATE_SLEEP);
-                }
+                nrf_802154_tx_queue_in_flight_set(NULL);
             }
         }
 
@@ -2398,63 +5021,62 @@ bool nrf_802154_core_sleep(nrf_802154_term_t term_lvl)
     return result;
 }
 
-bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
-                             req_originator_t               req_orig,
-                             nrf_802154_notification_func_t notify_function,
-                             bool                           notify_abort)
+bool nrf_802154_core_transmit_burst(const uint8_t * const * pp_data, uint8_t count, bool cca)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    bool result = nrf_802154_critical_section_enter();
+    bool result = (count > 0U) && critical_section_enter_and_verify_timeslot_length();
 
     if (result)
     {
-        if ((m_state != RADIO_STATE_RX) && (m_state != RADIO_STATE_TX_ACK))
+        if (tx_is_in_progress() || !nrf_802154_tx_queue_is_empty())
         {
-            if (critical_section_can_be_processed_now())
+            result = nrf_802154_tx_queue_burst_push(pp_data, count, cca);
+
+            // Start the queue if a failure left it without a frame in flight.
+            tx_queue_resume();
+        }
+        else
+        {
+            nrf_802154_tx_queue_in_flight_set(pp_data[0]);
+
+            // The rest of the burst is queued first, so that the timeslot requested for the first
+            // frame covers the whole burst.
+            result = nrf_802154_tx_queue_burst_push(&pp_data[1], count - 1U, cca) &&
+                     transmit_request_handle(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_HIGHER_LAYER,
+                                             pp_data[0],
+                                             cca,
+                                             false);
+
+            if (!result)
             {
-                result = current_operation_terminate(term_lvl, req_orig, notify_abort);
+                const uint8_t * p_data;
+                bool            frame_cca;
 
-                if (result)
+                // The queue held only this burst, which was not accepted.
+                while (nrf_802154_tx_queue_pop(&p_data, &frame_cca))
                 {
-                    m_trx_receive_frame_notifications_mask =
-                        make_trx_frame_receive_notification_mask();
-                    state_set(RADIO_STATE_RX);
-                    rx_init();
+                    // Intentionally empty.
                 }
-            }
-            else
-            {
-                result = false;
-            }
-        }
 
-        if (notify_function != NULL)
-        {
-            notify_function(result);
+                nrf_802154_tx_queue_in_flight_set(NULL);
+            }
         }
 
         nrf_802154_critical_section_exit();
     }
-    else
-    {
-        if (notify_function != NULL)
-        {
-            notify_function(false);
-        }
-    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
     return result;
 }
 
-bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
-                              req_originator_t               req_orig,
-                              const uint8_t                * p_data,
-                              bool                           cca,
-                              bool                           immediate,
-                              nrf_802154_notification_func_t notify_function)
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
+
+bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl,
+                                      uint32_t          time_us,
+                                      uint32_t          channel_mask)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2462,59 +5084,49 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
     if (result)
     {
-        /* Short-circuit evaluation in place. */
-        if ((immediate) || (nrf_802154_core_hooks_pre_transmission(p_data, cca)))
-        {
-            result = current_operation_terminate(term_lvl, req_orig, true);
+        result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
 
-            if (result)
+        if (result)
+        {
+            if (time_us < ED_ITER_DURATION)
             {
-                m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
-                m_trx_transmit_frame_notifications_mask =
-                    make_trx_frame_transmit_notification_mask(cca);
-                m_flags.tx_diminished_prio =
-                    m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
+                time_us = ED_ITER_DURATION;
+            }
 
-                state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
-                mp_tx_data = p_data;
+            m_ed_time_left      = time_us;
+            m_ed_result         = 0;
+            m_ed_sweep_mask     = channel_mask;
+            m_ed_sweep_channels = channel_mask;
+            m_ed_sweep_time     = time_us;
 
-                result = tx_init(p_data, cca);
-                if (immediate)
-                {
-                    if (!result)
-                    {
-                        state_set(RADIO_STATE_RX);
-                        rx_init();
-                    }
-                }
-                else
-                {
-                    result = true;
-                }
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+            ed_ext_reset();
+#endif
+
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+            memset(m_ed_antenna_results, 0, sizeof(m_ed_antenna_results));
+#endif
+
+            if (channel_mask != 0U)
+            {
+                ed_sweep_channel_select();
             }
-        }
 
-        if (notify_function != NULL)
-        {
-            notify_function(result);
+            state_set(RADIO_STATE_ED);
+            ed_init();
         }
 
         nrf_802154_critical_section_exit();
     }
-    else
-    {
-        if (notify_function != NULL)
-        {
-            notify_function(false);
-        }
-    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
     return result;
 }
 
-bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+
+bool nrf_802154_core_low_power_listening(nrf_802154_term_t term_lvl)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2526,16 +5138,9 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
 
         if (result)
         {
-            if (time_us < ED_ITER_DURATION)
-            {
-                time_us = ED_ITER_DURATION;
-            }
-
-            m_ed_time_left = time_us;
-            m_ed_result    = 0;
+            m_flags.lpl = true;
 
-            state_set(RADIO_STATE_ED);
-            ed_init();
+            lpl_sample_start();
         }
 
         nrf_802154_critical_section_exit();
@@ -2546,6 +5151,8 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
     return result;
 }
 
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2558,6 +5165,8 @@ bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 
         if (result)
         {
+            m_flags.cca_other_antenna = false;
+
             state_set(RADIO_STATE_CCA);
             cca_init();
         }
@@ -2624,10 +5233,21 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+    if (nrf_802154_rx_buffer_is_small(p_data))
+    {
+        // Small buffers are never used for reception, so the receiver does not need to be updated.
+        nrf_802154_rx_buffer_small_release(p_data);
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return true;
+    }
+#endif
+
     rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
     bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
 
-    p_buffer->free = true;
+    nrf_802154_rx_buffer_release(p_buffer);
 
     if (in_crit_sect)
     {
@@ -2648,6 +5268,77 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
     return true;
 }
 
+#if NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED
+bool nrf_802154_core_buffer_free_fast(uint8_t * p_data)
+{
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+    if (nrf_802154_rx_buffer_is_small(p_data))
+    {
+        nrf_802154_rx_buffer_small_release(p_data);
+        return true;
+    }
+#endif
+
+    nrf_802154_rx_buffer_release((rx_buffer_t *)p_data);
+
+    // The receiver checks the free buffers again after it is started without a buffer, so
+    // the flag is read after the buffer is published.
+    __DMB();
+
+    return !nrf_802154_trx_receive_buffer_missing_hint_get();
+}
+
+#endif // NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED
+
+/** Apply the channel set in PIB to the current operation.
+ *
+ * @note This function must be called from a critical section.
+ */
+static void channel_update_apply(void)
+{
+    // Energy detection sweep restores the channel from PIB when it is finished.
+    if (timeslot_is_granted() && (m_ed_sweep_mask == 0U))
+    {
+        nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+    }
+
+    switch (m_state)
+    {
+        case RADIO_STATE_RX:
+            if (timeslot_is_granted() && nrf_802154_trx_receive_frame_restart())
+            {
+                // The receiver is re-tuned without tearing down the receive operation.
+                nrf_802154_timer_sched_remove(&m_rx_prestarted_timer, NULL);
+                nrf_802154_sl_ant_div_rx_aborted_notify();
+                request_preconditions_for_state(m_state);
+                rx_flags_clear();
+            }
+            else if (current_operation_terminate(NRF_802154_TERM_NONE, REQ_ORIG_CORE, true))
+            {
+                rx_init();
+            }
+            break;
+
+        case RADIO_STATE_CONTINUOUS_CARRIER:
+            if (timeslot_is_granted())
+            {
+                nrf_802154_trx_continuous_carrier_restart();
+            }
+            break;
+
+        case RADIO_STATE_MODULATED_CARRIER:
+            if (timeslot_is_granted())
+            {
+                nrf_802154_trx_modulated_carrier_restart();
+            }
+            break;
+
+        default:
+            // Don't perform any additional action in any other state.
+            break;
+    }
+}
+
 bool nrf_802154_core_channel_update(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2656,39 +5347,49 @@ bool nrf_802154_core_channel_update(void)
 
     if (result)
     {
-        if (timeslot_is_granted())
-        {
-            nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
-        }
+        channel_update_apply();
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#if NRF_802154_RX_HOPPING_ENABLED
+
+bool nrf_802154_core_rx_channel_hop(uint8_t channel)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
 
+    if (result)
+    {
         switch (m_state)
         {
-            case RADIO_STATE_RX:
-                if (current_operation_terminate(NRF_802154_TERM_NONE, REQ_ORIG_CORE, true))
-                {
-                    rx_init();
-                }
-                break;
-
-            case RADIO_STATE_CONTINUOUS_CARRIER:
-                if (timeslot_is_granted())
-                {
-                    nrf_802154_trx_continuous_carrier_restart();
-                }
+            case RADIO_STATE_SLEEP:
+            case RADIO_STATE_FALLING_ASLEEP:
                 break;
 
-            case RADIO_STATE_MODULATED_CARRIER:
-                if (timeslot_is_granted())
-                {
-                    nrf_802154_trx_modulated_carrier_restart();
-                }
+            case RADIO_STATE_RX:
+                // A frame being received is completed on the current channel.
+                result = !(timeslot_is_granted() && nrf_802154_trx_psdu_is_being_received());
                 break;
 
             default:
-                // Don't perform any additional action in any other state.
+                // The hop is performed when the driver returns to the receive state.
+                result = false;
                 break;
         }
 
+        if (result && (nrf_802154_pib_channel_get() != channel))
+        {
+            nrf_802154_pib_channel_set(channel);
+            channel_update_apply();
+        }
+
         nrf_802154_critical_section_exit();
     }
 
@@ -2697,6 +5398,8 @@ bool nrf_802154_core_channel_update(void)
     return result;
 }
 
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
 bool nrf_802154_core_cca_cfg_update(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2718,6 +5421,38 @@ bool nrf_802154_core_cca_cfg_update(void)
     return result;
 }
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+bool nrf_802154_core_pib_update(bool channel_changed)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        // CCA configuration is applied first, so that a receiver restarted due to
+        // the channel change already uses it.
+        if (timeslot_is_granted())
+        {
+            nrf_802154_trx_cca_configuration_update();
+        }
+
+        if (channel_changed)
+        {
+            channel_update_apply();
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
 bool nrf_802154_core_rssi_measure(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -44,6 +44,7 @@
 #include "nrf_802154_notification.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_types.h"
+#include "nrf_802154_sl_ant_div.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -97,6 +98,99 @@ void nrf_802154_core_deinit(void);
  */
 radio_state_t nrf_802154_core_state_get(void);
 
+#if NRF_802154_ANT_DIV_DUAL_ASSESSMENT_ENABLED
+
+/**
+ * @brief Gets the highest energy detected on the given antenna during the last energy detection.
+ *
+ * @param[in]  antenna  Antenna to get the result for.
+ *
+ * @returns  Energy detected on @p antenna, in the format of @ref nrf_802154_energy_detected.
+ */
+uint8_t nrf_802154_core_ed_antenna_result_get(nrf_802154_sl_ant_div_antenna_t antenna);
+
+#endif
+
+#if NRF_802154_RSSI_STREAM_ENABLED
+
+/**
+ * @brief Starts sampling the RSSI for the RSSI streaming if the radio is in the receive state.
+ *
+ * Otherwise, the sampling starts when the radio enters the receive state.
+ */
+void nrf_802154_core_rssi_stream_start(void);
+
+#endif
+
+#if NRF_802154_TX_DSN_ASSIGN_ENABLED
+
+/**
+ * @brief Sets the sequence number to be assigned to the next transmitted frame.
+ *
+ * @param[in]  dsn  Sequence number.
+ */
+void nrf_802154_core_tx_dsn_set(uint8_t dsn);
+
+#endif
+
+#if NRF_802154_PASSIVE_ED_ENABLED
+
+/**
+ * @brief Starts the energy detection procedure that samples the RSSI in the receive state.
+ *
+ * @param[in]  time_us  Duration of the procedure in microseconds.
+ *
+ * @retval  true   The procedure was started.
+ * @retval  false  The radio is not in the receive state, the procedure is already in progress,
+ *                 or the driver is busy.
+ */
+bool nrf_802154_core_energy_detection_passive(uint32_t time_us);
+
+#endif
+
+#if NRF_802154_PER_TEST_ENABLED
+
+/**
+ * @brief Configures the PER test burst sent by the next modulated carrier procedure.
+ *
+ * @param[in]  count        Number of frames in the burst. 0 disables the burst.
+ * @param[in]  interval_us  Interval between the starts of consecutive frames in microseconds.
+ */
+void nrf_802154_core_per_test_transmit_set(uint32_t count, uint32_t interval_us);
+
+/**
+ * @brief Gets the number of frames left to transmit in the PER test burst.
+ */
+uint32_t nrf_802154_core_per_test_transmit_remaining_get(void);
+
+/**
+ * @brief Selects if the received frames are only counted, starting from the next reception.
+ *
+ * @param[in]  enabled  If the PER test receive mode is to be enabled.
+ */
+void nrf_802154_core_per_test_receive_set(bool enabled);
+
+/**
+ * @brief Gets the numbers of frames counted in the PER test receive mode.
+ *
+ * @param[out] p_crcok     Number of frames received with correct CRC.
+ * @param[out] p_crcerror  Number of frames received with incorrect CRC.
+ */
+void nrf_802154_core_per_test_receive_counters_get(uint32_t * p_crcok, uint32_t * p_crcerror);
+
+#endif
+
+#if NRF_802154_ED_RESULT_EXT_ENABLED
+
+/**
+ * @brief Gets the extended result of the last energy detection procedure.
+ *
+ * @param[out]  p_result  Extended result of the energy detection.
+ */
+void nrf_802154_core_ed_result_get(nrf_802154_ed_result_t * p_result);
+
+#endif
+
 /***************************************************************************************************
  * @section State machine transition requests
  **************************************************************************************************/
@@ -138,6 +232,8 @@ bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
  *                              If false, the transmission may be postponed until
  *                              the TX preconditions are met.
  * @param[in]  notify_function  Function called to notify the status of this procedure. May be NULL.
+ * @param[in]  p_params         Pointer to per-frame transmit parameters. May be NULL, in which case
+ *                              the frame is transmitted with the PIB configuration.
  *
  * @retval  true   Entering the transmit state succeeded.
  * @retval  false  Entering the transmit state failed (the driver is performing other procedure).
@@ -147,7 +243,45 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               const uint8_t                * p_data,
                               bool                           cca,
                               bool                           immediate,
-                              nrf_802154_notification_func_t notify_function);
+                              nrf_802154_notification_func_t notify_function,
+                              const nrf_802154_tx_params_t * p_params);
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+/**
+ * @brief Requests the transmission of a frame through the transmit queue.
+ *
+ * If no transmission is in progress, the transmission starts as with @ref nrf_802154_core_transmit
+ * requested by the higher layer with @ref NRF_802154_TERM_NONE. Otherwise the frame is added to the
+ * transmit queue and transmitted right after the frames before it.
+ *
+ * @param[in]  p_data          Pointer to a frame to transmit.
+ * @param[in]  cca             If the driver is to perform CCA procedure before transmission.
+ * @param[in]  p_queue_params  Pointer to the queue parameters of the frame or NULL.
+ *
+ * @retval  true   The transmission was started or the frame was queued.
+ * @retval  false  The transmission could not be started or the transmit queue is full.
+ */
+bool nrf_802154_core_transmit_enqueue(const uint8_t                      * p_data,
+                                      bool                                 cca,
+                                      const nrf_802154_tx_queue_params_t * p_queue_params);
+
+/**
+ * @brief Requests the transmission of a burst of frames through the transmit queue.
+ *
+ * Works like @ref nrf_802154_core_transmit_enqueue called for every frame, but all frames are
+ * accepted or none of them. If no transmission is in progress, the frames are queued before
+ * the first one is started, so that the timeslot is requested once for the whole burst.
+ *
+ * @param[in]  pp_data  Array of pointers to the frames to transmit.
+ * @param[in]  count    Number of frames in @p pp_data.
+ * @param[in]  cca      If the driver is to perform CCA procedure before each transmission.
+ *
+ * @retval  true   The burst was accepted.
+ * @retval  false  The transmission could not be started or the transmit queue is too short.
+ */
+bool nrf_802154_core_transmit_burst(const uint8_t * const * pp_data, uint8_t count, bool cca);
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
 
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_ED state.
@@ -155,14 +289,20 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
  * When the energy detection procedure is finished, the driver transitions
  * to the @ref RADIO_STATE_RX state.
  *
- * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
- * @param[in]  time_us   Minimal time of energy detection procedure.
+ * If @p channel_mask is not 0, the energy detection procedure is performed on each of the given
+ * channels, and the results are notified at once when the last channel is scanned.
+ *
+ * @param[in]  term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]  time_us       Minimal time of energy detection procedure on each channel.
+ * @param[in]  channel_mask  Mask of the channels to scan, or 0 to scan the current channel only.
  *
  * @retval  true   Entering the energy detection state succeeded.
  * @retval  false  Entering the energy detection state failed
  *                 (the driver is performing other procedure).
  */
-bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
+bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl,
+                                      uint32_t          time_us,
+                                      uint32_t          channel_mask);
 
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_CCA state.
@@ -176,6 +316,25 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
  */
 bool nrf_802154_core_cca(nrf_802154_term_t term_lvl);
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+/**
+ * @brief Requests entering the low-power listening mode.
+ *
+ * In this mode the driver alternates between the @ref RADIO_STATE_ED state sampling the channel
+ * energy and the @ref RADIO_STATE_SLEEP state. It enters the @ref RADIO_STATE_RX state for
+ * a while if the sampled energy exceeds the CCA energy detection threshold. The mode ends when
+ * another operation is requested.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ *
+ * @retval  true   Entering the low-power listening mode succeeded.
+ * @retval  false  Entering the low-power listening mode failed (the driver is performing other
+ *                 procedure).
+ */
+bool nrf_802154_core_low_power_listening(nrf_802154_term_t term_lvl);
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_CONTINUOUS_CARRIER state.
  *
@@ -215,6 +374,24 @@ bool nrf_802154_core_modulated_carrier(nrf_802154_term_t term_lvl,
  */
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data);
 
+#if NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED
+
+/**
+ * @brief Releases a frame buffer freed by a higher layer without entering the critical section.
+ *
+ * The buffer is released with a single atomic operation. The receiver that waits for a buffer
+ * is not updated, so in that case the higher layer must also call
+ * @ref nrf_802154_core_notify_buffer_free through a request.
+ *
+ * @param[in]  p_data  Pointer to buffer that has been freed.
+ *
+ * @retval  true   The buffer was released and the receiver does not wait for it.
+ * @retval  false  The buffer was released, but the receiver may wait for a buffer.
+ */
+bool nrf_802154_core_buffer_free_fast(uint8_t * p_data);
+
+#endif // NRF_802154_BUFFER_FREE_FAST_PATH_ENABLED
+
 /**
  * @brief Notifies the core module that the next higher layer requested the change of the channel.
  *
@@ -225,12 +402,45 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data);
  */
 bool nrf_802154_core_channel_update(void);
 
+#if NRF_802154_RX_HOPPING_ENABLED
+
+/**
+ * @brief Switches the receiver to another channel of the receive hopping schedule.
+ *
+ * The channel is set in PIB and applied like with @ref nrf_802154_core_channel_update, but only
+ * in the @ref RADIO_STATE_SLEEP state and in the @ref RADIO_STATE_RX state when no frame is being
+ * received. In any other state, the channel is not changed.
+ *
+ * @param[in]  channel  Channel to switch to (11-26).
+ *
+ * @retval  true   The channel was switched.
+ * @retval  false  The channel was not switched, because a frame is being received or transmitted.
+ */
+bool nrf_802154_core_rx_channel_hop(uint8_t channel);
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
 /**
  * @brief Notifies the core module that the next higher layer requested the change
  * of the CCA configuration.
  */
 bool nrf_802154_core_cca_cfg_update(void);
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+/**
+ * @brief Notifies the core module that the next higher layer committed a PIB transaction.
+ *
+ * The CCA configuration is updated and, if @p channel_changed is true, the channel is applied
+ * like with @ref nrf_802154_core_channel_update. Both changes are applied in a single critical
+ * section, so the transceiver is restarted at most once.
+ *
+ * @param[in]  channel_changed  If the channel was changed during the transaction.
+ */
+bool nrf_802154_core_pib_update(bool channel_changed);
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
 /**
  * @brief Notifies the core module that the next higher layer requested the RSSI measurement.
  */
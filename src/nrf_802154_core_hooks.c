@@ -46,8 +46,10 @@
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_retransmission.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
+#include "nrf_802154_utils.h"
 
 typedef bool (* abort_hook)(nrf_802154_term_t term_lvl, req_originator_t req_orig);
 typedef bool (* pre_transmission_hook)(const uint8_t * p_frame, bool cca);
@@ -57,104 +59,252 @@ typedef bool (* tx_started_hook)(const uint8_t * p_frame);
 typedef void (* rx_started_hook)(const uint8_t * p_frame);
 typedef void (* rx_ack_started_hook)(void);
 
-/* Since some compilers do not allow empty initializers for arrays with unspecified bounds,
- * NULL pointer is appended to below arrays if the compiler used is not GCC. It is intentionally
- * unused, but it prevents the arrays from being empty. GCC manages to optimize empty arrays away,
- * so such a solution is unnecessary. */
+/** Get the bit of the given procedure in @ref m_active_procs. */
+#define PROC_BIT(proc) (1UL << (uint32_t)(proc))
 
-static const abort_hook m_abort_hooks[] =
+/* Below arrays are indexed by the procedures. An entry is NULL if the procedure does not use
+ * given hook. The masks list the hooks called regardless of the procedure being active, because
+ * they start the procedure or track state needed to start it.
+ *
+ * Since some compilers do not allow empty initializers, an entry past the last procedure is
+ * initialized in every array. It is intentionally unused. */
+
+static const abort_hook m_abort_hooks[NRF_802154_CORE_HOOKS_PROC_NB + 1] =
 {
 #if NRF_802154_CSMA_CA_ENABLED
-    nrf_802154_csma_ca_abort,
+    [NRF_802154_CORE_HOOKS_PROC_CSMA_CA] = nrf_802154_csma_ca_abort,
 #endif
 
 #if NRF_802154_ACK_TIMEOUT_ENABLED
-    nrf_802154_ack_timeout_abort,
+    [NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT] = nrf_802154_ack_timeout_abort,
 #endif
 
 #if NRF_802154_DELAYED_TRX_ENABLED
-    nrf_802154_delayed_trx_abort,
+    [NRF_802154_CORE_HOOKS_PROC_DELAYED_RX] = nrf_802154_delayed_trx_abort,
 #endif
 
 #if NRF_802154_IFS_ENABLED
-    nrf_802154_ifs_abort,
+    [NRF_802154_CORE_HOOKS_PROC_IFS] = nrf_802154_ifs_abort,
 #endif
 
-    NULL,
+#if NRF_802154_RETRANSMISSION_ENABLED
+    [NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION] = nrf_802154_retransmission_abort,
+#endif
+
+    [NRF_802154_CORE_HOOKS_PROC_NB] = NULL,
 };
 
-static const pre_transmission_hook m_pre_transmission_hooks[] =
+static const pre_transmission_hook m_pre_transmission_hooks[NRF_802154_CORE_HOOKS_PROC_NB + 1] =
 {
 #if NRF_802154_IFS_ENABLED
-    nrf_802154_ifs_pretransmission,
+    [NRF_802154_CORE_HOOKS_PROC_IFS] = nrf_802154_ifs_pretransmission,
 #endif
-    NULL,
+
+    [NRF_802154_CORE_HOOKS_PROC_NB] = NULL,
 };
 
-static const transmitted_hook m_transmitted_hooks[] =
+static const uint32_t m_pre_transmission_hooks_always = PROC_BIT(NRF_802154_CORE_HOOKS_PROC_IFS);
+
+static const transmitted_hook m_transmitted_hooks[NRF_802154_CORE_HOOKS_PROC_NB + 1] =
 {
 #if NRF_802154_ACK_TIMEOUT_ENABLED
-    nrf_802154_ack_timeout_transmitted_hook,
+    [NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT] = nrf_802154_ack_timeout_transmitted_hook,
 #endif
 #if NRF_802154_IFS_ENABLED
-    nrf_802154_ifs_transmitted_hook,
+    [NRF_802154_CORE_HOOKS_PROC_IFS] = nrf_802154_ifs_transmitted_hook,
 #endif
-    NULL,
+#if NRF_802154_RETRANSMISSION_ENABLED
+    [NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION] = nrf_802154_retransmission_transmitted_hook,
+#endif
+#if NRF_802154_DELAYED_TRX_ENABLED
+    [NRF_802154_CORE_HOOKS_PROC_DELAYED_TX] = nrf_802154_delayed_trx_transmitted_hook,
+#endif
+
+    [NRF_802154_CORE_HOOKS_PROC_NB] = NULL,
 };
 
-static const tx_failed_hook m_tx_failed_hooks[] =
+static const uint32_t m_transmitted_hooks_always = PROC_BIT(NRF_802154_CORE_HOOKS_PROC_IFS);
+
+static const tx_failed_hook m_tx_failed_hooks[NRF_802154_CORE_HOOKS_PROC_NB + 1] =
 {
 #if NRF_802154_CSMA_CA_ENABLED
-    nrf_802154_csma_ca_tx_failed_hook,
+    [NRF_802154_CORE_HOOKS_PROC_CSMA_CA] = nrf_802154_csma_ca_tx_failed_hook,
 #endif
 
 #if NRF_802154_ACK_TIMEOUT_ENABLED
-    nrf_802154_ack_timeout_tx_failed_hook,
+    [NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT] = nrf_802154_ack_timeout_tx_failed_hook,
 #endif
 
-    NULL,
+#if NRF_802154_RETRANSMISSION_ENABLED
+    [NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION] = nrf_802154_retransmission_tx_failed_hook,
+#endif
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+    [NRF_802154_CORE_HOOKS_PROC_DELAYED_TX] = nrf_802154_delayed_trx_tx_failed_hook,
+#endif
+
+    [NRF_802154_CORE_HOOKS_PROC_NB] = NULL,
 };
 
-static const tx_started_hook m_tx_started_hooks[] =
+static const tx_started_hook m_tx_started_hooks[NRF_802154_CORE_HOOKS_PROC_NB + 1] =
 {
 #if NRF_802154_CSMA_CA_ENABLED
-    nrf_802154_csma_ca_tx_started_hook,
+    [NRF_802154_CORE_HOOKS_PROC_CSMA_CA] = nrf_802154_csma_ca_tx_started_hook,
 #endif
 
 #if NRF_802154_ACK_TIMEOUT_ENABLED
-    nrf_802154_ack_timeout_tx_started_hook,
+    [NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT] = nrf_802154_ack_timeout_tx_started_hook,
 #endif
 
-    NULL,
+    [NRF_802154_CORE_HOOKS_PROC_NB] = NULL,
 };
 
-static const rx_started_hook m_rx_started_hooks[] =
+static const uint32_t m_tx_started_hooks_always = PROC_BIT(NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT);
+
+static const rx_started_hook m_rx_started_hooks[NRF_802154_CORE_HOOKS_PROC_NB + 1] =
 {
 #if NRF_802154_DELAYED_TRX_ENABLED
-    nrf_802154_delayed_trx_rx_started_hook,
+    [NRF_802154_CORE_HOOKS_PROC_DELAYED_RX] = nrf_802154_delayed_trx_rx_started_hook,
 #endif
 
-    NULL,
+    [NRF_802154_CORE_HOOKS_PROC_NB] = NULL,
 };
 
-static const rx_ack_started_hook m_rx_ack_started_hooks[] =
+static const rx_ack_started_hook m_rx_ack_started_hooks[NRF_802154_CORE_HOOKS_PROC_NB + 1] =
 {
 #if NRF_802154_ACK_TIMEOUT_ENABLED
-    nrf_802154_ack_timeout_rx_ack_started_hook,
+    [NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT] = nrf_802154_ack_timeout_rx_ack_started_hook,
 #endif
 
+    [NRF_802154_CORE_HOOKS_PROC_NB] = NULL,
+};
+
+/** Declare an external hook with the signature of the given type. */
+#define EXT_ABORT_HOOK_DECLARE(hook)            bool hook(nrf_802154_term_t term_lvl, \
+                                                          req_originator_t  req_orig);
+#define EXT_PRE_TRANSMISSION_HOOK_DECLARE(hook) bool hook(const uint8_t * p_frame, bool cca);
+#define EXT_TRANSMITTED_HOOK_DECLARE(hook)      void hook(const uint8_t * p_frame);
+#define EXT_TX_FAILED_HOOK_DECLARE(hook)        bool hook(const uint8_t        * p_frame, \
+                                                          nrf_802154_tx_error_t error);
+#define EXT_TX_STARTED_HOOK_DECLARE(hook)       bool hook(const uint8_t * p_frame);
+#define EXT_RX_STARTED_HOOK_DECLARE(hook)       void hook(const uint8_t * p_frame);
+#define EXT_RX_ACK_STARTED_HOOK_DECLARE(hook)   void hook(void);
+
+/** Put an external hook in an array. */
+#define EXT_HOOK_ENTRY(hook)                    hook,
+
+NRF_802154_CORE_HOOKS_EXTERNAL_ABORT(EXT_ABORT_HOOK_DECLARE)
+NRF_802154_CORE_HOOKS_EXTERNAL_PRE_TRANSMISSION(EXT_PRE_TRANSMISSION_HOOK_DECLARE)
+NRF_802154_CORE_HOOKS_EXTERNAL_TRANSMITTED(EXT_TRANSMITTED_HOOK_DECLARE)
+NRF_802154_CORE_HOOKS_EXTERNAL_TX_FAILED(EXT_TX_FAILED_HOOK_DECLARE)
+NRF_802154_CORE_HOOKS_EXTERNAL_TX_STARTED(EXT_TX_STARTED_HOOK_DECLARE)
+NRF_802154_CORE_HOOKS_EXTERNAL_RX_STARTED(EXT_RX_STARTED_HOOK_DECLARE)
+NRF_802154_CORE_HOOKS_EXTERNAL_RX_ACK_STARTED(EXT_RX_ACK_STARTED_HOOK_DECLARE)
+
+/* Hooks of the modules kept outside of the driver, listed in the configuration. The arrays end with
+ * a NULL entry that terminates the loops. */
+
+static const abort_hook m_ext_abort_hooks[] =
+{
+    NRF_802154_CORE_HOOKS_EXTERNAL_ABORT(EXT_HOOK_ENTRY)
+    NULL,
+};
+
+static const pre_transmission_hook m_ext_pre_transmission_hooks[] =
+{
+    NRF_802154_CORE_HOOKS_EXTERNAL_PRE_TRANSMISSION(EXT_HOOK_ENTRY)
+    NULL,
+};
+
+static const transmitted_hook m_ext_transmitted_hooks[] =
+{
+    NRF_802154_CORE_HOOKS_EXTERNAL_TRANSMITTED(EXT_HOOK_ENTRY)
+    NULL,
+};
+
+static const tx_failed_hook m_ext_tx_failed_hooks[] =
+{
+    NRF_802154_CORE_HOOKS_EXTERNAL_TX_FAILED(EXT_HOOK_ENTRY)
+    NULL,
+};
+
+static const tx_started_hook m_ext_tx_started_hooks[] =
+{
+    NRF_802154_CORE_HOOKS_EXTERNAL_TX_STARTED(EXT_HOOK_ENTRY)
+    NULL,
+};
+
+static const rx_started_hook m_ext_rx_started_hooks[] =
+{
+    NRF_802154_CORE_HOOKS_EXTERNAL_RX_STARTED(EXT_HOOK_ENTRY)
+    NULL,
+};
+
+static const rx_ack_started_hook m_ext_rx_ack_started_hooks[] =
+{
+    NRF_802154_CORE_HOOKS_EXTERNAL_RX_ACK_STARTED(EXT_HOOK_ENTRY)
     NULL,
 };
 
+static volatile uint32_t m_active_procs; ///< Bitmask of the active procedures.
+
+/**
+ * @brief Get the next procedure whose hook is to be called.
+ *
+ * The mask of the active procedures is read again on every call, so that a procedure activated or
+ * deactivated by an earlier hook is handled in the same way as when all hooks were called.
+ *
+ * @param[in]  always  Mask of the procedures whose hooks are called even if inactive.
+ * @param[in]  first   First procedure that can be returned.
+ *
+ * @returns  Next procedure to process, or @ref NRF_802154_CORE_HOOKS_PROC_NB if there is none.
+ */
+static uint32_t proc_next_get(uint32_t always, uint32_t first)
+{
+    uint32_t mask = (m_active_procs | always) & ~(PROC_BIT(first) - 1UL);
+
+    mask &= PROC_BIT(NRF_802154_CORE_HOOKS_PROC_NB) - 1UL;
+
+    return (mask == 0U) ? NRF_802154_CORE_HOOKS_PROC_NB : __CLZ(__RBIT(mask));
+}
+
+void nrf_802154_core_hooks_proc_activate(nrf_802154_core_hooks_proc_t proc)
+{
+    uint32_t procs;
+
+    do
+    {
+        procs = __LDREXW(&m_active_procs);
+    }
+    while (__STREXW(procs | PROC_BIT(proc), &m_active_procs));
+
+    __DMB();
+}
+
+void nrf_802154_core_hooks_proc_deactivate(nrf_802154_core_hooks_proc_t proc)
+{
+    uint32_t procs;
+
+    do
+    {
+        procs = __LDREXW(&m_active_procs);
+    }
+    while (__STREXW(procs & ~PROC_BIT(proc), &m_active_procs));
+
+    __DMB();
+}
+
 bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_t req_orig)
 {
     bool result = true;
 
-    for (uint32_t i = 0; i < sizeof(m_abort_hooks) / sizeof(m_abort_hooks[0]); i++)
+    for (uint32_t i = proc_next_get(0U, 0U);
+         i < NRF_802154_CORE_HOOKS_PROC_NB;
+         i = proc_next_get(0U, i + 1U))
     {
         if (m_abort_hooks[i] == NULL)
         {
-            break;
+            continue;
         }
 
         result = m_abort_hooks[i](term_lvl, req_orig);
@@ -165,6 +315,11 @@ bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_
         }
     }
 
+    for (uint32_t i = 0; result && (m_ext_abort_hooks[i] != NULL); i++)
+    {
+        result = m_ext_abort_hooks[i](term_lvl, req_orig);
+    }
+
     return result;
 }
 
@@ -172,12 +327,13 @@ bool nrf_802154_core_hooks_pre_transmission(const uint8_t * p_frame, bool cca)
 {
     bool result = true;
 
-    for (uint32_t i = 0; i < sizeof(m_pre_transmission_hooks) / sizeof(m_pre_transmission_hooks[0]);
-         i++)
+    for (uint32_t i = proc_next_get(m_pre_transmission_hooks_always, 0U);
+         i < NRF_802154_CORE_HOOKS_PROC_NB;
+         i = proc_next_get(m_pre_transmission_hooks_always, i + 1U))
     {
         if (m_pre_transmission_hooks[i] == NULL)
         {
-            break;
+            continue;
         }
 
         result = m_pre_transmission_hooks[i](p_frame, cca);
@@ -188,19 +344,29 @@ bool nrf_802154_core_hooks_pre_transmission(const uint8_t * p_frame, bool cca)
         }
     }
 
+    for (uint32_t i = 0; result && (m_ext_pre_transmission_hooks[i] != NULL); i++)
+    {
+        result = m_ext_pre_transmission_hooks[i](p_frame, cca);
+    }
+
     return result;
 }
 
 void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame)
 {
-    for (uint32_t i = 0; i < sizeof(m_transmitted_hooks) / sizeof(m_transmitted_hooks[0]); i++)
+    for (uint32_t i = proc_next_get(m_transmitted_hooks_always, 0U);
+         i < NRF_802154_CORE_HOOKS_PROC_NB;
+         i = proc_next_get(m_transmitted_hooks_always, i + 1U))
     {
-        if (m_transmitted_hooks[i] == NULL)
+        if (m_transmitted_hooks[i] != NULL)
         {
-            break;
+            m_transmitted_hooks[i](p_frame);
         }
+    }
 
-        m_transmitted_hooks[i](p_frame);
+    for (uint32_t i = 0; m_ext_transmitted_hooks[i] != NULL; i++)
+    {
+        m_ext_transmitted_hooks[i](p_frame);
     }
 }
 
@@ -208,11 +374,13 @@ bool nrf_802154_core_hooks_tx_failed(const uint8_t * p_frame, nrf_802154_tx_erro
 {
     bool result = true;
 
-    for (uint32_t i = 0; i < sizeof(m_tx_failed_hooks) / sizeof(m_tx_failed_hooks[0]); i++)
+    for (uint32_t i = proc_next_get(0U, 0U);
+         i < NRF_802154_CORE_HOOKS_PROC_NB;
+         i = proc_next_get(0U, i + 1U))
     {
         if (m_tx_failed_hooks[i] == NULL)
         {
-            break;
+            continue;
         }
 
         result = m_tx_failed_hooks[i](p_frame, error);
@@ -223,6 +391,11 @@ bool nrf_802154_core_hooks_tx_failed(const uint8_t * p_frame, nrf_802154_tx_erro
         }
     }
 
+    for (uint32_t i = 0; result && (m_ext_tx_failed_hooks[i] != NULL); i++)
+    {
+        result = m_ext_tx_failed_hooks[i](p_frame, error);
+    }
+
     return result;
 }
 
@@ -230,11 +403,13 @@ bool nrf_802154_core_hooks_tx_started(const uint8_t * p_frame)
 {
     bool result = true;
 
-    for (uint32_t i = 0; i < sizeof(m_tx_started_hooks) / sizeof(m_tx_started_hooks[0]); i++)
+    for (uint32_t i = proc_next_get(m_tx_started_hooks_always, 0U);
+         i < NRF_802154_CORE_HOOKS_PROC_NB;
+         i = proc_next_get(m_tx_started_hooks_always, i + 1U))
     {
         if (m_tx_started_hooks[i] == NULL)
         {
-            break;
+            continue;
         }
 
         result = m_tx_started_hooks[i](p_frame);
@@ -245,32 +420,46 @@ bool nrf_802154_core_hooks_tx_started(const uint8_t * p_frame)
         }
     }
 
+    for (uint32_t i = 0; result && (m_ext_tx_started_hooks[i] != NULL); i++)
+    {
+        result = m_ext_tx_started_hooks[i](p_frame);
+    }
+
     return result;
 }
 
 void nrf_802154_core_hooks_rx_started(const uint8_t * p_frame)
 {
-    for (uint32_t i = 0; i < sizeof(m_rx_started_hooks) / sizeof(m_rx_started_hooks[0]); i++)
+    for (uint32_t i = proc_next_get(0U, 0U);
+         i < NRF_802154_CORE_HOOKS_PROC_NB;
+         i = proc_next_get(0U, i + 1U))
     {
-        if (m_rx_started_hooks[i] == NULL)
+        if (m_rx_started_hooks[i] != NULL)
         {
-            break;
+            m_rx_started_hooks[i](p_frame);
         }
+    }
 
-        m_rx_started_hooks[i](p_frame);
+    for (uint32_t i = 0; m_ext_rx_started_hooks[i] != NULL; i++)
+    {
+        m_ext_rx_started_hooks[i](p_frame);
     }
 }
 
 void nrf_802154_core_hooks_rx_ack_started(void)
 {
-    for (uint32_t i = 0; i < sizeof(m_rx_ack_started_hooks) / sizeof(m_rx_ack_started_hooks[0]);
-         i++)
+    for (uint32_t i = proc_next_get(0U, 0U);
+         i < NRF_802154_CORE_HOOKS_PROC_NB;
+         i = proc_next_get(0U, i + 1U))
     {
-        if (m_rx_ack_started_hooks[i] == NULL)
+        if (m_rx_ack_started_hooks[i] != NULL)
         {
-            break;
+            m_rx_ack_started_hooks[i]();
         }
+    }
 
-        m_rx_ack_started_hooks[i]();
+    for (uint32_t i = 0; m_ext_rx_ack_started_hooks[i] != NULL; i++)
+    {
+        m_ext_rx_ack_started_hooks[i]();
     }
 }
@@ -46,7 +46,43 @@
  *
  * Hooks are used by the optional driver features to modify the way in which notifications
  * are propagated through the driver.
+ *
+ * Most hooks are called only while the procedure they belong to is active. The procedures mark
+ * themselves active with @ref nrf_802154_core_hooks_proc_activate and inactive with
+ * @ref nrf_802154_core_hooks_proc_deactivate, so that the hooks of idle procedures are skipped.
+ */
+
+/**
+ * @brief Procedures that use the hooks.
+ *
+ * The hooks of the procedures are called in the order of this enumeration.
+ */
+typedef enum
+{
+    NRF_802154_CORE_HOOKS_PROC_CSMA_CA,        ///< CSMA-CA procedure.
+    NRF_802154_CORE_HOOKS_PROC_ACK_TIMEOUT,    ///< Waiting for an ACK frame.
+    NRF_802154_CORE_HOOKS_PROC_DELAYED_RX,     ///< Ongoing delayed reception window.
+    NRF_802154_CORE_HOOKS_PROC_IFS,            ///< Transmission delayed by the interframe space.
+    NRF_802154_CORE_HOOKS_PROC_RETRANSMISSION, ///< Tracked retransmissions of a frame.
+    NRF_802154_CORE_HOOKS_PROC_DELAYED_TX,     ///< Ongoing transmission of a periodic beacon.
+    NRF_802154_CORE_HOOKS_PROC_NB,             ///< Number of the procedures.
+} nrf_802154_core_hooks_proc_t;
+
+/**
+ * @brief Marks the given procedure as active, so that its hooks are called.
+ *
+ * @param[in]  proc  Procedure that has started.
+ */
+void nrf_802154_core_hooks_proc_activate(nrf_802154_core_hooks_proc_t proc);
+
+/**
+ * @brief Marks the given procedure as inactive, so that its hooks are skipped.
+ *
+ * Hooks that start a procedure are called even if the procedure is inactive.
+ *
+ * @param[in]  proc  Procedure that has ended.
  */
+void nrf_802154_core_hooks_proc_deactivate(nrf_802154_core_hooks_proc_t proc);
 
 /**
  * @brief Processes hooks for the termination request.
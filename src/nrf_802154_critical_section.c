@@ -35,7 +35,8 @@
  *
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_CRITICAL_SECTION
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_CRITICAL_SECTION
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_CRITICAL_SECTION_LOG_VERBOSITY
 
 #include "nrf_802154_critical_section.h"
 
@@ -44,14 +45,24 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_utils.h"
 #include "hal/nrf_radio.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
 #include "platform/irq/nrf_802154_irq.h"
+#if NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#endif
 
 #include <nrf.h>
 
+#if NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+// This module implements the functions redirected by the header.
+#undef nrf_802154_critical_section_enter
+#undef nrf_802154_critical_section_forcefully_enter
+#endif
+
 #define CMSIS_IRQ_NUM_VECTACTIVE_DIFF                 16
 
 #define NESTED_CRITICAL_SECTION_ALLOWED_PRIORITY_NONE (-1)
@@ -60,6 +71,18 @@ static volatile uint8_t m_critical_section_monitor;                 ///< Monitor
 static volatile uint8_t m_nested_critical_section_counter;          ///< Counter of nested critical sections
 static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicator if nested critical sections are currently allowed
 
+#if NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
+/// Caller index used for modules that did not provide their ID.
+#define PROFILER_CALLER_UNKNOWN 0U
+
+static uint32_t m_profiler_start_time; ///< Time when the outermost critical section was entered.
+static uint8_t  m_profiler_caller;     ///< Index of the caller that entered the outermost critical section.
+static uint8_t  m_profiler_priority;   ///< Index of the priority the outermost critical section was entered from.
+static bool     m_profiler_active;     ///< Indicator if the outermost critical section is measured.
+
+#endif // NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
 /***************************************************************************************************
  * @section Critical sections management
  **************************************************************************************************/
@@ -205,6 +228,87 @@ static void critical_section_exit(void)
     while (cnt == 1);
 }
 
+#if NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
+/***************************************************************************************************
+ * @section Critical section profiler
+ **************************************************************************************************/
+
+/** @brief Start measuring the hold time if the outermost critical section was just entered.
+ *
+ * @note This function must be called with the critical section entered. A higher priority IRQ
+ *       may nest the critical section only for its own duration, so the counter equal to one
+ *       identifies the outermost critical section.
+ *
+ * @param[in]  caller_id  ID of the module that entered the critical section.
+ */
+static void profiler_hold_start(uint32_t caller_id)
+{
+    uint32_t priority;
+
+    if (m_nested_critical_section_counter != 1)
+    {
+        return;
+    }
+
+    // The high precision timer runs only while the timeslot is granted. The grant cannot change
+    // while the critical section is held, because RSCH notifications are deferred.
+    m_profiler_active = nrf_802154_rsch_prec_is_approved(RSCH_PREC_RAAL, RSCH_PRIO_MIN_APPROVED);
+
+    if (!m_profiler_active)
+    {
+        return;
+    }
+
+    priority = nrf_802154_critical_section_active_vector_priority_get();
+
+    if (priority >= (NRF_802154_STAT_CRIT_SECT_PRIORITIES - 1))
+    {
+        // The last entry is used for the thread mode.
+        priority = NRF_802154_STAT_CRIT_SECT_PRIORITIES - 1;
+    }
+
+    m_profiler_caller = (caller_id < NRF_802154_STAT_CRIT_SECT_CALLERS) ?
+                        (uint8_t)caller_id : PROFILER_CALLER_UNKNOWN;
+    m_profiler_priority   = (uint8_t)priority;
+    m_profiler_start_time = nrf_802154_hp_timer_current_time_get();
+}
+
+/** @brief Update hold time statistics with the given hold time. */
+static void profiler_hold_add(volatile nrf_802154_stat_crit_sect_hold_t * p_hold, uint32_t time)
+{
+    p_hold->count++;
+    p_hold->total_time += time;
+
+    if (time > p_hold->max_time)
+    {
+        p_hold->max_time = time;
+    }
+}
+
+/** @brief Finish measuring the hold time if the outermost critical section is to be exited.
+ *
+ * @note This function must be called with the critical section entered.
+ */
+static void profiler_hold_end(void)
+{
+    uint32_t time;
+
+    if ((m_nested_critical_section_counter != 1) || !m_profiler_active)
+    {
+        return;
+    }
+
+    m_profiler_active = false;
+
+    time = nrf_802154_hp_timer_current_time_get() - m_profiler_start_time;
+
+    profiler_hold_add(&g_nrf_802154_stat_crit_sect.callers[m_profiler_caller], time);
+    profiler_hold_add(&g_nrf_802154_stat_crit_sect.priorities[m_profiler_priority], time);
+}
+
+#endif // NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
 /***************************************************************************************************
  * @section API functions
  **************************************************************************************************/
@@ -215,6 +319,53 @@ void nrf_802154_critical_section_init(void)
     m_nested_critical_section_allowed_priority = NESTED_CRITICAL_SECTION_ALLOWED_PRIORITY_NONE;
 }
 
+#if NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
+bool nrf_802154_critical_section_enter_profiled(uint32_t caller_id)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = critical_section_enter(false);
+
+    if (result)
+    {
+        profiler_hold_start(caller_id);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+void nrf_802154_critical_section_forcefully_enter_profiled(uint32_t caller_id)
+{
+    bool critical_section_entered;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    critical_section_entered = critical_section_enter(true);
+    assert(critical_section_entered);
+    (void)critical_section_entered;
+
+    profiler_hold_start(caller_id);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+bool nrf_802154_critical_section_enter(void)
+{
+    return nrf_802154_critical_section_enter_profiled(PROFILER_CALLER_UNKNOWN);
+}
+
+void nrf_802154_critical_section_forcefully_enter(void)
+{
+    nrf_802154_critical_section_forcefully_enter_profiled(PROFILER_CALLER_UNKNOWN);
+}
+
+#else // NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
 bool nrf_802154_critical_section_enter(void)
 {
     bool result;
@@ -241,10 +392,16 @@ void nrf_802154_critical_section_forcefully_enter(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#endif // NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
 void nrf_802154_critical_section_exit(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+    profiler_hold_end();
+#endif
+
     critical_section_exit();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
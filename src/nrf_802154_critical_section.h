@@ -35,6 +35,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -75,6 +77,43 @@ void nrf_802154_critical_section_exit(void);
  */
 void nrf_802154_critical_section_forcefully_enter(void);
 
+#if NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
+/**
+ * @brief Function for entering a critical section in the 802.15.4 driver on behalf of a module.
+ *
+ * This function works like @ref nrf_802154_critical_section_enter, but the hold time of the
+ * critical section is counted for the module @p caller_id.
+ *
+ * @param[in]  caller_id  ID of the module that enters the critical section.
+ *
+ * @retval true   The critical section is entered.
+ * @retval false  The critical section could not be entered.
+ */
+bool nrf_802154_critical_section_enter_profiled(uint32_t caller_id);
+
+/**
+ * @brief Function for forcefully entering a critical section in the 802.15.4 driver on behalf
+ *        of a module.
+ *
+ * This function works like @ref nrf_802154_critical_section_forcefully_enter, but the hold time
+ * of the critical section is counted for the module @p caller_id.
+ *
+ * @param[in]  caller_id  ID of the module that enters the critical section.
+ */
+void nrf_802154_critical_section_forcefully_enter_profiled(uint32_t caller_id);
+
+#if defined(NRF_802154_MODULE_ID)
+// Modules with an ID have their hold times counted separately. Passing the functions by pointer
+// is not affected by these macros, such callers are counted as unknown.
+#define nrf_802154_critical_section_enter() \
+    nrf_802154_critical_section_enter_profiled(NRF_802154_MODULE_ID)
+#define nrf_802154_critical_section_forcefully_enter() \
+    nrf_802154_critical_section_forcefully_enter_profiled(NRF_802154_MODULE_ID)
+#endif
+
+#endif // NRF_802154_CRITICAL_SECTION_PROFILER_ENABLED
+
 /**
  * @brief Allows entry to a nested critical section.
  *
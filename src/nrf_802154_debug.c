@@ -41,6 +41,10 @@
 
 #include "nrf_802154_debug_log_codes.h"
 
+#if NRF_802154_LOG_RUNTIME_MASK_ENABLED
+volatile uint32_t g_nrf_802154_log_verbosity_mask = UINT32_MAX; ///< All levels enabled by default.
+#endif
+
 void nrf_802154_debug_gpio_init(void);
 void nrf_802154_debug_assert_init(void);
 
@@ -73,3 +77,11 @@ void nrf_802154_debug_init(void)
     nrf_802154_debug_assert_init();
 #endif // ENABLE_DEBUG_ASSERT
 }
+
+#if NRF_802154_LOG_RUNTIME_MASK_ENABLED
+void nrf_802154_debug_log_verbosity_mask_set(uint32_t mask)
+{
+    g_nrf_802154_log_verbosity_mask = mask;
+}
+
+#endif // NRF_802154_LOG_RUNTIME_MASK_ENABLED
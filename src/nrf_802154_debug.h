@@ -118,6 +118,21 @@ extern "C" {
  */
 void nrf_802154_debug_init(void);
 
+#if NRF_802154_LOG_RUNTIME_MASK_ENABLED
+
+/**
+ * @brief Sets the mask of log verbosity levels enabled at runtime.
+ *
+ * Bit n of @p mask enables log entries of verbosity n. Entries removed at compile time
+ * by the verbosity of a module (see @ref NRF_802154_LOG_VERBOSITY_DEFAULT) are not recorded
+ * regardless of the mask.
+ *
+ * @param[in]  mask  Mask of enabled verbosity levels.
+ */
+void nrf_802154_debug_log_verbosity_mask_set(uint32_t mask);
+
+#endif // NRF_802154_LOG_RUNTIME_MASK_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
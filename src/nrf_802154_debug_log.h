@@ -32,21 +32,67 @@
 #ifndef NRF_802154_DEBUG_LOG_H_
 #define NRF_802154_DEBUG_LOG_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "nrf_802154_config.h"
 #include "nrf_802154_sl_log.h"
 #include "nrf_802154_debug_log_codes.h"
+#include "nrf_802154_trace.h"
+
+#if NRF_802154_LOG_RUNTIME_MASK_ENABLED
+
+/** @brief Mask of verbosity levels enabled at runtime. Bit n enables entries of verbosity n. */
+extern volatile uint32_t g_nrf_802154_log_verbosity_mask;
+
+/**@brief Checks if the provided @p verbosity is enabled in the runtime mask. */
+#define nrf_802154_log_runtime_allows(verbosity)                     \
+    ((g_nrf_802154_log_verbosity_mask & (1UL << (verbosity))) != 0U)
+
+#else // NRF_802154_LOG_RUNTIME_MASK_ENABLED
+
+#define nrf_802154_log_runtime_allows(verbosity) true
+
+#endif // NRF_802154_LOG_RUNTIME_MASK_ENABLED
+
+/**@brief Checks if the provided @p verbosity allows the current module to record a log.
+ *
+ * The compile-time threshold of the module is checked first, so the entries below it
+ * are removed together with the runtime mask check.
+ */
+#define nrf_802154_log_verbosity_allows(verbosity)    \
+    (nrf_802154_sl_log_verbosity_allows(verbosity) && \
+     nrf_802154_log_runtime_allows(verbosity))
 
 /**@brief Records log about entry to a function.
  * @param verbosity     Verbosity level of the module in which log is recorded required to emit log.
  */
-#define nrf_802154_log_function_enter(verbosity) \
-    nrf_802154_sl_log_function_enter(verbosity)
+#define nrf_802154_log_function_enter(verbosity)                           \
+    do                                                                     \
+    {                                                                      \
+        if (nrf_802154_log_verbosity_allows(verbosity))                    \
+        {                                                                  \
+            nrf_802154_sl_log_function_enter(verbosity);                   \
+            nrf_802154_trace_function(verbosity,                           \
+                                      NRF_802154_LOG_TYPE_FUNCTION_ENTER); \
+        }                                                                  \
+    }                                                                      \
+    while (0)
 
 /**@brief Records log about exit from a function.
  * @param verbosity     Verbosity level of the module in which log is recorded required to emit log.
  */
-#define nrf_802154_log_function_exit(verbosity) \
-    nrf_802154_sl_log_function_exit(verbosity)
+#define nrf_802154_log_function_exit(verbosity)                           \
+    do                                                                    \
+    {                                                                     \
+        if (nrf_802154_log_verbosity_allows(verbosity))                   \
+        {                                                                 \
+            nrf_802154_sl_log_function_exit(verbosity);                   \
+            nrf_802154_trace_function(verbosity,                          \
+                                      NRF_802154_LOG_TYPE_FUNCTION_EXIT); \
+        }                                                                 \
+    }                                                                     \
+    while (0)
 
 /**@brief Records log about event (with parameter) related to current module.
  * @param verbosity         Verbosity level of the module in which log is recorded required to emit log.
@@ -56,8 +102,17 @@
  *                          of the parameter is defined by the module in which
  *                          the log is recorded and event_id.
  */
-#define nrf_802154_log_local_event(verbosity, local_event_id, param_u16) \
-    nrf_802154_sl_log_local_event(verbosity, local_event_id, param_u16)
+#define nrf_802154_log_local_event(verbosity, local_event_id, param_u16)         \
+    do                                                                           \
+    {                                                                            \
+        if (nrf_802154_log_verbosity_allows(verbosity))                          \
+        {                                                                        \
+            nrf_802154_sl_log_local_event(verbosity, local_event_id, param_u16); \
+            nrf_802154_trace_event(verbosity, NRF_802154_LOG_TYPE_LOCAL_EVENT,   \
+                                   local_event_id, param_u16);                   \
+        }                                                                        \
+    }                                                                            \
+    while (0)
 
 /**@brief Records log about event (with parameter) related to global resource.
  * @param verbosity     Verbosity level of the module in which log is recorded required to emit log.
@@ -65,7 +120,16 @@
  * @param param_u16     Additional parameter to be logged with event. Meaning
  *                      of the parameter is defined by value of global_event_id.
  */
-#define nrf_802154_log_global_event(verbosity, global_event_id, param_u16) \
-    nrf_802154_sl_log_global_event(verbosity, global_event_id, param_u16)
+#define nrf_802154_log_global_event(verbosity, global_event_id, param_u16)         \
+    do                                                                             \
+    {                                                                              \
+        if (nrf_802154_log_verbosity_allows(verbosity))                            \
+        {                                                                          \
+            nrf_802154_sl_log_global_event(verbosity, global_event_id, param_u16); \
+            nrf_802154_trace_event(verbosity, NRF_802154_LOG_TYPE_GLOBAL_EVENT,    \
+                                   global_event_id, param_u16);                    \
+        }                                                                          \
+    }                                                                              \
+    while (0)
 
 #endif /* NRF_802154_DEBUG_LOG_H_ */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the ring buffer of the records of the headers of received frames.
+ *
+ * The ring buffer has a single writer, the core receiving frames, and a single reader, the higher
+ * layer. One entry of the ring is always left empty to tell a full ring from an empty one.
+ *
+ */
+
+#include "nrf_802154_header_ring.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_HEADER_MONITOR_ENABLED
+
+static nrf_802154_header_record_t * mp_records;  ///< Memory of the ring buffer.
+static uint32_t                     m_count;     ///< Number of entries of the ring buffer.
+static volatile uint32_t            m_write_idx; ///< Index at which the next record is written.
+static volatile uint32_t            m_read_idx;  ///< Index of the first record not read yet.
+static volatile uint32_t            m_dropped;   ///< Number of records dropped for lack of space.
+static volatile bool                m_enabled;   ///< If header records are written.
+static volatile bool                m_retain;    ///< If full frames are retained.
+
+bool nrf_802154_header_ring_start(nrf_802154_header_record_t * p_records, uint32_t count)
+{
+    if ((p_records == NULL) || (count < 2U))
+    {
+        return false;
+    }
+
+    m_enabled = false;
+    __DMB();
+
+    mp_records  = p_records;
+    m_count     = count;
+    m_write_idx = 0;
+    m_read_idx  = 0;
+    m_dropped   = 0;
+
+    __DMB();
+    m_enabled = true;
+
+    return true;
+}
+
+void nrf_802154_header_ring_stop(void)
+{
+    m_enabled = false;
+}
+
+bool nrf_802154_header_ring_is_enabled(void)
+{
+    return m_enabled;
+}
+
+void nrf_802154_header_ring_frames_retain_set(bool retain)
+{
+    m_retain = retain;
+}
+
+bool nrf_802154_header_ring_frames_retain_get(void)
+{
+    return m_retain;
+}
+
+void nrf_802154_header_ring_frame_write(const uint8_t                            * p_data,
+                                        const nrf_802154_frame_parser_mhr_data_t * p_mhr_data,
+                                        const nrf_802154_rx_metadata_t           * p_metadata)
+{
+    uint32_t write_idx = m_write_idx;
+    uint32_t next_idx  = (write_idx + 1U < m_count) ? (write_idx + 1U) : 0U;
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    if (next_idx == m_read_idx)
+    {
+        m_dropped++;
+        return;
+    }
+
+    nrf_802154_header_record_t * p_record = &mp_records[write_idx];
+
+    p_record->time64 = (p_metadata->time == NRF_802154_NO_TIMESTAMP) ?
+                       NRF_802154_NO_TIMESTAMP : p_metadata->time64;
+
+    p_record->dst_panid_present = (p_mhr_data->p_dst_panid != NULL);
+    if (p_record->dst_panid_present)
+    {
+        memcpy(p_record->dst_panid, p_mhr_data->p_dst_panid, PAN_ID_SIZE);
+    }
+
+    p_record->src_panid_present = (p_mhr_data->p_src_panid != NULL);
+    if (p_record->src_panid_present)
+    {
+        memcpy(p_record->src_panid, p_mhr_data->p_src_panid, PAN_ID_SIZE);
+    }
+
+    p_record->dst_addr_size = 0U;
+    if (p_mhr_data->p_dst_addr != NULL)
+    {
+        p_record->dst_addr_size = p_mhr_data->dst_addr_size;
+        memcpy(p_record->dst_addr, p_mhr_data->p_dst_addr, p_record->dst_addr_size);
+    }
+
+    p_record->src_addr_size = 0U;
+    if (p_mhr_data->p_src_addr != NULL)
+    {
+        p_record->src_addr_size = p_mhr_data->src_addr_size;
+        memcpy(p_record->src_addr, p_mhr_data->p_src_addr, p_record->src_addr_size);
+    }
+
+    p_record->frame_type  = p_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK;
+    p_record->dsn_present = !nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_data);
+    p_record->dsn         = p_record->dsn_present ? p_data[DSN_OFFSET] : 0U;
+    p_record->length      = p_data[PHR_OFFSET];
+    p_record->power       = p_metadata->power;
+    p_record->lqi         = p_metadata->lqi;
+    p_record->channel     = p_metadata->channel;
+
+    // Publish the record after its content is written.
+    __DMB();
+    m_write_idx = next_idx;
+}
+
+uint32_t nrf_802154_header_ring_read(nrf_802154_header_record_t * p_records, uint32_t max_count)
+{
+    uint32_t read_idx  = m_read_idx;
+    uint32_t write_idx = m_write_idx;
+    uint32_t count     = 0;
+
+    __DMB();
+
+    while ((count < max_count) && (read_idx != write_idx))
+    {
+        p_records[count++] = mp_records[read_idx];
+        read_idx           = (read_idx + 1U < m_count) ? (read_idx + 1U) : 0U;
+    }
+
+    // Release the space after the records are copied.
+    __DMB();
+    m_read_idx = read_idx;
+
+    return count;
+}
+
+uint32_t nrf_802154_header_ring_dropped_get(void)
+{
+    return m_dropped;
+}
+
+#endif // NRF_802154_HEADER_MONITOR_ENABLED
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that writes records of the headers of received frames to a ring buffer.
+ *
+ */
+
+#ifndef NRF_802154_HEADER_RING_H_
+#define NRF_802154_HEADER_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts writing header records to the given ring buffer.
+ *
+ * @param[in]  p_records  Pointer to the memory to be used as the ring buffer.
+ * @param[in]  count      Number of records that fit in the memory. The ring buffer holds
+ *                        up to @p count - 1 records.
+ *
+ * @retval  true   Writing of the records started.
+ * @retval  false  The ring buffer cannot hold any record.
+ */
+bool nrf_802154_header_ring_start(nrf_802154_header_record_t * p_records, uint32_t count);
+
+/**
+ * @brief Stops writing header records.
+ *
+ * Records already written to the ring buffer can still be read.
+ */
+void nrf_802154_header_ring_stop(void);
+
+/**
+ * @brief Checks if header records are being written.
+ *
+ * @retval  true   Header records are written.
+ * @retval  false  The header monitor is stopped.
+ */
+bool nrf_802154_header_ring_is_enabled(void);
+
+/**
+ * @brief Sets if the full frames are to be retained in addition to the header records.
+ *
+ * @param[in]  retain  If the received frames are to be passed to the higher layer.
+ */
+void nrf_802154_header_ring_frames_retain_set(bool retain);
+
+/**
+ * @brief Checks if the full frames are retained in addition to the header records.
+ *
+ * @retval  true   Received frames are passed to the higher layer.
+ * @retval  false  Receive buffers are reused as soon as the header records are written.
+ */
+bool nrf_802154_header_ring_frames_retain_get(void);
+
+/**
+ * @brief Writes the record of the header of a received frame to the ring buffer.
+ *
+ * If the ring buffer is full, the record is dropped.
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[in]  p_mhr_data  Pointer to the parsed MHR of the frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the frame.
+ */
+void nrf_802154_header_ring_frame_write(const uint8_t                            * p_data,
+                                        const nrf_802154_frame_parser_mhr_data_t * p_mhr_data,
+                                        const nrf_802154_rx_metadata_t           * p_metadata);
+
+/**
+ * @brief Reads header records from the ring buffer.
+ *
+ * @param[out] p_records  Pointer to the array the records are copied to.
+ * @param[in]  max_count  Size of the @p p_records array.
+ *
+ * @returns  Number of records copied to @p p_records.
+ */
+uint32_t nrf_802154_header_ring_read(nrf_802154_header_record_t * p_records, uint32_t max_count);
+
+/**
+ * @brief Gets the number of records dropped because the ring buffer was full.
+ *
+ * @returns  Number of dropped records since the header monitor started.
+ */
+uint32_t nrf_802154_header_ring_dropped_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_HEADER_RING_H_ */
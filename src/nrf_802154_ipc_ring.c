@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the shared memory transport of frames between cores.
+ *
+ * Each ring has a single producer and a single consumer, each running on a different core. The
+ * producer writes a descriptor and then publishes it by advancing @c head. The consumer reads
+ * a descriptor and then releases its slot by advancing @c tail. Memory barriers order the accesses
+ * to the descriptors and to the indices, so no lock shared between the cores is needed.
+ *
+ */
+
+#include "nrf_802154_ipc_ring.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_IPC_RING_ENABLED
+
+#if (NRF_802154_IPC_RING_SIZE < 2) || \
+    ((NRF_802154_IPC_RING_SIZE & (NRF_802154_IPC_RING_SIZE - 1)) != 0)
+#error NRF_802154_IPC_RING_SIZE must be a power of two.
+#endif
+
+/// Mask that converts a free running index of a ring to the index of its descriptor.
+#define RING_IDX_MASK (NRF_802154_IPC_RING_SIZE - 1U)
+
+void nrf_802154_ipc_ring_init(nrf_802154_ipc_ring_t * p_ring)
+{
+    p_ring->head = 0;
+    p_ring->tail = 0;
+
+    __DMB();
+}
+
+bool nrf_802154_ipc_ring_put(nrf_802154_ipc_ring_t * p_ring, const nrf_802154_ipc_desc_t * p_desc)
+{
+    uint32_t head = p_ring->head;
+
+    if ((head - p_ring->tail) >= NRF_802154_IPC_RING_SIZE)
+    {
+        return false;
+    }
+
+    p_ring->descs[head & RING_IDX_MASK] = *p_desc;
+
+    // The descriptor must be visible to the consumer before its slot is published.
+    __DMB();
+
+    p_ring->head = head + 1U;
+
+    return true;
+}
+
+bool nrf_802154_ipc_ring_get(nrf_802154_ipc_ring_t * p_ring, nrf_802154_ipc_desc_t * p_desc)
+{
+    uint32_t tail = p_ring->tail;
+
+    if (tail == p_ring->head)
+    {
+        return false;
+    }
+
+    // The descriptor must not be read before its slot is seen as published.
+    __DMB();
+
+    *p_desc = p_ring->descs[tail & RING_IDX_MASK];
+
+    // The descriptor must be read before its slot is released to the producer.
+    __DMB();
+
+    p_ring->tail = tail + 1U;
+
+    return true;
+}
+
+static nrf_802154_ipc_shared_t * mp_shared; ///< Shared memory of the transport, NULL if not attached.
+
+void nrf_802154_ipc_ring_driver_attach(nrf_802154_ipc_shared_t * p_shared)
+{
+    nrf_802154_ipc_ring_init(&p_shared->to_host);
+    nrf_802154_ipc_ring_init(&p_shared->to_driver);
+
+    mp_shared = p_shared;
+}
+
+bool nrf_802154_ipc_ring_received_post(uint8_t                        * p_data,
+                                       const nrf_802154_rx_metadata_t * p_metadata)
+{
+    nrf_802154_ipc_desc_t desc =
+    {
+        .type    = NRF_802154_IPC_DESC_RECEIVED,
+        .status  = 0,
+        .power   = p_metadata->power,
+        .lqi     = p_metadata->lqi,
+        .p_frame = (uint32_t)(uintptr_t)p_data,
+        .p_aux   = 0,
+        .time    = p_metadata->time,
+    };
+
+    if ((mp_shared == NULL) || !nrf_802154_ipc_ring_put(&mp_shared->to_host, &desc))
+    {
+        nrf_802154_buffer_free_raw(p_data);
+        return false;
+    }
+
+    return true;
+}
+
+bool nrf_802154_ipc_ring_tx_result_post(const uint8_t       * p_frame,
+                                        uint8_t             * p_ack,
+                                        int8_t                power,
+                                        uint8_t               lqi,
+                                        nrf_802154_tx_error_t error)
+{
+    nrf_802154_ipc_desc_t desc =
+    {
+        .type    = (error == NRF_802154_TX_ERROR_NONE) ? NRF_802154_IPC_DESC_TRANSMITTED :
+                   NRF_802154_IPC_DESC_TRANSMIT_FAILED,
+        .status  = error,
+        .power   = power,
+        .lqi     = lqi,
+        .p_frame = (uint32_t)(uintptr_t)p_frame,
+        .p_aux   = (uint32_t)(uintptr_t)p_ack,
+        .time    = NRF_802154_NO_TIMESTAMP,
+    };
+
+    if ((mp_shared == NULL) || !nrf_802154_ipc_ring_put(&mp_shared->to_host, &desc))
+    {
+        if (p_ack != NULL)
+        {
+            nrf_802154_buffer_free_raw(p_ack);
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+/** Starts the transmission requested by the host. */
+static bool transmit(const uint8_t * p_frame, bool cca)
+{
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    return nrf_802154_transmit_raw_enqueue(p_frame, cca);
+#else
+    return nrf_802154_transmit_raw(p_frame, cca);
+#endif
+}
+
+uint32_t nrf_802154_ipc_ring_driver_process(void)
+{
+    nrf_802154_ipc_desc_t desc;
+    uint32_t              processed = 0;
+
+    if (mp_shared == NULL)
+    {
+        return 0;
+    }
+
+    while (nrf_802154_ipc_ring_get(&mp_shared->to_driver, &desc))
+    {
+        switch (desc.type)
+        {
+            case NRF_802154_IPC_DESC_BUFFER_FREE:
+                nrf_802154_buffer_free_raw((uint8_t *)(uintptr_t)desc.p_frame);
+                break;
+
+            case NRF_802154_IPC_DESC_TRANSMIT:
+                if (!transmit((const uint8_t *)(uintptr_t)desc.p_frame, desc.status != 0))
+                {
+                    (void)nrf_802154_ipc_ring_tx_result_post((const uint8_t *)(uintptr_t)desc.p_frame,
+                                                             NULL,
+                                                             0,
+                                                             0,
+                                                             NRF_802154_TX_ERROR_ABORTED);
+                }
+                break;
+
+            default:
+                // Descriptors of other types are not sent to the driver.
+                break;
+        }
+
+        processed++;
+    }
+
+    return processed;
+}
+
+#endif // NRF_802154_IPC_RING_ENABLED
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that passes frames between cores through descriptor rings in shared memory.
+ *
+ * The core that runs the driver attaches it to the shared memory with
+ * @ref nrf_802154_ipc_ring_driver_attach and posts received frames and transmit results from
+ * the driver callbacks. The host core reads them with @ref nrf_802154_ipc_ring_get from
+ * @c to_host and writes its requests with @ref nrf_802154_ipc_ring_put to @c to_driver. Signaling
+ * the other core after writing to a ring, for example with the IPC peripheral, is left to
+ * the user of this module.
+ *
+ */
+
+#ifndef NRF_802154_IPC_RING_H_
+#define NRF_802154_IPC_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Types of the descriptors passed through the rings.
+ */
+typedef enum
+{
+    NRF_802154_IPC_DESC_RECEIVED,        ///< Driver to host: a frame was received to @p p_frame.
+    NRF_802154_IPC_DESC_TRANSMITTED,     ///< Driver to host: @p p_frame was transmitted, its ACK is in @p p_aux.
+    NRF_802154_IPC_DESC_TRANSMIT_FAILED, ///< Driver to host: transmission of @p p_frame failed with @p status.
+    NRF_802154_IPC_DESC_BUFFER_FREE,     ///< Host to driver: the received frame @p p_frame is no longer used.
+    NRF_802154_IPC_DESC_TRANSMIT,        ///< Host to driver: transmit @p p_frame, with CCA if @p status is not 0.
+} nrf_802154_ipc_desc_type_t;
+
+/**
+ * @brief Structure of a descriptor passed through the rings.
+ *
+ * Pointers are stored as 32-bit addresses, so the frames must be placed at the same address in
+ * the memory maps of both cores.
+ */
+typedef struct
+{
+    uint8_t  type;    ///< Type of the descriptor, see @ref nrf_802154_ipc_desc_type_t.
+    uint8_t  status;  ///< Transmit error or CCA flag, depending on @p type.
+    int8_t   power;   ///< RSSI of the received frame or of the ACK.
+    uint8_t  lqi;     ///< LQI of the received frame or of the ACK.
+    uint32_t p_frame; ///< Address of the frame, starting with its PHR.
+    uint32_t p_aux;   ///< Address of the received ACK, or 0.
+    uint32_t time;    ///< Timestamp of the received frame, or @ref NRF_802154_NO_TIMESTAMP.
+} nrf_802154_ipc_desc_t;
+
+/**
+ * @brief Structure of a single-producer single-consumer ring of descriptors.
+ */
+typedef struct
+{
+    volatile uint32_t     head;                            ///< Number of descriptors written, updated by the producer.
+    volatile uint32_t     tail;                            ///< Number of descriptors read, updated by the consumer.
+    nrf_802154_ipc_desc_t descs[NRF_802154_IPC_RING_SIZE]; ///< Descriptors.
+} nrf_802154_ipc_ring_t;
+
+/**
+ * @brief Structure of the shared memory used by the transport.
+ */
+typedef struct
+{
+    nrf_802154_ipc_ring_t to_host;   ///< Descriptors written by the driver and read by the host.
+    nrf_802154_ipc_ring_t to_driver; ///< Descriptors written by the host and read by the driver.
+} nrf_802154_ipc_shared_t;
+
+#if NRF_802154_IPC_RING_ENABLED
+
+/**
+ * @brief Initializes a ring as empty.
+ *
+ * @param[out] p_ring  Pointer to the ring.
+ */
+void nrf_802154_ipc_ring_init(nrf_802154_ipc_ring_t * p_ring);
+
+/**
+ * @brief Writes a descriptor to a ring.
+ *
+ * Only one context can write to a ring at a time.
+ *
+ * @param[in]  p_ring  Pointer to the ring.
+ * @param[in]  p_desc  Pointer to the descriptor to be copied to the ring.
+ *
+ * @retval true   The descriptor was written.
+ * @retval false  The ring is full.
+ */
+bool nrf_802154_ipc_ring_put(nrf_802154_ipc_ring_t * p_ring, const nrf_802154_ipc_desc_t * p_desc);
+
+/**
+ * @brief Reads a descriptor from a ring.
+ *
+ * Only one context can read from a ring at a time.
+ *
+ * @param[in]  p_ring  Pointer to the ring.
+ * @param[out] p_desc  Pointer to the memory the descriptor is copied to.
+ *
+ * @retval true   The descriptor was read.
+ * @retval false  The ring is empty.
+ */
+bool nrf_802154_ipc_ring_get(nrf_802154_ipc_ring_t * p_ring, nrf_802154_ipc_desc_t * p_desc);
+
+/**
+ * @brief Attaches the driver to the shared memory of the transport.
+ *
+ * Both rings are initialized as empty, so the host must not use them until this function returns.
+ *
+ * @param[in]  p_shared  Pointer to the shared memory.
+ */
+void nrf_802154_ipc_ring_driver_attach(nrf_802154_ipc_shared_t * p_shared);
+
+/**
+ * @brief Passes a received frame to the host.
+ *
+ * Intended to be called from @ref nrf_802154_received_metadata_raw. The frame stays in its
+ * receive buffer until the host returns it with an @ref NRF_802154_IPC_DESC_BUFFER_FREE
+ * descriptor.
+ *
+ * @param[in]  p_data      Pointer to the buffer that contains the received frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the received frame.
+ *
+ * @retval true   The frame was passed to the host.
+ * @retval false  The ring to the host is full. The buffer is freed and the frame is dropped.
+ */
+bool nrf_802154_ipc_ring_received_post(uint8_t                        * p_data,
+                                       const nrf_802154_rx_metadata_t * p_metadata);
+
+/**
+ * @brief Passes the result of a transmission to the host.
+ *
+ * Intended to be called from @ref nrf_802154_transmitted_raw and
+ * @ref nrf_802154_transmit_failed.
+ *
+ * @param[in]  p_frame  Pointer to the transmitted frame.
+ * @param[in]  p_ack    Pointer to the received ACK, or NULL. It is freed by the host like
+ *                      a received frame.
+ * @param[in]  power    RSSI of the ACK.
+ * @param[in]  lqi      LQI of the ACK.
+ * @param[in]  error    Transmit error, @ref NRF_802154_TX_ERROR_NONE if the frame was transmitted.
+ *
+ * @retval true   The result was passed to the host.
+ * @retval false  The ring to the host is full. The ACK buffer, if any, is freed.
+ */
+bool nrf_802154_ipc_ring_tx_result_post(const uint8_t       * p_frame,
+                                        uint8_t             * p_ack,
+                                        int8_t                power,
+                                        uint8_t               lqi,
+                                        nrf_802154_tx_error_t error);
+
+/**
+ * @brief Processes the descriptors written by the host.
+ *
+ * Intended to be called when the host signals the driver core that it wrote descriptors, for
+ * example from the IPC interrupt handler. Receive buffers are returned to the driver and
+ * requested transmissions are started. A transmission that cannot be started is reported to
+ * the host with @ref NRF_802154_TX_ERROR_ABORTED.
+ *
+ * @returns  Number of descriptors processed.
+ */
+uint32_t nrf_802154_ipc_ring_driver_process(void);
+
+#endif // NRF_802154_IPC_RING_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_IPC_RING_H_ */
@@ -66,11 +66,11 @@ void nrf_802154_notification_init(void);
 /**
  * @brief Notifies the next higher layer that a frame was received.
  *
- * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the received frame.
- * @param[in]  power   RSSI measured during the frame reception.
- * @param[in]  lqi     LQI indicating measured link quality during the frame reception.
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the received frame. The metadata is copied,
+ *                         so the structure does not need to be valid after this function returns.
  */
-void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi);
+void nrf_802154_notify_received(uint8_t * p_data, const nrf_802154_rx_metadata_t * p_metadata);
 
 /**
  * @brief Notifies the next higher layer that the reception of a frame failed.
@@ -79,6 +79,23 @@ void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi);
  */
 void nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error);
 
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
+/**
+ * @brief Notifies the next higher layer that a Data Request was received and acknowledged.
+ *
+ * @param[in]  p_src_addr         Pointer to the source address of the Data Request. The address
+ *                                is copied.
+ * @param[in]  src_addr_extended  If @p p_src_addr is an extended address.
+ * @param[in]  p_metadata         Pointer to the metadata of the Data Request. The metadata
+ *                                is copied.
+ */
+void nrf_802154_notify_data_request_received(const uint8_t                  * p_src_addr,
+                                             bool                             src_addr_extended,
+                                             const nrf_802154_rx_metadata_t * p_metadata);
+
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
 /**
  * @brief Notifies the next higher layer that a frame was transmitted.
  *
@@ -116,6 +133,16 @@ void nrf_802154_notify_energy_detected(uint8_t result);
  */
 void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies the next higher layer that the energy detection sweep ended.
+ *
+ * @param[in]  channel_mask  Mask of the scanned channels.
+ * @param[in]  p_results     Array of the detected energy levels, starting from the channel
+ *                           @ref NRF_802154_ED_SWEEP_CHANNEL_FIRST.
+ */
+void nrf_802154_notify_energy_detection_sweep_done(uint32_t        channel_mask,
+                                                   const uint8_t * p_results);
+
 /**
  * @brief Notifies the next higher layer that the CCA procedure ended.
  *
@@ -130,6 +157,30 @@ void nrf_802154_notify_cca(bool is_free);
  */
 void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error);
 
+#if NRF_802154_TSCH_ENABLED
+
+/**
+ * @brief Notifies the next higher layer that a cell of the TSCH slotframe was completed.
+ *
+ * @param[in]  slot_offset  Slot offset of the completed cell.
+ * @param[in]  asn          Absolute Slot Number of the timeslot in which the cell was performed.
+ */
+void nrf_802154_notify_tsch_cell_completed(uint16_t slot_offset, uint64_t asn);
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+
+/**
+ * @brief Notifies the next higher layer that an asynchronous request was processed.
+ *
+ * @param[in]  request  Type of the processed request.
+ * @param[in]  result   Result of the request.
+ */
+void nrf_802154_notify_async_request_done(nrf_802154_async_request_t request, bool result);
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
 /**
  *@}
  **/
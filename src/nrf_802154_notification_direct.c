@@ -42,6 +42,9 @@
 
 #include "nrf_802154.h"
 #include "nrf_802154_critical_section.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_tx_buffer.h"
+#include "mac_features/nrf_802154_tx_queue.h"
 
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
@@ -51,25 +54,58 @@ void nrf_802154_notification_init(void)
     // Intentionally empty
 }
 
-void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
+void nrf_802154_notify_received(uint8_t * p_data, const nrf_802154_rx_metadata_t * p_metadata)
 {
-#if NRF_802154_USE_RAW_API
-    nrf_802154_received_raw(p_data, power, lqi);
+#if NRF_802154_LATENCY_STATS_ENABLED
+    nrf_802154_stat_latency_record(NRF_802154_STAT_LATENCY_RX_DELIVERY,
+                                   nrf_802154_stat_latency_mark_get(
+                                       NRF_802154_STAT_LATENCY_RX_DELIVERY));
+#endif
+
+#if NRF_802154_RX_BATCH_NOTIFY_ENABLED
+    nrf_802154_rx_frame_t frame = {.p_data = p_data, .metadata = *p_metadata};
+
+    nrf_802154_received_batch_raw(&frame, 1);
+#elif NRF_802154_USE_RAW_API
+    nrf_802154_received_metadata_raw(p_data, p_metadata);
 #else // NRF_802154_USE_RAW_API
-    nrf_802154_received(p_data + RAW_PAYLOAD_OFFSET, p_data[RAW_LENGTH_OFFSET], power, lqi);
+    nrf_802154_received_metadata(p_data + RAW_PAYLOAD_OFFSET,
+                                 p_data[RAW_LENGTH_OFFSET],
+                                 p_metadata);
 #endif  // NRF_802154_USE_RAW_API
 }
 
 void nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error)
 {
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+    // There is no queue to merge the failures in, each one is notified at once.
+    nrf_802154_receive_failed_coalesced(error, 1);
+#else
     nrf_802154_receive_failed(error);
+#endif
+}
+
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+void nrf_802154_notify_data_request_received(const uint8_t                  * p_src_addr,
+                                             bool                             src_addr_extended,
+                                             const nrf_802154_rx_metadata_t * p_metadata)
+{
+    nrf_802154_data_request_received(p_src_addr, src_addr_extended, p_metadata);
 }
 
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
 void nrf_802154_notify_transmitted(const uint8_t * p_frame,
                                    uint8_t       * p_ack,
                                    int8_t          power,
                                    uint8_t         lqi)
 {
+#if NRF_802154_LATENCY_STATS_ENABLED
+    nrf_802154_stat_latency_record(NRF_802154_STAT_LATENCY_TX_COMPLETION,
+                                   nrf_802154_stat_latency_mark_get(
+                                       NRF_802154_STAT_LATENCY_TX_COMPLETION));
+#endif
+
 #if NRF_802154_USE_RAW_API
     nrf_802154_transmitted_raw(p_frame, p_ack, power, lqi);
 #else // NRF_802154_USE_RAW_API
@@ -79,15 +115,29 @@ void nrf_802154_notify_transmitted(const uint8_t * p_frame,
                            power,
                            lqi);
 #endif // NRF_802154_USE_RAW_API
+
+#if NRF_802154_TX_BUFFERS > 0
+    nrf_802154_tx_buffer_pool_frame_done(p_frame);
+#endif
 }
 
 void nrf_802154_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    // Frames queued after the failed one are not transmitted. The queue is flushed before
+    // the failed frame is handed back to the higher layer.
+    nrf_802154_tx_queue_failed_flush(p_frame);
+#endif
+
 #if NRF_802154_USE_RAW_API
     nrf_802154_transmit_failed(p_frame, error);
 #else // NRF_802154_USE_RAW_API
     nrf_802154_transmit_failed(p_frame + RAW_PAYLOAD_OFFSET, error);
 #endif  // NRF_802154_USE_RAW_API
+
+#if NRF_802154_TX_BUFFERS > 0
+    nrf_802154_tx_buffer_pool_frame_done(p_frame);
+#endif
 }
 
 void nrf_802154_notify_energy_detected(uint8_t result)
@@ -100,6 +150,12 @@ void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     nrf_802154_energy_detection_failed(error);
 }
 
+void nrf_802154_notify_energy_detection_sweep_done(uint32_t        channel_mask,
+                                                   const uint8_t * p_results)
+{
+    nrf_802154_energy_detection_sweep_done(channel_mask, p_results);
+}
+
 void nrf_802154_notify_cca(bool is_free)
 {
     nrf_802154_cca_done(is_free);
@@ -109,3 +165,19 @@ void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error)
 {
     nrf_802154_cca_failed(error);
 }
+
+#if NRF_802154_TSCH_ENABLED
+void nrf_802154_notify_tsch_cell_completed(uint16_t slot_offset, uint64_t asn)
+{
+    nrf_802154_tsch_cell_completed(slot_offset, asn);
+}
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+void nrf_802154_notify_async_request_done(nrf_802154_async_request_t request, bool result)
+{
+    nrf_802154_async_request_done(request, result);
+}
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
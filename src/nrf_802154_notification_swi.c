@@ -40,23 +40,44 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_queue.h"
+#include "nrf_802154_ram_usage.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
+#include "nrf_802154_tx_buffer.h"
 #include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_encrypt.h"
+#include "mac_features/nrf_802154_tx_queue.h"
 #include "hal/nrf_egu.h"
 
 /** Size of notification queue.
  *
- * One slot for each receive buffer, one for transmission, one for busy channel and one for energy
- * detection.
+ * One slot for each receive buffer (including small ones), one for transmission, one for each frame
+ * dropped from the transmit queue, one for busy channel and one for energy detection.
+ * If asynchronous requests are enabled, there is also one slot for each request that can be
+ * queued at a time.
  *
  * One slot is lost due to simplified queue implementation.
  */
-#define NTF_QUEUE_SIZE ((NRF_802154_RX_BUFFERS + 3) + 1)
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+#define NTF_ASYNC_REQUEST_SLOTS NRF_802154_REQUEST_QUEUE_SIZE
+#else
+#define NTF_ASYNC_REQUEST_SLOTS 0
+#endif
+
+#if NRF_802154_NOTIFICATION_QUEUE_SIZE > 0
+#define NTF_QUEUE_SIZE          (NRF_802154_NOTIFICATION_QUEUE_SIZE + 1)
+#else
+#define NTF_QUEUE_SIZE          ((NRF_802154_RX_BUFFERS + NRF_802154_RX_SMALL_BUFFERS + \
+                                  NRF_802154_TX_QUEUE_SIZE + NTF_ASYNC_REQUEST_SLOTS + 3) + 1)
+#endif
 
 #define NTF_INT        NRF_EGU_INT_TRIGGERED0   ///< Label of notification interrupt.
 #define NTF_TASK       NRF_EGU_TASK_TRIGGER0    ///< Label of notification task.
@@ -67,12 +88,16 @@ typedef enum
 {
     NTF_TYPE_RECEIVED,                ///< Frame received
     NTF_TYPE_RECEIVE_FAILED,          ///< Frame reception failed
+    NTF_TYPE_DATA_REQUEST_RECEIVED,   ///< Data Request received and acknowledged
     NTF_TYPE_TRANSMITTED,             ///< Frame transmitted
     NTF_TYPE_TRANSMIT_FAILED,         ///< Frame transmission failure
     NTF_TYPE_ENERGY_DETECTED,         ///< Energy detection procedure ended
     NTF_TYPE_ENERGY_DETECTION_FAILED, ///< Energy detection procedure failed
+    NTF_TYPE_ENERGY_SWEEP_DONE,       ///< Energy detection sweep ended
     NTF_TYPE_CCA,                     ///< CCA procedure ended
     NTF_TYPE_CCA_FAILED,              ///< CCA procedure failed
+    NTF_TYPE_TSCH_CELL_COMPLETED,     ///< Cell of the TSCH slotframe completed
+    NTF_TYPE_ASYNC_REQUEST_DONE,      ///< Asynchronous request processed
 } nrf_802154_ntf_type_t;
 
 /// Notification data in the notification queue.
@@ -84,22 +109,39 @@ typedef struct
     {
         struct
         {
-            uint8_t * p_data; ///< Pointer to a buffer containing PHR and PSDU of the received frame.
-            int8_t    power;  ///< RSSI of received frame.
-            uint8_t   lqi;    ///< LQI of received frame.
-        } received;           ///< Received frame details.
+            uint8_t                * p_data;   ///< Pointer to a buffer containing PHR and PSDU of the received frame.
+            nrf_802154_rx_metadata_t metadata; ///< Metadata of the received frame.
+#if NRF_802154_LATENCY_STATS_ENABLED
+            uint32_t                 start_time; ///< Time when the reception of the frame ended.
+#endif
+        } received;                            ///< Received frame details.
 
         struct
         {
             nrf_802154_rx_error_t error; ///< An error code that indicates reason of the failure.
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+            uint32_t              count; ///< Number of consecutive failures with this error code.
+#endif
         } receive_failed;
 
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+        struct
+        {
+            uint8_t                  src_addr[EXTENDED_ADDRESS_SIZE]; ///< Source address of the Data Request.
+            bool                     src_addr_extended;               ///< If @p src_addr is an extended address.
+            nrf_802154_rx_metadata_t metadata;                        ///< Metadata of the Data Request.
+        } data_request_received;                                      ///< Received Data Request details.
+#endif
+
         struct
         {
             const uint8_t * p_frame; ///< Pointer to frame that was transmitted.
             uint8_t       * p_ack;   ///< Pointer to a buffer containing PHR and PSDU of the received ACK or NULL.
             int8_t          power;   ///< RSSI of received ACK or 0.
             uint8_t         lqi;     ///< LQI of received ACK or 0.
+#if NRF_802154_LATENCY_STATS_ENABLED
+            uint32_t        start_time; ///< Time when the transmission ended.
+#endif
         } transmitted;               ///< Transmitted frame details.
 
         struct
@@ -118,6 +160,12 @@ typedef struct
             nrf_802154_ed_error_t error; ///< An error code that indicates reason of the failure.
         } energy_detection_failed;       ///< Energy detection failure details.
 
+        struct
+        {
+            uint32_t        channel_mask; ///< Mask of the scanned channels.
+            const uint8_t * p_results;    ///< Detected energy levels of the channels.
+        } energy_sweep_done;              ///< Energy detection sweep details.
+
         struct
         {
             bool result; ///< CCA result.
@@ -127,13 +175,123 @@ typedef struct
         {
             nrf_802154_cca_error_t error; ///< An error code that indicates reason of the failure.
         } cca_failed;                     ///< CCA failure details.
+
+        struct
+        {
+            uint32_t asn_lo;      ///< Least significant word of the Absolute Slot Number.
+            uint32_t asn_hi;      ///< Most significant word of the Absolute Slot Number.
+            uint16_t slot_offset; ///< Slot offset of the completed cell.
+        } tsch_cell_completed;    ///< Completed TSCH cell details.
+
+        struct
+        {
+            nrf_802154_async_request_t request; ///< Type of the processed request.
+            bool                       result;  ///< Result of the request.
+        } async_request_done;                   ///< Asynchronous request details.
     } data;                               ///< Notification data depending on it's type.
 } nrf_802154_ntf_data_t;
 
-static nrf_802154_queue_t    m_notifications_queue;
-static nrf_802154_ntf_data_t m_notifications_queue_memory[NTF_QUEUE_SIZE];
+#if NRF_802154_NOTIFICATION_PRIORITY_ENABLED
+#define NTF_CLASS_COUNT 2 ///< Number of notification priority classes.
+#else
+#define NTF_CLASS_COUNT 1 ///< Number of notification priority classes.
+#endif
+
+/// Priority classes of notifications. Classes with lower values are passed first.
+typedef enum
+{
+    NTF_CLASS_CONTROL = 0,                   ///< Results of transmission, CCA and ED procedures.
+    NTF_CLASS_RX      = NTF_CLASS_COUNT - 1, ///< Reception results and TSCH cells.
+} nrf_802154_ntf_class_t;
+
+/// Notification queues, one for each priority class.
+static nrf_802154_queue_t    m_notifications_queues[NTF_CLASS_COUNT];
+static nrf_802154_ntf_data_t m_notifications_queues_memory[NTF_CLASS_COUNT][NTF_QUEUE_SIZE];
+
+#if NRF_802154_QUEUE_STATS_ENABLED
+/// Write times of the items in the notification queues.
+static uint32_t m_notifications_queues_push_times[NTF_CLASS_COUNT][NTF_QUEUE_SIZE];
+
+NRF_802154_RAM_USAGE_REPORT(notification,
+                            sizeof(m_notifications_queues_memory) +
+                            sizeof(m_notifications_queues_push_times));
+#else
+NRF_802154_RAM_USAGE_REPORT(notification, sizeof(m_notifications_queues_memory));
+#endif
+
+/// State of a notify block, kept by the notifying function between @ref ntf_enter and
+/// @ref ntf_exit, so that a nested notification does not overwrite it.
+typedef struct
+{
+    nrf_802154_queue_t            * p_queue; ///< Queue written in the block.
+    nrf_802154_mcu_critical_state_t mcu_cs;  ///< State of the MCU critical section.
+#if NRF_802154_NOTIFICATION_QUEUE_LOCK_FREE
+    bool                            locked;  ///< If interrupts are masked in the block.
+#endif
+} ntf_block_t;
+
+#if NRF_802154_NOTIFICATION_THREAD_ENABLED && NRF_802154_NOTIFICATION_THREAD_WAKEUP_BATCHED
+/// If the thread was woken up and has not started processing the notification queue yet.
+static volatile bool m_thread_wakeup_pending;
+#endif
+
+#if NRF_802154_RX_BATCH_NOTIFY_ENABLED
+/** Maximal number of frames passed in a single batch.
+ *
+ * Frames are held until freed by the higher layer, so there are never more frame reception
+ * notifications in the queue than there are receive buffers.
+ */
+#define NTF_RX_BATCH_SIZE (NRF_802154_RX_BUFFERS + NRF_802154_RX_SMALL_BUFFERS)
+
+#if NTF_RX_BATCH_SIZE > UINT8_MAX
+#error Too many receive buffers for batched reception notifications.
+#endif
+
+/// Frames collected from the notification queue to be passed to the higher layer in one batch.
+static nrf_802154_rx_frame_t m_rx_batch[NTF_RX_BATCH_SIZE];
+#endif
+
+/**
+ * Mask interrupts for the update of a notification queue, unless no other notifier can
+ * preempt the caller.
+ *
+ * The queues have a single reader, so without masking they tolerate only one writer at a time.
+ * A notifier running at the highest interrupt priority cannot be preempted by another one, and
+ * notifiers running at lower priorities, including those called outside of the critical section
+ * of the driver, always mask interrupts. Therefore only the former skip the masking.
+ *
+ * @param[out]  p_block  State of the notify block.
+ */
+static void ntf_lock(ntf_block_t * p_block)
+{
+#if NRF_802154_NOTIFICATION_QUEUE_LOCK_FREE
+    p_block->locked = (nrf_802154_critical_section_active_vector_priority_get() != 0U);
 
-static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
+    if (!p_block->locked)
+    {
+        return;
+    }
+#endif
+
+    nrf_802154_mcu_critical_enter(p_block->mcu_cs);
+}
+
+/**
+ * Unmask interrupts masked by @ref ntf_lock.
+ *
+ * @param[in]  p_block  State of the notify block.
+ */
+static void ntf_unlock(ntf_block_t * p_block)
+{
+#if NRF_802154_NOTIFICATION_QUEUE_LOCK_FREE
+    if (!p_block->locked)
+    {
+        return;
+    }
+#endif
+
+    nrf_802154_mcu_critical_exit(p_block->mcu_cs);
+}
 
 /**
  * Enter notify block.
@@ -141,30 +299,94 @@ static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
  * This is a helper function used in all notification functions to atomically
  * find an empty slot in the notification queue and allow atomic slot update.
  *
+ * @param[in]   ntf_class  Priority class of the notification.
+ * @param[out]  p_block    State of the notify block to be passed to @ref ntf_exit.
+ *
  * @return Pointer to an empty slot in the notification queue.
  */
-static nrf_802154_ntf_data_t * ntf_enter(void)
+static nrf_802154_ntf_data_t * ntf_enter(nrf_802154_ntf_class_t ntf_class, ntf_block_t * p_block)
+{
+    ntf_lock(p_block);
+
+    p_block->p_queue = &m_notifications_queues[ntf_class];
+
+    assert(!nrf_802154_queue_is_full(p_block->p_queue));
+
+    return nrf_802154_queue_push_begin(p_block->p_queue);
+}
+
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+/**
+ * Enter notify block if there is room in the queue of the given class.
+ *
+ * This function works like @ref ntf_enter, but does not assert that the queue is not full.
+ * If it returns NULL, @ref ntf_exit is not to be called.
+ *
+ * @param[in]   ntf_class  Priority class of the notification.
+ * @param[out]  p_block    State of the notify block to be passed to @ref ntf_exit.
+ *
+ * @return  Pointer to the slot in the notification queue, or NULL if the queue is full.
+ */
+static nrf_802154_ntf_data_t * ntf_try_enter(nrf_802154_ntf_class_t ntf_class,
+                                             ntf_block_t          * p_block)
+{
+    ntf_lock(p_block);
+
+    p_block->p_queue = &m_notifications_queues[ntf_class];
+
+    if (nrf_802154_queue_is_full(p_block->p_queue))
+    {
+        ntf_unlock(p_block);
+        return NULL;
+    }
+
+    return nrf_802154_queue_push_begin(p_block->p_queue);
+}
+
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
+#if NRF_802154_NOTIFICATION_THREAD_ENABLED
+/**
+ * Wake up the thread processing the notification queue.
+ *
+ * With batched wake-ups, the thread is woken up only once until it starts processing the queue,
+ * as it passes all notifications issued before that.
+ */
+static void ntf_thread_wakeup(void)
 {
-    nrf_802154_mcu_critical_enter(m_mcu_cs);
+#if NRF_802154_NOTIFICATION_THREAD_WAKEUP_BATCHED
+    if (m_thread_wakeup_pending)
+    {
+        return;
+    }
 
-    assert(!nrf_802154_queue_is_full(&m_notifications_queue));
+    m_thread_wakeup_pending = true;
+#endif
 
-    return nrf_802154_queue_push_begin(&m_notifications_queue);
+    nrf_802154_notification_thread_wakeup();
 }
 
+#endif // NRF_802154_NOTIFICATION_THREAD_ENABLED
+
 /**
  * Exit notify block.
  *
  * This is a helper function used in all notification functions to end atomic slot update
  * and trigger SWI to process the notification from the slot.
+ *
+ * @param[in]  p_block  State of the notify block filled by @ref ntf_enter.
  */
-static void ntf_exit(void)
+static void ntf_exit(ntf_block_t * p_block)
 {
-    nrf_802154_queue_push_commit(&m_notifications_queue);
+    nrf_802154_queue_push_commit(p_block->p_queue);
 
+#if NRF_802154_NOTIFICATION_THREAD_ENABLED
+    ntf_thread_wakeup();
+#else
     nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, NTF_TASK);
+#endif
 
-    nrf_802154_mcu_critical_exit(m_mcu_cs);
+    ntf_unlock(p_block);
 }
 
 /**
@@ -172,22 +394,60 @@ static void ntf_exit(void)
  *
  * The notification is triggered from the SWI priority level.
  *
- * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the received frame.
- * @param[in]  power   RSSI measured during the frame reception.
- * @param[in]  lqi     LQI that indicates the measured link quality during the frame reception.
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the received frame.
  */
-void swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
+void swi_notify_received(uint8_t * p_data, const nrf_802154_rx_metadata_t * p_metadata)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_RX, &block);
+
+    p_slot->type                   = NTF_TYPE_RECEIVED;
+    p_slot->data.received.p_data   = p_data;
+    p_slot->data.received.metadata = *p_metadata;
+#if NRF_802154_LATENCY_STATS_ENABLED
+    p_slot->data.received.start_time =
+        nrf_802154_stat_latency_mark_get(NRF_802154_STAT_LATENCY_RX_DELIVERY);
+#endif
 
-    p_slot->type                 = NTF_TYPE_RECEIVED;
-    p_slot->data.received.p_data = p_data;
-    p_slot->data.received.power  = power;
-    p_slot->data.received.lqi    = lqi;
+    ntf_exit(&block);
+}
 
-    ntf_exit();
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+/**
+ * @brief Merges a reception failure with the failure notified last, if it is still queued.
+ *
+ * @param[in]  error  Error code that indicates reason of the failure.
+ *
+ * @retval  true   The failure was merged, nothing is to be queued.
+ * @retval  false  The failure must be queued as a new notification.
+ */
+static bool receive_failed_coalesce(nrf_802154_rx_error_t error)
+{
+    bool                    result = false;
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_last;
+
+    ntf_lock(&block);
+
+    p_last = nrf_802154_queue_last_pending_get(&m_notifications_queues[NTF_CLASS_RX]);
+
+    if ((p_last != NULL) &&
+        (p_last->type == NTF_TYPE_RECEIVE_FAILED) &&
+        (p_last->data.receive_failed.error == error) &&
+        (p_last->data.receive_failed.count < UINT32_MAX))
+    {
+        p_last->data.receive_failed.count++;
+        result = true;
+    }
+
+    ntf_unlock(&block);
+
+    return result;
 }
 
+#endif // NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+
 /**
  * @brief Notifies the next higher layer that the reception of a frame failed.
  *
@@ -195,14 +455,61 @@ void swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
  */
 void swi_notify_receive_failed(nrf_802154_rx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+    if (receive_failed_coalesce(error))
+    {
+        return;
+    }
+#endif
+
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_RX, &block);
 
     p_slot->type                      = NTF_TYPE_RECEIVE_FAILED;
     p_slot->data.receive_failed.error = error;
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+    p_slot->data.receive_failed.count = 1;
+#endif
+
+    ntf_exit(&block);
+}
 
-    ntf_exit();
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+/**
+ * @brief Notifies the next higher layer that a Data Request was received and acknowledged.
+ *
+ * The notification is dropped if the queue is full, as the Data Request is already handled
+ * by the driver.
+ *
+ * @param[in]  p_src_addr         Pointer to the source address of the Data Request.
+ * @param[in]  src_addr_extended  If @p p_src_addr is an extended address.
+ * @param[in]  p_metadata         Pointer to the metadata of the Data Request.
+ */
+void swi_notify_data_request_received(const uint8_t                  * p_src_addr,
+                                      bool                             src_addr_extended,
+                                      const nrf_802154_rx_metadata_t * p_metadata)
+{
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_try_enter(NTF_CLASS_RX, &block);
+
+    if (p_slot == NULL)
+    {
+        nrf_802154_stat_counter_increment(data_request_notifications_dropped);
+        return;
+    }
+
+    p_slot->type = NTF_TYPE_DATA_REQUEST_RECEIVED;
+    memcpy(p_slot->data.data_request_received.src_addr,
+           p_src_addr,
+           src_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+    p_slot->data.data_request_received.src_addr_extended = src_addr_extended;
+    p_slot->data.data_request_received.metadata          = *p_metadata;
+
+    ntf_exit(&block);
 }
 
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
 /**
  * @brief Notifies the next higher layer that a frame was transmitted
  *
@@ -219,15 +526,20 @@ void swi_notify_transmitted(const uint8_t * p_frame,
                             int8_t          power,
                             uint8_t         lqi)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
 
     p_slot->type                     = NTF_TYPE_TRANSMITTED;
     p_slot->data.transmitted.p_frame = p_frame;
     p_slot->data.transmitted.p_ack   = p_ack;
     p_slot->data.transmitted.power   = power;
     p_slot->data.transmitted.lqi     = lqi;
+#if NRF_802154_LATENCY_STATS_ENABLED
+    p_slot->data.transmitted.start_time =
+        nrf_802154_stat_latency_mark_get(NRF_802154_STAT_LATENCY_TX_COMPLETION);
+#endif
 
-    ntf_exit();
+    ntf_exit(&block);
 }
 
 /**
@@ -240,13 +552,14 @@ void swi_notify_transmitted(const uint8_t * p_frame,
  */
 void swi_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
 
     p_slot->type                         = NTF_TYPE_TRANSMIT_FAILED;
     p_slot->data.transmit_failed.p_frame = p_frame;
     p_slot->data.transmit_failed.error   = error;
 
-    ntf_exit();
+    ntf_exit(&block);
 }
 
 /**
@@ -257,12 +570,13 @@ void swi_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t e
  */
 void swi_notify_energy_detected(uint8_t result)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
 
     p_slot->type                        = NTF_TYPE_ENERGY_DETECTED;
     p_slot->data.energy_detected.result = result;
 
-    ntf_exit();
+    ntf_exit(&block);
 }
 
 /**
@@ -273,12 +587,32 @@ void swi_notify_energy_detected(uint8_t result)
  */
 void swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
 
     p_slot->type                               = NTF_TYPE_ENERGY_DETECTION_FAILED;
     p_slot->data.energy_detection_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(&block);
+}
+
+/**
+ * @brief Notifies the next higher layer that the energy detection sweep ended from
+ * the SWI priority level.
+ *
+ * @param[in]  channel_mask  Mask of the scanned channels.
+ * @param[in]  p_results     Array of the detected energy levels.
+ */
+void swi_notify_energy_detection_sweep_done(uint32_t channel_mask, const uint8_t * p_results)
+{
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
+
+    p_slot->type                                = NTF_TYPE_ENERGY_SWEEP_DONE;
+    p_slot->data.energy_sweep_done.channel_mask = channel_mask;
+    p_slot->data.energy_sweep_done.p_results    = p_results;
+
+    ntf_exit(&block);
 }
 
 /**
@@ -290,12 +624,13 @@ void swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
  */
 void swi_notify_cca(bool channel_free)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
 
     p_slot->type            = NTF_TYPE_CCA;
     p_slot->data.cca.result = channel_free;
 
-    ntf_exit();
+    ntf_exit(&block);
 }
 
 /**
@@ -307,28 +642,139 @@ void swi_notify_cca(bool channel_free)
  */
 void swi_notify_cca_failed(nrf_802154_cca_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
 
     p_slot->type                  = NTF_TYPE_CCA_FAILED;
     p_slot->data.cca_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(&block);
+}
+
+#if NRF_802154_TSCH_ENABLED
+/**
+ * @brief Notifies the next higher layer that a cell of the TSCH slotframe was completed.
+ *
+ * The notification is triggered from the SWI priority level.
+ *
+ * @param[in]  slot_offset  Slot offset of the completed cell.
+ * @param[in]  asn          Absolute Slot Number of the timeslot in which the cell was performed.
+ */
+void swi_notify_tsch_cell_completed(uint16_t slot_offset, uint64_t asn)
+{
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_RX, &block);
+
+    p_slot->type                                 = NTF_TYPE_TSCH_CELL_COMPLETED;
+    p_slot->data.tsch_cell_completed.asn_lo      = (uint32_t)asn;
+    p_slot->data.tsch_cell_completed.asn_hi      = (uint32_t)(asn >> 32);
+    p_slot->data.tsch_cell_completed.slot_offset = slot_offset;
+
+    ntf_exit(&block);
+}
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+/**
+ * @brief Notifies the next higher layer that an asynchronous request was processed.
+ *
+ * The notification is triggered from the SWI priority level.
+ *
+ * @param[in]  request  Type of the processed request.
+ * @param[in]  result   Result of the request.
+ */
+void swi_notify_async_request_done(nrf_802154_async_request_t request, bool result)
+{
+    ntf_block_t             block;
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_CLASS_CONTROL, &block);
+
+    p_slot->type                            = NTF_TYPE_ASYNC_REQUEST_DONE;
+    p_slot->data.async_request_done.request = request;
+    p_slot->data.async_request_done.result  = result;
+
+    ntf_exit(&block);
+}
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
+/**@brief Passes the result of a successful transmission to the higher layer.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ * @param[in]  p_ack    Pointer to a buffer that contains PHR and PSDU of ACK frame, or NULL.
+ * @param[in]  power    RSSI of the received ACK, or 0.
+ * @param[in]  lqi      LQI of the received ACK, or 0.
+ */
+static void transmitted_notify(const uint8_t * p_frame,
+                               uint8_t       * p_ack,
+                               int8_t          power,
+                               uint8_t         lqi)
+{
+#if NRF_802154_USE_RAW_API
+    nrf_802154_transmitted_raw(p_frame, p_ack, power, lqi);
+#else // NRF_802154_USE_RAW_API
+    uint8_t * p_psdu = NULL;
+    uint8_t   length = 0;
+
+    if (p_ack != NULL)
+    {
+        p_psdu = p_ack + RAW_PAYLOAD_OFFSET;
+        length = p_ack[RAW_LENGTH_OFFSET];
+    }
+    nrf_802154_transmitted(p_frame + RAW_PAYLOAD_OFFSET, p_psdu, length, power, lqi);
+#endif
+
+#if NRF_802154_TX_BUFFERS > 0
+    nrf_802154_tx_buffer_pool_frame_done(p_frame);
+#endif
+}
+
+/**@brief Passes the result of a failed transmission to the higher layer.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame that failed
+ *                      the transmission.
+ * @param[in]  error    Reason of the transmission failure.
+ */
+static void transmit_failed_notify(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+#if NRF_802154_USE_RAW_API
+    nrf_802154_transmit_failed(p_frame, error);
+#else // NRF_802154_USE_RAW_API
+    nrf_802154_transmit_failed(p_frame + RAW_PAYLOAD_OFFSET, error);
+#endif
+
+#if NRF_802154_TX_BUFFERS > 0
+    nrf_802154_tx_buffer_pool_frame_done(p_frame);
+#endif
 }
 
 void nrf_802154_notification_init(void)
 {
-    nrf_802154_queue_init(&m_notifications_queue, m_notifications_queue_memory,
-                          sizeof(m_notifications_queue_memory),
-                          sizeof(m_notifications_queue_memory[0]));
+    for (uint32_t i = 0; i < NTF_CLASS_COUNT; i++)
+    {
+        nrf_802154_queue_init(&m_notifications_queues[i], m_notifications_queues_memory[i],
+                              sizeof(m_notifications_queues_memory[i]),
+                              sizeof(m_notifications_queues_memory[i][0]));
+
+#if NRF_802154_QUEUE_STATS_ENABLED
+        nrf_802154_queue_stats_attach(&m_notifications_queues[i],
+                                      &g_nrf_802154_stat_queues.notifications,
+                                      m_notifications_queues_push_times[i]);
+#endif
+    }
 
+#if NRF_802154_NOTIFICATION_THREAD_ENABLED
+    // The queue is processed by the thread of the higher layer.
+#else
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, NTF_INT);
+#endif
 
     nrf_802154_swi_init();
 }
 
-void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
+void nrf_802154_notify_received(uint8_t * p_data, const nrf_802154_rx_metadata_t * p_metadata)
 {
-    swi_notify_received(p_data, power, lqi);
+    swi_notify_received(p_data, p_metadata);
 }
 
 void nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error)
@@ -336,100 +782,304 @@ void nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error)
     swi_notify_receive_failed(error);
 }
 
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+void nrf_802154_notify_data_request_received(const uint8_t                  * p_src_addr,
+                                             bool                             src_addr_extended,
+                                             const nrf_802154_rx_metadata_t * p_metadata)
+{
+    swi_notify_data_request_received(p_src_addr, src_addr_extended, p_metadata);
+}
+
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+
 void nrf_802154_notify_transmitted(const uint8_t * p_frame,
                                    uint8_t       * p_ack,
                                    int8_t          power,
                                    uint8_t         lqi)
 {
+#if NRF_802154_NOTIFICATION_DIRECT_TX_ENABLED
+#if NRF_802154_LATENCY_STATS_ENABLED
+    nrf_802154_stat_latency_record(NRF_802154_STAT_LATENCY_TX_COMPLETION,
+                                   nrf_802154_stat_latency_mark_get(
+                                       NRF_802154_STAT_LATENCY_TX_COMPLETION));
+#endif
+    transmitted_notify(p_frame, p_ack, power, lqi);
+#else
     swi_notify_transmitted(p_frame, p_ack, power, lqi);
+#endif
 }
 
 void nrf_802154_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
+#if NRF_802154_NOTIFICATION_DIRECT_TX_ENABLED
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    // Frames queued after the failed one are not transmitted. The queue is flushed before
+    // the failed frame is handed back to the higher layer.
+    nrf_802154_tx_queue_failed_flush(p_frame);
+#endif
+
+    transmit_failed_notify(p_frame, error);
+#else
     swi_notify_transmit_failed(p_frame, error);
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    // Frames queued after the failed one are not transmitted. They are notified after it, so that
+    // the higher layer gets the notifications in the order of the transmissions.
+    nrf_802154_tx_queue_failed_flush(p_frame);
+#endif
+#endif
 }
 
 void nrf_802154_notify_energy_detected(uint8_t result)
 {
+#if NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED
+    nrf_802154_energy_detected(result);
+#else
     swi_notify_energy_detected(result);
+#endif
 }
 
 void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
+#if NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED
+    nrf_802154_energy_detection_failed(error);
+#else
     swi_notify_energy_detection_failed(error);
+#endif
+}
+
+void nrf_802154_notify_energy_detection_sweep_done(uint32_t        channel_mask,
+                                                   const uint8_t * p_results)
+{
+#if NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED
+    nrf_802154_energy_detection_sweep_done(channel_mask, p_results);
+#else
+    swi_notify_energy_detection_sweep_done(channel_mask, p_results);
+#endif
 }
 
 void nrf_802154_notify_cca(bool is_free)
 {
+#if NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED
+    nrf_802154_cca_done(is_free);
+#else
     swi_notify_cca(is_free);
+#endif
 }
 
 void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error)
 {
+#if NRF_802154_NOTIFICATION_DIRECT_ED_CCA_ENABLED
+    nrf_802154_cca_failed(error);
+#else
     swi_notify_cca_failed(error);
+#endif
 }
 
-/**@brief Handles NTF_EVENT on NRF_802154_EGU_INSTANCE */
+#if NRF_802154_TSCH_ENABLED
+void nrf_802154_notify_tsch_cell_completed(uint16_t slot_offset, uint64_t asn)
+{
+    swi_notify_tsch_cell_completed(slot_offset, asn);
+}
+
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+void nrf_802154_notify_async_request_done(nrf_802154_async_request_t request, bool result)
+{
+    swi_notify_async_request_done(request, result);
+}
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
+#if NRF_802154_DECRYPTION_ENABLED
+/**@brief Verifies and decrypts a received frame before it is passed to the higher layer.
+ *
+ * This is done in the notification context instead of the RADIO interrupt, so that the AES
+ * operations do not delay the handling of the radio events. A frame with an invalid MIC is
+ * dropped and its buffer is freed.
+ *
+ * @param[inout]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[inout]  p_metadata  Pointer to the metadata of the received frame.
+ *
+ * @retval true   The frame is to be passed to the higher layer.
+ * @retval false  The frame was dropped.
+ */
+static bool received_frame_verify(uint8_t * p_data, nrf_802154_rx_metadata_t * p_metadata)
+{
+    if (nrf_802154_encrypt_rx_frame_verify(p_data, &p_metadata->decrypted))
+    {
+        return true;
+    }
+
+    nrf_802154_stat_counter_increment(rx_security_failures);
+    nrf_802154_buffer_free_raw(p_data);
+
+    return false;
+}
+
+#endif // NRF_802154_DECRYPTION_ENABLED
+
+#if NRF_802154_RX_BATCH_NOTIFY_ENABLED
+/**@brief Passes all frame reception notifications from the head of the queue in a single batch.
+ *
+ * Notifications are collected until the queue is empty or a notification of another type is
+ * found, so the order of notifications is preserved.
+ */
+static void rx_batch_notify(void)
+{
+    nrf_802154_queue_t * p_queue = &m_notifications_queues[NTF_CLASS_RX];
+    uint8_t              count   = 0;
+    uint8_t              available;
+
+    do
+    {
+        nrf_802154_ntf_data_t * p_slots =
+            (nrf_802154_ntf_data_t *)nrf_802154_queue_pop_batch_begin(p_queue,
+                                                                      &available);
+        uint8_t                 taken = 0;
+
+        while ((taken < available) &&
+               (count < NTF_RX_BATCH_SIZE) &&
+               (p_slots[taken].type == NTF_TYPE_RECEIVED))
+        {
+            m_rx_batch[count].p_data   = p_slots[taken].data.received.p_data;
+            m_rx_batch[count].metadata = p_slots[taken].data.received.metadata;
+            taken++;
+
+#if NRF_802154_DECRYPTION_ENABLED
+            if (!received_frame_verify(m_rx_batch[count].p_data, &m_rx_batch[count].metadata))
+            {
+                continue;
+            }
+#endif
+#if NRF_802154_LATENCY_STATS_ENABLED
+            nrf_802154_stat_latency_record(NRF_802154_STAT_LATENCY_RX_DELIVERY,
+                                           p_slots[taken - 1].data.received.start_time);
+#endif
+            count++;
+        }
+
+        // Frames are copied out, so all their slots are freed at once.
+        nrf_802154_queue_pop_batch_commit(p_queue, taken);
+
+        if (taken < available)
+        {
+            // Notification of another type found or the batch is full.
+            break;
+        }
+    }
+    while ((available > 0U) && (count < NTF_RX_BATCH_SIZE));
+
+#if NRF_802154_DECRYPTION_ENABLED
+    // All frames of the batch may have been dropped.
+    if (count == 0U)
+    {
+        return;
+    }
+#endif
+
+    nrf_802154_received_batch_raw(m_rx_batch, count);
+}
+
+#endif // NRF_802154_RX_BATCH_NOTIFY_ENABLED
+
+/**@brief Gets the notification queue of the highest priority class that is not empty.
+ *
+ * @returns  Pointer to the queue or NULL if all queues are empty.
+ */
+static nrf_802154_queue_t * ntf_queue_next_get(void)
+{
+    for (uint32_t i = 0; i < NTF_CLASS_COUNT; i++)
+    {
+        if (!nrf_802154_queue_is_empty(&m_notifications_queues[i]))
+        {
+            return &m_notifications_queues[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**@brief Handles NTF_EVENT on NRF_802154_EGU_INSTANCE
+ *
+ * If @ref NRF_802154_NOTIFICATION_THREAD_ENABLED is set, it is called from the thread of
+ * the higher layer instead.
+ *
+ * The queue of the highest priority class is checked again before each notification, so
+ * a notification of a higher class is passed before all pending notifications of lower classes.
+ */
 static void irq_handler_ntf_event(void)
 {
-    while (!nrf_802154_queue_is_empty(&m_notifications_queue))
+    nrf_802154_queue_t * p_queue;
+
+    while ((p_queue = ntf_queue_next_get()) != NULL)
     {
         nrf_802154_ntf_data_t * p_slot =
-            (nrf_802154_ntf_data_t *)nrf_802154_queue_pop_begin(&m_notifications_queue);
+            (nrf_802154_ntf_data_t *)nrf_802154_queue_pop_begin(p_queue);
 
         switch (p_slot->type)
         {
             case NTF_TYPE_RECEIVED:
+#if NRF_802154_RX_BATCH_NOTIFY_ENABLED
+                // Slots are consumed by the batch handler.
+                rx_batch_notify();
+                continue;
+#else
+#if NRF_802154_DECRYPTION_ENABLED
+                if (!received_frame_verify(p_slot->data.received.p_data,
+                                           &p_slot->data.received.metadata))
+                {
+                    break;
+                }
+#endif
+#if NRF_802154_LATENCY_STATS_ENABLED
+                nrf_802154_stat_latency_record(NRF_802154_STAT_LATENCY_RX_DELIVERY,
+                                               p_slot->data.received.start_time);
+#endif
 #if NRF_802154_USE_RAW_API
-                nrf_802154_received_raw(p_slot->data.received.p_data,
-                                        p_slot->data.received.power,
-                                        p_slot->data.received.lqi);
+                nrf_802154_received_metadata_raw(p_slot->data.received.p_data,
+                                                 &p_slot->data.received.metadata);
 #else // NRF_802154_USE_RAW_API
-                nrf_802154_received(p_slot->data.received.p_data + RAW_PAYLOAD_OFFSET,
-                                    p_slot->data.received.p_data[RAW_LENGTH_OFFSET],
-                                    p_slot->data.received.power,
-                                    p_slot->data.received.lqi);
+                nrf_802154_received_metadata(p_slot->data.received.p_data + RAW_PAYLOAD_OFFSET,
+                                             p_slot->data.received.p_data[RAW_LENGTH_OFFSET],
+                                             &p_slot->data.received.metadata);
 #endif
+#endif // NRF_802154_RX_BATCH_NOTIFY_ENABLED
                 break;
 
             case NTF_TYPE_RECEIVE_FAILED:
+#if NRF_802154_RECEIVE_FAILED_COALESCING_ENABLED
+                nrf_802154_receive_failed_coalesced(p_slot->data.receive_failed.error,
+                                                    p_slot->data.receive_failed.count);
+#else
                 nrf_802154_receive_failed(p_slot->data.receive_failed.error);
+#endif
                 break;
 
-            case NTF_TYPE_TRANSMITTED:
-            {
-#if NRF_802154_USE_RAW_API
-                nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
-                                           p_slot->data.transmitted.p_ack,
-                                           p_slot->data.transmitted.power,
-                                           p_slot->data.transmitted.lqi);
-#else // NRF_802154_USE_RAW_API
-                uint8_t * p_ack  = NULL;
-                uint8_t   length = 0;
+#if NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
+            case NTF_TYPE_DATA_REQUEST_RECEIVED:
+                nrf_802154_data_request_received(
+                    p_slot->data.data_request_received.src_addr,
+                    p_slot->data.data_request_received.src_addr_extended,
+                    &p_slot->data.data_request_received.metadata);
+                break;
+#endif // NRF_802154_DATA_REQUEST_NOTIFICATION_ENABLED
 
-                if (p_slot->data.transmitted.p_ack != NULL)
-                {
-                    p_ack  = p_slot->data.transmitted.p_ack + RAW_PAYLOAD_OFFSET;
-                    length = p_slot->data.transmitted.p_ack[RAW_LENGTH_OFFSET];
-                }
-                nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
-                                       p_ack,
-                                       length,
-                                       p_slot->data.transmitted.power,
-                                       p_slot->data.transmitted.lqi);
+            case NTF_TYPE_TRANSMITTED:
+#if NRF_802154_LATENCY_STATS_ENABLED
+                nrf_802154_stat_latency_record(NRF_802154_STAT_LATENCY_TX_COMPLETION,
+                                               p_slot->data.transmitted.start_time);
 #endif
-            }
-            break;
+                transmitted_notify(p_slot->data.transmitted.p_frame,
+                                   p_slot->data.transmitted.p_ack,
+                                   p_slot->data.transmitted.power,
+                                   p_slot->data.transmitted.lqi);
+                break;
 
             case NTF_TYPE_TRANSMIT_FAILED:
-#if NRF_802154_USE_RAW_API
-                nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
-                                           p_slot->data.transmit_failed.error);
-#else // NRF_802154_USE_RAW_API
-                nrf_802154_transmit_failed(
-                    p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
-                    p_slot->data.transmit_failed.error);
-#endif
+                transmit_failed_notify(p_slot->data.transmit_failed.p_frame,
+                                       p_slot->data.transmit_failed.error);
                 break;
 
             case NTF_TYPE_ENERGY_DETECTED:
@@ -441,6 +1091,12 @@ static void irq_handler_ntf_event(void)
                     p_slot->data.energy_detection_failed.error);
                 break;
 
+            case NTF_TYPE_ENERGY_SWEEP_DONE:
+                nrf_802154_energy_detection_sweep_done(
+                    p_slot->data.energy_sweep_done.channel_mask,
+                    p_slot->data.energy_sweep_done.p_results);
+                break;
+
             case NTF_TYPE_CCA:
                 nrf_802154_cca_done(p_slot->data.cca.result);
                 break;
@@ -449,14 +1105,43 @@ static void irq_handler_ntf_event(void)
                 nrf_802154_cca_failed(p_slot->data.cca_failed.error);
                 break;
 
+#if NRF_802154_TSCH_ENABLED
+            case NTF_TYPE_TSCH_CELL_COMPLETED:
+                nrf_802154_tsch_cell_completed(
+                    p_slot->data.tsch_cell_completed.slot_offset,
+                    ((uint64_t)p_slot->data.tsch_cell_completed.asn_hi << 32) |
+                    p_slot->data.tsch_cell_completed.asn_lo);
+                break;
+#endif // NRF_802154_TSCH_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+            case NTF_TYPE_ASYNC_REQUEST_DONE:
+                nrf_802154_async_request_done(p_slot->data.async_request_done.request,
+                                              p_slot->data.async_request_done.result);
+                break;
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
             default:
                 assert(false);
         }
 
-        nrf_802154_queue_pop_commit(&m_notifications_queue);
+        nrf_802154_queue_pop_commit(p_queue);
     }
 }
 
+#if NRF_802154_NOTIFICATION_THREAD_ENABLED
+void nrf_802154_notification_thread_process(void)
+{
+#if NRF_802154_NOTIFICATION_THREAD_WAKEUP_BATCHED
+    // Cleared before the queue is read, so a notification issued during processing is either
+    // passed now or wakes the thread up again.
+    m_thread_wakeup_pending = false;
+#endif
+
+    irq_handler_ntf_event();
+}
+
+#else // NRF_802154_NOTIFICATION_THREAD_ENABLED
 void nrf_802154_notification_swi_irq_handler(void)
 {
     if (nrf_egu_event_check(NRF_802154_EGU_INSTANCE, NTF_EVENT))
@@ -466,3 +1151,5 @@ void nrf_802154_notification_swi_irq_handler(void)
         irq_handler_ntf_event();
     }
 }
+
+#endif // NRF_802154_NOTIFICATION_THREAD_ENABLED
@@ -294,6 +294,30 @@ extern "C" {
 #define NRF_802154_PPI_TIMESTAMP_EVENT_TO_TIMER_CAPTURE NRF_PPI_CHANNEL14
 #endif
 
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+
+/**
+ * @def NRF_802154_PPI_RADIO_END_TO_TIMER_CAPTURE
+ *
+ * The PPI channel that connects RADIO_END event to HP timer's frame TIMER_CAPTURE task.
+ *
+ * @note This option is used only when the PPI frame timestamping is enabled
+ *       (see @ref NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED).
+ *
+ */
+#ifndef NRF_802154_PPI_RADIO_END_TO_TIMER_CAPTURE
+#define NRF_802154_PPI_RADIO_END_TO_TIMER_CAPTURE NRF_PPI_CHANNEL15
+#endif
+
+#define NRF_802154_FRAME_TIMESTAMP_PPI_CHANNELS_USED_MASK \
+    (1 << NRF_802154_PPI_RADIO_END_TO_TIMER_CAPTURE)
+
+#else // NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+
+#define NRF_802154_FRAME_TIMESTAMP_PPI_CHANNELS_USED_MASK 0
+
+#endif // NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+
 /**
  * @def NRF_802154_TIMESTAMP_PPI_CHANNELS_USED_MASK
  *
@@ -301,7 +325,8 @@ extern "C" {
  */
 #define NRF_802154_TIMESTAMP_PPI_CHANNELS_USED_MASK       \
     ((1 << NRF_802154_PPI_RTC_COMPARE_TO_TIMER_CAPTURE) | \
-     (1 << NRF_802154_PPI_TIMESTAMP_EVENT_TO_TIMER_CAPTURE))
+     (1 << NRF_802154_PPI_TIMESTAMP_EVENT_TO_TIMER_CAPTURE) | \
+     NRF_802154_FRAME_TIMESTAMP_PPI_CHANNELS_USED_MASK)
 
 #else // NRF_802154_FRAME_TIMESTAMP_ENABLED
 
@@ -158,6 +158,29 @@ extern "C" {
 #define NRF_802154_DPPI_RADIO_SYNC_TO_EGU_SYNC 8U
 #endif
 
+/**
+ * @def NRF_802154_DPPI_RADIO_END_TO_TIMER_CAPTURE
+ *
+ * The DPPI channel that connects RADIO_END event to HP timer's frame TIMER_CAPTURE task.
+ *
+ * @note This option is used only when the PPI frame timestamping is enabled
+ *       (see @ref NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED).
+ *
+ */
+#ifndef NRF_802154_DPPI_RADIO_END_TO_TIMER_CAPTURE
+#define NRF_802154_DPPI_RADIO_END_TO_TIMER_CAPTURE 9U
+#endif
+
+/**
+ * @def NRF_802154_DPPI_ABORT_GROUP
+ *
+ * The DPPI channel group used to break DPPI connections related with FEM, when the abort condition occurs.
+ *
+ */
+#ifndef NRF_802154_DPPI_ABORT_GROUP
+#define NRF_802154_DPPI_ABORT_GROUP NRF_DPPI_CHANNEL_GROUP1
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,17 +45,28 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_utils.h"
 #include "fal/nrf_802154_fal.h"
 
 #define CSMACA_BE_MAXIMUM 8 ///< The maximum allowed CSMA-CA backoff exponent (BE) that results from the implementation
 
+#define CHANNEL_MIN       11U                            ///< The lowest channel supported by the driver.
+#define CHANNEL_MAX       26U                            ///< The highest channel supported by the driver.
+#define CHANNELS_NUM      (CHANNEL_MAX - CHANNEL_MIN + 1U) ///< Number of channels supported by the driver.
+
 typedef struct
 {
     nrf_802154_coex_rx_request_mode_t rx_request_mode; ///< Coex request mode in receive operation.
     nrf_802154_coex_tx_request_mode_t tx_request_mode; ///< Coex request mode in transmit operation.
 } nrf_802154_pib_coex_t;
 
+typedef struct
+{
+    uint8_t pa_activation_delay_us;  ///< Delay of the PA activation relative to the FEM time gap.
+    uint8_t lna_activation_delay_us; ///< Delay of the LNA activation relative to the FEM time gap.
+} nrf_802154_pib_fem_t;
+
 #if NRF_802154_CSMA_CA_ENABLED
 typedef struct
 {
@@ -76,6 +87,29 @@ typedef struct
 
 #endif  // NRF_802154_IFS_ENABLED
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+#define LPL_PERIOD_DEFAULT_US 100000UL ///< Default time between low-power listening samples.
+#define LPL_SAMPLE_DEFAULT_US 128UL    ///< Default duration of a low-power listening sample.
+#define LPL_HOLD_DEFAULT_US   10000UL  ///< Default receiver hold time after energy detection.
+
+typedef struct
+{
+    uint32_t period_us; ///< Time between the starts of consecutive samples.
+    uint32_t sample_us; ///< Duration of the energy detection in each sample.
+    uint32_t hold_us;   ///< Time the receiver is kept on after the energy is detected.
+} nrf_802154_pib_lpl_t;
+
+#endif  // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
+#if NRF_802154_PAN_CONTEXTS > 1
+typedef struct
+{
+    nrf_802154_pan_context_t config;  ///< Configuration of the context.
+    volatile bool            enabled; ///< If the context is configured.
+} nrf_802154_pib_pan_context_t;
+
+#endif  // NRF_802154_PAN_CONTEXTS > 1
+
 typedef struct
 {
     int8_t                  tx_power;                             ///< Transmit power.
@@ -88,6 +122,10 @@ typedef struct
     bool                    pan_coord   : 1;                      ///< Indicating if radio is configured as the PAN coordinator.
     uint8_t                 channel     : 5;                      ///< Channel on which the node receives messages.
     nrf_802154_pib_coex_t   coex;                                 ///< Coex-related fields.
+    nrf_802154_pib_fem_t    fem;                                  ///< FEM timing fields.
+    uint32_t                post_tx_rx_window;                    ///< RX window after transmissions [us].
+    nrf_802154_post_tx_state_t post_tx_state;                     ///< State after transmissions.
+    uint8_t                 frame_type_filter;                    ///< Mask of accepted frame types.
 
 #if NRF_802154_CSMA_CA_ENABLED
     nrf_802154_pib_csmaca_t csmaca;                               ///< CSMA-CA related fields.
@@ -99,11 +137,34 @@ typedef struct
 
 #endif
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+    nrf_802154_pib_lpl_t lpl; ///< Low-power listening fields.
+
+#endif
+
+#if NRF_802154_PAN_CONTEXTS > 1
+    nrf_802154_pib_pan_context_t pan_contexts[NRF_802154_PAN_CONTEXTS - 1]; ///< Contexts 1 and up.
+
+#endif
+
 } nrf_802154_pib_data_t;
 
 // Static variables.
 static nrf_802154_pib_data_t m_data; ///< Buffer containing PIB data.
 
+/// Transmit power resulting from the PIB transmit power on a single channel.
+typedef struct
+{
+    nrf_radio_txpower_t radio_tx_power; ///< RADIO TX power value, including the FEM adjustment.
+    int8_t              fem_gain;       ///< Part of the PIB transmit power added by the FEM, in dB.
+} tx_power_entry_t;
+
+/// Transmit power on each channel. Updated when the PIB transmit power or the FEM configuration
+/// changes, so that the FEM is not queried when a transmission is prepared.
+static tx_power_entry_t    m_tx_power_table[CHANNELS_NUM];
+/// RADIO TX power value of the PIB transmit power with the FEM PA inactive.
+static nrf_radio_txpower_t m_tx_power_fem_bypass;
+
 /**
  * Converts TX power integer values to RADIO TX power allowed values.
  *
@@ -164,6 +225,35 @@ static nrf_radio_txpower_t to_radio_tx_power_convert(int8_t integer_tx_power)
     return radio_tx_power;
 }
 
+/**
+ * Converts transmit power in dBm to the RADIO TX power value used on the given channel.
+ *
+ * @param[in]  channel  Channel number (11-26).
+ * @param[in]  dbm      Requested transmit power in dBm.
+ *
+ * @retval     RADIO TX power allowed value.
+ */
+static nrf_radio_txpower_t tx_power_convert(uint8_t channel, int8_t dbm)
+{
+    int8_t tx_power = nrf_802154_fal_tx_power_get(channel, dbm);
+
+    return to_radio_tx_power_convert(tx_power);
+}
+
+/** Recomputes the RADIO TX power value and the FEM gain of the PIB transmit power. */
+static void tx_power_table_update(void)
+{
+    for (uint32_t i = 0; i < CHANNELS_NUM; i++)
+    {
+        int8_t radio_dbm = nrf_802154_fal_tx_power_get((uint8_t)(CHANNEL_MIN + i), m_data.tx_power);
+
+        m_tx_power_table[i].radio_tx_power = to_radio_tx_power_convert(radio_dbm);
+        m_tx_power_table[i].fem_gain       = (int8_t)(m_data.tx_power - radio_dbm);
+    }
+
+    m_tx_power_fem_bypass = to_radio_tx_power_convert(m_data.tx_power);
+}
+
 /**
  * @brief Checks if provided Coex transmit request mode is supported.
  *
@@ -229,6 +319,8 @@ void nrf_802154_pib_init(void)
     m_data.pan_coord   = false;
     m_data.channel     = 11;
 
+    m_data.frame_type_filter = NRF_802154_FRAME_TYPE_FILTER_ALL;
+
     memset(m_data.pan_id, 0xff, sizeof(m_data.pan_id));
     m_data.short_addr[0] = 0xfe;
     m_data.short_addr[1] = 0xff;
@@ -246,6 +338,12 @@ void nrf_802154_pib_init(void)
 #endif
     m_data.coex.tx_request_mode = NRF_802154_COEX_TX_REQUEST_MODE_FRAME_READY;
 
+    m_data.fem.pa_activation_delay_us  = NRF_802154_FEM_PA_ACTIVATION_DELAY_US;
+    m_data.fem.lna_activation_delay_us = NRF_802154_FEM_LNA_ACTIVATION_DELAY_US;
+
+    m_data.post_tx_state     = NRF_802154_POST_TX_STATE_RX;
+    m_data.post_tx_rx_window = 0;
+
 #if NRF_802154_CSMA_CA_ENABLED
     m_data.csmaca.min_be       = NRF_802154_CSMA_CA_MIN_BE_DEFAULT;
     m_data.csmaca.max_be       = NRF_802154_CSMA_CA_MAX_BE_DEFAULT;
@@ -257,8 +355,45 @@ void nrf_802154_pib_init(void)
     m_data.ifs.min_lifs_period_us = MIN_LIFS_PERIOD_US;
     m_data.ifs.mode               = NRF_802154_IFS_MODE_DISABLED;
 #endif // NRF_802154_IFS_ENABLED
+
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+    m_data.lpl.period_us = LPL_PERIOD_DEFAULT_US;
+    m_data.lpl.sample_us = LPL_SAMPLE_DEFAULT_US;
+    m_data.lpl.hold_us   = LPL_HOLD_DEFAULT_US;
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
+#if NRF_802154_PAN_CONTEXTS > 1
+    for (uint8_t i = 0; i < (NRF_802154_PAN_CONTEXTS - 1); i++)
+    {
+        m_data.pan_contexts[i].enabled = false;
+    }
+#endif // NRF_802154_PAN_CONTEXTS > 1
+
+    tx_power_table_update();
+}
+
+#if NRF_802154_WARM_START_ENABLED
+
+uint32_t nrf_802154_pib_snapshot_size_get(void)
+{
+    return sizeof(m_data);
+}
+
+void nrf_802154_pib_snapshot_save(uint8_t * p_buffer)
+{
+    memcpy(p_buffer, &m_data, sizeof(m_data));
 }
 
+void nrf_802154_pib_snapshot_restore(const uint8_t * p_buffer)
+{
+    memcpy(&m_data, p_buffer, sizeof(m_data));
+
+    tx_power_table_update();
+}
+
+#endif // NRF_802154_WARM_START_ENABLED
+
+#if NRF_802154_PROMISCUOUS_MODE == NRF_802154_MODE_RUNTIME
 bool nrf_802154_pib_promiscuous_get(void)
 {
     return m_data.promiscuous;
@@ -269,6 +404,17 @@ void nrf_802154_pib_promiscuous_set(bool enabled)
     m_data.promiscuous = enabled;
 }
 
+#else // NRF_802154_PROMISCUOUS_MODE == NRF_802154_MODE_RUNTIME
+void nrf_802154_pib_promiscuous_set(bool enabled)
+{
+    // The mode is fixed by NRF_802154_PROMISCUOUS_MODE.
+    assert(enabled == nrf_802154_pib_promiscuous_get());
+    (void)enabled;
+}
+
+#endif // NRF_802154_PROMISCUOUS_MODE == NRF_802154_MODE_RUNTIME
+
+#if NRF_802154_AUTO_ACK_MODE == NRF_802154_MODE_RUNTIME
 bool nrf_802154_pib_auto_ack_get(void)
 {
     return m_data.auto_ack;
@@ -279,6 +425,16 @@ void nrf_802154_pib_auto_ack_set(bool enabled)
     m_data.auto_ack = enabled;
 }
 
+#else // NRF_802154_AUTO_ACK_MODE == NRF_802154_MODE_RUNTIME
+void nrf_802154_pib_auto_ack_set(bool enabled)
+{
+    // The mode is fixed by NRF_802154_AUTO_ACK_MODE.
+    assert(enabled == nrf_802154_pib_auto_ack_get());
+    (void)enabled;
+}
+
+#endif // NRF_802154_AUTO_ACK_MODE == NRF_802154_MODE_RUNTIME
+
 bool nrf_802154_pib_pan_coord_get(void)
 {
     return m_data.pan_coord;
@@ -289,6 +445,16 @@ void nrf_802154_pib_pan_coord_set(bool enabled)
     m_data.pan_coord = enabled;
 }
 
+nrf_802154_frame_type_filter_t nrf_802154_pib_frame_type_filter_get(void)
+{
+    return m_data.frame_type_filter;
+}
+
+void nrf_802154_pib_frame_type_filter_set(nrf_802154_frame_type_filter_t mask)
+{
+    m_data.frame_type_filter = mask;
+}
+
 uint8_t nrf_802154_pib_channel_get(void)
 {
     return m_data.channel;
@@ -301,14 +467,64 @@ void nrf_802154_pib_channel_set(uint8_t channel)
 
 nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void)
 {
-    int8_t tx_power = nrf_802154_fal_tx_power_get(m_data.channel, m_data.tx_power);
+    return nrf_802154_pib_tx_power_on_channel_get(m_data.channel);
+}
+
+nrf_radio_txpower_t nrf_802154_pib_tx_power_on_channel_get(uint8_t channel)
+{
+    assert((channel >= CHANNEL_MIN) && (channel <= CHANNEL_MAX));
 
-    return to_radio_tx_power_convert(tx_power);
+    return m_tx_power_table[channel - CHANNEL_MIN].radio_tx_power;
+}
+
+nrf_radio_txpower_t nrf_802154_pib_tx_power_reduced_get(uint8_t channel, uint8_t reduction)
+{
+    assert((channel >= CHANNEL_MIN) && (channel <= CHANNEL_MAX));
+
+    const tx_power_entry_t * p_entry = &m_tx_power_table[channel - CHANNEL_MIN];
+
+    // The FEM keeps its gain at the PIB transmit power, so the radio delivers the reduction.
+    int32_t radio_dbm = (int32_t)m_data.tx_power - p_entry->fem_gain - reduction;
+
+    // The conversion selects the lowest power supported if the result is below it.
+    if (radio_dbm < INT8_MIN)
+    {
+        radio_dbm = INT8_MIN;
+    }
+
+    return to_radio_tx_power_convert((int8_t)radio_dbm);
+}
+
+int8_t nrf_802154_pib_tx_power_dbm_get(void)
+{
+    return m_data.tx_power;
+}
+
+nrf_radio_txpower_t nrf_802154_pib_tx_power_convert(uint8_t channel, int8_t dbm)
+{
+    return tx_power_convert(channel, dbm);
+}
+
+nrf_radio_txpower_t nrf_802154_pib_tx_power_fem_bypass_convert(int8_t dbm)
+{
+    return to_radio_tx_power_convert(dbm);
+}
+
+nrf_radio_txpower_t nrf_802154_pib_tx_power_fem_bypass_get(void)
+{
+    return m_tx_power_fem_bypass;
 }
 
 void nrf_802154_pib_tx_power_set(int8_t dbm)
 {
     m_data.tx_power = dbm;
+
+    tx_power_table_update();
+}
+
+void nrf_802154_pib_tx_power_refresh(void)
+{
+    tx_power_table_update();
 }
 
 const uint8_t * nrf_802154_pib_pan_id_get(void)
@@ -341,6 +557,48 @@ void nrf_802154_pib_short_address_set(const uint8_t * p_short_address)
     memcpy(m_data.short_addr, p_short_address, SHORT_ADDRESS_SIZE);
 }
 
+#if NRF_802154_PAN_CONTEXTS > 1
+
+bool nrf_802154_pib_pan_context_set(uint8_t id, const nrf_802154_pan_context_t * p_context)
+{
+    if ((id == 0) || (id >= NRF_802154_PAN_CONTEXTS))
+    {
+        return false;
+    }
+
+    nrf_802154_pib_pan_context_t * p_entry = &m_data.pan_contexts[id - 1];
+
+    // The context is disabled for the time of the update, so that the receive filter never
+    // matches a frame against an incomplete configuration.
+    p_entry->enabled = false;
+    __DMB();
+    p_entry->config = *p_context;
+    __DMB();
+    p_entry->enabled = true;
+
+    return true;
+}
+
+void nrf_802154_pib_pan_context_clear(uint8_t id)
+{
+    if ((id > 0) && (id < NRF_802154_PAN_CONTEXTS))
+    {
+        m_data.pan_contexts[id - 1].enabled = false;
+    }
+}
+
+const nrf_802154_pan_context_t * nrf_802154_pib_pan_context_get(uint8_t id)
+{
+    if ((id == 0) || (id >= NRF_802154_PAN_CONTEXTS) || !m_data.pan_contexts[id - 1].enabled)
+    {
+        return NULL;
+    }
+
+    return &m_data.pan_contexts[id - 1].config;
+}
+
+#endif // NRF_802154_PAN_CONTEXTS > 1
+
 void nrf_802154_pib_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
 {
     switch (p_cca_cfg->mode)
@@ -405,6 +663,61 @@ nrf_802154_coex_tx_request_mode_t nrf_802154_pib_coex_tx_request_mode_get(void)
     return m_data.coex.tx_request_mode;
 }
 
+bool nrf_802154_pib_fem_activation_delay_set(uint8_t pa_delay_us, uint8_t lna_delay_us)
+{
+    if ((pa_delay_us >= TX_RAMP_UP_TIME) || (lna_delay_us >= RX_RAMP_UP_TIME))
+    {
+        return false;
+    }
+
+    m_data.fem.pa_activation_delay_us  = pa_delay_us;
+    m_data.fem.lna_activation_delay_us = lna_delay_us;
+
+    return true;
+}
+
+uint8_t nrf_802154_pib_fem_pa_activation_delay_get(void)
+{
+    return m_data.fem.pa_activation_delay_us;
+}
+
+uint8_t nrf_802154_pib_fem_lna_activation_delay_get(void)
+{
+    return m_data.fem.lna_activation_delay_us;
+}
+
+bool nrf_802154_pib_post_tx_state_set(nrf_802154_post_tx_state_t state, uint32_t rx_window_us)
+{
+    switch (state)
+    {
+        case NRF_802154_POST_TX_STATE_RX_WINDOW:
+            if (rx_window_us == 0U)
+            {
+                return false;
+            }
+
+        // Fallthrough
+        case NRF_802154_POST_TX_STATE_RX:
+        case NRF_802154_POST_TX_STATE_SLEEP:
+            m_data.post_tx_state     = state;
+            m_data.post_tx_rx_window = rx_window_us;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+nrf_802154_post_tx_state_t nrf_802154_pib_post_tx_state_get(void)
+{
+    return m_data.post_tx_state;
+}
+
+uint32_t nrf_802154_pib_post_tx_rx_window_get(void)
+{
+    return m_data.post_tx_rx_window;
+}
+
 #if NRF_802154_CSMA_CA_ENABLED
 bool nrf_802154_pib_csmaca_min_be_set(uint8_t min_be)
 {
@@ -496,3 +809,36 @@ void nrf_802154_pib_ifs_min_lifs_period_set(uint16_t period)
 }
 
 #endif // NRF_802154_IFS_ENABLED
+
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+
+bool nrf_802154_pib_lpl_cfg_set(uint32_t period_us, uint32_t sample_us, uint32_t hold_us)
+{
+    if ((sample_us >= period_us) || (hold_us == 0U))
+    {
+        return false;
+    }
+
+    m_data.lpl.period_us = period_us;
+    m_data.lpl.sample_us = sample_us;
+    m_data.lpl.hold_us   = hold_us;
+
+    return true;
+}
+
+uint32_t nrf_802154_pib_lpl_period_get(void)
+{
+    return m_data.lpl.period_us;
+}
+
+uint32_t nrf_802154_pib_lpl_sample_time_get(void)
+{
+    return m_data.lpl.sample_us;
+}
+
+uint32_t nrf_802154_pib_lpl_hold_time_get(void)
+{
+    return m_data.lpl.hold_us;
+}
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
@@ -51,14 +51,48 @@ extern "C" {
  */
 void nrf_802154_pib_init(void);
 
+#if NRF_802154_WARM_START_ENABLED
+
+/**
+ * @brief Gets the size of the snapshot of the PIB.
+ *
+ * @returns  Size of the snapshot in bytes.
+ */
+uint32_t nrf_802154_pib_snapshot_size_get(void);
+
+/**
+ * @brief Stores the PIB in a snapshot.
+ *
+ * @param[out] p_buffer  Buffer for the snapshot of @ref nrf_802154_pib_snapshot_size_get bytes.
+ */
+void nrf_802154_pib_snapshot_save(uint8_t * p_buffer);
+
+/**
+ * @brief Restores the PIB from a snapshot created by @ref nrf_802154_pib_snapshot_save.
+ *
+ * @param[in]  p_buffer  Snapshot of @ref nrf_802154_pib_snapshot_size_get bytes.
+ */
+void nrf_802154_pib_snapshot_restore(const uint8_t * p_buffer);
+
+#endif // NRF_802154_WARM_START_ENABLED
+
 /**
  * @brief Checks if the promiscuous mode is enabled.
  *
  * @retval  true   The promiscuous mode is enabled.
  * @retval  false  The promiscuous mode is disabled.
  */
+#if NRF_802154_PROMISCUOUS_MODE == NRF_802154_MODE_RUNTIME
 bool nrf_802154_pib_promiscuous_get(void);
 
+#else
+static inline bool nrf_802154_pib_promiscuous_get(void)
+{
+    return NRF_802154_PROMISCUOUS_MODE == NRF_802154_MODE_FIXED_ON;
+}
+
+#endif
+
 /**
  * @brief Enables or disables the promiscuous mode.
  *
@@ -72,8 +106,17 @@ void nrf_802154_pib_promiscuous_set(bool enabled);
  * @retval  true   The auto ACK procedure is enabled.
  * @retval  false  The auto ACK procedure is disabled.
  */
+#if NRF_802154_AUTO_ACK_MODE == NRF_802154_MODE_RUNTIME
 bool nrf_802154_pib_auto_ack_get(void);
 
+#else
+static inline bool nrf_802154_pib_auto_ack_get(void)
+{
+    return NRF_802154_AUTO_ACK_MODE == NRF_802154_MODE_FIXED_ON;
+}
+
+#endif
+
 /**
  * @brief Enables or disables the auto ACK procedure.
  *
@@ -96,6 +139,20 @@ bool nrf_802154_pib_pan_coord_get(void);
  */
 void nrf_802154_pib_pan_coord_set(bool enabled);
 
+/**
+ * @brief Gets the mask of frame types accepted by the receive filter.
+ *
+ * @returns  Mask of accepted frame types.
+ */
+nrf_802154_frame_type_filter_t nrf_802154_pib_frame_type_filter_get(void);
+
+/**
+ * @brief Sets the mask of frame types accepted by the receive filter.
+ *
+ * @param[in]  mask  Mask of accepted frame types.
+ */
+void nrf_802154_pib_frame_type_filter_set(nrf_802154_frame_type_filter_t mask);
+
 /**
  * @brief Gets the currently used channel.
  *
@@ -117,6 +174,74 @@ void nrf_802154_pib_channel_set(uint8_t channel);
  */
 nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void);
 
+/**
+ * @brief Gets the transmit power set with @ref nrf_802154_pib_tx_power_set.
+ *
+ * @returns  Requested transmit power in dBm, not adjusted to the front-end and the radio
+ *           capabilities.
+ */
+int8_t nrf_802154_pib_tx_power_dbm_get(void);
+
+/**
+ * @brief Gets the transmit power to use for the given requested power on the given channel.
+ *
+ * @param[in]  channel  Channel number (11-26).
+ * @param[in]  dbm      Requested transmit power in dBm.
+ *
+ * @returns  Transmit power in dBm, adjusted to the front-end and the radio capabilities.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_convert(uint8_t channel, int8_t dbm);
+
+/**
+ * @brief Gets the transmit power used on the given channel.
+ *
+ * The value is taken from a table precomputed for all channels, so it does not query the FEM.
+ *
+ * @param[in]  channel  Channel number (11-26).
+ *
+ * @returns  Transmit power in dBm, adjusted to the front-end and the radio capabilities.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_on_channel_get(uint8_t channel);
+
+/**
+ * @brief Gets the transmit power used on the given channel, lowered by the given reduction.
+ *
+ * The FEM gain is taken from the table precomputed for the PIB transmit power, so the FEM is not
+ * queried and the whole reduction is applied to the radio.
+ *
+ * @param[in]  channel    Channel number (11-26).
+ * @param[in]  reduction  Reduction of the PIB transmit power in dB.
+ *
+ * @returns  Transmit power adjusted to the radio capabilities.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_reduced_get(uint8_t channel, uint8_t reduction);
+
+/**
+ * @brief Converts the given transmit power to the RADIO value used with the FEM PA inactive.
+ *
+ * @param[in]  dbm  Transmit power in dBm.
+ *
+ * @returns  Transmit power adjusted to the radio capabilities only.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_fem_bypass_convert(int8_t dbm);
+
+/**
+ * @brief Gets the RADIO value of the PIB transmit power used with the FEM PA inactive.
+ *
+ * The value is precomputed when the PIB transmit power is set.
+ *
+ * @returns  PIB transmit power adjusted to the radio capabilities only.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_fem_bypass_get(void);
+
+/**
+ * @brief Recomputes the transmit power used on each channel.
+ *
+ * This function is to be called when the FEM configuration that affects the transmit power
+ * changes.
+ */
+void nrf_802154_pib_tx_power_refresh(void);
+
 /**
  * @brief Sets the transmit power used for ACK frames.
  *
@@ -172,6 +297,40 @@ const uint8_t * nrf_802154_pib_short_address_get(void);
  */
 void nrf_802154_pib_short_address_set(const uint8_t * p_short_address);
 
+#if NRF_802154_PAN_CONTEXTS > 1
+
+/**
+ * @brief Configures an additional PAN context.
+ *
+ * This function makes a copy of the configuration.
+ *
+ * @param[in]  id         Identifier of the context (1 to @ref NRF_802154_PAN_CONTEXTS - 1).
+ * @param[in]  p_context  Pointer to the configuration of the context.
+ *
+ * @retval  true   The context is configured.
+ * @retval  false  @p id is out of range.
+ */
+bool nrf_802154_pib_pan_context_set(uint8_t id, const nrf_802154_pan_context_t * p_context);
+
+/**
+ * @brief Removes the configuration of an additional PAN context.
+ *
+ * @param[in]  id  Identifier of the context (1 to @ref NRF_802154_PAN_CONTEXTS - 1).
+ */
+void nrf_802154_pib_pan_context_clear(uint8_t id);
+
+/**
+ * @brief Gets the configuration of an additional PAN context.
+ *
+ * @param[in]  id  Identifier of the context.
+ *
+ * @returns  Pointer to the configuration of the context, or NULL if @p id does not identify
+ *           a configured additional context.
+ */
+const nrf_802154_pan_context_t * nrf_802154_pib_pan_context_get(uint8_t id);
+
+#endif // NRF_802154_PAN_CONTEXTS > 1
+
 /**
  * @brief Sets the radio CCA mode and threshold.
  *
@@ -221,6 +380,57 @@ bool nrf_802154_pib_coex_tx_request_mode_set(nrf_802154_coex_tx_request_mode_t m
  */
 nrf_802154_coex_tx_request_mode_t nrf_802154_pib_coex_tx_request_mode_get(void);
 
+/**
+ * @brief Sets the delays of the FEM activation relative to the time gaps configured in the FEM.
+ *
+ * @param[in]  pa_delay_us   Delay of the PA activation in microseconds.
+ * @param[in]  lna_delay_us  Delay of the LNA activation in microseconds.
+ *
+ * @retval true   The delays were set.
+ * @retval false  A delay is not lower than the corresponding radio ramp-up time.
+ */
+bool nrf_802154_pib_fem_activation_delay_set(uint8_t pa_delay_us, uint8_t lna_delay_us);
+
+/**
+ * @brief Gets the delay of the PA activation relative to the time gap configured in the FEM.
+ *
+ * @return Delay of the PA activation in microseconds.
+ */
+uint8_t nrf_802154_pib_fem_pa_activation_delay_get(void);
+
+/**
+ * @brief Gets the delay of the LNA activation relative to the time gap configured in the FEM.
+ *
+ * @return Delay of the LNA activation in microseconds.
+ */
+uint8_t nrf_802154_pib_fem_lna_activation_delay_get(void);
+
+/**
+ * @brief Sets the state entered after successful transmissions.
+ *
+ * @param[in]  state         State to enter after successful transmissions.
+ * @param[in]  rx_window_us  Duration of the receive window for
+ *                           @ref NRF_802154_POST_TX_STATE_RX_WINDOW.
+ *
+ * @retval true   The state was set.
+ * @retval false  The state is not supported or the window duration is 0.
+ */
+bool nrf_802154_pib_post_tx_state_set(nrf_802154_post_tx_state_t state, uint32_t rx_window_us);
+
+/**
+ * @brief Gets the state entered after successful transmissions.
+ *
+ * @return State entered after successful transmissions.
+ */
+nrf_802154_post_tx_state_t nrf_802154_pib_post_tx_state_get(void);
+
+/**
+ * @brief Gets the duration of the receive window following successful transmissions.
+ *
+ * @return Duration of the receive window in microseconds.
+ */
+uint32_t nrf_802154_pib_post_tx_rx_window_get(void);
+
 #if NRF_802154_CSMA_CA_ENABLED
 /**
  * @brief Sets the minimum value of the backoff exponent (BE) in the CSMA-CA algorithm.
@@ -322,6 +532,41 @@ uint16_t nrf_802154_pib_ifs_min_lifs_period_get(void);
 void nrf_802154_pib_ifs_min_lifs_period_set(uint16_t period);
 #endif // NRF_802154_IFS_ENABLED
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+/**
+ * @brief Sets the low-power listening configuration.
+ *
+ * @param[in] period_us  Time between the starts of consecutive samples in microseconds.
+ * @param[in] sample_us  Duration of the energy detection in each sample in microseconds.
+ * @param[in] hold_us    Time the receiver is kept on after the energy is detected in microseconds.
+ *
+ * @retval    true  The update of PIB was successful.
+ * @retval    false The sample is not shorter than the period or the hold time is 0.
+ */
+bool nrf_802154_pib_lpl_cfg_set(uint32_t period_us, uint32_t sample_us, uint32_t hold_us);
+
+/**
+ * @brief Gets the time between low-power listening samples.
+ *
+ * @return Time between the starts of consecutive samples in microseconds.
+ */
+uint32_t nrf_802154_pib_lpl_period_get(void);
+
+/**
+ * @brief Gets the duration of a low-power listening sample.
+ *
+ * @return Duration of the energy detection in each sample in microseconds.
+ */
+uint32_t nrf_802154_pib_lpl_sample_time_get(void);
+
+/**
+ * @brief Gets the time the receiver is kept on after energy is detected in low-power listening.
+ *
+ * @return Hold time in microseconds.
+ */
+uint32_t nrf_802154_pib_lpl_hold_time_get(void);
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
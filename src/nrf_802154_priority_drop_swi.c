@@ -46,10 +46,91 @@
 #include "hal/nrf_egu.h"
 #include "platform/clock/nrf_802154_clock.h"
 
+#if NRF_802154_HFCLK_STOP_HYSTERESIS_US > 0
+#include <stddef.h>
+
+#include "mac_features/nrf_802154_delayed_trx.h"
+#include "timer/nrf_802154_timer_sched.h"
+#endif
+
 #define HFCLK_STOP_INT   NRF_EGU_INT_TRIGGERED1   ///< Label of HFClk stop interrupt.
 #define HFCLK_STOP_TASK  NRF_EGU_TASK_TRIGGER1    ///< Label of HFClk stop task.
 #define HFCLK_STOP_EVENT NRF_EGU_EVENT_TRIGGERED1 ///< Label of HFClk stop event.
 
+#if NRF_802154_HFCLK_STOP_HYSTERESIS_US > 0
+
+#define IDLE_GAP_AVG_SHIFT 2 ///< Weight of a new idle gap in the average, as a power of 2 divisor.
+
+static nrf_802154_timer_t m_hfclk_stop_timer;   ///< Timer deferring the HFClk stop.
+static volatile bool      m_hfclk_stop_elapsed; ///< If the HFClk stop deferral has elapsed.
+static volatile bool      m_hfclk_stop_pending; ///< If the HFClk stop is deferred.
+static uint32_t           m_hfclk_idle_time;    ///< Time at which the HFClk was released.
+static uint32_t           m_idle_gap_avg;       ///< Average time to the next HFClk request.
+
+/**
+ * @brief Notifies that the HFClk stop deferral has elapsed.
+ *
+ * The HFClk is stopped from the SWI priority level.
+ *
+ * @param[in]  p_context  Not used.
+ */
+static void hfclk_stop_timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    m_hfclk_stop_elapsed = true;
+
+    nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, HFCLK_STOP_TASK);
+}
+
+/**
+ * @brief Updates the average idle gap with a new sample.
+ *
+ * @param[in]  gap  Time after which the HFClk was requested again, in microseconds.
+ */
+static void idle_gap_update(uint32_t gap)
+{
+    m_idle_gap_avg = m_idle_gap_avg - (m_idle_gap_avg >> IDLE_GAP_AVG_SHIFT) +
+                     (gap >> IDLE_GAP_AVG_SHIFT);
+}
+
+/**
+ * @brief Gets the time for which the HFClk stop is to be deferred.
+ *
+ * @param[in]  now  Current time in microseconds.
+ *
+ * @returns  Deferral time in microseconds.
+ */
+static uint32_t hfclk_stop_delay_get(uint32_t now)
+{
+    uint32_t delay = NRF_802154_HFCLK_STOP_HYSTERESIS_US;
+
+#if NRF_802154_HFCLK_STOP_PREDICTION_MAX_US > 0
+    uint32_t predicted = m_idle_gap_avg;
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+    uint32_t op_time;
+
+    if (nrf_802154_delayed_trx_nearest_op_time_get(&op_time) &&
+        ((int32_t)(op_time - now) > 0) && ((op_time - now) < predicted))
+    {
+        predicted = op_time - now;
+    }
+#endif
+
+    if ((predicted > delay) && (predicted <= NRF_802154_HFCLK_STOP_PREDICTION_MAX_US))
+    {
+        delay = predicted;
+    }
+#else
+    (void)now;
+#endif
+
+    return delay;
+}
+
+#endif // NRF_802154_HFCLK_STOP_HYSTERESIS_US > 0
+
 /**
  * @brief Requests a stop of the HF clock.
  *
@@ -74,6 +155,23 @@ static void swi_hfclk_stop(void)
 static void swi_hfclk_stop_terminate(void)
 {
     nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, HFCLK_STOP_EVENT);
+
+#if NRF_802154_HFCLK_STOP_HYSTERESIS_US > 0
+    bool was_running;
+
+    nrf_802154_timer_sched_remove(&m_hfclk_stop_timer, &was_running);
+
+    if (was_running)
+    {
+        idle_gap_update(nrf_802154_timer_sched_time_get() - m_hfclk_idle_time);
+    }
+
+    m_hfclk_stop_pending = false;
+    m_hfclk_stop_elapsed = false;
+
+    // The timer might have fired just before it was removed.
+    nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, HFCLK_STOP_EVENT);
+#endif
 }
 
 void nrf_802154_rsch_prio_drop_init(void)
@@ -97,8 +195,41 @@ void nrf_802154_rsch_prio_drop_swi_irq_handler(void)
 {
     if (nrf_egu_event_check(NRF_802154_EGU_INSTANCE, HFCLK_STOP_EVENT))
     {
+#if NRF_802154_HFCLK_STOP_HYSTERESIS_US > 0
+        nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, HFCLK_STOP_EVENT);
+
+        if (m_hfclk_stop_elapsed)
+        {
+            m_hfclk_stop_elapsed = false;
+            m_hfclk_stop_pending = false;
+
+            // The HFClk was not requested again within the longest deferral.
+            idle_gap_update(NRF_802154_HFCLK_STOP_PREDICTION_MAX_US);
+
+            nrf_802154_clock_hfclk_stop();
+        }
+        else if (!m_hfclk_stop_pending)
+        {
+            uint32_t now = nrf_802154_timer_sched_time_get();
+
+            m_hfclk_stop_pending = true;
+            m_hfclk_idle_time    = now;
+
+            m_hfclk_stop_timer.t0        = now;
+            m_hfclk_stop_timer.dt        = hfclk_stop_delay_get(now);
+            m_hfclk_stop_timer.callback  = hfclk_stop_timer_fired;
+            m_hfclk_stop_timer.p_context = NULL;
+
+            nrf_802154_timer_sched_add(&m_hfclk_stop_timer, true);
+        }
+        else
+        {
+            // Intentionally empty: the HFClk stop is already deferred.
+        }
+#else
         nrf_802154_clock_hfclk_stop();
 
         nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, HFCLK_STOP_EVENT);
+#endif
     }
 }
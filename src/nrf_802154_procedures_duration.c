@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the tables of durations of the 802.15.4 radio driver procedures.
+ *
+ * The tables are generated at compile time from the same macros the durations are computed with,
+ * so a duration query is a single load.
+ *
+ */
+
+#include "nrf_802154_procedures_duration.h"
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+
+#if NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED
+
+#if MAX_PACKET_SIZE != 127
+#error The duration tables are generated for PSDU lengths 0-127.
+#endif
+
+/// Row of @ref nrf_802154_tx_duration_table for the given PSDU length.
+#define TX_ROW(len)                                                         \
+    {                                                                       \
+        { TX_DURATION_US(len, 0, 0), TX_DURATION_US(len, 0, 1) },           \
+        { TX_DURATION_US(len, 1, 0), TX_DURATION_US(len, 1, 1) }            \
+    }
+
+/// Row of @ref nrf_802154_rx_duration_table for the given PSDU length.
+#define RX_ROW(len) { RX_DURATION_US(len, 0), RX_DURATION_US(len, 1) }
+
+/// Rows for 8 consecutive PSDU lengths starting with @p base.
+#define ROWS_8(row, base)                                                   \
+    row((base) + 0), row((base) + 1), row((base) + 2), row((base) + 3),     \
+    row((base) + 4), row((base) + 5), row((base) + 6), row((base) + 7)
+
+/// Rows for all PSDU lengths.
+#define ROWS_128(row)                                                       \
+    ROWS_8(row, 0), ROWS_8(row, 8), ROWS_8(row, 16), ROWS_8(row, 24),       \
+    ROWS_8(row, 32), ROWS_8(row, 40), ROWS_8(row, 48), ROWS_8(row, 56),     \
+    ROWS_8(row, 64), ROWS_8(row, 72), ROWS_8(row, 80), ROWS_8(row, 88),     \
+    ROWS_8(row, 96), ROWS_8(row, 104), ROWS_8(row, 112), ROWS_8(row, 120)
+
+const uint16_t nrf_802154_tx_duration_table[MAX_PACKET_SIZE + 1][2][2] = { ROWS_128(TX_ROW) };
+
+const uint16_t nrf_802154_rx_duration_table[MAX_PACKET_SIZE + 1][2] = { ROWS_128(RX_ROW) };
+
+#endif // NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED
@@ -41,6 +41,7 @@
 #include <stdint.h>
 #include "nrf.h"
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
 #define TX_RAMP_UP_TIME                   40 // us
@@ -69,6 +70,39 @@
     PHY_US_TIME_FROM_SYMBOLS( \
         PHY_SHR_SYMBOLS + PHY_SYMBOLS_FROM_OCTETS(PHR_SIZE + MAX_PACKET_SIZE))
 
+/**@brief Duration (in microseconds) of a frame with SHR and PHR, as a constant expression. */
+#define FRAME_DURATION_US(psdu_length) \
+    PHY_US_TIME_FROM_SYMBOLS(PHY_SHR_SYMBOLS + PHY_SYMBOLS_FROM_OCTETS(PHR_SIZE + (psdu_length)))
+
+/**@brief Duration (in microseconds) of a transmission, as a constant expression.
+ *
+ * See @ref nrf_802154_tx_duration_get.
+ */
+#define TX_DURATION_US(psdu_length, cca, ack_requested)                             \
+    (MAX_RAMP_DOWN_TIME + TX_RAMP_UP_TIME + FRAME_DURATION_US(psdu_length) +        \
+     ((ack_requested) ? PHY_US_TIME_FROM_SYMBOLS(MAC_IMM_ACK_WAIT_SYMBOLS) : 0) +   \
+     ((cca) ? (RX_RAMP_UP_TIME + RX_RAMP_DOWN_TIME +                                \
+               PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS)) : 0))
+
+/**@brief Duration (in microseconds) of a reception, as a constant expression.
+ *
+ * See @ref nrf_802154_rx_duration_get.
+ */
+#define RX_DURATION_US(psdu_length, ack_requested)                                  \
+    (FRAME_DURATION_US(psdu_length) +                                               \
+     ((ack_requested) ?                                                             \
+      PHY_US_TIME_FROM_SYMBOLS(A_TURNAROUND_TIME_SYMBOLS + IMM_ACK_SYMBOLS) : 0))
+
+#if NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED
+
+/**@brief Durations of transmissions, indexed by PSDU length, CCA and ACK request. */
+extern const uint16_t nrf_802154_tx_duration_table[MAX_PACKET_SIZE + 1][2][2];
+
+/**@brief Durations of receptions, indexed by PSDU length and ACK request. */
+extern const uint16_t nrf_802154_rx_duration_table[MAX_PACKET_SIZE + 1][2];
+
+#endif
+
 __STATIC_INLINE uint16_t nrf_802154_tx_duration_get(uint8_t psdu_length,
                                                     bool    cca,
                                                     bool    ack_requested);
@@ -108,23 +142,14 @@ __STATIC_INLINE uint16_t nrf_802154_tx_duration_get(uint8_t psdu_length,
     // if CCA: + RX ramp up + CCA + RX ramp down
     // + TX ramp up + SHR + PHR + PSDU
     // if ACK: + macAckWaitDuration
-    uint16_t us_time = MAX_RAMP_DOWN_TIME + TX_RAMP_UP_TIME + nrf_802154_frame_duration_get(
-        psdu_length,
-        true,
-        true);
-
-    if (ack_requested)
+#if NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED
+    if (psdu_length <= MAX_PACKET_SIZE)
     {
-        us_time += PHY_US_TIME_FROM_SYMBOLS(MAC_IMM_ACK_WAIT_SYMBOLS);
+        return nrf_802154_tx_duration_table[psdu_length][cca][ack_requested];
     }
+#endif
 
-    if (cca)
-    {
-        us_time += RX_RAMP_UP_TIME + RX_RAMP_DOWN_TIME + PHY_US_TIME_FROM_SYMBOLS(
-            A_CCA_DURATION_SYMBOLS);
-    }
-
-    return us_time;
+    return (uint16_t)TX_DURATION_US(psdu_length, cca, ack_requested);
 }
 
 __STATIC_INLINE uint16_t nrf_802154_cca_before_tx_duration_get(void)
@@ -139,16 +164,14 @@ __STATIC_INLINE uint16_t nrf_802154_rx_duration_get(uint8_t psdu_length, bool ac
 {
     // SHR + PHR + PSDU
     // if ACK: + aTurnaroundTime + ACK frame duration
-    uint16_t us_time = nrf_802154_frame_duration_get(psdu_length, true, true);
-
-    if (ack_requested)
+#if NRF_802154_PROCEDURES_DURATION_TABLES_ENABLED
+    if (psdu_length <= MAX_PACKET_SIZE)
     {
-        us_time += PHY_US_TIME_FROM_SYMBOLS(A_TURNAROUND_TIME_SYMBOLS +
-                                            PHY_SHR_SYMBOLS +
-                                            PHY_SYMBOLS_FROM_OCTETS(IMM_ACK_LENGTH + PHR_SIZE));
+        return nrf_802154_rx_duration_table[psdu_length][ack_requested];
     }
+#endif
 
-    return us_time;
+    return (uint16_t)RX_DURATION_US(psdu_length, ack_requested);
 }
 
 __STATIC_INLINE uint16_t nrf_802154_cca_duration_get(void)
@@ -37,6 +37,12 @@
 
 #include "nrf_802154_queue.h"
 
+#include "nrf_802154_utils.h"
+#if NRF_802154_QUEUE_STATS_ENABLED
+#include "nrf_802154_stats.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#endif
+
 static inline uint8_t increment_modulo(uint8_t v, uint8_t wrap_at_value)
 {
     v++;
@@ -54,6 +60,61 @@ static inline void * idx2ptr(const nrf_802154_queue_t * p_queue, size_t idx)
     return ((uint8_t *)(p_queue->p_memory)) + idx * p_queue->item_size;
 }
 
+#if NRF_802154_QUEUE_STATS_ENABLED
+
+/** Get number of items stored in the queue. */
+static inline uint8_t items_count_get(const nrf_802154_queue_t * p_queue)
+{
+    uint8_t rdidx = p_queue->rdidx;
+    uint8_t wridx = p_queue->wridx;
+
+    return (wridx >= rdidx) ? (wridx - rdidx) : (p_queue->capacity - rdidx + wridx);
+}
+
+/** Update statistics when the item at the write index is committed. */
+static void stats_push_update(const nrf_802154_queue_t * p_queue)
+{
+    uint8_t count;
+
+    if (p_queue->p_stats == NULL)
+    {
+        return;
+    }
+
+    p_queue->p_push_times[p_queue->wridx] = nrf_802154_hp_timer_current_time_get();
+
+    // The item being committed is counted too.
+    count = items_count_get(p_queue) + 1U;
+
+    if (count > p_queue->p_stats->high_watermark)
+    {
+        p_queue->p_stats->high_watermark = count;
+    }
+
+    // One slot is always lost, so the queue is full with capacity - 1 items.
+    if ((count + 2U) >= p_queue->capacity)
+    {
+        p_queue->p_stats->near_full_pushes++;
+    }
+}
+
+/** Update statistics when the item at the given index is read. */
+static void stats_pop_update(const nrf_802154_queue_t * p_queue, uint8_t idx)
+{
+    uint32_t latency;
+
+    if (p_queue->p_stats == NULL)
+    {
+        return;
+    }
+
+    latency = nrf_802154_hp_timer_current_time_get() - p_queue->p_push_times[idx];
+
+    p_queue->p_stats->latency[nrf_802154_stat_latency_bucket_get(latency)]++;
+}
+
+#endif // NRF_802154_QUEUE_STATS_ENABLED
+
 void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
                            void               * p_memory,
                            size_t               memory_size,
@@ -80,8 +141,26 @@ void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
     p_queue->item_size = item_size;
     p_queue->wridx     = 0U;
     p_queue->rdidx     = 0U;
+
+#if NRF_802154_QUEUE_STATS_ENABLED
+    p_queue->p_stats      = NULL;
+    p_queue->p_push_times = NULL;
+#endif
+}
+
+#if NRF_802154_QUEUE_STATS_ENABLED
+void nrf_802154_queue_stats_attach(nrf_802154_queue_t               * p_queue,
+                                   volatile nrf_802154_stat_queue_t * p_stats,
+                                   uint32_t                         * p_push_times)
+{
+    assert(p_push_times != NULL);
+
+    p_queue->p_push_times = p_push_times;
+    p_queue->p_stats      = p_stats;
 }
 
+#endif // NRF_802154_QUEUE_STATS_ENABLED
+
 void * nrf_802154_queue_push_begin(const nrf_802154_queue_t * p_queue)
 {
     return idx2ptr(p_queue, p_queue->wridx);
@@ -89,19 +168,93 @@ void * nrf_802154_queue_push_begin(const nrf_802154_queue_t * p_queue)
 
 void nrf_802154_queue_push_commit(nrf_802154_queue_t * p_queue)
 {
+#if NRF_802154_QUEUE_STATS_ENABLED
+    stats_push_update(p_queue);
+#endif
+
+    // Make the item visible to the reader only when it is completely written.
+    __DMB();
+
     p_queue->wridx = increment_modulo(p_queue->wridx, p_queue->capacity);
 }
 
 void * nrf_802154_queue_pop_begin(const nrf_802154_queue_t * p_queue)
 {
+    // The item must not be read before the write index that published it.
+    __DMB();
+
     return idx2ptr(p_queue, p_queue->rdidx);
 }
 
 void nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue)
 {
+#if NRF_802154_QUEUE_STATS_ENABLED
+    stats_pop_update(p_queue, p_queue->rdidx);
+#endif
+
+    // Free the slot only when the item is completely read.
+    __DMB();
+
     p_queue->rdidx = increment_modulo(p_queue->rdidx, p_queue->capacity);
 }
 
+void * nrf_802154_queue_last_pending_get(const nrf_802154_queue_t * p_queue)
+{
+    uint8_t rdidx = p_queue->rdidx;
+    uint8_t wridx = p_queue->wridx;
+    uint8_t lastidx;
+
+    if (wridx == rdidx)
+    {
+        return NULL;
+    }
+
+    lastidx = (wridx == 0U) ? (p_queue->capacity - 1U) : (wridx - 1U);
+
+    // The item at the read index may be being read already.
+    return (lastidx == rdidx) ? NULL : idx2ptr(p_queue, lastidx);
+}
+
+void * nrf_802154_queue_pop_batch_begin(const nrf_802154_queue_t * p_queue, uint8_t * p_count)
+{
+    uint8_t rdidx = p_queue->rdidx;
+    uint8_t wridx = p_queue->wridx;
+
+    assert(p_count != NULL);
+
+    // Items up to the end of the memory are contiguous, the rest is returned by the next call.
+    *p_count = (wridx >= rdidx) ? (wridx - rdidx) : (p_queue->capacity - rdidx);
+
+    // The items must not be read before the write index that published them.
+    __DMB();
+
+    return idx2ptr(p_queue, rdidx);
+}
+
+void nrf_802154_queue_pop_batch_commit(nrf_802154_queue_t * p_queue, uint8_t count)
+{
+    uint32_t rdidx = (uint32_t)p_queue->rdidx + count;
+
+    assert(count <= p_queue->capacity);
+
+#if NRF_802154_QUEUE_STATS_ENABLED
+    for (uint8_t i = 0; i < count; i++)
+    {
+        stats_pop_update(p_queue, (uint8_t)((p_queue->rdidx + i) % p_queue->capacity));
+    }
+#endif
+
+    if (rdidx >= p_queue->capacity)
+    {
+        rdidx -= p_queue->capacity;
+    }
+
+    // Free the slots only when the items are completely read.
+    __DMB();
+
+    p_queue->rdidx = (uint8_t)rdidx;
+}
+
 bool nrf_802154_queue_is_full(const nrf_802154_queue_t * p_queue)
 {
     size_t wridx;
@@ -40,6 +40,9 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
 /**@brief Type representing a FIFO queue. */
 typedef struct
 {
@@ -58,6 +61,14 @@ typedef struct
 
     /**@brief Index in the items memory of the queue where next item is read. */
     volatile uint8_t rdidx;
+
+#if NRF_802154_QUEUE_STATS_ENABLED
+    /**@brief Statistics updated by the queue, or NULL. */
+    volatile nrf_802154_stat_queue_t * p_stats;
+
+    /**@brief Write times of the items, @c capacity entries. */
+    uint32_t                         * p_push_times;
+#endif
 } nrf_802154_queue_t;
 
 /**@brief Initializes a queue.
@@ -74,6 +85,24 @@ void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
                            size_t               memory_size,
                            size_t               item_size);
 
+#if NRF_802154_QUEUE_STATS_ENABLED
+
+/**@brief Makes the queue update the given statistics.
+ *
+ * The statistics can be shared by several queues. The high watermark is then the highest
+ * watermark of all of them.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ * @param[in] p_stats       Pointer to the statistics to be updated.
+ * @param[in] p_push_times  Pointer to a memory for the write times of the items. It must hold
+ *                          as many entries as there are items in the memory of the queue.
+ */
+void nrf_802154_queue_stats_attach(nrf_802154_queue_t               * p_queue,
+                                   volatile nrf_802154_stat_queue_t * p_stats,
+                                   uint32_t                         * p_push_times);
+
+#endif // NRF_802154_QUEUE_STATS_ENABLED
+
 /**@brief Returns pointer to the next item to be written to the queue.
  *
  * This function is to be used when writing data to the queue directly (no copy).
@@ -90,7 +119,9 @@ void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
  * }
  * @endcode
  *
- * To ensure thread-safety external locking is required.
+ * External locking is required only if the queue is written from more than one context that can
+ * preempt each other. A single writer and a single reader need no locking, as memory barriers
+ * order the writes to the item and to the write index.
  *
  * @param[in] p_queue        Pointer to the queue instance.
  *
@@ -99,6 +130,8 @@ void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
 void * nrf_802154_queue_push_begin(const nrf_802154_queue_t * p_queue);
 
 /**@brief Increments write pointer of the queue.
+ *
+ * All writes to the item are completed before the item becomes visible to the reader.
  *
  * @param[in] p_queue       Pointer to the queue instance.
  */
@@ -108,7 +141,8 @@ void nrf_802154_queue_push_commit(nrf_802154_queue_t * p_queue);
  *
  * This function is to be used when reading data from the queue directly (no copy).
  * Returned pointer is valid when the queue is not empty (@ref nrf_802154_queue_is_empty returned false).
- * To ensure thread-safety external locking is required.
+ * External locking is required only if the queue is read from more than one context that can
+ * preempt each other.
  *
  * To read an item from the queue perform following.
  * @code
@@ -128,11 +162,46 @@ void nrf_802154_queue_push_commit(nrf_802154_queue_t * p_queue);
 void * nrf_802154_queue_pop_begin(const nrf_802154_queue_t * p_queue);
 
 /**@brief Increments read pointer of the queue.
+ *
+ * All reads of the item are completed before its slot is given back to the writer.
  *
  * @param[in] p_queue       Pointer to the queue instance.
  */
 void nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue);
 
+/**@brief Returns pointer to the item written last, if the reader has not started reading it.
+ *
+ * The returned item can still be modified by the writer, as the reader reaches it only after
+ * reading the item pointed by @ref nrf_802154_queue_pop_begin.
+ * The writer must not be preempted by the reader between this call and the item update.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ *
+ * @return Pointer to the item written last, or NULL if the queue holds less than two items.
+ */
+void * nrf_802154_queue_last_pending_get(const nrf_802154_queue_t * p_queue);
+
+/**@brief Returns pointer to the first of the items that can be read from the queue at once.
+ *
+ * The items are stored one after another in the memory of the queue, starting at the returned
+ * pointer. Items wrapped around the end of the memory are returned by the next call.
+ * The returned items are freed with @ref nrf_802154_queue_pop_batch_commit.
+ *
+ * @param[in]  p_queue  Pointer to the queue instance.
+ * @param[out] p_count  Number of items that can be read. Zero if the queue is empty.
+ *
+ * @return Pointer to the first item to be read.
+ */
+void * nrf_802154_queue_pop_batch_begin(const nrf_802154_queue_t * p_queue, uint8_t * p_count);
+
+/**@brief Increments read pointer of the queue by the given number of items.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ * @param[in] count         Number of items read. Must not exceed the number returned by
+ *                          @ref nrf_802154_queue_pop_batch_begin.
+ */
+void nrf_802154_queue_pop_batch_commit(nrf_802154_queue_t * p_queue, uint8_t count);
+
 /**@brief Checks if the queue is empty.
  *
  * @param[in] p_queue       Pointer to the queue instance.
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Macros that report the RAM used by the static buffers of the 802.15.4 driver modules.
+ *
+ */
+
+#ifndef NRF_802154_RAM_USAGE_H_
+#define NRF_802154_RAM_USAGE_H_
+
+#include <stdint.h>
+
+#include <nrfx.h>
+
+#include "nrf_802154_config.h"
+
+/**
+ * @brief Reports the number of bytes taken by the static buffers of a module.
+ *
+ * The macro is placed at file scope of the module, after the definitions of its buffers.
+ * It fails the build if @p size exceeds @ref NRF_802154_RAM_USAGE_MODULE_LIMIT and, if
+ * @ref NRF_802154_RAM_USAGE_REPORT_ENABLED is set, defines the constant
+ * @c nrf_802154_ram_usage_<module> equal to @p size.
+ *
+ * @param[in]  module  Name of the module, used in the name of the constant.
+ * @param[in]  size    Number of bytes taken by the buffers of the module.
+ */
+#if NRF_802154_RAM_USAGE_REPORT_ENABLED
+#define NRF_802154_RAM_USAGE_REPORT(module, size)                              \
+    NRFX_STATIC_ASSERT((size) <= NRF_802154_RAM_USAGE_MODULE_LIMIT);           \
+    __USED const uint32_t nrf_802154_ram_usage_ ## module = (uint32_t)(size)
+#else
+#define NRF_802154_RAM_USAGE_REPORT(module, size) \
+    NRFX_STATIC_ASSERT((size) <= NRF_802154_RAM_USAGE_MODULE_LIMIT)
+#endif
+
+#endif // NRF_802154_RAM_USAGE_H_
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a pool of pseudo-random numbers generated in advance.
+ *
+ * The pool is a single-producer, single-consumer ring buffer. It is refilled in the context
+ * of the higher layer and emptied by time-critical procedures, which can preempt the refill.
+ *
+ */
+
+#include "nrf_802154_random_pool.h"
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_utils.h"
+#include "platform/random/nrf_802154_random.h"
+
+#if NRF_802154_RANDOM_POOL_SIZE > 0
+
+#if (NRF_802154_RANDOM_POOL_SIZE & (NRF_802154_RANDOM_POOL_SIZE - 1)) != 0
+#error NRF_802154_RANDOM_POOL_SIZE must be a power of 2.
+#endif
+
+static uint32_t          m_pool[NRF_802154_RANDOM_POOL_SIZE]; ///< Pseudo-random numbers.
+static volatile uint32_t m_write_cnt;                         ///< Numbers put to the pool.
+static volatile uint32_t m_read_cnt;                          ///< Numbers taken from the pool.
+
+void nrf_802154_random_pool_init(void)
+{
+    m_write_cnt = 0U;
+    m_read_cnt  = 0U;
+
+    nrf_802154_random_pool_refill();
+}
+
+void nrf_802154_random_pool_refill(void)
+{
+    uint32_t write_cnt = m_write_cnt;
+
+    while ((write_cnt - m_read_cnt) < NRF_802154_RANDOM_POOL_SIZE)
+    {
+        m_pool[write_cnt % NRF_802154_RANDOM_POOL_SIZE] = nrf_802154_random_get();
+
+        // Make sure the number is stored before it is made available to the consumer.
+        __DMB();
+        m_write_cnt = ++write_cnt;
+    }
+}
+
+uint32_t nrf_802154_random_pool_get(void)
+{
+    uint32_t read_cnt = m_read_cnt;
+
+    if (read_cnt == m_write_cnt)
+    {
+        return nrf_802154_random_get();
+    }
+
+    uint32_t value = m_pool[read_cnt % NRF_802154_RANDOM_POOL_SIZE];
+
+    // Make sure the number is read before its entry is made available to the producer.
+    __DMB();
+    m_read_cnt = read_cnt + 1U;
+
+    return value;
+}
+
+#else // NRF_802154_RANDOM_POOL_SIZE > 0
+
+void nrf_802154_random_pool_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_random_pool_refill(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_random_pool_get(void)
+{
+    return nrf_802154_random_get();
+}
+
+#endif // NRF_802154_RANDOM_POOL_SIZE > 0
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that keeps a pool of pseudo-random numbers generated in advance.
+ *
+ */
+
+#ifndef NRF_802154_RANDOM_POOL_H_
+#define NRF_802154_RANDOM_POOL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the pool and fills it with pseudo-random numbers.
+ *
+ * @note The random number generator must be initialized before this function is called.
+ */
+void nrf_802154_random_pool_init(void);
+
+/**
+ * @brief Fills free entries of the pool with pseudo-random numbers.
+ *
+ * This function takes a variable time, because it calls the random number generator. It is to be
+ * called from a context in which this time does not matter, for example before a time-critical
+ * procedure is started.
+ */
+void nrf_802154_random_pool_refill(void);
+
+/**
+ * @brief Gets a pseudo-random number from the pool.
+ *
+ * The number is taken from the pool in constant time. If the pool is empty, or if
+ * @ref NRF_802154_RANDOM_POOL_SIZE is 0, the number is requested from the random number
+ * generator directly.
+ *
+ * @returns Pseudo-random number.
+ */
+uint32_t nrf_802154_random_pool_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_RANDOM_POOL_H_ */
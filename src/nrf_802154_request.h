@@ -35,6 +35,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_types.h"
@@ -92,6 +93,7 @@ bool nrf_802154_request_receive(nrf_802154_term_t              term_lvl,
  *                              If false, the transmission can be postponed until the TX
  *                              preconditions are met.
  * @param[in]  notify_function  Function called to notify the status of this procedure. May be NULL.
+ * @param[in]  p_params         Pointer to per-frame transmit parameters. May be NULL.
  *
  * @retval  true   The driver will enter the transmit state.
  * @retval  false  The driver cannot enter the transmit state due to an ongoing operation.
@@ -101,18 +103,51 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  const uint8_t                * p_data,
                                  bool                           cca,
                                  bool                           immediate,
-                                 nrf_802154_notification_func_t notify_function);
+                                 nrf_802154_notification_func_t notify_function,
+                                 const nrf_802154_tx_params_t * p_params);
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+/**
+ * @brief Request adding a frame to the transmit queue.
+ *
+ * @param[in]  p_data          Pointer to the frame to transmit.
+ * @param[in]  cca             If the driver is to perform the CCA procedure before transmission.
+ * @param[in]  p_queue_params  Pointer to the queue parameters of the frame or NULL.
+ *
+ * @retval  true   The frame is going to be transmitted.
+ * @retval  false  The frame was not accepted.
+ */
+bool nrf_802154_request_transmit_enqueue(const uint8_t                      * p_data,
+                                         bool                                 cca,
+                                         const nrf_802154_tx_queue_params_t * p_queue_params);
+
+/**
+ * @brief Request adding a burst of frames to the transmit queue.
+ *
+ * @param[in]  pp_data  Array of pointers to the frames to transmit.
+ * @param[in]  count    Number of frames in @p pp_data.
+ * @param[in]  cca      If the driver is to perform the CCA procedure before each transmission.
+ *
+ * @retval  true   The frames are going to be transmitted.
+ * @retval  false  The frames were not accepted.
+ */
+bool nrf_802154_request_transmit_burst(const uint8_t * const * pp_data, uint8_t count, bool cca);
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
 
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state.
  *
- * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
- * @param[in]  time_us   Requested duration of the energy detection procedure.
+ * @param[in]  term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]  time_us       Requested duration of the energy detection procedure.
+ * @param[in]  channel_mask  Mask of the channels to scan, or 0 to scan the current channel only.
  *
  * @retval  true   The driver will enter energy detection state.
  * @retval  false  The driver cannot enter the energy detection state due to an ongoing operation.
  */
-bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
+bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
+                                         uint32_t          time_us,
+                                         uint32_t          channel_mask);
 
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state.
@@ -124,6 +159,20 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t ti
  */
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl);
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+/**
+ * @brief Requests entering the low-power listening mode.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ *
+ * @retval  true   The driver will enter the low-power listening mode.
+ * @retval  false  The driver cannot enter the low-power listening mode due to an ongoing
+ *                 operation.
+ */
+bool nrf_802154_request_low_power_listening(nrf_802154_term_t term_lvl);
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CONTINUOUS_CARRIER state.
  *
@@ -162,11 +211,105 @@ bool nrf_802154_request_antenna_update(void);
  */
 bool nrf_802154_request_channel_update(void);
 
+#if NRF_802154_RX_HOPPING_ENABLED
+
+/**
+ * @brief Requests the driver to switch the receiver to another channel of the receive hopping
+ *        schedule.
+ *
+ * @param[in]  channel  Channel to switch to (11-26).
+ *
+ * @retval  true   The channel was switched.
+ * @retval  false  The channel was not switched, because the driver is busy with a frame.
+ */
+bool nrf_802154_request_rx_channel_hop(uint8_t channel);
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
 /**
  * @brief Requests the driver to update the CCA configuration used by the RADIO peripheral.
  */
 bool nrf_802154_request_cca_cfg_update(void);
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+/**
+ * @brief Requests the driver to apply the PIB changes staged during a PIB transaction.
+ *
+ * @param[in]  channel_changed  If the channel was changed during the transaction.
+ */
+bool nrf_802154_request_pib_update(bool channel_changed);
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_SLEEP state without waiting for the result.
+ *
+ * The result is notified with @ref nrf_802154_notify_async_request_done.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_request_sleep_async(nrf_802154_term_t term_lvl);
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_RX state without waiting for the result.
+ *
+ * The result is notified with @ref nrf_802154_notify_async_request_done.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_request_receive_async(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_TX state without waiting for the result.
+ *
+ * The result is notified with @ref nrf_802154_notify_async_request_done.
+ *
+ * @param[in]  term_lvl   Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig   Module that originates this request.
+ * @param[in]  p_data     Pointer to a buffer that contains PHR and PSDU of the frame to be
+ *                        transmitted.
+ * @param[in]  cca        If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  immediate  If true, the driver schedules transmission immediately or never.
+ *                        If false, the transmission may be postponed until the TX preconditions
+ *                        are met.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_request_transmit_async(nrf_802154_term_t term_lvl,
+                                       req_originator_t  req_orig,
+                                       const uint8_t   * p_data,
+                                       bool              cca,
+                                       bool              immediate);
+
+/**
+ * @brief Requests the driver to update the channel number without waiting for the result.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_request_channel_update_async(void);
+
+/**
+ * @brief Requests the driver to update the CCA configuration without waiting for the result.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_request_cca_cfg_update_async(void);
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
 /**
  * @brief Requests the RSSI measurement.
  */
@@ -41,6 +41,7 @@
 #include <stdint.h>
 
 #include "nrf_802154_core.h"
+#include "nrf_802154_notification.h"
 #include "hal/nrf_radio.h"
 
 #define REQUEST_FUNCTION_PARMS(func_core, ...) \
@@ -57,6 +58,11 @@
                                     \
     return result;
 
+#define REQUEST_FUNCTION_ASYNC(func_core, request, ...)                    \
+    nrf_802154_notify_async_request_done(request, func_core(__VA_ARGS__)); \
+                                                                           \
+    return true;
+
 void nrf_802154_request_init(void)
 {
     // Intentionally empty
@@ -84,7 +90,8 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  const uint8_t                * p_data,
                                  bool                           cca,
                                  bool                           immediate,
-                                 nrf_802154_notification_func_t notify_function)
+                                 nrf_802154_notification_func_t notify_function,
+                                 const nrf_802154_tx_params_t * p_params)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_transmit,
                            term_lvl,
@@ -92,12 +99,30 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                            p_data,
                            cca,
                            immediate,
-                           notify_function)
+                           notify_function,
+                           p_params)
+}
+
+#if NRF_802154_TX_QUEUE_SIZE > 0
+bool nrf_802154_request_transmit_enqueue(const uint8_t                      * p_data,
+                                         bool                                 cca,
+                                         const nrf_802154_tx_queue_params_t * p_queue_params)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_transmit_enqueue, p_data, cca, p_queue_params)
+}
+
+bool nrf_802154_request_transmit_burst(const uint8_t * const * pp_data, uint8_t count, bool cca)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_transmit_burst, pp_data, count, cca)
 }
 
-bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
+
+bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
+                                         uint32_t          time_us,
+                                         uint32_t          channel_mask)
 {
-    REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection, term_lvl, time_us)
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection, term_lvl, time_us, channel_mask)
 }
 
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
@@ -105,6 +130,14 @@ bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
     REQUEST_FUNCTION_PARMS(nrf_802154_core_cca, term_lvl)
 }
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+bool nrf_802154_request_low_power_listening(nrf_802154_term_t term_lvl)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_low_power_listening, term_lvl)
+}
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 bool nrf_802154_request_continuous_carrier(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_continuous_carrier, term_lvl)
@@ -131,11 +164,29 @@ bool nrf_802154_request_channel_update(void)
     REQUEST_FUNCTION(nrf_802154_core_channel_update)
 }
 
+#if NRF_802154_RX_HOPPING_ENABLED
+
+bool nrf_802154_request_rx_channel_hop(uint8_t channel)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_rx_channel_hop, channel)
+}
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
 bool nrf_802154_request_cca_cfg_update(void)
 {
     REQUEST_FUNCTION(nrf_802154_core_cca_cfg_update)
 }
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+bool nrf_802154_request_pib_update(bool channel_changed)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_pib_update, channel_changed)
+}
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
 bool nrf_802154_request_rssi_measure(void)
 {
     REQUEST_FUNCTION(nrf_802154_core_rssi_measure)
@@ -145,3 +196,54 @@ bool nrf_802154_request_rssi_measurement_get(int8_t * p_rssi)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_last_rssi_measurement_get, p_rssi)
 }
+
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+bool nrf_802154_request_sleep_async(nrf_802154_term_t term_lvl)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_sleep, NRF_802154_ASYNC_REQUEST_SLEEP, term_lvl)
+}
+
+bool nrf_802154_request_receive_async(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_receive,
+                           NRF_802154_ASYNC_REQUEST_RECEIVE,
+                           term_lvl,
+                           req_orig,
+                           NULL,
+                           true)
+}
+
+bool nrf_802154_request_transmit_async(nrf_802154_term_t term_lvl,
+                                       req_originator_t  req_orig,
+                                       const uint8_t   * p_data,
+                                       bool              cca,
+                                       bool              immediate)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_transmit,
+                           NRF_802154_ASYNC_REQUEST_TRANSMIT,
+                           term_lvl,
+                           req_orig,
+                           p_data,
+                           cca,
+                           immediate,
+                           NULL,
+                           NULL)
+}
+
+bool nrf_802154_request_channel_update_async(void)
+{
+    nrf_802154_notify_async_request_done(NRF_802154_ASYNC_REQUEST_CHANNEL_UPDATE,
+                                         nrf_802154_core_channel_update());
+
+    return true;
+}
+
+bool nrf_802154_request_cca_cfg_update_async(void)
+{
+    nrf_802154_notify_async_request_done(NRF_802154_ASYNC_REQUEST_CCA_CFG_UPDATE,
+                                         nrf_802154_core_cca_cfg_update());
+
+    return true;
+}
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
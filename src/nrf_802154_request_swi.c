@@ -45,10 +45,14 @@
 #include "nrf_802154_core.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_notification.h"
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_queue.h"
+#include "nrf_802154_ram_usage.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
+#include "nrf_802154_trace.h"
 #include "nrf_802154_utils.h"
 #include "hal/nrf_radio.h"
 #include "hal/nrf_egu.h"
@@ -58,9 +62,10 @@
 
 /** Size of requests queue.
  *
- * Two is minimal queue size. It is not expected in current implementation to queue a few requests.
+ * Two is minimal queue size. It is enough for synchronous requests, but each pending asynchronous
+ * request occupies a slot (see @ref NRF_802154_REQUEST_QUEUE_SIZE).
  */
-#define REQ_QUEUE_SIZE 2
+#define REQ_QUEUE_SIZE NRF_802154_REQUEST_QUEUE_SIZE
 
 #define REQ_INT        NRF_EGU_INT_TRIGGERED2   ///< Label of request interrupt.
 #define REQ_TASK       NRF_EGU_TASK_TRIGGER2    ///< Label of request task.
@@ -79,9 +84,22 @@ typedef enum
     REQ_TYPE_BUFFER_FREE,
     REQ_TYPE_CHANNEL_UPDATE,
     REQ_TYPE_CCA_CFG_UPDATE,
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+    REQ_TYPE_PIB_UPDATE,
+#endif
     REQ_TYPE_RSSI_MEASURE,
     REQ_TYPE_RSSI_GET,
     REQ_TYPE_ANTENNA_UPDATE,
+#if NRF_802154_TX_QUEUE_SIZE > 0
+    REQ_TYPE_TRANSMIT_ENQUEUE,
+    REQ_TYPE_TRANSMIT_BURST,
+#endif
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+    REQ_TYPE_LOW_POWER_LISTENING,
+#endif
+#if NRF_802154_RX_HOPPING_ENABLED
+    REQ_TYPE_RX_CHANNEL_HOP,
+#endif
 } nrf_802154_req_type_t;
 
 /// Request data in request queue.
@@ -89,6 +107,10 @@ typedef struct
 {
     nrf_802154_req_type_t type; ///< Type of the request.
 
+#if NRF_802154_LATENCY_STATS_ENABLED
+    uint32_t start_time; ///< Time when the request was called.
+#endif
+
     union
     {
         struct
@@ -114,15 +136,35 @@ typedef struct
             const uint8_t                * p_data;     ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
             bool                           cca;        ///< If CCA was requested prior to transmission.
             bool                           immediate;  ///< If TX procedure must be performed immediately.
+            const nrf_802154_tx_params_t * p_params;   ///< Per-frame transmit parameters.
             bool                         * p_result;   ///< Transmit request result.
         } transmit;                                    ///< Transmit request details.
 
+#if NRF_802154_TX_QUEUE_SIZE > 0
         struct
         {
-            nrf_802154_term_t term_lvl; ///< Request priority.
-            bool            * p_result; ///< Energy detection request result.
-            uint32_t          time_us;  ///< Requested time of energy detection procedure.
-        } energy_detection;             ///< Energy detection request details.
+            const uint8_t                      * p_data;         ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
+            bool                                 cca;            ///< If CCA was requested prior to transmission.
+            const nrf_802154_tx_queue_params_t * p_queue_params; ///< Queue parameters of the frame or NULL.
+            bool                               * p_result;       ///< Transmit enqueue request result.
+        } transmit_enqueue;                                      ///< Transmit enqueue request details.
+
+        struct
+        {
+            const uint8_t * const * pp_data;  ///< Array of pointers to the frames to transmit.
+            uint8_t                 count;    ///< Number of frames in @p pp_data.
+            bool                    cca;      ///< If CCA was requested prior to each transmission.
+            bool                  * p_result; ///< Transmit burst request result.
+        } transmit_burst;                     ///< Transmit burst request details.
+#endif
+
+        struct
+        {
+            nrf_802154_term_t term_lvl;     ///< Request priority.
+            bool            * p_result;     ///< Energy detection request result.
+            uint32_t          time_us;      ///< Requested time of energy detection procedure.
+            uint32_t          channel_mask; ///< Channels to scan, or 0 for the current channel.
+        } energy_detection;                 ///< Energy detection request details.
 
         struct
         {
@@ -130,6 +172,14 @@ typedef struct
             bool            * p_result; ///< CCA request result.
         } cca;                          ///< CCA request details.
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+        struct
+        {
+            nrf_802154_term_t term_lvl; ///< Request priority.
+            bool            * p_result; ///< Low-power listening request result.
+        } low_power_listening;          ///< Low-power listening request details.
+#endif
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -154,11 +204,27 @@ typedef struct
             bool * p_result; ///< Channel update request result.
         } channel_update;    ///< Channel update request details.
 
+#if NRF_802154_RX_HOPPING_ENABLED
+        struct
+        {
+            uint8_t channel;  ///< Channel to switch to.
+            bool  * p_result; ///< Channel hop request result.
+        } rx_channel_hop;     ///< Receive channel hop request details.
+#endif
+
         struct
         {
             bool * p_result; ///< CCA config update request result.
         } cca_cfg_update;    ///< CCA config update request details.
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+        struct
+        {
+            bool   channel_changed; ///< If the channel was changed during the transaction.
+            bool * p_result;        ///< PIB update request result.
+        } pib_update;               ///< PIB update request details.
+#endif
+
         struct
         {
             bool * p_result; ///< RSSI measurement request result.
@@ -183,6 +249,16 @@ static nrf_802154_queue_t m_requests_queue;
 /**@brief Memory holding requests queue items */
 static nrf_802154_req_data_t m_requests_queue_memory[REQ_QUEUE_SIZE];
 
+#if NRF_802154_QUEUE_STATS_ENABLED
+/**@brief Write times of the requests queue items */
+static uint32_t m_requests_queue_push_times[REQ_QUEUE_SIZE];
+
+NRF_802154_RAM_USAGE_REPORT(request,
+                            sizeof(m_requests_queue_memory) + sizeof(m_requests_queue_push_times));
+#else
+NRF_802154_RAM_USAGE_REPORT(request, sizeof(m_requests_queue_memory));
+#endif
+
 /**@brief State of the MCU critical section */
 static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
 
@@ -196,11 +272,19 @@ static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
  */
 static nrf_802154_req_data_t * req_enter(void)
 {
+    nrf_802154_req_data_t * p_slot;
+
     nrf_802154_mcu_critical_enter(m_mcu_cs);
 
     assert(!nrf_802154_queue_is_full(&m_requests_queue));
 
-    return (nrf_802154_req_data_t *)nrf_802154_queue_push_begin(&m_requests_queue);
+    p_slot = (nrf_802154_req_data_t *)nrf_802154_queue_push_begin(&m_requests_queue);
+
+#if NRF_802154_LATENCY_STATS_ENABLED
+    p_slot->start_time = nrf_802154_stat_latency_start_get();
+#endif
+
+    return p_slot;
 }
 
 /**
@@ -254,6 +338,69 @@ static inline void assert_interrupt_status(void)
                                                       \
     return result;
 
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+
+/** Queue the request with a NULL result pointer, which marks it as asynchronous.
+ *
+ * If the active vector priority is high enough, the request is processed at once and its
+ * result is notified. Otherwise the request is queued only if there is a free slot.
+ */
+#define REQUEST_FUNCTION_ASYNC(func_core, func_swi, request, ...)                 \
+    bool result = false;                                                          \
+                                                                                  \
+    if (active_vector_priority_is_high())                                         \
+    {                                                                             \
+        nrf_802154_notify_async_request_done(request, func_core(__VA_ARGS__));    \
+        result = true;                                                            \
+    }                                                                             \
+    else                                                                          \
+    {                                                                             \
+        nrf_802154_mcu_critical_state_t mcu_cs;                                   \
+                                                                                  \
+        assert_interrupt_status();                                                \
+                                                                                  \
+        nrf_802154_mcu_critical_enter(mcu_cs);                                    \
+                                                                                  \
+        if (!nrf_802154_queue_is_full(&m_requests_queue))                         \
+        {                                                                         \
+            func_swi(__VA_ARGS__, NULL);                                          \
+            result = true;                                                        \
+        }                                                                         \
+                                                                                  \
+        nrf_802154_mcu_critical_exit(mcu_cs);                                     \
+    }                                                                             \
+                                                                                  \
+    return result;
+
+#define REQUEST_FUNCTION_ASYNC_NO_ARGS(func_core, func_swi, request) \
+    bool result = false;                                             \
+                                                                     \
+    if (active_vector_priority_is_high())                            \
+    {                                                                \
+        nrf_802154_notify_async_request_done(request, func_core());  \
+        result = true;                                               \
+    }                                                                \
+    else                                                             \
+    {                                                                \
+        nrf_802154_mcu_critical_state_t mcu_cs;                      \
+                                                                     \
+        assert_interrupt_status();                                   \
+                                                                     \
+        nrf_802154_mcu_critical_enter(mcu_cs);                       \
+                                                                     \
+        if (!nrf_802154_queue_is_full(&m_requests_queue))            \
+        {                                                            \
+            func_swi(NULL);                                          \
+            result = true;                                           \
+        }                                                            \
+                                                                     \
+        nrf_802154_mcu_critical_exit(mcu_cs);                        \
+    }                                                                \
+                                                                     \
+    return result;
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
 /** Check if active vector priority is high enough to call requests directly.
  *
  *  @retval  true   Active vector priority is greater or equal to SWI priority.
@@ -324,6 +471,7 @@ static void swi_receive(nrf_802154_term_t              term_lvl,
  * @param[in]   notify_function  Function called to notify the status of this procedure instead of
  *                               the default notification. If NULL, the default notification
  *                               is used.
+ * @param[in]   p_params         Pointer to per-frame transmit parameters. May be NULL.
  * @param[out]  p_result         Result of entering the transmit state.
  */
 static void swi_transmit(nrf_802154_term_t              term_lvl,
@@ -332,6 +480,7 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
                          bool                           cca,
                          bool                           immediate,
                          nrf_802154_notification_func_t notify_function,
+                         const nrf_802154_tx_params_t * p_params,
                          bool                         * p_result)
 {
     nrf_802154_req_data_t * p_slot = req_enter();
@@ -343,28 +492,83 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
     p_slot->data.transmit.cca        = cca;
     p_slot->data.transmit.immediate  = immediate;
     p_slot->data.transmit.notif_func = notify_function;
+    p_slot->data.transmit.p_params   = p_params;
     p_slot->data.transmit.p_result   = p_result;
 
     req_exit();
 }
 
+#if NRF_802154_TX_QUEUE_SIZE > 0
+/**
+ * @brief Requests adding a frame to the transmit queue from the SWI priority.
+ *
+ * @param[in]   p_data          Pointer to the frame to transmit.
+ * @param[in]   cca             If the driver should perform the CCA procedure before transmission.
+ * @param[in]   p_queue_params  Pointer to the queue parameters of the frame or NULL.
+ * @param[out]  p_result        Result of adding the frame.
+ */
+static void swi_transmit_enqueue(const uint8_t                      * p_data,
+                                 bool                                 cca,
+                                 const nrf_802154_tx_queue_params_t * p_queue_params,
+                                 bool                               * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                                 = REQ_TYPE_TRANSMIT_ENQUEUE;
+    p_slot->data.transmit_enqueue.p_data         = p_data;
+    p_slot->data.transmit_enqueue.cca            = cca;
+    p_slot->data.transmit_enqueue.p_queue_params = p_queue_params;
+    p_slot->data.transmit_enqueue.p_result       = p_result;
+
+    req_exit();
+}
+
+/**
+ * @brief Requests adding a burst of frames to the transmit queue from the SWI priority.
+ *
+ * @param[in]   pp_data   Array of pointers to the frames to transmit.
+ * @param[in]   count     Number of frames in @p pp_data.
+ * @param[in]   cca       If the driver should perform the CCA procedure before each transmission.
+ * @param[out]  p_result  Result of adding the frames.
+ */
+static void swi_transmit_burst(const uint8_t * const * pp_data,
+                               uint8_t                 count,
+                               bool                    cca,
+                               bool                  * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                         = REQ_TYPE_TRANSMIT_BURST;
+    p_slot->data.transmit_burst.pp_data  = pp_data;
+    p_slot->data.transmit_burst.count    = count;
+    p_slot->data.transmit_burst.cca      = cca;
+    p_slot->data.transmit_burst.p_result = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state from the SWI priority.
  *
- * @param[in]   term_lvl  Termination level of this request. Selects procedures to abort.
- * @param[in]   time_us   Requested duration of the energy detection procedure.
- * @param[out]  p_result  Result of entering the energy detection state.
+ * @param[in]   term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]   time_us       Requested duration of the energy detection procedure.
+ * @param[in]   channel_mask  Mask of the channels to scan, or 0 for the current channel only.
+ * @param[out]  p_result      Result of entering the energy detection state.
  */
 static void swi_energy_detection(nrf_802154_term_t term_lvl,
                                  uint32_t          time_us,
+                                 uint32_t          channel_mask,
                                  bool            * p_result)
 {
     nrf_802154_req_data_t * p_slot = req_enter();
 
-    p_slot->type                           = REQ_TYPE_ENERGY_DETECTION;
-    p_slot->data.energy_detection.term_lvl = term_lvl;
-    p_slot->data.energy_detection.time_us  = time_us;
-    p_slot->data.energy_detection.p_result = p_result;
+    p_slot->type                               = REQ_TYPE_ENERGY_DETECTION;
+    p_slot->data.energy_detection.term_lvl     = term_lvl;
+    p_slot->data.energy_detection.time_us      = time_us;
+    p_slot->data.energy_detection.channel_mask = channel_mask;
+    p_slot->data.energy_detection.p_result     = p_result;
 
     req_exit();
 }
@@ -386,6 +590,26 @@ static void swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
     req_exit();
 }
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+/**
+ * @brief Requests entering the low-power listening mode from the SWI priority.
+ *
+ * @param[in]   term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[out]  p_result  Result of entering the low-power listening mode.
+ */
+static void swi_low_power_listening(nrf_802154_term_t term_lvl, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                              = REQ_TYPE_LOW_POWER_LISTENING;
+    p_slot->data.low_power_listening.term_lvl = term_lvl;
+    p_slot->data.low_power_listening.p_result = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CONTINUOUS_CARRIER state from the SWI priority.
  *
@@ -474,6 +698,27 @@ static void swi_channel_update(bool * p_result)
     req_exit();
 }
 
+#if NRF_802154_RX_HOPPING_ENABLED
+
+/**
+ * @brief Requests switching the receiver to another channel from the SWI priority.
+ *
+ * @param[in]   channel   Channel to switch to.
+ * @param[out]  p_result  Result of the channel hop.
+ */
+static void swi_rx_channel_hop(uint8_t channel, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                         = REQ_TYPE_RX_CHANNEL_HOP;
+    p_slot->data.rx_channel_hop.channel  = channel;
+    p_slot->data.rx_channel_hop.p_result = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
 /**
  * @brief Notifies the core module that the next higher layer has requested a CCA configuration
  * change.
@@ -490,6 +735,28 @@ static void swi_cca_cfg_update(bool * p_result)
     req_exit();
 }
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+/**
+ * @brief Notifies the core module that the next higher layer has committed a PIB transaction.
+ *
+ * @param[in]   channel_changed  If the channel was changed during the transaction.
+ * @param[out]  p_result         Pointer where the result to be returned by
+ *                               nrf_802154_request_pib_update should be written by the swi handler.
+ */
+static void swi_pib_update(bool channel_changed, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                            = REQ_TYPE_PIB_UPDATE;
+    p_slot->data.pib_update.channel_changed = channel_changed;
+    p_slot->data.pib_update.p_result        = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
 /**
  * @brief Notifies the core module that the next higher layer requested the RSSI measurement.
  *
@@ -529,6 +796,12 @@ void nrf_802154_request_init(void)
     nrf_802154_queue_init(&m_requests_queue, m_requests_queue_memory,
                           sizeof(m_requests_queue_memory), sizeof(m_requests_queue_memory[0]));
 
+#if NRF_802154_QUEUE_STATS_ENABLED
+    nrf_802154_queue_stats_attach(&m_requests_queue,
+                                  &g_nrf_802154_stat_queues.requests,
+                                  m_requests_queue_push_times);
+#endif
+
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, REQ_INT);
 
     nrf_802154_swi_init();
@@ -557,7 +830,8 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  const uint8_t                * p_data,
                                  bool                           cca,
                                  bool                           immediate,
-                                 nrf_802154_notification_func_t notify_function)
+                                 nrf_802154_notification_func_t notify_function,
+                                 const nrf_802154_tx_params_t * p_params)
 {
     REQUEST_FUNCTION(nrf_802154_core_transmit,
                      swi_transmit,
@@ -566,16 +840,38 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      p_data,
                      cca,
                      immediate,
-                     notify_function)
+                     notify_function,
+                     p_params)
 }
 
+#if NRF_802154_TX_QUEUE_SIZE > 0
+bool nrf_802154_request_transmit_enqueue(const uint8_t                      * p_data,
+                                         bool                                 cca,
+                                         const nrf_802154_tx_queue_params_t * p_queue_params)
+{
+    REQUEST_FUNCTION(nrf_802154_core_transmit_enqueue,
+                     swi_transmit_enqueue,
+                     p_data,
+                     cca,
+                     p_queue_params)
+}
+
+bool nrf_802154_request_transmit_burst(const uint8_t * const * pp_data, uint8_t count, bool cca)
+{
+    REQUEST_FUNCTION(nrf_802154_core_transmit_burst, swi_transmit_burst, pp_data, count, cca)
+}
+
+#endif // NRF_802154_TX_QUEUE_SIZE > 0
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
-                                         uint32_t          time_us)
+                                         uint32_t          time_us,
+                                         uint32_t          channel_mask)
 {
     REQUEST_FUNCTION(nrf_802154_core_energy_detection,
                      swi_energy_detection,
                      term_lvl,
-                     time_us)
+                     time_us,
+                     channel_mask)
 }
 
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
@@ -583,6 +879,14 @@ bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
     REQUEST_FUNCTION(nrf_802154_core_cca, swi_cca, term_lvl)
 }
 
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+bool nrf_802154_request_low_power_listening(nrf_802154_term_t term_lvl)
+{
+    REQUEST_FUNCTION(nrf_802154_core_low_power_listening, swi_low_power_listening, term_lvl)
+}
+
+#endif // NRF_802154_LOW_POWER_LISTENING_ENABLED
+
 bool nrf_802154_request_continuous_carrier(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION(nrf_802154_core_continuous_carrier, swi_continuous_carrier,
@@ -613,11 +917,29 @@ bool nrf_802154_request_channel_update(void)
     REQUEST_FUNCTION_NO_ARGS(nrf_802154_core_channel_update, swi_channel_update)
 }
 
+#if NRF_802154_RX_HOPPING_ENABLED
+
+bool nrf_802154_request_rx_channel_hop(uint8_t channel)
+{
+    REQUEST_FUNCTION(nrf_802154_core_rx_channel_hop, swi_rx_channel_hop, channel)
+}
+
+#endif // NRF_802154_RX_HOPPING_ENABLED
+
 bool nrf_802154_request_cca_cfg_update(void)
 {
     REQUEST_FUNCTION_NO_ARGS(nrf_802154_core_cca_cfg_update, swi_cca_cfg_update)
 }
 
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+
+bool nrf_802154_request_pib_update(bool channel_changed)
+{
+    REQUEST_FUNCTION(nrf_802154_core_pib_update, swi_pib_update, channel_changed)
+}
+
+#endif // NRF_802154_PIB_TRANSACTION_ENABLED
+
 bool nrf_802154_request_rssi_measure(void)
 {
     REQUEST_FUNCTION_NO_ARGS(nrf_802154_core_rssi_measure, swi_rssi_measure)
@@ -630,6 +952,92 @@ bool nrf_802154_request_rssi_measurement_get(int8_t * p_rssi)
                      p_rssi)
 }
 
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+bool nrf_802154_request_sleep_async(nrf_802154_term_t term_lvl)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_sleep,
+                           swi_sleep,
+                           NRF_802154_ASYNC_REQUEST_SLEEP,
+                           term_lvl)
+}
+
+bool nrf_802154_request_receive_async(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_receive,
+                           swi_receive,
+                           NRF_802154_ASYNC_REQUEST_RECEIVE,
+                           term_lvl,
+                           req_orig,
+                           NULL,
+                           true)
+}
+
+bool nrf_802154_request_transmit_async(nrf_802154_term_t term_lvl,
+                                       req_originator_t  req_orig,
+                                       const uint8_t   * p_data,
+                                       bool              cca,
+                                       bool              immediate)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_transmit,
+                           swi_transmit,
+                           NRF_802154_ASYNC_REQUEST_TRANSMIT,
+                           term_lvl,
+                           req_orig,
+                           p_data,
+                           cca,
+                           immediate,
+                           NULL,
+                           NULL)
+}
+
+bool nrf_802154_request_channel_update_async(void)
+{
+    REQUEST_FUNCTION_ASYNC_NO_ARGS(nrf_802154_core_channel_update,
+                                   swi_channel_update,
+                                   NRF_802154_ASYNC_REQUEST_CHANNEL_UPDATE)
+}
+
+bool nrf_802154_request_cca_cfg_update_async(void)
+{
+    REQUEST_FUNCTION_ASYNC_NO_ARGS(nrf_802154_core_cca_cfg_update,
+                                   swi_cca_cfg_update,
+                                   NRF_802154_ASYNC_REQUEST_CCA_CFG_UPDATE)
+}
+
+/**@brief Gets the type of the asynchronous request notified when the given request is processed.
+ *
+ * @param[in]  type  Type of the request in the request queue.
+ *
+ * @returns  Type of the asynchronous request.
+ */
+static nrf_802154_async_request_t async_request_get(nrf_802154_req_type_t type)
+{
+    switch (type)
+    {
+        case REQ_TYPE_SLEEP:
+            return NRF_802154_ASYNC_REQUEST_SLEEP;
+
+        case REQ_TYPE_RECEIVE:
+            return NRF_802154_ASYNC_REQUEST_RECEIVE;
+
+        case REQ_TYPE_TRANSMIT:
+            return NRF_802154_ASYNC_REQUEST_TRANSMIT;
+
+        case REQ_TYPE_CHANNEL_UPDATE:
+            return NRF_802154_ASYNC_REQUEST_CHANNEL_UPDATE;
+
+        case REQ_TYPE_CCA_CFG_UPDATE:
+            return NRF_802154_ASYNC_REQUEST_CCA_CFG_UPDATE;
+
+        default:
+            // Other requests are always synchronous.
+            assert(false);
+            return NRF_802154_ASYNC_REQUEST_SLEEP;
+    }
+}
+
+#endif // NRF_802154_ASYNC_REQUESTS_ENABLED
+
 /**@brief Handles REQ_EVENT on NRF_802154_EGU_INSTANCE */
 static void irq_handler_req_event(void)
 {
@@ -637,16 +1045,26 @@ static void irq_handler_req_event(void)
     {
         nrf_802154_req_data_t * p_slot =
             (nrf_802154_req_data_t *)nrf_802154_queue_pop_begin(&m_requests_queue);
+        bool   result   = false;
+        bool * p_result = NULL;
+
+#if NRF_802154_LATENCY_STATS_ENABLED
+        nrf_802154_stat_latency_record(NRF_802154_STAT_LATENCY_REQUEST_SERVICING,
+                                       p_slot->start_time);
+#endif
+
+        nrf_802154_trace_input(NRF_802154_TRACE_INPUT_SOURCE_REQUEST, p_slot->type, 0U);
 
         switch (p_slot->type)
         {
             case REQ_TYPE_SLEEP:
-                *(p_slot->data.sleep.p_result) =
-                    nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
+                p_result = p_slot->data.sleep.p_result;
+                result   = nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
                 break;
 
             case REQ_TYPE_RECEIVE:
-                *(p_slot->data.receive.p_result) =
+                p_result = p_slot->data.receive.p_result;
+                result   =
                     nrf_802154_core_receive(p_slot->data.receive.term_lvl,
                                             p_slot->data.receive.req_orig,
                                             p_slot->data.receive.notif_func,
@@ -654,68 +1072,136 @@ static void irq_handler_req_event(void)
                 break;
 
             case REQ_TYPE_TRANSMIT:
-                *(p_slot->data.transmit.p_result) =
+                p_result = p_slot->data.transmit.p_result;
+                result   =
                     nrf_802154_core_transmit(p_slot->data.transmit.term_lvl,
                                              p_slot->data.transmit.req_orig,
                                              p_slot->data.transmit.p_data,
                                              p_slot->data.transmit.cca,
                                              p_slot->data.transmit.immediate,
-                                             p_slot->data.transmit.notif_func);
+                                             p_slot->data.transmit.notif_func,
+                                             p_slot->data.transmit.p_params);
                 break;
 
             case REQ_TYPE_ENERGY_DETECTION:
-                *(p_slot->data.energy_detection.p_result) =
+                p_result = p_slot->data.energy_detection.p_result;
+                result   =
                     nrf_802154_core_energy_detection(
                         p_slot->data.energy_detection.term_lvl,
-                        p_slot->data.energy_detection.time_us);
+                        p_slot->data.energy_detection.time_us,
+                        p_slot->data.energy_detection.channel_mask);
                 break;
 
             case REQ_TYPE_CCA:
-                *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
+                p_result = p_slot->data.cca.p_result;
+                result   = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
+                break;
+
+#if NRF_802154_LOW_POWER_LISTENING_ENABLED
+            case REQ_TYPE_LOW_POWER_LISTENING:
+                p_result = p_slot->data.low_power_listening.p_result;
+                result   = nrf_802154_core_low_power_listening(
+                    p_slot->data.low_power_listening.term_lvl);
                 break;
+#endif
 
             case REQ_TYPE_CONTINUOUS_CARRIER:
-                *(p_slot->data.continuous_carrier.p_result) =
+                p_result = p_slot->data.continuous_carrier.p_result;
+                result   =
                     nrf_802154_core_continuous_carrier(
                         p_slot->data.continuous_carrier.term_lvl);
                 break;
 
             case REQ_TYPE_MODULATED_CARRIER:
-                *(p_slot->data.modulated_carrier.p_result) =
+                p_result = p_slot->data.modulated_carrier.p_result;
+                result   =
                     nrf_802154_core_modulated_carrier(p_slot->data.modulated_carrier.term_lvl,
                                                       p_slot->data.modulated_carrier.p_data);
                 break;
 
             case REQ_TYPE_BUFFER_FREE:
-                *(p_slot->data.buffer_free.p_result) =
+                p_result = p_slot->data.buffer_free.p_result;
+                result   =
                     nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
                 break;
 
             case REQ_TYPE_CHANNEL_UPDATE:
-                *(p_slot->data.channel_update.p_result) = nrf_802154_core_channel_update();
+                p_result = p_slot->data.channel_update.p_result;
+                result   = nrf_802154_core_channel_update();
+                break;
+
+#if NRF_802154_RX_HOPPING_ENABLED
+            case REQ_TYPE_RX_CHANNEL_HOP:
+                p_result = p_slot->data.rx_channel_hop.p_result;
+                result   = nrf_802154_core_rx_channel_hop(p_slot->data.rx_channel_hop.channel);
                 break;
+#endif
 
             case REQ_TYPE_CCA_CFG_UPDATE:
-                *(p_slot->data.cca_cfg_update.p_result) = nrf_802154_core_cca_cfg_update();
+                p_result = p_slot->data.cca_cfg_update.p_result;
+                result   = nrf_802154_core_cca_cfg_update();
+                break;
+
+#if NRF_802154_PIB_TRANSACTION_ENABLED
+            case REQ_TYPE_PIB_UPDATE:
+                p_result = p_slot->data.pib_update.p_result;
+                result   = nrf_802154_core_pib_update(p_slot->data.pib_update.channel_changed);
                 break;
+#endif
 
             case REQ_TYPE_RSSI_MEASURE:
-                *(p_slot->data.rssi_measure.p_result) = nrf_802154_core_rssi_measure();
+                p_result = p_slot->data.rssi_measure.p_result;
+                result   = nrf_802154_core_rssi_measure();
                 break;
 
             case REQ_TYPE_RSSI_GET:
-                *(p_slot->data.rssi_get.p_result) =
+                p_result = p_slot->data.rssi_get.p_result;
+                result   =
                     nrf_802154_core_last_rssi_measurement_get(p_slot->data.rssi_get.p_rssi);
                 break;
 
             case REQ_TYPE_ANTENNA_UPDATE:
-                *(p_slot->data.antenna_update.p_result) = nrf_802154_core_antenna_update();
+                p_result = p_slot->data.antenna_update.p_result;
+                result   = nrf_802154_core_antenna_update();
                 break;
 
+#if NRF_802154_TX_QUEUE_SIZE > 0
+            case REQ_TYPE_TRANSMIT_ENQUEUE:
+                p_result = p_slot->data.transmit_enqueue.p_result;
+                result   =
+                    nrf_802154_core_transmit_enqueue(p_slot->data.transmit_enqueue.p_data,
+                                                     p_slot->data.transmit_enqueue.cca,
+                                                     p_slot->data.transmit_enqueue.p_queue_params);
+                break;
+
+            case REQ_TYPE_TRANSMIT_BURST:
+                p_result = p_slot->data.transmit_burst.p_result;
+                result   = nrf_802154_core_transmit_burst(p_slot->data.transmit_burst.pp_data,
+                                                          p_slot->data.transmit_burst.count,
+                                                          p_slot->data.transmit_burst.cca);
+                break;
+#endif
+
             default:
                 assert(false);
         }
 
+        nrf_802154_trace_input_done(NRF_802154_TRACE_INPUT_SOURCE_REQUEST, p_slot->type);
+
+        if (p_result != NULL)
+        {
+            *p_result = result;
+        }
+        else
+        {
+#if NRF_802154_ASYNC_REQUESTS_ENABLED
+            // Request was issued asynchronously, no one is waiting for the result.
+            nrf_802154_notify_async_request_done(async_request_get(p_slot->type), result);
+#else
+            assert(false);
+#endif
+        }
+
         nrf_802154_queue_pop_commit(&m_requests_queue);
     }
 }
@@ -35,13 +35,18 @@
  *
  */
 
+#include "nrf_802154_rssi.h"
+
 #include <stdint.h>
 
 #include "platform/temperature/nrf_802154_temperature.h"
 
-int8_t nrf_802154_rssi_sample_temp_corr_value_get(void)
+/// Temperature correction value computed for the last temperature reported by the platform.
+static volatile int8_t m_temp_corr_value;
+
+/** Compute the RSSISAMPLE temperature correction value for the given temperature. */
+static int8_t temp_corr_value_compute(int8_t temp)
 {
-    int8_t temp = nrf_802154_temperature_get();
     int8_t result;
 
     if (temp <= -30)
@@ -76,6 +81,16 @@ int8_t nrf_802154_rssi_sample_temp_corr_value_get(void)
     return result;
 }
 
+void nrf_802154_rssi_temperature_update(void)
+{
+    m_temp_corr_value = temp_corr_value_compute(nrf_802154_temperature_get());
+}
+
+int8_t nrf_802154_rssi_sample_temp_corr_value_get(void)
+{
+    return m_temp_corr_value;
+}
+
 uint8_t nrf_802154_rssi_sample_corrected_get(uint8_t rssi_sample)
 {
     return rssi_sample + nrf_802154_rssi_sample_temp_corr_value_get();
@@ -41,10 +41,20 @@
  * @brief RSSI calculations used internally in the 802.15.4 driver.
  */
 
+/**
+ * @brief Updates the RSSISAMPLE temperature correction value.
+ *
+ * The correction value is computed from the current temperature reported by the platform and
+ * cached, so that the corrections of the measurements do not depend on the thermometer. This
+ * function must be called when the driver is initialized and every time the temperature changes.
+ */
+void nrf_802154_rssi_temperature_update(void);
+
 /**
  * @brief Gets the RSSISAMPLE temperature correction value.
  *
- * The correction value is based on the last temperature value reported by the platform.
+ * The correction value is based on the temperature value cached by the last call to
+ * @ref nrf_802154_rssi_temperature_update.
  *
  * @returns RSSISAMPLE temperature correction value (Errata 153).
  */
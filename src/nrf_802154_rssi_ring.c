@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements streaming of RSSI samples to a ring buffer.
+ *
+ * The ring buffer has a single writer, the core sampling the RSSI, and a single reader, the higher
+ * layer. One entry of the ring is always left empty to tell a full ring from an empty one.
+ *
+ */
+
+#include "nrf_802154_rssi_ring.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_RSSI_STREAM_ENABLED
+
+static nrf_802154_rssi_sample_t * mp_samples;  ///< Memory of the ring buffer.
+static uint32_t                   m_count;     ///< Number of entries of the ring buffer.
+static uint32_t                   m_interval;  ///< Interval between the samples [us].
+static volatile uint32_t          m_write_idx; ///< Index at which the next sample is written.
+static volatile uint32_t          m_read_idx;  ///< Index of the first sample not read yet.
+static volatile uint32_t          m_dropped;   ///< Number of samples dropped due to lack of space.
+static volatile bool              m_enabled;   ///< If RSSI samples are streamed.
+
+bool nrf_802154_rssi_ring_start(nrf_802154_rssi_sample_t * p_samples,
+                                uint32_t                   count,
+                                uint32_t                   interval_us)
+{
+    if ((p_samples == NULL) || (count < 2U) || (interval_us == 0U))
+    {
+        return false;
+    }
+
+    m_enabled = false;
+    __DMB();
+
+    mp_samples  = p_samples;
+    m_count     = count;
+    m_interval  = interval_us;
+    m_write_idx = 0;
+    m_read_idx  = 0;
+    m_dropped   = 0;
+
+    __DMB();
+    m_enabled = true;
+
+    return true;
+}
+
+void nrf_802154_rssi_ring_stop(void)
+{
+    m_enabled = false;
+}
+
+bool nrf_802154_rssi_ring_is_enabled(void)
+{
+    return m_enabled;
+}
+
+uint32_t nrf_802154_rssi_ring_interval_get(void)
+{
+    return m_interval;
+}
+
+void nrf_802154_rssi_ring_sample_write(uint32_t time, int8_t rssi, uint8_t channel)
+{
+    uint32_t write_idx = m_write_idx;
+    uint32_t next_idx  = (write_idx + 1U < m_count) ? (write_idx + 1U) : 0U;
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    if (next_idx == m_read_idx)
+    {
+        m_dropped++;
+        return;
+    }
+
+    nrf_802154_rssi_sample_t * p_sample = &mp_samples[write_idx];
+
+    p_sample->time    = time;
+    p_sample->rssi    = rssi;
+    p_sample->channel = channel;
+
+    // Publish the sample after its content is written.
+    __DMB();
+    m_write_idx = next_idx;
+}
+
+uint32_t nrf_802154_rssi_ring_read(nrf_802154_rssi_sample_t * p_samples, uint32_t max_count)
+{
+    uint32_t read_idx  = m_read_idx;
+    uint32_t write_idx = m_write_idx;
+    uint32_t count     = 0;
+
+    __DMB();
+
+    while ((count < max_count) && (read_idx != write_idx))
+    {
+        p_samples[count++] = mp_samples[read_idx];
+        read_idx           = (read_idx + 1U < m_count) ? (read_idx + 1U) : 0U;
+    }
+
+    // Release the space after the samples are copied.
+    __DMB();
+    m_read_idx = read_idx;
+
+    return count;
+}
+
+uint32_t nrf_802154_rssi_ring_dropped_get(void)
+{
+    return m_dropped;
+}
+
+#endif // NRF_802154_RSSI_STREAM_ENABLED
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that streams RSSI samples to a ring buffer.
+ *
+ */
+
+#ifndef NRF_802154_RSSI_RING_H_
+#define NRF_802154_RSSI_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts streaming of RSSI samples to the given ring buffer.
+ *
+ * @param[in]  p_samples    Pointer to the memory to be used as the ring buffer.
+ * @param[in]  count        Number of samples that fit in the memory. The ring buffer holds
+ *                          up to @p count - 1 samples.
+ * @param[in]  interval_us  Interval between the RSSI samples in microseconds.
+ *
+ * @retval  true   Streaming started.
+ * @retval  false  The ring buffer cannot hold any sample or the interval is 0.
+ */
+bool nrf_802154_rssi_ring_start(nrf_802154_rssi_sample_t * p_samples,
+                                uint32_t                   count,
+                                uint32_t                   interval_us);
+
+/**
+ * @brief Stops streaming of RSSI samples.
+ *
+ * Samples already written to the ring buffer can still be read.
+ */
+void nrf_802154_rssi_ring_stop(void);
+
+/**
+ * @brief Checks if RSSI samples are being streamed.
+ *
+ * @retval  true   RSSI samples are streamed.
+ * @retval  false  RSSI streaming is stopped.
+ */
+bool nrf_802154_rssi_ring_is_enabled(void);
+
+/**
+ * @brief Gets the interval between the streamed RSSI samples.
+ *
+ * @returns  Interval in microseconds.
+ */
+uint32_t nrf_802154_rssi_ring_interval_get(void);
+
+/**
+ * @brief Writes an RSSI sample to the ring buffer.
+ *
+ * If the ring buffer is full, the sample is dropped.
+ *
+ * @param[in]  time     Time at which the RSSI was measured.
+ * @param[in]  rssi     Measured RSSI in dBm.
+ * @param[in]  channel  Channel the RSSI was measured on.
+ */
+void nrf_802154_rssi_ring_sample_write(uint32_t time, int8_t rssi, uint8_t channel);
+
+/**
+ * @brief Reads RSSI samples from the ring buffer.
+ *
+ * @param[out] p_samples  Pointer to the array the samples are copied to.
+ * @param[in]  max_count  Size of the @p p_samples array.
+ *
+ * @returns  Number of samples copied to @p p_samples.
+ */
+uint32_t nrf_802154_rssi_ring_read(nrf_802154_rssi_sample_t * p_samples, uint32_t max_count);
+
+/**
+ * @brief Gets the number of samples dropped because the ring buffer was full.
+ *
+ * @returns  Number of dropped samples since streaming started.
+ */
+uint32_t nrf_802154_rssi_ring_dropped_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_RSSI_RING_H_ */
@@ -37,33 +37,246 @@
 
 #include "nrf_802154_rx_buffer.h"
 
+#include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_ram_usage.h"
+#include "nrf_802154_utils.h"
 
 #if NRF_802154_RX_BUFFERS < 1
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
-rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
+#if (NRF_802154_RX_SMALL_BUFFERS > 0) && \
+    ((NRF_802154_RX_SMALL_BUFFER_SIZE < (IMM_ACK_LENGTH + PHR_SIZE)) || \
+    (NRF_802154_RX_SMALL_BUFFER_SIZE > MAX_PACKET_SIZE))
+#error NRF_802154_RX_SMALL_BUFFER_SIZE is out of range.
+#endif
 
-void nrf_802154_rx_buffer_init(void)
+/// Number of buffers tracked by a single word of the free buffers bitmap.
+#define FREE_MASK_WORD_BITS 32U
+
+/// Number of words in the free buffers bitmap.
+#define FREE_MASK_WORDS     NRF_802154_DIVIDE_AND_CEIL(NRF_802154_RX_BUFFERS, FREE_MASK_WORD_BITS)
+
+/// Receive buffers.
+rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS] NRF_802154_BUFFER_PLACEMENT;
+
+/// Bitmap of free buffers. Bit n of word w is set if buffer (w * 32 + n) is free.
+static volatile uint32_t m_free_mask[FREE_MASK_WORDS];
+
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+
+/// Number of words in the free small buffers bitmap.
+#define SMALL_FREE_MASK_WORDS NRF_802154_DIVIDE_AND_CEIL(NRF_802154_RX_SMALL_BUFFERS, \
+                                                         FREE_MASK_WORD_BITS)
+
+/// Storage of the small receive buffers.
+static uint8_t m_small_buffers[NRF_802154_RX_SMALL_BUFFERS][NRF_802154_RX_SMALL_BUFFER_SIZE]
+    NRF_802154_BUFFER_PLACEMENT;
+
+/// Bitmap of free small buffers. Layout is the same as in @ref m_free_mask.
+static volatile uint32_t m_small_free_mask[SMALL_FREE_MASK_WORDS];
+
+NRF_802154_RAM_USAGE_REPORT(rx_buffer,
+                            sizeof(nrf_802154_rx_buffers) + sizeof(m_free_mask) +
+                            sizeof(m_small_buffers) + sizeof(m_small_free_mask));
+
+#else
+
+NRF_802154_RAM_USAGE_REPORT(rx_buffer, sizeof(nrf_802154_rx_buffers) + sizeof(m_free_mask));
+
+#endif // NRF_802154_RX_SMALL_BUFFERS > 0
+
+/** Set bits of first @p count entries of the given bitmap and clear the rest. */
+static void mask_fill(volatile uint32_t * p_mask, uint32_t words, uint32_t count)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    for (uint32_t i = 0; i < words; i++)
     {
-        nrf_802154_rx_buffers[i].free = true;
+        uint32_t entries_left = count - (i * FREE_MASK_WORD_BITS);
+
+        p_mask[i] = (entries_left >= FREE_MASK_WORD_BITS) ?
+                    UINT32_MAX : ((1UL << entries_left) - 1UL);
     }
 }
 
+/** Set and clear bits of a word of a bitmap with a single exclusive store, from any context. */
+static void mask_word_update(volatile uint32_t * p_word, uint32_t set_bits, uint32_t clear_bits)
+{
+    uint32_t word;
+
+    do
+    {
+        word = __LDREXW(p_word);
+    }
+    while (__STREXW((word & ~clear_bits) | set_bits, p_word));
+}
+
+/** Get index of the given buffer in @ref nrf_802154_rx_buffers. */
+static inline uint32_t buffer_idx_get(const rx_buffer_t * p_buffer)
+{
+    uint32_t idx = (uint32_t)(p_buffer - nrf_802154_rx_buffers);
+
+    assert(idx < NRF_802154_RX_BUFFERS);
+
+    return idx;
+}
+
+void nrf_802154_rx_buffer_init(void)
+{
+    mask_fill(m_free_mask, FREE_MASK_WORDS, NRF_802154_RX_BUFFERS);
+
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+    mask_fill(m_small_free_mask, SMALL_FREE_MASK_WORDS, NRF_802154_RX_SMALL_BUFFERS);
+#endif
+}
+
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    for (uint32_t i = 0; i < FREE_MASK_WORDS; i++)
     {
-        if (nrf_802154_rx_buffers[i].free)
+        uint32_t mask = m_free_mask[i];
+
+        if (mask != 0U)
+        {
+            // Count trailing zeros to get the lowest free buffer in this word.
+            return &nrf_802154_rx_buffers[(i * FREE_MASK_WORD_BITS) + __CLZ(__RBIT(mask))];
+        }
+    }
+
+    return NULL;
+}
+
+rx_buffer_t * nrf_802154_rx_buffer_free_find_except(const rx_buffer_t * p_excluded)
+{
+    uint32_t excluded_word = FREE_MASK_WORDS;
+    uint32_t excluded_bit  = 0U;
+
+    if (p_excluded != NULL)
+    {
+        uint32_t idx = buffer_idx_get(p_excluded);
+
+        excluded_word = idx / FREE_MASK_WORD_BITS;
+        excluded_bit  = 1UL << (idx % FREE_MASK_WORD_BITS);
+    }
+
+    for (uint32_t i = 0; i < FREE_MASK_WORDS; i++)
+    {
+        uint32_t mask = m_free_mask[i];
+
+        if (i == excluded_word)
+        {
+            mask &= ~excluded_bit;
+        }
+
+        if (mask != 0U)
         {
-            return &nrf_802154_rx_buffers[i];
+            return &nrf_802154_rx_buffers[(i * FREE_MASK_WORD_BITS) + __CLZ(__RBIT(mask))];
         }
     }
 
     return NULL;
 }
+
+bool nrf_802154_rx_buffer_is_free(const rx_buffer_t * p_buffer)
+{
+    uint32_t idx = buffer_idx_get(p_buffer);
+
+    return (m_free_mask[idx / FREE_MASK_WORD_BITS] & (1UL << (idx % FREE_MASK_WORD_BITS))) != 0U;
+}
+
+void nrf_802154_rx_buffer_claim(rx_buffer_t * p_buffer)
+{
+    uint32_t idx = buffer_idx_get(p_buffer);
+
+    mask_word_update(&m_free_mask[idx / FREE_MASK_WORD_BITS],
+                     0U,
+                     1UL << (idx % FREE_MASK_WORD_BITS));
+}
+
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer)
+{
+    uint32_t idx = buffer_idx_get(p_buffer);
+
+    mask_word_update(&m_free_mask[idx / FREE_MASK_WORD_BITS],
+                     1UL << (idx % FREE_MASK_WORD_BITS),
+                     0U);
+}
+
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+
+/** Get index of the small buffer containing @p p_data. */
+static inline uint32_t small_buffer_idx_get(const uint8_t * p_data)
+{
+    uint32_t idx = (uint32_t)(p_data - &m_small_buffers[0][0]) / NRF_802154_RX_SMALL_BUFFER_SIZE;
+
+    assert(idx < NRF_802154_RX_SMALL_BUFFERS);
+    assert(p_data == m_small_buffers[idx]);
+
+    return idx;
+}
+
+bool nrf_802154_rx_buffer_is_small(const uint8_t * p_data)
+{
+    return (p_data >= &m_small_buffers[0][0]) &&
+           (p_data < &m_small_buffers[NRF_802154_RX_SMALL_BUFFERS][0]);
+}
+
+uint8_t * nrf_802154_rx_buffer_small_move(const rx_buffer_t * p_buffer)
+{
+    uint8_t   length = p_buffer->data[PHR_OFFSET] + PHR_SIZE;
+    uint8_t * p_data = NULL;
+
+    if (length > NRF_802154_RX_SMALL_BUFFER_SIZE)
+    {
+        return NULL;
+    }
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < SMALL_FREE_MASK_WORDS; i++)
+    {
+        uint32_t mask = m_small_free_mask[i];
+
+        if (mask != 0U)
+        {
+            uint32_t bit = __CLZ(__RBIT(mask));
+
+            m_small_free_mask[i] = mask & ~(1UL << bit);
+            p_data               = m_small_buffers[(i * FREE_MASK_WORD_BITS) + bit];
+            break;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (p_data != NULL)
+    {
+        memcpy(p_data, p_buffer->data, length);
+    }
+
+    return p_data;
+}
+
+bool nrf_802154_rx_buffer_small_is_free(const uint8_t * p_data)
+{
+    uint32_t idx = small_buffer_idx_get(p_data);
+
+    return (m_small_free_mask[idx / FREE_MASK_WORD_BITS] &
+            (1UL << (idx % FREE_MASK_WORD_BITS))) != 0U;
+}
+
+void nrf_802154_rx_buffer_small_release(uint8_t * p_data)
+{
+    uint32_t idx = small_buffer_idx_get(p_data);
+
+    mask_word_update(&m_small_free_mask[idx / FREE_MASK_WORD_BITS],
+                     1UL << (idx % FREE_MASK_WORD_BITS),
+                     0U);
+}
+
+#endif // NRF_802154_RX_SMALL_BUFFERS > 0
@@ -40,6 +40,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
 #ifdef __cplusplus
@@ -48,11 +49,13 @@ extern "C" {
 
 /**
  * @brief Structure that contains the received frame.
+ *
+ * Whether the buffer is free or contains a frame is tracked by the bitmap kept by this module.
+ * Use @ref nrf_802154_rx_buffer_is_free to check it.
  */
 typedef struct
 {
     uint8_t data[MAX_PACKET_SIZE + 1];
-    bool    free; // If this buffer is free or contains a frame.
 } rx_buffer_t;
 
 /**
@@ -76,6 +79,90 @@ void nrf_802154_rx_buffer_init(void);
  */
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
 
+/**
+ * @brief Gets a free buffer to receive a frame, other than the given one.
+ *
+ * @param[in]  p_excluded  Pointer to a buffer from @ref nrf_802154_rx_buffers that is not to be
+ *                         returned, or NULL.
+ *
+ * @returns  Pointer to a free buffer, or NULL if no other free buffer is available.
+ */
+rx_buffer_t * nrf_802154_rx_buffer_free_find_except(const rx_buffer_t * p_excluded);
+
+/**
+ * @brief Checks if the given buffer is free.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer from @ref nrf_802154_rx_buffers.
+ *
+ * @retval  true   The buffer is free and can be used to receive a frame.
+ * @retval  false  The buffer contains a frame that has not been freed yet.
+ */
+bool nrf_802154_rx_buffer_is_free(const rx_buffer_t * p_buffer);
+
+/**
+ * @brief Marks the given buffer as containing a frame.
+ *
+ * The buffer is not returned by @ref nrf_802154_rx_buffer_free_find until it is released
+ * with @ref nrf_802154_rx_buffer_release.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer from @ref nrf_802154_rx_buffers.
+ */
+void nrf_802154_rx_buffer_claim(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Marks the given buffer as free.
+ *
+ * The buffer is released with a single exclusive store, so this function can be called from
+ * any context without a critical section.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer from @ref nrf_802154_rx_buffers.
+ */
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer);
+
+#if NRF_802154_RX_SMALL_BUFFERS > 0
+
+/**
+ * @brief Checks if the given pointer points to a small receive buffer.
+ *
+ * @param[in]  p_data  Pointer to a received frame (PHR + PSDU).
+ *
+ * @retval  true   @p p_data points to a small buffer.
+ * @retval  false  @p p_data points to a buffer from @ref nrf_802154_rx_buffers.
+ */
+bool nrf_802154_rx_buffer_is_small(const uint8_t * p_data);
+
+/**
+ * @brief Moves the frame from the given buffer to a free small buffer.
+ *
+ * The frame is moved only if it fits in @ref NRF_802154_RX_SMALL_BUFFER_SIZE bytes and a small
+ * buffer is available. The buffer @p p_buffer is left free, so it can be used to receive
+ * the next frame immediately.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer from @ref nrf_802154_rx_buffers containing a frame.
+ *
+ * @returns  Pointer to the small buffer containing the frame, or NULL if the frame was not moved.
+ */
+uint8_t * nrf_802154_rx_buffer_small_move(const rx_buffer_t * p_buffer);
+
+/**
+ * @brief Checks if the given small buffer is free.
+ *
+ * @param[in]  p_data  Pointer to a small buffer.
+ *
+ * @retval  true   The small buffer is free.
+ * @retval  false  The small buffer contains a frame that has not been freed yet.
+ */
+bool nrf_802154_rx_buffer_small_is_free(const uint8_t * p_data);
+
+/**
+ * @brief Marks the given small buffer as free.
+ *
+ * @param[in]  p_data  Pointer to a small buffer.
+ */
+void nrf_802154_rx_buffer_small_release(uint8_t * p_data);
+
+#endif // NRF_802154_RX_SMALL_BUFFERS > 0
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,13 +29,51 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154.h"
 #include "nrf_802154_stats.h"
+#if NRF_802154_LATENCY_STATS_ENABLED || NRF_802154_COEX_STATS_ENABLED || \
+    NRF_802154_ANT_DIV_STATS_ENABLED
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#include "rsch/nrf_802154_rsch.h"
+#endif
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+#include "nrf_802154_sl_ant_div.h"
+#endif
+
+#if NRF_802154_COEX_STATS_ENABLED
+#include "nrf_802154_core.h"
+#include "rsch/coex/nrf_802154_wifi_coex.h"
+#endif
+
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+#include "platform/lp_timer/nrf_802154_lp_timer.h"
+#endif
 
 #define NUMBER_OF_STAT_COUNTERS (sizeof(nrf_802154_stat_counters_t) / sizeof(uint32_t))
 #define NUMBER_OF_STAT_TOTALS   (sizeof(nrf_802154_stat_totals_t) / sizeof(uint64_t))
+#define NUMBER_OF_STAT_CSMA_HISTOGRAM_COUNTERS \
+    (sizeof(nrf_802154_stat_csma_histogram_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_QUEUES_COUNTERS \
+    (sizeof(nrf_802154_stat_queues_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_CRIT_SECT_COUNTERS \
+    (sizeof(nrf_802154_stat_crit_sect_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_CHANNELS_COUNTERS \
+    (sizeof(nrf_802154_stat_channels_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_LATENCY_HISTOGRAM_COUNTERS \
+    (sizeof(nrf_802154_stat_latency_histogram_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_IRQ_CYCLES_COUNTERS \
+    (sizeof(nrf_802154_stat_irq_cycles_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_OCCUPANCY_COUNTERS \
+    (sizeof(nrf_802154_stat_occupancy_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_COEX_COUNTERS \
+    (sizeof(nrf_802154_stat_coex_t) / sizeof(uint32_t))
+#define NUMBER_OF_STAT_ANT_DIV_COUNTERS \
+    (sizeof(nrf_802154_stat_ant_div_t) / sizeof(uint32_t))
 
 /**@brief Structure holding statistics about the Radio Driver behavior. */
 volatile nrf_802154_stats_t g_nrf_802154_stats;
@@ -43,6 +81,76 @@ volatile nrf_802154_stats_t g_nrf_802154_stats;
 /**@brief Structure holding total times spent in certain states. */
 volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
 
+/**@brief Sequence number of the updates of the statistics and the total times.
+ *
+ * The writers increment it before they modify the statistics. The statistics are written only
+ * from interrupts preempting the reader, so an unchanged sequence number after copying them
+ * proves that no write happened in the meantime.
+ */
+volatile uint32_t g_nrf_802154_stats_sequence;
+
+/**@brief Structure holding histograms of the CSMA-CA procedure. */
+volatile nrf_802154_stat_csma_histogram_t g_nrf_802154_stat_csma_histogram;
+
+/**@brief Structure holding statistics of the notification and request queues. */
+volatile nrf_802154_stat_queues_t g_nrf_802154_stat_queues;
+
+/**@brief Structure holding hold times of the critical section. */
+volatile nrf_802154_stat_crit_sect_t g_nrf_802154_stat_crit_sect;
+
+/**@brief Structure holding statistic counters of each channel. */
+volatile nrf_802154_stat_channels_t g_nrf_802154_stat_channels;
+
+/**@brief Structure holding latency histograms of notifications and requests. */
+volatile nrf_802154_stat_latency_histogram_t g_nrf_802154_stat_latency_histogram;
+
+/**@brief Structure holding execution times of the RADIO interrupt handler. */
+volatile nrf_802154_stat_irq_cycles_t g_nrf_802154_stat_irq_cycles;
+
+/**@brief Structure holding histograms of the power sampled on idle channels. */
+volatile nrf_802154_stat_occupancy_t g_nrf_802154_stat_occupancy;
+
+/**@brief Structure holding statistics of the access to the medium granted by the PTA. */
+volatile nrf_802154_stat_coex_t g_nrf_802154_stat_coex;
+
+/**@brief Structure holding statistics of the antenna diversity in the receive operations. */
+volatile nrf_802154_stat_ant_div_t g_nrf_802154_stat_ant_div;
+
+/**@brief Structure holding statistics of the timeslots granted by the radio scheduler. */
+static nrf_802154_stat_timeslot_t m_stat_timeslot;
+
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+/// Log of the timeslot events, overwritten from the oldest one when full.
+static nrf_802154_stat_timeslot_event_t m_timeslot_log[NRF_802154_TIMESLOT_STATS_LOG_SIZE];
+/// Index of the oldest event in the log.
+static uint32_t m_timeslot_log_first;
+/// Number of events in the log.
+static uint32_t m_timeslot_log_count;
+/// Time of the last revocation, or 0 if the timeslot is granted or was released.
+static uint64_t m_timeslot_revoked_time;
+#endif
+
+#if NRF_802154_COEX_STATS_ENABLED
+/// Operation requested from the PTA.
+static nrf_802154_stat_coex_operation_t m_coex_operation;
+/// Time of the request waiting for the grant.
+static uint32_t m_coex_request_time = NRF_802154_STAT_LATENCY_NO_START;
+/// If the access requested from the PTA is granted.
+static bool m_coex_granted;
+#endif
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+/// Time of the detection of the preamble for which the antenna is being selected.
+static uint32_t m_ant_div_preamble_time = NRF_802154_STAT_LATENCY_NO_START;
+/// Antenna selected for the last received frame.
+static uint8_t m_ant_div_last_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+#endif
+
+#if NRF_802154_LATENCY_STATS_ENABLED
+/// Start times of the latencies marked with @ref nrf_802154_stat_latency_start_mark.
+static volatile uint32_t m_latency_marks[NRF_802154_STAT_LATENCY_COUNT];
+#endif
+
 void nrf_802154_stats_get(nrf_802154_stats_t * p_stats)
 {
     *p_stats = g_nrf_802154_stats;
@@ -63,6 +171,7 @@ void nrf_802154_stat_counters_subtract(const nrf_802154_stat_counters_t * p_stat
         nrf_802154_mcu_critical_state_t mcu_cs;
 
         nrf_802154_mcu_critical_enter(mcu_cs);
+        g_nrf_802154_stats_sequence++;
         *p_dst -= *p_src;
         nrf_802154_mcu_critical_exit(mcu_cs);
 
@@ -80,6 +189,8 @@ void nrf_802154_stat_counters_reset(void)
 {
     volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stats.counters);
 
+    g_nrf_802154_stats_sequence++;
+
     for (size_t i = 0; i < NUMBER_OF_STAT_COUNTERS; ++i)
     {
         *(p_dst++) = 0U;
@@ -106,6 +217,709 @@ void nrf_802154_stat_totals_get(nrf_802154_stat_totals_t * p_stat_totals)
     }
 }
 
+void nrf_802154_stat_snapshot_get(nrf_802154_stat_snapshot_t * p_snapshot)
+{
+    uint32_t sequence;
+
+    nrf_802154_stat_totals_get_notify();
+
+    do
+    {
+        sequence = g_nrf_802154_stats_sequence;
+
+        p_snapshot->stats  = g_nrf_802154_stats;
+        p_snapshot->totals = g_nrf_802154_stat_totals;
+    }
+    while (sequence != g_nrf_802154_stats_sequence);
+}
+
+void nrf_802154_stat_csma_histogram_get(nrf_802154_stat_csma_histogram_t * p_histogram)
+{
+    uint32_t                * p_dst = (uint32_t *)p_histogram;
+    const volatile uint32_t * p_src =
+        (const volatile uint32_t *)(&g_nrf_802154_stat_csma_histogram);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_CSMA_HISTOGRAM_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_csma_histogram_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_csma_histogram);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_CSMA_HISTOGRAM_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_queues_get(nrf_802154_stat_queues_t * p_stat_queues)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_queues;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_queues);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_QUEUES_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_queues_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_queues);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_QUEUES_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_crit_sect_get(nrf_802154_stat_crit_sect_t * p_stat_crit_sect)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_crit_sect;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_crit_sect);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_CRIT_SECT_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_crit_sect_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_crit_sect);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_CRIT_SECT_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_channels_get(nrf_802154_stat_channels_t * p_stat_channels)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_channels;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_channels);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_CHANNELS_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_channels_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_channels);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_CHANNELS_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_latency_histogram_get(nrf_802154_stat_latency_histogram_t * p_histogram)
+{
+    uint32_t                * p_dst = (uint32_t *)p_histogram;
+    const volatile uint32_t * p_src =
+        (const volatile uint32_t *)(&g_nrf_802154_stat_latency_histogram);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_LATENCY_HISTOGRAM_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_latency_histogram_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_latency_histogram);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_LATENCY_HISTOGRAM_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_irq_cycles_get(nrf_802154_stat_irq_cycles_t * p_stat_irq_cycles)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_irq_cycles;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_irq_cycles);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_IRQ_CYCLES_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_irq_cycles_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_irq_cycles);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_IRQ_CYCLES_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_occupancy_get(nrf_802154_stat_occupancy_t * p_stat_occupancy)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_occupancy;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_occupancy);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_OCCUPANCY_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_occupancy_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_occupancy);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_OCCUPANCY_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_coex_get(nrf_802154_stat_coex_t * p_stat_coex)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_coex;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_coex);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_COEX_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_coex_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_coex);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_COEX_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_ant_div_get(nrf_802154_stat_ant_div_t * p_stat_ant_div)
+{
+    uint32_t                * p_dst = (uint32_t *)p_stat_ant_div;
+    const volatile uint32_t * p_src = (const volatile uint32_t *)(&g_nrf_802154_stat_ant_div);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_ANT_DIV_COUNTERS; ++i)
+    {
+        *(p_dst++) = *(p_src++);
+    }
+}
+
+void nrf_802154_stat_ant_div_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stat_ant_div);
+
+    for (size_t i = 0; i < NUMBER_OF_STAT_ANT_DIV_COUNTERS; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
+void nrf_802154_stat_timeslot_get(nrf_802154_stat_timeslot_t * p_stat_timeslot)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    *p_stat_timeslot = m_stat_timeslot;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_timeslot_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    memset(&m_stat_timeslot, 0, sizeof(m_stat_timeslot));
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+uint32_t nrf_802154_stat_timeslot_log_read(nrf_802154_stat_timeslot_event_t * p_events,
+                                           uint32_t                           max_count)
+{
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+    uint32_t                        count = 0U;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    while ((count < max_count) && (m_timeslot_log_count > 0U))
+    {
+        p_events[count++]    = m_timeslot_log[m_timeslot_log_first];
+        m_timeslot_log_first = (m_timeslot_log_first + 1U) % NRF_802154_TIMESLOT_STATS_LOG_SIZE;
+        m_timeslot_log_count--;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return count;
+#else
+    (void)p_events;
+    (void)max_count;
+
+    return 0U;
+#endif
+}
+
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+
+/** Add an event to the timeslot log. Must be called in a critical section. */
+static void timeslot_log_add(uint64_t                              time,
+                             nrf_802154_stat_timeslot_event_type_t type,
+                             nrf_802154_stat_timeslot_op_t         op)
+{
+    uint32_t idx = (m_timeslot_log_first + m_timeslot_log_count) %
+                   NRF_802154_TIMESLOT_STATS_LOG_SIZE;
+
+    m_timeslot_log[idx].time = time;
+    m_timeslot_log[idx].type = type;
+    m_timeslot_log[idx].op   = op;
+
+    if (m_timeslot_log_count < NRF_802154_TIMESLOT_STATS_LOG_SIZE)
+    {
+        m_timeslot_log_count++;
+    }
+    else
+    {
+        m_timeslot_log_first = (m_timeslot_log_first + 1U) % NRF_802154_TIMESLOT_STATS_LOG_SIZE;
+    }
+}
+
+void nrf_802154_stat_timeslot_granted(void)
+{
+    uint64_t                        now = nrf_802154_lp_timer_time64_get();
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_stat_timeslot.grants++;
+
+    if (m_timeslot_revoked_time != 0U)
+    {
+        uint64_t lost_time = now - m_timeslot_revoked_time;
+
+        m_stat_timeslot.total_lost_time += lost_time;
+
+        if (lost_time > m_stat_timeslot.max_lost_time)
+        {
+            m_stat_timeslot.max_lost_time = (lost_time > UINT32_MAX) ?
+                                            UINT32_MAX : (uint32_t)lost_time;
+        }
+
+        m_timeslot_revoked_time = 0U;
+    }
+
+    timeslot_log_add(now, NRF_802154_STAT_TIMESLOT_EVENT_GRANTED, NRF_802154_STAT_TIMESLOT_OP_NONE);
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_timeslot_ended(bool revoked, nrf_802154_stat_timeslot_op_t op)
+{
+    uint64_t                        now = nrf_802154_lp_timer_time64_get();
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (revoked)
+    {
+        m_stat_timeslot.revocations++;
+        m_stat_timeslot.aborted_ops[op]++;
+        m_timeslot_revoked_time = now;
+
+        timeslot_log_add(now, NRF_802154_STAT_TIMESLOT_EVENT_REVOKED, op);
+    }
+    else
+    {
+        timeslot_log_add(now, NRF_802154_STAT_TIMESLOT_EVENT_RELEASED, op);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_TIMESLOT_STATS_ENABLED
+
+#if NRF_802154_COEX_STATS_ENABLED
+
+/** Add the time elapsed since the request to the grant latency histogram of its operation. */
+static void coex_grant_latency_record(uint32_t time)
+{
+    uint32_t                        bucket = nrf_802154_stat_latency_bucket_get(time);
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    g_nrf_802154_stat_coex.grant_latency[m_coex_operation][bucket]++;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_wifi_coex_request_changed(
+    nrf_802154_wifi_coex_request_state_t curr_request_state,
+    nrf_802154_wifi_coex_request_state_t prev_request_state,
+    bool                                 grant_state)
+{
+    (void)prev_request_state;
+
+    m_coex_request_time = NRF_802154_STAT_LATENCY_NO_START;
+    m_coex_granted      = grant_state;
+
+    switch (curr_request_state)
+    {
+        case WIFI_COEX_REQUEST_STATE_RX:
+            m_coex_operation = NRF_802154_STAT_COEX_RX;
+            break;
+
+        case WIFI_COEX_REQUEST_STATE_TX:
+            m_coex_operation = (nrf_802154_core_state_get() == RADIO_STATE_TX_ACK) ?
+                               NRF_802154_STAT_COEX_ACK : NRF_802154_STAT_COEX_TX;
+            break;
+
+        default:
+            m_coex_granted = false;
+            return;
+    }
+
+    if (grant_state)
+    {
+        // The medium is already granted, so the request does not wait for the PTA.
+        coex_grant_latency_record(0U);
+    }
+    else
+    {
+        m_coex_request_time = nrf_802154_stat_latency_start_get();
+    }
+}
+
+void nrf_802154_wifi_coex_granted(nrf_802154_wifi_coex_request_state_t curr_request_state)
+{
+    uint32_t now = nrf_802154_stat_latency_start_get();
+
+    (void)curr_request_state;
+
+    if ((m_coex_request_time != NRF_802154_STAT_LATENCY_NO_START) &&
+        (now != NRF_802154_STAT_LATENCY_NO_START))
+    {
+        coex_grant_latency_record(now - m_coex_request_time);
+    }
+
+    m_coex_request_time = NRF_802154_STAT_LATENCY_NO_START;
+    m_coex_granted      = true;
+}
+
+void nrf_802154_wifi_coex_denied(nrf_802154_wifi_coex_request_state_t curr_request_state)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (curr_request_state == WIFI_COEX_REQUEST_STATE_NO_REQUEST)
+    {
+        return;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    g_nrf_802154_stat_coex.denials[m_coex_operation]++;
+
+    if (m_coex_granted)
+    {
+        g_nrf_802154_stat_coex.revoked_grants[m_coex_operation]++;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    // The request is still signaled, so the next grant is counted from now.
+    m_coex_granted      = false;
+    m_coex_request_time = nrf_802154_stat_latency_start_get();
+}
+
+#endif // NRF_802154_COEX_STATS_ENABLED
+
+#if NRF_802154_OCCUPANCY_MONITOR_ENABLED || NRF_802154_ANT_DIV_STATS_ENABLED
+
+/** Get the bin of a power histogram for the given power. */
+static int32_t power_bin_get(int8_t power)
+{
+    int32_t bin = 0;
+
+    if (power >= NRF_802154_STAT_OCCUPANCY_BIN_FIRST_DBM)
+    {
+        bin = ((power - NRF_802154_STAT_OCCUPANCY_BIN_FIRST_DBM) /
+               NRF_802154_STAT_OCCUPANCY_BIN_WIDTH_DB) + 1;
+
+        if (bin >= NRF_802154_STAT_OCCUPANCY_BINS)
+        {
+            bin = NRF_802154_STAT_OCCUPANCY_BINS - 1;
+        }
+    }
+
+    return bin;
+}
+
+#endif // NRF_802154_OCCUPANCY_MONITOR_ENABLED || NRF_802154_ANT_DIV_STATS_ENABLED
+
+#if NRF_802154_OCCUPANCY_MONITOR_ENABLED
+
+void nrf_802154_stat_occupancy_sample_add(uint8_t channel, int8_t power)
+{
+    uint32_t ch_idx = (uint32_t)channel - NRF_802154_STAT_CHANNEL_FIRST;
+
+    if (ch_idx >= NRF_802154_STAT_CHANNELS)
+    {
+        return;
+    }
+
+    int32_t                         bin = power_bin_get(power);
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    g_nrf_802154_stat_occupancy.channels[ch_idx][bin]++;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_OCCUPANCY_MONITOR_ENABLED
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+
+void nrf_802154_stat_ant_div_preamble_detected(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    m_ant_div_preamble_time = nrf_802154_stat_latency_start_get();
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    g_nrf_802154_stat_ant_div.preambles_detected++;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_ant_div_frame_started(void)
+{
+    uint32_t now = nrf_802154_stat_latency_start_get();
+
+    if ((m_ant_div_preamble_time != NRF_802154_STAT_LATENCY_NO_START) &&
+        (now != NRF_802154_STAT_LATENCY_NO_START))
+    {
+        uint32_t                        bucket =
+            nrf_802154_stat_latency_bucket_get(now - m_ant_div_preamble_time);
+        nrf_802154_mcu_critical_state_t mcu_cs;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+        g_nrf_802154_stat_ant_div.decision_latency[bucket]++;
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+
+    m_ant_div_preamble_time = NRF_802154_STAT_LATENCY_NO_START;
+}
+
+void nrf_802154_stat_ant_div_decision_late(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    m_ant_div_preamble_time = NRF_802154_STAT_LATENCY_NO_START;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    g_nrf_802154_stat_ant_div.decisions_late++;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_ant_div_frame_received(uint8_t antenna, int8_t power)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (antenna >= NRF_802154_STAT_ANT_DIV_ANTENNAS)
+    {
+        return;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    g_nrf_802154_stat_ant_div.rssi[antenna][power_bin_get(power)]++;
+
+    if ((m_ant_div_last_antenna != NRF_802154_SL_ANT_DIV_ANTENNA_NONE) &&
+        (m_ant_div_last_antenna != antenna))
+    {
+        g_nrf_802154_stat_ant_div.antenna_changes++;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    m_ant_div_last_antenna = antenna;
+}
+
+#endif // NRF_802154_ANT_DIV_STATS_ENABLED
+
+#if NRF_802154_IRQ_PROFILER_ENABLED
+
+void nrf_802154_stat_irq_cycles_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT       = 0U;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void nrf_802154_stat_irq_cycles_record(nrf_802154_stat_irq_cycles_item_t item,
+                                       uint32_t                          start_cycles)
+{
+    uint32_t                                      cycles  = DWT->CYCCNT - start_cycles;
+    volatile nrf_802154_stat_irq_cycles_entry_t * p_entry =
+        &g_nrf_802154_stat_irq_cycles.items[item];
+    nrf_802154_mcu_critical_state_t               mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if ((p_entry->count == 0U) || (cycles < p_entry->min_cycles))
+    {
+        p_entry->min_cycles = cycles;
+    }
+
+    if (cycles > p_entry->max_cycles)
+    {
+        p_entry->max_cycles = cycles;
+    }
+
+    p_entry->count++;
+    p_entry->total_cycles += cycles;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_IRQ_PROFILER_ENABLED
+
+uint32_t nrf_802154_stat_tx_power_level_get(int8_t power)
+{
+    int32_t level = ((int32_t)power - NRF_802154_STAT_TX_POWER_LEVEL_MIN) /
+                    NRF_802154_STAT_TX_POWER_LEVEL_STEP;
+
+    if (level < 0)
+    {
+        level = 0;
+    }
+    else if (level >= NRF_802154_STAT_TX_POWER_LEVELS)
+    {
+        level = NRF_802154_STAT_TX_POWER_LEVELS - 1;
+    }
+
+    return (uint32_t)level;
+}
+
+#if NRF_802154_ENERGY_MODEL_ENABLED
+
+/// Number of microampere-microseconds in a nanoampere-hour.
+#define UA_US_PER_NAH 3600000ULL
+
+void nrf_802154_stat_charge_get(nrf_802154_stat_charge_t * p_charge)
+{
+    static const uint32_t tx_currents[NRF_802154_STAT_TX_POWER_LEVELS] =
+        NRF_802154_ENERGY_TX_CURRENTS;
+
+    nrf_802154_stat_totals_t totals;
+    uint64_t                 tx = 0U;
+
+    nrf_802154_stat_totals_get(&totals);
+
+    for (uint32_t i = 0; i < NRF_802154_STAT_TX_POWER_LEVELS; i++)
+    {
+        tx += totals.total_transmit_time_per_power[i] * tx_currents[i];
+    }
+
+    p_charge->rx = ((totals.total_listening_time + totals.total_receive_time) *
+                    NRF_802154_ENERGY_RX_CURRENT) / UA_US_PER_NAH;
+    p_charge->tx   = tx / UA_US_PER_NAH;
+    p_charge->fem  = ((totals.total_lna_time * NRF_802154_ENERGY_LNA_CURRENT) +
+                      (totals.total_pa_time * NRF_802154_ENERGY_PA_CURRENT)) / UA_US_PER_NAH;
+    p_charge->hfxo = (totals.total_hfxo_time * NRF_802154_ENERGY_HFXO_CURRENT) / UA_US_PER_NAH;
+
+    p_charge->total = p_charge->rx + p_charge->tx + p_charge->fem + p_charge->hfxo;
+}
+
+#endif // NRF_802154_ENERGY_MODEL_ENABLED
+
+uint32_t nrf_802154_stat_latency_bucket_get(uint32_t time)
+{
+    uint32_t bucket = 0U;
+
+    while ((time >= NRF_802154_STAT_LATENCY_BUCKET_BASE_US) &&
+           (bucket < (NRF_802154_STAT_LATENCY_BUCKETS - 1U)))
+    {
+        time /= 2U;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+#if NRF_802154_LATENCY_STATS_ENABLED || NRF_802154_COEX_STATS_ENABLED || \
+    NRF_802154_ANT_DIV_STATS_ENABLED
+
+uint32_t nrf_802154_stat_latency_start_get(void)
+{
+    // The high precision timer runs only while the timeslot is granted.
+    if (!nrf_802154_rsch_prec_is_approved(RSCH_PREC_RAAL, RSCH_PRIO_MIN_APPROVED))
+    {
+        return NRF_802154_STAT_LATENCY_NO_START;
+    }
+
+    return nrf_802154_hp_timer_current_time_get();
+}
+
+#endif // NRF_802154_LATENCY_STATS_ENABLED || NRF_802154_COEX_STATS_ENABLED ||
+       // NRF_802154_ANT_DIV_STATS_ENABLED
+
+#if NRF_802154_LATENCY_STATS_ENABLED
+
+void nrf_802154_stat_latency_start_mark(nrf_802154_stat_latency_t latency)
+{
+    m_latency_marks[latency] = nrf_802154_stat_latency_start_get();
+}
+
+uint32_t nrf_802154_stat_latency_mark_get(nrf_802154_stat_latency_t latency)
+{
+    return m_latency_marks[latency];
+}
+
+void nrf_802154_stat_latency_record(nrf_802154_stat_latency_t latency, uint32_t start_time)
+{
+    volatile uint32_t             * p_histogram;
+    uint32_t                        end_time = nrf_802154_stat_latency_start_get();
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if ((start_time == NRF_802154_STAT_LATENCY_NO_START) ||
+        (end_time == NRF_802154_STAT_LATENCY_NO_START))
+    {
+        return;
+    }
+
+    switch (latency)
+    {
+        case NRF_802154_STAT_LATENCY_RX_DELIVERY:
+            p_histogram = g_nrf_802154_stat_latency_histogram.rx_delivery;
+            break;
+
+        case NRF_802154_STAT_LATENCY_TX_COMPLETION:
+            p_histogram = g_nrf_802154_stat_latency_histogram.tx_completion;
+            break;
+
+        case NRF_802154_STAT_LATENCY_REQUEST_SERVICING:
+            p_histogram = g_nrf_802154_stat_latency_histogram.request_servicing;
+            break;
+
+        default:
+            assert(false);
+            return;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    p_histogram[nrf_802154_stat_latency_bucket_get(end_time - start_time)]++;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_LATENCY_STATS_ENABLED
+
 __WEAK void nrf_802154_stat_totals_get_notify(void)
 {
     /* Implementation here is intentionally empty.
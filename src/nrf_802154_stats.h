@@ -35,26 +35,185 @@
 #include "nrf_802154_types.h"
 #include "nrf_802154_utils.h"
 
+/**@brief Get the bucket of a latency histogram for the given time.
+ *
+ * @param time  Time in microseconds.
+ *
+ * @return Index of the bucket, lower than @ref NRF_802154_STAT_LATENCY_BUCKETS.
+ */
+uint32_t nrf_802154_stat_latency_bucket_get(uint32_t time);
+
+/**@brief Get the level of @ref nrf_802154_stat_totals_t::total_transmit_time_per_power for
+ *        the given transmit power.
+ *
+ * @param power  Transmit power in dBm.
+ *
+ * @return Index of the level, lower than @ref NRF_802154_STAT_TX_POWER_LEVELS.
+ */
+uint32_t nrf_802154_stat_tx_power_level_get(int8_t power);
+
+#if NRF_802154_LATENCY_STATS_ENABLED || NRF_802154_COEX_STATS_ENABLED || \
+    NRF_802154_ANT_DIV_STATS_ENABLED
+
+/**@brief Start time returned while the latency cannot be measured. */
+#define NRF_802154_STAT_LATENCY_NO_START UINT32_MAX
+
+/**@brief Get the start time of a latency.
+ *
+ * @return Current time, or @ref NRF_802154_STAT_LATENCY_NO_START if the high precision timer
+ *         is not running.
+ */
+uint32_t nrf_802154_stat_latency_start_get(void);
+
+#endif // NRF_802154_LATENCY_STATS_ENABLED || NRF_802154_COEX_STATS_ENABLED ||
+       // NRF_802154_ANT_DIV_STATS_ENABLED
+
+#if NRF_802154_LATENCY_STATS_ENABLED
+
+/**@brief Latencies tracked by @ref nrf_802154_stat_latency_histogram_t. */
+typedef enum
+{
+    NRF_802154_STAT_LATENCY_RX_DELIVERY,       ///< Received frame end to its notification.
+    NRF_802154_STAT_LATENCY_TX_COMPLETION,     ///< Transmission end to its notification.
+    NRF_802154_STAT_LATENCY_REQUEST_SERVICING, ///< Request call to its handling by the core.
+    NRF_802154_STAT_LATENCY_COUNT,             ///< Number of tracked latencies.
+} nrf_802154_stat_latency_t;
+
+/**@brief Store the current time as the start of the given latency.
+ *
+ * The stored time is retrieved with @ref nrf_802154_stat_latency_mark_get by the module that
+ * finishes the latency, for example the notification module.
+ */
+void nrf_802154_stat_latency_start_mark(nrf_802154_stat_latency_t latency);
+
+/**@brief Get the start time stored by @ref nrf_802154_stat_latency_start_mark. */
+uint32_t nrf_802154_stat_latency_mark_get(nrf_802154_stat_latency_t latency);
+
+/**@brief Add the time elapsed since @p start_time to the histogram of the given latency.
+ *
+ * Nothing is added if any of the ends of the latency was not measured.
+ */
+void nrf_802154_stat_latency_record(nrf_802154_stat_latency_t latency, uint32_t start_time);
+
+#endif // NRF_802154_LATENCY_STATS_ENABLED
+
+#if NRF_802154_IRQ_PROFILER_ENABLED
+
+/**@brief Start the DWT cycle counter used to measure the RADIO interrupt handler. */
+void nrf_802154_stat_irq_cycles_init(void);
+
+/**@brief Get the start of an execution time measured with @ref nrf_802154_stat_irq_cycles_record. */
+#define nrf_802154_stat_irq_cycles_start() (DWT->CYCCNT)
+
+/**@brief Add the number of cycles elapsed since @p start_cycles to the given item of the profile.
+ *
+ * @param item          Item of the profile, one of @ref nrf_802154_stat_irq_cycles_item_t values
+ * @param start_cycles  Value returned by @ref nrf_802154_stat_irq_cycles_start
+ */
+void nrf_802154_stat_irq_cycles_record(nrf_802154_stat_irq_cycles_item_t item,
+                                       uint32_t                          start_cycles);
+
+#else // NRF_802154_IRQ_PROFILER_ENABLED
+
+#define nrf_802154_stat_irq_cycles_start() 0U
+
+#define nrf_802154_stat_irq_cycles_record(item, start_cycles) \
+    do                                                        \
+    {                                                         \
+        (void)(start_cycles);                                 \
+    }                                                         \
+    while (0)
+
+#endif // NRF_802154_IRQ_PROFILER_ENABLED
+
+#if NRF_802154_TIMESLOT_STATS_ENABLED
+
+/**@brief Count a timeslot granted by the radio scheduler. */
+void nrf_802154_stat_timeslot_granted(void);
+
+/**@brief Count the end of a timeslot.
+ *
+ * @param revoked  If the timeslot was revoked, or released because the driver went to sleep.
+ * @param op       Operation aborted by the end of the timeslot.
+ */
+void nrf_802154_stat_timeslot_ended(bool revoked, nrf_802154_stat_timeslot_op_t op);
+
+#endif // NRF_802154_TIMESLOT_STATS_ENABLED
+
+#if NRF_802154_OCCUPANCY_MONITOR_ENABLED
+
+/**@brief Add a power sample of an idle channel to its occupancy histogram.
+ *
+ * @param channel  Channel the power was sampled on (11-26)
+ * @param power    Sampled power [dBm]
+ */
+void nrf_802154_stat_occupancy_sample_add(uint8_t channel, int8_t power);
+
+#endif // NRF_802154_OCCUPANCY_MONITOR_ENABLED
+
+#if NRF_802154_ANT_DIV_STATS_ENABLED
+
+/**@brief Count a possible preamble that started the antenna selection. */
+void nrf_802154_stat_ant_div_preamble_detected(void);
+
+/**@brief Count the start of a frame after the antenna selection. */
+void nrf_802154_stat_ant_div_frame_started(void);
+
+/**@brief Count an antenna selection not followed by a frame. */
+void nrf_802154_stat_ant_div_decision_late(void);
+
+/**@brief Add a received frame to the statistics of the antenna selected for it.
+ *
+ * @param antenna  Antenna selected for the frame, one of nrf_802154_sl_ant_div_antenna_t values
+ * @param power    RSSI of the frame [dBm]
+ */
+void nrf_802154_stat_ant_div_frame_received(uint8_t antenna, int8_t power);
+
+#endif // NRF_802154_ANT_DIV_STATS_ENABLED
+
 #if !defined(UNIT_TEST)
 // Don't use directly. Use provided nrf_802154_stat_xxxx API macros.
 extern volatile nrf_802154_stats_t g_nrf_802154_stats;
 
 extern volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
 
-/**@brief Increment one of the @ref nrf_802154_stat_counters_t fields.
+extern volatile nrf_802154_stat_channels_t g_nrf_802154_stat_channels;
+
+// Incremented by each update of g_nrf_802154_stats and g_nrf_802154_stat_totals.
+extern volatile uint32_t g_nrf_802154_stats_sequence;
+
+extern volatile nrf_802154_stat_csma_histogram_t g_nrf_802154_stat_csma_histogram;
+
+// Attached to the queues with nrf_802154_queue_stats_attach.
+extern volatile nrf_802154_stat_queues_t g_nrf_802154_stat_queues;
+
+// Updated by the critical section module.
+extern volatile nrf_802154_stat_crit_sect_t g_nrf_802154_stat_crit_sect;
+
+/**@brief Atomically increment a statistic counter.
  *
- * @param field_name    Identifier of struct member to increment
+ * The counter is incremented with exclusive accesses, so it is not corrupted by a writer of
+ * another priority and no interrupts are masked. The cores without exclusive accesses mask
+ * interrupts instead.
+ *
+ * @param p_counter  Pointer to the counter.
  */
-#define nrf_802154_stat_counter_increment(field_name) \
-    do                                                \
-    {                                                 \
-        nrf_802154_mcu_critical_state_t mcu_cs;       \
-                                                      \
-        nrf_802154_mcu_critical_enter(mcu_cs);        \
-        (g_nrf_802154_stats.counters.field_name)++;   \
-        nrf_802154_mcu_critical_exit(mcu_cs);         \
-    }                                                 \
-    while (0)
+static inline void nrf_802154_stat_atomic_increment(volatile uint32_t * p_counter)
+{
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+    do
+    {
+        // Retry until no other context wrote the counter between the load and the store.
+    }
+    while (__STREXW(__LDREXW(p_counter) + 1U, p_counter) != 0U);
+#else
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    (*p_counter)++;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+#endif
+}
 
 /**@brief Write one of the @ref nrf_802154_stat_timestamps_t fields.
  *
@@ -64,6 +223,7 @@ extern volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
 #define nrf_802154_stat_timestamp_write(field_name, value)    \
     do                                                        \
     {                                                         \
+        g_nrf_802154_stats_sequence++;                        \
         (g_nrf_802154_stats.timestamps.field_name) = (value); \
     }                                                         \
     while (0)
@@ -72,17 +232,89 @@ extern volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
 #define nrf_802154_stat_timestamp_read(field_name) \
     (g_nrf_802154_stats.timestamps.field_name)
 
+#if NRF_802154_STATS_ENABLED
+
+/**@brief Increment one of the @ref nrf_802154_stat_counters_t fields.
+ *
+ * @param field_name    Identifier of struct member to increment
+ */
+#define nrf_802154_stat_counter_increment(field_name)                              \
+    do                                                                             \
+    {                                                                              \
+        nrf_802154_stat_atomic_increment(&g_nrf_802154_stats_sequence);            \
+        nrf_802154_stat_atomic_increment(&g_nrf_802154_stats.counters.field_name); \
+    }                                                                              \
+    while (0)
+
 #define nrf_802154_stat_totals_increment(field_name, value) \
     do                                                      \
     {                                                       \
         nrf_802154_mcu_critical_state_t mcu_cs;             \
                                                             \
         nrf_802154_mcu_critical_enter(mcu_cs);              \
+        g_nrf_802154_stats_sequence++;                      \
         (g_nrf_802154_stat_totals.field_name) += (value);   \
         nrf_802154_mcu_critical_exit(mcu_cs);               \
     }                                                       \
     while (0)
 
+/**@brief Increment a bucket of one of the @ref nrf_802154_stat_csma_histogram_t fields.
+ *
+ * @param field_name    Identifier of struct member to increment
+ * @param bucket        Index of the bucket to increment
+ */
+#define nrf_802154_stat_csma_histogram_increment(field_name, bucket) \
+    nrf_802154_stat_atomic_increment(&g_nrf_802154_stat_csma_histogram.field_name[(bucket)])
+
+/**@brief Increment one of the @ref nrf_802154_stat_channel_counters_t fields of a channel.
+ *
+ * @param channel       Channel the event happened on (11-26)
+ * @param field_name    Identifier of struct member to increment
+ */
+#define nrf_802154_stat_channel_counter_increment(channel, field_name)    \
+    do                                                                    \
+    {                                                                     \
+        uint32_t ch_idx = (channel) - NRF_802154_STAT_CHANNEL_FIRST;      \
+                                                                          \
+        if (ch_idx < NRF_802154_STAT_CHANNELS)                            \
+        {                                                                 \
+            nrf_802154_stat_atomic_increment(                             \
+                &g_nrf_802154_stat_channels.channels[ch_idx].field_name); \
+        }                                                                 \
+    }                                                                     \
+    while (0)
+
+#else // NRF_802154_STATS_ENABLED
+
+#define nrf_802154_stat_counter_increment(field_name) \
+    do                                                \
+    {                                                 \
+    }                                                 \
+    while (0)
+
+#define nrf_802154_stat_totals_increment(field_name, value) \
+    do                                                      \
+    {                                                       \
+        (void)(value);                                      \
+    }                                                       \
+    while (0)
+
+#define nrf_802154_stat_csma_histogram_increment(field_name, bucket) \
+    do                                                               \
+    {                                                                \
+        (void)(bucket);                                              \
+    }                                                                \
+    while (0)
+
+#define nrf_802154_stat_channel_counter_increment(channel, field_name) \
+    do                                                                 \
+    {                                                                  \
+        (void)(channel);                                               \
+    }                                                                  \
+    while (0)
+
+#endif // NRF_802154_STATS_ENABLED
+
 extern void nrf_802154_stat_totals_get_notify(void);
 
 #else // !defined(UNIT_TEST)
@@ -97,10 +329,22 @@ extern void nrf_802154_stat_totals_get_notify(void);
 #define nrf_802154_stat_timestamp_read(field_name) \
     nrf_802154_stat_timestamp_read_func(offsetof(nrf_802154_stat_timestamps_t, field_name))
 
+#define nrf_802154_stat_csma_histogram_increment(field_name, bucket) \
+    nrf_802154_stat_csma_histogram_increment_func(                   \
+        offsetof(nrf_802154_stat_csma_histogram_t, field_name) +     \
+        ((bucket) * sizeof(uint32_t)))
+
+#define nrf_802154_stat_channel_counter_increment(channel, field_name) \
+    nrf_802154_stat_channel_counter_increment_func(                     \
+        (channel),                                                      \
+        offsetof(nrf_802154_stat_channel_counters_t, field_name))
+
 // Functions for which mocks are generated.
 void nrf_802154_stat_counter_increment_func(size_t field_offset);
 void nrf_802154_stat_timestamp_write_func(size_t field_offset, uint32_t value);
 uint32_t nrf_802154_stat_timestamp_read_func(size_t field_offset);
+void nrf_802154_stat_csma_histogram_increment_func(size_t field_offset);
+void nrf_802154_stat_channel_counter_increment_func(uint8_t channel, size_t field_offset);
 
 #endif // !defined(UNIT_TEST)
 
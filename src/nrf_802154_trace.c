@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the binary trace buffer of the nRF 802.15.4 radio driver.
+ *
+ */
+
+#include "nrf_802154_trace.h"
+
+#if NRF_802154_TRACE_EXPORT_ENABLED && !NRF_802154_TRACE_ENABLED
+#error NRF_802154_TRACE_EXPORT_ENABLED requires NRF_802154_TRACE_ENABLED.
+#endif
+
+#if NRF_802154_TRACE_INPUT_ENABLED && !NRF_802154_TRACE_ENABLED
+#error NRF_802154_TRACE_INPUT_ENABLED requires NRF_802154_TRACE_ENABLED.
+#endif
+
+#if NRF_802154_TRACE_ENABLED && !defined(CU_TEST)
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_utils.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#include "platform/trace_export/nrf_802154_trace_export.h"
+
+#if (NRF_802154_TRACE_BUFFER_LEN & (NRF_802154_TRACE_BUFFER_LEN - 1U)) != 0U
+#error NRF_802154_TRACE_BUFFER_LEN must be a power of 2.
+#endif
+
+#if NRF_802154_TRACE_EXPORT_ENABLED && (NRF_802154_TRACE_EXPORT_CHUNK_LEN < 2U)
+#error NRF_802154_TRACE_EXPORT_CHUNK_LEN must be at least 2.
+#endif
+
+/// Mask of the index of a record in the trace buffer.
+#define TRACE_IDX_MASK     (NRF_802154_TRACE_BUFFER_LEN - 1U)
+
+/// Maximum number of dropped records that can be reported in a single record.
+#define EXPORT_DROPPED_MAX ((1UL << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) - 1UL)
+
+volatile nrf_802154_trace_record_t g_nrf_802154_trace_buffer[NRF_802154_TRACE_BUFFER_LEN];
+volatile uint32_t                  g_nrf_802154_trace_idx;
+
+/** Reserve index of the next record. Preempting writers get subsequent indices. */
+static uint32_t record_idx_reserve(void)
+{
+    uint32_t idx;
+
+    do
+    {
+        idx = __LDREXW(&g_nrf_802154_trace_idx);
+    }
+    while (__STREXW(idx + 1U, &g_nrf_802154_trace_idx));
+
+    return idx & TRACE_IDX_MASK;
+}
+
+void nrf_802154_trace_write(uint32_t entry)
+{
+    uint32_t                             idx      = record_idx_reserve();
+    volatile nrf_802154_trace_record_t * p_record = &g_nrf_802154_trace_buffer[idx];
+
+    // The time is valid only if the high precision timer is running, what is true while
+    // the driver holds the timeslot.
+    p_record->time  = nrf_802154_hp_timer_current_time_get();
+    p_record->entry = entry;
+}
+
+#if NRF_802154_TRACE_EXPORT_ENABLED
+
+/// Buffers passed to the trace export backend.
+static nrf_802154_trace_record_t m_export_buffers[2][NRF_802154_TRACE_EXPORT_CHUNK_LEN];
+static volatile uint32_t         m_export_lengths[2]; ///< Number of records in each buffer.
+static uint8_t                   m_export_fill_idx;   ///< Index of the next buffer to fill.
+static uint8_t                   m_export_write_idx;  ///< Index of the next buffer to write.
+static volatile bool             m_export_busy;       ///< If the backend is writing a buffer.
+static uint32_t                  m_export_read_idx;   ///< Index of the next record to export.
+static uint32_t                  m_export_unreported; ///< Dropped records not reported yet.
+static volatile uint32_t         m_export_dropped;    ///< Total number of dropped records.
+
+/** Count records lost because they were overwritten before being copied. */
+static void export_dropped_add(uint32_t count)
+{
+    m_export_dropped    += count;
+    m_export_unreported += count;
+
+    if (m_export_unreported > EXPORT_DROPPED_MAX)
+    {
+        m_export_unreported = EXPORT_DROPPED_MAX;
+    }
+}
+
+/** Copy new records from the trace buffer to the buffer @p p_buffer. */
+static uint32_t export_buffer_fill(nrf_802154_trace_record_t * p_buffer)
+{
+    uint32_t write_idx = g_nrf_802154_trace_idx;
+    uint32_t first_idx;
+    uint32_t count;
+    uint32_t len       = 0U;
+
+    if ((write_idx - m_export_read_idx) > NRF_802154_TRACE_BUFFER_LEN)
+    {
+        export_dropped_add(write_idx - m_export_read_idx - NRF_802154_TRACE_BUFFER_LEN);
+        m_export_read_idx = write_idx - NRF_802154_TRACE_BUFFER_LEN;
+    }
+
+    // Keep the first slot for the report of dropped records.
+    first_idx = m_export_read_idx;
+    count     = write_idx - first_idx;
+
+    if (count > (NRF_802154_TRACE_EXPORT_CHUNK_LEN - 1U))
+    {
+        count = NRF_802154_TRACE_EXPORT_CHUNK_LEN - 1U;
+    }
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        // This function runs at the lowest priority, so every reserved record is complete.
+        p_buffer[i + 1U] = g_nrf_802154_trace_buffer[(first_idx + i) & TRACE_IDX_MASK];
+    }
+
+    m_export_read_idx = first_idx + count;
+
+    // Records overwritten during the copy are not valid.
+    write_idx = g_nrf_802154_trace_idx;
+
+    if ((write_idx - first_idx) > NRF_802154_TRACE_BUFFER_LEN)
+    {
+        export_dropped_add(count);
+        count = 0U;
+    }
+
+    if (m_export_unreported != 0U)
+    {
+        p_buffer[0].time  = nrf_802154_hp_timer_current_time_get();
+        p_buffer[0].entry = (NRF_802154_TRACE_EXPORT_TYPE_DROPPED <<
+                             NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) | m_export_unreported;
+        len               = count + 1U;
+
+        m_export_unreported = 0U;
+    }
+    else if (count != 0U)
+    {
+        memmove(&p_buffer[0], &p_buffer[1], count * sizeof(p_buffer[0]));
+        len = count;
+    }
+
+    return len;
+}
+
+/** Start the write of the next filled buffer if the backend is idle. */
+static void export_write_start(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            start = false;
+    uint8_t                         idx;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    idx = m_export_write_idx;
+
+    if (!m_export_busy && (m_export_lengths[idx] != 0U))
+    {
+        m_export_busy = true;
+        start         = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (start)
+    {
+        nrf_802154_trace_export_backend_write((const uint8_t *)m_export_buffers[idx],
+                                              m_export_lengths[idx] *
+                                              sizeof(nrf_802154_trace_record_t));
+    }
+}
+
+void nrf_802154_trace_export_init(void)
+{
+    m_export_lengths[0] = 0U;
+    m_export_lengths[1] = 0U;
+    m_export_fill_idx   = 0U;
+    m_export_write_idx  = 0U;
+    m_export_busy       = false;
+    m_export_read_idx   = g_nrf_802154_trace_idx;
+    m_export_unreported = 0U;
+    m_export_dropped    = 0U;
+
+    nrf_802154_trace_export_backend_init();
+}
+
+void nrf_802154_trace_export_process(void)
+{
+    uint8_t idx = m_export_fill_idx;
+
+    if (m_export_lengths[idx] == 0U)
+    {
+        uint32_t len = export_buffer_fill(m_export_buffers[idx]);
+
+        if (len != 0U)
+        {
+            m_export_lengths[idx] = len;
+            m_export_fill_idx     = idx ^ 1U;
+        }
+    }
+
+    export_write_start();
+}
+
+uint32_t nrf_802154_trace_export_dropped_get(void)
+{
+    return m_export_dropped;
+}
+
+void nrf_802154_trace_export_backend_written(void)
+{
+    m_export_lengths[m_export_write_idx] = 0U;
+    m_export_write_idx                  ^= 1U;
+    m_export_busy                        = false;
+
+    export_write_start();
+}
+
+#endif // NRF_802154_TRACE_EXPORT_ENABLED
+
+#endif // NRF_802154_TRACE_ENABLED && !defined(CU_TEST)
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @brief Module that records timestamped debug log entries in the binary trace buffer.
+ *
+ * Each record contains the time of the high precision timer and a log word encoded in the same
+ * way as the entries of the debug log buffer (see @ref nrf_802154_sl_debug_logging). The buffer
+ * is decoded from a RAM dump with the tools in @c tools/event_decoder.
+ */
+
+#ifndef NRF_802154_TRACE_H_
+#define NRF_802154_TRACE_H_
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_sl_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if NRF_802154_TRACE_ENABLED && !defined(CU_TEST)
+
+/**
+ * @brief Structure of a single record of the binary trace buffer.
+ */
+typedef struct
+{
+    uint32_t time;  ///< Time of the high precision timer when the record was written [us].
+    uint32_t entry; ///< Log word of the record. The encoding is the same as in the debug log buffer.
+} nrf_802154_trace_record_t;
+
+/** @brief Binary trace buffer. */
+extern volatile nrf_802154_trace_record_t g_nrf_802154_trace_buffer[NRF_802154_TRACE_BUFFER_LEN];
+
+/**
+ * @brief Number of records written to the binary trace buffer since the reset.
+ *
+ * The next record is written at index @c g_nrf_802154_trace_idx modulo
+ * @ref NRF_802154_TRACE_BUFFER_LEN.
+ */
+extern volatile uint32_t g_nrf_802154_trace_idx;
+
+/**
+ * @brief Writes a record to the binary trace buffer.
+ *
+ * This function can be called from any priority. It does not disable interrupts.
+ *
+ * @param[in]  entry  Log word to be written.
+ */
+void nrf_802154_trace_write(uint32_t entry);
+
+#if NRF_802154_TRACE_EXPORT_ENABLED
+
+/**
+ * @brief Type of the record inserted into the exported stream when records were dropped.
+ *
+ * The lower 28 bits of the log word of this record contain the number of the dropped records.
+ */
+#define NRF_802154_TRACE_EXPORT_TYPE_DROPPED 15U
+
+/**
+ * @brief Initializes the trace export and its backend.
+ */
+void nrf_802154_trace_export_init(void);
+
+/**
+ * @brief Copies new records from the binary trace buffer to the trace export backend.
+ *
+ * This function is to be called periodically by the application from the lowest priority
+ * context, for example from the idle loop. Records written since the previous call are copied
+ * to a free export buffer, and the write of that buffer is started if the backend is idle.
+ */
+void nrf_802154_trace_export_process(void);
+
+/**
+ * @brief Gets the number of records overwritten in the trace buffer before being exported.
+ *
+ * @returns  Number of dropped records since the initialization.
+ */
+uint32_t nrf_802154_trace_export_dropped_get(void);
+
+#endif // NRF_802154_TRACE_EXPORT_ENABLED
+
+#if NRF_802154_TRACE_INPUT_ENABLED
+
+/**
+ * @brief Type of the record of an input event of the driver state machine.
+ *
+ * The log word of this record is encoded as follows:
+ * - bits 24..26: source of the event, one of @c NRF_802154_TRACE_INPUT_SOURCE_* values,
+ * - bit 27: set in the record written when the handling of the event is finished,
+ * - bits 16..23: identifier of the event within its source,
+ * - bits 0..15: parameter of the event.
+ */
+#define NRF_802154_TRACE_TYPE_INPUT               14U
+
+#define NRF_802154_TRACE_INPUT_SOURCE_BITPOS      24 ///< Bit shift of the source of an event.
+#define NRF_802154_TRACE_INPUT_DONE_BITPOS        27 ///< Bit shift of the flag of a handled event.
+#define NRF_802154_TRACE_INPUT_ID_BITPOS          16 ///< Bit shift of the ID of an event.
+
+#define NRF_802154_TRACE_INPUT_SOURCE_RADIO_EVENT 0U ///< RADIO event, ID is the IRQ profile item.
+#define NRF_802154_TRACE_INPUT_SOURCE_REQUEST     1U ///< Request processed from the queue.
+#define NRF_802154_TRACE_INPUT_SOURCE_TIMESLOT    2U ///< Change of the timeslot priority.
+
+/**
+ * @brief Records an input event of the driver state machine in the binary trace buffer.
+ *
+ * @param[in]  source     Source of the event, one of @c NRF_802154_TRACE_INPUT_SOURCE_* values.
+ * @param[in]  event_id   Identifier of the event within its source. Possible values: [ 0 .. 255 ].
+ * @param[in]  param_u16  Parameter of the event.
+ */
+#define nrf_802154_trace_input(source, event_id, param_u16)                          \
+    nrf_802154_trace_write(                                                          \
+        (NRF_802154_TRACE_TYPE_INPUT << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |       \
+        (((uint32_t)(source)) << NRF_802154_TRACE_INPUT_SOURCE_BITPOS) |             \
+        (((uint32_t)(uint8_t)(event_id)) << NRF_802154_TRACE_INPUT_ID_BITPOS) |      \
+        ((uint16_t)(param_u16)))
+
+/**
+ * @brief Records the end of the handling of an input event in the binary trace buffer.
+ *
+ * @param[in]  source     Source of the event, one of @c NRF_802154_TRACE_INPUT_SOURCE_* values.
+ * @param[in]  event_id   Identifier of the event within its source. Possible values: [ 0 .. 255 ].
+ */
+#define nrf_802154_trace_input_done(source, event_id)                                \
+    nrf_802154_trace_write(                                                          \
+        (NRF_802154_TRACE_TYPE_INPUT << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |       \
+        (1UL << NRF_802154_TRACE_INPUT_DONE_BITPOS) |                                \
+        (((uint32_t)(source)) << NRF_802154_TRACE_INPUT_SOURCE_BITPOS) |             \
+        (((uint32_t)(uint8_t)(event_id)) << NRF_802154_TRACE_INPUT_ID_BITPOS))
+
+#endif // NRF_802154_TRACE_INPUT_ENABLED
+
+/**
+ * @brief Records entry to or exit from a function in the binary trace buffer.
+ *
+ * @param[in]  verbosity  Verbosity level required to emit the record.
+ * @param[in]  type       @ref NRF_802154_LOG_TYPE_FUNCTION_ENTER or
+ *                        @ref NRF_802154_LOG_TYPE_FUNCTION_EXIT.
+ */
+#define nrf_802154_trace_function(verbosity, type)                                      \
+    do                                                                                  \
+    {                                                                                   \
+        if (nrf_802154_sl_log_verbosity_allows(verbosity))                              \
+        {                                                                               \
+            nrf_802154_trace_write(                                                     \
+                ((uint32_t)(type) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |             \
+                ((NRF_802154_MODULE_ID) << NRF_802154_SL_DEBUG_LOG_MODULE_ID_BITPOS) |  \
+                ((uint16_t)((uintptr_t)(__func__))));                                   \
+        }                                                                               \
+    }                                                                                   \
+    while (0)
+
+/**
+ * @brief Records an event with a parameter in the binary trace buffer.
+ *
+ * @param[in]  verbosity  Verbosity level required to emit the record.
+ * @param[in]  type       @ref NRF_802154_LOG_TYPE_LOCAL_EVENT or
+ *                        @ref NRF_802154_LOG_TYPE_GLOBAL_EVENT.
+ * @param[in]  event_id   Identifier of the event. Possible values: [ 0 .. 63 ].
+ * @param[in]  param_u16  Parameter of the event.
+ */
+#define nrf_802154_trace_event(verbosity, type, event_id, param_u16)                    \
+    do                                                                                  \
+    {                                                                                   \
+        if (nrf_802154_sl_log_verbosity_allows(verbosity))                              \
+        {                                                                               \
+            nrf_802154_trace_write(                                                     \
+                ((uint32_t)(type) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |             \
+                ((NRF_802154_MODULE_ID) << NRF_802154_SL_DEBUG_LOG_MODULE_ID_BITPOS) |  \
+                (((uint32_t)(event_id)) << NRF_802154_SL_DEBUG_LOG_EVENT_ID_BITPOS) |   \
+                ((uint16_t)(param_u16)));                                               \
+        }                                                                               \
+    }                                                                                   \
+    while (0)
+
+#else // NRF_802154_TRACE_ENABLED && !defined(CU_TEST)
+
+#define nrf_802154_trace_function(verbosity, type) \
+    do                                             \
+    {                                              \
+    }                                              \
+    while (0)
+
+#define nrf_802154_trace_event(verbosity, type, event_id, param_u16) \
+    do                                                               \
+    {                                                                \
+    }                                                                \
+    while (0)
+
+#endif // NRF_802154_TRACE_ENABLED && !defined(CU_TEST)
+
+#if !NRF_802154_TRACE_ENABLED || !NRF_802154_TRACE_INPUT_ENABLED || defined(CU_TEST)
+
+#define nrf_802154_trace_input(source, event_id, param_u16) \
+    do                                                      \
+    {                                                       \
+    }                                                       \
+    while (0)
+
+#define nrf_802154_trace_input_done(source, event_id) \
+    do                                                \
+    {                                                 \
+    }                                                 \
+    while (0)
+
+#endif // !NRF_802154_TRACE_ENABLED || !NRF_802154_TRACE_INPUT_ENABLED || defined(CU_TEST)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TRACE_H_ */
@@ -29,7 +29,8 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_TRX
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_TRX
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_TRX_LOG_VERBOSITY
 
 #include "nrf_802154_trx.h"
 
@@ -43,7 +44,9 @@
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_rssi.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
+#include "nrf_802154_trace.h"
 #include "nrf_802154_trx_ppi_api.h"
 #include "nrf_802154_utils.h"
 
@@ -54,6 +57,7 @@
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_critical_section.h"
 #include "fem/nrf_fem_protocol_api.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
 #include "platform/irq/nrf_802154_irq.h"
 
 #include "nrf_802154_sl_ant_div.h"
@@ -107,6 +111,11 @@
 #define SHORTS_MOD_CARRIER    (NRF_RADIO_SHORT_TXREADY_START_MASK | \
                                NRF_RADIO_SHORT_PHYEND_START_MASK)
 
+#define SHORTS_PER_TX         (NRF_RADIO_SHORT_TXREADY_START_MASK)
+
+#define SHORTS_PER_RX         (NRF_RADIO_SHORT_RXREADY_START_MASK | \
+                               NRF_RADIO_SHORT_END_START_MASK)
+
 #define SHORTS_ED             (NRF_RADIO_SHORT_READY_EDSTART_MASK)
 
 #define SHORTS_CCA            (NRF_RADIO_SHORT_RXREADY_CCASTART_MASK | \
@@ -118,6 +127,8 @@
 #define TXRU_TIME             40         ///< Transmitter ramp up time [us]
 #define EVENT_LAT             23         ///< END event latency [us]
 #define MAX_RXRAMPDOWN_CYCLES 32         ///< Maximum number of cycles that RX ramp-down might take
+#define MAX_RXSTOP_CYCLES     32         ///< Maximum number of cycles that stopping RX packet might take
+#define MAX_TXRAMPDOWN_CYCLES 1344       ///< Maximum number of cycles that TX ramp-down might take
 
 #define RSSI_SETTLE_TIME_US   15         ///< Time required for RSSI measurements to become valid after signal level change.
 
@@ -125,8 +136,9 @@
 void nrf_802154_radio_irq_handler(void); ///< Prototype required by internal RADIO IRQ handler
 #endif  // NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 
-/// Common parameters for the FAL handling.
-static const nrf_802154_fal_event_t m_activate_rx_cc0 =
+/// Common parameters for the FAL handling. The activation times are updated from the PIB by
+/// @ref fem_activation_events_update.
+static nrf_802154_fal_event_t m_activate_rx_cc0 =
 {
     .type         = NRF_802154_FAL_EVENT_TYPE_TIMER,
     .override_ppi = false,
@@ -140,7 +152,7 @@ static const nrf_802154_fal_event_t m_activate_rx_cc0 =
     },
 };
 
-static const nrf_802154_fal_event_t m_activate_tx_cc0 =
+static nrf_802154_fal_event_t m_activate_tx_cc0 =
 {
     .type         = NRF_802154_FAL_EVENT_TYPE_TIMER,
     .override_ppi = false,
@@ -184,6 +196,11 @@ typedef struct
     bool          rssi_started;
 
     volatile bool rssi_settled;
+
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+    bool rxack_timeout_armed; ///< If the wait for an ACK is ended by the TIMER.
+
+#endif // NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
 } nrf_802154_flags_t;
 
 static nrf_802154_flags_t m_flags; ///< Flags used to store the current driver state.
@@ -191,8 +208,82 @@ static nrf_802154_flags_t m_flags; ///< Flags used to store the current driver s
 /**@brief Value of TIMER internal counter from which the counting is resumed on RADIO.EVENTS_END event. */
 static volatile uint32_t m_timer_value_on_radio_end_event;
 static volatile bool     m_transmit_with_cca;
+static uint8_t           m_receive_bcc; ///< BCC set at the start of each received frame [bytes].
+static volatile bool     m_transmit_delayed; ///< If the frame transmission is triggered by the TIMER.
+
+static int8_t m_cca_temp_corr_value; ///< Temperature correction of the programmed CCA threshold.
+
+/// Antenna selected for the destination of the transmitted frames.
+static nrf_802154_sl_ant_div_antenna_t m_tx_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+
+/// If the PA is left inactive during the transmitted frames.
+static bool m_tx_fem_bypass;
+
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+/// Time from the end of the transmitted frame until the ACK reception is ended [us], 0 if not used.
+static uint32_t m_rxack_timeout;
+#endif
+
+#if NRF_802154_PER_TEST_ENABLED
+static volatile uint32_t m_per_tx_remaining; ///< Frames left to transmit in the PER test burst.
+static uint32_t          m_per_tx_interval;  ///< Interval between the frames of the PER test burst [us].
+static bool              m_per_rx_enabled;   ///< If the received frames are to be only counted.
+static bool              m_per_rx_active;    ///< If the ongoing reception only counts the frames.
+static volatile uint32_t m_per_rx_crcok;     ///< Frames counted with correct CRC.
+static volatile uint32_t m_per_rx_crcerror;  ///< Frames counted with incorrect CRC.
+
+/// Buffer overwritten by the frames counted by the PER test.
+static uint8_t m_per_rx_buffer[MAX_PACKET_SIZE + PHR_SIZE];
+#endif
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+/// Activation of an amplifier of the FEM, tracked to measure its active time.
+typedef struct
+{
+    bool     pending;    ///< If the amplifier is configured to be activated.
+    uint32_t start_time; ///< Expected activation time of the amplifier on the HP timer.
+} fem_activation_t;
+
+static fem_activation_t m_lna_activation; ///< Activation of the LNA.
+static fem_activation_t m_pa_activation;  ///< Activation of the PA.
+#endif
+
+#if NRF_802154_RADIO_FAST_ENABLE_ENABLED
+/**@brief RADIO registers that hold the configuration independent of the PIB. */
+typedef struct
+{
+    uint32_t mode;
+    uint32_t pcnf0;
+    uint32_t pcnf1;
+    uint32_t modecnf0;
+    uint32_t crccnf;
+    uint32_t crcpoly;
+    uint32_t crcinit;
+} radio_cfg_image_t;
+
+static radio_cfg_image_t m_radio_cfg_image;       ///< Cached RADIO configuration.
+static bool              m_radio_cfg_image_valid; ///< If @ref m_radio_cfg_image is captured.
+static bool              m_radio_released;        ///< If the RADIO was reset when the timeslot ended.
+#endif
+
+/**@brief Executes @p statement and records its execution time as the given item of the RADIO
+ *        interrupt profile. */
+#define irq_cycles_measure(item, statement)                                       \
+    do                                                                            \
+    {                                                                             \
+        uint32_t irq_cycles_start = nrf_802154_stat_irq_cycles_start();           \
+                                                                                  \
+        nrf_802154_trace_input(NRF_802154_TRACE_INPUT_SOURCE_RADIO_EVENT, (item), \
+                               m_trx_state);                                      \
+        statement;                                                                \
+        nrf_802154_trace_input_done(NRF_802154_TRACE_INPUT_SOURCE_RADIO_EVENT,    \
+                                    (item));                                      \
+        nrf_802154_stat_irq_cycles_record((item), irq_cycles_start);              \
+    }                                                                             \
+    while (0)
 
 static void rxframe_finish_disable_ppis(void);
+static void rxframe_finish_psdu_is_not_being_received(void);
 static void rxack_finish_disable_ppis(void);
 static void txframe_finish_disable_ppis(bool cca);
 
@@ -252,18 +343,90 @@ static void channel_set(uint8_t channel)
     nrf_radio_frequency_set(NRF_RADIO, 2405U + 5U * (channel - 11U));
 }
 
+static void cca_configuration_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
+{
+    m_cca_temp_corr_value = nrf_802154_rssi_sample_temp_corr_value_get();
+
+    nrf_radio_cca_configure(NRF_RADIO,
+                            p_cca_cfg->mode,
+                            nrf_802154_rssi_cca_ed_threshold_corrected_get(p_cca_cfg->ed_threshold),
+                            p_cca_cfg->corr_threshold,
+                            p_cca_cfg->corr_limit);
+}
+
 static void cca_configuration_update(void)
 {
     nrf_802154_cca_cfg_t cca_cfg;
 
     nrf_802154_pib_cca_cfg_get(&cca_cfg);
-    nrf_radio_cca_configure(NRF_RADIO,
-                            cca_cfg.mode,
-                            nrf_802154_rssi_cca_ed_threshold_corrected_get(cca_cfg.ed_threshold),
-                            cca_cfg.corr_threshold,
-                            cca_cfg.corr_limit);
+    cca_configuration_set(&cca_cfg);
+}
+
+/** Configure the RADIO part that does not depend on the PIB. */
+static void radio_static_configuration_set(void)
+{
+    nrf_radio_packet_conf_t packet_conf;
+
+    nrf_radio_mode_set(NRF_RADIO, NRF_RADIO_MODE_IEEE802154_250KBIT);
+
+    memset(&packet_conf, 0, sizeof(packet_conf));
+    packet_conf.lflen  = 8;
+    packet_conf.plen   = NRF_RADIO_PREAMBLE_LENGTH_32BIT_ZERO;
+    packet_conf.crcinc = true;
+    packet_conf.maxlen = MAX_PACKET_SIZE;
+    nrf_radio_packet_configure(NRF_RADIO, &packet_conf);
+
+    nrf_radio_modecnf0_set(NRF_RADIO, true, 0);
+
+    // Configure CRC
+    nrf_radio_crc_configure(NRF_RADIO, CRC_LENGTH, NRF_RADIO_CRC_ADDR_IEEE802154, CRC_POLYNOMIAL);
+}
+
+#if NRF_802154_RADIO_FAST_ENABLE_ENABLED
+/** Check if the RADIO is unused since it was reset by @ref nrf_802154_trx_disable. */
+static bool radio_is_untouched(void)
+{
+    // Any user of the RADIO configures its mode and packet format, which are zero after reset.
+    return m_radio_released &&
+           (NRF_RADIO->MODE == 0U) &&
+           (NRF_RADIO->PCNF0 == 0U) &&
+           (NRF_RADIO->PCNF1 == 0U) &&
+           (NRF_RADIO->CRCCNF == 0U) &&
+           (NRF_RADIO->SHORTS == 0U) &&
+           (NRF_RADIO->INTENSET == 0U) &&
+           (nrf_radio_state_get(NRF_RADIO) == NRF_RADIO_STATE_DISABLED);
+}
+
+/** Configure the RADIO part that does not depend on the PIB from the cached image. */
+static void radio_static_configuration_restore(void)
+{
+    if (m_radio_cfg_image_valid)
+    {
+        NRF_RADIO->MODE     = m_radio_cfg_image.mode;
+        NRF_RADIO->PCNF0    = m_radio_cfg_image.pcnf0;
+        NRF_RADIO->PCNF1    = m_radio_cfg_image.pcnf1;
+        NRF_RADIO->MODECNF0 = m_radio_cfg_image.modecnf0;
+        NRF_RADIO->CRCCNF   = m_radio_cfg_image.crccnf;
+        NRF_RADIO->CRCPOLY  = m_radio_cfg_image.crcpoly;
+        NRF_RADIO->CRCINIT  = m_radio_cfg_image.crcinit;
+    }
+    else
+    {
+        radio_static_configuration_set();
+
+        m_radio_cfg_image.mode     = NRF_RADIO->MODE;
+        m_radio_cfg_image.pcnf0    = NRF_RADIO->PCNF0;
+        m_radio_cfg_image.pcnf1    = NRF_RADIO->PCNF1;
+        m_radio_cfg_image.modecnf0 = NRF_RADIO->MODECNF0;
+        m_radio_cfg_image.crccnf   = NRF_RADIO->CRCCNF;
+        m_radio_cfg_image.crcpoly  = NRF_RADIO->CRCPOLY;
+        m_radio_cfg_image.crcinit  = NRF_RADIO->CRCINIT;
+        m_radio_cfg_image_valid    = true;
+    }
 }
 
+#endif // NRF_802154_RADIO_FAST_ENABLE_ENABLED
+
 /** Initialize interrupts for radio peripheral. */
 static void irq_init(void)
 {
@@ -285,21 +448,74 @@ static void trigger_disable_to_start_rampup(void)
     }
 }
 
+/** Apply the FEM activation delays from the PIB to the FEM activation events. */
+static void fem_activation_events_update(void)
+{
+    m_activate_rx_cc0.event.timer.counter_period.end =
+        RX_RAMP_UP_TIME + nrf_802154_pib_fem_lna_activation_delay_get();
+    m_activate_tx_cc0.event.timer.counter_period.end =
+        TX_RAMP_UP_TIME + nrf_802154_pib_fem_pa_activation_delay_get();
+}
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+
+/** Store the expected activation time of an amplifier, @p delay from now. */
+static void fem_activation_mark(fem_activation_t * p_activation, uint32_t delay)
+{
+    p_activation->pending    = true;
+    p_activation->start_time = nrf_802154_hp_timer_current_time_get() + delay;
+}
+
+/** Get the time the amplifier was active since its activation time, capped at @p max_time. */
+static uint32_t fem_activation_time_get(fem_activation_t * p_activation, uint32_t max_time)
+{
+    int32_t time;
+
+    if (!p_activation->pending)
+    {
+        return 0U;
+    }
+
+    p_activation->pending = false;
+
+    time = (int32_t)(nrf_802154_hp_timer_current_time_get() - p_activation->start_time);
+
+    if (time <= 0)
+    {
+        return 0U;
+    }
+
+    return ((uint32_t)time < max_time) ? (uint32_t)time : max_time;
+}
+
+#endif // NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+
 /** Configure FEM to set LNA at appropriate time. */
 static void fem_for_lna_set(void)
 {
+    fem_activation_events_update();
+
     if (nrf_802154_fal_lna_configuration_set(&m_activate_rx_cc0, NULL) == NRFX_SUCCESS)
     {
         nrf_timer_shorts_enable(m_activate_rx_cc0.event.timer.p_timer_instance,
                                 NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
 
         nrf_802154_trx_ppi_for_fem_set();
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+        fem_activation_mark(&m_lna_activation, m_activate_rx_cc0.event.timer.counter_period.end);
+#endif
     }
 }
 
 /** Reset FEM configuration for LNA. */
 static void fem_for_lna_reset(void)
 {
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    nrf_802154_stat_totals_increment(total_lna_time,
+                                     fem_activation_time_get(&m_lna_activation, UINT32_MAX));
+#endif
+
     nrf_802154_fal_lna_configuration_clear();
     nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
     nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
@@ -312,11 +528,17 @@ static void fem_for_lna_reset(void)
  */
 static void fem_for_pa_set(void)
 {
+    fem_activation_events_update();
+
     if (nrf_802154_fal_pa_configuration_set(&m_activate_tx_cc0, NULL) == NRFX_SUCCESS)
     {
         nrf_timer_shorts_enable(m_activate_tx_cc0.event.timer.p_timer_instance,
                                 NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
         nrf_802154_trx_ppi_for_fem_set();
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+        fem_activation_mark(&m_pa_activation, m_activate_tx_cc0.event.timer.counter_period.end);
+#endif
     }
 }
 
@@ -326,6 +548,11 @@ static void fem_for_pa_set(void)
  */
 static void fem_for_pa_reset(void)
 {
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    nrf_802154_stat_totals_increment(total_pa_time,
+                                     fem_activation_time_get(&m_pa_activation, UINT32_MAX));
+#endif
+
     nrf_802154_fal_pa_configuration_clear();
     nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
     nrf_802154_trx_ppi_for_fem_clear();
@@ -340,6 +567,8 @@ static void fem_for_tx_set(bool cca)
 {
     bool success;
 
+    fem_activation_events_update();
+
     if (cca)
     {
         bool pa_set  = false;
@@ -348,11 +577,23 @@ static void fem_for_tx_set(bool cca)
         if (nrf_802154_fal_lna_configuration_set(&m_activate_rx_cc0, &m_ccaidle) == NRFX_SUCCESS)
         {
             lna_set = true;
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+            fem_activation_mark(&m_lna_activation,
+                                m_activate_rx_cc0.event.timer.counter_period.end);
+#endif
         }
 
-        if (nrf_802154_fal_pa_configuration_set(&m_ccaidle, NULL) == NRFX_SUCCESS)
+        if (!m_tx_fem_bypass &&
+            (nrf_802154_fal_pa_configuration_set(&m_ccaidle, NULL) == NRFX_SUCCESS))
         {
             pa_set = true;
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+            // The PA is activated when the CCA reports an idle channel.
+            fem_activation_mark(&m_pa_activation,
+                                RX_RAMP_UP_TIME + PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS));
+#endif
         }
 
         success = pa_set || lna_set;
@@ -360,7 +601,16 @@ static void fem_for_tx_set(bool cca)
     }
     else
     {
-        success = (nrf_802154_fal_pa_configuration_set(&m_activate_tx_cc0, NULL) == NRFX_SUCCESS);
+        success = !m_tx_fem_bypass &&
+                  (nrf_802154_fal_pa_configuration_set(&m_activate_tx_cc0, NULL) == NRFX_SUCCESS);
+
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+        if (success)
+        {
+            fem_activation_mark(&m_pa_activation,
+                                m_activate_tx_cc0.event.timer.counter_period.end);
+        }
+#endif
     }
 
     if (success)
@@ -372,6 +622,16 @@ static void fem_for_tx_set(bool cca)
 
 static void fem_for_tx_reset(bool cca)
 {
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    // During the transmission with CCA, the LNA is deactivated when the CCA ends.
+    nrf_802154_stat_totals_increment(
+        total_lna_time,
+        fem_activation_time_get(&m_lna_activation,
+                                PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS)));
+    nrf_802154_stat_totals_increment(total_pa_time,
+                                     fem_activation_time_get(&m_pa_activation, UINT32_MAX));
+#endif
+
     nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
 
     if (cca)
@@ -394,6 +654,7 @@ void nrf_802154_trx_module_reset(void)
     m_trx_state                      = TRX_STATE_DISABLED;
     m_timer_value_on_radio_end_event = 0;
     m_transmit_with_cca              = false;
+    m_transmit_delayed               = false;
     mp_receive_buffer                = NULL;
 
     memset(&m_flags, 0, sizeof(m_flags));
@@ -419,23 +680,20 @@ void nrf_802154_trx_enable(void)
 
     assert(m_trx_state == TRX_STATE_DISABLED);
 
-    nrf_radio_reset();
-
-    nrf_radio_packet_conf_t packet_conf;
+#if NRF_802154_RADIO_FAST_ENABLE_ENABLED
+    if (!radio_is_untouched())
+    {
+        nrf_radio_reset();
+    }
 
-    nrf_radio_mode_set(NRF_RADIO, NRF_RADIO_MODE_IEEE802154_250KBIT);
+    m_radio_released = false;
 
-    memset(&packet_conf, 0, sizeof(packet_conf));
-    packet_conf.lflen  = 8;
-    packet_conf.plen   = NRF_RADIO_PREAMBLE_LENGTH_32BIT_ZERO;
-    packet_conf.crcinc = true;
-    packet_conf.maxlen = MAX_PACKET_SIZE;
-    nrf_radio_packet_configure(NRF_RADIO, &packet_conf);
-
-    nrf_radio_modecnf0_set(NRF_RADIO, true, 0);
+    radio_static_configuration_restore();
+#else
+    nrf_radio_reset();
 
-    // Configure CRC
-    nrf_radio_crc_configure(NRF_RADIO, CRC_LENGTH, NRF_RADIO_CRC_ADDR_IEEE802154, CRC_POLYNOMIAL);
+    radio_static_configuration_set();
+#endif
 
     // Configure CCA
     cca_configuration_update();
@@ -447,13 +705,11 @@ void nrf_802154_trx_enable(void)
 
     assert(nrf_radio_shorts_get(NRF_RADIO) == SHORTS_IDLE);
 
-#if defined(NRF52840_XXAA) || \
-    defined(NRF52833_XXAA) || \
-    defined(NRF52820_XXAA) || \
-    defined(NRF52811_XXAA)
-    // TODO: Uncomment it when FEM API is cross-family
-    nrf_802154_fal_abort_set(nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_DISABLED),
-                             nrf_802154_trx_ppi_group_for_abort_get());
+    nrf_802154_trx_ppi_for_fem_abort_set();
+
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+    // The end of each frame is captured by the timer without any action from the IRQ handlers.
+    nrf_802154_trx_ppi_for_frame_timestamp_set();
 #endif
 
     nrf_802154_fal_deactivate_now(NRF_802154_FAL_ALL);
@@ -505,6 +761,9 @@ static void ppi_all_clear(void)
             break;
 
         case TRX_STATE_MODULATED_CARRIER:
+#if NRF_802154_PER_TEST_ENABLED
+            nrf_802154_trx_ppi_for_per_test_clear();
+#endif
             nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_TXEN, false);
             nrf_802154_trx_ppi_for_fem_clear();
             break;
@@ -554,6 +813,10 @@ void nrf_802154_trx_disable(void)
         /* While the RADIO is powered off deconfigure any PPIs used directly by trx module */
         ppi_all_clear();
 
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+        nrf_802154_trx_ppi_for_frame_timestamp_clear();
+#endif
+
 #if !NRF_802154_DISABLE_BCC_MATCHING && defined(RADIO_INTENSET_SYNC_Msk)
         nrf_egu_int_disable(NRF_802154_EGU_INSTANCE, EGU_SYNC_INTMASK);
         nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, EGU_SYNC_EVENT);
@@ -567,13 +830,7 @@ void nrf_802154_trx_disable(void)
 
         nrf_radio_power_set(NRF_RADIO, true);
 
-#if defined(NRF52840_XXAA) ||     \
-        defined(NRF52833_XXAA) || \
-        defined(NRF52820_XXAA) || \
-        defined(NRF52811_XXAA)
-        // TODO: Uncomment this code when FEM API supports nRF53
-        nrf_802154_fal_abort_clear();
-#endif
+        nrf_802154_trx_ppi_for_fem_abort_clear();
 
         // TODO: Deconfigure FAL PA and LNA here?
         nrf_802154_fal_deactivate_now(NRF_802154_FAL_ALL);
@@ -599,6 +856,10 @@ void nrf_802154_trx_disable(void)
 
         m_trx_state = TRX_STATE_DISABLED;
 
+#if NRF_802154_RADIO_FAST_ENABLE_ENABLED
+        m_radio_released = true;
+#endif
+
         nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_LOW,
                                     NRF_802154_LOG_GLOBAL_EVENT_ID_RADIO_RESET, 0U);
     }
@@ -671,7 +932,8 @@ static void rx_antenna_update(void)
  * Updates the antenna for transmission, according to antenna diversity configuration.
  *
  * Antenna diversity for tx is not currently supported. If antenna diversity is not
- * in disabled state, default antenna will always be used for transmission.
+ * in disabled state, the antenna selected for the destination of the frame by
+ * @ref nrf_802154_trx_tx_antenna_select or the default antenna is used for transmission.
  */
 static void tx_antenna_update(void)
 {
@@ -687,7 +949,8 @@ static void tx_antenna_update(void)
 
         case NRF_802154_SL_ANT_DIV_MODE_MANUAL:
             result = nrf_802154_sl_ant_div_antenna_set(
-                nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX));
+                (m_tx_antenna != NRF_802154_SL_ANT_DIV_ANTENNA_NONE) ?
+                m_tx_antenna : nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX));
             break;
 
         case NRF_802154_SL_ANT_DIV_MODE_AUTO:
@@ -702,6 +965,16 @@ static void tx_antenna_update(void)
     }
 }
 
+void nrf_802154_trx_tx_antenna_select(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    m_tx_antenna = antenna;
+}
+
+void nrf_802154_trx_tx_fem_bypass_set(bool bypass)
+{
+    m_tx_fem_bypass = bypass;
+}
+
 void nrf_802154_trx_antenna_update(void)
 {
     assert(m_trx_state != TRX_STATE_DISABLED);
@@ -747,6 +1020,20 @@ void nrf_802154_trx_cca_configuration_update(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+bool nrf_802154_trx_cca_configuration_is_outdated(void)
+{
+    return m_cca_temp_corr_value != nrf_802154_rssi_sample_temp_corr_value_get();
+}
+
+void nrf_802154_trx_cca_configuration_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    cca_configuration_set(p_cca_cfg);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
 /** Check if PSDU is currently being received.
  *
  * @returns True if radio is receiving PSDU, false otherwise.
@@ -781,6 +1068,11 @@ bool nrf_802154_trx_receive_is_buffer_missing(void)
     }
 }
 
+bool nrf_802154_trx_receive_buffer_missing_hint_get(void)
+{
+    return m_flags.missing_receive_buffer;
+}
+
 static void receive_buffer_missing_buffer_set(void * p_receive_buffer)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -834,11 +1126,62 @@ bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer)
     return result;
 }
 
+#if NRF_802154_PER_TEST_ENABLED
+/** Start receiving frames that are only counted, without notifications and receive buffers. */
+static void per_test_receive_frame(void)
+{
+    // Force the TIMER to be stopped and count from 0.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+
+    m_trx_state = TRX_STATE_RXFRAME;
+
+    rx_flags_clear();
+    m_flags.rssi_started = false;
+    m_flags.rssi_settled = false;
+
+    // The RADIO restarts the reception by itself at the end of each frame.
+    nrf_radio_packetptr_set(NRF_RADIO, m_per_rx_buffer);
+    nrf_radio_shorts_set(NRF_RADIO, SHORTS_PER_RX);
+
+    nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCOK);
+    nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCERROR);
+    nrf_radio_int_enable(NRF_RADIO, NRF_RADIO_INT_CRCOK_MASK | NRF_RADIO_INT_CRCERROR_MASK);
+
+    fem_activation_events_update();
+
+    if (nrf_802154_fal_lna_configuration_set(&m_activate_rx_cc0, NULL) == NRFX_SUCCESS)
+    {
+        nrf_timer_shorts_enable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
+    }
+
+    nrf_802154_trx_antenna_update();
+    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, true);
+
+    trigger_disable_to_start_rampup();
+}
+
+#endif // NRF_802154_PER_TEST_ENABLED
+
 void nrf_802154_trx_receive_frame(uint8_t                                bcc,
                                   nrf_802154_trx_receive_notifications_t notifications_mask)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_PER_TEST_ENABLED
+    m_per_rx_active = m_per_rx_enabled;
+
+    if (m_per_rx_active)
+    {
+        (void)bcc;
+        (void)notifications_mask;
+
+        per_test_receive_frame();
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     uint32_t ints_to_enable = 0U;
     uint32_t shorts         = SHORTS_RX;
 
@@ -873,6 +1216,7 @@ void nrf_802154_trx_receive_frame(uint8_t                                bcc,
     // Set BCC
 #if !NRF_802154_DISABLE_BCC_MATCHING
     assert(bcc != 0U);
+    m_receive_bcc = bcc;
     nrf_radio_bcc_set(NRF_RADIO, bcc * 8U);
 #else
     assert(bcc == 0U);
@@ -929,6 +1273,8 @@ void nrf_802154_trx_receive_frame(uint8_t                                bcc,
     // Set FEM
     uint32_t delta_time;
 
+    fem_activation_events_update();
+
     if (nrf_802154_fal_lna_configuration_set(&m_activate_rx_cc0, NULL) == NRFX_SUCCESS)
     {
         delta_time = nrf_timer_cc_get(NRF_802154_TIMER_INSTANCE,
@@ -965,12 +1311,101 @@ void nrf_802154_trx_receive_frame(uint8_t                                bcc,
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+bool nrf_802154_trx_receive_frame_restart(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if ((m_trx_state != TRX_STATE_RXFRAME) || nrf_802154_trx_psdu_is_being_received())
+    {
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return false;
+    }
+
+    // Stop the TIMER, so that it counts the FEM activation from the next ramp up.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+
+    rxframe_finish_psdu_is_not_being_received();
+    m_flags.rssi_started = false;
+    m_flags.rssi_settled = false;
+
+    // The ramp up PPI disables itself when used, so it must be enabled again. Shorts, interrupts,
+    // the packet pointer and the FEM configuration are left as set by nrf_802154_trx_receive_frame.
+    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, true);
+
+    // RADIO.EVENTS_DISABLED -> EGU.TASK -> EGU.EVENT -> RADIO.TASK_RXEN on the new frequency
+    trigger_disable_to_start_rampup();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return true;
+}
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+bool nrf_802154_trx_receive_frame_drop(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool     result = false;
+    uint32_t shorts = nrf_radio_shorts_get(NRF_RADIO);
+
+    assert(m_trx_state == TRX_STATE_RXFRAME);
+
+    // Stop the packet without the END event, so that the RADIO remains in RXIDLE.
+    nrf_radio_shorts_set(NRF_RADIO, shorts & ~NRF_RADIO_SHORT_END_DISABLE_MASK);
+    nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_STOP);
+
+    for (uint32_t i = 0; i < MAX_RXSTOP_CYCLES; i++)
+    {
+        if (nrf_radio_state_get(NRF_RADIO) == NRF_RADIO_STATE_RXIDLE)
+        {
+            result = true;
+            break;
+        }
+    }
+
+    if (result)
+    {
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_END);
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCOK);
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCERROR);
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_ADDRESS);
+
+        rxframe_finish_psdu_is_not_being_received();
+        m_flags.rssi_started = false;
+        m_flags.rssi_settled = false;
+
+        nrf_radio_bcc_set(NRF_RADIO, m_receive_bcc * 8U);
+
+        // The RADIO listens again without ramping up. The TIMER and the FEM are not affected.
+        nrf_radio_shorts_set(NRF_RADIO, shorts);
+        nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_START);
+    }
+    else
+    {
+        nrf_radio_shorts_set(NRF_RADIO, shorts);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#endif // !NRF_802154_DISABLE_BCC_MATCHING
+
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+void nrf_802154_trx_receive_ack_timeout_set(uint32_t timeout)
+{
+    m_rxack_timeout = timeout;
+}
+
+#endif // NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
 void nrf_802154_trx_receive_ack(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
     uint32_t shorts         = SHORTS_RX_ACK;
     uint32_t ints_to_enable = 0U;
+    bool     start_timer    = false;
 
     m_trx_state = TRX_STATE_RXACK;
 
@@ -996,12 +1431,44 @@ void nrf_802154_trx_receive_ack(void)
 
     nrf_radio_int_enable(NRF_RADIO, ints_to_enable);
 
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+    if (m_rxack_timeout != 0U)
+    {
+        // The TIMER is started together with the ramp up, on the DISABLED event that follows
+        // the end of the transmitted frame. It disables the RADIO if no ACK is received in time.
+        start_timer                 = true;
+        m_flags.rxack_timeout_armed = true;
+
+        nrf_timer_cc_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL1, m_rxack_timeout);
+        nrf_timer_event_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+        nrf_timer_shorts_enable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE1_STOP_MASK);
+        nrf_802154_trx_ppi_for_ack_timeout_set();
+    }
+#endif
+
     fem_for_lna_set();
+
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+    if (start_timer)
+    {
+        // The TIMER must keep counting after the LNA is activated.
+        nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
+    }
+#endif
+
     nrf_802154_trx_antenna_update();
-    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, false);
+    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, start_timer);
 
     trigger_disable_to_start_rampup();
 
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+    if (start_timer)
+    {
+        // The DISABLED event is handled only if it is caused by the expiry of the ACK wait.
+        nrf_radio_int_enable(NRF_RADIO, NRF_RADIO_INT_DISABLED_MASK);
+    }
+#endif
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -1066,7 +1533,8 @@ bool nrf_802154_trx_rssi_sample_is_available(void)
 
 void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
                                    bool                                    cca,
-                                   nrf_802154_trx_transmit_notifications_t notifications_mask)
+                                   nrf_802154_trx_transmit_notifications_t notifications_mask,
+                                   nrf_radio_txpower_t                     tx_power)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -1077,8 +1545,9 @@ void nrf_802154_trx_transmit_frame(const void                            * p_tra
 
     m_trx_state         = TRX_STATE_TXFRAME;
     m_transmit_with_cca = cca;
+    m_transmit_delayed  = false;
 
-    nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get());
+    nrf_radio_txpower_set(NRF_RADIO, tx_power);
     nrf_radio_packetptr_set(NRF_RADIO, p_transmit_buffer);
 
     // Set shorts
@@ -1131,6 +1600,125 @@ void nrf_802154_trx_transmit_frame(const void                            * p_tra
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+/** Disable the RADIO and wait until it reaches DISABLED state.
+ *
+ * @retval true   The RADIO is in DISABLED state.
+ * @retval false  The RADIO did not reach DISABLED state within TX ramp-down time.
+ */
+static bool radio_disable_and_wait(void)
+{
+    nrf_radio_state_t state = nrf_radio_state_get(NRF_RADIO);
+
+    if (state == NRF_RADIO_STATE_DISABLED)
+    {
+        return true;
+    }
+
+    if ((state != NRF_RADIO_STATE_TXDISABLE) && (state != NRF_RADIO_STATE_RXDISABLE))
+    {
+        nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+    }
+
+    // The longest ramp-down (TX) takes approximately 21us. Similarly to
+    // wait_until_radio_is_disabled, a single iteration of the loop is assumed to take one cycle.
+    for (uint32_t i = 0; i < MAX_TXRAMPDOWN_CYCLES; i++)
+    {
+        if (nrf_radio_state_get(NRF_RADIO) == NRF_RADIO_STATE_DISABLED)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void nrf_802154_trx_transmit_frame_delayed(const void        * p_transmit_buffer,
+                                           uint32_t            delay_us,
+                                           nrf_radio_txpower_t tx_power)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if ((delay_us <= (TXRU_TIME + EVENT_LAT)) || !radio_disable_and_wait())
+    {
+        nrf_802154_trx_transmit_frame(p_transmit_buffer,
+                                      false,
+                                      TRX_TRANSMIT_NOTIFICATION_NONE,
+                                      tx_power);
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+
+    uint32_t ints_to_enable         = NRF_RADIO_INT_PHYEND_MASK;
+    uint32_t timer_cc_ramp_up_start = delay_us - TXRU_TIME;
+
+    // Force the TIMER to count from 0 since now. The delay is measured from this moment.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_START);
+    nrf_timer_cc_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL1, timer_cc_ramp_up_start);
+
+    m_trx_state         = TRX_STATE_TXFRAME;
+    m_transmit_with_cca = false;
+    m_transmit_delayed  = true;
+
+    nrf_radio_txpower_set(NRF_RADIO, tx_power);
+    nrf_radio_packetptr_set(NRF_RADIO, p_transmit_buffer);
+    nrf_radio_shorts_set(NRF_RADIO, SHORTS_TX);
+
+    // Enable IRQs
+    nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_PHYEND);
+    nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_ADDRESS);
+#if NRF_802154_TX_STARTED_NOTIFY_ENABLED
+    ints_to_enable    |= NRF_RADIO_INT_ADDRESS_MASK;
+    m_flags.tx_started = false;
+#endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
+
+    nrf_radio_int_enable(NRF_RADIO, ints_to_enable);
+
+    // Clear TXREADY event to detect if PPI worked
+    nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_TXREADY);
+
+    // Set FEM the same way as for ACK transmission.
+    m_activate_tx_cc0_timeshifted = m_activate_tx_cc0;
+
+    m_activate_tx_cc0_timeshifted.event.timer.counter_period.end =
+        timer_cc_ramp_up_start + TXRU_TIME + nrf_802154_pib_fem_pa_activation_delay_get();
+
+    if (!m_tx_fem_bypass &&
+        (nrf_802154_fal_pa_configuration_set(&m_activate_tx_cc0_timeshifted, NULL) ==
+         NRFX_SUCCESS))
+    {
+        nrf_timer_shorts_enable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
+    }
+    else
+    {
+        nrf_timer_shorts_enable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE1_STOP_MASK);
+    }
+
+    nrf_802154_trx_antenna_update();
+
+    // TIMER's CC1 triggers TXEN as for ACK transmission.
+    nrf_802154_trx_ppi_for_ack_tx_set();
+
+    // Detect if PPI will work in future or has just worked.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_CAPTURE3);
+    uint32_t timer_cc_now = nrf_timer_cc_get(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL3);
+
+    if (timer_cc_now >= timer_cc_ramp_up_start)
+    {
+        nrf_802154_trx_ppi_for_ramp_up_propagation_delay_wait();
+
+        if ((nrf_radio_state_get(NRF_RADIO) != NRF_RADIO_STATE_TXRU) &&
+            !nrf_radio_event_check(NRF_RADIO, NRF_RADIO_EVENT_TXREADY))
+        {
+            // The moment was missed while configuring peripherals. Start as soon as possible.
+            nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_TXEN);
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
 bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_us)
 {
     /* Assumptions on peripherals
@@ -1178,8 +1766,8 @@ bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_
     m_activate_tx_cc0_timeshifted = m_activate_tx_cc0;
 
     // Set the moment for FEM at which real transmission starts.
-    m_activate_tx_cc0_timeshifted.event.timer.counter_period.end = timer_cc_ramp_up_start +
-                                                                   TXRU_TIME;
+    m_activate_tx_cc0_timeshifted.event.timer.counter_period.end =
+        timer_cc_ramp_up_start + TXRU_TIME + nrf_802154_pib_fem_pa_activation_delay_get();
 
     if (nrf_802154_fal_pa_configuration_set(&m_activate_tx_cc0_timeshifted, NULL) == NRFX_SUCCESS)
     {
@@ -1553,10 +2141,31 @@ static void receive_frame_abort(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+/** Stop the TIMER from ending the ACK reception. */
+static void rxack_timeout_disarm(void)
+{
+    if (m_flags.rxack_timeout_armed)
+    {
+        m_flags.rxack_timeout_armed = false;
+
+        nrf_802154_trx_ppi_for_ack_timeout_clear();
+        nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, true);
+        nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE1_STOP_MASK);
+        nrf_radio_int_disable(NRF_RADIO, NRF_RADIO_INT_DISABLED_MASK);
+    }
+}
+
+#endif // NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
 static void rxack_finish_disable_ppis(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+    rxack_timeout_disarm();
+#endif
+
     nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, false);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -1754,23 +2363,54 @@ void nrf_802154_trx_modulated_carrier(const void * p_transmit_buffer)
 
     m_trx_state = TRX_STATE_MODULATED_CARRIER;
 
+    bool start_timer = false;
+
     // Set Tx Power
     nrf_radio_txpower_set(NRF_RADIO, nrf_802154_pib_tx_power_get());
 
     // Set Tx buffer
     nrf_radio_packetptr_set(NRF_RADIO, p_transmit_buffer);
 
-    // Set shorts
-    nrf_radio_shorts_set(NRF_RADIO, SHORTS_MOD_CARRIER);
+#if NRF_802154_PER_TEST_ENABLED
+    if (m_per_tx_remaining != 0U)
+    {
+        // The first frame is sent when the RADIO is ready. The next ones are started by the TIMER,
+        // which is started together with the ramp up and cleared on each interval.
+        start_timer = true;
+
+        nrf_radio_shorts_set(NRF_RADIO, SHORTS_PER_TX);
+
+        nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+        nrf_timer_cc_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL1, m_per_tx_interval);
+        nrf_timer_shorts_enable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE1_CLEAR_MASK);
+        nrf_802154_trx_ppi_for_per_test_set();
+
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_PHYEND);
+        nrf_radio_int_enable(NRF_RADIO, NRF_RADIO_INT_PHYEND_MASK);
+    }
+    else
+#endif
+    {
+        // Set shorts
+        nrf_radio_shorts_set(NRF_RADIO, SHORTS_MOD_CARRIER);
+    }
 
     // Set FEM
     fem_for_pa_set();
 
+#if NRF_802154_PER_TEST_ENABLED
+    if (start_timer)
+    {
+        // The TIMER must keep counting after the PA is activated.
+        nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
+    }
+#endif
+
     // Select antenna
     nrf_802154_trx_antenna_update();
 
     // Set PPIs
-    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_TXEN, false);
+    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_TXEN, start_timer);
 
     trigger_disable_to_start_rampup();
 
@@ -1781,6 +2421,15 @@ void nrf_802154_trx_modulated_carrier_restart(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_PER_TEST_ENABLED
+    if (m_trx_state == TRX_STATE_FINISHED)
+    {
+        // The PER test burst has already ended.
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     assert(m_trx_state == TRX_STATE_MODULATED_CARRIER);
 
     // Modulated carrier PPIs are configured without self-disabling
@@ -1792,10 +2441,76 @@ void nrf_802154_trx_modulated_carrier_restart(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_PER_TEST_ENABLED
+/** Stop the TIMER from starting the frames of the PER test burst. */
+static void per_test_transmit_finish(void)
+{
+    nrf_802154_trx_ppi_for_per_test_clear();
+    nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_TXEN, true);
+    nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE1_CLEAR_MASK);
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+    nrf_radio_int_disable(NRF_RADIO, NRF_RADIO_INT_PHYEND_MASK);
+}
+
+/** Count a frame of the PER test burst and end the burst after the last one. */
+static void per_test_transmit_frame_transmitted(void)
+{
+    if (m_per_tx_remaining > 1U)
+    {
+        m_per_tx_remaining--;
+        return;
+    }
+
+    m_per_tx_remaining = 0U;
+
+    per_test_transmit_finish();
+    nrf_radio_shorts_set(NRF_RADIO, SHORTS_IDLE);
+    fem_for_pa_reset();
+    nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+
+    // The RADIO stays disabled until the higher layer requests another operation.
+    m_trx_state = TRX_STATE_FINISHED;
+}
+
+void nrf_802154_trx_per_test_transmit_set(uint32_t count, uint32_t interval)
+{
+    m_per_tx_remaining = count;
+    m_per_tx_interval  = interval;
+}
+
+uint32_t nrf_802154_trx_per_test_transmit_remaining_get(void)
+{
+    return m_per_tx_remaining;
+}
+
+void nrf_802154_trx_per_test_receive_set(bool enabled)
+{
+    if (enabled)
+    {
+        m_per_rx_crcok    = 0U;
+        m_per_rx_crcerror = 0U;
+    }
+
+    m_per_rx_enabled = enabled;
+}
+
+void nrf_802154_trx_per_test_receive_counters_get(uint32_t * p_crcok, uint32_t * p_crcerror)
+{
+    *p_crcok    = m_per_rx_crcok;
+    *p_crcerror = m_per_rx_crcerror;
+}
+
+#endif // NRF_802154_PER_TEST_ENABLED
+
 static void modulated_carrier_abort()
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
+#if NRF_802154_PER_TEST_ENABLED
+    // The remaining frames of the burst are sent when the modulated carrier is started again.
+    per_test_transmit_finish();
+#endif
+
     nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_TXEN, false);
 
     nrf_radio_shorts_set(NRF_RADIO, SHORTS_IDLE);
@@ -1894,6 +2609,21 @@ static void irq_handler_address(void)
             break;
 
         case TRX_STATE_RXACK:
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+            if (m_flags.rxack_timeout_armed)
+            {
+                rxack_timeout_disarm();
+
+                // The ACK wait might have expired just before it was disarmed.
+                if (nrf_timer_event_check(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1))
+                {
+                    rxack_finish();
+                    m_trx_state = TRX_STATE_FINISHED;
+                    nrf_802154_trx_receive_ack_timeout();
+                    break;
+                }
+            }
+#endif
             m_flags.rssi_started = true;
             nrf_802154_trx_receive_ack_started();
             break;
@@ -1942,7 +2672,8 @@ static void irq_handler_bcmatch(void)
 
     current_bcc = nrf_radio_bcc_get(NRF_RADIO) / 8U;
 
-    next_bcc = nrf_802154_trx_receive_frame_bcmatched(current_bcc);
+    irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_FRAME_BCMATCHED,
+                       next_bcc = nrf_802154_trx_receive_frame_bcmatched(current_bcc));
 
     if (next_bcc > current_bcc)
     {
@@ -1963,6 +2694,15 @@ static void irq_handler_crcerror(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_PER_TEST_ENABLED
+    if (m_per_rx_active && (m_trx_state == TRX_STATE_RXFRAME))
+    {
+        m_per_rx_crcerror++;
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     switch (m_trx_state)
     {
         case TRX_STATE_RXFRAME:
@@ -1999,13 +2739,23 @@ static void irq_handler_crcok(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_PER_TEST_ENABLED
+    if (m_per_rx_active && (m_trx_state == TRX_STATE_RXFRAME))
+    {
+        m_per_rx_crcok++;
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     switch (m_trx_state)
     {
         case TRX_STATE_RXFRAME:
             m_flags.rssi_started = true;
             rxframe_finish();
             m_trx_state = TRX_STATE_RXFRAME_FINISHED;
-            nrf_802154_trx_receive_frame_received();
+            irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_FRAME_RECEIVED,
+                               nrf_802154_trx_receive_frame_received());
             break;
 
         case TRX_STATE_RXACK:
@@ -2025,7 +2775,20 @@ static void txframe_finish_disable_ppis(bool cca)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    nrf_802154_trx_ppi_for_ramp_up_clear(cca ? NRF_RADIO_TASK_RXEN : NRF_RADIO_TASK_TXEN, false);
+    if (m_transmit_delayed)
+    {
+        // The transmission was triggered by the TIMER through ACK transmission PPI.
+        nrf_802154_trx_ppi_for_ack_tx_clear();
+        nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE,
+                                 NRF_TIMER_SHORT_COMPARE0_STOP_MASK |
+                                 NRF_TIMER_SHORT_COMPARE1_STOP_MASK);
+        m_transmit_delayed = false;
+    }
+    else
+    {
+        nrf_802154_trx_ppi_for_ramp_up_clear(cca ? NRF_RADIO_TASK_RXEN : NRF_RADIO_TASK_TXEN,
+                                             false);
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -2194,6 +2957,12 @@ static void irq_handler_phyend(void)
             nrf_802154_trx_transmit_ack_transmitted();
             break;
 
+#if NRF_802154_PER_TEST_ENABLED
+        case TRX_STATE_MODULATED_CARRIER:
+            per_test_transmit_frame_transmitted();
+            break;
+#endif
+
         default:
             assert(false);
     }
@@ -2226,6 +2995,18 @@ static void irq_handler_disabled(void)
             go_idle_finish();
             break;
 
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+        case TRX_STATE_RXACK:
+            // The RADIO is also disabled at the end of the transmitted frame, before the ramp up.
+            if (nrf_timer_event_check(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1))
+            {
+                rxack_finish();
+                m_trx_state = TRX_STATE_FINISHED;
+                nrf_802154_trx_receive_ack_timeout();
+            }
+            break;
+#endif
+
         default:
             assert(false);
     }
@@ -2314,6 +3095,8 @@ static void irq_handler_sync(void)
 
 void nrf_802154_radio_irq_handler(void)
 {
+    uint32_t irq_start = nrf_802154_stat_irq_cycles_start();
+
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
     // Prevent interrupting of this handler by requests from higher priority code.
@@ -2329,7 +3112,7 @@ void nrf_802154_radio_irq_handler(void)
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_SYNC);
         nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, EGU_SYNC_EVENT);
 
-        irq_handler_sync();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_SYNC, irq_handler_sync());
     }
 #endif
 
@@ -2338,7 +3121,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_READY);
 
-        irq_handler_ready();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_READY, irq_handler_ready());
     }
 
     if (nrf_radio_int_enable_check(NRF_RADIO, NRF_RADIO_INT_ADDRESS_MASK) &&
@@ -2346,7 +3129,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_ADDRESS);
 
-        irq_handler_address();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_ADDRESS, irq_handler_address());
     }
 
 #if !NRF_802154_DISABLE_BCC_MATCHING
@@ -2356,7 +3139,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_BCMATCH);
 
-        irq_handler_bcmatch();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_BCMATCH, irq_handler_bcmatch());
     }
 
 #endif // !NRF_802154_DISABLE_BCC_MATCHING
@@ -2367,7 +3150,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCERROR);
 
-        irq_handler_crcerror();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_CRCERROR, irq_handler_crcerror());
     }
 #endif // !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
 
@@ -2376,7 +3159,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCOK);
 
-        irq_handler_crcok();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_CRCOK, irq_handler_crcok());
     }
 
     if (nrf_radio_int_enable_check(NRF_RADIO, NRF_RADIO_INT_PHYEND_MASK) &&
@@ -2384,7 +3167,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_PHYEND);
 
-        irq_handler_phyend();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_PHYEND, irq_handler_phyend());
     }
 
     if (nrf_radio_int_enable_check(NRF_RADIO, NRF_RADIO_INT_DISABLED_MASK) &&
@@ -2392,7 +3175,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
 
-        irq_handler_disabled();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_DISABLED, irq_handler_disabled());
     }
 
     if (nrf_radio_int_enable_check(NRF_RADIO, NRF_RADIO_INT_CCAIDLE_MASK) &&
@@ -2400,7 +3183,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CCAIDLE);
 
-        irq_handler_ccaidle();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_CCAIDLE, irq_handler_ccaidle());
     }
 
     if (nrf_radio_int_enable_check(NRF_RADIO, NRF_RADIO_INT_CCABUSY_MASK) &&
@@ -2408,7 +3191,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CCABUSY);
 
-        irq_handler_ccabusy();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_CCABUSY, irq_handler_ccabusy());
     }
 
     if (nrf_radio_int_enable_check(NRF_RADIO, NRF_RADIO_INT_EDEND_MASK) &&
@@ -2416,12 +3199,14 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_EDEND);
 
-        irq_handler_edend();
+        irq_cycles_measure(NRF_802154_STAT_IRQ_CYCLES_EDEND, irq_handler_edend());
     }
 
     nrf_802154_critical_section_exit();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_stat_irq_cycles_record(NRF_802154_STAT_IRQ_CYCLES_RADIO_IRQ, irq_start);
 }
 
 #if NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
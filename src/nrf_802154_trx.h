@@ -43,6 +43,8 @@
 #include <stdint.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+#include "nrf_802154_sl_ant_div.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -159,6 +161,25 @@ void nrf_802154_trx_disable(void);
  */
 void nrf_802154_trx_antenna_update(void);
 
+/**@brief Selects the antenna used for the following transmissions.
+ *
+ * The antenna is used instead of the one configured for transmission if the antenna diversity
+ * mode for transmission is @ref NRF_802154_SL_ANT_DIV_MODE_MANUAL. It takes effect when
+ * the next transmission starts.
+ *
+ * @param[in] antenna   Antenna to use, or @ref NRF_802154_SL_ANT_DIV_ANTENNA_NONE to use
+ *                      the antenna configured for transmission.
+ */
+void nrf_802154_trx_tx_antenna_select(nrf_802154_sl_ant_div_antenna_t antenna);
+
+/**@brief Selects if the FEM PA is activated for the following transmissions.
+ *
+ * It takes effect when the next transmission starts. It does not apply to ACK frames.
+ *
+ * @param[in] bypass    If the PA is to be left inactive.
+ */
+void nrf_802154_trx_tx_fem_bypass_set(bool bypass);
+
 /**@brief Sets radio channel to use.
  *
  * @param[in] channel   Channel number to set (11-26).
@@ -168,6 +189,23 @@ void nrf_802154_trx_channel_set(uint8_t channel);
 /**@brief Updates CCA configuration in the RADIO peripheral according to PIB. */
 void nrf_802154_trx_cca_configuration_update(void);
 
+/**@brief Checks if the CCA ED threshold in the RADIO peripheral is corrected for a stale
+ *        temperature.
+ *
+ * @retval true     The temperature correction value changed since the CCA configuration was set.
+ * @retval false    The CCA configuration is corrected for the current temperature.
+ */
+bool nrf_802154_trx_cca_configuration_is_outdated(void);
+
+/**@brief Sets CCA configuration in the RADIO peripheral regardless of PIB.
+ *
+ * The configuration is in use until it is replaced, for example by
+ * @ref nrf_802154_trx_cca_configuration_update.
+ *
+ * @param[in] p_cca_cfg  Pointer to the CCA configuration to set.
+ */
+void nrf_802154_trx_cca_configuration_set(const nrf_802154_cca_cfg_t * p_cca_cfg);
+
 /**@brief Puts the trx module into receive frame mode.
  *
  * The frame will be received into buffer set by @ref nrf_802154_trx_receive_buffer_set.
@@ -209,6 +247,37 @@ void nrf_802154_trx_cca_configuration_update(void);
 void nrf_802154_trx_receive_frame(uint8_t                                bcc,
                                   nrf_802154_trx_receive_notifications_t notifications_mask);
 
+/**@brief Restarts receiving frames on the channel set by @ref nrf_802154_trx_channel_set.
+ *
+ * The frequency is not changed automatically when the channel is changed during reception.
+ * This function ramps the RADIO down and up again on the new frequency, keeping the receive buffer,
+ * the notifications mask, the BCC and the FEM configuration set by
+ * @ref nrf_802154_trx_receive_frame. It is faster than a call to @ref nrf_802154_trx_abort
+ * followed by @ref nrf_802154_trx_receive_frame.
+ *
+ * @retval true   The reception was restarted.
+ * @retval false  The trx module is not receiving frames, or a PSDU is being received. Nothing was
+ *                changed.
+ */
+bool nrf_802154_trx_receive_frame_restart(void);
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+/**@brief Drops the frame being received and starts listening for the next one.
+ *
+ * The RADIO stops receiving the current packet and restarts reception from the RXIDLE state,
+ * without ramping down and up. The receive buffer, the notifications mask and the FEM
+ * configuration are kept. No handlers are called for the dropped frame.
+ *
+ * @note This function may be called from @ref nrf_802154_trx_receive_frame_bcmatched handler only.
+ *
+ * @retval true   The RADIO listens for the next frame.
+ * @retval false  The RADIO did not stop in time. Reception must be restarted with
+ *                @ref nrf_802154_trx_abort and @ref nrf_802154_trx_receive_frame.
+ */
+bool nrf_802154_trx_receive_frame_drop(void);
+
+#endif // !NRF_802154_DISABLE_BCC_MATCHING
+
 /**@brief Puts the trx module into receive ACK mode.
  *
  * The ack frame will be received into buffer set by @ref nrf_802154_trx_receive_buffer_set.
@@ -218,9 +287,21 @@ void nrf_802154_trx_receive_frame(uint8_t                                bcc,
  * - when a frame is received with correct crc, @ref nrf_802154_trx_receive_ack_received is called.
  * - when a frame is received with incorrect crc, @ref nrf_802154_trx_receive_ack_crcerror is called.
  * - no bcmatch events are generated.
+ * - when the wait set with @ref nrf_802154_trx_receive_ack_timeout_set expires before a frame
+ *   has started being received, @ref nrf_802154_trx_receive_ack_timeout is called.
  */
 void nrf_802154_trx_receive_ack(void);
 
+/**@brief Sets the time the receive ACK mode waits for an ACK.
+ *
+ * The time is measured by the TIMER from the end of the transmitted frame and applies to the
+ * subsequent calls to @ref nrf_802154_trx_receive_ack. When it elapses before the RADIO receives
+ * the SHR of a frame, the receiver is disabled by the hardware.
+ *
+ * @param[in] timeout  Time to wait for an ACK in microseconds, or 0 to wait until aborted.
+ */
+void nrf_802154_trx_receive_ack_timeout_set(uint32_t timeout);
+
 /**@brief Starts RSSI measurement.
  *
  * @note This function succeeds when TRX module is in receive frame state only (started with @ref nrf_802154_trx_receive_frame)
@@ -286,6 +367,18 @@ bool nrf_802154_trx_psdu_is_being_received(void);
  */
 bool nrf_802154_trx_receive_is_buffer_missing(void);
 
+/**@brief Checks if the receiver waits for a receive buffer, from any context.
+ *
+ * Unlike @ref nrf_802154_trx_receive_is_buffer_missing, this function does not check the state
+ * of the trx module, so it can be called from contexts that preempt the driver. The result is
+ * only a hint that must be confirmed with @ref nrf_802154_trx_receive_is_buffer_missing in
+ * the critical section.
+ *
+ * @retval true When the receive buffer may be missing.
+ * @retval false Otherwise.
+ */
+bool nrf_802154_trx_receive_buffer_missing_hint_get(void);
+
 /**@brief Sets pointer to a receive buffer.
  *
  * @param p_receive_buffer If NULL the next call to @ref nrf_802154_trx_receive_frame or
@@ -339,11 +432,33 @@ bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer);
  *
  * @param notifications_mask Selects additional notifications generated during a frame transmission.
  *                           It is bitwise combination of @ref nrf_802154_trx_transmit_notifications_t values.
+ *
+ * @param tx_power           Transmit power to use for the frame.
  * @note To transmit ack after frame is received use @ref nrf_802154_trx_transmit_ack.
  */
 void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
                                    bool                                    cca,
-                                   nrf_802154_trx_transmit_notifications_t notifications_mask);
+                                   nrf_802154_trx_transmit_notifications_t notifications_mask,
+                                   nrf_radio_txpower_t                     tx_power);
+
+/**@brief Begins frame transmit operation without CCA at a precise moment.
+ *
+ * The transmission is triggered by the TIMER peripheral through (D)PPI, so that the RADIO starts
+ * sending the synchronization header (SHR) exactly @p delay_us microseconds after this function
+ * is called. Notifications are the same as for @ref nrf_802154_trx_transmit_frame called with
+ * cca==false.
+ *
+ * If @p delay_us is too short to schedule the ramp up or the RADIO could not be disabled in time,
+ * the transmission starts immediately, as if @ref nrf_802154_trx_transmit_frame was called.
+ *
+ * @param p_transmit_buffer  Pointer to a buffer containing frame to transmit. The requirements are
+ *                           the same as for @ref nrf_802154_trx_transmit_frame.
+ * @param delay_us           Time in microseconds from now to the start of the transmission on air.
+ * @param tx_power           Transmit power to use for the frame.
+ */
+void nrf_802154_trx_transmit_frame_delayed(const void        * p_transmit_buffer,
+                                           uint32_t            delay_us,
+                                           nrf_radio_txpower_t tx_power);
 
 /**@brief Puts the trx module into transmit ACK mode.
  *
@@ -407,6 +522,41 @@ void nrf_802154_trx_modulated_carrier(const void * p_transmit_buffer);
 /** @brief Restarts generating modulated carrier.*/
 void nrf_802154_trx_modulated_carrier_restart(void);
 
+#if NRF_802154_PER_TEST_ENABLED
+
+/**@brief Configures the PER test burst sent by the next @ref nrf_802154_trx_modulated_carrier.
+ *
+ * While the burst is sent, the buffer is transmitted @p count times, started every @p interval
+ * microseconds by the TIMER. After the last frame the RADIO is disabled and the trx module enters
+ * @c FINISHED state, which is left with a call to any other operation.
+ *
+ * @param count     Number of frames to transmit. 0 selects the continuous modulated carrier.
+ * @param interval  Interval between the starts of consecutive frames in microseconds.
+ */
+void nrf_802154_trx_per_test_transmit_set(uint32_t count, uint32_t interval);
+
+/**@brief Gets the number of frames left to transmit in the PER test burst. */
+uint32_t nrf_802154_trx_per_test_transmit_remaining_get(void);
+
+/**@brief Selects if the next @ref nrf_802154_trx_receive_frame only counts the received frames.
+ *
+ * In the counting mode the received frames overwrite an internal buffer, no handlers are called
+ * and the receiver is restarted by the RADIO peripheral at the end of each frame.
+ * Enabling the counting mode resets the counters.
+ *
+ * @param enabled  If the received frames are to be only counted.
+ */
+void nrf_802154_trx_per_test_receive_set(bool enabled);
+
+/**@brief Gets the numbers of frames counted in the PER test receive mode.
+ *
+ * @param[out] p_crcok     Number of frames received with correct CRC.
+ * @param[out] p_crcerror  Number of frames received with incorrect CRC.
+ */
+void nrf_802154_trx_per_test_receive_counters_get(uint32_t * p_crcok, uint32_t * p_crcerror);
+
+#endif // NRF_802154_PER_TEST_ENABLED
+
 /**@brief Puts trx module into energy detection mode.
  *
  * Operation ends up with a call to @ref nrf_802154_trx_energy_detection_finished handler.
@@ -585,6 +735,26 @@ extern void nrf_802154_trx_receive_ack_received(void);
  */
 extern void nrf_802154_trx_receive_ack_crcerror(void);
 
+/**@brief Handler called when the wait for an ack expired.
+ *
+ * This handler is called from an ISR when:
+ * - receive ack operation has been started with a call to @ref nrf_802154_trx_receive_ack
+ * - the time set with @ref nrf_802154_trx_receive_ack_timeout_set elapsed before the RADIO
+ *   received synchronization header (SHR) of a frame
+ *
+ * When this handler is called following holds:
+ * - the RADIO peripheral is disabled
+ * - trx module is in @c FINISHED state.
+ *
+ * Implementation is responsible for:
+ * - leaving @c FINISHED state. It may do this by call to:
+ *     - @ref nrf_802154_trx_receive_frame,
+ *     - @ref nrf_802154_trx_transmit_frame,
+ *     - @ref nrf_802154_trx_go_idle,
+ *     - @ref nrf_802154_trx_disable.
+ */
+extern void nrf_802154_trx_receive_ack_timeout(void);
+
 /**@brief Handler called when a cca operation during transmit attempt started.
  *
  * This handler is called from an ISR when:
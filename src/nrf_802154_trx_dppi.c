@@ -29,12 +29,14 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_TRX_PPI
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_TRX_PPI
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_TRX_PPI_LOG_VERBOSITY
 
 #include "nrf_802154_trx_ppi_api.h"
 
 #include "nrf_802154_debug_log.h"
 #include "nrf_802154_peripherals.h"
+#include "fem/nrf_fem_protocol_api.h"
 
 #include "hal/nrf_dppi.h"
 #include "hal/nrf_egu.h"
@@ -46,11 +48,15 @@
 
 #define DPPI_CHGRP_RAMP_UP          NRF_DPPI_CHANNEL_GROUP0 ///< PPI group used to disable self-disabling PPIs
 #define DPPI_CHGRP_RAMP_UP_DIS_TASK NRF_DPPI_TASK_CHG0_DIS  ///< PPI task used to disable self-disabling PPIs
+#define DPPI_CHGRP_ABORT            NRF_802154_DPPI_ABORT_GROUP ///< PPI group used to disable PPIs when async event aborting radio operation is propagated through the system
 
 #define PPI_DISABLED_EGU            NRF_802154_DPPI_RADIO_DISABLED_TO_EGU
 #define PPI_EGU_RAMP_UP             NRF_802154_DPPI_EGU_TO_RADIO_RAMP_UP
 #define PPI_TIMER_TX_ACK            NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_TXEN
 #define PPI_RADIO_SYNC_EGU_SYNC     NRF_802154_DPPI_RADIO_SYNC_TO_EGU_SYNC
+#define PPI_RADIO_END_TIMESTAMP     NRF_802154_DPPI_RADIO_END_TO_TIMER_CAPTURE
+
+#define TIMER_FRAME_TIMESTAMP_TASK  NRF_TIMER_TASK_CAPTURE0 ///< HP timer task capturing frame end
 
 void nrf_802154_trx_ppi_for_ramp_up_set(nrf_radio_task_t ramp_up_task, bool start_timer)
 {
@@ -83,9 +89,9 @@ void nrf_802154_trx_ppi_for_ramp_up_clear(nrf_radio_task_t ramp_up_task, bool st
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    nrf_dppi_channels_disable(NRF_DPPIC,
-                              (1UL << PPI_EGU_RAMP_UP) |
-                              (1UL << PPI_DISABLED_EGU));
+    // RADIO_DISABLED stays published on PPI_DISABLED_EGU, as the FEM abort relies on it.
+    // The connection is broken in nrf_802154_trx_ppi_for_fem_abort_clear.
+    nrf_dppi_channels_disable(NRF_DPPIC, (1UL << PPI_EGU_RAMP_UP));
 
     nrf_egu_publish_clear(NRF_802154_EGU_INSTANCE, EGU_EVENT);
     nrf_radio_subscribe_clear(NRF_RADIO, ramp_up_task);
@@ -98,7 +104,6 @@ void nrf_802154_trx_ppi_for_ramp_up_clear(nrf_radio_task_t ramp_up_task, bool st
     }
 
     nrf_egu_subscribe_clear(NRF_802154_EGU_INSTANCE, EGU_TASK);
-    nrf_radio_publish_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -164,6 +169,62 @@ void nrf_802154_trx_ppi_for_ack_tx_clear(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+void nrf_802154_trx_ppi_for_ack_timeout_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    // TIMER_COMPARE1 ----> RADIO_DISABLE
+    nrf_radio_subscribe_set(NRF_RADIO, NRF_RADIO_TASK_DISABLE, PPI_TIMER_TX_ACK);
+    nrf_timer_publish_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1, PPI_TIMER_TX_ACK);
+
+    nrf_dppi_channels_enable(NRF_DPPIC, (1UL << PPI_TIMER_TX_ACK));
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_ack_timeout_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_dppi_channels_disable(NRF_DPPIC, (1UL << PPI_TIMER_TX_ACK));
+
+    nrf_radio_subscribe_clear(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+    nrf_timer_publish_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
+#if NRF_802154_PER_TEST_ENABLED
+void nrf_802154_trx_ppi_for_per_test_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    // TIMER_COMPARE1 ----> RADIO_START
+    nrf_radio_subscribe_set(NRF_RADIO, NRF_RADIO_TASK_START, PPI_TIMER_TX_ACK);
+    nrf_timer_publish_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1, PPI_TIMER_TX_ACK);
+
+    nrf_dppi_channels_enable(NRF_DPPIC, (1UL << PPI_TIMER_TX_ACK));
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_per_test_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_dppi_channels_disable(NRF_DPPIC, (1UL << PPI_TIMER_TX_ACK));
+
+    nrf_radio_subscribe_clear(NRF_RADIO, NRF_RADIO_TASK_START);
+    nrf_timer_publish_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_PER_TEST_ENABLED
+
 void nrf_802154_trx_ppi_for_fem_set(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -187,25 +248,53 @@ bool nrf_802154_trx_ppi_for_fem_powerdown_set(NRF_TIMER_Type * p_instance,
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    // TODO: Implement this function when FEM API supports nRF53
+    // PPI_EGU_RAMP_UP is reused here on purpose, to save resources,
+    // as fem powerdown cannot be scheduled simultaneously with radio ramp-up.
+    bool result = nrf_fem_prepare_powerdown(p_instance, compare_channel, PPI_EGU_RAMP_UP);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
-    return false;
+
+    return result;
 }
 
 void nrf_802154_trx_ppi_for_fem_powerdown_clear(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    // TODO: Implement this function when FEM API supports nRF53
+    nrf_dppi_channels_disable(NRF_DPPIC, (1UL << PPI_EGU_RAMP_UP));
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
 uint32_t nrf_802154_trx_ppi_group_for_abort_get(void)
 {
-    // TODO: Implement it when external event (like coex) can abort radio operation
-    return 0;
+    return (uint32_t)DPPI_CHGRP_ABORT;
+}
+
+void nrf_802154_trx_ppi_for_fem_abort_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    // RADIO_DISABLED is published for the whole time the transceiver is enabled, so that
+    // FEM connections subscribed to PPI_DISABLED_EGU are broken by hardware.
+    nrf_radio_publish_set(NRF_RADIO, NRF_RADIO_EVENT_DISABLED, PPI_DISABLED_EGU);
+    nrf_dppi_channels_enable(NRF_DPPIC, (1UL << PPI_DISABLED_EGU));
+
+    nrf_802154_fal_abort_set(PPI_DISABLED_EGU, DPPI_CHGRP_ABORT);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_fem_abort_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_802154_fal_abort_clear();
+
+    nrf_dppi_channels_disable(NRF_DPPIC, (1UL << PPI_DISABLED_EGU));
+    nrf_radio_publish_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
 #if defined(RADIO_INTENSET_SYNC_Msk)
@@ -232,3 +321,31 @@ void nrf_802154_trx_ppi_for_radio_sync_clear(nrf_egu_task_t task)
 }
 
 #endif
+
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+void nrf_802154_trx_ppi_for_frame_timestamp_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_radio_publish_set(NRF_RADIO, NRF_RADIO_EVENT_END, PPI_RADIO_END_TIMESTAMP);
+    nrf_timer_subscribe_set(NRF_802154_HIGH_PRECISION_TIMER_INSTANCE,
+                            TIMER_FRAME_TIMESTAMP_TASK,
+                            PPI_RADIO_END_TIMESTAMP);
+    nrf_dppi_channels_enable(NRF_DPPIC, (1UL << PPI_RADIO_END_TIMESTAMP));
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_frame_timestamp_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_dppi_channels_disable(NRF_DPPIC, (1UL << PPI_RADIO_END_TIMESTAMP));
+    nrf_radio_publish_clear(NRF_RADIO, NRF_RADIO_EVENT_END);
+    nrf_timer_subscribe_clear(NRF_802154_HIGH_PRECISION_TIMER_INSTANCE,
+                              TIMER_FRAME_TIMESTAMP_TASK);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
@@ -29,7 +29,8 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_TRX_PPI
+#define NRF_802154_MODULE_ID        NRF_802154_DRV_MODULE_ID_TRX_PPI
+#define NRF_802154_SL_LOG_VERBOSITY NRF_802154_TRX_PPI_LOG_VERBOSITY
 
 #include "nrf_802154_trx_ppi_api.h"
 
@@ -37,6 +38,8 @@
 
 #include "nrf_802154_debug_log.h"
 #include "nrf_802154_peripherals.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#include "fem/nrf_fem_protocol_api.h"
 
 #include "hal/nrf_egu.h"
 #include "hal/nrf_ppi.h"
@@ -56,6 +59,9 @@
 #define PPI_EGU_TIMER_START        NRF_802154_PPI_EGU_TO_TIMER_START          ///< PPI that connects EGU event with TIMER START task
 #define PPI_TIMER_TX_ACK           NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN ///< PPI that connects TIMER COMPARE event with RADIO TXEN task
 #define PPI_RADIO_SYNC_EGU_SYNC    NRF_802154_PPI_RADIO_SYNC_TO_EGU_SYNC      ///< PPI that connects RADIO SYNC event with EGU task for SYNC channel
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+#define PPI_RADIO_END_TIMESTAMP    NRF_802154_PPI_RADIO_END_TO_TIMER_CAPTURE  ///< PPI that connects RADIO END event with HP timer frame capture task
+#endif
 
 void nrf_802154_trx_ppi_for_ramp_up_set(nrf_radio_task_t ramp_up_task, bool start_timer)
 {
@@ -190,6 +196,62 @@ void nrf_802154_trx_ppi_for_ack_tx_clear(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+void nrf_802154_trx_ppi_for_ack_timeout_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_endpoint_setup(NRF_PPI,
+                                   PPI_TIMER_TX_ACK,
+                                   nrf_timer_event_address_get(NRF_802154_TIMER_INSTANCE,
+                                                               NRF_TIMER_EVENT_COMPARE1),
+                                   nrf_radio_task_address_get(NRF_RADIO,
+                                                              NRF_RADIO_TASK_DISABLE));
+    nrf_ppi_channel_enable(NRF_PPI, PPI_TIMER_TX_ACK);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_ack_timeout_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_disable(NRF_PPI, PPI_TIMER_TX_ACK);
+    nrf_ppi_channel_endpoint_setup(NRF_PPI, PPI_TIMER_TX_ACK, 0, 0);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_PRECISE_ACK_TIMEOUT_HW_TIMER_ENABLED
+
+#if NRF_802154_PER_TEST_ENABLED
+void nrf_802154_trx_ppi_for_per_test_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_endpoint_setup(NRF_PPI,
+                                   PPI_TIMER_TX_ACK,
+                                   nrf_timer_event_address_get(NRF_802154_TIMER_INSTANCE,
+                                                               NRF_TIMER_EVENT_COMPARE1),
+                                   nrf_radio_task_address_get(NRF_RADIO,
+                                                              NRF_RADIO_TASK_START));
+    nrf_ppi_channel_enable(NRF_PPI, PPI_TIMER_TX_ACK);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_per_test_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_disable(NRF_PPI, PPI_TIMER_TX_ACK);
+    nrf_ppi_channel_endpoint_setup(NRF_PPI, PPI_TIMER_TX_ACK, 0, 0);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_PER_TEST_ENABLED
+
 void nrf_802154_trx_ppi_for_fem_set(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -243,6 +305,25 @@ uint32_t nrf_802154_trx_ppi_group_for_abort_get(void)
     return (uint32_t)PPI_CHGRP_ABORT;
 }
 
+void nrf_802154_trx_ppi_for_fem_abort_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_802154_fal_abort_set(nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_DISABLED),
+                             PPI_CHGRP_ABORT);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_fem_abort_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_802154_fal_abort_clear();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
 #if defined(RADIO_INTENSET_SYNC_Msk)
 void nrf_802154_trx_ppi_for_radio_sync_set(nrf_egu_task_t task)
 {
@@ -269,3 +350,29 @@ void nrf_802154_trx_ppi_for_radio_sync_clear(nrf_egu_task_t task)
 }
 
 #endif
+
+#if NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
+void nrf_802154_trx_ppi_for_frame_timestamp_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    uint32_t event_addr = nrf_radio_event_address_get(NRF_RADIO, NRF_RADIO_EVENT_END);
+    uint32_t task_addr  = nrf_802154_hp_timer_frame_timestamp_task_get();
+
+    nrf_ppi_channel_endpoint_setup(NRF_PPI, PPI_RADIO_END_TIMESTAMP, event_addr, task_addr);
+    nrf_ppi_channel_enable(NRF_PPI, PPI_RADIO_END_TIMESTAMP);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_frame_timestamp_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_disable(NRF_PPI, PPI_RADIO_END_TIMESTAMP);
+    nrf_ppi_channel_endpoint_setup(NRF_PPI, PPI_RADIO_END_TIMESTAMP, 0, 0);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED
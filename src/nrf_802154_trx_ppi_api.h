@@ -104,6 +104,30 @@ void nrf_802154_trx_ppi_for_ack_tx_set(void);
  */
 void nrf_802154_trx_ppi_for_ack_tx_clear(void);
 
+/**
+ * @brief Set PPIs to connect TIMER COMPARE1 event with radio DISABLE task, needed to end the wait for an ACK.
+ *
+ * @note The PPI channel used for ACK TX is reused, as the ACK timeout cannot be set simultaneously with ACK TX.
+ */
+void nrf_802154_trx_ppi_for_ack_timeout_set(void);
+
+/**
+ * @brief Clear PPIs to connect TIMER event with radio DISABLE task. See @ref nrf_802154_trx_ppi_for_ack_timeout_set
+ */
+void nrf_802154_trx_ppi_for_ack_timeout_clear(void);
+
+/**
+ * @brief Set PPIs to connect TIMER COMPARE1 event with radio START task, needed to send the frames of a PER test burst.
+ *
+ * @note The PPI channel used for ACK TX is reused, as the PER test cannot run simultaneously with ACK TX.
+ */
+void nrf_802154_trx_ppi_for_per_test_set(void);
+
+/**
+ * @brief Clear PPIs to connect TIMER event with radio START task. See @ref nrf_802154_trx_ppi_for_per_test_set
+ */
+void nrf_802154_trx_ppi_for_per_test_clear(void);
+
 /**
  * @brief Configure PPIs needed for external LNA or PA. Radio DISABLED event will be connected to timer START task.
  * As a result, FEM ramp-up will be scheduled during the radio ramp-up period, with timing based on FEM implementation used.
@@ -122,8 +146,7 @@ void nrf_802154_trx_ppi_for_fem_clear(void);
  * @param[in] compare_channel Compare channel to hold a value for the timer.
  *
  * @note This function and @ref nrf_802154_trx_ppi_for_fem_powerdown_clear looks not symetrical.
- *       It seems it could be better designed. We shall refactor it when porting FEM support to
- *       nRF53 family.
+ *       It seems it could be better designed.
  *
  * @retval true   FEM powerdown procedure has started.
  * @retval false  FEM powerdown procedure is not needed.
@@ -141,6 +164,20 @@ void nrf_802154_trx_ppi_for_fem_powerdown_clear(void);
  */
 uint32_t nrf_802154_trx_ppi_group_for_abort_get(void);
 
+/**
+ * @brief Configure (D)PPIs needed by FEM to abort PA and LNA on RADIO event DISABLED.
+ *
+ * The connections made by the FEM are disabled through the group returned by
+ * @ref nrf_802154_trx_ppi_group_for_abort_get.
+ */
+void nrf_802154_trx_ppi_for_fem_abort_set(void);
+
+/**
+ * @brief Deconfigure (D)PPIs needed by FEM to abort PA and LNA.
+ *        See @ref nrf_802154_trx_ppi_for_fem_abort_set.
+ */
+void nrf_802154_trx_ppi_for_fem_abort_clear(void);
+
 /**
  * @brief Configure PPIs needed to trigger IRQ from RADIO event SYNC.
  *
@@ -155,4 +192,16 @@ void nrf_802154_trx_ppi_for_radio_sync_set(nrf_egu_task_t task);
  */
 void nrf_802154_trx_ppi_for_radio_sync_clear(nrf_egu_task_t task);
 
+/**
+ * @brief Configure PPIs needed to capture the time of RADIO event END by the high precision timer.
+ *
+ * The captured value can be read with @ref nrf_802154_hp_timer_frame_timestamp_get.
+ */
+void nrf_802154_trx_ppi_for_frame_timestamp_set(void);
+
+/**
+ * @brief Unconfigure PPIs configured by @ref nrf_802154_trx_ppi_for_frame_timestamp_set.
+ */
+void nrf_802154_trx_ppi_for_frame_timestamp_clear(void);
+
 #endif /* NRF_802154_TRX_PPI_H_ */
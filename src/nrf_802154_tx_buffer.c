@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the pool of transmit buffers owned by nRF 802.15.4 radio driver.
+ *
+ */
+
+#include "nrf_802154_tx_buffer.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_ram_usage.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_TX_BUFFERS > 0
+
+#if NRF_802154_TX_BUFFERS > 32
+#error Too many tx buffers in the 802.15.4 radio driver.
+#endif
+
+/// Size of a single transmit buffer.
+#define TX_BUFFER_SIZE (MAX_PACKET_SIZE + 1)
+
+/// Transmit buffers.
+static uint8_t m_tx_buffers[NRF_802154_TX_BUFFERS][TX_BUFFER_SIZE] NRF_802154_BUFFER_PLACEMENT;
+
+/// Bitmap of free buffers. Bit n is set if buffer n is free.
+static volatile uint32_t m_free_mask;
+
+NRF_802154_RAM_USAGE_REPORT(tx_buffer, sizeof(m_tx_buffers));
+
+/** Check if the given pointer points to a buffer from @ref m_tx_buffers. */
+static inline bool buffer_is_from_pool(const uint8_t * p_data)
+{
+    return (p_data >= &m_tx_buffers[0][0]) && (p_data < &m_tx_buffers[NRF_802154_TX_BUFFERS][0]);
+}
+
+/** Get index of the given buffer in @ref m_tx_buffers. */
+static inline uint32_t buffer_idx_get(const uint8_t * p_data)
+{
+    uint32_t idx = (uint32_t)(p_data - &m_tx_buffers[0][0]) / TX_BUFFER_SIZE;
+
+    assert(idx < NRF_802154_TX_BUFFERS);
+    assert(p_data == m_tx_buffers[idx]);
+
+    return idx;
+}
+
+void nrf_802154_tx_buffer_pool_init(void)
+{
+    m_free_mask = (NRF_802154_TX_BUFFERS == 32) ?
+                  UINT32_MAX : ((1UL << NRF_802154_TX_BUFFERS) - 1UL);
+}
+
+uint8_t * nrf_802154_tx_buffer_pool_alloc(void)
+{
+    uint8_t                       * p_data = NULL;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    uint32_t mask = m_free_mask;
+
+    if (mask != 0U)
+    {
+        uint32_t idx = __CLZ(__RBIT(mask));
+
+        m_free_mask = mask & ~(1UL << idx);
+        p_data      = m_tx_buffers[idx];
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return p_data;
+}
+
+void nrf_802154_tx_buffer_pool_release(const uint8_t * p_data)
+{
+    uint32_t                        idx = buffer_idx_get(p_data);
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    assert((m_free_mask & (1UL << idx)) == 0U);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    m_free_mask |= (1UL << idx);
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_tx_buffer_pool_frame_done(const uint8_t * p_frame)
+{
+    if (buffer_is_from_pool(p_frame))
+    {
+        nrf_802154_tx_buffer_pool_release(p_frame);
+    }
+}
+
+#endif // NRF_802154_TX_BUFFERS > 0
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that contains the pool of transmit buffers owned by the nRF 802.15.4 radio driver.
+ *
+ */
+
+#ifndef NRF_802154_TX_BUFFER_H_
+#define NRF_802154_TX_BUFFER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if NRF_802154_TX_BUFFERS > 0
+
+/**
+ * @brief Initializes the pool of transmit buffers.
+ */
+void nrf_802154_tx_buffer_pool_init(void);
+
+/**
+ * @brief Allocates a buffer from the pool.
+ *
+ * @returns  Pointer to a free buffer of (MAX_PACKET_SIZE + 1) bytes, or NULL if the pool is
+ *           exhausted.
+ */
+uint8_t * nrf_802154_tx_buffer_pool_alloc(void);
+
+/**
+ * @brief Returns a buffer to the pool.
+ *
+ * @param[in]  p_data  Pointer to a buffer allocated with @ref nrf_802154_tx_buffer_pool_alloc.
+ */
+void nrf_802154_tx_buffer_pool_release(const uint8_t * p_data);
+
+/**
+ * @brief Returns the buffer to the pool if the given frame was transmitted from the pool.
+ *
+ * This function is to be called after the higher layer is notified about the end of transmission
+ * of the frame pointed to by @p p_frame, successful or not.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ */
+void nrf_802154_tx_buffer_pool_frame_done(const uint8_t * p_frame);
+
+#endif // NRF_802154_TX_BUFFERS > 0
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TX_BUFFER_H_ */
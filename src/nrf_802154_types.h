@@ -32,6 +32,7 @@
 #ifndef NRF_802154_TYPES_H__
 #define NRF_802154_TYPES_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /**
@@ -78,6 +79,7 @@ typedef uint8_t nrf_802154_tx_error_t;
 #define NRF_802154_TX_ERROR_NO_ACK          0x05 // !< ACK frame was not received during the timeout period.
 #define NRF_802154_TX_ERROR_ABORTED         0x06 // !< Procedure was aborted by another operation.
 #define NRF_802154_TX_ERROR_TIMESLOT_DENIED 0x07 // !< Transmission did not start due to a denied timeslot request.
+#define NRF_802154_TX_ERROR_DEADLINE_MISSED 0x08 // !< Frame could not be transmitted before its deadline.
 
 /**
  * @brief Possible errors during the frame reception.
@@ -95,20 +97,24 @@ typedef uint8_t nrf_802154_rx_error_t;
 #define NRF_802154_RX_ERROR_DELAYED_TIMEOUT         0x08 // !< Delayed reception timeslot ended.
 #define NRF_802154_RX_ERROR_INVALID_LENGTH          0x09 // !< Received a frame with invalid length.
 #define NRF_802154_RX_ERROR_DELAYED_ABORTED         0x0A // !< Delayed operation in the ongoing state was aborted by other request.
+#define NRF_802154_RX_ERROR_SRC_ADDR_FILTERED       0x0B // !< Received a frame rejected by the source address filter. It is not notified to the higher layer.
+#define NRF_802154_RX_ERROR_FRAME_TYPE_FILTERED     0x0C // !< Received a frame of a type rejected by the frame type filter. It is not notified to the higher layer.
 
 /**
  * @brief Possible errors during the energy detection.
  */
 typedef uint8_t nrf_802154_ed_error_t;
 
-#define NRF_802154_ED_ERROR_ABORTED 0x01 // !< Procedure was aborted by another operation.
+#define NRF_802154_ED_ERROR_ABORTED         0x01 // !< Procedure was aborted by another operation.
+#define NRF_802154_ED_ERROR_TIMESLOT_DENIED 0x02 // !< Scheduled procedure did not start due to a denied timeslot request.
 
 /**
  * @brief Possible errors during the CCA procedure.
  */
 typedef uint8_t nrf_802154_cca_error_t;
 
-#define NRF_802154_CCA_ERROR_ABORTED 0x01 // !< Procedure was aborted by another operation.
+#define NRF_802154_CCA_ERROR_ABORTED         0x01 // !< Procedure was aborted by another operation.
+#define NRF_802154_CCA_ERROR_TIMESLOT_DENIED 0x02 // !< Scheduled procedure did not start due to a denied timeslot request.
 
 /**
  * @brief Possible errors during sleep procedure call.
@@ -118,6 +124,15 @@ typedef uint8_t nrf_802154_sleep_error_t;
 #define NRF_802154_SLEEP_ERROR_NONE 0x00 // !< There is no error.
 #define NRF_802154_SLEEP_ERROR_BUSY 0x01 // !< The driver cannot enter the sleep state due to the ongoing operation.
 
+/**
+ * @brief States entered by the driver after a successful transmission.
+ */
+typedef uint8_t nrf_802154_post_tx_state_t;
+
+#define NRF_802154_POST_TX_STATE_RX        0x00 // !< The driver enters the receive state.
+#define NRF_802154_POST_TX_STATE_SLEEP     0x01 // !< The driver enters the sleep state.
+#define NRF_802154_POST_TX_STATE_RX_WINDOW 0x02 // !< The driver receives for a while, then sleeps.
+
 /**
  * @brief Termination level selected for a particular request.
  *
@@ -140,6 +155,221 @@ typedef struct
     uint8_t              corr_limit;     // !< Limit of occurrences above the busy threshold of the CCA correlator. Not used in @ref NRF_RADIO_CCA_MODE_ED.
 } nrf_802154_cca_cfg_t;
 
+/**
+ * @brief Structure holding the extended result of the energy detection procedure.
+ *
+ * Energy values are in the format passed to @ref nrf_802154_energy_detected.
+ * See @ref NRF_802154_ED_RESULT_EXT_ENABLED.
+ */
+typedef struct
+{
+    uint8_t         max;          // !< Highest energy detected.
+    uint8_t         mean;         // !< Mean of the detected energy.
+    uint16_t        sample_count; // !< Number of energy samples collected, saturated at UINT16_MAX.
+    uint16_t        busy_count;   // !< Number of energy samples above the CCA energy threshold.
+    uint16_t        stored_count; // !< Number of energy samples stored in @p p_samples.
+    const uint8_t * p_samples;    // !< First energy samples, or NULL if none are stored. Valid until the next energy detection procedure ends.
+} nrf_802154_ed_result_t;
+
+/**
+ * @brief Flags selecting the fields of @ref nrf_802154_tx_params_t applied to a frame.
+ */
+typedef uint8_t nrf_802154_tx_params_flags_t;
+
+#define NRF_802154_TX_PARAM_CHANNEL    0x01 // !< Transmit the frame on @c channel instead of the PIB channel.
+#define NRF_802154_TX_PARAM_POWER      0x02 // !< Transmit the frame with @c power instead of the PIB power.
+#define NRF_802154_TX_PARAM_CCA_CFG    0x04 // !< Use @c cca_cfg for the CCA preceding the frame instead of the PIB configuration.
+#define NRF_802154_TX_PARAM_TIMESTAMP  0x08 // !< Write the SFD timestamp of the frame into its PSDU at @c timestamp_offset.
+#define NRF_802154_TX_PARAM_FEM_BYPASS 0x10 // !< Transmit the frame with the PA of the front-end module inactive.
+#define NRF_802154_TX_PARAM_COEX_HIGH  0x20 // !< Signal the high priority to the Wi-Fi coexistence arbiter for the frame.
+
+/**
+ * @brief Structure for parameters of a single frame transmission.
+ *
+ * Parameters selected by @c flags apply only to the frame they are passed with. The PIB is not
+ * modified, and the next frames are transmitted with the PIB configuration again.
+ *
+ * With @ref NRF_802154_TX_PARAM_TIMESTAMP, the driver modifies the frame buffer just before each
+ * transmission attempt. The written timestamp is the time of the end of the SFD, in microseconds
+ * in the time base of the Timer Scheduler, the same as the timestamps of received frames.
+ * The time is predicted in software before the transmission is started, so it is not exact.
+ * With @ref NRF_802154_FRAME_TIMESTAMP_PPI_ENABLED it is based on the HP timer, and the error is
+ * a few microseconds of the software latency before the radio ramp-up is triggered. Otherwise
+ * it is based on the LP timer, and the error is up to one LP timer tick (30.5 us) more.
+ * Sub-microsecond synchronization needs the timestamp of the transmitted frame captured by
+ * the radio, see @ref nrf_802154_transmitted_timestamp_raw.
+ *
+ * With @ref NRF_802154_TX_PARAM_FEM_BYPASS, the PA is not activated for the frame and the transmit
+ * power is delivered by the radio alone, so the FEM gain is not subtracted from it. It is meant for
+ * frames sent to nearby peers, which do not need the FEM gain.
+ *
+ * With @ref NRF_802154_TX_PARAM_COEX_HIGH, the frame is requested from the PTA with the high
+ * priority, see @ref NRF_802154_COEX_PRIORITY_ENABLED. It is meant for time-critical frames, so
+ * that Wi-Fi yields to them, but not to bulk data.
+ */
+typedef struct
+{
+    bool                         cca;              // !< If the driver is to perform a CCA procedure before transmission.
+    nrf_802154_tx_params_flags_t flags;            // !< Fields to apply. Bitwise combination of @c NRF_802154_TX_PARAM_* values.
+    uint8_t                      channel;          // !< Channel to transmit the frame on (11-26).
+    int8_t                       power;            // !< Transmit power in dBm.
+    nrf_802154_cca_cfg_t         cca_cfg;          // !< CCA configuration used before transmission.
+    uint8_t                      timestamp_offset; // !< Offset of the timestamp from the start of the PSDU.
+    uint8_t                      timestamp_width;  // !< Number of least significant bytes of the timestamp to write (1-4), little-endian.
+} nrf_802154_tx_params_t;
+
+/**
+ * @brief Structure for parameters of a frame added to the transmit queue.
+ *
+ * Frames of a lower priority value are transmitted first. Within a priority class, frames with
+ * a deadline are transmitted in the order of their deadlines, before the frames without one.
+ * A frame that cannot be transmitted by its deadline is dropped from the queue.
+ */
+typedef struct
+{
+    uint8_t  priority;       // !< Priority class of the frame, 0 being the highest.
+    bool     deadline_valid; // !< If the frame has a deadline.
+    uint32_t deadline;       // !< Time by which the transmission must end, in the time base of @ref nrf_802154_time_get.
+} nrf_802154_tx_queue_params_t;
+
+/**
+ * @brief ID of the PAN context reported for frames not filtered by the destination address.
+ */
+#define NRF_802154_PAN_CONTEXT_NONE 0xff
+
+/**
+ * @brief Structure that contains metadata of a received frame.
+ *
+ * The metadata is captured once when the reception of the frame ends, so it is not affected by
+ * frames received later.
+ */
+typedef struct
+{
+    uint32_t time;        // !< Timestamp taken when the SFD of the frame was received, in microseconds, or @ref NRF_802154_NO_TIMESTAMP if the timestamp is invalid.
+    int8_t   power;       // !< RSSI of the received frame.
+    uint8_t  lqi;         // !< LQI of the received frame.
+    uint8_t  channel;     // !< Channel the frame was received on.
+    uint8_t  antenna;     // !< Antenna selected by the antenna diversity for the reception of the frame. See nrf_802154_sl_ant_div_antenna_t.
+    bool     ack_fpb;     // !< If an ACK with the Frame Pending bit set was transmitted in response to the frame.
+    bool     ack_late;    // !< If the ACK to the frame was not transmitted because its turnaround deadline was missed.
+    bool     decrypted;   // !< If the frame was secured, and its MIC was verified and its payload decrypted by the driver. The MIC is left in the frame.
+    uint8_t  pan_context; // !< ID of the PAN context the frame is addressed to, or @ref NRF_802154_PAN_CONTEXT_NONE if the frame was not filtered.
+    uint64_t time64;      // !< 64-bit value of @p time, which does not wrap. Valid only if @p time is not @ref NRF_802154_NO_TIMESTAMP.
+} nrf_802154_rx_metadata_t;
+
+/**
+ * @brief Structure of an RSSI sample collected by the RSSI streaming.
+ */
+typedef struct
+{
+    uint32_t time;    // !< Time at which the RSSI was measured, in microseconds.
+    int8_t   rssi;    // !< Measured RSSI in dBm.
+    uint8_t  channel; // !< Channel the RSSI was measured on.
+} nrf_802154_rssi_sample_t;
+
+/**
+ * @brief Structure of a frame header record written by the header monitor.
+ *
+ * The addresses and PAN IDs are in the little-endian byte order, as in the frame.
+ */
+typedef struct
+{
+    uint64_t time64;            // !< 64-bit timestamp taken when the SFD of the frame was received, in microseconds, or @ref NRF_802154_NO_TIMESTAMP if the timestamp is invalid.
+    uint8_t  dst_panid[2];      // !< Destination PAN ID. Valid only if @p dst_panid_present is set.
+    uint8_t  src_panid[2];      // !< Source PAN ID. Valid only if @p src_panid_present is set.
+    uint8_t  dst_addr[8];       // !< Destination address. Only the first @p dst_addr_size bytes are valid.
+    uint8_t  src_addr[8];       // !< Source address. Only the first @p src_addr_size bytes are valid.
+    uint8_t  dst_addr_size;     // !< Size of the destination address: 0, 2 or 8 bytes.
+    uint8_t  src_addr_size;     // !< Size of the source address: 0, 2 or 8 bytes.
+    bool     dst_panid_present; // !< If the frame contains the destination PAN ID.
+    bool     src_panid_present; // !< If the frame contains the source PAN ID.
+    uint8_t  frame_type;        // !< Frame type from the Frame Control field.
+    bool     dsn_present;       // !< If the frame contains the sequence number.
+    uint8_t  dsn;               // !< Sequence number. Valid only if @p dsn_present is set.
+    uint8_t  length;            // !< Length of the PSDU including the FCS, as in the PHR.
+    int8_t   power;             // !< RSSI of the received frame.
+    uint8_t  lqi;               // !< LQI of the received frame.
+    uint8_t  channel;           // !< Channel the frame was received on.
+} nrf_802154_header_record_t;
+
+/**
+ * @brief Structure that contains the link quality of a peer.
+ *
+ * The averages are exponentially weighted moving averages, see
+ * @ref NRF_802154_PEER_TABLE_EWMA_SHIFT.
+ */
+typedef struct
+{
+    uint8_t  addr[8];            // !< Address of the peer in the little-endian byte order.
+    bool     extended;           // !< If @p addr is an extended address or a short address.
+    int8_t   rssi;               // !< Average RSSI of the frames and ACKs received from the peer, or 0 if none was received.
+    uint8_t  lqi;                // !< Average LQI of the frames and ACKs received from the peer, or 0 if none was received.
+    uint8_t  ack_success;        // !< Average percentage of transmissions to the peer that were acknowledged.
+    uint32_t last_seen;          // !< Timestamp of the last frame received from the peer, as in @ref nrf_802154_rx_metadata_t.
+    uint32_t ack_requests;       // !< Number of transmissions to the peer that requested an ACK.
+    uint32_t acks;               // !< Number of ACKs received from the peer.
+    uint8_t  antenna;            // !< Best antenna for the last frame received from the peer, used to transmit frames to the peer. See nrf_802154_sl_ant_div_antenna_t.
+    uint8_t  tx_power_reduction; // !< Reduction of the transmit power used for frames to the peer in dB. See @ref NRF_802154_PEER_TABLE_TX_POWER_CONTROL_ENABLED.
+} nrf_802154_peer_info_t;
+
+/**
+ * @brief Size of a key used to secure frames, in bytes.
+ */
+#define NRF_802154_KEY_SIZE        16
+
+/**
+ * @brief Maximum size of the Key Identifier field of the auxiliary security header, in bytes.
+ */
+#define NRF_802154_KEY_ID_MAX_SIZE 9
+
+/**
+ * @brief Structure that identifies a key used to secure frames.
+ *
+ * The identifier is compared with the Key Identifier field of the auxiliary security header
+ * of the frames. Only the first 1, 5 or 9 bytes of @c id are used with the Key Identifier
+ * Mode of 1, 2 or 3 respectively.
+ */
+typedef struct
+{
+    uint8_t mode;                           // !< Key Identifier Mode (1-3).
+    uint8_t id[NRF_802154_KEY_ID_MAX_SIZE]; // !< Key Source followed by Key Index, in the order of the Key Identifier field.
+} nrf_802154_key_id_t;
+
+/**
+ * @brief Structure that contains a key used to secure frames.
+ */
+typedef struct
+{
+    uint8_t             value[NRF_802154_KEY_SIZE]; // !< AES-128 key.
+    nrf_802154_key_id_t id;                         // !< Identifier of the key.
+    uint32_t            frame_counter;              // !< Frame counter of the next frame secured with the key.
+} nrf_802154_key_t;
+
+/**
+ * @brief Errors reported by the key storage.
+ *
+ * Possible values:
+ * - @ref NRF_802154_SECURITY_ERROR_NONE,
+ * - @ref NRF_802154_SECURITY_ERROR_STORAGE_FULL,
+ * - @ref NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND,
+ * - @ref NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED
+ */
+typedef uint8_t nrf_802154_security_error_t;
+
+#define NRF_802154_SECURITY_ERROR_NONE               0x00 // !< There is no error.
+#define NRF_802154_SECURITY_ERROR_STORAGE_FULL       0x01 // !< There is no free slot for the key.
+#define NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND      0x02 // !< There is no key with the given identifier.
+#define NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED 0x03 // !< The Key Identifier Mode is not supported.
+
+/**
+ * @brief Structure that describes a single frame in a batch of received frames.
+ */
+typedef struct
+{
+    uint8_t                * p_data;   // !< Pointer to a buffer that contains PHR and PSDU of the received frame.
+    nrf_802154_rx_metadata_t metadata; // !< Metadata of the received frame.
+} nrf_802154_rx_frame_t;
+
 /**
  * @brief Types of data that can be set in an ACK message.
  */
@@ -148,6 +378,22 @@ typedef uint8_t nrf_802154_ack_data_t;
 #define NRF_802154_ACK_DATA_PENDING_BIT 0x00
 #define NRF_802154_ACK_DATA_IE          0x01
 
+/**
+ * @brief Link metrics written into Enh-Acks.
+ *
+ * Possible values are a bitwise OR of:
+ * - @ref NRF_802154_LINK_METRICS_LQI,
+ * - @ref NRF_802154_LINK_METRICS_LINK_MARGIN,
+ * - @ref NRF_802154_LINK_METRICS_RSSI
+ *
+ * The metrics are written into the Enh-Ack in this order.
+ */
+typedef uint8_t nrf_802154_link_metrics_t;
+
+#define NRF_802154_LINK_METRICS_LQI         0x01 // !< LQI of the received frames.
+#define NRF_802154_LINK_METRICS_LINK_MARGIN 0x02 // !< RSSI of the received frames above the noise floor, scaled to 0-255.
+#define NRF_802154_LINK_METRICS_RSSI        0x04 // !< RSSI of the received frames, scaled to 0-255.
+
 /**
  * @brief Methods of source address matching.
  *
@@ -165,6 +411,98 @@ typedef uint8_t nrf_802154_src_addr_match_t;
 #define NRF_802154_SRC_ADDR_MATCH_ZIGBEE   0x01 // !< Implementation for the Zigbee protocol.
 #define NRF_802154_SRC_ADDR_MATCH_ALWAYS_1 0x02 // !< Standard compliant implementation.
 
+/**
+ * @brief Structure that describes an additional PAN the device receives frames for.
+ */
+typedef struct
+{
+    uint8_t                     pan_id[2];        // !< PAN ID (little-endian).
+    uint8_t                     short_addr[2];    // !< Short address of the device in the PAN (little-endian).
+    uint8_t                     extended_addr[8]; // !< Extended address of the device in the PAN (little-endian).
+    bool                        auto_ack;         // !< If frames addressed to the PAN are acknowledged automatically.
+    nrf_802154_src_addr_match_t src_match_method; // !< Method of setting the pending bit in ACKs to frames addressed to the PAN.
+} nrf_802154_pan_context_t;
+
+/**
+ * @brief Function called to update the IE data of an Enh-Ack just before it is transmitted.
+ *
+ * The function is called from the radio interrupt handler within the ACK turnaround time, so it
+ * must be very short. It can modify @p p_ie in place, but it cannot change its length.
+ *
+ * @param[in]    p_frame   Pointer to the buffer that contains PHR and PSDU of the frame to which
+ *                         the Enh-Ack responds.
+ * @param[inout] p_ie      Pointer to the IE data in the Enh-Ack, set with
+ *                         @ref nrf_802154_ack_data_set.
+ * @param[in]    ie_len    Length of the IE data.
+ * @param[in]    ack_time  Time in microseconds at which the PHR of the Enh-Ack is to be transmitted,
+ *                         in the same time base as timestamps of received frames.
+ *                         @ref NRF_802154_NO_TIMESTAMP if timestamps are not available.
+ */
+typedef void (* nrf_802154_ack_ie_writer_t)(const uint8_t * p_frame,
+                                            uint8_t       * p_ie,
+                                            uint8_t         ie_len,
+                                            uint32_t        ack_time);
+
+/**
+ * @brief Function deciding if the pending bit is to be set in the ACK to a received frame.
+ *
+ * The function is called from the radio interrupt handler while the ACK is prepared, within
+ * the ACK turnaround time, and it shares that time with the rest of the ACK preparation. It must
+ * return within 10 us, which is 640 CPU cycles at 64 MHz, and it must not block.
+ *
+ * @param[in]  p_src_addr  Pointer to the source address of the frame, little-endian.
+ * @param[in]  extended    If @p p_src_addr is an extended address.
+ * @param[in]  p_frame     Pointer to the buffer that contains PHR and PSDU of the frame.
+ *
+ * @retval true   The pending bit is to be set.
+ * @retval false  The pending bit is to be cleared.
+ */
+typedef bool (* nrf_802154_pending_bit_decider_t)(const uint8_t * p_src_addr,
+                                                  bool            extended,
+                                                  const uint8_t * p_frame);
+
+/**
+ * @brief Modes of the source address filter of received frames.
+ *
+ * Possible values:
+ * - @ref NRF_802154_SRC_ADDR_FILTER_DISABLED,
+ * - @ref NRF_802154_SRC_ADDR_FILTER_ALLOW,
+ * - @ref NRF_802154_SRC_ADDR_FILTER_DENY
+ */
+typedef uint8_t nrf_802154_src_addr_filter_mode_t;
+
+#define NRF_802154_SRC_ADDR_FILTER_DISABLED 0x00 // !< Source addresses of received frames are not checked.
+#define NRF_802154_SRC_ADDR_FILTER_ALLOW    0x01 // !< Only frames from the addresses in the filter list are received.
+#define NRF_802154_SRC_ADDR_FILTER_DENY     0x02 // !< Frames from the addresses in the filter list are dropped.
+
+/**
+ * @brief Size of the PCAP global header that precedes the records of captured frames.
+ */
+#define NRF_802154_CAPTURE_PCAP_HEADER_SIZE 24
+
+/**
+ * @brief Mask of frame types accepted by the receive filter.
+ *
+ * Bitwise OR of the following values:
+ * - @ref NRF_802154_FRAME_TYPE_FILTER_BEACON,
+ * - @ref NRF_802154_FRAME_TYPE_FILTER_DATA,
+ * - @ref NRF_802154_FRAME_TYPE_FILTER_ACK,
+ * - @ref NRF_802154_FRAME_TYPE_FILTER_COMMAND,
+ * - @ref NRF_802154_FRAME_TYPE_FILTER_MULTIPURPOSE,
+ * - @ref NRF_802154_FRAME_TYPE_FILTER_FRAGMENT,
+ * - @ref NRF_802154_FRAME_TYPE_FILTER_EXTENDED
+ */
+typedef uint8_t nrf_802154_frame_type_filter_t;
+
+#define NRF_802154_FRAME_TYPE_FILTER_BEACON       (1 << 0) // !< Beacon frames are accepted.
+#define NRF_802154_FRAME_TYPE_FILTER_DATA         (1 << 1) // !< Data frames are accepted.
+#define NRF_802154_FRAME_TYPE_FILTER_ACK          (1 << 2) // !< ACK frames are accepted.
+#define NRF_802154_FRAME_TYPE_FILTER_COMMAND      (1 << 3) // !< MAC command frames are accepted.
+#define NRF_802154_FRAME_TYPE_FILTER_MULTIPURPOSE (1 << 5) // !< Multipurpose frames are accepted.
+#define NRF_802154_FRAME_TYPE_FILTER_FRAGMENT     (1 << 6) // !< Fragment and Frak frames are accepted.
+#define NRF_802154_FRAME_TYPE_FILTER_EXTENDED     (1 << 7) // !< Extended frames are accepted.
+#define NRF_802154_FRAME_TYPE_FILTER_ALL          0xFF     // !< Frames of all types are accepted.
+
 /**
  * @brief RSSI measurement results.
  */
@@ -236,6 +574,16 @@ typedef struct
     uint32_t coex_denied_requests;
     /**@brief Number of coex grant activations that have been not requested. */
     uint32_t coex_unsolicited_grants;
+    /**@brief Number of received retransmitted frames not passed to the higher layer. */
+    uint32_t duplicate_frames;
+    /**@brief Number of CSMA-CA procedures that failed because of busy channel. */
+    uint32_t channel_access_failures;
+    /**@brief Number of ACKs not transmitted because their turnaround deadline was missed. */
+    uint32_t ack_deadline_misses;
+    /**@brief Number of received secured frames dropped because their MIC was invalid. */
+    uint32_t rx_security_failures;
+    /**@brief Number of Data Request notifications dropped due to a full notification queue. */
+    uint32_t data_request_notifications_dropped;
 } nrf_802154_stat_counters_t;
 
 /**
@@ -257,6 +605,21 @@ typedef struct
     uint32_t last_rx_end_timestamp;
 } nrf_802154_stat_timestamps_t;
 
+/**
+ * @brief Number of transmit power levels in @ref nrf_802154_stat_totals_t::total_transmit_time_per_power.
+ *
+ * Level @c i starts at @ref NRF_802154_STAT_TX_POWER_LEVEL_MIN +
+ * @c i * @ref NRF_802154_STAT_TX_POWER_LEVEL_STEP dBm and ends where the next level starts.
+ * Level 0 also holds all lower powers and the last level also holds all higher powers.
+ */
+#define NRF_802154_STAT_TX_POWER_LEVELS     8
+
+/** @brief Transmit power in dBm at which level 0 starts. */
+#define NRF_802154_STAT_TX_POWER_LEVEL_MIN  (-20)
+
+/** @brief Width in dB of a transmit power level. */
+#define NRF_802154_STAT_TX_POWER_LEVEL_STEP 4
+
 /**
  * @brief Type of structure holding total times spent in certain states.
  *
@@ -270,8 +633,453 @@ typedef struct
     uint64_t total_receive_time;
     /**@brief Total time in microseconds spent on transmission. */
     uint64_t total_transmit_time;
+    /**@brief Part of the listening and transmit times in microseconds spent on the ramp-up of the radio. */
+    uint64_t total_ramp_up_time;
+    /**@brief Total time in microseconds the LNA of the front-end module was active. */
+    uint64_t total_lna_time;
+    /**@brief Total time in microseconds the PA of the front-end module was active. */
+    uint64_t total_pa_time;
+    /**@brief Total time in microseconds the driver held the radio timeslot, with the HFXO running. */
+    uint64_t total_hfxo_time;
+    /**@brief Transmit time in microseconds split by transmit power levels, see @ref NRF_802154_STAT_TX_POWER_LEVELS. */
+    uint64_t total_transmit_time_per_power[NRF_802154_STAT_TX_POWER_LEVELS];
 } nrf_802154_stat_totals_t;
 
+/**
+ * @brief Type of structure holding the charge estimated from the total times.
+ *
+ * The charge is given in nanoampere-hours, so dividing it by 1000 gives microampere-hours.
+ * See @ref NRF_802154_ENERGY_MODEL_ENABLED.
+ */
+typedef struct
+{
+    uint64_t rx;    // !< Charge used by the receiver, including listening and receiving frames.
+    uint64_t tx;    // !< Charge used by the transmitter.
+    uint64_t fem;   // !< Charge used by the LNA and the PA of the front-end module.
+    uint64_t hfxo;  // !< Charge used by the HFXO while the driver held the radio timeslot.
+    uint64_t total; // !< Sum of all of the above.
+} nrf_802154_stat_charge_t;
+
+/**
+ * @brief Number of buckets of the histogram of the number of backoffs needed to access the channel.
+ *
+ * Bucket @c i counts transmissions started after @c i backoffs. The last bucket also counts
+ * transmissions that needed more backoffs.
+ */
+#define NRF_802154_STAT_CSMA_NB_BUCKETS        8
+
+/**
+ * @brief Number of buckets of the CSMA-CA time histograms.
+ *
+ * Bucket 0 counts times shorter than @ref NRF_802154_STAT_CSMA_TIME_BUCKET_BASE_US. Bucket @c i
+ * counts times from @ref NRF_802154_STAT_CSMA_TIME_BUCKET_BASE_US * 2^(i-1) up to
+ * @ref NRF_802154_STAT_CSMA_TIME_BUCKET_BASE_US * 2^i. The last bucket also counts longer times.
+ */
+#define NRF_802154_STAT_CSMA_TIME_BUCKETS      12
+
+/**
+ * @brief Upper bound of the first bucket of the CSMA-CA time histograms in microseconds (us).
+ *
+ * It is equal to the duration of a unit backoff period.
+ */
+#define NRF_802154_STAT_CSMA_TIME_BUCKET_BASE_US 320
+
+/**
+ * @brief Type of structure holding histograms of the CSMA-CA procedure.
+ *
+ * This structure holds counters of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Number of transmissions started after the given number of backoffs. */
+    uint32_t nb_at_success[NRF_802154_STAT_CSMA_NB_BUCKETS];
+    /**@brief Number of single backoff periods, by their duration. */
+    uint32_t backoff_delay[NRF_802154_STAT_CSMA_TIME_BUCKETS];
+    /**@brief Number of transmissions, by the time from the procedure start to the TX start. */
+    uint32_t tx_latency[NRF_802154_STAT_CSMA_TIME_BUCKETS];
+} nrf_802154_stat_csma_histogram_t;
+
+/**
+ * @brief Number of buckets of the latency histograms.
+ *
+ * Bucket 0 counts times shorter than @ref NRF_802154_STAT_LATENCY_BUCKET_BASE_US. Bucket
+ * @c i counts times from @ref NRF_802154_STAT_LATENCY_BUCKET_BASE_US * 2^(i-1) up to
+ * @ref NRF_802154_STAT_LATENCY_BUCKET_BASE_US * 2^i. The last bucket also counts longer
+ * times.
+ */
+#define NRF_802154_STAT_LATENCY_BUCKETS         12
+
+/**
+ * @brief Upper bound of the first bucket of the latency histograms in microseconds (us).
+ */
+#define NRF_802154_STAT_LATENCY_BUCKET_BASE_US  4
+
+/**
+ * @brief Type of structure holding statistics of an internal queue of the driver.
+ */
+typedef struct
+{
+    /**@brief Maximal number of items stored in the queue at once. */
+    uint32_t high_watermark;
+    /**@brief Number of items that left at most one free slot in the queue when written. */
+    uint32_t near_full_pushes;
+    /**@brief Number of items, by the time from writing to reading them. */
+    uint32_t latency[NRF_802154_STAT_LATENCY_BUCKETS];
+} nrf_802154_stat_queue_t;
+
+/**
+ * @brief Type of structure holding statistics of the internal queues of the driver.
+ *
+ * This structure holds fields of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Statistics of the notification queues. Priority classes share this structure. */
+    nrf_802154_stat_queue_t notifications;
+    /**@brief Statistics of the request queue. */
+    nrf_802154_stat_queue_t requests;
+} nrf_802154_stat_queues_t;
+
+/**
+ * @brief Lowest channel that can be scanned by @ref nrf_802154_energy_detection_sweep.
+ */
+#define NRF_802154_ED_SWEEP_CHANNEL_FIRST 11
+
+/**
+ * @brief Number of channels that can be scanned by @ref nrf_802154_energy_detection_sweep.
+ *
+ * The results of the sweep are passed in an array of this size, starting from the channel
+ * @ref NRF_802154_ED_SWEEP_CHANNEL_FIRST.
+ */
+#define NRF_802154_ED_SWEEP_CHANNELS      16
+
+/**
+ * @brief Mask of the channels that can be scanned by @ref nrf_802154_energy_detection_sweep.
+ */
+#define NRF_802154_ED_SWEEP_CHANNEL_MASK  0x07FFF800UL
+
+/**
+ * @brief Lowest channel counted by @ref nrf_802154_stat_channels_t.
+ */
+#define NRF_802154_STAT_CHANNEL_FIRST 11
+
+/**
+ * @brief Number of channels counted by @ref nrf_802154_stat_channels_t.
+ */
+#define NRF_802154_STAT_CHANNELS      16
+
+/**
+ * @brief Type of structure holding statistic counters of a single channel.
+ *
+ * This structure holds counters of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Number of frames received with correct CRC and with filtering passing. */
+    uint32_t received_frames;
+    /**@brief Number of frames received with incorrect CRC. */
+    uint32_t crc_errors;
+    /**@brief Number of CCA procedures that found the channel busy. */
+    uint32_t cca_busy;
+    /**@brief Number of CCA procedures that found the channel idle. */
+    uint32_t cca_idle;
+    /**@brief Number of energy detection samples. */
+    uint32_t energy_detections;
+    /**@brief Number of frame transmissions started. */
+    uint32_t tx_attempts;
+} nrf_802154_stat_channel_counters_t;
+
+/**
+ * @brief Type of structure holding statistic counters of all channels.
+ *
+ * This structure holds counters of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Counters of the channels, starting from @ref NRF_802154_STAT_CHANNEL_FIRST. */
+    nrf_802154_stat_channel_counters_t channels[NRF_802154_STAT_CHANNELS];
+} nrf_802154_stat_channels_t;
+
+/**
+ * @brief Type of structure holding latency histograms of the driver.
+ *
+ * This structure holds fields of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Time from the end of a received frame to its notification. */
+    uint32_t rx_delivery[NRF_802154_STAT_LATENCY_BUCKETS];
+    /**@brief Time from the end of a transmitted frame or its ACK to the notification. */
+    uint32_t tx_completion[NRF_802154_STAT_LATENCY_BUCKETS];
+    /**@brief Time from a request call to the start of its handling by the core. */
+    uint32_t request_servicing[NRF_802154_STAT_LATENCY_BUCKETS];
+} nrf_802154_stat_latency_histogram_t;
+
+/**
+ * @brief Number of callers the critical section hold times are tracked for.
+ *
+ * The caller index is the ID of the module that entered the critical section, as listed in
+ * @c nrf_802154_drv_modules_list_t. Index 0 counts callers that did not provide their ID,
+ * for example the service layer, and callers with IDs out of range.
+ */
+#define NRF_802154_STAT_CRIT_SECT_CALLERS    16
+
+/**
+ * @brief Number of interrupt priorities the critical section hold times are tracked for.
+ *
+ * The last entry counts critical sections entered from the thread mode.
+ */
+#define NRF_802154_STAT_CRIT_SECT_PRIORITIES 9
+
+/**
+ * @brief Type of structure holding hold times of the critical section.
+ */
+typedef struct
+{
+    /**@brief Number of times the critical section was held. */
+    uint32_t count;
+    /**@brief Longest hold of the critical section in microseconds (us). */
+    uint32_t max_time;
+    /**@brief Sum of all hold times of the critical section in microseconds (us). */
+    uint32_t total_time;
+} nrf_802154_stat_crit_sect_hold_t;
+
+/**
+ * @brief Type of structure holding the critical section profile.
+ *
+ * This structure holds fields of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Hold times by the module that entered the critical section. */
+    nrf_802154_stat_crit_sect_hold_t callers[NRF_802154_STAT_CRIT_SECT_CALLERS];
+    /**@brief Hold times by the priority of the interrupt that entered the critical section. */
+    nrf_802154_stat_crit_sect_hold_t priorities[NRF_802154_STAT_CRIT_SECT_PRIORITIES];
+} nrf_802154_stat_crit_sect_t;
+
+/**
+ * @brief Items of the RADIO interrupt profile.
+ *
+ * Possible values:
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_RADIO_IRQ,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_SYNC,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_READY,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_ADDRESS,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_BCMATCH,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_CRCERROR,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_CRCOK,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_PHYEND,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_DISABLED,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_CCAIDLE,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_CCABUSY,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_EDEND,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_FRAME_BCMATCHED,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_FRAME_RECEIVED,
+ * - @ref NRF_802154_STAT_IRQ_CYCLES_FRAME_FILTER
+ */
+typedef uint8_t nrf_802154_stat_irq_cycles_item_t;
+
+#define NRF_802154_STAT_IRQ_CYCLES_RADIO_IRQ       0x00 // !< Whole RADIO IRQ handler.
+#define NRF_802154_STAT_IRQ_CYCLES_SYNC            0x01 // !< Handler of the SYNC event.
+#define NRF_802154_STAT_IRQ_CYCLES_READY           0x02 // !< Handler of the READY event.
+#define NRF_802154_STAT_IRQ_CYCLES_ADDRESS         0x03 // !< Handler of the ADDRESS event.
+#define NRF_802154_STAT_IRQ_CYCLES_BCMATCH         0x04 // !< Handler of the BCMATCH event.
+#define NRF_802154_STAT_IRQ_CYCLES_CRCERROR        0x05 // !< Handler of the CRCERROR event.
+#define NRF_802154_STAT_IRQ_CYCLES_CRCOK           0x06 // !< Handler of the CRCOK event.
+#define NRF_802154_STAT_IRQ_CYCLES_PHYEND          0x07 // !< Handler of the PHYEND event.
+#define NRF_802154_STAT_IRQ_CYCLES_DISABLED        0x08 // !< Handler of the DISABLED event.
+#define NRF_802154_STAT_IRQ_CYCLES_CCAIDLE         0x09 // !< Handler of the CCAIDLE event.
+#define NRF_802154_STAT_IRQ_CYCLES_CCABUSY         0x0A // !< Handler of the CCABUSY event.
+#define NRF_802154_STAT_IRQ_CYCLES_EDEND           0x0B // !< Handler of the EDEND event.
+#define NRF_802154_STAT_IRQ_CYCLES_FRAME_BCMATCHED 0x0C // !< Core callback for a matched frame header.
+#define NRF_802154_STAT_IRQ_CYCLES_FRAME_RECEIVED  0x0D // !< Core callback for a received frame.
+#define NRF_802154_STAT_IRQ_CYCLES_FRAME_FILTER    0x0E // !< Parsing and filtering of a part of the received frame header.
+
+/**
+ * @brief Number of items of the RADIO interrupt profile.
+ */
+#define NRF_802154_STAT_IRQ_CYCLES_ITEMS 0x0F
+
+/**
+ * @brief Type of structure holding execution times of a part of the RADIO interrupt handler.
+ *
+ * The average execution time is @c total_cycles divided by @c count.
+ */
+typedef struct
+{
+    /**@brief Number of executions. */
+    uint32_t count;
+    /**@brief Shortest execution in CPU cycles. */
+    uint32_t min_cycles;
+    /**@brief Longest execution in CPU cycles. */
+    uint32_t max_cycles;
+    /**@brief Sum of all executions in CPU cycles. */
+    uint64_t total_cycles;
+} nrf_802154_stat_irq_cycles_entry_t;
+
+/**
+ * @brief Type of structure holding the RADIO interrupt profile.
+ *
+ * The entries are indexed with @ref nrf_802154_stat_irq_cycles_item_t values.
+ */
+typedef struct
+{
+    /**@brief Execution times of the parts of the RADIO interrupt handler. */
+    nrf_802154_stat_irq_cycles_entry_t items[NRF_802154_STAT_IRQ_CYCLES_ITEMS];
+} nrf_802154_stat_irq_cycles_t;
+
+/**
+ * @brief Number of bins of the channel occupancy histogram of each channel.
+ */
+#define NRF_802154_STAT_OCCUPANCY_BINS          8
+
+/**
+ * @brief Upper bound of the lowest bin of the channel occupancy histogram [dBm].
+ *
+ * The lowest bin counts the samples below this power. Each following bin counts the samples
+ * within the range of @ref NRF_802154_STAT_OCCUPANCY_BIN_WIDTH_DB dB above the preceding one,
+ * and the highest bin counts all the remaining samples.
+ */
+#define NRF_802154_STAT_OCCUPANCY_BIN_FIRST_DBM (-90)
+
+/**
+ * @brief Width of a bin of the channel occupancy histogram [dB].
+ */
+#define NRF_802154_STAT_OCCUPANCY_BIN_WIDTH_DB  10
+
+/**
+ * @brief Type of structure holding histograms of the power sampled on idle channels.
+ *
+ * This structure holds counters of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Histograms of the channels, starting from @ref NRF_802154_STAT_CHANNEL_FIRST. */
+    uint32_t channels[NRF_802154_STAT_CHANNELS][NRF_802154_STAT_OCCUPANCY_BINS];
+} nrf_802154_stat_occupancy_t;
+
+/**
+ * @brief Number of antennas the antenna diversity statistics are counted for.
+ */
+#define NRF_802154_STAT_ANT_DIV_ANTENNAS 2
+
+/**
+ * @brief Type of structure holding statistics of the antenna diversity in the receive operations.
+ *
+ * The @c rssi array is indexed with nrf_802154_sl_ant_div_antenna_t values. Its bins are defined
+ * as in @ref nrf_802154_stat_occupancy_t. The buckets of the decision latency histogram are
+ * defined as in @ref nrf_802154_stat_queues_get. This structure holds counters of @c uint32_t
+ * type only.
+ */
+typedef struct
+{
+    /**@brief Histograms of the RSSI of the received frames, by the antenna selected for them. */
+    uint32_t rssi[NRF_802154_STAT_ANT_DIV_ANTENNAS][NRF_802154_STAT_OCCUPANCY_BINS];
+    /**@brief Number of received frames for which the other antenna was selected than for the previous one. */
+    uint32_t antenna_changes;
+    /**@brief Number of possible preambles that started the antenna selection. */
+    uint32_t preambles_detected;
+    /**@brief Number of antenna selections, by the time from the detection of the preamble to the start of the frame. */
+    uint32_t decision_latency[NRF_802154_STAT_LATENCY_BUCKETS];
+    /**@brief Number of antenna selections after which no frame started, for example because the selection came too late. */
+    uint32_t decisions_late;
+} nrf_802154_stat_ant_div_t;
+
+/**
+ * @brief Operations the Wi-Fi coexistence statistics are counted for.
+ *
+ * Possible values:
+ * - @ref NRF_802154_STAT_COEX_RX,
+ * - @ref NRF_802154_STAT_COEX_TX,
+ * - @ref NRF_802154_STAT_COEX_ACK
+ */
+typedef uint8_t nrf_802154_stat_coex_operation_t;
+
+#define NRF_802154_STAT_COEX_RX         0x00 // !< Reception, requested from PTA in receive mode.
+#define NRF_802154_STAT_COEX_TX         0x01 // !< Transmission of a frame, requested from PTA in transmit mode.
+#define NRF_802154_STAT_COEX_ACK        0x02 // !< Transmission of an ACK, requested from PTA in transmit mode.
+
+#define NRF_802154_STAT_COEX_OPERATIONS 0x03 // !< Number of operations the statistics are counted for.
+
+/**
+ * @brief Type of structure holding statistics of the access to the medium granted by the PTA.
+ *
+ * The arrays are indexed with @ref nrf_802154_stat_coex_operation_t values. This structure holds
+ * counters of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Number of grants, by the time from the request to the grant. */
+    uint32_t grant_latency[NRF_802154_STAT_COEX_OPERATIONS][NRF_802154_STAT_LATENCY_BUCKETS];
+    /**@brief Number of times the PTA denied the access to the medium. */
+    uint32_t denials[NRF_802154_STAT_COEX_OPERATIONS];
+    /**@brief Number of denials that revoked a grant during the operation. */
+    uint32_t revoked_grants[NRF_802154_STAT_COEX_OPERATIONS];
+} nrf_802154_stat_coex_t;
+
+/**
+ * @brief Operations aborted by the revocation of the timeslot.
+ *
+ * Possible values:
+ * - @ref NRF_802154_STAT_TIMESLOT_OP_NONE,
+ * - @ref NRF_802154_STAT_TIMESLOT_OP_RX,
+ * - @ref NRF_802154_STAT_TIMESLOT_OP_TX,
+ * - @ref NRF_802154_STAT_TIMESLOT_OP_RX_ACK,
+ * - @ref NRF_802154_STAT_TIMESLOT_OP_TX_ACK,
+ * - @ref NRF_802154_STAT_TIMESLOT_OP_OTHER
+ */
+typedef uint8_t nrf_802154_stat_timeslot_op_t;
+
+#define NRF_802154_STAT_TIMESLOT_OP_NONE   0x00 // !< No operation was aborted, the receiver was idle.
+#define NRF_802154_STAT_TIMESLOT_OP_RX     0x01 // !< Reception of a frame.
+#define NRF_802154_STAT_TIMESLOT_OP_TX     0x02 // !< Transmission of a frame, including its CCA.
+#define NRF_802154_STAT_TIMESLOT_OP_RX_ACK 0x03 // !< Wait for the ACK of a transmitted frame.
+#define NRF_802154_STAT_TIMESLOT_OP_TX_ACK 0x04 // !< Transmission of an ACK.
+#define NRF_802154_STAT_TIMESLOT_OP_OTHER  0x05 // !< Energy detection, CCA or a radio test.
+
+#define NRF_802154_STAT_TIMESLOT_OPS       0x06 // !< Number of operations the revocations are counted for.
+
+/**
+ * @brief Type of structure holding statistics of the timeslots granted by the radio scheduler.
+ */
+typedef struct
+{
+    /**@brief Number of granted timeslots. */
+    uint32_t grants;
+    /**@brief Number of timeslots revoked while the driver was not going to sleep. */
+    uint32_t revocations;
+    /**@brief Number of revocations by the operation they aborted. */
+    uint32_t aborted_ops[NRF_802154_STAT_TIMESLOT_OPS];
+    /**@brief Longest time from a revocation to the next grant in microseconds (us). */
+    uint32_t max_lost_time;
+    /**@brief Sum of the times from revocations to the next grants in microseconds (us). */
+    uint64_t total_lost_time;
+} nrf_802154_stat_timeslot_t;
+
+/**
+ * @brief Events of the timeslot log.
+ *
+ * Possible values:
+ * - @ref NRF_802154_STAT_TIMESLOT_EVENT_GRANTED,
+ * - @ref NRF_802154_STAT_TIMESLOT_EVENT_REVOKED,
+ * - @ref NRF_802154_STAT_TIMESLOT_EVENT_RELEASED
+ */
+typedef uint8_t nrf_802154_stat_timeslot_event_type_t;
+
+#define NRF_802154_STAT_TIMESLOT_EVENT_GRANTED  0x00 // !< The timeslot was granted.
+#define NRF_802154_STAT_TIMESLOT_EVENT_REVOKED  0x01 // !< The timeslot was revoked.
+#define NRF_802154_STAT_TIMESLOT_EVENT_RELEASED 0x02 // !< The timeslot ended when the driver went to sleep.
+
+/**
+ * @brief Structure that describes an event of the timeslot log.
+ */
+typedef struct
+{
+    uint64_t                              time; // !< Time of the event in microseconds, in the time base of @ref nrf_802154_time64_get.
+    nrf_802154_stat_timeslot_event_type_t type; // !< Type of the event.
+    nrf_802154_stat_timeslot_op_t         op;   // !< Operation aborted by a revocation, or @ref NRF_802154_STAT_TIMESLOT_OP_NONE.
+} nrf_802154_stat_timeslot_event_t;
+
 /**
  * @brief Type of structure holding statistics about the Radio Driver behavior.
  */
@@ -284,6 +1092,95 @@ typedef struct
     nrf_802154_stat_timestamps_t timestamps;
 } nrf_802154_stats_t;
 
+/**
+ * @brief Type of structure holding a consistent snapshot of the statistics.
+ */
+typedef struct
+{
+    /**@brief Statistics about the Radio Driver behavior. */
+    nrf_802154_stats_t       stats;
+
+    /**@brief Total times spent in certain states. */
+    nrf_802154_stat_totals_t totals;
+} nrf_802154_stat_snapshot_t;
+
+/**
+ * @brief Type of a cell of the TSCH slotframe.
+ *
+ * Possible values:
+ * - @ref NRF_802154_TSCH_CELL_TYPE_TX,
+ * - @ref NRF_802154_TSCH_CELL_TYPE_RX,
+ * - @ref NRF_802154_TSCH_CELL_TYPE_SHARED
+ */
+typedef uint8_t nrf_802154_tsch_cell_type_t;
+
+#define NRF_802154_TSCH_CELL_TYPE_TX     0x00 // !< Dedicated cell used to transmit the frame assigned to it.
+#define NRF_802154_TSCH_CELL_TYPE_RX     0x01 // !< Dedicated cell used to receive frames.
+#define NRF_802154_TSCH_CELL_TYPE_SHARED 0x02 // !< Shared cell. The assigned frame is transmitted after CCA, otherwise frames are received.
+
+/**
+ * @brief Structure describing a cell of the TSCH slotframe.
+ */
+typedef struct
+{
+    uint16_t                    slot_offset;    ///< Offset of the timeslot in the slotframe.
+    uint8_t                     channel_offset; ///< Channel offset of the cell.
+    nrf_802154_tsch_cell_type_t type;           ///< Type of the cell.
+} nrf_802154_tsch_cell_t;
+
+/**
+ * @brief Structure with the timing and channel hopping configuration of the TSCH slotframe.
+ */
+typedef struct
+{
+    uint64_t        asn;                     ///< Absolute Slot Number of the timeslot starting at @p slot_start.
+    uint32_t        slot_start;              ///< Start time of the timeslot @p asn in microseconds.
+    uint32_t        slot_duration;           ///< Duration of a timeslot in microseconds (macTsTimeslotLength).
+    uint16_t        slotframe_length;        ///< Number of timeslots in the slotframe.
+    uint32_t        tx_offset;               ///< Time from the timeslot start to the start of the frame transmission (macTsTxOffset).
+    uint32_t        rx_offset;               ///< Time from the timeslot start to the start of the receive window (macTsRxOffset).
+    uint32_t        rx_wait;                 ///< Duration of the receive window (macTsRxWait).
+    const uint8_t * p_hopping_sequence;      ///< Channel hopping sequence.
+    uint8_t         hopping_sequence_length; ///< Number of channels in the hopping sequence.
+} nrf_802154_tsch_config_t;
+
+/**
+ * @brief Structure that describes a channel of the receive hopping schedule.
+ */
+typedef struct
+{
+    uint8_t  channel;    ///< Channel to receive on (11-26).
+    uint32_t dwell_time; ///< Time to stay on the channel in microseconds.
+} nrf_802154_rx_hop_t;
+
+/**
+ * @brief Structure that describes a segment of a frame passed to
+ *        @ref nrf_802154_tx_buffer_submit_segments.
+ */
+typedef struct
+{
+    const uint8_t * p_data; ///< Pointer to the data of the segment.
+    uint8_t         length; ///< Length of the segment in bytes.
+} nrf_802154_tx_segment_t;
+
+/**
+ * @brief Types of requests that can be issued asynchronously.
+ *
+ * Possible values:
+ * - @ref NRF_802154_ASYNC_REQUEST_SLEEP,
+ * - @ref NRF_802154_ASYNC_REQUEST_RECEIVE,
+ * - @ref NRF_802154_ASYNC_REQUEST_TRANSMIT,
+ * - @ref NRF_802154_ASYNC_REQUEST_CHANNEL_UPDATE,
+ * - @ref NRF_802154_ASYNC_REQUEST_CCA_CFG_UPDATE
+ */
+typedef uint8_t nrf_802154_async_request_t;
+
+#define NRF_802154_ASYNC_REQUEST_SLEEP          0x00 // !< Request to enter the sleep state.
+#define NRF_802154_ASYNC_REQUEST_RECEIVE        0x01 // !< Request to enter the receive state.
+#define NRF_802154_ASYNC_REQUEST_TRANSMIT       0x02 // !< Request to transmit a frame.
+#define NRF_802154_ASYNC_REQUEST_CHANNEL_UPDATE 0x03 // !< Request to apply the new channel.
+#define NRF_802154_ASYNC_REQUEST_CCA_CFG_UPDATE 0x04 // !< Request to apply the new CCA configuration.
+
 /**
  *@}
  **/
@@ -72,6 +72,16 @@
  */
 #define NUMELTS(X)                      (sizeof((X)) / sizeof(X[0]))
 
+/**@brief Places a frame buffer of the driver in @ref NRF_802154_BUFFERS_SECTION, if defined, and
+ *        aligns it to @ref NRF_802154_BUFFERS_ALIGNMENT.
+ */
+#ifdef NRF_802154_BUFFERS_SECTION
+#define NRF_802154_BUFFER_PLACEMENT \
+    __ALIGNED(NRF_802154_BUFFERS_ALIGNMENT) __attribute__((section(NRF_802154_BUFFERS_SECTION)))
+#else
+#define NRF_802154_BUFFER_PLACEMENT __ALIGNED(NRF_802154_BUFFERS_ALIGNMENT)
+#endif
+
 /**@brief Wait procedure used in a busy loop. */
 #define nrf_802154_busy_wait()          __WFE()
 
@@ -125,6 +135,19 @@ typedef uint32_t nrf_802154_mcu_critical_state_t;
     }                                                    \
     while (0)
 
+/**@brief Extends a 32-bit time in microseconds to 64 bits.
+ *
+ * @param[in]  now   Current 64-bit time in microseconds.
+ * @param[in]  time  32-bit time to extend. It must be less than 2^31 microseconds (about 35 minutes)
+ *                   before or after @p now.
+ *
+ * @returns 64-bit time whose 32 least significant bits are equal to @p time.
+ */
+static inline uint64_t nrf_802154_time64_extend(uint64_t now, uint32_t time)
+{
+    return now + (int64_t)(int32_t)(time - (uint32_t)now);
+}
+
 static inline uint64_t NRF_802154_US_TO_RTC_TICKS(uint64_t time)
 {
     uint64_t t1, u1;
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @brief Module that defines the Trace Export Abstraction Layer for the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_TRACE_EXPORT_H_
+#define NRF_802154_TRACE_EXPORT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_trace_export Trace Export Abstraction Layer for the 802.15.4 driver
+ * @{
+ * @ingroup nrf_802154_trace_export
+ * @brief The Trace Export Abstraction Layer interface for the 802.15.4 driver.
+ *
+ * The Trace Export Abstraction Layer is an abstraction layer of the interface used to stream
+ * the records of the binary trace buffer to the host.
+ *
+ */
+
+/**
+ * @brief Initializes the trace export backend.
+ */
+void nrf_802154_trace_export_backend_init(void);
+
+/**
+ * @brief Starts writing data to the host.
+ *
+ * The data buffer must not be modified until @ref nrf_802154_trace_export_backend_written
+ * is called. This function is not called again before that.
+ *
+ * @param[in]  p_data  Pointer to the data to write.
+ * @param[in]  length  Number of bytes to write.
+ */
+void nrf_802154_trace_export_backend_write(const uint8_t * p_data, uint32_t length);
+
+/**
+ * @brief Callback function executed when the data passed to
+ *        @ref nrf_802154_trace_export_backend_write has been written.
+ *
+ * This function may be called from the context of @ref nrf_802154_trace_export_backend_write
+ * or from an interrupt handler of the backend.
+ */
+extern void nrf_802154_trace_export_backend_written(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TRACE_EXPORT_H_ */
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the trace export backend that uses SEGGER RTT.
+ *
+ * The records are written to the up channel @ref NRF_802154_TRACE_EXPORT_RTT_CHANNEL. The channel
+ * should be configured in the SKIP mode, so that writing never blocks. Data skipped by RTT when
+ * the host does not read the channel fast enough is not reported as dropped.
+ *
+ */
+
+#include "nrf_802154_trace_export.h"
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "SEGGER_RTT.h"
+
+void nrf_802154_trace_export_backend_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trace_export_backend_write(const uint8_t * p_data, uint32_t length)
+{
+    (void)SEGGER_RTT_Write(NRF_802154_TRACE_EXPORT_RTT_CHANNEL, p_data, length);
+
+    nrf_802154_trace_export_backend_written();
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the trace export backend that uses UARTE with EasyDMA.
+ *
+ * Only the TXD line is used. The data is transferred by EasyDMA, so the CPU is involved only
+ * when a transfer is started and in the ENDTX interrupt.
+ *
+ */
+
+#include "nrf_802154_trace_export.h"
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "hal/nrf_gpio.h"
+#include "hal/nrf_uarte.h"
+#include "platform/irq/nrf_802154_irq.h"
+
+#define UARTE NRF_802154_TRACE_EXPORT_UARTE_INSTANCE ///< UARTE instance used by this backend.
+
+static void uarte_irq_handler(void)
+{
+    if (nrf_uarte_event_check(UARTE, NRF_UARTE_EVENT_ENDTX))
+    {
+        nrf_uarte_event_clear(UARTE, NRF_UARTE_EVENT_ENDTX);
+
+        nrf_802154_trace_export_backend_written();
+    }
+}
+
+void nrf_802154_trace_export_backend_init(void)
+{
+    nrf_gpio_pin_set(NRF_802154_TRACE_EXPORT_UARTE_TX_PIN);
+    nrf_gpio_cfg_output(NRF_802154_TRACE_EXPORT_UARTE_TX_PIN);
+
+    nrf_uarte_baudrate_set(UARTE, NRF_802154_TRACE_EXPORT_UARTE_BAUDRATE);
+    nrf_uarte_txrx_pins_set(UARTE, NRF_802154_TRACE_EXPORT_UARTE_TX_PIN, NRF_UARTE_PSEL_DISCONNECTED);
+    nrf_uarte_event_clear(UARTE, NRF_UARTE_EVENT_ENDTX);
+    nrf_uarte_int_enable(UARTE, NRF_UARTE_INT_ENDTX_MASK);
+    nrf_uarte_enable(UARTE);
+
+    nrf_802154_irq_init(NRF_802154_TRACE_EXPORT_UARTE_IRQN,
+                        NRF_802154_TRACE_EXPORT_UARTE_IRQ_PRIORITY,
+                        uarte_irq_handler);
+    nrf_802154_irq_enable(NRF_802154_TRACE_EXPORT_UARTE_IRQN);
+}
+
+void nrf_802154_trace_export_backend_write(const uint8_t * p_data, uint32_t length)
+{
+    nrf_uarte_tx_buffer_set(UARTE, p_data, length);
+    nrf_uarte_task_trigger(UARTE, NRF_UARTE_TASK_STARTTX);
+}
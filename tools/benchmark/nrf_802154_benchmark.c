@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the throughput and latency benchmark of the 802.15.4 driver.
+ *
+ * The same file is built into two images that run on a pair of devices: the initiator, with
+ * @c BENCHMARK_ROLE_INITIATOR set to 1, and the responder, with it set to 0. Only the public API
+ * of the driver is used. Results are printed with @c printf, one JSON object per line, so they
+ * can be collected over RTT or UART by the retargeted standard output of the platform.
+ *
+ * The initiator runs the following tests:
+ * - @c tx_raw          Frames without the ACK request transmitted back to back without CCA.
+ * - @c tx_csma_ack     Frames with the ACK request transmitted with CSMA-CA.
+ * - @c request_latency Average time of a request passed to the core.
+ *
+ * The responder reports for each transmit test the number of frames received and lost, and the
+ * notification latency: the time from the end of a frame to the reception notification. The
+ * responder holds each received frame for @c BENCHMARK_RX_HOLD_TIME before freeing it, to measure
+ * the loss of frames versus @c NRF_802154_RX_BUFFERS with a given processing time.
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+
+#ifndef BENCHMARK_ROLE_INITIATOR
+#define BENCHMARK_ROLE_INITIATOR 1 ///< 1 to build the initiator image, 0 to build the responder.
+#endif
+
+#ifndef BENCHMARK_CHANNEL
+#define BENCHMARK_CHANNEL 20 ///< Channel used by the benchmark.
+#endif
+
+#ifndef BENCHMARK_FRAMES
+#define BENCHMARK_FRAMES 1000 ///< Number of frames transmitted in each transmit test.
+#endif
+
+#ifndef BENCHMARK_PSDU_LENGTH
+#define BENCHMARK_PSDU_LENGTH 100 ///< Length of the transmitted frames, including the FCS.
+#endif
+
+#ifndef BENCHMARK_RX_HOLD_TIME
+#define BENCHMARK_RX_HOLD_TIME 0 ///< Time in microseconds the responder holds a received frame.
+#endif
+
+#ifndef BENCHMARK_REQUESTS
+#define BENCHMARK_REQUESTS 1000 ///< Number of requests timed in the request latency test.
+#endif
+
+#define PAN_ID            0xbe27 ///< PAN ID of both devices.
+#define RESPONDER_ADDRESS 0x0001 ///< Short address of the responder.
+#define INITIATOR_ADDRESS 0x0002 ///< Short address of the initiator.
+
+#define HEADER_SIZE       9      ///< Size of the MAC header of the frames.
+#define PAYLOAD_SIZE      5      ///< Size of the test ID and the sequence number in the payload.
+#define FCS_SIZE          2      ///< Size of the FCS.
+#define US_PER_OCTET      32     ///< Time of a single octet on air in microseconds.
+
+#define TEST_ID_END       0xff ///< Test ID of the frame that ends a transmit test.
+
+#if (BENCHMARK_PSDU_LENGTH < (HEADER_SIZE + PAYLOAD_SIZE + FCS_SIZE)) || \
+    (BENCHMARK_PSDU_LENGTH > 127)
+#error BENCHMARK_PSDU_LENGTH is out of range.
+#endif
+
+/// Identifiers of the transmit tests, carried in the payload of the frames.
+typedef enum
+{
+    TEST_TX_RAW      = 1,
+    TEST_TX_CSMA_ACK = 2,
+} test_id_t;
+
+/** Gets the name of the transmit test printed in the results. */
+static const char * test_name_get(uint8_t test_id)
+{
+    switch (test_id)
+    {
+        case TEST_TX_RAW:
+            return "tx_raw";
+
+        case TEST_TX_CSMA_ACK:
+            return "tx_csma_ack";
+
+        default:
+            return "unknown";
+    }
+}
+
+/** Sets the PAN ID, the short address and the channel of the device, and starts the receiver. */
+static void radio_setup(uint16_t short_address)
+{
+    uint8_t pan_id[2]  = {(uint8_t)PAN_ID, (uint8_t)(PAN_ID >> 8)};
+    uint8_t address[2] = {(uint8_t)short_address, (uint8_t)(short_address >> 8)};
+
+    nrf_802154_init();
+    nrf_802154_pan_id_set(pan_id);
+    nrf_802154_short_address_set(address);
+    nrf_802154_channel_set(BENCHMARK_CHANNEL);
+    nrf_802154_auto_ack_set(true);
+    (void)nrf_802154_receive();
+}
+
+#if BENCHMARK_ROLE_INITIATOR
+
+static uint8_t       m_frame[BENCHMARK_PSDU_LENGTH + 1]; ///< PHR and PSDU of the transmitted frame.
+static volatile bool m_tx_done;                           ///< If the last transmission ended.
+static volatile bool m_tx_ok;                             ///< If the last transmission succeeded.
+
+/** Writes the header and the payload of the frame of the given test. */
+static void frame_build(uint8_t test_id, uint32_t seq, bool ack_request)
+{
+    m_frame[0] = BENCHMARK_PSDU_LENGTH;
+    m_frame[1] = ack_request ? 0x61 : 0x41; // Data frame, PAN ID compression.
+    m_frame[2] = 0x88;                      // Short destination and source addresses.
+    m_frame[3] = (uint8_t)seq;
+    m_frame[4] = (uint8_t)PAN_ID;
+    m_frame[5] = (uint8_t)(PAN_ID >> 8);
+    m_frame[6] = (uint8_t)RESPONDER_ADDRESS;
+    m_frame[7] = (uint8_t)(RESPONDER_ADDRESS >> 8);
+    m_frame[8] = (uint8_t)INITIATOR_ADDRESS;
+    m_frame[9] = (uint8_t)(INITIATOR_ADDRESS >> 8);
+
+    m_frame[HEADER_SIZE + 1] = test_id;
+    memcpy(&m_frame[HEADER_SIZE + 2], &seq, sizeof(seq));
+}
+
+/** Transmits the frame and waits until the transmission ends. */
+static bool frame_transmit(bool csma)
+{
+    m_tx_done = false;
+
+    if (csma)
+    {
+        nrf_802154_transmit_csma_ca_raw(m_frame);
+    }
+    else if (!nrf_802154_transmit_raw(m_frame, false))
+    {
+        return false;
+    }
+
+    while (!m_tx_done)
+    {
+        // Wait for the transmission result.
+    }
+
+    return m_tx_ok;
+}
+
+/** Runs a transmit test and prints the achieved frame rate. */
+static void tx_test_run(uint8_t test_id, bool csma, bool ack_request)
+{
+    uint32_t succeeded = 0;
+    uint32_t start     = nrf_802154_time_get();
+    uint32_t elapsed;
+
+    for (uint32_t seq = 0; seq < BENCHMARK_FRAMES; seq++)
+    {
+        frame_build(test_id, seq, ack_request);
+
+        if (frame_transmit(csma))
+        {
+            succeeded++;
+        }
+    }
+
+    elapsed = nrf_802154_time_get() - start;
+
+    printf("{\"role\":\"initiator\",\"test\":\"%s\",\"frames\":%u,\"succeeded\":%u,"
+           "\"time_us\":%lu,\"frames_per_s\":%lu}\n",
+           test_name_get(test_id),
+           (unsigned)BENCHMARK_FRAMES,
+           (unsigned)succeeded,
+           (unsigned long)elapsed,
+           (unsigned long)(((uint64_t)succeeded * 1000000UL) / (elapsed ? elapsed : 1U)));
+
+    // Tell the responder that the test ended, so it prints its results.
+    frame_build(TEST_ID_END, BENCHMARK_FRAMES, false);
+    (void)frame_transmit(false);
+}
+
+/** Measures the average time of a request passed through the request module to the core. */
+static void request_latency_test_run(void)
+{
+    uint32_t start = nrf_802154_time_get();
+    uint32_t elapsed;
+
+    for (uint32_t i = 0; i < BENCHMARK_REQUESTS; i++)
+    {
+        nrf_802154_channel_set(BENCHMARK_CHANNEL + (i & 1U));
+    }
+
+    elapsed = nrf_802154_time_get() - start;
+    nrf_802154_channel_set(BENCHMARK_CHANNEL);
+
+    printf("{\"role\":\"initiator\",\"test\":\"request_latency\",\"requests\":%u,"
+           "\"time_us\":%lu,\"avg_ns\":%lu}\n",
+           (unsigned)BENCHMARK_REQUESTS,
+           (unsigned long)elapsed,
+           (unsigned long)(((uint64_t)elapsed * 1000U) / BENCHMARK_REQUESTS));
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame,
+                                uint8_t       * p_ack,
+                                int8_t          power,
+                                uint8_t         lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+
+    m_tx_ok   = true;
+    m_tx_done = true;
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+
+    m_tx_ok   = false;
+    m_tx_done = true;
+}
+
+int main(void)
+{
+    radio_setup(INITIATOR_ADDRESS);
+
+    tx_test_run(TEST_TX_RAW, false, false);
+    tx_test_run(TEST_TX_CSMA_ACK, true, true);
+    request_latency_test_run();
+
+    printf("{\"role\":\"initiator\",\"test\":\"done\"}\n");
+
+    while (true)
+    {
+        // All tests completed.
+    }
+}
+
+#else // BENCHMARK_ROLE_INITIATOR
+
+#define HELD_FRAMES_SIZE 64U ///< Capacity of the queue of held frames, a power of two.
+
+/// Received frame held before it is freed.
+typedef struct
+{
+    uint8_t * p_data;   ///< Buffer of the frame.
+    uint32_t  rx_time;  ///< Time at which the frame was notified.
+} held_frame_t;
+
+static held_frame_t      m_held[HELD_FRAMES_SIZE]; ///< Frames waiting to be freed.
+static volatile uint32_t m_held_head;              ///< Number of frames put in @ref m_held.
+static volatile uint32_t m_held_tail;              ///< Number of frames freed from @ref m_held.
+
+static volatile uint8_t  m_test_id;              ///< ID of the test in progress, 0 if none.
+static volatile uint32_t m_received;             ///< Frames of the test received.
+static volatile uint32_t m_next_seq;             ///< Next expected sequence number.
+static volatile uint32_t m_lost;                 ///< Frames of the test lost.
+static volatile uint32_t m_rx_failed;            ///< Reception failures during the test.
+static volatile uint64_t m_latency_sum;          ///< Sum of the notification latencies.
+static volatile uint32_t m_latency_max;          ///< Maximal notification latency.
+static volatile bool     m_report_pending;       ///< If the results of a test are to be printed.
+static uint8_t           m_reported_test_id;     ///< ID of the test to be printed.
+static uint32_t          m_reported_received;    ///< Frames received in the test to be printed.
+static uint32_t          m_reported_lost;        ///< Frames lost in the test to be printed.
+static uint32_t          m_reported_rx_failed;   ///< Reception failures in the test to be printed.
+static uint64_t          m_reported_latency;     ///< Latency sum of the test to be printed.
+static uint32_t          m_reported_latency_max; ///< Maximal latency of the test to be printed.
+
+/** Copies the results of the current test to be printed and starts a new test. */
+static void test_end(void)
+{
+    m_reported_test_id     = m_test_id;
+    m_reported_received    = m_received;
+    m_reported_lost        = m_lost;
+    m_reported_rx_failed   = m_rx_failed;
+    m_reported_latency     = m_latency_sum;
+    m_reported_latency_max = m_latency_max;
+    m_report_pending       = true;
+
+    m_test_id     = 0;
+    m_received    = 0;
+    m_next_seq    = 0;
+    m_lost        = 0;
+    m_rx_failed   = 0;
+    m_latency_sum = 0;
+    m_latency_max = 0;
+}
+
+/** Accounts a received frame of a transmit test. */
+static void frame_account(const uint8_t * p_data, const nrf_802154_rx_metadata_t * p_metadata)
+{
+    uint8_t  test_id = p_data[HEADER_SIZE + 1];
+    uint32_t seq;
+    uint32_t frame_end;
+    uint32_t latency;
+
+    memcpy(&seq, &p_data[HEADER_SIZE + 2], sizeof(seq));
+
+    if (test_id == TEST_ID_END)
+    {
+        if (m_test_id != 0)
+        {
+            m_lost += BENCHMARK_FRAMES - m_next_seq;
+            test_end();
+        }
+
+        return;
+    }
+
+    if (test_id != m_test_id)
+    {
+        m_test_id = test_id;
+    }
+
+    if (seq >= m_next_seq)
+    {
+        m_lost    += seq - m_next_seq;
+        m_next_seq = seq + 1U;
+    }
+
+    m_received++;
+
+    if (p_metadata->time != NRF_802154_NO_TIMESTAMP)
+    {
+        frame_end = p_metadata->time + ((uint32_t)p_data[0] + 1U) * US_PER_OCTET;
+        latency   = nrf_802154_time_get() - frame_end;
+
+        m_latency_sum += latency;
+
+        if (latency > m_latency_max)
+        {
+            m_latency_max = latency;
+        }
+    }
+}
+
+void nrf_802154_received_metadata_raw(uint8_t                        * p_data,
+                                      const nrf_802154_rx_metadata_t * p_metadata)
+{
+    if (p_data[0] == BENCHMARK_PSDU_LENGTH)
+    {
+        frame_account(p_data, p_metadata);
+    }
+
+    if ((m_held_head - m_held_tail) < HELD_FRAMES_SIZE)
+    {
+        m_held[m_held_head & (HELD_FRAMES_SIZE - 1U)] = (held_frame_t){
+            .p_data  = p_data,
+            .rx_time = nrf_802154_time_get(),
+        };
+        m_held_head++;
+    }
+    else
+    {
+        nrf_802154_buffer_free_raw(p_data);
+    }
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    (void)error;
+
+    if (m_test_id != 0)
+    {
+        m_rx_failed++;
+    }
+}
+
+/** Frees the held frames whose hold time passed. */
+static void held_frames_free(void)
+{
+    while (m_held_tail != m_held_head)
+    {
+        held_frame_t * p_frame = &m_held[m_held_tail & (HELD_FRAMES_SIZE - 1U)];
+
+        if ((nrf_802154_time_get() - p_frame->rx_time) < BENCHMARK_RX_HOLD_TIME)
+        {
+            break;
+        }
+
+        nrf_802154_buffer_free_raw(p_frame->p_data);
+        m_held_tail++;
+    }
+}
+
+int main(void)
+{
+    radio_setup(RESPONDER_ADDRESS);
+
+    while (true)
+    {
+        held_frames_free();
+
+        if (m_report_pending)
+        {
+            m_report_pending = false;
+
+            printf("{\"role\":\"responder\",\"test\":\"%s\",\"rx_buffers\":%u,"
+                   "\"hold_time_us\":%u,\"received\":%lu,\"lost\":%lu,\"rx_failed\":%lu,"
+                   "\"ntf_latency_avg_us\":%lu,\"ntf_latency_max_us\":%lu}\n",
+                   test_name_get(m_reported_test_id),
+                   (unsigned)NRF_802154_RX_BUFFERS,
+                   (unsigned)BENCHMARK_RX_HOLD_TIME,
+                   (unsigned long)m_reported_received,
+                   (unsigned long)m_reported_lost,
+                   (unsigned long)m_reported_rx_failed,
+                   (unsigned long)(m_reported_latency /
+                                   (m_reported_received ? m_reported_received : 1U)),
+                   (unsigned long)m_reported_latency_max);
+        }
+    }
+}
+
+#endif // BENCHMARK_ROLE_INITIATOR
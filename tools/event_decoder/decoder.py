@@ -1,9 +1,24 @@
+import argparse
 import os
 import re
+import struct
 
 """
 The script goes through all driver source files and searches for DEBUG_LOG_FUNCTION_RE pattern.
 Then it prints macro constant for `nrf_802154_debug.h` and `decode.html` entries.
+
+When called with `--trace <dump>`, the script decodes the binary trace buffer
+(`g_nrf_802154_trace_buffer`, see `nrf_802154_trace.h`) and prints the timeline of records.
+The dump is either the output of GDB `x/<2 * NRF_802154_TRACE_BUFFER_LEN>xw &g_nrf_802154_trace_buffer`
+or a binary file created with GDB `dump binary value <file> g_nrf_802154_trace_buffer`.
+Pass the value of `g_nrf_802154_trace_idx` with `--index` to print the records from the oldest one.
+A binary capture of the stream written by the trace export (RTT or UARTE) is decoded the same way.
+
+When called with `--inputs <dump>`, the script extracts the input events of the driver state machine
+recorded with `NRF_802154_TRACE_INPUT_ENABLED` (RADIO events, queued requests and timeslot changes),
+prints them in order with the time spent handling each of them, and summarizes the handling cost
+per event. Pass the capture of the same scenario taken with another build with `--baseline` to compare
+the cost of every event against it.
 """
 
 DEBUG_LOG_FUNCTION_RE = re.compile(r'nrf_802154_log_entry\(\s*(\w+)\s*,\s*\d+\s*\);', re.MULTILINE)
@@ -17,26 +32,281 @@ DECODER_AND_DEFINES_TEMPLATE = \
 
 DRV_SRC_PATH = os.path.normpath(os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../src'))
 
-print('Searching sources in "{}"'.format(DRV_SRC_PATH))
+LOG_TYPE_NAMES = {
+    1: 'ENTER',
+    2: 'EXIT',
+    3: 'LOCAL_EVENT',
+    4: 'GLOBAL_EVENT',
+    14: 'INPUT',
+    15: 'DROPPED',
+}
 
-MODULE_HEX_ID_MAP = {
-    'nrf_802154_rsch.c': '1000'
+INPUT_SOURCE_NAMES = {
+    0: 'RADIO',
+    1: 'REQUEST',
+    2: 'TIMESLOT',
 }
 
-for dir_path, dirs, files in os.walk(DRV_SRC_PATH):
-    for file in files:
-        with open(os.path.join(dir_path, file)) as file_handler:
-            module_id = MODULE_HEX_ID_MAP.get(file, 'FFFF')
-            print('{} ({})'.format(file, module_id))
+# Items of the RADIO IRQ profile, see nrf_802154_stat_irq_cycles_item_t.
+INPUT_RADIO_EVENT_NAMES = [
+    'RADIO_IRQ', 'SYNC', 'READY', 'ADDRESS', 'BCMATCH', 'CRCERROR', 'CRCOK', 'PHYEND', 'DISABLED',
+    'CCAIDLE', 'CCABUSY', 'EDEND', 'FRAME_BCMATCHED', 'FRAME_RECEIVED', 'FRAME_CCAIDLE',
+    'FRAME_CCABUSY', 'ACK_GENERATION', 'FRAME_FILTER',
+]
+
+REQ_TYPE_RE = re.compile(r'^\s*(REQ_TYPE_\w+),', re.MULTILINE)
+
+MODULE_ID_RE       = re.compile(r'NRF_802154_(?:DRV|MPSL|SL)_MODULE_ID_(\w+)\s*=\s*(\d+)U?')
+GLOBAL_EVENT_ID_RE = re.compile(r'NRF_802154_LOG_GLOBAL_EVENT_ID_(\w+)\s*=\s*(\d+)U?')
+LOCAL_EVENT_ID_RE  = re.compile(r'NRF_802154_LOG_L_EVENT_DEFINE\(\s*(\w+)\s*,\s*(\w+)\s*,\s*(\d+)')
+
+
+def read_log_codes():
+    """Read names of modules and events from `nrf_802154_debug_log_codes.h`."""
+    with open(os.path.join(DRV_SRC_PATH, 'nrf_802154_debug_log_codes.h')) as file_handler:
+        codes = file_handler.read()
+
+    modules       = {int(value): name for name, value in MODULE_ID_RE.findall(codes)}
+    global_events = {int(value): name for name, value in GLOBAL_EVENT_ID_RE.findall(codes)}
+    local_events  = {(module, int(value)): name for module, name, value in LOCAL_EVENT_ID_RE.findall(codes)}
+
+    return modules, global_events, local_events
+
+
+def read_request_names():
+    """Read names of the queued requests from `nrf_802154_request_swi.c`."""
+    with open(os.path.join(DRV_SRC_PATH, 'nrf_802154_request_swi.c')) as file_handler:
+        source = file_handler.read()
+
+    # Types are declared in order in the nrf_802154_req_type_t enumeration.
+    enum = source[source.find('typedef enum'):source.find('nrf_802154_req_type_t;')]
+
+    return [name[len('REQ_TYPE_'):] for name in REQ_TYPE_RE.findall(enum)]
+
+
+def input_name(source, event_id, request_names):
+    """Get the name of an input event of the driver state machine."""
+    if source == 0 and event_id < len(INPUT_RADIO_EVENT_NAMES):
+        name = INPUT_RADIO_EVENT_NAMES[event_id]
+    elif source == 1 and event_id < len(request_names):
+        name = request_names[event_id]
+    elif source == 2:
+        name = 'PRIO_{}'.format(event_id)
+    else:
+        name = 'EVENT_{}'.format(event_id)
+
+    return '{}.{}'.format(INPUT_SOURCE_NAMES.get(source, 'SOURCE_{}'.format(source)), name)
+
+
+def read_trace_words(path):
+    """Read words of the trace buffer from a GDB `x/xw` output or from a binary dump."""
+    with open(path, 'rb') as file_handler:
+        data = file_handler.read()
+
+    try:
+        text = data.decode('ascii')
+    except UnicodeDecodeError:
+        text = None
+
+    if text is None or not re.search(r'0x[0-9a-fA-F]+', text):
+        return list(struct.unpack('<{}I'.format(len(data) // 4), data[:len(data) // 4 * 4]))
+
+    words = []
+
+    for line in text.splitlines():
+        # Skip the address printed by GDB at the beginning of each line.
+        if ':' in line:
+            line = line.split(':', 1)[1]
+
+        words.extend(int(word, 16) for word in re.findall(r'0x[0-9a-fA-F]+', line))
+
+    return words
+
+
+def read_trace_records(path, index):
+    """Read the records of a trace dump, starting from the oldest one if the index is known."""
+    words   = read_trace_words(path)
+    records = [(words[i], words[i + 1]) for i in range(0, len(words) - 1, 2)]
+
+    if index is not None and records:
+        start   = index % len(records)
+        records = records[start:] + records[:start]
+
+    return records
+
+
+def read_inputs(path, index):
+    """Get the input events of a trace dump as a list of (time, name, param, cost) tuples.
+
+    The cost is the time between the record of the event and the record of the end of its
+    handling, or None if the end was not recorded. Nested events, e.g. a core callback called
+    from a RADIO event handler, are matched with their own end records.
+    """
+    request_names = read_request_names()
+    inputs        = []
+    pending       = []
+
+    for time, entry in read_trace_records(path, index):
+        if (entry >> 28) == 15:
+            # Records were lost, so the pending events cannot be matched anymore.
+            pending = []
+            continue
+
+        if (entry >> 28) != 14:
+            continue
+
+        done     = (entry >> 27) & 0x1
+        source   = (entry >> 24) & 0x7
+        event_id = (entry >> 16) & 0xff
+        name     = input_name(source, event_id, request_names)
+
+        if not done:
+            pending.append((len(inputs), name, time))
+            inputs.append([time, name, entry & 0xffff, None])
+            continue
+
+        for i in range(len(pending) - 1, -1, -1):
+            if pending[i][1] == name:
+                inputs[pending[i][0]][3] = (time - pending[i][2]) & 0xffffffff
+                del pending[i:]
+                break
+
+    return [tuple(event) for event in inputs]
+
+
+def cost_summary(inputs):
+    """Get the number of handled events and the total and maximum handling cost per event name."""
+    summary = {}
+
+    for _, name, _, cost in inputs:
+        if cost is None:
+            continue
+
+        count, total, maximum = summary.get(name, (0, 0, 0))
+        summary[name]         = (count + 1, total + cost, max(maximum, cost))
+
+    return summary
+
+
+def replay_inputs(path, index, baseline_path, baseline_index):
+    """Print the input sequence of a capture and the handling cost of its events."""
+    inputs    = read_inputs(path, index)
+    prev_time = None
+
+    print('{:>10} {:>8}  {:<28} {:>6} {:>9}'.format('time [us]', 'delta', 'input', 'param', 'cost [us]'))
+
+    for time, name, param, cost in inputs:
+        delta     = '' if prev_time is None else '+{}'.format((time - prev_time) & 0xffffffff)
+        prev_time = time
+
+        print('{:>10} {:>8}  {:<28} {:>6} {:>9}'.format(time, delta, name, param,
+                                                        '?' if cost is None else cost))
+
+    summary  = cost_summary(inputs)
+    baseline = cost_summary(read_inputs(baseline_path, baseline_index)) if baseline_path else {}
+
+    print()
+    print('{:<28} {:>6} {:>9} {:>9} {:>12}'.format('input', 'count', 'mean', 'max', 'mean vs base'))
+
+    for name in sorted(summary):
+        count, total, maximum = summary[name]
+        mean                  = total / count
+        compare               = ''
+
+        if name in baseline:
+            base_count, base_total, _ = baseline[name]
+            base_mean                 = base_total / base_count
+            compare                   = '{:+.1f}'.format(mean - base_mean)
+
+        print('{:<28} {:>6} {:>9.1f} {:>9} {:>12}'.format(name, count, mean, maximum, compare))
+
+
+def decode_trace(path, index):
+    """Print the timeline of the records from the binary trace buffer."""
+    modules, global_events, local_events = read_log_codes()
+    request_names = read_request_names()
+    records       = read_trace_records(path, index)
+    prev_time     = None
+
+    print('{:>10} {:>8}  {:<18} {:<12} {}'.format('time [us]', 'delta', 'module', 'type', 'event'))
+
+    for time, entry in records:
+        log_type = entry >> 28
+
+        # Empty records have not been written since the reset.
+        if log_type not in LOG_TYPE_NAMES:
+            continue
+
+        module_id = (entry >> 22) & 0x3f
+        event_id  = (entry >> 16) & 0x3f
+        param     = entry & 0xffff
+        module    = modules.get(module_id, 'MODULE_{}'.format(module_id))
+
+        if log_type == 15:
+            print('{:>10} {:>8}  {} records dropped'.format(time, '', entry & 0xfffffff))
+            continue
+
+        if log_type == 14:
+            name = input_name((entry >> 24) & 0x7, (entry >> 16) & 0xff, request_names)
+            done = ' done' if (entry >> 27) & 0x1 else ' param={}'.format(param)
+            print('{:>10} {:>8}  {:<18} {:<12} {}{}'.format(time, '', '', 'INPUT', name, done))
+            continue
+
+        if log_type in (1, 2):
+            event = 'function @ 0x....{:04x}'.format(param)
+        elif log_type == 3:
+            event = '{} param={}'.format(local_events.get((module, event_id), 'EVENT_{}'.format(event_id)), param)
+        else:
+            event = '{} param={}'.format(global_events.get(event_id, 'EVENT_{}'.format(event_id)), param)
+
+        delta     = '' if prev_time is None else '+{}'.format((time - prev_time) & 0xffffffff)
+        prev_time = time
+
+        print('{:>10} {:>8}  {:<18} {:<12} {}'.format(time, delta, module, LOG_TYPE_NAMES[log_type], event))
+
+
+def scan_sources():
+
+    print('Searching sources in "{}"'.format(DRV_SRC_PATH))
+
+    MODULE_HEX_ID_MAP = {
+        'nrf_802154_rsch.c': '1000'
+    }
+
+    for dir_path, dirs, files in os.walk(DRV_SRC_PATH):
+        for file in files:
+            with open(os.path.join(dir_path, file)) as file_handler:
+                module_id = MODULE_HEX_ID_MAP.get(file, 'FFFF')
+                print('{} ({})'.format(file, module_id))
+
+                decoder = []
+                defines = []
+
+                for index, function in enumerate(DEBUG_LOG_FUNCTION_RE.findall(file_handler.read())):
+                    hex_id = hex(int(module_id, 16) + index)
+                    decoder.append('            {{id: "FUNCTION_{}", val: {}, from: "RSCH", to: "RSCH", text: "{}()"}},'.format(function, hex_id, function))
+                    defines.append('#define FUNCTION_{:<40} {}UL'.format(function, hex_id))
 
-            decoder = []
-            defines = []
+                if decoder:
+                    print(DECODER_AND_DEFINES_TEMPLATE.format(decoder='\n'.join(decoder), defines='\n'.join(defines)))
 
-            for index, function in enumerate(DEBUG_LOG_FUNCTION_RE.findall(file_handler.read())):
-                hex_id = hex(int(module_id, 16) + index)
-                decoder.append('            {{id: "FUNCTION_{}", val: {}, from: "RSCH", to: "RSCH", text: "{}()"}},'.format(function, hex_id, function))
-                defines.append('#define FUNCTION_{:<40} {}UL'.format(function, hex_id))
 
-            if decoder:
-                print(DECODER_AND_DEFINES_TEMPLATE.format(decoder='\n'.join(decoder), defines='\n'.join(defines)))
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--trace', metavar='DUMP', help='decode a dump of the binary trace buffer')
+    parser.add_argument('--index', type=lambda x: int(x, 0),
+                        help='value of g_nrf_802154_trace_idx when the dump was taken')
+    parser.add_argument('--inputs', metavar='DUMP',
+                        help='print the input events of a dump and the cost of their handling')
+    parser.add_argument('--baseline', metavar='DUMP',
+                        help='dump of the same scenario to compare the handling cost against')
+    parser.add_argument('--baseline-index', type=lambda x: int(x, 0),
+                        help='value of g_nrf_802154_trace_idx when the baseline dump was taken')
+    args = parser.parse_args()
 
+    if args.inputs:
+        replay_inputs(args.inputs, args.index, args.baseline, args.baseline_index)
+    elif args.trace:
+        decode_trace(args.trace, args.index)
+    else:
+        scan_sources()
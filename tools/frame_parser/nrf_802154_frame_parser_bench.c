@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the host benchmark of the 802.15.4 frame parser.
+ *
+ * The benchmark builds a corpus of frames covering the 2003, 2006 and 2015 frame versions, every
+ * combination of the destination and source addressing modes and of the PAN ID compression, header
+ * IEs and secured frames with every Key Identifier Mode. Each entry point of the parser is then
+ * called for all frames of the corpus, and the time and, on Linux, the number of instructions per
+ * frame are printed with @c printf, one JSON object per line.
+ *
+ * The frame parser needs only the C library and an empty @c nrf.h, provided in @c host, so the
+ * benchmark is built with the host compiler from the root of the repository:
+ *
+ * @code
+ * cc -O2 -Itools/frame_parser/host -Isrc -Isrc/mac_features \
+ *    tools/frame_parser/nrf_802154_frame_parser_bench.c \
+ *    src/mac_features/nrf_802154_frame_parser.c -o frame_parser_bench
+ * @endcode
+ *
+ * Options:
+ * - @c --rounds @c N    Number of passes over the corpus for each entry point.
+ * - @c --corpus @c DIR  Write every frame of the corpus to a file in @c DIR, to seed the fuzz
+ *                       harness in @c nrf_802154_frame_parser_fuzz.c.
+ *
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#define BENCH_ROUNDS_DEFAULT 10000 ///< Default number of passes over the corpus.
+#define CORPUS_MAX_FRAMES    1024  ///< Maximum number of frames in the corpus.
+#define FRAME_BUFFER_SIZE    (PHR_SIZE + MAX_PACKET_SIZE) ///< Size of a frame buffer of the driver.
+
+#define CSL_IE_ID            0x1a ///< Element ID of the CSL header IE.
+#define CSL_IE_SIZE          4    ///< Size of the content of the CSL header IE.
+#define HT1_IE_ID            0x7e ///< Element ID of the Header Termination 1 IE.
+#define MIC_32_SIZE          4    ///< Size of the MIC of the frames secured with MIC-32.
+#define DATA_PAYLOAD_SIZE    10   ///< Size of the payload of the data frames.
+
+/// Frames of the corpus, each one starting with the PHR.
+static uint8_t  m_corpus[CORPUS_MAX_FRAMES][FRAME_BUFFER_SIZE];
+static uint32_t m_corpus_size; ///< Number of frames in @ref m_corpus.
+
+/// Keeps the results of the parser, so that the compiler does not remove the calls.
+static volatile uintptr_t m_sink;
+
+/** Writes a header IE descriptor with the given element ID and content length. */
+static uint8_t * header_ie_write(uint8_t * p_dst, uint8_t id, uint8_t len)
+{
+    uint16_t descriptor = (uint16_t)((len & IE_HEADER_LENGTH_MASK) | ((uint16_t)id << 7));
+
+    p_dst[0] = (uint8_t)descriptor;
+    p_dst[1] = (uint8_t)(descriptor >> 8);
+
+    return p_dst + 2;
+}
+
+/**
+ * Builds a frame with the given Frame Control field.
+ *
+ * The fields following the addressing fields are placed at the offsets returned by the parser,
+ * so a frame is added to the corpus only if its addressing fields can be parsed.
+ */
+static bool frame_build(uint8_t * p_frame, uint8_t fcf_0, uint8_t fcf_1, uint8_t key_id_mode)
+{
+    uint8_t * p_next;
+    uint8_t   offset;
+
+    memset(p_frame, 0, FRAME_BUFFER_SIZE);
+
+    p_frame[PHR_OFFSET]          = MAX_PACKET_SIZE;
+    p_frame[PHR_SIZE]            = fcf_0;
+    p_frame[PHR_SIZE + 1]        = fcf_1;
+    p_frame[PHR_SIZE + FCF_SIZE] = 0x5a; // Sequence number.
+
+    offset = nrf_802154_frame_parser_addressing_end_offset_get(p_frame);
+
+    if (offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
+    {
+        return false;
+    }
+
+    // PAN IDs and addresses.
+    for (uint8_t i = PHR_SIZE + FCF_SIZE + DSN_SIZE; i < offset; i++)
+    {
+        p_frame[i] = (uint8_t)(0xa0 + i);
+    }
+
+    p_next = &p_frame[offset];
+
+    if (fcf_0 & SECURITY_ENABLED_BIT)
+    {
+        *p_next = SECURITY_LEVEL_ENC_MIC_32 | key_id_mode;
+        p_next  = &p_frame[nrf_802154_frame_parser_key_id_offset_get(p_frame)];
+
+        switch (key_id_mode)
+        {
+            case KEY_ID_MODE_1:
+                p_next += KEY_ID_MODE_1_SIZE;
+                break;
+
+            case KEY_ID_MODE_2:
+                p_next += KEY_ID_MODE_2_SIZE;
+                break;
+
+            case KEY_ID_MODE_3:
+                p_next += KEY_ID_MODE_3_SIZE;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (fcf_1 & IE_PRESENT_BIT)
+    {
+        p_next  = header_ie_write(p_next, CSL_IE_ID, CSL_IE_SIZE);
+        p_next += CSL_IE_SIZE;
+        p_next  = header_ie_write(p_next, HT1_IE_ID, 0);
+    }
+
+    if ((fcf_0 & FRAME_TYPE_MASK) == FRAME_TYPE_COMMAND)
+    {
+        *p_next++ = MAC_CMD_DATA_REQ;
+    }
+    else
+    {
+        p_next += DATA_PAYLOAD_SIZE;
+    }
+
+    if (fcf_0 & SECURITY_ENABLED_BIT)
+    {
+        p_next += MIC_32_SIZE;
+    }
+
+    p_frame[PHR_OFFSET] = (uint8_t)(p_next - &p_frame[PHR_SIZE] + FCS_SIZE);
+
+    return true;
+}
+
+/** Fills the corpus with frames of all supported formats. */
+static void corpus_build(void)
+{
+    static const uint8_t versions[]     = {FRAME_VERSION_0, FRAME_VERSION_1, FRAME_VERSION_2};
+    static const uint8_t dst_modes[]    = {DEST_ADDR_TYPE_NONE,
+                                           DEST_ADDR_TYPE_SHORT,
+                                           DEST_ADDR_TYPE_EXTENDED};
+    static const uint8_t src_modes[]    = {SRC_ADDR_TYPE_NONE,
+                                           SRC_ADDR_TYPE_SHORT,
+                                           SRC_ADDR_TYPE_EXTENDED};
+    static const uint8_t frame_types[]  = {FRAME_TYPE_DATA, FRAME_TYPE_COMMAND};
+    static const uint8_t key_id_modes[] = {KEY_ID_MODE_0,
+                                           KEY_ID_MODE_1,
+                                           KEY_ID_MODE_2,
+                                           KEY_ID_MODE_3};
+
+    for (uint32_t v = 0; v < sizeof(versions); v++)
+    {
+        for (uint32_t d = 0; d < sizeof(dst_modes); d++)
+        {
+            for (uint32_t s = 0; s < sizeof(src_modes); s++)
+            {
+                for (uint32_t t = 0; t < sizeof(frame_types); t++)
+                {
+                    for (uint32_t k = 0; k < sizeof(key_id_modes) + 1; k++)
+                    {
+                        for (uint32_t flags = 0; flags < 4; flags++)
+                        {
+                            bool    secured     = (k > 0);
+                            bool    ie_present  = (flags & 1) != 0;
+                            bool    panid_compr = (flags & 2) != 0;
+                            uint8_t fcf_0       = frame_types[t] | ACK_REQUEST_BIT;
+                            uint8_t fcf_1       = versions[v] | dst_modes[d] | src_modes[s];
+
+                            // Only the 2015 frame version carries IEs.
+                            if (ie_present && (versions[v] != FRAME_VERSION_2))
+                            {
+                                continue;
+                            }
+
+                            fcf_0 |= secured ? SECURITY_ENABLED_BIT : 0;
+                            fcf_0 |= panid_compr ? PAN_ID_COMPR_MASK : 0;
+                            fcf_1 |= ie_present ? IE_PRESENT_BIT : 0;
+
+                            if ((m_corpus_size < CORPUS_MAX_FRAMES) &&
+                                frame_build(m_corpus[m_corpus_size],
+                                            fcf_0,
+                                            fcf_1,
+                                            secured ? key_id_modes[k - 1] : 0))
+                            {
+                                m_corpus_size++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** Writes every frame of the corpus to a separate file in the given directory. */
+static int corpus_write(const char * p_dir)
+{
+    char path[512];
+
+    for (uint32_t i = 0; i < m_corpus_size; i++)
+    {
+        FILE * p_file;
+
+        snprintf(path, sizeof(path), "%s/frame_%03u.bin", p_dir, (unsigned)i);
+        p_file = fopen(path, "wb");
+
+        if (p_file == NULL)
+        {
+            perror(path);
+            return -1;
+        }
+
+        fwrite(m_corpus[i], 1, PHR_SIZE + m_corpus[i][PHR_OFFSET], p_file);
+        fclose(p_file);
+    }
+
+    return 0;
+}
+
+static void dst_addr_get_call(const uint8_t * p_frame)
+{
+    bool extended;
+
+    m_sink = (uintptr_t)nrf_802154_frame_parser_dst_addr_get(p_frame, &extended) + extended;
+}
+
+static void src_addr_get_call(const uint8_t * p_frame)
+{
+    bool extended;
+
+    m_sink = (uintptr_t)nrf_802154_frame_parser_src_addr_get(p_frame, &extended) + extended;
+}
+
+static void mhr_parse_call(const uint8_t * p_frame)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr_data;
+
+    m_sink = nrf_802154_frame_parser_mhr_parse(p_frame, &mhr_data) + mhr_data.addressing_end_offset;
+}
+
+static void mhr_parse_cached_call(const uint8_t * p_frame)
+{
+    m_sink = (uintptr_t)nrf_802154_frame_parser_mhr_parse_cached(p_frame);
+}
+
+static void sec_ctrl_get_call(const uint8_t * p_frame)
+{
+    m_sink = (uintptr_t)nrf_802154_frame_parser_sec_ctrl_get(p_frame);
+}
+
+static void key_id_get_call(const uint8_t * p_frame)
+{
+    m_sink = (uintptr_t)nrf_802154_frame_parser_key_id_get(p_frame);
+}
+
+static void ie_header_get_call(const uint8_t * p_frame)
+{
+    m_sink = (uintptr_t)nrf_802154_frame_parser_ie_header_get(p_frame);
+}
+
+static void data_request_is_call(const uint8_t * p_frame)
+{
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_data =
+        nrf_802154_frame_parser_mhr_parse_cached(p_frame);
+
+    m_sink = (p_mhr_data != NULL) && nrf_802154_frame_parser_data_request_is(p_frame, p_mhr_data);
+}
+
+/// Description of a benchmarked entry point of the parser.
+typedef struct
+{
+    const char * p_name;                    ///< Name printed in the results.
+    void (* call)(const uint8_t * p_frame); ///< Function calling the entry point.
+    bool same_frame;                        ///< If all passes are over one frame before the next.
+} entry_point_t;
+
+static const entry_point_t m_entry_points[] =
+{
+    {"dst_addr_get",          dst_addr_get_call,     false},
+    {"src_addr_get",          src_addr_get_call,     false},
+    {"mhr_parse",             mhr_parse_call,        false},
+    {"mhr_parse_cached_miss", mhr_parse_cached_call, false},
+    {"mhr_parse_cached_hit",  mhr_parse_cached_call, true },
+    {"sec_ctrl_get",          sec_ctrl_get_call,     false},
+    {"key_id_get",            key_id_get_call,       false},
+    {"ie_header_get",         ie_header_get_call,    false},
+    {"data_request_is",       data_request_is_call,  true },
+};
+
+/** Opens the counter of instructions retired by this process, or returns -1 if there is none. */
+static int instructions_counter_open(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+/** Starts counting instructions. */
+static void instructions_counter_start(int fd)
+{
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#else
+    (void)fd;
+#endif
+}
+
+/** Stops counting instructions and returns the number of instructions counted. */
+static uint64_t instructions_counter_stop(int fd)
+{
+    uint64_t count = 0;
+
+#if defined(__linux__)
+    if ((fd < 0) ||
+        (ioctl(fd, PERF_EVENT_IOC_DISABLE, 0) != 0) ||
+        (read(fd, &count, sizeof(count)) != sizeof(count)))
+    {
+        count = 0;
+    }
+#else
+    (void)fd;
+#endif
+
+    return count;
+}
+
+/** Returns the monotonic time in nanoseconds. */
+static uint64_t time_ns_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/** Calls an entry point for the whole corpus and prints the cost of a single call. */
+static void entry_point_bench(const entry_point_t * p_entry, uint32_t rounds, int counter_fd)
+{
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t instructions;
+    double   calls = (double)rounds * m_corpus_size;
+
+    instructions_counter_start(counter_fd);
+    start = time_ns_get();
+
+    if (p_entry->same_frame)
+    {
+        for (uint32_t i = 0; i < m_corpus_size; i++)
+        {
+            for (uint32_t round = 0; round < rounds; round++)
+            {
+                p_entry->call(m_corpus[i]);
+            }
+        }
+    }
+    else
+    {
+        for (uint32_t round = 0; round < rounds; round++)
+        {
+            for (uint32_t i = 0; i < m_corpus_size; i++)
+            {
+                p_entry->call(m_corpus[i]);
+            }
+        }
+    }
+
+    elapsed      = time_ns_get() - start;
+    instructions = instructions_counter_stop(counter_fd);
+
+    printf("{\"entry\": \"%s\", \"frames\": %u, \"rounds\": %u, \"ns_per_frame\": %.2f, "
+           "\"instructions_per_frame\": ",
+           p_entry->p_name,
+           (unsigned)m_corpus_size,
+           (unsigned)rounds,
+           (double)elapsed / calls);
+
+    if (instructions != 0)
+    {
+        printf("%.1f}\n", (double)instructions / calls);
+    }
+    else
+    {
+        printf("null}\n");
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t     rounds   = BENCH_ROUNDS_DEFAULT;
+    const char * p_corpus = NULL;
+    int          counter_fd;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--rounds") == 0) && (i + 1 < argc))
+        {
+            rounds = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "--corpus") == 0) && (i + 1 < argc))
+        {
+            p_corpus = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--rounds N] [--corpus DIR]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    corpus_build();
+
+    if ((p_corpus != NULL) && (corpus_write(p_corpus) != 0))
+    {
+        return 1;
+    }
+
+    counter_fd = instructions_counter_open();
+
+    for (uint32_t i = 0; i < sizeof(m_entry_points) / sizeof(m_entry_points[0]); i++)
+    {
+        entry_point_bench(&m_entry_points[i], rounds, counter_fd);
+    }
+
+    return 0;
+}
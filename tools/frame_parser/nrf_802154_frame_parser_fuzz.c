@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the fuzz harness of the 802.15.4 frame parser.
+ *
+ * Each input is copied to a buffer of the size of a frame buffer of the driver, so that reads past
+ * the buffer are caught by AddressSanitizer. All entry points of the parser are called for the
+ * frame, and the results are checked for consistency:
+ * - Offsets are zero, @ref NRF_802154_FRAME_PARSER_INVALID_OFFSET, or inside the buffer.
+ * - The pointers returned by the get functions match the offsets.
+ * - @ref nrf_802154_frame_parser_mhr_parse and @ref nrf_802154_frame_parser_mhr_parse_cached
+ *   return the same result.
+ *
+ * The harness is built for libFuzzer from the root of the repository:
+ *
+ * @code
+ * clang -g -O1 -fsanitize=fuzzer,address,undefined \
+ *    -Itools/frame_parser/host -Isrc -Isrc/mac_features \
+ *    tools/frame_parser/nrf_802154_frame_parser_fuzz.c \
+ *    src/mac_features/nrf_802154_frame_parser.c -o frame_parser_fuzz
+ * ./frame_parser_fuzz corpus/
+ * @endcode
+ *
+ * The @c --corpus option of @c nrf_802154_frame_parser_bench.c writes seed frames of all supported
+ * formats. With @c FRAME_PARSER_FUZZ_STANDALONE set to 1, the harness gets its own @c main, which
+ * runs the files given on the command line once. This replays a corpus or a crash with any
+ * compiler.
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#ifndef FRAME_PARSER_FUZZ_STANDALONE
+#define FRAME_PARSER_FUZZ_STANDALONE 0 ///< 1 to build a @c main that runs the given input files.
+#endif
+
+#define FRAME_BUFFER_SIZE (PHR_SIZE + MAX_PACKET_SIZE) ///< Size of a frame buffer of the driver.
+#define PHR_LENGTH_MASK   0x7f                         ///< Bits of the PHR with the frame length.
+
+/** Stops the harness if the given condition does not hold. */
+#define FUZZ_CHECK(condition)                                                   \
+    do                                                                          \
+    {                                                                           \
+        if (!(condition))                                                       \
+        {                                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__,    \
+                    #condition);                                                \
+            abort();                                                            \
+        }                                                                       \
+    }                                                                           \
+    while (0)
+
+/** Checks that an offset returned by the parser is valid for the given frame buffer. */
+static void offset_check(uint8_t offset)
+{
+    FUZZ_CHECK((offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
+               (offset < FRAME_BUFFER_SIZE));
+}
+
+/** Checks that a pointer returned by the parser matches the offset of the field. */
+static void pointer_check(const uint8_t * p_frame, const uint8_t * p_field, uint8_t offset)
+{
+    offset_check(offset);
+
+    if ((offset == 0) || (offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
+    {
+        FUZZ_CHECK(p_field == NULL);
+    }
+    else
+    {
+        FUZZ_CHECK(p_field == &p_frame[offset]);
+    }
+}
+
+/** Checks if two results of the MHR parser are equal. Padding of the structure is not compared. */
+static bool mhr_equal(const nrf_802154_frame_parser_mhr_data_t * p_first,
+                      const nrf_802154_frame_parser_mhr_data_t * p_second)
+{
+    return (p_first->p_dst_panid == p_second->p_dst_panid) &&
+           (p_first->p_dst_addr == p_second->p_dst_addr) &&
+           (p_first->p_src_panid == p_second->p_src_panid) &&
+           (p_first->p_src_addr == p_second->p_src_addr) &&
+           (p_first->p_sec_ctrl == p_second->p_sec_ctrl) &&
+           (p_first->dst_addr_size == p_second->dst_addr_size) &&
+           (p_first->src_addr_size == p_second->src_addr_size) &&
+           (p_first->addressing_end_offset == p_second->addressing_end_offset);
+}
+
+/** Checks that the addressing fields found by the MHR parser match the offsets of the fields. */
+static void mhr_check(const uint8_t * p_frame, const nrf_802154_frame_parser_mhr_data_t * p_mhr)
+{
+    bool dst_extended;
+    bool src_extended;
+
+    FUZZ_CHECK(p_mhr->addressing_end_offset ==
+               nrf_802154_frame_parser_addressing_end_offset_get(p_frame));
+    FUZZ_CHECK(p_mhr->p_dst_addr == nrf_802154_frame_parser_dst_addr_get(p_frame, &dst_extended));
+    FUZZ_CHECK(p_mhr->p_src_addr == nrf_802154_frame_parser_src_addr_get(p_frame, &src_extended));
+    FUZZ_CHECK(p_mhr->p_dst_panid == nrf_802154_frame_parser_dst_panid_get(p_frame));
+    FUZZ_CHECK(p_mhr->p_src_panid == nrf_802154_frame_parser_src_panid_get(p_frame));
+    FUZZ_CHECK(p_mhr->p_sec_ctrl == nrf_802154_frame_parser_sec_ctrl_get(p_frame));
+
+    if (p_mhr->p_dst_addr != NULL)
+    {
+        FUZZ_CHECK(p_mhr->dst_addr_size ==
+                   (dst_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE));
+    }
+
+    if (p_mhr->p_src_addr != NULL)
+    {
+        FUZZ_CHECK(p_mhr->src_addr_size ==
+                   (src_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE));
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t size)
+{
+    nrf_802154_frame_parser_mhr_data_t         mhr;
+    const nrf_802154_frame_parser_mhr_data_t * p_cached;
+    uint8_t                                  * p_frame;
+    bool                                       extended;
+    bool                                       parsed;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    p_frame = calloc(1, FRAME_BUFFER_SIZE);
+
+    if (p_frame == NULL)
+    {
+        return 0;
+    }
+
+    memcpy(p_frame, p_data, (size < FRAME_BUFFER_SIZE) ? size : FRAME_BUFFER_SIZE);
+
+    // The radio receives at most MAX_PACKET_SIZE bytes, so the upper bit of the PHR is never set.
+    p_frame[PHR_OFFSET] &= PHR_LENGTH_MASK;
+
+    pointer_check(p_frame,
+                  nrf_802154_frame_parser_dst_addr_get(p_frame, &extended),
+                  nrf_802154_frame_parser_dst_addr_offset_get(p_frame));
+    pointer_check(p_frame,
+                  nrf_802154_frame_parser_src_addr_get(p_frame, &extended),
+                  nrf_802154_frame_parser_src_addr_offset_get(p_frame));
+    pointer_check(p_frame,
+                  nrf_802154_frame_parser_dst_panid_get(p_frame),
+                  nrf_802154_frame_parser_dst_panid_offset_get(p_frame));
+    pointer_check(p_frame,
+                  nrf_802154_frame_parser_src_panid_get(p_frame),
+                  nrf_802154_frame_parser_src_panid_offset_get(p_frame));
+    pointer_check(p_frame,
+                  nrf_802154_frame_parser_sec_ctrl_get(p_frame),
+                  nrf_802154_frame_parser_sec_ctrl_offset_get(p_frame));
+    pointer_check(p_frame,
+                  nrf_802154_frame_parser_key_id_get(p_frame),
+                  nrf_802154_frame_parser_key_id_offset_get(p_frame));
+    pointer_check(p_frame,
+                  nrf_802154_frame_parser_ie_header_get(p_frame),
+                  nrf_802154_frame_parser_ie_header_offset_get(p_frame));
+    offset_check(nrf_802154_frame_parser_dst_addr_end_offset_get(p_frame));
+
+    parsed   = nrf_802154_frame_parser_mhr_parse(p_frame, &mhr);
+    p_cached = nrf_802154_frame_parser_mhr_parse_cached(p_frame);
+
+    FUZZ_CHECK(parsed == (p_cached != NULL));
+
+    if (parsed)
+    {
+        FUZZ_CHECK(mhr_equal(&mhr, p_cached));
+        mhr_check(p_frame, &mhr);
+
+        // The result only matters for not crashing or reading past the buffer.
+        (void)nrf_802154_frame_parser_data_request_is(p_frame, &mhr);
+    }
+
+    // The cached result must follow a change of the Frame Control field of the same buffer.
+    p_frame[PHR_SIZE + 1] ^= IE_PRESENT_BIT;
+    p_cached               = nrf_802154_frame_parser_mhr_parse_cached(p_frame);
+    parsed                 = nrf_802154_frame_parser_mhr_parse(p_frame, &mhr);
+
+    FUZZ_CHECK(parsed == (p_cached != NULL));
+    FUZZ_CHECK(!parsed || mhr_equal(&mhr, p_cached));
+
+    free(p_frame);
+
+    return 0;
+}
+
+#if FRAME_PARSER_FUZZ_STANDALONE
+
+int main(int argc, char ** argv)
+{
+    static uint8_t buffer[FRAME_BUFFER_SIZE];
+
+    for (int i = 1; i < argc; i++)
+    {
+        FILE * p_file = fopen(argv[i], "rb");
+        size_t size;
+
+        if (p_file == NULL)
+        {
+            perror(argv[i]);
+            return 1;
+        }
+
+        size = fread(buffer, 1, sizeof(buffer), p_file);
+        fclose(p_file);
+
+        (void)LLVMFuzzerTestOneInput(buffer, size);
+    }
+
+    printf("%d inputs passed\n", argc - 1);
+
+    return 0;
+}
+
+#endif // FRAME_PARSER_FUZZ_STANDALONE
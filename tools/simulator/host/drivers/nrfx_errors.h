@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   Stand-in for the nrfx error codes used by the host simulator of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRFX_ERRORS_H__
+#define NRFX_ERRORS_H__
+
+#define NRFX_ERROR_BASE_NUM 0x0BAD0000
+
+typedef enum
+{
+    NRFX_SUCCESS                   = (NRFX_ERROR_BASE_NUM + 0),
+    NRFX_ERROR_INTERNAL            = (NRFX_ERROR_BASE_NUM + 1),
+    NRFX_ERROR_NO_MEM              = (NRFX_ERROR_BASE_NUM + 2),
+    NRFX_ERROR_NOT_SUPPORTED       = (NRFX_ERROR_BASE_NUM + 3),
+    NRFX_ERROR_INVALID_PARAM       = (NRFX_ERROR_BASE_NUM + 4),
+    NRFX_ERROR_INVALID_STATE       = (NRFX_ERROR_BASE_NUM + 5),
+    NRFX_ERROR_INVALID_LENGTH      = (NRFX_ERROR_BASE_NUM + 6),
+    NRFX_ERROR_TIMEOUT             = (NRFX_ERROR_BASE_NUM + 7),
+    NRFX_ERROR_FORBIDDEN           = (NRFX_ERROR_BASE_NUM + 8),
+    NRFX_ERROR_NULL                = (NRFX_ERROR_BASE_NUM + 9),
+    NRFX_ERROR_INVALID_ADDR        = (NRFX_ERROR_BASE_NUM + 10),
+    NRFX_ERROR_BUSY                = (NRFX_ERROR_BASE_NUM + 11),
+    NRFX_ERROR_ALREADY_INITIALIZED = (NRFX_ERROR_BASE_NUM + 12),
+} nrfx_err_t;
+
+#endif // NRFX_ERRORS_H__
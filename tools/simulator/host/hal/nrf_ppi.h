@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   Stand-in for the PPI HAL used by the host simulator of the 802.15.4 driver.
+ *
+ * The PPI channels are only named by the peripheral configuration of the driver. The simulated
+ * radio does not use them.
+ *
+ */
+
+#ifndef NRF_PPI_H__
+#define NRF_PPI_H__
+
+#include <nrfx.h>
+
+typedef enum
+{
+    NRF_PPI_CHANNEL0, NRF_PPI_CHANNEL1, NRF_PPI_CHANNEL2, NRF_PPI_CHANNEL3,
+    NRF_PPI_CHANNEL4, NRF_PPI_CHANNEL5, NRF_PPI_CHANNEL6, NRF_PPI_CHANNEL7,
+    NRF_PPI_CHANNEL8, NRF_PPI_CHANNEL9, NRF_PPI_CHANNEL10, NRF_PPI_CHANNEL11,
+    NRF_PPI_CHANNEL12, NRF_PPI_CHANNEL13, NRF_PPI_CHANNEL14, NRF_PPI_CHANNEL15,
+} nrf_ppi_channel_t;
+
+typedef enum
+{
+    NRF_PPI_CHANNEL_GROUP0, NRF_PPI_CHANNEL_GROUP1, NRF_PPI_CHANNEL_GROUP2,
+    NRF_PPI_CHANNEL_GROUP3, NRF_PPI_CHANNEL_GROUP4, NRF_PPI_CHANNEL_GROUP5,
+} nrf_ppi_channel_group_t;
+
+#endif // NRF_PPI_H__
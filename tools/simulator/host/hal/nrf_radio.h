@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   Stand-in for the RADIO HAL used by the host simulator of the 802.15.4 driver.
+ *
+ * The core reads only the addresses of the RADIO events, to pass them to the timer coordinator.
+ * The event registers are kept in @c NRF_RADIO, so that the addresses are valid.
+ *
+ */
+
+#ifndef NRF_RADIO_H__
+#define NRF_RADIO_H__
+
+#include <nrf.h>
+
+#define RADIO_TXPOWER_TXPOWER_Neg40dBm 0xD8UL
+#define RADIO_TXPOWER_TXPOWER_Pos2dBm  0x02UL
+#define RADIO_TXPOWER_TXPOWER_Pos3dBm  0x03UL
+#define RADIO_TXPOWER_TXPOWER_Pos4dBm  0x04UL
+#define RADIO_TXPOWER_TXPOWER_Pos5dBm  0x05UL
+#define RADIO_TXPOWER_TXPOWER_Pos6dBm  0x06UL
+#define RADIO_TXPOWER_TXPOWER_Pos7dBm  0x07UL
+#define RADIO_TXPOWER_TXPOWER_Pos8dBm  0x08UL
+
+typedef struct
+{
+    volatile uint32_t TASKS[64];
+    volatile uint32_t EVENTS[64];
+} NRF_RADIO_Type;
+
+extern NRF_RADIO_Type nrf_802154_sim_radio;
+
+#define NRF_RADIO (&nrf_802154_sim_radio)
+
+/**@brief RADIO events, as offsets of the event registers. */
+typedef enum
+{
+    NRF_RADIO_EVENT_READY      = 0x100,
+    NRF_RADIO_EVENT_ADDRESS    = 0x104,
+    NRF_RADIO_EVENT_PAYLOAD    = 0x108,
+    NRF_RADIO_EVENT_END        = 0x10C,
+    NRF_RADIO_EVENT_DISABLED   = 0x110,
+    NRF_RADIO_EVENT_BCMATCH    = 0x128,
+    NRF_RADIO_EVENT_CRCOK      = 0x130,
+    NRF_RADIO_EVENT_CRCERROR   = 0x134,
+    NRF_RADIO_EVENT_FRAMESTART = 0x138,
+    NRF_RADIO_EVENT_EDEND      = 0x13C,
+    NRF_RADIO_EVENT_CCAIDLE    = 0x144,
+    NRF_RADIO_EVENT_CCABUSY    = 0x148,
+    NRF_RADIO_EVENT_PHYEND     = 0x16C,
+} nrf_radio_event_t;
+
+/**@brief RADIO output power levels. */
+typedef enum
+{
+    NRF_RADIO_TXPOWER_POS8DBM  = RADIO_TXPOWER_TXPOWER_Pos8dBm,
+    NRF_RADIO_TXPOWER_POS7DBM  = RADIO_TXPOWER_TXPOWER_Pos7dBm,
+    NRF_RADIO_TXPOWER_POS6DBM  = RADIO_TXPOWER_TXPOWER_Pos6dBm,
+    NRF_RADIO_TXPOWER_POS5DBM  = RADIO_TXPOWER_TXPOWER_Pos5dBm,
+    NRF_RADIO_TXPOWER_POS4DBM  = RADIO_TXPOWER_TXPOWER_Pos4dBm,
+    NRF_RADIO_TXPOWER_POS3DBM  = RADIO_TXPOWER_TXPOWER_Pos3dBm,
+    NRF_RADIO_TXPOWER_POS2DBM  = RADIO_TXPOWER_TXPOWER_Pos2dBm,
+    NRF_RADIO_TXPOWER_0DBM     = 0x00UL,
+    NRF_RADIO_TXPOWER_NEG4DBM  = 0xFCUL,
+    NRF_RADIO_TXPOWER_NEG8DBM  = 0xF8UL,
+    NRF_RADIO_TXPOWER_NEG12DBM = 0xF4UL,
+    NRF_RADIO_TXPOWER_NEG16DBM = 0xF0UL,
+    NRF_RADIO_TXPOWER_NEG20DBM = 0xECUL,
+    NRF_RADIO_TXPOWER_NEG40DBM = RADIO_TXPOWER_TXPOWER_Neg40dBm,
+} nrf_radio_txpower_t;
+
+/**@brief RADIO CCA modes. */
+typedef enum
+{
+    NRF_RADIO_CCA_MODE_ED,
+    NRF_RADIO_CCA_MODE_CARRIER,
+    NRF_RADIO_CCA_MODE_CARRIER_AND_ED,
+    NRF_RADIO_CCA_MODE_CARRIER_OR_ED,
+    NRF_RADIO_CCA_MODE_CARRIER_AND_ED_TEST1,
+} nrf_radio_cca_mode_t;
+
+static inline uint32_t nrf_radio_event_address_get(const NRF_RADIO_Type * p_reg,
+                                                   nrf_radio_event_t      event)
+{
+    return (uint32_t)(uintptr_t)&p_reg->EVENTS[((uint32_t)event - 0x100U) / sizeof(uint32_t)];
+}
+
+#endif // NRF_RADIO_H__
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   Stand-in for the Zephyr kernel header used by the host simulator of the 802.15.4 driver.
+ *
+ * The open Timer Scheduler in @c nrf_802154_sl_timer.c runs on a Zephyr kernel timer. The simulator
+ * provides the kernel timer and the uptime with the RTC tick of 32768 Hz, so the Timer Scheduler
+ * is built without changes and keeps the granularity it has on the target.
+ *
+ */
+
+#ifndef KERNEL_H__
+#define KERNEL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CONFIG_SYS_CLOCK_TICKS_PER_SEC 32768
+
+#define BUILD_ASSERT(expression) _Static_assert(expression, #expression)
+
+/**@brief Timeout of a kernel timer. */
+typedef struct
+{
+    uint64_t us; ///< Timeout [us].
+} k_timeout_t;
+
+#define K_NO_WAIT    ((k_timeout_t){ .us = 0 })
+#define K_USEC(time) ((k_timeout_t){ .us = (time) })
+
+struct k_timer;
+
+/**@brief Kernel timer, fired as an event of the simulation. */
+struct k_timer
+{
+    void (* expiry_fn)(struct k_timer * p_timer); ///< Function called when the timer expires.
+    void (* stop_fn)(struct k_timer * p_timer);   ///< Function called when the timer is stopped.
+    uint64_t          expiry;                     ///< Expiration time [us].
+    bool              running;                    ///< If the timer is running.
+    struct k_timer  * p_next;                     ///< Next running timer.
+};
+
+#define K_TIMER_DEFINE(name, expiry, stop) \
+    struct k_timer name = { .expiry_fn = (expiry), .stop_fn = (stop) }
+
+/**
+ * @brief Starts the kernel timer.
+ *
+ * The expiration is rounded up to the RTC tick, as by the system timer of the target.
+ *
+ * @param[in]  p_timer   Timer to start.
+ * @param[in]  duration  Time to the expiration.
+ * @param[in]  period    Period of the timer. Only @c K_NO_WAIT is supported.
+ */
+void k_timer_start(struct k_timer * p_timer, k_timeout_t duration, k_timeout_t period);
+
+/**
+ * @brief Stops the kernel timer.
+ *
+ * @param[in]  p_timer  Timer to stop.
+ */
+void k_timer_stop(struct k_timer * p_timer);
+
+/**
+ * @brief Gets the time of the simulation in RTC ticks.
+ */
+int64_t k_uptime_ticks(void);
+
+#endif // KERNEL_H__
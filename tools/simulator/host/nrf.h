@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   Stand-in for the MDK header used by the host simulator of the 802.15.4 driver.
+ *
+ * It provides the chip defines, the interrupt numbers and the CMSIS intrinsics used by the core
+ * and the MAC features. The exclusive access intrinsics are plain accesses, because the simulator
+ * runs every context of the driver on one host thread. @c SCB->ICSR holds the vector of the
+ * interrupt dispatched by the simulator, so that the critical section module sees the priority of
+ * the simulated context.
+ *
+ */
+
+#ifndef NRF_H__
+#define NRF_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef NRF52840_XXAA
+#define NRF52840_XXAA
+#endif
+#ifndef NRF52_SERIES
+#define NRF52_SERIES
+#endif
+
+#define __STATIC_INLINE static inline
+#define __ALIGNED(x)    __attribute__((aligned(x)))
+#define __WEAK          __attribute__((weak))
+#define __USED          __attribute__((used))
+
+/**@brief Interrupt numbers of the peripherals used by the driver. */
+typedef enum
+{
+    RADIO_IRQn      = 1,
+    TIMER0_IRQn     = 8,
+    TIMER1_IRQn     = 9,
+    TIMER2_IRQn     = 10,
+    RTC0_IRQn       = 11,
+    RTC1_IRQn       = 17,
+    SWI0_EGU0_IRQn  = 20,
+    SWI1_EGU1_IRQn  = 21,
+    SWI2_EGU2_IRQn  = 22,
+    SWI3_EGU3_IRQn  = 23,
+    SWI4_EGU4_IRQn  = 24,
+    SWI5_EGU5_IRQn  = 25,
+    TIMER3_IRQn     = 26,
+    TIMER4_IRQn     = 27,
+    RTC2_IRQn       = 36,
+} IRQn_Type;
+
+/**@brief System Control Block, reduced to the Interrupt Control and State Register. */
+typedef struct
+{
+    volatile uint32_t ICSR;
+} SCB_Type;
+
+#define SCB_ICSR_VECTACTIVE_Pos 0U
+#define SCB_ICSR_VECTACTIVE_Msk (0x1FFUL << SCB_ICSR_VECTACTIVE_Pos)
+
+extern SCB_Type nrf_802154_sim_scb;
+
+#define SCB (&nrf_802154_sim_scb)
+
+typedef struct
+{
+    volatile uint32_t TASKS_TRIGGER[16];
+    volatile uint32_t RESERVED[48];
+    volatile uint32_t EVENTS_TRIGGERED[16];
+} NRF_EGU_Type;
+
+typedef struct
+{
+    volatile uint32_t TASKS_START;
+    volatile uint32_t TASKS_STOP;
+    volatile uint32_t TASKS_COUNT;
+    volatile uint32_t TASKS_CLEAR;
+    volatile uint32_t TASKS_SHUTDOWN;
+    volatile uint32_t RESERVED[11];
+    volatile uint32_t TASKS_CAPTURE[6];
+    volatile uint32_t RESERVED1[59];
+    volatile uint32_t EVENTS_COMPARE[6];
+} NRF_TIMER_Type;
+
+typedef struct
+{
+    volatile uint32_t TASKS_START;
+    volatile uint32_t TASKS_STOP;
+    volatile uint32_t TASKS_CLEAR;
+    volatile uint32_t TASKS_TRIGOVRFLW;
+    volatile uint32_t RESERVED[60];
+    volatile uint32_t EVENTS_TICK;
+    volatile uint32_t EVENTS_OVRFLW;
+    volatile uint32_t RESERVED1[14];
+    volatile uint32_t EVENTS_COMPARE[4];
+} NRF_RTC_Type;
+
+static inline uint32_t __get_PRIMASK(void)
+{
+    return 0;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    (void)primask;
+}
+
+static inline void __disable_irq(void)
+{
+    // Intentionally empty
+}
+
+static inline void __enable_irq(void)
+{
+    // Intentionally empty
+}
+
+static inline void __DMB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __DSB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __ISB(void)
+{
+    // Intentionally empty
+}
+
+static inline void __NOP(void)
+{
+    // Intentionally empty
+}
+
+static inline void __WFE(void)
+{
+    // Intentionally empty
+}
+
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint32_t)__builtin_clz(value);
+}
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0U;
+
+    for (uint32_t i = 0U; i < 32U; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1U);
+    }
+
+    return result;
+}
+
+static inline uint8_t __LDREXB(volatile uint8_t * p_addr)
+{
+    return *p_addr;
+}
+
+static inline uint32_t __STREXB(uint8_t value, volatile uint8_t * p_addr)
+{
+    *p_addr = value;
+
+    return 0U;
+}
+
+static inline uint32_t __LDREXW(volatile uint32_t * p_addr)
+{
+    return *p_addr;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t * p_addr)
+{
+    *p_addr = value;
+
+    return 0U;
+}
+
+static inline void __CLREX(void)
+{
+    // Intentionally empty
+}
+
+#endif // NRF_H__
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   Stand-in for the nrfx header used by the host simulator of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRFX_H__
+#define NRFX_H__
+
+#include <nrf.h>
+#include <drivers/nrfx_errors.h>
+
+#define NRFX_CONCAT_2(p1, p2)      NRFX_CONCAT_2_(p1, p2)
+#define NRFX_CONCAT_2_(p1, p2)     p1 ## p2
+#define NRFX_CONCAT_3(p1, p2, p3)  NRFX_CONCAT_3_(p1, p2, p3)
+#define NRFX_CONCAT_3_(p1, p2, p3) p1 ## p2 ## p3
+
+#define NRFX_STATIC_ASSERT(expression) _Static_assert(expression, #expression)
+
+#define NRFX_ASSERT(expression)
+
+extern NRF_EGU_Type   nrf_802154_sim_egu[6];
+extern NRF_TIMER_Type nrf_802154_sim_timer[5];
+extern NRF_RTC_Type   nrf_802154_sim_rtc[3];
+
+#define NRF_EGU0   (&nrf_802154_sim_egu[0])
+#define NRF_EGU1   (&nrf_802154_sim_egu[1])
+#define NRF_EGU2   (&nrf_802154_sim_egu[2])
+#define NRF_EGU3   (&nrf_802154_sim_egu[3])
+#define NRF_EGU4   (&nrf_802154_sim_egu[4])
+#define NRF_EGU5   (&nrf_802154_sim_egu[5])
+#define NRF_TIMER0 (&nrf_802154_sim_timer[0])
+#define NRF_TIMER1 (&nrf_802154_sim_timer[1])
+#define NRF_TIMER2 (&nrf_802154_sim_timer[2])
+#define NRF_TIMER3 (&nrf_802154_sim_timer[3])
+#define NRF_TIMER4 (&nrf_802154_sim_timer[4])
+#define NRF_RTC0   (&nrf_802154_sim_rtc[0])
+#define NRF_RTC1   (&nrf_802154_sim_rtc[1])
+#define NRF_RTC2   (&nrf_802154_sim_rtc[2])
+
+#endif // NRFX_H__
@@ -0,0 +1,668 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the event scheduler, the platform and the air medium of the host
+ *   simulator of the 802.15.4 driver.
+ *
+ * The platform provides the interrupts, the clock, the random numbers, the high precision timer and
+ * the Zephyr kernel timer of the open Timer Scheduler. Interrupts are never pending while the
+ * scenario calls the driver, because events are dispatched only by @ref nrf_802154_sim_run.
+ *
+ * The air medium delivers the frames of the driver to the peers and the frames of the peers to the
+ * model of the radio. A peer receives a frame of the driver addressed to it on its channel, and
+ * transmits an Imm-Ack after @c TURNAROUND_TIME if the ACK is requested and @c ack_enabled is set.
+ * Enh-Acks are not generated.
+ *
+ */
+
+#include "nrf_802154_sim.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <kernel.h>
+#include <nrf.h>
+#include <nrfx.h>
+#include "hal/nrf_radio.h"
+#include <soc/nrfx_coredep.h>
+
+#include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "platform/clock/nrf_802154_clock.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#include "platform/irq/nrf_802154_irq.h"
+#include "platform/random/nrf_802154_random.h"
+
+#define CMSIS_IRQ_NUM_VECTACTIVE_DIFF 16      ///< Offset of the interrupt numbers in VECTACTIVE.
+#define BUSY_PERIODS_NUM              8       ///< Number of busy periods of the channels.
+#define IRQS_NUM                      64      ///< Number of the simulated interrupts.
+#define POWER_CLOCK_IRQn              0       ///< Interrupt of the clock.
+#define ACK_DSN_OFFSET                3       ///< DSN of an Imm-Ack, including the PHR.
+#define BROADCAST_ADDRESS_SHORT       0xFFFFU ///< Broadcast short address and PAN ID.
+
+/** @brief Period in which a channel is busy. */
+typedef struct
+{
+    uint8_t  channel; ///< Busy channel.
+    uint64_t start;   ///< Start of the period [us].
+    uint64_t end;     ///< End of the period [us].
+} busy_period_t;
+
+SCB_Type       nrf_802154_sim_scb;
+NRF_RADIO_Type nrf_802154_sim_radio;
+NRF_EGU_Type   nrf_802154_sim_egu[6];
+NRF_TIMER_Type nrf_802154_sim_timer[5];
+NRF_RTC_Type   nrf_802154_sim_rtc[3];
+
+static uint64_t                 m_now;                  ///< Time of the simulation [us].
+static nrf_802154_sim_event_t * mp_events;              ///< Scheduled events, sorted by time.
+static nrf_802154_sim_peer_t  * mp_peers;               ///< Peers on the air medium.
+static busy_period_t            m_busy[BUSY_PERIODS_NUM]; ///< Busy periods of the channels.
+static uint32_t                 m_busy_next;            ///< Next busy period to overwrite.
+static uint32_t                 m_random;               ///< State of the random numbers.
+static bool                     m_irq_enabled[IRQS_NUM]; ///< If the interrupts are enabled.
+
+static bool                   m_hfclk_running;          ///< If the HFCLK is running.
+static nrf_802154_sim_event_t m_hfclk_event;            ///< Start of the HFCLK.
+
+static struct k_timer       * mp_k_timers;              ///< Running kernel timers.
+static nrf_802154_sim_event_t m_k_timer_event;          ///< Expiration of the first kernel timer.
+
+static nrf_802154_sim_frame_t * mp_dut_frame;           ///< Frame of the driver on the air.
+static nrf_802154_sim_event_t   m_dut_frame_event;      ///< End of the frame of the driver.
+
+/***************************************************************************************************
+ * @section Event scheduler
+ **************************************************************************************************/
+
+void nrf_802154_sim_event_cancel(nrf_802154_sim_event_t * p_event)
+{
+    nrf_802154_sim_event_t ** pp_item = &mp_events;
+
+    while (*pp_item != NULL)
+    {
+        if (*pp_item == p_event)
+        {
+            *pp_item = p_event->p_next;
+            break;
+        }
+
+        pp_item = &(*pp_item)->p_next;
+    }
+
+    p_event->scheduled = false;
+    p_event->p_next    = NULL;
+}
+
+void nrf_802154_sim_event_schedule(nrf_802154_sim_event_t * p_event, uint64_t time)
+{
+    nrf_802154_sim_event_t ** pp_item = &mp_events;
+
+    nrf_802154_sim_event_cancel(p_event);
+
+    // Events of the same time are dispatched in the order they are scheduled.
+    while ((*pp_item != NULL) && ((*pp_item)->time <= time))
+    {
+        pp_item = &(*pp_item)->p_next;
+    }
+
+    p_event->time      = time;
+    p_event->scheduled = true;
+    p_event->p_next    = *pp_item;
+    *pp_item           = p_event;
+}
+
+/** @brief Dispatches the event in the context of its interrupt. */
+static void event_dispatch(nrf_802154_sim_event_t * p_event)
+{
+    uint32_t icsr = SCB->ICSR;
+
+    if (p_event->irqn != NRF_802154_SIM_NO_IRQ)
+    {
+        SCB->ICSR = p_event->irqn + CMSIS_IRQ_NUM_VECTACTIVE_DIFF;
+    }
+
+    p_event->handler(p_event->p_context);
+
+    SCB->ICSR = icsr;
+}
+
+/** @brief Dispatches the first event if it is due at @p end. */
+static bool event_next_dispatch(uint64_t end)
+{
+    nrf_802154_sim_event_t * p_event = mp_events;
+
+    if ((p_event == NULL) || (p_event->time > end))
+    {
+        return false;
+    }
+
+    mp_events          = p_event->p_next;
+    p_event->p_next    = NULL;
+    p_event->scheduled = false;
+
+    if (p_event->time > m_now)
+    {
+        m_now = p_event->time;
+    }
+
+    event_dispatch(p_event);
+
+    return true;
+}
+
+void nrf_802154_sim_run(uint64_t duration)
+{
+    uint64_t end = m_now + duration;
+
+    while (event_next_dispatch(end))
+    {
+        // Intentionally empty
+    }
+
+    m_now = end;
+}
+
+bool nrf_802154_sim_run_until(const volatile uint32_t * p_condition, uint64_t timeout)
+{
+    uint64_t end = m_now + timeout;
+
+    while (*p_condition == 0U)
+    {
+        if (!event_next_dispatch(end))
+        {
+            m_now = end;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint64_t nrf_802154_sim_time_get(void)
+{
+    return m_now;
+}
+
+
+void nrf_802154_sim_reset(uint32_t seed)
+{
+    m_now           = 0U;
+    mp_events       = NULL;
+    mp_peers        = NULL;
+    mp_k_timers     = NULL;
+    mp_dut_frame    = NULL;
+    m_busy_next     = 0U;
+    m_random        = (seed != 0U) ? seed : 1U;
+    m_hfclk_running = false;
+    SCB->ICSR       = 0U;
+
+    memset(m_busy, 0, sizeof(m_busy));
+    memset(m_irq_enabled, 0, sizeof(m_irq_enabled));
+    memset(&m_hfclk_event, 0, sizeof(m_hfclk_event));
+    memset(&m_k_timer_event, 0, sizeof(m_k_timer_event));
+    memset(&m_dut_frame_event, 0, sizeof(m_dut_frame_event));
+}
+
+/***************************************************************************************************
+ * @section Platform
+ **************************************************************************************************/
+
+void nrfx_coredep_delay_us(uint32_t time_us)
+{
+    m_now += time_us;
+}
+
+void nrf_802154_irq_init(uint32_t irqn, uint32_t prio, nrf_802154_isr_t isr)
+{
+    (void)irqn;
+    (void)prio;
+    (void)isr;
+}
+
+void nrf_802154_irq_enable(uint32_t irqn)
+{
+    assert(irqn < IRQS_NUM);
+
+    m_irq_enabled[irqn] = true;
+}
+
+void nrf_802154_irq_disable(uint32_t irqn)
+{
+    assert(irqn < IRQS_NUM);
+
+    m_irq_enabled[irqn] = false;
+}
+
+void nrf_802154_irq_set_pending(uint32_t irqn)
+{
+    // The SWI backends are not built into the simulator.
+    (void)irqn;
+    assert(false);
+}
+
+void nrf_802154_irq_clear_pending(uint32_t irqn)
+{
+    (void)irqn;
+}
+
+bool nrf_802154_irq_is_enabled(uint32_t irqn)
+{
+    assert(irqn < IRQS_NUM);
+
+    return m_irq_enabled[irqn];
+}
+
+uint32_t nrf_802154_irq_priority_get(uint32_t irqn)
+{
+    // All events are dispatched one at a time, so all interrupts have the same priority.
+    (void)irqn;
+
+    return NRF_802154_IRQ_PRIORITY;
+}
+
+static void hfclk_started(void * p_context)
+{
+    (void)p_context;
+
+    m_hfclk_running = true;
+    nrf_802154_clock_hfclk_ready();
+}
+
+void nrf_802154_clock_init(void)
+{
+    m_hfclk_running = false;
+}
+
+void nrf_802154_clock_deinit(void)
+{
+    nrf_802154_sim_event_cancel(&m_hfclk_event);
+    m_hfclk_running = false;
+}
+
+void nrf_802154_clock_hfclk_start(void)
+{
+    m_hfclk_event.handler = hfclk_started;
+    m_hfclk_event.irqn    = POWER_CLOCK_IRQn;
+
+    nrf_802154_sim_event_schedule(&m_hfclk_event, m_now + NRF_802154_SIM_HFCLK_START_TIME);
+}
+
+void nrf_802154_clock_hfclk_stop(void)
+{
+    nrf_802154_sim_event_cancel(&m_hfclk_event);
+    m_hfclk_running = false;
+}
+
+bool nrf_802154_clock_hfclk_is_running(void)
+{
+    return m_hfclk_running;
+}
+
+void nrf_802154_random_init(void)
+{
+    // Intentionally empty: the seed is set by nrf_802154_sim_reset.
+}
+
+void nrf_802154_random_deinit(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    // xorshift32
+    m_random ^= m_random << 13;
+    m_random ^= m_random >> 17;
+    m_random ^= m_random << 5;
+
+    return m_random;
+}
+
+uint32_t nrf_802154_hp_timer_current_time_get(void)
+{
+    return (uint32_t)m_now;
+}
+
+/***************************************************************************************************
+ * @section Kernel timer
+ **************************************************************************************************/
+
+/** @brief Schedules the event of the first running kernel timer. */
+static void k_timer_event_update(void)
+{
+    if (mp_k_timers == NULL)
+    {
+        nrf_802154_sim_event_cancel(&m_k_timer_event);
+    }
+    else
+    {
+        nrf_802154_sim_event_schedule(&m_k_timer_event, mp_k_timers->expiry);
+    }
+}
+
+static void k_timer_unlink(struct k_timer * p_timer)
+{
+    struct k_timer ** pp_item = &mp_k_timers;
+
+    while (*pp_item != NULL)
+    {
+        if (*pp_item == p_timer)
+        {
+            *pp_item = p_timer->p_next;
+            break;
+        }
+
+        pp_item = &(*pp_item)->p_next;
+    }
+
+    p_timer->p_next  = NULL;
+    p_timer->running = false;
+}
+
+static void k_timer_expired(void * p_context)
+{
+    (void)p_context;
+
+    while ((mp_k_timers != NULL) && (mp_k_timers->expiry <= m_now))
+    {
+        struct k_timer * p_timer = mp_k_timers;
+
+        k_timer_unlink(p_timer);
+        p_timer->expiry_fn(p_timer);
+    }
+
+    k_timer_event_update();
+}
+
+void k_timer_start(struct k_timer * p_timer, k_timeout_t duration, k_timeout_t period)
+{
+    struct k_timer ** pp_item = &mp_k_timers;
+    uint64_t          ticks;
+
+    (void)period;
+    assert(period.us == 0U);
+
+    k_timer_unlink(p_timer);
+
+    // The timer expires at the first RTC tick at or after the requested time.
+    ticks = ((m_now + duration.us) * CONFIG_SYS_CLOCK_TICKS_PER_SEC + 999999U) / 1000000U;
+
+    p_timer->expiry  = (ticks * 1000000U + CONFIG_SYS_CLOCK_TICKS_PER_SEC - 1U) /
+                       CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+    p_timer->running = true;
+
+    while ((*pp_item != NULL) && ((*pp_item)->expiry <= p_timer->expiry))
+    {
+        pp_item = &(*pp_item)->p_next;
+    }
+
+    p_timer->p_next = *pp_item;
+    *pp_item        = p_timer;
+
+    m_k_timer_event.handler = k_timer_expired;
+    m_k_timer_event.irqn    = RTC2_IRQn;
+
+    k_timer_event_update();
+}
+
+void k_timer_stop(struct k_timer * p_timer)
+{
+    bool was_running = p_timer->running;
+
+    k_timer_unlink(p_timer);
+    k_timer_event_update();
+
+    if (was_running && (p_timer->stop_fn != NULL))
+    {
+        p_timer->stop_fn(p_timer);
+    }
+}
+
+int64_t k_uptime_ticks(void)
+{
+    return (int64_t)((m_now * CONFIG_SYS_CLOCK_TICKS_PER_SEC) / 1000000U);
+}
+
+/***************************************************************************************************
+ * @section Air medium
+ **************************************************************************************************/
+
+/** @brief Checks if the frame is addressed to the peer. */
+static bool peer_is_destination(const nrf_802154_sim_peer_t * p_peer, const uint8_t * p_psdu)
+{
+    bool            extended;
+    const uint8_t * p_addr  = nrf_802154_frame_parser_dst_addr_get(p_psdu, &extended);
+    const uint8_t * p_panid = nrf_802154_frame_parser_dst_panid_get(p_psdu);
+
+    if (p_addr == NULL)
+    {
+        return false;
+    }
+
+    if (p_panid != NULL)
+    {
+        uint16_t panid = (uint16_t)(p_panid[0] | (p_panid[1] << 8));
+
+        if ((panid != p_peer->pan_id) && (panid != BROADCAST_ADDRESS_SHORT))
+        {
+            return false;
+        }
+    }
+
+    if (extended)
+    {
+        return memcmp(p_addr, p_peer->extended_addr, EXTENDED_ADDRESS_SIZE) == 0;
+    }
+    else
+    {
+        uint16_t addr = (uint16_t)(p_addr[0] | (p_addr[1] << 8));
+
+        return (addr == p_peer->short_addr) || (addr == BROADCAST_ADDRESS_SHORT);
+    }
+}
+
+/** @brief Processes a frame of the driver received by the peer. */
+static void peer_frame_receive(nrf_802154_sim_peer_t * p_peer, const uint8_t * p_psdu)
+{
+    if ((p_psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) == FRAME_TYPE_ACK)
+    {
+        const uint8_t * p_frame = p_peer->frame.psdu;
+
+        if ((p_peer->frame.end != 0U) &&
+            ((p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT) != 0U) &&
+            (p_frame[DSN_OFFSET] == p_psdu[ACK_DSN_OFFSET]))
+        {
+            p_peer->acks_received++;
+        }
+
+        return;
+    }
+
+    if (!peer_is_destination(p_peer, p_psdu))
+    {
+        return;
+    }
+
+    p_peer->frames_received++;
+
+    if (((p_psdu[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT) != 0U) && p_peer->ack_enabled &&
+        !p_peer->frame.on_air)
+    {
+        uint8_t ack[IMM_ACK_LENGTH + PHR_SIZE] = {IMM_ACK_LENGTH, FRAME_TYPE_ACK, 0x00};
+
+        ack[ACK_DSN_OFFSET] = p_psdu[DSN_OFFSET];
+
+        nrf_802154_sim_peer_transmit(p_peer, ack, false, m_now + TURNAROUND_TIME);
+        p_peer->acks_transmitted++;
+    }
+}
+
+/** @brief Delivers the frame of the driver to the peers at its end. */
+static void dut_frame_ended(void * p_context)
+{
+    nrf_802154_sim_frame_t * p_frame = p_context;
+
+    if (!p_frame->on_air)
+    {
+        // The transmission was aborted.
+        return;
+    }
+
+    p_frame->on_air = false;
+
+    for (nrf_802154_sim_peer_t * p_peer = mp_peers; p_peer != NULL; p_peer = p_peer->p_next)
+    {
+        if (p_peer->channel == p_frame->channel)
+        {
+            peer_frame_receive(p_peer, p_frame->psdu);
+        }
+    }
+}
+
+/** @brief Starts and ends a frame of a peer on the air. */
+static void peer_frame_event(void * p_context)
+{
+    nrf_802154_sim_peer_t * p_peer = p_context;
+
+    if (!p_peer->frame.on_air)
+    {
+        p_peer->frame.on_air = true;
+        nrf_802154_sim_event_schedule(&p_peer->event, p_peer->frame.end);
+
+        if (p_peer->frame.channel == nrf_802154_sim_trx_channel_get())
+        {
+            nrf_802154_sim_trx_frame_on_air(&p_peer->frame);
+        }
+    }
+    else
+    {
+        p_peer->frame.on_air = false;
+    }
+}
+
+/** @brief Gets the end of a frame starting at @p start. */
+static uint64_t frame_end_get(const uint8_t * p_psdu, uint64_t start)
+{
+    return start + NRF_802154_SIM_SHR_TIME +
+           (uint64_t)(p_psdu[PHR_OFFSET] + PHR_SIZE) * NRF_802154_SIM_US_PER_OCTET;
+}
+
+void nrf_802154_sim_peer_add(nrf_802154_sim_peer_t * p_peer)
+{
+    p_peer->frames_received  = 0U;
+    p_peer->acks_transmitted = 0U;
+    p_peer->acks_received    = 0U;
+
+    memset(&p_peer->frame, 0, sizeof(p_peer->frame));
+    memset(&p_peer->event, 0, sizeof(p_peer->event));
+
+    p_peer->p_next = mp_peers;
+    mp_peers       = p_peer;
+}
+
+void nrf_802154_sim_peer_transmit(nrf_802154_sim_peer_t * p_peer,
+                                  const uint8_t         * p_psdu,
+                                  bool                    crc_error,
+                                  uint64_t                time)
+{
+    nrf_802154_sim_frame_t * p_frame = &p_peer->frame;
+
+    assert(!p_frame->on_air);
+    assert(p_psdu[PHR_OFFSET] <= MAX_PACKET_SIZE);
+
+    memcpy(p_frame->psdu, p_psdu, p_psdu[PHR_OFFSET] + PHR_SIZE);
+    p_frame->channel   = p_peer->channel;
+    p_frame->crc_error = crc_error;
+    p_frame->start     = time;
+    p_frame->end       = frame_end_get(p_psdu, time);
+    p_frame->p_source  = p_peer;
+
+    p_peer->event.handler   = peer_frame_event;
+    p_peer->event.p_context = p_peer;
+    p_peer->event.irqn      = NRF_802154_SIM_NO_IRQ;
+
+    nrf_802154_sim_event_schedule(&p_peer->event, time);
+}
+
+void nrf_802154_sim_channel_busy_set(uint8_t channel, uint64_t start, uint64_t end)
+{
+    m_busy[m_busy_next].channel = channel;
+    m_busy[m_busy_next].start   = start;
+    m_busy[m_busy_next].end     = end;
+
+    m_busy_next = (m_busy_next + 1U) % BUSY_PERIODS_NUM;
+}
+
+void nrf_802154_sim_air_transmit(nrf_802154_sim_frame_t * p_frame)
+{
+    p_frame->on_air   = true;
+    p_frame->p_source = NULL;
+    p_frame->end      = frame_end_get(p_frame->psdu, p_frame->start);
+
+    mp_dut_frame = p_frame;
+
+    m_dut_frame_event.handler   = dut_frame_ended;
+    m_dut_frame_event.p_context = p_frame;
+    m_dut_frame_event.irqn      = NRF_802154_SIM_NO_IRQ;
+
+    nrf_802154_sim_event_schedule(&m_dut_frame_event, p_frame->end);
+}
+
+bool nrf_802154_sim_air_is_busy(uint8_t channel, uint64_t start, uint64_t end)
+{
+    for (nrf_802154_sim_peer_t * p_peer = mp_peers; p_peer != NULL; p_peer = p_peer->p_next)
+    {
+        const nrf_802154_sim_frame_t * p_frame = &p_peer->frame;
+
+        if ((p_frame->end != 0U) && (p_frame->channel == channel) &&
+            (p_frame->start < end) && (start < p_frame->end))
+        {
+            return true;
+        }
+    }
+
+    for (uint32_t i = 0U; i < BUSY_PERIODS_NUM; i++)
+    {
+        if ((m_busy[i].end != 0U) && (m_busy[i].channel == channel) &&
+            (m_busy[i].start < end) && (start < m_busy[i].end))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file contains the interface of the host simulator of the 802.15.4 driver.
+ *
+ * The simulator runs the core, the MAC features and the open service layer of the driver on the
+ * host. The radio abstraction of @c nrf_802154_trx.h is replaced by a model of the radio in
+ * @c nrf_802154_sim_trx.c, which exchanges frames with scripted peers over a virtual air medium,
+ * and the radio scheduler of the open service layer by @c nrf_802154_sim_rsch.c, which adds the
+ * delayed timeslots.
+ * All contexts of the driver run on one host thread, in virtual time:
+ * - The driver API is called from the thread of the scenario, as from the thread mode of the CPU.
+ * - RADIO events and expirations of the kernel timer are events of the simulation, dispatched by
+ *   @ref nrf_802154_sim_run as interrupts, one at a time and in the order of their time.
+ *
+ */
+
+#ifndef NRF_802154_SIM_H_
+#define NRF_802154_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_802154_SIM_RAMP_UP_TIME     40U        ///< Ramp up time of the radio [us].
+#define NRF_802154_SIM_HFCLK_START_TIME 256U       ///< Start up time of the HFCLK [us].
+#define NRF_802154_SIM_NO_IRQ           UINT32_MAX ///< Event dispatched in the thread mode.
+
+/// Duration of an octet on the air [us].
+#define NRF_802154_SIM_US_PER_OCTET (PHY_US_PER_SYMBOL * PHY_SYMBOLS_PER_OCTET)
+
+/// Duration of the SHR [us].
+#define NRF_802154_SIM_SHR_TIME     (PHY_US_PER_SYMBOL * PHY_SHR_SYMBOLS)
+
+/** @brief Function called when an event of the simulation is dispatched. */
+typedef void (* nrf_802154_sim_handler_t)(void * p_context);
+
+/** @brief Event of the simulation. */
+typedef struct nrf_802154_sim_event_s
+{
+    uint64_t                        time;      ///< Time of the event [us].
+    nrf_802154_sim_handler_t        handler;   ///< Function called when the event is dispatched.
+    void                          * p_context; ///< Context passed to @ref handler.
+    uint32_t                        irqn;      ///< Interrupt in which the event is dispatched.
+    bool                            scheduled; ///< If the event is scheduled.
+    struct nrf_802154_sim_event_s * p_next;    ///< Next scheduled event.
+} nrf_802154_sim_event_t;
+
+/** @brief Frame on the air. */
+typedef struct
+{
+    uint8_t  psdu[MAX_PACKET_SIZE + PHR_SIZE]; ///< PHR and PSDU of the frame.
+    uint8_t  channel;                          ///< Channel of the frame.
+    bool     crc_error;                        ///< If the frame is received with a wrong FCS.
+    uint64_t start;                            ///< Start of the SHR [us].
+    uint64_t end;                              ///< End of the last octet [us].
+    void   * p_source;                         ///< Transmitting peer, NULL for the driver.
+    bool     on_air;                           ///< If the frame is being transmitted.
+} nrf_802154_sim_frame_t;
+
+/** @brief Scripted peer of the driver on the air medium. */
+typedef struct nrf_802154_sim_peer_s
+{
+    uint8_t  channel;                              ///< Channel the peer listens on.
+    uint16_t pan_id;                               ///< PAN ID of the peer.
+    uint16_t short_addr;                           ///< Short address of the peer.
+    uint8_t  extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended address, little endian.
+    bool     ack_enabled;                          ///< If the peer acknowledges frames to it.
+    uint8_t  rssi;                                 ///< RSSI of the frames of the peer [-dBm].
+    uint8_t  lqi;                                  ///< LQI of the frames of the peer.
+
+    uint32_t frames_received;                      ///< Frames of the driver addressed to the peer.
+    uint32_t acks_transmitted;                     ///< ACKs transmitted by the peer.
+    uint32_t acks_received;                        ///< ACKs of the driver received by the peer.
+
+    nrf_802154_sim_frame_t         frame;     ///< Frame transmitted by the peer.
+    nrf_802154_sim_event_t         event;     ///< Event of the transmission of the peer.
+    struct nrf_802154_sim_peer_s * p_next;    ///< Next peer on the air medium.
+} nrf_802154_sim_peer_t;
+
+/**
+ * @brief Resets the simulation.
+ *
+ * Removes all events and peers, sets the time to zero and seeds the random numbers of the driver,
+ * so that every run of a scenario has the same result.
+ *
+ * @param[in]  seed  Seed of the random numbers.
+ */
+void nrf_802154_sim_reset(uint32_t seed);
+
+/**
+ * @brief Gets the time of the simulation.
+ *
+ * @returns Time [us].
+ */
+uint64_t nrf_802154_sim_time_get(void);
+
+/**
+ * @brief Schedules an event of the simulation.
+ *
+ * An event that is already scheduled is moved to the new time.
+ *
+ * @param[inout]  p_event  Event with @c handler, @c p_context and @c irqn filled in.
+ * @param[in]     time     Time of the event [us]. A time in the past dispatches the event next.
+ */
+void nrf_802154_sim_event_schedule(nrf_802154_sim_event_t * p_event, uint64_t time);
+
+/**
+ * @brief Cancels an event of the simulation, if it is scheduled.
+ *
+ * @param[inout]  p_event  Event to cancel.
+ */
+void nrf_802154_sim_event_cancel(nrf_802154_sim_event_t * p_event);
+
+/**
+ * @brief Dispatches the events of the simulation for the given time.
+ *
+ * @param[in]  duration  Time to simulate [us].
+ */
+void nrf_802154_sim_run(uint64_t duration);
+
+/**
+ * @brief Dispatches the events of the simulation until the given condition is met.
+ *
+ * @param[in]  p_condition  Pointer to a flag that ends the run when it is not zero.
+ * @param[in]  timeout      Maximum time to simulate [us].
+ *
+ * @retval true   The condition is met.
+ * @retval false  The timeout expired.
+ */
+bool nrf_802154_sim_run_until(const volatile uint32_t * p_condition, uint64_t timeout);
+
+/**
+ * @brief Adds a peer to the air medium.
+ *
+ * @param[inout]  p_peer  Peer with the configuration filled in. The statistics are cleared.
+ */
+void nrf_802154_sim_peer_add(nrf_802154_sim_peer_t * p_peer);
+
+/**
+ * @brief Transmits a frame from a peer.
+ *
+ * @param[inout]  p_peer     Transmitting peer. Only one frame of a peer is on the air at a time.
+ * @param[in]     p_psdu     PHR and PSDU of the frame. The FCS is not checked.
+ * @param[in]     crc_error  If the frame is received with a wrong FCS.
+ * @param[in]     time       Start of the SHR [us].
+ */
+void nrf_802154_sim_peer_transmit(nrf_802154_sim_peer_t * p_peer,
+                                  const uint8_t         * p_psdu,
+                                  bool                    crc_error,
+                                  uint64_t                time);
+
+/**
+ * @brief Makes the channel busy for the CCA of the driver, as by a device out of the scenario.
+ *
+ * @param[in]  channel  Busy channel.
+ * @param[in]  start    Start of the busy period [us].
+ * @param[in]  end      End of the busy period [us].
+ */
+void nrf_802154_sim_channel_busy_set(uint8_t channel, uint64_t start, uint64_t end);
+
+/**
+ * @brief Puts a frame of the driver on the air medium.
+ *
+ * @note This function is used by the model of the radio.
+ *
+ * @param[inout]  p_frame  Frame with the PSDU, channel, start and end filled in.
+ */
+void nrf_802154_sim_air_transmit(nrf_802154_sim_frame_t * p_frame);
+
+/**
+ * @brief Checks if any frame or busy period overlaps the given period on the channel.
+ *
+ * @note This function is used by the model of the radio for CCA and energy detection.
+ *
+ * @param[in]  channel  Channel to check.
+ * @param[in]  start    Start of the period [us].
+ * @param[in]  end      End of the period [us].
+ */
+bool nrf_802154_sim_air_is_busy(uint8_t channel, uint64_t start, uint64_t end);
+
+/**
+ * @brief Notifies the model of the radio that a frame of a peer starts on the air.
+ *
+ * @param[in]  p_frame  Frame of the peer.
+ */
+void nrf_802154_sim_trx_frame_on_air(const nrf_802154_sim_frame_t * p_frame);
+
+/**
+ * @brief Gets the channel the model of the radio is tuned to.
+ */
+uint8_t nrf_802154_sim_trx_channel_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SIM_H_ */
@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the benchmark of the 802.15.4 driver on the host simulator.
+ *
+ * The benchmark runs the following scenarios against one peer on the air medium and prints the
+ * time and, on Linux, the number of host instructions per frame with @c printf, one JSON object
+ * per line:
+ * - @c rx    Frames of the peer addressed to the driver, without the ACK request.
+ * - @c ack   Frames of the peer addressed to the driver, acknowledged with an Imm-Ack.
+ * - @c csma  Frames of the driver transmitted with CSMA-CA and acknowledged by the peer.
+ *
+ * The counts cover the driver and the model of the radio and of the air medium, which add a fixed
+ * cost per radio event, so they are meant for comparing changes of the driver with each other.
+ *
+ * The simulator is built with the host compiler from the root of the repository, from all sources
+ * of the driver but the radio abstraction, the SWI notification and request modules, the debug
+ * GPIO and trace modules and the alternative implementations of the ACK timeout and AES-CCM:
+ *
+ * @code
+ * cc -O2 -Itools/simulator/host -Itools/simulator -Isrc -Isrc/mac_features \
+ *    -Isrc/platform/random -Isrc/platform/temperature -Inrf_802154_sl/include \
+ *    tools/simulator/nrf_802154_sim_bench.c tools/simulator/nrf_802154_sim.c \
+ *    tools/simulator/nrf_802154_sim_trx.c \
+ *    $(ls src/nrf_802154*.c | grep -v -e _trx -e _swi -e debug_gpio -e _trace) \
+ *    $(ls src/mac_features/nrf_802154*.c | grep -v -e aes_ccm -e /nrf_802154_ack_timeout) \
+ *    src/mac_features/ack_generator/nrf_802154*.c \
+ *    src/platform/temperature/nrf_802154_temperature_none.c \
+ *    $(ls nrf_802154_sl/open/src/nrf_802154*.c | grep -v timer_drift) -o sim_bench
+ * @endcode
+ *
+ * Options:
+ * - @c --frames @c N  Number of frames of each scenario.
+ *
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_sim.h"
+
+#define BENCH_FRAMES_DEFAULT 10000   ///< Default number of frames of each scenario.
+#define BENCH_SEED           1U      ///< Seed of the random numbers of the driver.
+#define BENCH_CHANNEL        11U     ///< Channel of the driver and of the peer.
+#define BENCH_PAN_ID         0xabcdU ///< PAN ID of the driver and of the peer.
+#define BENCH_DUT_ADDR       0x0001U ///< Short address of the driver.
+#define BENCH_PEER_ADDR      0x0002U ///< Short address of the peer.
+#define BENCH_STARTUP_TIME   1000U   ///< Time to start the receiver of the driver [us].
+#define BENCH_FRAME_PERIOD   2000U   ///< Period of the frames of the peer [us].
+#define BENCH_TX_TIMEOUT     100000U ///< Maximum time of a transmission of the driver [us].
+#define DATA_PAYLOAD_SIZE    10U     ///< Size of the payload of the data frames.
+
+/// Size of a data frame with short addresses and a compressed PAN ID, without the PHR.
+#define DATA_FRAME_SIZE      (FCF_SIZE + DSN_SIZE + PAN_ID_SIZE + 2U * SHORT_ADDRESS_SIZE + \
+                              DATA_PAYLOAD_SIZE + FCS_SIZE)
+
+/// Frame transmitted by the driver.
+static uint8_t m_tx_frame[DATA_FRAME_SIZE + PHR_SIZE];
+
+static nrf_802154_sim_peer_t m_peer;        ///< Peer of the driver.
+static uint32_t              m_received;    ///< Frames received by the driver.
+static uint32_t              m_transmitted; ///< Frames of the driver acknowledged by the peer.
+static uint32_t              m_tx_failed;   ///< Failed transmissions of the driver.
+static volatile uint32_t     m_tx_done;     ///< If the current transmission of the driver ended.
+
+void nrf_802154_received_timestamp_raw(uint8_t * p_data, int8_t power, uint8_t lqi, uint32_t time)
+{
+    (void)power;
+    (void)lqi;
+    (void)time;
+
+    m_received++;
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame, uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    if (p_ack != NULL)
+    {
+        m_transmitted++;
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+
+    m_tx_done = 1;
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+
+    m_tx_failed++;
+    m_tx_done = 1;
+}
+
+/** Writes a data frame with short addresses and a compressed PAN ID. */
+static void data_frame_write(uint8_t * p_frame, uint16_t dst, uint16_t src, bool ack_request)
+{
+    memset(p_frame, 0, DATA_FRAME_SIZE + PHR_SIZE);
+
+    p_frame[PHR_OFFSET]            = DATA_FRAME_SIZE;
+    p_frame[FRAME_TYPE_OFFSET]     = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK |
+                                     (ack_request ? ACK_REQUEST_BIT : 0U);
+    p_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT | FRAME_VERSION_1;
+    p_frame[PAN_ID_OFFSET]         = (uint8_t)BENCH_PAN_ID;
+    p_frame[PAN_ID_OFFSET + 1]     = (uint8_t)(BENCH_PAN_ID >> 8);
+    p_frame[DEST_ADDR_OFFSET]      = (uint8_t)dst;
+    p_frame[DEST_ADDR_OFFSET + 1]  = (uint8_t)(dst >> 8);
+    p_frame[DEST_ADDR_OFFSET + 2]  = (uint8_t)src;
+    p_frame[DEST_ADDR_OFFSET + 3]  = (uint8_t)(src >> 8);
+}
+
+/** Starts the simulation with the driver receiving on @ref BENCH_CHANNEL and one peer. */
+static void scenario_init(void)
+{
+    uint8_t pan_id[PAN_ID_SIZE] = {(uint8_t)BENCH_PAN_ID, (uint8_t)(BENCH_PAN_ID >> 8)};
+    uint8_t short_addr[SHORT_ADDRESS_SIZE] =
+    {(uint8_t)BENCH_DUT_ADDR, (uint8_t)(BENCH_DUT_ADDR >> 8)};
+    uint8_t extended_addr[EXTENDED_ADDRESS_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    nrf_802154_sim_reset(BENCH_SEED);
+    nrf_802154_init();
+
+    nrf_802154_pan_id_set(pan_id);
+    nrf_802154_short_address_set(short_addr);
+    nrf_802154_extended_address_set(extended_addr);
+    nrf_802154_channel_set(BENCH_CHANNEL);
+
+    memset(&m_peer, 0, sizeof(m_peer));
+    m_peer.channel     = BENCH_CHANNEL;
+    m_peer.pan_id      = BENCH_PAN_ID;
+    m_peer.short_addr  = BENCH_PEER_ADDR;
+    m_peer.ack_enabled = true;
+    m_peer.rssi        = 60;
+    m_peer.lqi         = 200;
+    nrf_802154_sim_peer_add(&m_peer);
+
+    m_received    = 0;
+    m_transmitted = 0;
+    m_tx_failed   = 0;
+
+    nrf_802154_receive();
+    nrf_802154_sim_run(BENCH_STARTUP_TIME);
+}
+
+/** Puts the driver to sleep and deinitializes it. */
+static void scenario_deinit(void)
+{
+    (void)nrf_802154_sleep();
+    nrf_802154_sim_run(BENCH_STARTUP_TIME);
+    nrf_802154_deinit();
+}
+
+/** Transmits the frames of the peer to the driver, one per @ref BENCH_FRAME_PERIOD. */
+static uint32_t rx_run(uint32_t frames, bool ack_request)
+{
+    uint8_t frame[DATA_FRAME_SIZE + PHR_SIZE];
+
+    data_frame_write(frame, BENCH_DUT_ADDR, BENCH_PEER_ADDR, ack_request);
+
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        frame[DSN_OFFSET] = (uint8_t)i;
+        nrf_802154_sim_peer_transmit(&m_peer, frame, false, nrf_802154_sim_time_get());
+        nrf_802154_sim_run(BENCH_FRAME_PERIOD);
+    }
+
+    return ack_request ? m_peer.acks_received : m_received;
+}
+
+static uint32_t rx_scenario(uint32_t frames)
+{
+    return rx_run(frames, false);
+}
+
+static uint32_t ack_scenario(uint32_t frames)
+{
+    return rx_run(frames, true);
+}
+
+/** Transmits the frames of the driver to the peer with CSMA-CA, one after another. */
+static uint32_t csma_scenario(uint32_t frames)
+{
+    data_frame_write(m_tx_frame, BENCH_PEER_ADDR, BENCH_DUT_ADDR, true);
+
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        m_tx_frame[DSN_OFFSET] = (uint8_t)i;
+        m_tx_done              = 0;
+
+        nrf_802154_transmit_csma_ca_raw(m_tx_frame);
+
+        if (!nrf_802154_sim_run_until(&m_tx_done, BENCH_TX_TIMEOUT))
+        {
+            break;
+        }
+    }
+
+    return m_transmitted;
+}
+
+/// Description of a benchmarked scenario.
+typedef struct
+{
+    const char * p_name;               ///< Name printed in the results.
+    uint32_t (* run)(uint32_t frames); ///< Function running the scenario, returns the successes.
+} scenario_t;
+
+static const scenario_t m_scenarios[] =
+{
+    {"rx",   rx_scenario  },
+    {"ack",  ack_scenario },
+    {"csma", csma_scenario},
+};
+
+/** Opens the counter of instructions retired by this process, or returns -1 if there is none. */
+static int instructions_counter_open(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+/** Starts counting instructions. */
+static void instructions_counter_start(int fd)
+{
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#else
+    (void)fd;
+#endif
+}
+
+/** Stops counting instructions and returns the number of instructions counted. */
+static uint64_t instructions_counter_stop(int fd)
+{
+    uint64_t count = 0;
+
+#if defined(__linux__)
+    if ((fd < 0) ||
+        (ioctl(fd, PERF_EVENT_IOC_DISABLE, 0) != 0) ||
+        (read(fd, &count, sizeof(count)) != sizeof(count)))
+    {
+        count = 0;
+    }
+#else
+    (void)fd;
+#endif
+
+    return count;
+}
+
+/** Returns the monotonic time in nanoseconds. */
+static uint64_t time_ns_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/** Runs a scenario and prints the cost of a single frame. */
+static void scenario_bench(const scenario_t * p_scenario, uint32_t frames, int counter_fd)
+{
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t instructions;
+    uint32_t succeeded;
+
+    scenario_init();
+
+    instructions_counter_start(counter_fd);
+    start = time_ns_get();
+
+    succeeded = p_scenario->run(frames);
+
+    elapsed      = time_ns_get() - start;
+    instructions = instructions_counter_stop(counter_fd);
+
+    scenario_deinit();
+
+    printf("{\"scenario\": \"%s\", \"frames\": %u, \"succeeded\": %u, \"ns_per_frame\": %.2f, "
+           "\"instructions_per_frame\": ",
+           p_scenario->p_name,
+           (unsigned)frames,
+           (unsigned)succeeded,
+           (double)elapsed / frames);
+
+    if (instructions != 0)
+    {
+        printf("%.1f}\n", (double)instructions / frames);
+    }
+    else
+    {
+        printf("null}\n");
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = BENCH_FRAMES_DEFAULT;
+    int      counter_fd;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc))
+        {
+            frames = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (frames == 0)
+    {
+        return 2;
+    }
+
+    counter_fd = instructions_counter_open();
+
+    for (uint32_t i = 0; i < sizeof(m_scenarios) / sizeof(m_scenarios[0]); i++)
+    {
+        scenario_bench(&m_scenarios[i], frames, counter_fd);
+    }
+
+    return 0;
+}
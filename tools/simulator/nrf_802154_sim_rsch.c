@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the radio scheduler of the host simulator of the 802.15.4 driver.
+ *
+ * The scheduler works like @c nrf_802154_sl_rsch.c of the open service layer, which approves
+ * all priorities once the high frequency clock is running, and adds the delayed timeslots that the
+ * open service layer does not support and that CSMA-CA and the delayed operations require.
+ * A delayed timeslot starts when a timer of @c nrf_802154_timer_sched.h expires, so its start is
+ * rounded up to the granularity of the timer scheduler.
+ *
+ */
+
+#include "nrf_802154_sl_rsch.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include <nrf.h>
+
+#include "rsch/nrf_802154_rsch.h"
+#include "platform/clock/nrf_802154_clock.h"
+#include "timer/nrf_802154_timer_sched.h"
+
+/** @brief Delayed timeslot. */
+typedef struct
+{
+    nrf_802154_timer_t  timer;   ///< Timer starting the timeslot.
+    rsch_dly_ts_param_t param;   ///< Parameters of the requested timeslot.
+    bool                pending; ///< If the timeslot is requested and has not started yet.
+} dly_ts_t;
+
+static rsch_prio_t m_prev_prio;
+static bool        m_ready;
+static dly_ts_t    m_dly_ts[RSCH_DLY_TS_NUM];
+
+/**
+ * @brief Notifies the core that the approved RSCH priority has changed.
+ *
+ * @note This function is called from the critical section context and does not preempt
+ *       other critical sections.
+ *
+ * @param[in]  prio  Approved priority level.
+ */
+extern void nrf_802154_rsch_crit_sect_prio_changed(rsch_prio_t prio);
+
+static void dly_ts_started(void * p_context)
+{
+    dly_ts_t * p_dly_ts = p_context;
+
+    p_dly_ts->pending = false;
+    p_dly_ts->param.started_callback(p_dly_ts->param.id);
+}
+
+/***************************************************************************************************
+ * Public API
+ **************************************************************************************************/
+
+void nrf_802154_rsch_init(void)
+{
+    m_ready     = false;
+    m_prev_prio = RSCH_PRIO_IDLE;
+
+    memset(m_dly_ts, 0, sizeof(m_dly_ts));
+}
+
+void nrf_802154_rsch_uninit(void)
+{
+    for (uint32_t i = 0; i < RSCH_DLY_TS_NUM; i++)
+    {
+        (void)nrf_802154_rsch_delayed_timeslot_cancel((rsch_dly_ts_id_t)i);
+    }
+}
+
+void nrf_802154_rsch_continuous_ended(void)
+{
+    // Intentionally empty
+}
+
+bool nrf_802154_rsch_timeslot_request(uint32_t length_us)
+{
+    (void)length_us;
+
+    assert(m_ready);
+
+    return true;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_request(const rsch_dly_ts_param_t * p_dly_ts_param)
+{
+    dly_ts_t * p_dly_ts;
+    uint32_t   now   = nrf_802154_timer_sched_time_get();
+    uint32_t   start = p_dly_ts_param->t0 + p_dly_ts_param->dt;
+
+    assert(p_dly_ts_param->id < RSCH_DLY_TS_NUM);
+
+    p_dly_ts = &m_dly_ts[p_dly_ts_param->id];
+
+    if ((p_dly_ts_param->type == RSCH_DLY_TS_TYPE_PRECISE) && ((int32_t)(start - now) < 0))
+    {
+        return false;
+    }
+
+    (void)nrf_802154_rsch_delayed_timeslot_cancel(p_dly_ts_param->id);
+
+    p_dly_ts->param           = *p_dly_ts_param;
+    p_dly_ts->pending         = true;
+    p_dly_ts->timer.t0        = p_dly_ts_param->t0;
+    p_dly_ts->timer.dt        = p_dly_ts_param->dt;
+    p_dly_ts->timer.callback  = dly_ts_started;
+    p_dly_ts->timer.p_context = p_dly_ts;
+
+    nrf_802154_timer_sched_add(&p_dly_ts->timer, true);
+
+    return true;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id)
+{
+    dly_ts_t * p_dly_ts = &m_dly_ts[dly_ts_id];
+    bool       result   = p_dly_ts->pending;
+
+    if (result)
+    {
+        nrf_802154_timer_sched_remove(&p_dly_ts->timer, NULL);
+        p_dly_ts->pending = false;
+    }
+
+    return result;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_priority_update(rsch_dly_ts_id_t dly_ts_id,
+                                                      rsch_prio_t      dly_ts_prio)
+{
+    dly_ts_t * p_dly_ts = &m_dly_ts[dly_ts_id];
+
+    if (p_dly_ts->pending)
+    {
+        p_dly_ts->param.prio = dly_ts_prio;
+    }
+
+    return p_dly_ts->pending;
+}
+
+bool nrf_802154_rsch_timeslot_is_requested(void)
+{
+    for (uint32_t i = 0; i < RSCH_DLY_TS_NUM; i++)
+    {
+        if (m_dly_ts[i].pending)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_rsch_prec_is_approved(rsch_prec_t prec, rsch_prio_t prio)
+{
+    (void)prec;
+
+    return prio == RSCH_PRIO_IDLE ? true : m_ready;
+}
+
+uint32_t nrf_802154_rsch_timeslot_us_left_get(void)
+{
+    return UINT32_MAX;
+}
+
+void nrf_802154_clock_hfclk_ready(void)
+{
+    m_ready = true;
+    nrf_802154_rsch_crit_sect_prio_changed(RSCH_PRIO_MAX);
+}
+
+void nrf_802154_rsch_crit_sect_prio_request(rsch_prio_t prio)
+{
+    if (m_prev_prio != prio)
+    {
+        if (prio == RSCH_PRIO_IDLE)
+        {
+            nrf_802154_clock_hfclk_stop();
+
+            assert(m_ready);
+
+            m_ready = false;
+
+            nrf_802154_rsch_crit_sect_prio_changed(RSCH_PRIO_IDLE);
+        }
+        else if (m_prev_prio == RSCH_PRIO_IDLE)
+        {
+            assert(!m_ready);
+
+            nrf_802154_clock_hfclk_start();
+        }
+        else
+        {
+            // Intentionally empty
+        }
+
+        m_prev_prio = prio;
+    }
+}
+
+void nrf_802154_rsch_prio_drop_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_rsch_crit_sect_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_critical_section_rsch_enter(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_critical_section_rsch_exit(void)
+{
+    // Intentionally empty
+}
+
+bool nrf_802154_critical_section_rsch_event_is_pending(void)
+{
+    return false;
+}
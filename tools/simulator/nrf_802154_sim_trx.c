@@ -0,0 +1,698 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the model of the radio of the host simulator of the 802.15.4 driver.
+ *
+ * The model implements @c nrf_802154_trx.h on the air medium of @c nrf_802154_sim.c, in place of
+ * @c nrf_802154_trx.c. It keeps the states of the radio abstraction and calls the same handlers of
+ * the core, in the RADIO interrupt and at the times of the RADIO events:
+ * - ADDRESS at the end of the SHR, BCMATCH at the end of the octet given by the BCC, and CRCOK or
+ *   CRCERROR at the end of a received frame.
+ * - CCAIDLE or CCABUSY after the ramp up and @c CCA_TIME, and PHYEND at the end of a transmitted
+ *   frame, which starts after the ramp up.
+ * - The ACK starts @c delay_us after the end of the received frame.
+ *
+ * A received frame is copied to the receive buffer at the ADDRESS event. The LQI of the peer is
+ * written in place of the FCS, as by the RADIO. Frames that start before the receiver is ramped
+ * up, or while the receive buffer is missing, are not received.
+ *
+ */
+
+#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_TRX
+
+#include "nrf_802154_trx.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_sim.h"
+
+#include "hal/nrf_radio.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#include "timer/nrf_802154_timer_coord.h"
+
+#define ED_SAMPLE_BUSY   0x40U ///< ED sample of a busy channel.
+#define ED_SAMPLE_IDLE   0x00U ///< ED sample of an idle channel.
+#define RSSI_SAMPLE_IDLE 100U  ///< RSSI sample when no frame is received [-dBm].
+#define DISABLE_TIME     2U    ///< Time from the DISABLE task to the DISABLED event [us].
+
+static trx_state_t m_state;                   ///< State of the radio.
+static uint8_t     m_channel;                 ///< Channel of the radio.
+static uint8_t   * mp_receive_buffer;         ///< Buffer for the next received frame.
+static bool        m_receive_buffer_missing;  ///< If the receiver waits for a buffer.
+static uint8_t     m_receive_bcc;             ///< BCC set at the start of each frame [bytes].
+static uint8_t     m_bcc;                     ///< BCC of the frame being received [bytes].
+static uint64_t    m_listen_start;            ///< Time the receiver is ramped up [us].
+static uint64_t    m_last_end;                ///< Time of the last END event [us].
+static uint8_t     m_rssi_sample;             ///< Last RSSI sample [-dBm].
+static uint8_t     m_ed_sample;               ///< Result of the energy detection.
+static bool        m_cca_idle;                ///< Result of the last CCA.
+
+/// Notifications of the current reception.
+static nrf_802154_trx_receive_notifications_t m_receive_notifications;
+
+/// Notifications of the current transmission.
+static nrf_802154_trx_transmit_notifications_t m_transmit_notifications;
+
+static const nrf_802154_sim_frame_t * mp_rx_frame; ///< Frame being received, NULL if none.
+static uint8_t                      * mp_rx_data;  ///< Buffer the frame is received to.
+static nrf_802154_sim_frame_t         m_tx_frame;  ///< Frame or ACK being transmitted.
+static nrf_802154_sim_event_t         m_event;     ///< Next RADIO event.
+
+/** @brief Function handling a RADIO event. */
+typedef void (* radio_event_handler_t)(void);
+
+static radio_event_handler_t m_event_handler; ///< Handler of the next RADIO event.
+
+/** @brief Handles the RADIO interrupt, as @c nrf_802154_radio_irq_handler. */
+static void radio_irq_handler(void * p_context)
+{
+    (void)p_context;
+
+    // Prevent interrupting of this handler by requests from higher priority code.
+    nrf_802154_critical_section_forcefully_enter();
+
+    m_event_handler();
+
+    nrf_802154_critical_section_exit();
+}
+
+/** @brief Schedules the next RADIO event. */
+static void radio_event_schedule(radio_event_handler_t handler, uint64_t time)
+{
+    m_event_handler   = handler;
+    m_event.handler   = radio_irq_handler;
+    m_event.p_context = NULL;
+    m_event.irqn      = RADIO_IRQn;
+
+    nrf_802154_sim_event_schedule(&m_event, time);
+}
+
+/** @brief Stops the reception of the current frame. */
+static void rx_frame_release(void)
+{
+    mp_rx_frame = NULL;
+    mp_rx_data  = NULL;
+}
+
+/** @brief Stops the current operation of the radio. */
+static void operation_stop(void)
+{
+    nrf_802154_sim_event_cancel(&m_event);
+    rx_frame_release();
+
+    if (m_tx_frame.on_air)
+    {
+        m_tx_frame.on_air = false;
+    }
+}
+
+/** @brief Gets the end of the given octet of the frame, counted from the PHR. */
+static uint64_t octet_end_get(const nrf_802154_sim_frame_t * p_frame, uint8_t octets)
+{
+    return p_frame->start + NRF_802154_SIM_SHR_TIME +
+           (uint64_t)octets * NRF_802154_SIM_US_PER_OCTET;
+}
+
+/***************************************************************************************************
+ * @section Reception
+ **************************************************************************************************/
+
+static void rx_end(void)
+{
+    const nrf_802154_sim_frame_t * p_frame = mp_rx_frame;
+    uint8_t                      * p_data  = mp_rx_data;
+    const nrf_802154_sim_peer_t  * p_peer  = p_frame->p_source;
+
+    rx_frame_release();
+    m_last_end = p_frame->end;
+
+    if (p_frame->crc_error)
+    {
+        if (m_state == TRX_STATE_RXFRAME)
+        {
+            // The RADIO listens again to the same buffer.
+#if !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
+            nrf_802154_trx_receive_frame_crcerror();
+#endif
+        }
+        else
+        {
+            m_state = TRX_STATE_FINISHED;
+            nrf_802154_trx_receive_ack_crcerror();
+        }
+
+        return;
+    }
+
+    // The RADIO stores the LQI in place of the first octet of the FCS.
+    p_data[p_data[PHR_OFFSET] - 1U] = p_peer->lqi;
+    m_rssi_sample                   = p_peer->rssi;
+
+    if (m_state == TRX_STATE_RXFRAME)
+    {
+        m_state = TRX_STATE_RXFRAME_FINISHED;
+        nrf_802154_trx_receive_frame_received();
+    }
+    else
+    {
+        m_state = TRX_STATE_FINISHED;
+        nrf_802154_trx_receive_ack_received();
+    }
+}
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+static void rx_bcmatch(void)
+{
+    const nrf_802154_sim_frame_t * p_frame = mp_rx_frame;
+    uint8_t                        next_bcc;
+
+    next_bcc = nrf_802154_trx_receive_frame_bcmatched(m_bcc);
+
+    if (mp_rx_frame != p_frame)
+    {
+        // The frame was dropped or the receiver was stopped by the handler.
+        return;
+    }
+
+    if ((next_bcc > m_bcc) && (next_bcc <= (p_frame->psdu[PHR_OFFSET] + PHR_SIZE)))
+    {
+        m_bcc = next_bcc;
+        radio_event_schedule(rx_bcmatch, octet_end_get(p_frame, m_bcc));
+    }
+    else
+    {
+        radio_event_schedule(rx_end, p_frame->end);
+    }
+}
+
+#endif
+
+static void rx_address(void)
+{
+    const nrf_802154_sim_frame_t * p_frame = mp_rx_frame;
+    uint8_t                        length  = p_frame->psdu[PHR_OFFSET] + PHR_SIZE;
+
+    mp_rx_data = mp_receive_buffer;
+    memcpy(mp_rx_data, p_frame->psdu, length);
+
+    if (m_state == TRX_STATE_RXACK)
+    {
+        radio_event_schedule(rx_end, p_frame->end);
+        nrf_802154_trx_receive_ack_started();
+        return;
+    }
+
+    m_bcc = m_receive_bcc;
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+    if (m_bcc <= length)
+    {
+        radio_event_schedule(rx_bcmatch, octet_end_get(p_frame, m_bcc));
+    }
+    else
+#endif
+    {
+        radio_event_schedule(rx_end, p_frame->end);
+    }
+
+    if ((m_receive_notifications & TRX_RECEIVE_NOTIFICATION_STARTED) != 0U)
+    {
+        nrf_802154_trx_receive_frame_started();
+    }
+}
+
+void nrf_802154_sim_trx_frame_on_air(const nrf_802154_sim_frame_t * p_frame)
+{
+    bool listening = (m_state == TRX_STATE_RXFRAME) || (m_state == TRX_STATE_RXACK);
+
+    if (!listening || (mp_rx_frame != NULL) || m_receive_buffer_missing ||
+        (mp_receive_buffer == NULL) || (p_frame->start < m_listen_start))
+    {
+        return;
+    }
+
+    mp_rx_frame = p_frame;
+    radio_event_schedule(rx_address, p_frame->start + NRF_802154_SIM_SHR_TIME);
+}
+
+uint8_t nrf_802154_sim_trx_channel_get(void)
+{
+    return m_channel;
+}
+
+/** @brief Starts listening after the ramp up. */
+static void rx_start(trx_state_t state)
+{
+    operation_stop();
+
+    m_state        = state;
+    m_listen_start = nrf_802154_sim_time_get() + NRF_802154_SIM_RAMP_UP_TIME;
+}
+
+void nrf_802154_trx_receive_frame(uint8_t                                bcc,
+                                  nrf_802154_trx_receive_notifications_t notifications_mask)
+{
+#if !NRF_802154_DISABLE_BCC_MATCHING
+    assert(bcc != 0U);
+#endif
+
+    rx_start(TRX_STATE_RXFRAME);
+
+    m_receive_bcc            = bcc;
+    m_receive_notifications  = notifications_mask;
+    m_receive_buffer_missing = (mp_receive_buffer == NULL);
+}
+
+bool nrf_802154_trx_receive_frame_restart(void)
+{
+    if ((m_state != TRX_STATE_RXFRAME) || (mp_rx_frame != NULL))
+    {
+        return false;
+    }
+
+    m_listen_start = nrf_802154_sim_time_get() + NRF_802154_SIM_RAMP_UP_TIME;
+
+    return true;
+}
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+bool nrf_802154_trx_receive_frame_drop(void)
+{
+    assert(m_state == TRX_STATE_RXFRAME);
+
+    // The RADIO listens again without ramping up.
+    operation_stop();
+
+    return true;
+}
+
+#endif
+
+void nrf_802154_trx_receive_ack(void)
+{
+    rx_start(TRX_STATE_RXACK);
+}
+
+bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer)
+{
+    bool result = false;
+
+    mp_receive_buffer = p_receive_buffer;
+
+    if ((p_receive_buffer != NULL) && m_receive_buffer_missing)
+    {
+        m_receive_buffer_missing = false;
+        result                   = true;
+    }
+
+    return result;
+}
+
+bool nrf_802154_trx_receive_is_buffer_missing(void)
+{
+    return (m_state == TRX_STATE_RXFRAME) && m_receive_buffer_missing;
+}
+
+bool nrf_802154_trx_psdu_is_being_received(void)
+{
+    return mp_rx_data != NULL;
+}
+
+bool nrf_802154_trx_rssi_measure(void)
+{
+    return true;
+}
+
+bool nrf_802154_trx_rssi_measure_is_started(void)
+{
+    return true;
+}
+
+bool nrf_802154_trx_rssi_sample_is_available(void)
+{
+    return true;
+}
+
+uint8_t nrf_802154_trx_rssi_last_sample_get(void)
+{
+    return m_rssi_sample;
+}
+
+/***************************************************************************************************
+ * @section Transmission
+ **************************************************************************************************/
+
+static void tx_phyend(void)
+{
+    m_last_end = m_tx_frame.end;
+
+    if (m_state == TRX_STATE_TXFRAME)
+    {
+        m_state = TRX_STATE_FINISHED;
+        nrf_802154_trx_transmit_frame_transmitted();
+    }
+    else
+    {
+        m_state = TRX_STATE_FINISHED;
+        nrf_802154_trx_transmit_ack_transmitted();
+    }
+}
+
+static void tx_address(void)
+{
+    radio_event_schedule(tx_phyend, m_tx_frame.end);
+
+#if NRF_802154_TX_STARTED_NOTIFY_ENABLED
+    if (m_state == TRX_STATE_TXFRAME)
+    {
+        nrf_802154_trx_transmit_frame_started();
+    }
+    else
+    {
+        nrf_802154_trx_transmit_ack_started();
+    }
+#endif
+}
+
+/** @brief Puts the frame on the air at the end of the ramp up. */
+static void tx_start(void)
+{
+    m_tx_frame.channel = m_channel;
+    m_tx_frame.start   = nrf_802154_sim_time_get();
+
+    nrf_802154_sim_air_transmit(&m_tx_frame);
+
+    radio_event_schedule(tx_address, m_tx_frame.start + NRF_802154_SIM_SHR_TIME);
+}
+
+static void tx_cca_end(void)
+{
+    uint64_t now = nrf_802154_sim_time_get();
+
+    if (nrf_802154_sim_air_is_busy(m_channel, now - CCA_TIME, now))
+    {
+        m_state = TRX_STATE_FINISHED;
+        nrf_802154_trx_transmit_frame_ccabusy();
+        return;
+    }
+
+    // CCAIDLE triggers TXEN, so the frame starts after the ramp up.
+    radio_event_schedule(tx_start, now + NRF_802154_SIM_RAMP_UP_TIME);
+
+    if ((m_transmit_notifications & TRX_TRANSMIT_NOTIFICATION_CCAIDLE) != 0U)
+    {
+        nrf_802154_trx_transmit_frame_ccaidle();
+    }
+}
+
+static void tx_cca_start(void)
+{
+    radio_event_schedule(tx_cca_end, nrf_802154_sim_time_get() + CCA_TIME);
+
+    if ((m_transmit_notifications & TRX_TRANSMIT_NOTIFICATION_CCASTARTED) != 0U)
+    {
+        nrf_802154_trx_transmit_frame_ccastarted();
+    }
+}
+
+void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
+                                   bool                                    cca,
+                                   nrf_802154_trx_transmit_notifications_t notifications_mask,
+                                   nrf_radio_txpower_t                     tx_power)
+{
+    const uint8_t * p_psdu = p_transmit_buffer;
+    uint64_t        now    = nrf_802154_sim_time_get();
+
+    (void)tx_power;
+
+    operation_stop();
+
+    m_state                  = TRX_STATE_TXFRAME;
+    m_transmit_notifications = notifications_mask;
+
+    memcpy(m_tx_frame.psdu, p_psdu, p_psdu[PHR_OFFSET] + PHR_SIZE);
+
+    radio_event_schedule(cca ? tx_cca_start : tx_start, now + NRF_802154_SIM_RAMP_UP_TIME);
+}
+
+bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_us)
+{
+    const uint8_t * p_psdu = p_transmit_buffer;
+    uint64_t        start  = m_last_end + delay_us;
+
+    assert(m_state == TRX_STATE_RXFRAME_FINISHED);
+    assert(p_transmit_buffer != NULL);
+
+    m_state = TRX_STATE_TXACK;
+
+    if (nrf_802154_sim_time_get() + NRF_802154_SIM_RAMP_UP_TIME > start)
+    {
+        // The ramp up of the ACK cannot start on time.
+        return false;
+    }
+
+    memcpy(m_tx_frame.psdu, p_psdu, p_psdu[PHR_OFFSET] + PHR_SIZE);
+
+    radio_event_schedule(tx_start, start);
+
+    return true;
+}
+
+/***************************************************************************************************
+ * @section Other operations
+ **************************************************************************************************/
+
+static void disabled(void)
+{
+    m_state = TRX_STATE_IDLE;
+    nrf_802154_trx_go_idle_finished();
+}
+
+static void standalone_cca_end(void)
+{
+    uint64_t now = nrf_802154_sim_time_get();
+
+    m_cca_idle = !nrf_802154_sim_air_is_busy(m_channel, now - CCA_TIME, now);
+    m_state    = TRX_STATE_FINISHED;
+
+    nrf_802154_trx_standalone_cca_finished(m_cca_idle);
+}
+
+static void energy_detection_end(void)
+{
+    m_state = TRX_STATE_FINISHED;
+    nrf_802154_trx_energy_detection_finished(m_ed_sample);
+}
+
+void nrf_802154_trx_init(void)
+{
+    m_state                  = TRX_STATE_DISABLED;
+    mp_receive_buffer        = NULL;
+    m_receive_buffer_missing = false;
+    m_rssi_sample            = RSSI_SAMPLE_IDLE;
+    m_last_end               = 0U;
+
+    rx_frame_release();
+    memset(&m_tx_frame, 0, sizeof(m_tx_frame));
+    memset(&m_event, 0, sizeof(m_event));
+}
+
+void nrf_802154_trx_enable(void)
+{
+    assert(m_state == TRX_STATE_DISABLED);
+
+    m_state   = TRX_STATE_IDLE;
+    m_channel = nrf_802154_pib_channel_get();
+}
+
+void nrf_802154_trx_disable(void)
+{
+    operation_stop();
+
+    m_state = TRX_STATE_DISABLED;
+}
+
+void nrf_802154_trx_antenna_update(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trx_tx_antenna_select(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    (void)antenna;
+}
+
+void nrf_802154_trx_tx_fem_bypass_set(bool bypass)
+{
+    (void)bypass;
+}
+
+void nrf_802154_trx_channel_set(uint8_t channel)
+{
+    m_channel = channel;
+}
+
+void nrf_802154_trx_cca_configuration_update(void)
+{
+    // Intentionally empty
+}
+
+bool nrf_802154_trx_cca_configuration_is_outdated(void)
+{
+    return false;
+}
+
+void nrf_802154_trx_cca_configuration_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
+{
+    (void)p_cca_cfg;
+}
+
+bool nrf_802154_trx_go_idle(void)
+{
+    switch (m_state)
+    {
+        case TRX_STATE_IDLE:
+            return false;
+
+        case TRX_STATE_GOING_IDLE:
+            return true;
+
+        case TRX_STATE_RXFRAME_FINISHED:
+        case TRX_STATE_FINISHED:
+            m_state = TRX_STATE_GOING_IDLE;
+            radio_event_schedule(disabled, nrf_802154_sim_time_get() + DISABLE_TIME);
+            return true;
+
+        default:
+            assert(false);
+            return false;
+    }
+}
+
+void nrf_802154_trx_standalone_cca(void)
+{
+    operation_stop();
+
+    m_state = TRX_STATE_STANDALONE_CCA;
+    radio_event_schedule(standalone_cca_end,
+                         nrf_802154_sim_time_get() + NRF_802154_SIM_RAMP_UP_TIME + CCA_TIME);
+}
+
+void nrf_802154_trx_continuous_carrier(void)
+{
+    operation_stop();
+
+    m_state = TRX_STATE_CONTINUOUS_CARRIER;
+}
+
+void nrf_802154_trx_continuous_carrier_restart(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trx_modulated_carrier(const void * p_transmit_buffer)
+{
+    (void)p_transmit_buffer;
+
+    operation_stop();
+
+    m_state = TRX_STATE_MODULATED_CARRIER;
+}
+
+void nrf_802154_trx_modulated_carrier_restart(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_trx_energy_detection(uint32_t ed_count)
+{
+    uint64_t start = nrf_802154_sim_time_get() + NRF_802154_SIM_RAMP_UP_TIME;
+    uint64_t end   = start + (uint64_t)ed_count * CCA_TIME;
+
+    operation_stop();
+
+    m_state     = TRX_STATE_ENERGY_DETECTION;
+    m_ed_sample = nrf_802154_sim_air_is_busy(m_channel, start, end) ? ED_SAMPLE_BUSY :
+                  ED_SAMPLE_IDLE;
+
+    radio_event_schedule(energy_detection_end, end);
+}
+
+void nrf_802154_trx_abort(void)
+{
+    switch (m_state)
+    {
+        case TRX_STATE_DISABLED:
+        case TRX_STATE_IDLE:
+        case TRX_STATE_FINISHED:
+            break;
+
+        default:
+            operation_stop();
+            m_state = TRX_STATE_FINISHED;
+            break;
+    }
+}
+
+trx_state_t nrf_802154_trx_state_get(void)
+{
+    return m_state;
+}
+
+/***************************************************************************************************
+ * @section Timestamps
+ **************************************************************************************************/
+
+void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr)
+{
+    // The END, CRCOK and PHYEND events of the model occur at the same time.
+    (void)event_addr;
+}
+
+bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
+{
+    *p_timestamp = (uint32_t)m_last_end;
+
+    return true;
+}
+
+uint32_t nrf_802154_hp_timer_timestamp_get(void)
+{
+    return (uint32_t)m_last_end;
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2017 - 2020, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the tests of the transmit queue of the 802.15.4 driver on the host
+ *   simulator.
+ *
+ * Each test prints its name and result, and the program returns a non-zero status if any test
+ * fails. The tests are built like the benchmark in @c nrf_802154_sim_bench.c, with this file in
+ * place of the benchmark and with the transmit queue and its fairness enabled:
+ *
+ * @code
+ * -DNRF_802154_TX_QUEUE_SIZE=4 -DNRF_802154_PEER_TABLE_ENABLED=1 \
+ * -DNRF_802154_TX_QUEUE_FAIRNESS_ENABLED=1
+ * @endcode
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_sim.h"
+
+#if (NRF_802154_TX_QUEUE_SIZE == 0) || !NRF_802154_TX_QUEUE_FAIRNESS_ENABLED
+#error The tests require NRF_802154_TX_QUEUE_SIZE and NRF_802154_TX_QUEUE_FAIRNESS_ENABLED.
+#endif
+
+#define TEST_SEED         1U      ///< Seed of the random numbers of the driver.
+#define TEST_CHANNEL      11U     ///< Channel of the driver and of the peers.
+#define TEST_PAN_ID       0xabcdU ///< PAN ID of the driver and of the peers.
+#define TEST_DUT_ADDR     0x0001U ///< Short address of the driver.
+#define TEST_PEER_A_ADDR  0x0002U ///< Short address of the peer that does not acknowledge.
+#define TEST_PEER_B_ADDR  0x0003U ///< Short address of the peer that acknowledges.
+#define TEST_STARTUP_TIME 1000U   ///< Time to start the receiver of the driver [us].
+#define TEST_TIMEOUT      100000U ///< Maximum time of a test [us].
+#define TX_EVENTS_MAX     8U      ///< Maximum number of recorded transmit notifications.
+#define DATA_PAYLOAD_SIZE 10U     ///< Size of the payload of the data frames.
+
+/// Size of a data frame with short addresses and a compressed PAN ID, without the PHR.
+#define DATA_FRAME_SIZE   (FCF_SIZE + DSN_SIZE + PAN_ID_SIZE + 2U * SHORT_ADDRESS_SIZE + \
+                           DATA_PAYLOAD_SIZE + FCS_SIZE)
+
+/** Checks a condition of a test and ends the test if it is not met. */
+#define TEST_ASSERT(cond)                                                     \
+    do                                                                        \
+    {                                                                         \
+        if (!(cond))                                                          \
+        {                                                                     \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return false;                                                     \
+        }                                                                     \
+    }                                                                         \
+    while (0)
+
+/// Transmit notification of the driver.
+typedef struct
+{
+    const uint8_t       * p_frame; ///< Transmitted frame.
+    bool                  success; ///< If the frame was acknowledged.
+    nrf_802154_tx_error_t error;   ///< Error of a failed transmission.
+} tx_event_t;
+
+static nrf_802154_sim_peer_t m_peer_a;                   ///< Peer that does not acknowledge.
+static nrf_802154_sim_peer_t m_peer_b;                   ///< Peer that acknowledges.
+static tx_event_t            m_tx_events[TX_EVENTS_MAX]; ///< Transmit notifications in order.
+static volatile uint32_t     m_tx_events_num;            ///< Number of transmit notifications.
+
+static void tx_event_record(const uint8_t * p_frame, bool success, nrf_802154_tx_error_t error)
+{
+    if (m_tx_events_num < TX_EVENTS_MAX)
+    {
+        m_tx_events[m_tx_events_num].p_frame = p_frame;
+        m_tx_events[m_tx_events_num].success = success;
+        m_tx_events[m_tx_events_num].error   = error;
+    }
+
+    m_tx_events_num++;
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame, uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    (void)power;
+    (void)lqi;
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+
+    tx_event_record(p_frame, true, NRF_802154_TX_ERROR_NONE);
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    tx_event_record(p_frame, false, error);
+}
+
+/** Writes a data frame to the given peer, with the ACK request. */
+static void data_frame_write(uint8_t * p_frame, uint16_t dst, uint8_t dsn)
+{
+    memset(p_frame, 0, DATA_FRAME_SIZE + PHR_SIZE);
+
+    p_frame[PHR_OFFSET]            = DATA_FRAME_SIZE;
+    p_frame[FRAME_TYPE_OFFSET]     = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK | ACK_REQUEST_BIT;
+    p_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT | FRAME_VERSION_1;
+    p_frame[DSN_OFFSET]            = dsn;
+    p_frame[PAN_ID_OFFSET]         = (uint8_t)TEST_PAN_ID;
+    p_frame[PAN_ID_OFFSET + 1]     = (uint8_t)(TEST_PAN_ID >> 8);
+    p_frame[DEST_ADDR_OFFSET]      = (uint8_t)dst;
+    p_frame[DEST_ADDR_OFFSET + 1]  = (uint8_t)(dst >> 8);
+    p_frame[DEST_ADDR_OFFSET + 2]  = (uint8_t)TEST_DUT_ADDR;
+    p_frame[DEST_ADDR_OFFSET + 3]  = (uint8_t)(TEST_DUT_ADDR >> 8);
+}
+
+static void peer_init(nrf_802154_sim_peer_t * p_peer, uint16_t short_addr, bool ack_enabled)
+{
+    memset(p_peer, 0, sizeof(*p_peer));
+
+    p_peer->channel     = TEST_CHANNEL;
+    p_peer->pan_id      = TEST_PAN_ID;
+    p_peer->short_addr  = short_addr;
+    p_peer->ack_enabled = ack_enabled;
+    p_peer->rssi        = 60;
+    p_peer->lqi         = 200;
+
+    nrf_802154_sim_peer_add(p_peer);
+}
+
+/** Starts the simulation with the driver receiving on @ref TEST_CHANNEL and two peers. */
+static void test_init(void)
+{
+    uint8_t pan_id[PAN_ID_SIZE] = {(uint8_t)TEST_PAN_ID, (uint8_t)(TEST_PAN_ID >> 8)};
+    uint8_t short_addr[SHORT_ADDRESS_SIZE] =
+    {(uint8_t)TEST_DUT_ADDR, (uint8_t)(TEST_DUT_ADDR >> 8)};
+
+    nrf_802154_sim_reset(TEST_SEED);
+    nrf_802154_init();
+
+    nrf_802154_pan_id_set(pan_id);
+    nrf_802154_short_address_set(short_addr);
+    nrf_802154_channel_set(TEST_CHANNEL);
+
+    peer_init(&m_peer_a, TEST_PEER_A_ADDR, false);
+    peer_init(&m_peer_b, TEST_PEER_B_ADDR, true);
+
+    memset(m_tx_events, 0, sizeof(m_tx_events));
+    m_tx_events_num = 0;
+
+    nrf_802154_receive();
+    nrf_802154_sim_run(TEST_STARTUP_TIME);
+}
+
+/** Puts the driver to sleep and deinitializes it. */
+static void test_deinit(void)
+{
+    (void)nrf_802154_sleep();
+    nrf_802154_sim_run(TEST_STARTUP_TIME);
+    nrf_802154_deinit();
+}
+
+/**
+ * A frame to a peer that does not acknowledge fails with @ref NRF_802154_TX_ERROR_NO_ACK.
+ * The frame queued after it to another peer is then transmitted without another request.
+ */
+static bool test_failure_then_next_queued_frame(void)
+{
+    static uint8_t frame_a[DATA_FRAME_SIZE + PHR_SIZE];
+    static uint8_t frame_b[DATA_FRAME_SIZE + PHR_SIZE];
+
+    data_frame_write(frame_a, TEST_PEER_A_ADDR, 1);
+    data_frame_write(frame_b, TEST_PEER_B_ADDR, 2);
+
+    TEST_ASSERT(nrf_802154_transmit_raw_enqueue(frame_a, true));
+    TEST_ASSERT(nrf_802154_transmit_raw_enqueue(frame_b, true));
+
+    for (uint64_t end = nrf_802154_sim_time_get() + TEST_TIMEOUT;
+         (m_tx_events_num < 2U) && (nrf_802154_sim_time_get() < end);)
+    {
+        nrf_802154_sim_run(TEST_STARTUP_TIME);
+    }
+
+    TEST_ASSERT(m_tx_events_num == 2U);
+
+    TEST_ASSERT(m_tx_events[0].p_frame == frame_a);
+    TEST_ASSERT(!m_tx_events[0].success);
+    TEST_ASSERT(m_tx_events[0].error == NRF_802154_TX_ERROR_NO_ACK);
+
+    TEST_ASSERT(m_tx_events[1].p_frame == frame_b);
+    TEST_ASSERT(m_tx_events[1].success);
+
+    TEST_ASSERT(m_peer_a.frames_received == 1U);
+    TEST_ASSERT(m_peer_b.frames_received == 1U);
+    TEST_ASSERT(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    return true;
+}
+
+/// Test of the transmit queue.
+typedef struct
+{
+    const char * p_name; ///< Name printed with the result.
+    bool (* run)(void);  ///< Function running the test, returns if the test passed.
+} test_t;
+
+static const test_t m_tests[] =
+{
+    {"failure_then_next_queued_frame", test_failure_then_next_queued_frame},
+};
+
+int main(void)
+{
+    uint32_t failed = 0;
+
+    for (uint32_t i = 0; i < sizeof(m_tests) / sizeof(m_tests[0]); i++)
+    {
+        bool passed;
+
+        test_init();
+        passed = m_tests[i].run();
+        test_deinit();
+
+        printf("%s: %s\n", m_tests[i].p_name, passed ? "PASS" : "FAIL");
+
+        if (!passed)
+        {
+            failed++;
+        }
+    }
+
+    return (failed == 0) ? 0 : 1;
+}